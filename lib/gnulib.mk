@@ -0,0 +1,4661 @@
+## DO NOT EDIT! GENERATED AUTOMATICALLY!
+# Copyright (C) 2002-2024 Free Software Foundation, Inc.
+#
+# This file is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This file is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this file.  If not, see <https://www.gnu.org/licenses/>.
+#
+# As a special exception to the GNU General Public License,
+# this file may be distributed as part of a program that
+# contains a configuration script generated by Autoconf, under
+# the same distribution terms as the rest of that program.
+#
+# Generated by gnulib-tool.
+# Reproduce by:
+# gnulib-tool --import \
+#  --lib=libgnu \
+#  --source-base=lib \
+#  --m4-base=m4 \
+#  --doc-base=doc \
+#  --tests-base=tests \
+#  --aux-dir=build-aux \
+#  --gnu-make \
+#  --makefile-name=gnulib.mk.in \
+#  --conditional-dependencies \
+#  --no-libtool \
+#  --macro-prefix=gl \
+#  --no-vc-files \
+#  --avoid=access \
+#  --avoid=btowc \
+#  --avoid=chmod \
+#  --avoid=crypto/af_alg \
+#  --avoid=dup \
+#  --avoid=fchdir \
+#  --avoid=fstat \
+#  --avoid=iswblank \
+#  --avoid=iswctype \
+#  --avoid=iswdigit \
+#  --avoid=iswxdigit \
+#  --avoid=langinfo \
+#  --avoid=lock \
+#  --avoid=mbrtowc \
+#  --avoid=mbsinit \
+#  --avoid=memchr \
+#  --avoid=mkdir \
+#  --avoid=msvc-inval \
+#  --avoid=msvc-nothrow \
+#  --avoid=nl_langinfo \
+#  --avoid=openat-die \
+#  --avoid=opendir \
+#  --avoid=pthread-h \
+#  --avoid=raise \
+#  --avoid=save-cwd \
+#  --avoid=select \
+#  --avoid=setenv \
+#  --avoid=sigprocmask \
+#  --avoid=stat \
+#  --avoid=stdarg \
+#  --avoid=threadlib \
+#  --avoid=tzset \
+#  --avoid=unsetenv \
+#  --avoid=utime \
+#  --avoid=utime-h \
+#  --avoid=wchar \
+#  --avoid=wcrtomb \
+#  --avoid=wctype \
+#  --avoid=wctype-h \
+#  alignasof \
+#  alloca-opt \
+#  binary-io \
+#  bitset \
+#  boot-time \
+#  byteswap \
+#  c-ctype \
+#  c-strcase \
+#  canonicalize-lgpl \
+#  careadlinkat \
+#  close-stream \
+#  copy-file-range \
+#  count-leading-zeros \
+#  count-one-bits \
+#  count-trailing-zeros \
+#  crypto/md5 \
+#  crypto/md5-buffer \
+#  crypto/sha1-buffer \
+#  crypto/sha256-buffer \
+#  crypto/sha512-buffer \
+#  d-type \
+#  diffseq \
+#  double-slash-root \
+#  dtoastr \
+#  dtotimespec \
+#  dup2 \
+#  environ \
+#  execinfo \
+#  faccessat \
+#  fchmodat \
+#  fcntl \
+#  fcntl-h \
+#  fdopendir \
+#  file-has-acl \
+#  filemode \
+#  filename \
+#  filevercmp \
+#  flexmember \
+#  fpieee \
+#  free-posix \
+#  fstatat \
+#  fsusage \
+#  fsync \
+#  futimens \
+#  getline \
+#  getloadavg \
+#  getopt-gnu \
+#  getrandom \
+#  gettime \
+#  gettimeofday \
+#  gitlog-to-changelog \
+#  ieee754-h \
+#  ignore-value \
+#  intprops \
+#  largefile \
+#  libgmp \
+#  lstat \
+#  manywarnings \
+#  memmem-simple \
+#  mempcpy \
+#  memrchr \
+#  memset_explicit \
+#  minmax \
+#  mkostemp \
+#  mktime \
+#  nanosleep \
+#  nproc \
+#  nstrftime \
+#  pathmax \
+#  pipe2 \
+#  pselect \
+#  pthread_sigmask \
+#  qcopy-acl \
+#  readlink \
+#  readlinkat \
+#  regex \
+#  safe-read \
+#  sig2str \
+#  sigdescr_np \
+#  socklen \
+#  stat-time \
+#  std-gnu11 \
+#  stdbool \
+#  stdckdint \
+#  stddef \
+#  stdio \
+#  stpcpy \
+#  strnlen \
+#  strtoimax \
+#  symlink \
+#  sys_stat \
+#  sys_time \
+#  tempname \
+#  time-h \
+#  time_r \
+#  time_rz \
+#  timegm \
+#  timer-time \
+#  timespec-add \
+#  timespec-sub \
+#  unlocked-io \
+#  update-copyright \
+#  utimensat \
+#  vla \
+#  warnings \
+#  year2038
+
+
+MOSTLYCLEANFILES += core *.stackdump
+# Start of GNU Make output.
+ALLOCA = 
+ALLOCA_H = alloca.h
+ALSA_CFLAGS = 
+ALSA_LIBS = 
+AM_DEFAULT_VERBOSITY = 0
+APPLE_UNIVERSAL_BUILD = 0
+AR = ar
+ARFLAGS = cr
+ASSERT_H = 
+AUTO_DEPEND = yes
+AWK = mawk
+BITSIZEOF_PTRDIFF_T = 
+BITSIZEOF_SIG_ATOMIC_T = 
+BITSIZEOF_SIZE_T = 
+BITSIZEOF_WCHAR_T = 
+BITSIZEOF_WINT_T = 
+BLESSMAIL_TARGET = 
+BREW = 
+BUILD_DETAILS = 
+BYTESWAP_H = 
+CAIRO_CFLAGS = 
+CAIRO_LIBS = 
+CAIRO_XCB_CFLAGS = 
+CAIRO_XCB_LIBS = 
+CAIRO_XLIB_CFLAGS = 
+CAIRO_XLIB_LIBS = 
+CC = gcc
+CFLAGS = -g3 -O2
+CFLAGS_SOUND = 
+CHECK_STRUCTS = false
+CLIENTRES = 
+CLIENTW = 
+CLOCK_TIME_LIB = 
+CM_OBJ = cm.o
+COM_ERRLIB = 
+CPP = gcc -E
+CPPFLAGS =  
+CRYPTOLIB = 
+CXX = 
+CXXFLAGS = 
+CYGWIN_OBJ = 
+C_SWITCH_MACHINE = 
+C_SWITCH_SYSTEM = 
+C_SWITCH_X_SITE = 
+DBUS_CFLAGS = 
+DBUS_LIBS = 
+DBUS_OBJ = 
+DEFS = -DHAVE_CONFIG_H
+DESLIB = 
+DIR_HAS_FD_MEMBER = 1
+DOCMISC_W32 = 
+DUMPING = pdumper
+DUMPING_OVERWRITE = --dumping-overwrite
+DYNAMIC_LIB_SECONDARY_SUFFIX = 
+DYNAMIC_LIB_SUFFIX = .so
+DYNLIB_OBJ = 
+ECHO_C = 
+ECHO_N = -n
+ECHO_T = 
+EGREP = /usr/bin/grep -E
+EMACSRES = 
+EMACS_MANIFEST = 
+EMULTIHOP_HIDDEN = 
+EMULTIHOP_VALUE = 
+ENOLINK_HIDDEN = 
+ENOLINK_VALUE = 
+EOVERFLOW_HIDDEN = 
+EOVERFLOW_VALUE = 
+ERRNO_H = 
+EUIDACCESS_LIBGEN = 
+EXECINFO_H = 
+EXEEXT = 
+FILE_HAS_ACL_LIB = 
+FIND_DELETE = -delete
+FIRSTFILE_OBJ = 
+FLOAT_H = 
+FONTCONFIG_CFLAGS = 
+FONTCONFIG_LIBS = 
+FONT_OBJ = 
+FREETYPE_CFLAGS = 
+FREETYPE_LIBS = 
+GCONF_CFLAGS = 
+GCONF_LIBS = 
+GETADDRINFO_A_LIBS = -lanl
+GETLOADAVG_LIBS = 
+GETOPT_CDEFS_H = 
+GETOPT_H = 
+GETRANDOM_LIB = 
+GFILENOTIFY_CFLAGS = 
+GFILENOTIFY_LIBS = 
+GL_CFLAG_ALLOW_WARNINGS = -Wno-error
+GL_CFLAG_GNULIB_WARNINGS =  -Wno-cast-qual -Wno-conversion -Wno-float-equal -Wno-sign-compare -Wno-undef -Wno-unused-function -Wno-unused-parameter -Wno-float-conversion -Wimplicit-fallthrough -Wno-pedantic -Wno-sign-conversion -Wno-type-limits -Wno-unsuffixed-float-constants
+GL_COND_LIBTOOL_CONDITION = 
+GL_COND_OBJ_CANONICALIZE_LGPL_CONDITION = 
+GL_COND_OBJ_CLOSE_CONDITION = 
+GL_COND_OBJ_COPY_FILE_RANGE_CONDITION = 1
+GL_COND_OBJ_DIRFD_CONDITION = 
+GL_COND_OBJ_DUP2_CONDITION = 
+GL_COND_OBJ_ERROR_CONDITION = 
+GL_COND_OBJ_EUIDACCESS_CONDITION = 
+GL_COND_OBJ_EXECINFO_CONDITION = 
+GL_COND_OBJ_FACCESSAT_CONDITION = 
+GL_COND_OBJ_FCHMODAT_CONDITION = 
+GL_COND_OBJ_FCNTL_CONDITION = 1
+GL_COND_OBJ_FDOPENDIR_CONDITION = 
+GL_COND_OBJ_FFSL_CONDITION = 
+GL_COND_OBJ_FFS_CONDITION = 
+GL_COND_OBJ_FLOAT_CONDITION = 
+GL_COND_OBJ_FPENDING_CONDITION = 
+GL_COND_OBJ_FREE_CONDITION = 
+GL_COND_OBJ_FSTATAT_CONDITION = 
+GL_COND_OBJ_FSUSAGE_CONDITION = 1
+GL_COND_OBJ_FSYNC_CONDITION = 
+GL_COND_OBJ_FUTIMENS_CONDITION = 
+GL_COND_OBJ_GETDELIM_CONDITION = 
+GL_COND_OBJ_GETDTABLESIZE_CONDITION = 
+GL_COND_OBJ_GETGROUPS_CONDITION = 
+GL_COND_OBJ_GETLINE_CONDITION = 
+GL_COND_OBJ_GETLOADAVG_CONDITION = 
+GL_COND_OBJ_GETOPT_CONDITION = 
+GL_COND_OBJ_GETPROGNAME_CONDITION = 1
+GL_COND_OBJ_GETRANDOM_CONDITION = 
+GL_COND_OBJ_GETTIMEOFDAY_CONDITION = 
+GL_COND_OBJ_GROUP_MEMBER_CONDITION = 
+GL_COND_OBJ_ITOLD_CONDITION = 
+GL_COND_OBJ_LCHMOD_CONDITION = 
+GL_COND_OBJ_LSTAT_CONDITION = 
+GL_COND_OBJ_MEMPCPY_CONDITION = 
+GL_COND_OBJ_MEMRCHR_CONDITION = 
+GL_COND_OBJ_MEMSET_EXPLICIT_CONDITION = 1
+GL_COND_OBJ_MINI_GMP_GNULIB_CONDITION = 
+GL_COND_OBJ_MKOSTEMP_CONDITION = 
+GL_COND_OBJ_NANOSLEEP_CONDITION = 1
+GL_COND_OBJ_OBSTACK_CONDITION = 1
+GL_COND_OBJ_OPEN_CONDITION = 
+GL_COND_OBJ_PSELECT_CONDITION = 
+GL_COND_OBJ_PTHREAD_SIGMASK_CONDITION = 
+GL_COND_OBJ_RAWMEMCHR_CONDITION = 
+GL_COND_OBJ_READLINKAT_CONDITION = 
+GL_COND_OBJ_READLINK_CONDITION = 
+GL_COND_OBJ_READ_CONDITION = 
+GL_COND_OBJ_REALLOCARRAY_CONDITION = 
+GL_COND_OBJ_REGEX_CONDITION = 
+GL_COND_OBJ_SIG2STR_CONDITION = 1
+GL_COND_OBJ_SIGDESCR_NP_CONDITION = 
+GL_COND_OBJ_STDIO_READ_CONDITION = 
+GL_COND_OBJ_STDIO_WRITE_CONDITION = 
+GL_COND_OBJ_STPCPY_CONDITION = 
+GL_COND_OBJ_STRERROR_CONDITION = 
+GL_COND_OBJ_STRERROR_OVERRIDE_CONDITION = 
+GL_COND_OBJ_STRNLEN_CONDITION = 
+GL_COND_OBJ_STRTOIMAX_CONDITION = 
+GL_COND_OBJ_STRTOLL_CONDITION = 
+GL_COND_OBJ_SYMLINK_CONDITION = 
+GL_COND_OBJ_TIMEGM_CONDITION = 
+GL_COND_OBJ_TIME_RZ_CONDITION = 1
+GL_COND_OBJ_TIME_R_CONDITION = 
+GL_COND_OBJ_UTIMENSAT_CONDITION = 
+GL_GENERATE_ALLOCA_H_CONDITION = 1
+GL_GENERATE_ASSERT_H_CONDITION = 
+GL_GENERATE_BYTESWAP_H_CONDITION = 
+GL_GENERATE_ERRNO_H_CONDITION = 
+GL_GENERATE_EXECINFO_H_CONDITION = 
+GL_GENERATE_FLOAT_H_CONDITION = 
+GL_GENERATE_GETOPT_CDEFS_H_CONDITION = 
+GL_GENERATE_GETOPT_H_CONDITION = 
+GL_GENERATE_GMP_GMP_H_CONDITION = 
+GL_GENERATE_GMP_H_CONDITION = 
+GL_GENERATE_IEEE754_H_CONDITION = 
+GL_GENERATE_LIMITS_H_CONDITION = 1
+GL_GENERATE_MINI_GMP_H_CONDITION = 
+GL_GENERATE_OBSTACK_H_CONDITION = 1
+GL_GENERATE_STDCKDINT_H_CONDITION = 1
+GL_GENERATE_STDDEF_H_CONDITION = 1
+GL_GENERATE_STDINT_H_CONDITION = 
+GL_GNULIB_ACCESS = 0
+GL_GNULIB_ALIGNED_ALLOC = 0
+GL_GNULIB_ALPHASORT = 0
+GL_GNULIB_ATOLL = 0
+GL_GNULIB_CALLOC_GNU = 1
+GL_GNULIB_CALLOC_POSIX = 1
+GL_GNULIB_CANONICALIZE_FILE_NAME = 1
+GL_GNULIB_CHDIR = 0
+GL_GNULIB_CHMOD = 0
+GL_GNULIB_CHOWN = 0
+GL_GNULIB_CLOSE = 1
+GL_GNULIB_CLOSEDIR = 0
+GL_GNULIB_COPY_FILE_RANGE = 1
+GL_GNULIB_CREAT = 0
+GL_GNULIB_CTIME = 0
+GL_GNULIB_DIRFD = 0
+GL_GNULIB_DPRINTF = 0
+GL_GNULIB_DUP = 0
+GL_GNULIB_DUP2 = 1
+GL_GNULIB_DUP3 = 0
+GL_GNULIB_ENVIRON = 1
+GL_GNULIB_EUIDACCESS = 0
+GL_GNULIB_EXECL = 0
+GL_GNULIB_EXECLE = 0
+GL_GNULIB_EXECLP = 0
+GL_GNULIB_EXECV = 0
+GL_GNULIB_EXECVE = 0
+GL_GNULIB_EXECVP = 0
+GL_GNULIB_EXECVPE = 0
+GL_GNULIB_EXPLICIT_BZERO = 0
+GL_GNULIB_FACCESSAT = 1
+GL_GNULIB_FCHDIR = 0
+GL_GNULIB_FCHMODAT = 1
+GL_GNULIB_FCHOWNAT = 0
+GL_GNULIB_FCLOSE = 0
+GL_GNULIB_FCNTL = 1
+GL_GNULIB_FDATASYNC = 0
+GL_GNULIB_FDOPEN = 0
+GL_GNULIB_FDOPENDIR = 1
+GL_GNULIB_FFLUSH = 0
+GL_GNULIB_FFS = 0
+GL_GNULIB_FFSL = 1
+GL_GNULIB_FFSLL = 0
+GL_GNULIB_FGETC = 1
+GL_GNULIB_FGETS = 1
+GL_GNULIB_FOPEN = 1
+GL_GNULIB_FOPEN_GNU = 1
+GL_GNULIB_FPRINTF = 1
+GL_GNULIB_FPRINTF_POSIX = 0
+GL_GNULIB_FPURGE = 0
+GL_GNULIB_FPUTC = 1
+GL_GNULIB_FPUTS = 1
+GL_GNULIB_FREAD = 1
+GL_GNULIB_FREE_POSIX = 1
+GL_GNULIB_FREOPEN = 0
+GL_GNULIB_FSCANF = 1
+GL_GNULIB_FSEEK = 0
+GL_GNULIB_FSEEKO = 0
+GL_GNULIB_FSTAT = 0
+GL_GNULIB_FSTATAT = 1
+GL_GNULIB_FSYNC = 1
+GL_GNULIB_FTELL = 0
+GL_GNULIB_FTELLO = 0
+GL_GNULIB_FTRUNCATE = 0
+GL_GNULIB_FUTIMENS = 1
+GL_GNULIB_FWRITE = 1
+GL_GNULIB_GETC = 1
+GL_GNULIB_GETCHAR = 1
+GL_GNULIB_GETCWD = 0
+GL_GNULIB_GETDELIM = 0
+GL_GNULIB_GETDOMAINNAME = 0
+GL_GNULIB_GETDTABLESIZE = 1
+GL_GNULIB_GETENTROPY = 0
+GL_GNULIB_GETGROUPS = 0
+GL_GNULIB_GETHOSTNAME = 0
+GL_GNULIB_GETLINE = 1
+GL_GNULIB_GETLOADAVG = 1
+GL_GNULIB_GETLOGIN = 0
+GL_GNULIB_GETLOGIN_R = 0
+GL_GNULIB_GETOPT_POSIX = 1
+GL_GNULIB_GETPAGESIZE = 0
+GL_GNULIB_GETPASS = 0
+GL_GNULIB_GETPASS_GNU = 0
+GL_GNULIB_GETPROGNAME = 1
+GL_GNULIB_GETRANDOM = 1
+GL_GNULIB_GETSUBOPT = 0
+GL_GNULIB_GETTIMEOFDAY = 1
+GL_GNULIB_GETUMASK = 0
+GL_GNULIB_GETUSERSHELL = 0
+GL_GNULIB_GRANTPT = 0
+GL_GNULIB_GROUP_MEMBER = 0
+GL_GNULIB_IMAXABS = 0
+GL_GNULIB_IMAXDIV = 0
+GL_GNULIB_ISATTY = 0
+GL_GNULIB_LCHMOD = 0
+GL_GNULIB_LCHOWN = 0
+GL_GNULIB_LINK = 0
+GL_GNULIB_LINKAT = 0
+GL_GNULIB_LOCALTIME = 0
+GL_GNULIB_LSEEK = 0
+GL_GNULIB_LSTAT = 1
+GL_GNULIB_MALLOC_GNU = 1
+GL_GNULIB_MALLOC_POSIX = 1
+GL_GNULIB_MBSCASECMP = 0
+GL_GNULIB_MBSCASESTR = 0
+GL_GNULIB_MBSCHR = 0
+GL_GNULIB_MBSCSPN = 0
+GL_GNULIB_MBSLEN = 0
+GL_GNULIB_MBSNCASECMP = 0
+GL_GNULIB_MBSNLEN = 0
+GL_GNULIB_MBSPBRK = 0
+GL_GNULIB_MBSPCASECMP = 0
+GL_GNULIB_MBSRCHR = 0
+GL_GNULIB_MBSSEP = 0
+GL_GNULIB_MBSSPN = 0
+GL_GNULIB_MBSSTR = 0
+GL_GNULIB_MBSTOK_R = 0
+GL_GNULIB_MBSTOWCS = 0
+GL_GNULIB_MBTOWC = 0
+GL_GNULIB_MDA_ACCESS = 1
+GL_GNULIB_MDA_CHDIR = 1
+GL_GNULIB_MDA_CHMOD = 1
+GL_GNULIB_MDA_CLOSE = 1
+GL_GNULIB_MDA_CREAT = 1
+GL_GNULIB_MDA_DUP = 1
+GL_GNULIB_MDA_DUP2 = 1
+GL_GNULIB_MDA_ECVT = 1
+GL_GNULIB_MDA_EXECL = 1
+GL_GNULIB_MDA_EXECLE = 1
+GL_GNULIB_MDA_EXECLP = 1
+GL_GNULIB_MDA_EXECV = 1
+GL_GNULIB_MDA_EXECVE = 1
+GL_GNULIB_MDA_EXECVP = 1
+GL_GNULIB_MDA_EXECVPE = 1
+GL_GNULIB_MDA_FCLOSEALL = 1
+GL_GNULIB_MDA_FCVT = 1
+GL_GNULIB_MDA_FDOPEN = 1
+GL_GNULIB_MDA_FILENO = 1
+GL_GNULIB_MDA_GCVT = 1
+GL_GNULIB_MDA_GETCWD = 1
+GL_GNULIB_MDA_GETPID = 1
+GL_GNULIB_MDA_GETW = 1
+GL_GNULIB_MDA_ISATTY = 1
+GL_GNULIB_MDA_LSEEK = 1
+GL_GNULIB_MDA_MEMCCPY = 1
+GL_GNULIB_MDA_MKDIR = 1
+GL_GNULIB_MDA_MKTEMP = 1
+GL_GNULIB_MDA_OPEN = 1
+GL_GNULIB_MDA_PUTENV = 1
+GL_GNULIB_MDA_PUTW = 1
+GL_GNULIB_MDA_READ = 1
+GL_GNULIB_MDA_RMDIR = 1
+GL_GNULIB_MDA_STRDUP = 1
+GL_GNULIB_MDA_SWAB = 1
+GL_GNULIB_MDA_TEMPNAM = 1
+GL_GNULIB_MDA_TZSET = 1
+GL_GNULIB_MDA_UMASK = 1
+GL_GNULIB_MDA_UNLINK = 1
+GL_GNULIB_MDA_WRITE = 1
+GL_GNULIB_MEMCHR = 0
+GL_GNULIB_MEMMEM = 1
+GL_GNULIB_MEMPCPY = 1
+GL_GNULIB_MEMRCHR = 1
+GL_GNULIB_MEMSET_EXPLICIT = 1
+GL_GNULIB_MKDIR = 0
+GL_GNULIB_MKDIRAT = 0
+GL_GNULIB_MKDTEMP = 0
+GL_GNULIB_MKFIFO = 0
+GL_GNULIB_MKFIFOAT = 0
+GL_GNULIB_MKNOD = 0
+GL_GNULIB_MKNODAT = 0
+GL_GNULIB_MKOSTEMP = 1
+GL_GNULIB_MKOSTEMPS = 0
+GL_GNULIB_MKSTEMP = 0
+GL_GNULIB_MKSTEMPS = 0
+GL_GNULIB_MKTIME = 1
+GL_GNULIB_NANOSLEEP = 1
+GL_GNULIB_NONBLOCKING = 0
+GL_GNULIB_OBSTACK_PRINTF = 0
+GL_GNULIB_OBSTACK_PRINTF_POSIX = 0
+GL_GNULIB_OPEN = 1
+GL_GNULIB_OPENAT = 0
+GL_GNULIB_OPENDIR = 0
+GL_GNULIB_OVERRIDES_STRUCT_STAT = 0
+GL_GNULIB_PCLOSE = 0
+GL_GNULIB_PERROR = 0
+GL_GNULIB_PIPE = 0
+GL_GNULIB_PIPE2 = 1
+GL_GNULIB_POPEN = 0
+GL_GNULIB_POSIX_MEMALIGN = 0
+GL_GNULIB_POSIX_OPENPT = 0
+GL_GNULIB_PREAD = 0
+GL_GNULIB_PRINTF = 1
+GL_GNULIB_PRINTF_POSIX = 0
+GL_GNULIB_PSELECT = 1
+GL_GNULIB_PTHREAD_SIGMASK = 1
+GL_GNULIB_PTSNAME = 0
+GL_GNULIB_PTSNAME_R = 0
+GL_GNULIB_PUTC = 1
+GL_GNULIB_PUTCHAR = 1
+GL_GNULIB_PUTENV = 0
+GL_GNULIB_PUTS = 1
+GL_GNULIB_PWRITE = 0
+GL_GNULIB_QSORT_R = 0
+GL_GNULIB_RAISE = 0
+GL_GNULIB_RAND = 0
+GL_GNULIB_RANDOM = 0
+GL_GNULIB_RANDOM_R = 0
+GL_GNULIB_RAWMEMCHR = 0
+GL_GNULIB_READ = 1
+GL_GNULIB_READDIR = 0
+GL_GNULIB_READLINK = 1
+GL_GNULIB_READLINKAT = 1
+GL_GNULIB_REALLOCARRAY = 1
+GL_GNULIB_REALLOC_GNU = 1
+GL_GNULIB_REALLOC_POSIX = 1
+GL_GNULIB_REALPATH = 1
+GL_GNULIB_REMOVE = 0
+GL_GNULIB_RENAME = 0
+GL_GNULIB_RENAMEAT = 0
+GL_GNULIB_REWINDDIR = 0
+GL_GNULIB_RMDIR = 0
+GL_GNULIB_RPMATCH = 0
+GL_GNULIB_SCANDIR = 0
+GL_GNULIB_SCANF = 1
+GL_GNULIB_SECURE_GETENV = 0
+GL_GNULIB_SELECT = 0
+GL_GNULIB_SETENV = 0
+GL_GNULIB_SETHOSTNAME = 0
+GL_GNULIB_SIGABBREV_NP = 0
+GL_GNULIB_SIGACTION = 0
+GL_GNULIB_SIGDESCR_NP = 1
+GL_GNULIB_SIGNAL_H_SIGPIPE = 0
+GL_GNULIB_SIGPROCMASK = 0
+GL_GNULIB_SLEEP = 0
+GL_GNULIB_SNPRINTF = 0
+GL_GNULIB_SPRINTF_POSIX = 0
+GL_GNULIB_STAT = 0
+GL_GNULIB_STDIO_H_NONBLOCKING = 0
+GL_GNULIB_STDIO_H_SIGPIPE = 0
+GL_GNULIB_STPCPY = 1
+GL_GNULIB_STPNCPY = 0
+GL_GNULIB_STRCASESTR = 0
+GL_GNULIB_STRCHRNUL = 0
+GL_GNULIB_STRDUP = 0
+GL_GNULIB_STRERROR = 0
+GL_GNULIB_STRERRORNAME_NP = 0
+GL_GNULIB_STRERROR_R = 0
+GL_GNULIB_STRFTIME = 0
+GL_GNULIB_STRNCAT = 0
+GL_GNULIB_STRNDUP = 0
+GL_GNULIB_STRNLEN = 1
+GL_GNULIB_STRPBRK = 0
+GL_GNULIB_STRPTIME = 0
+GL_GNULIB_STRSEP = 0
+GL_GNULIB_STRSIGNAL = 0
+GL_GNULIB_STRSTR = 0
+GL_GNULIB_STRTOD = 0
+GL_GNULIB_STRTOIMAX = 1
+GL_GNULIB_STRTOK_R = 0
+GL_GNULIB_STRTOL = 0
+GL_GNULIB_STRTOLD = 0
+GL_GNULIB_STRTOLL = 0
+GL_GNULIB_STRTOUL = 0
+GL_GNULIB_STRTOULL = 0
+GL_GNULIB_STRTOUMAX = 0
+GL_GNULIB_STRVERSCMP = 0
+GL_GNULIB_SYMLINK = 1
+GL_GNULIB_SYMLINKAT = 0
+GL_GNULIB_SYSTEM_POSIX = 0
+GL_GNULIB_TIME = 0
+GL_GNULIB_TIMEGM = 1
+GL_GNULIB_TIMESPEC_GET = 0
+GL_GNULIB_TIMESPEC_GETRES = 0
+GL_GNULIB_TIME_R = 1
+GL_GNULIB_TIME_RZ = 1
+GL_GNULIB_TMPFILE = 0
+GL_GNULIB_TRUNCATE = 0
+GL_GNULIB_TTYNAME_R = 0
+GL_GNULIB_TZSET = 0
+GL_GNULIB_UNISTD_H_GETOPT = 0
+GL_GNULIB_UNISTD_H_NONBLOCKING = 0
+GL_GNULIB_UNISTD_H_SIGPIPE = 0
+GL_GNULIB_UNLINK = 0
+GL_GNULIB_UNLINKAT = 0
+GL_GNULIB_UNLOCKPT = 0
+GL_GNULIB_UNSETENV = 0
+GL_GNULIB_USLEEP = 0
+GL_GNULIB_UTIMENSAT = 1
+GL_GNULIB_VASPRINTF = 0
+GL_GNULIB_VDPRINTF = 0
+GL_GNULIB_VFPRINTF = 1
+GL_GNULIB_VFPRINTF_POSIX = 0
+GL_GNULIB_VFSCANF = 0
+GL_GNULIB_VPRINTF = 1
+GL_GNULIB_VPRINTF_POSIX = 0
+GL_GNULIB_VSCANF = 0
+GL_GNULIB_VSNPRINTF = 0
+GL_GNULIB_VSPRINTF_POSIX = 0
+GL_GNULIB_WCTOMB = 0
+GL_GNULIB_WRITE = 0
+GL_GNULIB__EXIT = 0
+GMALLOC_OBJ = 
+GMP_H = 
+GNULIBHEADERS_OVERRIDE_WINT_T = 0
+GNULIB_WARN_CFLAGS =  -Wall -Warith-conversion -Wdate-time -Wdisabled-optimization -Wdouble-promotion -Wduplicated-cond -Wextra -Wformat-signedness -Winit-self -Winvalid-pch -Wlogical-op -Wmissing-declarations -Wmissing-include-dirs -Wmissing-prototypes -Wnested-externs -Wnull-dereference -Wold-style-definition -Wopenmp-simd -Wpacked -Wpointer-arith -Wstrict-prototypes -Wsuggest-attribute=format -Wsuggest-attribute=noreturn -Wsuggest-final-methods -Wsuggest-final-types -Wtrampolines -Wuninitialized -Wunknown-pragmas -Wvariadic-macros -Wvector-operation-performance -Wwrite-strings -Warray-bounds=2 -Wattribute-alias=2 -Wformat=2 -Wformat-truncation=2 -Wimplicit-fallthrough=5 -Wshift-overflow=2 -Wuse-after-free=3 -Wvla-larger-than=4031 -Wno-redundant-decls -Wno-missing-field-initializers -Wno-override-init -Wno-sign-compare -Wno-type-limits -Wno-unused-parameter -Wno-format-nonliteral -Wno-bidi-chars
+GNUSTEP_CFLAGS = 
+GNU_OBJC_CFLAGS = 
+GOBJECT_CFLAGS = 
+GOBJECT_LIBS = 
+GREP = /usr/bin/grep
+GSETTINGS_CFLAGS = 
+GSETTINGS_LIBS = 
+GTK_CFLAGS = 
+GTK_LIBS = 
+GTK_OBJ = 
+GZIP_PROG =  # /usr/bin/gzip # (disabled by configure --without-compress-install)
+HAIKU_CFLAGS = 
+HAIKU_CXX_OBJ = 
+HAIKU_LIBS = 
+HAIKU_OBJ = 
+HARFBUZZ_CFLAGS = 
+HARFBUZZ_LIBS = 
+HAVE_ALIGNED_ALLOC = 1
+HAVE_ALLOCA_H = 1
+HAVE_ALPHASORT = 1
+HAVE_ATOLL = 1
+HAVE_BE_APP = no
+HAVE_C99_STDINT_H = 1
+HAVE_CANONICALIZE_FILE_NAME = 1
+HAVE_CHOWN = 1
+HAVE_CLOSEDIR = 1
+HAVE_COPY_FILE_RANGE = 1
+HAVE_DECL_DIRFD = 1
+HAVE_DECL_ECVT = 1
+HAVE_DECL_ENVIRON = 1
+HAVE_DECL_EXECVPE = 1
+HAVE_DECL_FCHDIR = 1
+HAVE_DECL_FCLOSEALL = 1
+HAVE_DECL_FCVT = 1
+HAVE_DECL_FDATASYNC = 1
+HAVE_DECL_FDOPENDIR = 1
+HAVE_DECL_FPURGE = 1
+HAVE_DECL_FSEEKO = 1
+HAVE_DECL_FTELLO = 1
+HAVE_DECL_GCVT = 1
+HAVE_DECL_GETDELIM = 1
+HAVE_DECL_GETDOMAINNAME = 1
+HAVE_DECL_GETLINE = 1
+HAVE_DECL_GETLOADAVG = 1
+HAVE_DECL_GETLOGIN = 1
+HAVE_DECL_GETLOGIN_R = 1
+HAVE_DECL_GETPAGESIZE = 1
+HAVE_DECL_GETUSERSHELL = 1
+HAVE_DECL_GETW = 1
+HAVE_DECL_IMAXABS = 1
+HAVE_DECL_IMAXDIV = 1
+HAVE_DECL_INITSTATE = 1
+HAVE_DECL_LOCALTIME_R = 1
+HAVE_DECL_MEMMEM = 1
+HAVE_DECL_MEMRCHR = 1
+HAVE_DECL_OBSTACK_PRINTF = 1
+HAVE_DECL_POSIX_SPAWN_SETSID = 
+HAVE_DECL_PROGRAM_INVOCATION_NAME = 1
+HAVE_DECL_PUTW = 1
+HAVE_DECL_SETENV = 1
+HAVE_DECL_SETHOSTNAME = 1
+HAVE_DECL_SETSTATE = 1
+HAVE_DECL_SNPRINTF = 1
+HAVE_DECL_STRDUP = 1
+HAVE_DECL_STRERROR_R = 1
+HAVE_DECL_STRNCASECMP = 1
+HAVE_DECL_STRNDUP = 1
+HAVE_DECL_STRNLEN = 1
+HAVE_DECL_STRSIGNAL = 1
+HAVE_DECL_STRTOIMAX = 1
+HAVE_DECL_STRTOK_R = 1
+HAVE_DECL_STRTOUMAX = 1
+HAVE_DECL_TRUNCATE = 1
+HAVE_DECL_TTYNAME_R = 1
+HAVE_DECL_UNSETENV = 1
+HAVE_DECL_VSNPRINTF = 1
+HAVE_DIRENT_H = 1
+HAVE_DPRINTF = 1
+HAVE_DUP3 = 1
+HAVE_ERROR = 1
+HAVE_ERROR_AT_LINE = 1
+HAVE_ERROR_H = 1
+HAVE_EUIDACCESS = 1
+HAVE_EXECVPE = 1
+HAVE_EXPLICIT_BZERO = 1
+HAVE_FACCESSAT = 1
+HAVE_FCHDIR = 1
+HAVE_FCHMODAT = 1
+HAVE_FCHOWNAT = 1
+HAVE_FCNTL = 1
+HAVE_FDATASYNC = 1
+HAVE_FDOPENDIR = 1
+HAVE_FFS = 1
+HAVE_FFSL = 1
+HAVE_FFSLL = 1
+HAVE_FSEEKO = 1
+HAVE_FSTATAT = 1
+HAVE_FSYNC = 1
+HAVE_FTELLO = 1
+HAVE_FTRUNCATE = 1
+HAVE_FUTIMENS = 1
+HAVE_GETDTABLESIZE = 1
+HAVE_GETENTROPY = 1
+HAVE_GETGROUPS = 1
+HAVE_GETHOSTNAME = 1
+HAVE_GETLOGIN = 1
+HAVE_GETOPT_H = 1
+HAVE_GETPAGESIZE = 1
+HAVE_GETPASS = 1
+HAVE_GETPROGNAME = 0
+HAVE_GETRANDOM = 1
+HAVE_GETSUBOPT = 1
+HAVE_GETTIMEOFDAY = 1
+HAVE_GETUMASK = 1
+HAVE_GRANTPT = 1
+HAVE_GROUP_MEMBER = 1
+HAVE_GSETTINGS = no
+HAVE_IMAXABS = 1
+HAVE_IMAXDIV = 1
+HAVE_IMAXDIV_T = 1
+HAVE_INITSTATE = 1
+HAVE_INTTYPES_H = 1
+HAVE_LCHMOD = 1
+HAVE_LCHOWN = 1
+HAVE_LIBGMP = yes
+HAVE_LIBSECCOMP = no
+HAVE_LINK = 1
+HAVE_LINKAT = 1
+HAVE_LSTAT = 1
+HAVE_MACPORTS = 
+HAVE_MAX_ALIGN_T = 1
+HAVE_MBSLEN = 0
+HAVE_MBTOWC = 1
+HAVE_MEMPCPY = 1
+HAVE_MEMSET_EXPLICIT = 0
+HAVE_MKDIRAT = 1
+HAVE_MKDTEMP = 1
+HAVE_MKFIFO = 1
+HAVE_MKFIFOAT = 1
+HAVE_MKNOD = 1
+HAVE_MKNODAT = 1
+HAVE_MKOSTEMP = 1
+HAVE_MKOSTEMPS = 1
+HAVE_MKSTEMP = 1
+HAVE_MKSTEMPS = 1
+HAVE_MODULES = no
+HAVE_NANOSLEEP = 1
+HAVE_NATIVE_COMP = no
+HAVE_OPENAT = 1
+HAVE_OPENDIR = 1
+HAVE_OS_H = 0
+HAVE_PCLOSE = 1
+HAVE_PDUMPER = yes
+HAVE_PGTK = no
+HAVE_PIPE = 1
+HAVE_PIPE2 = 1
+HAVE_POPEN = 1
+HAVE_POSIX_MEMALIGN = 1
+HAVE_POSIX_OPENPT = 1
+HAVE_POSIX_SIGNALBLOCKING = 1
+HAVE_POSIX_SPAWN = 
+HAVE_POSIX_SPAWNATTR_SETFLAGS = 
+HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR = 
+HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP = 
+HAVE_PREAD = 1
+HAVE_PSELECT = 1
+HAVE_PTHREAD_SIGMASK = 1
+HAVE_PTSNAME = 1
+HAVE_PTSNAME_R = 1
+HAVE_PWRITE = 1
+HAVE_QSORT_R = 1
+HAVE_RAISE = 1
+HAVE_RANDOM = 1
+HAVE_RANDOM_H = 1
+HAVE_RANDOM_R = 1
+HAVE_RAWMEMCHR = 1
+HAVE_READDIR = 1
+HAVE_READLINK = 1
+HAVE_READLINKAT = 1
+HAVE_REALLOCARRAY = 1
+HAVE_REALPATH = 1
+HAVE_RENAMEAT = 1
+HAVE_REWINDDIR = 1
+HAVE_RPMATCH = 1
+HAVE_SCANDIR = 1
+HAVE_SECCOMP = yes
+HAVE_SECURE_GETENV = 1
+HAVE_SETENV = 1
+HAVE_SETHOSTNAME = 1
+HAVE_SETSTATE = 1
+HAVE_SIGABBREV_NP = 1
+HAVE_SIGACTION = 1
+HAVE_SIGDESCR_NP = 1
+HAVE_SIGHANDLER_T = 1
+HAVE_SIGINFO_T = 1
+HAVE_SIGNED_SIG_ATOMIC_T = 
+HAVE_SIGNED_WCHAR_T = 
+HAVE_SIGNED_WINT_T = 
+HAVE_SIGSET_T = 1
+HAVE_SLEEP = 1
+HAVE_SPAWN_H = 
+HAVE_SQLITE3 = no
+HAVE_STDINT_H = 1
+HAVE_STPCPY = 1
+HAVE_STPNCPY = 1
+HAVE_STRCASECMP = 1
+HAVE_STRCASESTR = 1
+HAVE_STRCHRNUL = 1
+HAVE_STRERRORNAME_NP = 1
+HAVE_STRINGS_H = 1
+HAVE_STRPBRK = 1
+HAVE_STRPTIME = 1
+HAVE_STRSEP = 1
+HAVE_STRTOD = 1
+HAVE_STRTOL = 1
+HAVE_STRTOLD = 1
+HAVE_STRTOLL = 1
+HAVE_STRTOUL = 1
+HAVE_STRTOULL = 1
+HAVE_STRUCT_RANDOM_DATA = 1
+HAVE_STRUCT_SIGACTION_SA_SIGACTION = 1
+HAVE_STRUCT_TIMEVAL = 1
+HAVE_STRVERSCMP = 1
+HAVE_SYMLINK = 1
+HAVE_SYMLINKAT = 1
+HAVE_SYS_BITYPES_H = 0
+HAVE_SYS_CDEFS_H = 
+HAVE_SYS_INTTYPES_H = 0
+HAVE_SYS_LOADAVG_H = 0
+HAVE_SYS_PARAM_H = 0
+HAVE_SYS_RANDOM_H = 1
+HAVE_SYS_SELECT_H = 1
+HAVE_SYS_TIME_H = 1
+HAVE_SYS_TYPES_H = 1
+HAVE_TIMEGM = 1
+HAVE_TIMESPEC_GET = 1
+HAVE_TIMESPEC_GETRES = 1
+HAVE_TIMEZONE_T = 0
+HAVE_TREE_SITTER = no
+HAVE_TYPE_VOLATILE_SIG_ATOMIC_T = 1
+HAVE_UNISTD_H = 1
+HAVE_UNLINKAT = 1
+HAVE_UNLOCKPT = 1
+HAVE_USLEEP = 1
+HAVE_UTIMENSAT = 1
+HAVE_VASPRINTF = 1
+HAVE_VDPRINTF = 1
+HAVE_WCHAR_H = 1
+HAVE_WCHAR_T = 1
+HAVE_WINSOCK2_H = 0
+HAVE_XSERVER = 
+HAVE__EXIT = 1
+HYBRID_MALLOC = 
+IEEE754_H = 
+IMAGEMAGICK_CFLAGS = 
+IMAGEMAGICK_LIBS = 
+INCLUDE_NEXT = include_next
+INCLUDE_NEXT_AS_FIRST_DIRECTIVE = include_next
+INSTALL_ARCH_INDEP_EXTRA = install-etc
+INSTALL_DATA = ${INSTALL} -m 644
+INSTALL_INFO = :
+INSTALL_PROGRAM = ${INSTALL}
+INSTALL_SCRIPT = ${INSTALL}
+INT32_MAX_LT_INTMAX_MAX = 1
+INT64_MAX_EQ_LONG_MAX = defined _LP64
+JSON_CFLAGS = 
+JSON_LIBS = 
+JSON_OBJ = 
+KQUEUE_CFLAGS = 
+KQUEUE_LIBS = 
+KRB4LIB = 
+KRB5LIB = 
+LCMS2_CFLAGS = 
+LCMS2_LIBS = 
+LDFLAGS = 
+LD_SWITCH_SYSTEM = 
+LD_SWITCH_SYSTEM_TEMACS = $(LD_SWITCH_X_SITE_RPATH)
+LD_SWITCH_X_SITE = 
+LD_SWITCH_X_SITE_RPATH = 
+LIBGCCJIT_CFLAGS = 
+LIBGCCJIT_LIBS = 
+LIBGIF = 
+LIBGMP = -lgmp
+LIBGNUTLS_CFLAGS = -isystem /usr/include/p11-kit-1 
+LIBGNUTLS_LIBS = -lgnutls 
+LIBGNU_LIBDEPS = 
+LIBGNU_LTLIBDEPS = 
+LIBGPM = 
+LIBHESIOD = 
+LIBINTL = 
+LIBJPEG = 
+LIBMODULES = 
+LIBOBJS = 
+LIBOTF_CFLAGS = 
+LIBOTF_LIBS = 
+LIBPNG = 
+LIBRESOLV = 
+LIBS =  
+LIBSECCOMP_CFLAGS = 
+LIBSECCOMP_LIBS = 
+LIBSELINUX_LIBS = 
+LIBSOUND = 
+LIBSYSTEMD_CFLAGS = 
+LIBSYSTEMD_LIBS = 
+LIBS_ECLIENT = 
+LIBS_GNUSTEP = 
+LIBS_MAIL = 
+LIBS_SYSTEM = 
+LIBS_TERMCAP = -ltinfo
+LIBTIFF = 
+LIBXMENU = 
+LIBXML2_CFLAGS = 
+LIBXML2_LIBS = 
+LIBXMU = 
+LIBXPM = 
+LIBXSM = 
+LIBXTR6 = 
+LIBXT_OTHER = $(LIBXSM)
+LIBX_OTHER = 
+LIBZ = 
+LIB_ACL = 
+LIB_CLOCK_GETTIME = 
+LIB_EACCESS = 
+LIB_EXECINFO = 
+LIB_GETRANDOM = 
+LIB_MATH = -lm
+LIB_NANOSLEEP = 
+LIB_PTHREAD = 
+LIB_PTHREAD_SIGMASK = 
+LIB_TIMER_TIME = 
+LIB_WSOCK32 = 
+LIB_XATTR = 
+LIMITS_H = limits.h
+LN_S_FILEONLY = ln -s
+LTLIBGMP = -lgmp
+LTLIBINTL = 
+LTLIBOBJS = 
+M17N_FLT_CFLAGS = 
+M17N_FLT_LIBS = 
+MAKEINFO = makeinfo
+MAKE_PROG = 
+MKDIR_P = /usr/bin/mkdir -p
+MODULES_OBJ = 
+MODULES_SECONDARY_SUFFIX = 
+MODULES_SUFFIX = .so
+NANOSLEEP_LIB = 
+NATIVE_COMPILATION_AOT = no
+NEXT_ASSERT_H = 
+NEXT_AS_FIRST_DIRECTIVE_ASSERT_H = 
+NEXT_AS_FIRST_DIRECTIVE_DIRENT_H = <dirent.h>
+NEXT_AS_FIRST_DIRECTIVE_ERRNO_H = 
+NEXT_AS_FIRST_DIRECTIVE_ERROR_H = <error.h>
+NEXT_AS_FIRST_DIRECTIVE_FCNTL_H = <fcntl.h>
+NEXT_AS_FIRST_DIRECTIVE_FLOAT_H = 
+NEXT_AS_FIRST_DIRECTIVE_GETOPT_H = <getopt.h>
+NEXT_AS_FIRST_DIRECTIVE_INTTYPES_H = <inttypes.h>
+NEXT_AS_FIRST_DIRECTIVE_LIMITS_H = <limits.h>
+NEXT_AS_FIRST_DIRECTIVE_SIGNAL_H = <signal.h>
+NEXT_AS_FIRST_DIRECTIVE_STDDEF_H = <stddef.h>
+NEXT_AS_FIRST_DIRECTIVE_STDINT_H = <stdint.h>
+NEXT_AS_FIRST_DIRECTIVE_STDIO_H = <stdio.h>
+NEXT_AS_FIRST_DIRECTIVE_STDLIB_H = <stdlib.h>
+NEXT_AS_FIRST_DIRECTIVE_STRINGS_H = <strings.h>
+NEXT_AS_FIRST_DIRECTIVE_STRING_H = <string.h>
+NEXT_AS_FIRST_DIRECTIVE_SYS_RANDOM_H = <sys/random.h>
+NEXT_AS_FIRST_DIRECTIVE_SYS_SELECT_H = <sys/select.h>
+NEXT_AS_FIRST_DIRECTIVE_SYS_STAT_H = <sys/stat.h>
+NEXT_AS_FIRST_DIRECTIVE_SYS_TIME_H = <sys/time.h>
+NEXT_AS_FIRST_DIRECTIVE_SYS_TYPES_H = <sys/types.h>
+NEXT_AS_FIRST_DIRECTIVE_TIME_H = <time.h>
+NEXT_AS_FIRST_DIRECTIVE_UNISTD_H = <unistd.h>
+NEXT_DIRENT_H = <dirent.h>
+NEXT_ERRNO_H = 
+NEXT_ERROR_H = <error.h>
+NEXT_FCNTL_H = <fcntl.h>
+NEXT_FLOAT_H = 
+NEXT_GETOPT_H = <getopt.h>
+NEXT_INTTYPES_H = <inttypes.h>
+NEXT_LIMITS_H = <limits.h>
+NEXT_SIGNAL_H = <signal.h>
+NEXT_STDDEF_H = <stddef.h>
+NEXT_STDINT_H = <stdint.h>
+NEXT_STDIO_H = <stdio.h>
+NEXT_STDLIB_H = <stdlib.h>
+NEXT_STRINGS_H = <strings.h>
+NEXT_STRING_H = <string.h>
+NEXT_SYS_RANDOM_H = <sys/random.h>
+NEXT_SYS_SELECT_H = <sys/select.h>
+NEXT_SYS_STAT_H = <sys/stat.h>
+NEXT_SYS_TIME_H = <sys/time.h>
+NEXT_SYS_TYPES_H = <sys/types.h>
+NEXT_TIME_H = <time.h>
+NEXT_UNISTD_H = <unistd.h>
+NOTIFY_CFLAGS = 
+NOTIFY_LIBS = 
+NOTIFY_OBJ = 
+NS_OBJ = 
+NS_OBJC_OBJ = 
+NTDIR = 
+NTLIB = 
+OBJC = 
+OBJCFLAGS = 
+OBJEXT = o
+OBSTACK_H = obstack.h
+OTHER_FILES = 
+PACKAGE_BUGREPORT = richard@commandlinesystems.com
+PACKAGE_NAME = Commercial Emacs
+PACKAGE_STRING = Commercial Emacs 0.2.1
+PACKAGE_TARNAME = commercial-emacs
+PACKAGE_URL = https://github.com/commercial-emacs/commercial-emacs/
+PACKAGE_VERSION = 0.2.1
+PATH_SEPARATOR = :
+PGTK_LIBS = 
+PGTK_OBJ = 
+PKG_CONFIG = /usr/bin/pkg-config
+PKG_CONFIG_LIBDIR = 
+PKG_CONFIG_PATH = 
+PNG_CFLAGS = 
+PNG_LIBS = 
+POST_ALLOC_OBJ = 
+PRAGMA_COLUMNS = 
+PRAGMA_SYSTEM_HEADER = #pragma GCC system_header
+PRE_ALLOC_OBJ = lastfile.o
+PRIPTR_PREFIX = __PRIPTR_PREFIX
+PROCESS_OBJ = process.o
+PROFILING_CFLAGS = 
+PTHREAD_H_DEFINES_STRUCT_TIMESPEC = 0
+PTHREAD_SIGMASK_LIB = 
+PTRDIFF_T_SUFFIX = 
+QCOPY_ACL_LIB = 
+RALLOC_OBJ = 
+RANLIB = ranlib
+REPLACE_ACCESS = 0
+REPLACE_ALIGNED_ALLOC = 0
+REPLACE_CALLOC_FOR_CALLOC_GNU = 0
+REPLACE_CALLOC_FOR_CALLOC_POSIX = 0
+REPLACE_CANONICALIZE_FILE_NAME = 0
+REPLACE_CHMOD = 0
+REPLACE_CHOWN = 0
+REPLACE_CLOSE = 0
+REPLACE_CLOSEDIR = 0
+REPLACE_COPY_FILE_RANGE = 1
+REPLACE_CREAT = 0
+REPLACE_CTIME = 0
+REPLACE_DIRFD = 0
+REPLACE_DPRINTF = 0
+REPLACE_DUP = 0
+REPLACE_DUP2 = 0
+REPLACE_DUP3 = 0
+REPLACE_ERROR = 0
+REPLACE_ERROR_AT_LINE = 0
+REPLACE_EXECL = 0
+REPLACE_EXECLE = 0
+REPLACE_EXECLP = 0
+REPLACE_EXECV = 0
+REPLACE_EXECVE = 0
+REPLACE_EXECVP = 0
+REPLACE_EXECVPE = 0
+REPLACE_FACCESSAT = 0
+REPLACE_FCHDIR = 0
+REPLACE_FCHMODAT = 0
+REPLACE_FCHOWNAT = 0
+REPLACE_FCLOSE = 1
+REPLACE_FCNTL = 1
+REPLACE_FDATASYNC = 0
+REPLACE_FDOPEN = 0
+REPLACE_FDOPENDIR = 0
+REPLACE_FFLUSH = 0
+REPLACE_FFSLL = 0
+REPLACE_FOPEN = 1
+REPLACE_FOPEN_FOR_FOPEN_GNU = 1
+REPLACE_FPRINTF = 0
+REPLACE_FPURGE = 0
+REPLACE_FREE = 0
+REPLACE_FREOPEN = 0
+REPLACE_FSEEK = 0
+REPLACE_FSEEKO = 0
+REPLACE_FSTAT = 0
+REPLACE_FSTATAT = 0
+REPLACE_FTELL = 0
+REPLACE_FTELLO = 0
+REPLACE_FTRUNCATE = 0
+REPLACE_FUTIMENS = 0
+REPLACE_GETCWD = 0
+REPLACE_GETDELIM = 0
+REPLACE_GETDOMAINNAME = 0
+REPLACE_GETDTABLESIZE = 0
+REPLACE_GETENTROPY = 0
+REPLACE_GETGROUPS = 0
+REPLACE_GETLINE = 0
+REPLACE_GETLOADAVG = 0
+REPLACE_GETLOGIN_R = 0
+REPLACE_GETPAGESIZE = 0
+REPLACE_GETPASS = 0
+REPLACE_GETPASS_FOR_GETPASS_GNU = 0
+REPLACE_GETPROGNAME = 0
+REPLACE_GETRANDOM = 0
+REPLACE_GETSUBOPT = 0
+REPLACE_GETTIMEOFDAY = 0
+REPLACE_GMTIME = 0
+REPLACE_IMAXABS = 0
+REPLACE_IMAXDIV = 0
+REPLACE_INITSTATE = 0
+REPLACE_ISATTY = 0
+REPLACE_ITOLD = 0
+REPLACE_LCHOWN = 0
+REPLACE_LINK = 0
+REPLACE_LINKAT = 0
+REPLACE_LOCALTIME = 0
+REPLACE_LOCALTIME_R = 0
+REPLACE_LSEEK = 0
+REPLACE_LSTAT = 0
+REPLACE_MALLOC_FOR_MALLOC_GNU = 0
+REPLACE_MALLOC_FOR_MALLOC_POSIX = 0
+REPLACE_MBSTOWCS = 0
+REPLACE_MBTOWC = 0
+REPLACE_MB_CUR_MAX = 0
+REPLACE_MEMCHR = 0
+REPLACE_MEMMEM = 0
+REPLACE_MEMPCPY = 0
+REPLACE_MKDIR = 0
+REPLACE_MKFIFO = 0
+REPLACE_MKFIFOAT = 0
+REPLACE_MKNOD = 0
+REPLACE_MKNODAT = 0
+REPLACE_MKOSTEMP = 0
+REPLACE_MKOSTEMPS = 0
+REPLACE_MKSTEMP = 0
+REPLACE_MKTIME = 0
+REPLACE_NANOSLEEP = 1
+REPLACE_NULL = 0
+REPLACE_OBSTACK = 1
+REPLACE_OBSTACK_PRINTF = 0
+REPLACE_OPEN = 0
+REPLACE_OPENAT = 0
+REPLACE_OPENDIR = 0
+REPLACE_PERROR = 0
+REPLACE_PIPE2 = 1
+REPLACE_POPEN = 0
+REPLACE_POSIX_MEMALIGN = 0
+REPLACE_POSIX_OPENPT = 0
+REPLACE_PREAD = 0
+REPLACE_PRINTF = 0
+REPLACE_PSELECT = 0
+REPLACE_PTHREAD_SIGMASK = 0
+REPLACE_PTSNAME = 0
+REPLACE_PTSNAME_R = 0
+REPLACE_PUTENV = 0
+REPLACE_PWRITE = 0
+REPLACE_QSORT_R = 0
+REPLACE_RAISE = 0
+REPLACE_RAND = 0
+REPLACE_RANDOM = 0
+REPLACE_RANDOM_R = 0
+REPLACE_READ = 0
+REPLACE_READDIR = 0
+REPLACE_READLINK = 0
+REPLACE_READLINKAT = 0
+REPLACE_REALLOCARRAY = 0
+REPLACE_REALLOC_FOR_REALLOC_GNU = 0
+REPLACE_REALLOC_FOR_REALLOC_POSIX = 0
+REPLACE_REALPATH = 0
+REPLACE_REMOVE = 0
+REPLACE_RENAME = 0
+REPLACE_RENAMEAT = 0
+REPLACE_REWINDDIR = 0
+REPLACE_RMDIR = 0
+REPLACE_SELECT = 0
+REPLACE_SETENV = 0
+REPLACE_SETHOSTNAME = 0
+REPLACE_SETSTATE = 0
+REPLACE_SLEEP = 0
+REPLACE_SNPRINTF = 0
+REPLACE_SPRINTF = 0
+REPLACE_STAT = 0
+REPLACE_STDIO_READ_FUNCS = 0
+REPLACE_STDIO_WRITE_FUNCS = 0
+REPLACE_STPCPY = 0
+REPLACE_STPNCPY = 0
+REPLACE_STRCASESTR = 0
+REPLACE_STRCHRNUL = 0
+REPLACE_STRDUP = 0
+REPLACE_STRERROR = 0
+REPLACE_STRERRORNAME_NP = 0
+REPLACE_STRERROR_R = 0
+REPLACE_STRFTIME = 0
+REPLACE_STRNCAT = 0
+REPLACE_STRNDUP = 0
+REPLACE_STRNLEN = 0
+REPLACE_STRSIGNAL = 0
+REPLACE_STRSTR = 0
+REPLACE_STRTOD = 0
+REPLACE_STRTOIMAX = 0
+REPLACE_STRTOK_R = 0
+REPLACE_STRTOL = 0
+REPLACE_STRTOLD = 0
+REPLACE_STRTOLL = 0
+REPLACE_STRTOUL = 0
+REPLACE_STRTOULL = 0
+REPLACE_STRTOUMAX = 0
+REPLACE_STRUCT_TIMEVAL = 0
+REPLACE_STRVERSCMP = 0
+REPLACE_SYMLINK = 0
+REPLACE_SYMLINKAT = 0
+REPLACE_TIME = 0
+REPLACE_TIMEGM = 0
+REPLACE_TIMESPEC_GET = 0
+REPLACE_TMPFILE = 0
+REPLACE_TRUNCATE = 0
+REPLACE_TTYNAME_R = 0
+REPLACE_TZSET = 0
+REPLACE_UNLINK = 0
+REPLACE_UNLINKAT = 0
+REPLACE_UNSETENV = 0
+REPLACE_USLEEP = 0
+REPLACE_UTIMENSAT = 0
+REPLACE_VASPRINTF = 0
+REPLACE_VDPRINTF = 0
+REPLACE_VFPRINTF = 0
+REPLACE_VPRINTF = 0
+REPLACE_VSNPRINTF = 0
+REPLACE_VSPRINTF = 0
+REPLACE_WCTOMB = 0
+REPLACE_WRITE = 0
+REPLACE__EXIT = 0
+RSVG_CFLAGS = 
+RSVG_LIBS = 
+SEPCHAR = :
+SETTINGS_CFLAGS = 
+SETTINGS_LIBS = 
+SHELL = /bin/bash
+SIG_ATOMIC_T_SUFFIX = 
+SIZEOF_LONG = 8
+SIZE_T_SUFFIX = 
+SMALL_JA_DIC = no
+SQLITE3_CFLAGS = 
+SQLITE3_LIBS = 
+SQLITE3_OBJ = 
+STDCKDINT_H = stdckdint.h
+STDDEF_H = stddef.h
+STDINT_H = 
+SUBDIR_MAKEFILES_IN =  $(srcdir)/lib/Makefile.in $(srcdir)/lib-src/Makefile.in $(srcdir)/oldXMenu/Makefile.in $(srcdir)/doc/emacs/Makefile.in $(srcdir)/doc/misc/Makefile.in $(srcdir)/doc/lispintro/Makefile.in $(srcdir)/doc/lispref/Makefile.in $(srcdir)/src/Makefile.in $(srcdir)/lwlib/Makefile.in $(srcdir)/lisp/Makefile.in $(srcdir)/leim/Makefile.in $(srcdir)/nextstep/Makefile.in $(srcdir)/nt/Makefile.in $(srcdir)/test/Makefile.in $(srcdir)/test/infra/Makefile.in $(srcdir)/admin/charsets/Makefile.in $(srcdir)/admin/unidata/Makefile.in
+SYSTEM_TYPE = gnu/linux
+SYS_TIME_H_DEFINES_STRUCT_TIMESPEC = 0
+TERMCAP_OBJ = terminfo.o
+TIMER_TIME_LIB = 
+TIME_H_DEFINES_STRUCT_TIMESPEC = 1
+TIME_H_DEFINES_TIME_UTC = 1
+TOOLKIT_LIBW = 
+TREE_SITTER_CFLAGS = 
+TREE_SITTER_LIBS = 
+TREE_SITTER_OBJ = 
+UINT32_MAX_LT_UINTMAX_MAX = 1
+UINT64_MAX_EQ_ULONG_MAX = defined _LP64
+UNDEFINE_STRTOK_R = 0
+UNEXEC_OBJ = 
+UNISTD_H_DEFINES_STRUCT_TIMESPEC = 0
+UNISTD_H_HAVE_SYS_RANDOM_H = 1
+UNISTD_H_HAVE_WINSOCK2_H = 0
+UNISTD_H_HAVE_WINSOCK2_H_AND_USE_SOCKETS = 0
+USE_ACL = 0
+USE_STARTUP_NOTIFICATION = no
+VMLIMIT_OBJ = 
+W32_LIBS = 
+W32_OBJ = 
+W32_RES_LINK = 
+WARN_CFLAGS =  -Wall -Warith-conversion -Wdate-time -Wdisabled-optimization -Wdouble-promotion -Wduplicated-cond -Wextra -Wformat-signedness -Winit-self -Winvalid-pch -Wlogical-op -Wmissing-declarations -Wmissing-include-dirs -Wmissing-prototypes -Wnested-externs -Wnull-dereference -Wold-style-definition -Wopenmp-simd -Wpacked -Wpointer-arith -Wstrict-prototypes -Wsuggest-attribute=format -Wsuggest-attribute=noreturn -Wsuggest-final-methods -Wsuggest-final-types -Wtrampolines -Wuninitialized -Wunknown-pragmas -Wunused-macros -Wvariadic-macros -Wvector-operation-performance -Wwrite-strings -Warray-bounds=2 -Wattribute-alias=2 -Wformat=2 -Wformat-truncation=2 -Wimplicit-fallthrough=5 -Wshift-overflow=2 -Wuse-after-free=3 -Wvla-larger-than=4031 -Wno-redundant-decls -Wno-missing-field-initializers -Wno-override-init -Wno-sign-compare -Wno-type-limits -Wno-unused-parameter -Wno-format-nonliteral -Wno-bidi-chars
+WCHAR_T_SUFFIX = 
+WEBKIT_CFLAGS = 
+WEBKIT_LIBS = 
+WEBP_CFLAGS = 
+WEBP_LIBS = 
+WERROR_CFLAGS = 
+WIDGET_OBJ = 
+WINDOWS_64_BIT_OFF_T = 0
+WINDOWS_64_BIT_ST_SIZE = 0
+WINDOWS_STAT_INODES = 0
+WINDOWS_STAT_TIMESPEC = 0
+WINDOW_SYSTEM_OBJ = 
+WINDRES = 
+WINT_T_SUFFIX = 
+XARGS_LIMIT = 
+XCB_LIBS = 
+XCOMPOSITE_CFLAGS = 
+XCOMPOSITE_LIBS = 
+XCRUN = 
+XDBE_CFLAGS = 
+XDBE_LIBS = 
+XFIXES_CFLAGS = 
+XFIXES_LIBS = 
+XFT_CFLAGS = 
+XFT_LIBS = 
+XGSELOBJ = 
+XINERAMA_CFLAGS = 
+XINERAMA_LIBS = 
+XINPUT_CFLAGS = 
+XINPUT_LIBS = 
+XMENU_OBJ = 
+XMKMF = 
+XOBJ = 
+XRANDR_CFLAGS = 
+XRANDR_LIBS = 
+XRENDER_LIBS = 
+XSHAPE_CFLAGS = 
+XSHAPE_LIBS = 
+XSYNC_CFLAGS = 
+XSYNC_LIBS = 
+XWIDGETS_OBJ = 
+X_TOOLKIT_TYPE = none
+ac_ct_CC = gcc
+ac_ct_CXX = 
+ac_ct_OBJC = 
+archlibdir = ${libexecdir}/emacs/${version}/${configuration}
+bindir = ${exec_prefix}/bin
+bitmapdir = 
+build = x86_64-pc-linux-gnu
+build_alias = 
+build_cpu = x86_64
+build_os = linux-gnu
+build_vendor = pc
+cache_file = /dev/null
+canonical = x86_64-pc-linux-gnu
+comma_space_version = 
+comma_version = 
+configuration = x86_64-pc-linux-gnu
+copyright = Copyright (C) 2022 The Authors
+datadir = ${datarootdir}
+datarootdir = ${prefix}/share
+docdir = ${datarootdir}/doc/${PACKAGE_TARNAME}
+dvidir = ${docdir}
+emacs_major_version = 30
+etcdir = ${datadir}/emacs/${version}/etc
+etcdocdir = ${datadir}/emacs/${version}/etc
+exec_prefix = ${prefix}
+gamedir = ${localstatedir}/games/emacs
+gamegroup = 
+gameuser = 
+gl_GNULIB_ENABLED_03e0aaad4cb89ca757653bd367a6ccb7_CONDITION = 
+gl_GNULIB_ENABLED_260941c0e5dc67ec9e87d1fb321c300b_CONDITION = 
+gl_GNULIB_ENABLED_43fe87a341d9b4b93c47c3ad819a5239_CONDITION = 
+gl_GNULIB_ENABLED_5264294aa0a5557541b53c8c741f7f31_CONDITION = 
+gl_GNULIB_ENABLED_6099e9737f757db36c47fa9d9f02e88c_CONDITION = 
+gl_GNULIB_ENABLED_682e609604ccaac6be382e4ee3a4eaec_CONDITION = 
+gl_GNULIB_ENABLED_8444034ea779b88768865bb60b4fb8c9_CONDITION = 
+gl_GNULIB_ENABLED_925677f0343de64b89a9f0c790b4104c_CONDITION = 
+gl_GNULIB_ENABLED_a9786850e999ae65a836a6041e8e5ed1_CONDITION = 
+gl_GNULIB_ENABLED_ae0d979e17e723693567f9efd1d2294f_CONDITION = 1
+gl_GNULIB_ENABLED_alignof_CONDITION = 1
+gl_GNULIB_ENABLED_cloexec_CONDITION = 
+gl_GNULIB_ENABLED_close_CONDITION = 1
+gl_GNULIB_ENABLED_dbb57f49352be8fb86869629a254fb72_CONDITION = 
+gl_GNULIB_ENABLED_dirfd_CONDITION = 
+gl_GNULIB_ENABLED_euidaccess_CONDITION = 
+gl_GNULIB_ENABLED_fd38c7e463b54744b77b98aeafb4fa7c_CONDITION = 
+gl_GNULIB_ENABLED_ffs_CONDITION = 
+gl_GNULIB_ENABLED_getdelim_CONDITION = 
+gl_GNULIB_ENABLED_getdtablesize_CONDITION = 1
+gl_GNULIB_ENABLED_getgroups_CONDITION = 
+gl_GNULIB_ENABLED_lchmod_CONDITION = 
+gl_GNULIB_ENABLED_open_CONDITION = 1
+gl_GNULIB_ENABLED_rawmemchr_CONDITION = 
+gl_GNULIB_ENABLED_strerror_CONDITION = 
+gl_GNULIB_ENABLED_strings_CONDITION = 
+gl_GNULIB_ENABLED_strtoll_CONDITION = 
+gl_GNULIB_ENABLED_utimens_CONDITION = 
+gl_LIBOBJDEPS =  ./$(DEPDIR)/fopen.Po
+gl_LIBOBJS =  fopen.o
+gl_LTLIBOBJS =  fopen.lo
+gltests_LIBOBJDEPS = 
+gltests_LIBOBJS = 
+gltests_LTLIBOBJS = 
+gltests_WITNESS = IN_COMMERCIAL_EMACS_GNULIB_TESTS
+gsettingsschemadir = 
+host = x86_64-pc-linux-gnu
+host_alias = 
+host_cpu = x86_64
+host_os = linux-gnu
+host_vendor = pc
+htmldir = ${docdir}
+includedir = ${prefix}/include
+infodir = ${datarootdir}/info
+libdir = ${exec_prefix}/lib
+libexecdir = ${exec_prefix}/libexec
+liblockfile = no
+lispdir = ${datadir}/emacs/${version}/lisp
+lispdirrel = ${version}/lisp
+lisppath = ${locallisppath}:${standardlisppath}
+localedir = ${datarootdir}/locale
+locallisppath = ${datadir}/emacs/${version}/site-lisp:${datadir}/emacs/site-lisp
+localstatedir = ${prefix}/var
+mandir = ${datarootdir}/man
+ns_appbindir = 
+ns_appdir = 
+ns_applibdir = 
+ns_applibexecdir = 
+ns_appresdir = 
+ns_appsrc = 
+ns_check_file = 
+ns_self_contained = no
+oldincludedir = /usr/include
+pdfdir = ${docdir}
+prefix = /usr/local
+program_transform_name = s,x,x,
+psdir = ${docdir}
+runstatedir = ${localstatedir}/run
+sbindir = ${exec_prefix}/sbin
+sharedstatedir = ${prefix}/com
+srcdir = .
+standardlisppath = ${lispdir}
+sysconfdir = ${prefix}/etc
+target_alias = 
+version = 0.2.1
+with_mailutils = 
+x_default_search_path = 
+# End of GNU Make output.
+
+noinst_LIBRARIES += libgnu.a
+
+libgnu_a_SOURCES =
+libgnu_a_CFLAGS = $(AM_CFLAGS) $(GL_CFLAG_GNULIB_WARNINGS)
+libgnu_a_LIBADD = $(gl_LIBOBJS)
+libgnu_a_DEPENDENCIES = $(gl_LIBOBJS)
+EXTRA_libgnu_a_SOURCES =
+
+## begin gnulib module absolute-header
+ifeq (,$(OMIT_GNULIB_MODULE_absolute-header))
+
+# Use this preprocessor expression to decide whether #include_next works.
+# Do not rely on a 'configure'-time test for this, since the expression
+# might appear in an installed header, which is used by some other compiler.
+HAVE_INCLUDE_NEXT = (__GNUC__ || __clang__ || 60000000 <= __DECC_VER)
+
+endif
+## end   gnulib module absolute-header
+
+## begin gnulib module acl-permissions
+ifeq (,$(OMIT_GNULIB_MODULE_acl-permissions))
+
+libgnu_a_SOURCES += acl-errno-valid.c acl-internal.c    get-permissions.c set-permissions.c
+
+EXTRA_DIST += acl-internal.h acl.h acl_entries.c
+
+EXTRA_libgnu_a_SOURCES += acl_entries.c
+
+endif
+## end   gnulib module acl-permissions
+
+## begin gnulib module alignof
+ifeq (,$(OMIT_GNULIB_MODULE_alignof))
+
+ifneq (,$(gl_GNULIB_ENABLED_alignof_CONDITION))
+
+endif
+EXTRA_DIST += alignof.h
+
+endif
+## end   gnulib module alignof
+
+## begin gnulib module alloca-opt
+ifeq (,$(OMIT_GNULIB_MODULE_alloca-opt))
+
+BUILT_SOURCES += $(ALLOCA_H)
+
+# We need the following in order to create <alloca.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_ALLOCA_H_CONDITION))
+alloca.h: alloca.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	  -e 's|@''HAVE_ALLOCA_H''@|$(HAVE_ALLOCA_H)|g' \
+	  $(srcdir)/alloca.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+alloca.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += alloca.h alloca.h-t
+
+EXTRA_DIST += alloca.in.h
+
+endif
+## end   gnulib module alloca-opt
+
+## begin gnulib module allocator
+ifeq (,$(OMIT_GNULIB_MODULE_allocator))
+
+libgnu_a_SOURCES += allocator.c
+
+EXTRA_DIST += allocator.h
+
+endif
+## end   gnulib module allocator
+
+## begin gnulib module assert-h
+ifeq (,$(OMIT_GNULIB_MODULE_assert-h))
+
+BUILT_SOURCES += $(ASSERT_H)
+
+# We need the following in order to create <assert.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_ASSERT_H_CONDITION))
+assert.h: assert.in.h verify.h $(top_builddir)/config.status
+	$(gl_V_at){ $(SED_HEADER_STDOUT) \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_ASSERT_H''@|$(NEXT_ASSERT_H)|g' \
+	      < $(srcdir)/assert.in.h && \
+	  sed -e '/@assert.h omit start@/,/@assert.h omit end@/d' \
+	      -e 's|_gl_verify|_gl_static_assert|g' \
+	      -e 's|_GL_VERIFY|_GL_STATIC_ASSERT|g' \
+	      -e 's|_GL\(_STATIC_ASSERT_H\)|_GL\1|g' \
+	      < $(srcdir)/verify.h; \
+	} > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+assert.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += assert.h assert.h-t
+
+EXTRA_DIST += assert.in.h verify.h
+
+endif
+## end   gnulib module assert-h
+
+## begin gnulib module at-internal
+ifeq (,$(OMIT_GNULIB_MODULE_at-internal))
+
+ifneq (,$(gl_GNULIB_ENABLED_260941c0e5dc67ec9e87d1fb321c300b_CONDITION))
+libgnu_a_SOURCES += openat-priv.h openat-proc.c
+
+endif
+endif
+## end   gnulib module at-internal
+
+## begin gnulib module attribute
+ifeq (,$(OMIT_GNULIB_MODULE_attribute))
+
+
+EXTRA_DIST += attribute.h
+
+endif
+## end   gnulib module attribute
+
+## begin gnulib module basename-lgpl
+ifeq (,$(OMIT_GNULIB_MODULE_basename-lgpl))
+
+ifneq (,$(gl_GNULIB_ENABLED_ae0d979e17e723693567f9efd1d2294f_CONDITION))
+libgnu_a_SOURCES += basename-lgpl.c
+
+endif
+EXTRA_DIST += basename-lgpl.h
+
+endif
+## end   gnulib module basename-lgpl
+
+## begin gnulib module binary-io
+ifeq (,$(OMIT_GNULIB_MODULE_binary-io))
+
+libgnu_a_SOURCES += binary-io.h binary-io.c
+
+endif
+## end   gnulib module binary-io
+
+## begin gnulib module bitset
+ifeq (,$(OMIT_GNULIB_MODULE_bitset))
+
+libgnu_a_SOURCES += bitset.c bitset/array.c bitset/stats.c    bitset/table.c bitset/list.c bitset/vector.c
+
+EXTRA_DIST += bitset.h bitset/array.h bitset/base.h bitset/list.h bitset/stats.h bitset/table.h bitset/vector.h
+
+endif
+## end   gnulib module bitset
+
+## begin gnulib module boot-time
+ifeq (,$(OMIT_GNULIB_MODULE_boot-time))
+
+libgnu_a_SOURCES += boot-time.c
+
+EXTRA_DIST += boot-time-aux.h boot-time.h readutmp.h
+
+endif
+## end   gnulib module boot-time
+
+## begin gnulib module byteswap
+ifeq (,$(OMIT_GNULIB_MODULE_byteswap))
+
+BUILT_SOURCES += $(BYTESWAP_H)
+
+# We need the following in order to create <byteswap.h> when the system
+# doesn't have one.
+ifneq (,$(GL_GENERATE_BYTESWAP_H_CONDITION))
+byteswap.h: byteswap.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_TO_AT_t) $(srcdir)/byteswap.in.h
+	$(AM_V_at)mv $@-t $@
+else
+byteswap.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += byteswap.h byteswap.h-t
+
+EXTRA_DIST += byteswap.in.h
+
+endif
+## end   gnulib module byteswap
+
+## begin gnulib module c-ctype
+ifeq (,$(OMIT_GNULIB_MODULE_c-ctype))
+
+libgnu_a_SOURCES += c-ctype.h c-ctype.c
+
+endif
+## end   gnulib module c-ctype
+
+## begin gnulib module c-strcase
+ifeq (,$(OMIT_GNULIB_MODULE_c-strcase))
+
+libgnu_a_SOURCES += c-strcase.h c-strcasecmp.c c-strncasecmp.c
+
+endif
+## end   gnulib module c-strcase
+
+## begin gnulib module calloc-gnu
+ifeq (,$(OMIT_GNULIB_MODULE_calloc-gnu))
+
+
+EXTRA_DIST += calloc.c
+
+EXTRA_libgnu_a_SOURCES += calloc.c
+
+endif
+## end   gnulib module calloc-gnu
+
+## begin gnulib module calloc-posix
+ifeq (,$(OMIT_GNULIB_MODULE_calloc-posix))
+
+
+EXTRA_DIST += calloc.c
+
+EXTRA_libgnu_a_SOURCES += calloc.c
+
+endif
+## end   gnulib module calloc-posix
+
+## begin gnulib module canonicalize-lgpl
+ifeq (,$(OMIT_GNULIB_MODULE_canonicalize-lgpl))
+
+ifneq (,$(GL_COND_OBJ_CANONICALIZE_LGPL_CONDITION))
+libgnu_a_SOURCES += canonicalize-lgpl.c
+endif
+
+endif
+## end   gnulib module canonicalize-lgpl
+
+## begin gnulib module careadlinkat
+ifeq (,$(OMIT_GNULIB_MODULE_careadlinkat))
+
+libgnu_a_SOURCES += careadlinkat.c
+
+EXTRA_DIST += careadlinkat.h
+
+endif
+## end   gnulib module careadlinkat
+
+## begin gnulib module cloexec
+ifeq (,$(OMIT_GNULIB_MODULE_cloexec))
+
+ifneq (,$(gl_GNULIB_ENABLED_cloexec_CONDITION))
+libgnu_a_SOURCES += cloexec.c
+
+endif
+EXTRA_DIST += cloexec.h
+
+endif
+## end   gnulib module cloexec
+
+## begin gnulib module close
+ifeq (,$(OMIT_GNULIB_MODULE_close))
+
+ifneq (,$(gl_GNULIB_ENABLED_close_CONDITION))
+ifneq (,$(GL_COND_OBJ_CLOSE_CONDITION))
+libgnu_a_SOURCES += close.c
+endif
+
+endif
+endif
+## end   gnulib module close
+
+## begin gnulib module close-stream
+ifeq (,$(OMIT_GNULIB_MODULE_close-stream))
+
+libgnu_a_SOURCES += close-stream.c
+
+EXTRA_DIST += close-stream.h
+
+endif
+## end   gnulib module close-stream
+
+## begin gnulib module copy-file-range
+ifeq (,$(OMIT_GNULIB_MODULE_copy-file-range))
+
+ifneq (,$(GL_COND_OBJ_COPY_FILE_RANGE_CONDITION))
+libgnu_a_SOURCES += copy-file-range.c
+endif
+
+endif
+## end   gnulib module copy-file-range
+
+## begin gnulib module count-leading-zeros
+ifeq (,$(OMIT_GNULIB_MODULE_count-leading-zeros))
+
+libgnu_a_SOURCES += count-leading-zeros.c
+
+EXTRA_DIST += count-leading-zeros.h
+
+endif
+## end   gnulib module count-leading-zeros
+
+## begin gnulib module count-one-bits
+ifeq (,$(OMIT_GNULIB_MODULE_count-one-bits))
+
+libgnu_a_SOURCES += count-one-bits.c
+
+EXTRA_DIST += count-one-bits.h
+
+endif
+## end   gnulib module count-one-bits
+
+## begin gnulib module count-trailing-zeros
+ifeq (,$(OMIT_GNULIB_MODULE_count-trailing-zeros))
+
+libgnu_a_SOURCES += count-trailing-zeros.c
+
+EXTRA_DIST += count-trailing-zeros.h
+
+endif
+## end   gnulib module count-trailing-zeros
+
+## begin gnulib module crypto/md5
+ifeq (,$(OMIT_GNULIB_MODULE_crypto/md5))
+
+libgnu_a_SOURCES += md5-stream.c
+
+endif
+## end   gnulib module crypto/md5
+
+## begin gnulib module crypto/md5-buffer
+ifeq (,$(OMIT_GNULIB_MODULE_crypto/md5-buffer))
+
+libgnu_a_SOURCES += md5.c
+
+EXTRA_DIST += gl_openssl.h md5.h
+
+endif
+## end   gnulib module crypto/md5-buffer
+
+## begin gnulib module crypto/sha1-buffer
+ifeq (,$(OMIT_GNULIB_MODULE_crypto/sha1-buffer))
+
+libgnu_a_SOURCES += sha1.c
+
+EXTRA_DIST += gl_openssl.h sha1.h
+
+endif
+## end   gnulib module crypto/sha1-buffer
+
+## begin gnulib module crypto/sha256-buffer
+ifeq (,$(OMIT_GNULIB_MODULE_crypto/sha256-buffer))
+
+libgnu_a_SOURCES += sha256.c
+
+EXTRA_DIST += gl_openssl.h sha256.h
+
+endif
+## end   gnulib module crypto/sha256-buffer
+
+## begin gnulib module crypto/sha512-buffer
+ifeq (,$(OMIT_GNULIB_MODULE_crypto/sha512-buffer))
+
+libgnu_a_SOURCES += sha512.c
+
+EXTRA_DIST += gl_openssl.h sha512.h
+
+endif
+## end   gnulib module crypto/sha512-buffer
+
+## begin gnulib module diffseq
+ifeq (,$(OMIT_GNULIB_MODULE_diffseq))
+
+libgnu_a_SOURCES += diffseq.h
+
+endif
+## end   gnulib module diffseq
+
+## begin gnulib module dirent
+ifeq (,$(OMIT_GNULIB_MODULE_dirent))
+
+BUILT_SOURCES += dirent.h
+
+# We need the following in order to create <dirent.h> when the system
+# doesn't have one that works with the given compiler.
+dirent.h: dirent.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''HAVE_DIRENT_H''@|$(HAVE_DIRENT_H)|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_DIRENT_H''@|$(NEXT_DIRENT_H)|g' \
+	      -e 's/@''DIR_HAS_FD_MEMBER''@/$(DIR_HAS_FD_MEMBER)/g' \
+	      -e 's/@''GNULIB_OPENDIR''@/$(GL_GNULIB_OPENDIR)/g' \
+	      -e 's/@''GNULIB_READDIR''@/$(GL_GNULIB_READDIR)/g' \
+	      -e 's/@''GNULIB_REWINDDIR''@/$(GL_GNULIB_REWINDDIR)/g' \
+	      -e 's/@''GNULIB_CLOSEDIR''@/$(GL_GNULIB_CLOSEDIR)/g' \
+	      -e 's/@''GNULIB_DIRFD''@/$(GL_GNULIB_DIRFD)/g' \
+	      -e 's/@''GNULIB_FDOPENDIR''@/$(GL_GNULIB_FDOPENDIR)/g' \
+	      -e 's/@''GNULIB_SCANDIR''@/$(GL_GNULIB_SCANDIR)/g' \
+	      -e 's/@''GNULIB_ALPHASORT''@/$(GL_GNULIB_ALPHASORT)/g' \
+	      -e 's/@''HAVE_OPENDIR''@/$(HAVE_OPENDIR)/g' \
+	      -e 's/@''HAVE_READDIR''@/$(HAVE_READDIR)/g' \
+	      -e 's/@''HAVE_REWINDDIR''@/$(HAVE_REWINDDIR)/g' \
+	      -e 's/@''HAVE_CLOSEDIR''@/$(HAVE_CLOSEDIR)/g' \
+	      -e 's|@''HAVE_DECL_DIRFD''@|$(HAVE_DECL_DIRFD)|g' \
+	      -e 's|@''HAVE_DECL_FDOPENDIR''@|$(HAVE_DECL_FDOPENDIR)|g' \
+	      -e 's|@''HAVE_FDOPENDIR''@|$(HAVE_FDOPENDIR)|g' \
+	      -e 's|@''HAVE_SCANDIR''@|$(HAVE_SCANDIR)|g' \
+	      -e 's|@''HAVE_ALPHASORT''@|$(HAVE_ALPHASORT)|g' \
+	      -e 's|@''REPLACE_OPENDIR''@|$(REPLACE_OPENDIR)|g' \
+	      -e 's|@''REPLACE_READDIR''@|$(REPLACE_READDIR)|g' \
+	      -e 's|@''REPLACE_REWINDDIR''@|$(REPLACE_REWINDDIR)|g' \
+	      -e 's|@''REPLACE_CLOSEDIR''@|$(REPLACE_CLOSEDIR)|g' \
+	      -e 's|@''REPLACE_DIRFD''@|$(REPLACE_DIRFD)|g' \
+	      -e 's|@''REPLACE_FDOPENDIR''@|$(REPLACE_FDOPENDIR)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/dirent.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += dirent.h dirent.h-t
+
+EXTRA_DIST += dirent.in.h
+
+endif
+## end   gnulib module dirent
+
+## begin gnulib module dirfd
+ifeq (,$(OMIT_GNULIB_MODULE_dirfd))
+
+ifneq (,$(gl_GNULIB_ENABLED_dirfd_CONDITION))
+ifneq (,$(GL_COND_OBJ_DIRFD_CONDITION))
+libgnu_a_SOURCES += dirfd.c
+endif
+
+endif
+EXTRA_DIST += dirent-private.h
+
+endif
+## end   gnulib module dirfd
+
+## begin gnulib module dtoastr
+ifeq (,$(OMIT_GNULIB_MODULE_dtoastr))
+
+libgnu_a_SOURCES += dtoastr.c
+
+EXTRA_DIST += ftoastr.c ftoastr.h
+
+EXTRA_libgnu_a_SOURCES += ftoastr.c
+
+endif
+## end   gnulib module dtoastr
+
+## begin gnulib module dtotimespec
+ifeq (,$(OMIT_GNULIB_MODULE_dtotimespec))
+
+libgnu_a_SOURCES += dtotimespec.c
+
+endif
+## end   gnulib module dtotimespec
+
+## begin gnulib module dup2
+ifeq (,$(OMIT_GNULIB_MODULE_dup2))
+
+ifneq (,$(GL_COND_OBJ_DUP2_CONDITION))
+libgnu_a_SOURCES += dup2.c
+endif
+
+endif
+## end   gnulib module dup2
+
+## begin gnulib module eloop-threshold
+ifeq (,$(OMIT_GNULIB_MODULE_eloop-threshold))
+
+ifneq (,$(gl_GNULIB_ENABLED_925677f0343de64b89a9f0c790b4104c_CONDITION))
+
+endif
+EXTRA_DIST += eloop-threshold.h
+
+endif
+## end   gnulib module eloop-threshold
+
+## begin gnulib module errno
+ifeq (,$(OMIT_GNULIB_MODULE_errno))
+
+BUILT_SOURCES += $(ERRNO_H)
+
+# We need the following in order to create <errno.h> when the system
+# doesn't have one that is POSIX compliant.
+ifneq (,$(GL_GENERATE_ERRNO_H_CONDITION))
+errno.h: errno.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_ERRNO_H''@|$(NEXT_ERRNO_H)|g' \
+	      -e 's|@''EMULTIHOP_HIDDEN''@|$(EMULTIHOP_HIDDEN)|g' \
+	      -e 's|@''EMULTIHOP_VALUE''@|$(EMULTIHOP_VALUE)|g' \
+	      -e 's|@''ENOLINK_HIDDEN''@|$(ENOLINK_HIDDEN)|g' \
+	      -e 's|@''ENOLINK_VALUE''@|$(ENOLINK_VALUE)|g' \
+	      -e 's|@''EOVERFLOW_HIDDEN''@|$(EOVERFLOW_HIDDEN)|g' \
+	      -e 's|@''EOVERFLOW_VALUE''@|$(EOVERFLOW_VALUE)|g' \
+	      $(srcdir)/errno.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+errno.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += errno.h errno.h-t
+
+EXTRA_DIST += errno.in.h
+
+endif
+## end   gnulib module errno
+
+## begin gnulib module error
+ifeq (,$(OMIT_GNULIB_MODULE_error))
+
+ifneq (,$(GL_COND_OBJ_ERROR_CONDITION))
+libgnu_a_SOURCES += error.c
+endif
+
+endif
+## end   gnulib module error
+
+## begin gnulib module error-h
+ifeq (,$(OMIT_GNULIB_MODULE_error-h))
+
+BUILT_SOURCES += error.h
+
+# We need the following in order to override <error.h>.
+error.h: error.in.h $(top_builddir)/config.status $(CXXDEFS_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''HAVE_ERROR_H''@|$(HAVE_ERROR_H)|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''NEXT_ERROR_H''@|$(NEXT_ERROR_H)|g' \
+	      -e 's|@''HAVE_ERROR''@|$(HAVE_ERROR)|g' \
+	      -e 's|@''HAVE_ERROR_AT_LINE''@|$(HAVE_ERROR_AT_LINE)|g' \
+	      -e 's|@''REPLACE_ERROR''@|$(REPLACE_ERROR)|g' \
+	      -e 's|@''REPLACE_ERROR_AT_LINE''@|$(REPLACE_ERROR_AT_LINE)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      $(srcdir)/error.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += error.h error.h-t
+
+EXTRA_DIST += error.in.h
+
+endif
+## end   gnulib module error-h
+
+## begin gnulib module euidaccess
+ifeq (,$(OMIT_GNULIB_MODULE_euidaccess))
+
+ifneq (,$(gl_GNULIB_ENABLED_euidaccess_CONDITION))
+ifneq (,$(GL_COND_OBJ_EUIDACCESS_CONDITION))
+libgnu_a_SOURCES += euidaccess.c
+endif
+
+endif
+endif
+## end   gnulib module euidaccess
+
+## begin gnulib module execinfo
+ifeq (,$(OMIT_GNULIB_MODULE_execinfo))
+
+BUILT_SOURCES += $(EXECINFO_H)
+
+# We need the following in order to create <execinfo.h> when the system
+# doesn't have one that works.
+ifneq (,$(GL_GENERATE_EXECINFO_H_CONDITION))
+execinfo.h: execinfo.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_TO_AT_t) $(srcdir)/execinfo.in.h
+	$(AM_V_at)mv $@-t $@
+else
+execinfo.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += execinfo.h execinfo.h-t
+
+ifneq (,$(GL_COND_OBJ_EXECINFO_CONDITION))
+libgnu_a_SOURCES += execinfo.c
+endif
+
+EXTRA_DIST += execinfo.in.h
+
+endif
+## end   gnulib module execinfo
+
+## begin gnulib module exitfail
+ifeq (,$(OMIT_GNULIB_MODULE_exitfail))
+
+libgnu_a_SOURCES += exitfail.c
+
+EXTRA_DIST += exitfail.h
+
+endif
+## end   gnulib module exitfail
+
+## begin gnulib module faccessat
+ifeq (,$(OMIT_GNULIB_MODULE_faccessat))
+
+ifneq (,$(GL_COND_OBJ_FACCESSAT_CONDITION))
+libgnu_a_SOURCES += faccessat.c
+endif
+
+EXTRA_DIST += at-func.c
+
+EXTRA_libgnu_a_SOURCES += at-func.c
+
+endif
+## end   gnulib module faccessat
+
+## begin gnulib module fchmodat
+ifeq (,$(OMIT_GNULIB_MODULE_fchmodat))
+
+ifneq (,$(GL_COND_OBJ_FCHMODAT_CONDITION))
+libgnu_a_SOURCES += fchmodat.c
+endif
+
+EXTRA_DIST += at-func.c
+
+EXTRA_libgnu_a_SOURCES += at-func.c
+
+endif
+## end   gnulib module fchmodat
+
+## begin gnulib module fcntl
+ifeq (,$(OMIT_GNULIB_MODULE_fcntl))
+
+ifneq (,$(GL_COND_OBJ_FCNTL_CONDITION))
+libgnu_a_SOURCES += fcntl.c
+endif
+
+endif
+## end   gnulib module fcntl
+
+## begin gnulib module fcntl-h
+ifeq (,$(OMIT_GNULIB_MODULE_fcntl-h))
+
+BUILT_SOURCES += fcntl.h
+
+# We need the following in order to create <fcntl.h> when the system
+# doesn't have one that works with the given compiler.
+fcntl.h: fcntl.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_FCNTL_H''@|$(NEXT_FCNTL_H)|g' \
+	      -e 's/@''GNULIB_CREAT''@/$(GL_GNULIB_CREAT)/g' \
+	      -e 's/@''GNULIB_FCNTL''@/$(GL_GNULIB_FCNTL)/g' \
+	      -e 's/@''GNULIB_NONBLOCKING''@/$(GL_GNULIB_NONBLOCKING)/g' \
+	      -e 's/@''GNULIB_OPEN''@/$(GL_GNULIB_OPEN)/g' \
+	      -e 's/@''GNULIB_OPENAT''@/$(GL_GNULIB_OPENAT)/g' \
+	      -e 's/@''GNULIB_MDA_CREAT''@/$(GL_GNULIB_MDA_CREAT)/g' \
+	      -e 's/@''GNULIB_MDA_OPEN''@/$(GL_GNULIB_MDA_OPEN)/g' \
+	      -e 's|@''HAVE_FCNTL''@|$(HAVE_FCNTL)|g' \
+	      -e 's|@''HAVE_OPENAT''@|$(HAVE_OPENAT)|g' \
+	      -e 's|@''REPLACE_CREAT''@|$(REPLACE_CREAT)|g' \
+	      -e 's|@''REPLACE_FCNTL''@|$(REPLACE_FCNTL)|g' \
+	      -e 's|@''REPLACE_OPEN''@|$(REPLACE_OPEN)|g' \
+	      -e 's|@''REPLACE_OPENAT''@|$(REPLACE_OPENAT)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/fcntl.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += fcntl.h fcntl.h-t
+
+EXTRA_DIST += fcntl.in.h
+
+endif
+## end   gnulib module fcntl-h
+
+## begin gnulib module fd-hook
+ifeq (,$(OMIT_GNULIB_MODULE_fd-hook))
+
+ifneq (,$(gl_GNULIB_ENABLED_43fe87a341d9b4b93c47c3ad819a5239_CONDITION))
+libgnu_a_SOURCES += fd-hook.c
+
+endif
+EXTRA_DIST += fd-hook.h
+
+endif
+## end   gnulib module fd-hook
+
+## begin gnulib module fdopendir
+ifeq (,$(OMIT_GNULIB_MODULE_fdopendir))
+
+ifneq (,$(GL_COND_OBJ_FDOPENDIR_CONDITION))
+libgnu_a_SOURCES += fdopendir.c
+endif
+
+EXTRA_DIST += dirent-private.h
+
+endif
+## end   gnulib module fdopendir
+
+## begin gnulib module ffs
+ifeq (,$(OMIT_GNULIB_MODULE_ffs))
+
+ifneq (,$(gl_GNULIB_ENABLED_ffs_CONDITION))
+ifneq (,$(GL_COND_OBJ_FFS_CONDITION))
+libgnu_a_SOURCES += ffs.c
+endif
+
+endif
+endif
+## end   gnulib module ffs
+
+## begin gnulib module ffsl
+ifeq (,$(OMIT_GNULIB_MODULE_ffsl))
+
+ifneq (,$(GL_COND_OBJ_FFSL_CONDITION))
+libgnu_a_SOURCES += ffsl.c
+endif
+
+EXTRA_DIST += ffsl.h
+
+endif
+## end   gnulib module ffsl
+
+## begin gnulib module file-has-acl
+ifeq (,$(OMIT_GNULIB_MODULE_file-has-acl))
+
+libgnu_a_SOURCES += file-has-acl.c
+
+EXTRA_DIST += acl-internal.h
+
+endif
+## end   gnulib module file-has-acl
+
+## begin gnulib module filemode
+ifeq (,$(OMIT_GNULIB_MODULE_filemode))
+
+libgnu_a_SOURCES += filemode.c
+
+EXTRA_DIST += filemode.h
+
+endif
+## end   gnulib module filemode
+
+## begin gnulib module filename
+ifeq (,$(OMIT_GNULIB_MODULE_filename))
+
+
+EXTRA_DIST += filename.h
+
+endif
+## end   gnulib module filename
+
+## begin gnulib module filevercmp
+ifeq (,$(OMIT_GNULIB_MODULE_filevercmp))
+
+libgnu_a_SOURCES += filevercmp.c
+
+EXTRA_DIST += filevercmp.h
+
+endif
+## end   gnulib module filevercmp
+
+## begin gnulib module flexmember
+ifeq (,$(OMIT_GNULIB_MODULE_flexmember))
+
+
+EXTRA_DIST += flexmember.h
+
+endif
+## end   gnulib module flexmember
+
+## begin gnulib module float
+ifeq (,$(OMIT_GNULIB_MODULE_float))
+
+BUILT_SOURCES += $(FLOAT_H)
+
+# We need the following in order to create <float.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_FLOAT_H_CONDITION))
+float.h: float.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_FLOAT_H''@|$(NEXT_FLOAT_H)|g' \
+	      -e 's|@''REPLACE_ITOLD''@|$(REPLACE_ITOLD)|g' \
+	      $(srcdir)/float.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+float.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += float.h float.h-t
+
+ifneq (,$(GL_COND_OBJ_FLOAT_CONDITION))
+libgnu_a_SOURCES += float.c
+endif
+ifneq (,$(GL_COND_OBJ_ITOLD_CONDITION))
+libgnu_a_SOURCES += itold.c
+endif
+
+EXTRA_DIST += float.in.h
+
+endif
+## end   gnulib module float
+
+## begin gnulib module fopen
+ifeq (,$(OMIT_GNULIB_MODULE_fopen))
+
+
+EXTRA_DIST += fopen.c
+
+EXTRA_libgnu_a_SOURCES += fopen.c
+
+endif
+## end   gnulib module fopen
+
+## begin gnulib module fopen-gnu
+ifeq (,$(OMIT_GNULIB_MODULE_fopen-gnu))
+
+
+EXTRA_DIST += fopen.c
+
+EXTRA_libgnu_a_SOURCES += fopen.c
+
+endif
+## end   gnulib module fopen-gnu
+
+## begin gnulib module fpending
+ifeq (,$(OMIT_GNULIB_MODULE_fpending))
+
+ifneq (,$(GL_COND_OBJ_FPENDING_CONDITION))
+libgnu_a_SOURCES += fpending.c
+endif
+
+EXTRA_DIST += fpending.h stdio-impl.h
+
+endif
+## end   gnulib module fpending
+
+## begin gnulib module free-posix
+ifeq (,$(OMIT_GNULIB_MODULE_free-posix))
+
+ifneq (,$(GL_COND_OBJ_FREE_CONDITION))
+libgnu_a_SOURCES += free.c
+endif
+
+endif
+## end   gnulib module free-posix
+
+## begin gnulib module fstatat
+ifeq (,$(OMIT_GNULIB_MODULE_fstatat))
+
+ifneq (,$(GL_COND_OBJ_FSTATAT_CONDITION))
+libgnu_a_SOURCES += fstatat.c
+endif
+
+EXTRA_DIST += at-func.c
+
+EXTRA_libgnu_a_SOURCES += at-func.c
+
+endif
+## end   gnulib module fstatat
+
+## begin gnulib module fsusage
+ifeq (,$(OMIT_GNULIB_MODULE_fsusage))
+
+ifneq (,$(GL_COND_OBJ_FSUSAGE_CONDITION))
+libgnu_a_SOURCES += fsusage.c
+endif
+
+EXTRA_DIST += fsusage.h
+
+endif
+## end   gnulib module fsusage
+
+## begin gnulib module fsync
+ifeq (,$(OMIT_GNULIB_MODULE_fsync))
+
+ifneq (,$(GL_COND_OBJ_FSYNC_CONDITION))
+libgnu_a_SOURCES += fsync.c
+endif
+
+endif
+## end   gnulib module fsync
+
+## begin gnulib module futimens
+ifeq (,$(OMIT_GNULIB_MODULE_futimens))
+
+ifneq (,$(GL_COND_OBJ_FUTIMENS_CONDITION))
+libgnu_a_SOURCES += futimens.c
+endif
+
+endif
+## end   gnulib module futimens
+
+## begin gnulib module gen-header
+ifeq (,$(OMIT_GNULIB_MODULE_gen-header))
+
+# In 'sed', replace the pattern space with a "DO NOT EDIT" comment.
+SED_HEADER_NOEDIT = s,.*,/* DO NOT EDIT! GENERATED AUTOMATICALLY! */,
+
+# '$(SED_HEADER_STDOUT) -e "..."' runs 'sed' but first outputs "DO NOT EDIT".
+SED_HEADER_STDOUT = sed -e 1h -e '1$(SED_HEADER_NOEDIT)' -e 1G
+
+# '$(SED_HEADER_TO_AT_t) FILE' copies FILE to $@-t, prepending a leading
+# "DO_NOT_EDIT".  Although this could be done more simply via:
+#	SED_HEADER_TO_AT_t = $(SED_HEADER_STDOUT) > $@-t
+# the -n and 'w' avoid a fork+exec, at least when GNU Make is used.
+SED_HEADER_TO_AT_t = $(SED_HEADER_STDOUT) -n -e 'w $@-t'
+
+# Use $(gl_V_at) instead of $(AM_V_GEN) or $(AM_V_at) on a line that
+gl_V_at = $(AM_V_GEN)
+
+endif
+## end   gnulib module gen-header
+
+## begin gnulib module getdelim
+ifeq (,$(OMIT_GNULIB_MODULE_getdelim))
+
+ifneq (,$(gl_GNULIB_ENABLED_getdelim_CONDITION))
+ifneq (,$(GL_COND_OBJ_GETDELIM_CONDITION))
+libgnu_a_SOURCES += getdelim.c
+endif
+
+endif
+endif
+## end   gnulib module getdelim
+
+## begin gnulib module getdtablesize
+ifeq (,$(OMIT_GNULIB_MODULE_getdtablesize))
+
+ifneq (,$(gl_GNULIB_ENABLED_getdtablesize_CONDITION))
+ifneq (,$(GL_COND_OBJ_GETDTABLESIZE_CONDITION))
+libgnu_a_SOURCES += getdtablesize.c
+endif
+
+endif
+endif
+## end   gnulib module getdtablesize
+
+## begin gnulib module getgroups
+ifeq (,$(OMIT_GNULIB_MODULE_getgroups))
+
+ifneq (,$(gl_GNULIB_ENABLED_getgroups_CONDITION))
+ifneq (,$(GL_COND_OBJ_GETGROUPS_CONDITION))
+libgnu_a_SOURCES += getgroups.c
+endif
+
+endif
+endif
+## end   gnulib module getgroups
+
+## begin gnulib module getline
+ifeq (,$(OMIT_GNULIB_MODULE_getline))
+
+ifneq (,$(GL_COND_OBJ_GETLINE_CONDITION))
+libgnu_a_SOURCES += getline.c
+endif
+
+endif
+## end   gnulib module getline
+
+## begin gnulib module getloadavg
+ifeq (,$(OMIT_GNULIB_MODULE_getloadavg))
+
+ifneq (,$(GL_COND_OBJ_GETLOADAVG_CONDITION))
+libgnu_a_SOURCES += getloadavg.c
+endif
+
+endif
+## end   gnulib module getloadavg
+
+## begin gnulib module getopt-posix
+ifeq (,$(OMIT_GNULIB_MODULE_getopt-posix))
+
+BUILT_SOURCES += $(GETOPT_H) $(GETOPT_CDEFS_H)
+
+# We need the following in order to create <getopt.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_GETOPT_H_CONDITION))
+getopt.h: getopt.in.h $(top_builddir)/config.status $(ARG_NONNULL_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''HAVE_GETOPT_H''@|$(HAVE_GETOPT_H)|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_GETOPT_H''@|$(NEXT_GETOPT_H)|g' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      $(srcdir)/getopt.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+getopt.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+
+ifneq (,$(GL_GENERATE_GETOPT_CDEFS_H_CONDITION))
+getopt-cdefs.h: getopt-cdefs.in.h $(top_builddir)/config.status
+	$(AM_V_GEN)$(SED_HEADER_STDOUT) \
+	  -e 's|@''HAVE_SYS_CDEFS_H''@|$(HAVE_SYS_CDEFS_H)|g' \
+	  $(srcdir)/getopt-cdefs.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+getopt-cdefs.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+
+MOSTLYCLEANFILES += getopt.h getopt.h-t getopt-cdefs.h getopt-cdefs.h-t
+
+ifneq (,$(GL_COND_OBJ_GETOPT_CONDITION))
+libgnu_a_SOURCES += getopt.c getopt1.c
+endif
+
+EXTRA_DIST += getopt-cdefs.in.h getopt-core.h getopt-ext.h getopt-pfx-core.h getopt-pfx-ext.h getopt.in.h getopt_int.h
+
+endif
+## end   gnulib module getopt-posix
+
+## begin gnulib module getprogname
+ifeq (,$(OMIT_GNULIB_MODULE_getprogname))
+
+ifneq (,$(GL_COND_OBJ_GETPROGNAME_CONDITION))
+libgnu_a_SOURCES += getprogname.c
+endif
+
+EXTRA_DIST += getprogname.h
+
+endif
+## end   gnulib module getprogname
+
+## begin gnulib module getrandom
+ifeq (,$(OMIT_GNULIB_MODULE_getrandom))
+
+ifneq (,$(GL_COND_OBJ_GETRANDOM_CONDITION))
+libgnu_a_SOURCES += getrandom.c
+endif
+
+endif
+## end   gnulib module getrandom
+
+## begin gnulib module gettext-h
+ifeq (,$(OMIT_GNULIB_MODULE_gettext-h))
+
+libgnu_a_SOURCES += gettext.h
+
+endif
+## end   gnulib module gettext-h
+
+## begin gnulib module gettime
+ifeq (,$(OMIT_GNULIB_MODULE_gettime))
+
+libgnu_a_SOURCES += gettime.c
+
+endif
+## end   gnulib module gettime
+
+## begin gnulib module gettimeofday
+ifeq (,$(OMIT_GNULIB_MODULE_gettimeofday))
+
+ifneq (,$(GL_COND_OBJ_GETTIMEOFDAY_CONDITION))
+libgnu_a_SOURCES += gettimeofday.c
+endif
+
+endif
+## end   gnulib module gettimeofday
+
+## begin gnulib module gitlog-to-changelog
+ifeq (,$(OMIT_GNULIB_MODULE_gitlog-to-changelog))
+
+
+EXTRA_DIST += $(top_srcdir)/build-aux/gitlog-to-changelog
+
+endif
+## end   gnulib module gitlog-to-changelog
+
+## begin gnulib module glibc-internal/dynarray
+ifeq (,$(OMIT_GNULIB_MODULE_glibc-internal/dynarray))
+
+ifneq (,$(gl_GNULIB_ENABLED_fd38c7e463b54744b77b98aeafb4fa7c_CONDITION))
+BUILT_SOURCES += malloc/dynarray.gl.h malloc/dynarray-skeleton.gl.h
+
+malloc/dynarray.gl.h: malloc/dynarray.h
+	$(AM_V_GEN)$(MKDIR_P) 'malloc'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	  -e '/libc_hidden_proto/d' \
+	  $(srcdir)/malloc/dynarray.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += malloc/dynarray.gl.h malloc/dynarray.gl.h-t
+
+malloc/dynarray-skeleton.gl.h: malloc/dynarray-skeleton.c
+	$(AM_V_GEN)$(MKDIR_P) 'malloc'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|<malloc/dynarray\.h>|<malloc/dynarray.gl.h>|g' \
+	      -e 's|__attribute_maybe_unused__|_GL_ATTRIBUTE_MAYBE_UNUSED|g' \
+	      -e 's|__attribute_nonnull__|_GL_ATTRIBUTE_NONNULL|g' \
+	      -e 's|__attribute_warn_unused_result__|_GL_ATTRIBUTE_NODISCARD|g' \
+	      -e 's|__glibc_likely|_GL_LIKELY|g' \
+	      -e 's|__glibc_unlikely|_GL_UNLIKELY|g' \
+	      $(srcdir)/malloc/dynarray-skeleton.c > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += malloc/dynarray-skeleton.gl.h malloc/dynarray-skeleton.gl.h-t
+
+libgnu_a_SOURCES += malloc/dynarray_at_failure.c                 malloc/dynarray_emplace_enlarge.c                 malloc/dynarray_finalize.c                 malloc/dynarray_resize.c                 malloc/dynarray_resize_clear.c
+
+endif
+EXTRA_DIST += dynarray.h malloc/dynarray-skeleton.c malloc/dynarray.h
+
+EXTRA_libgnu_a_SOURCES += malloc/dynarray-skeleton.c
+
+endif
+## end   gnulib module glibc-internal/dynarray
+
+## begin gnulib module glibc-internal/scratch_buffer
+ifeq (,$(OMIT_GNULIB_MODULE_glibc-internal/scratch_buffer))
+
+ifneq (,$(gl_GNULIB_ENABLED_8444034ea779b88768865bb60b4fb8c9_CONDITION))
+BUILT_SOURCES += malloc/scratch_buffer.gl.h
+
+malloc/scratch_buffer.gl.h: malloc/scratch_buffer.h
+	$(AM_V_GEN)$(MKDIR_P) 'malloc'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|__always_inline|inline _GL_ATTRIBUTE_ALWAYS_INLINE|g' \
+	      -e 's|__glibc_likely|_GL_LIKELY|g' \
+	      -e 's|__glibc_unlikely|_GL_UNLIKELY|g' \
+	      -e '/libc_hidden_proto/d' \
+	      $(srcdir)/malloc/scratch_buffer.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += malloc/scratch_buffer.gl.h malloc/scratch_buffer.gl.h-t
+
+libgnu_a_SOURCES += malloc/scratch_buffer_grow.c                 malloc/scratch_buffer_grow_preserve.c                 malloc/scratch_buffer_set_array_size.c
+
+endif
+EXTRA_DIST += malloc/scratch_buffer.h scratch_buffer.h
+
+endif
+## end   gnulib module glibc-internal/scratch_buffer
+
+## begin gnulib module group-member
+ifeq (,$(OMIT_GNULIB_MODULE_group-member))
+
+ifneq (,$(gl_GNULIB_ENABLED_a9786850e999ae65a836a6041e8e5ed1_CONDITION))
+ifneq (,$(GL_COND_OBJ_GROUP_MEMBER_CONDITION))
+libgnu_a_SOURCES += group-member.c
+endif
+
+endif
+endif
+## end   gnulib module group-member
+
+## begin gnulib module ialloc
+ifeq (,$(OMIT_GNULIB_MODULE_ialloc))
+
+libgnu_a_SOURCES += ialloc.c
+
+EXTRA_DIST += ialloc.h
+
+endif
+## end   gnulib module ialloc
+
+## begin gnulib module idx
+ifeq (,$(OMIT_GNULIB_MODULE_idx))
+
+libgnu_a_SOURCES += idx.h
+
+endif
+## end   gnulib module idx
+
+## begin gnulib module ieee754-h
+ifeq (,$(OMIT_GNULIB_MODULE_ieee754-h))
+
+BUILT_SOURCES += $(IEEE754_H)
+
+# We need the following in order to create <ieee754.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_IEEE754_H_CONDITION))
+ieee754.h: ieee754.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	  -e 's/ifndef _GL_GNULIB_HEADER/if 0/g' \
+	  $(srcdir)/ieee754.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+ieee754.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += ieee754.h ieee754.h-t
+
+EXTRA_DIST += ieee754.in.h
+
+endif
+## end   gnulib module ieee754-h
+
+## begin gnulib module ignore-value
+ifeq (,$(OMIT_GNULIB_MODULE_ignore-value))
+
+
+EXTRA_DIST += ignore-value.h
+
+endif
+## end   gnulib module ignore-value
+
+## begin gnulib module integer_length
+ifeq (,$(OMIT_GNULIB_MODULE_integer_length))
+
+libgnu_a_SOURCES += integer_length.c
+
+EXTRA_DIST += float+.h integer_length.h
+
+endif
+## end   gnulib module integer_length
+
+## begin gnulib module integer_length_l
+ifeq (,$(OMIT_GNULIB_MODULE_integer_length_l))
+
+libgnu_a_SOURCES += integer_length_l.c
+
+EXTRA_DIST += integer_length.h
+
+endif
+## end   gnulib module integer_length_l
+
+## begin gnulib module intprops
+ifeq (,$(OMIT_GNULIB_MODULE_intprops))
+
+
+EXTRA_DIST += intprops-internal.h intprops.h
+
+endif
+## end   gnulib module intprops
+
+## begin gnulib module inttypes-incomplete
+ifeq (,$(OMIT_GNULIB_MODULE_inttypes-incomplete))
+
+BUILT_SOURCES += inttypes.h
+
+# We need the following in order to create <inttypes.h> when the system
+# doesn't have one that works with the given compiler.
+inttypes.h: inttypes.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(WARN_ON_USE_H) $(ARG_NONNULL_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's/@''HAVE_INTTYPES_H''@/$(HAVE_INTTYPES_H)/g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_INTTYPES_H''@|$(NEXT_INTTYPES_H)|g' \
+	      -e 's/@''APPLE_UNIVERSAL_BUILD''@/$(APPLE_UNIVERSAL_BUILD)/g' \
+	      -e 's/@''PRIPTR_PREFIX''@/$(PRIPTR_PREFIX)/g' \
+	      -e 's/@''GNULIB_IMAXABS''@/$(GL_GNULIB_IMAXABS)/g' \
+	      -e 's/@''GNULIB_IMAXDIV''@/$(GL_GNULIB_IMAXDIV)/g' \
+	      -e 's/@''GNULIB_STRTOIMAX''@/$(GL_GNULIB_STRTOIMAX)/g' \
+	      -e 's/@''GNULIB_STRTOUMAX''@/$(GL_GNULIB_STRTOUMAX)/g' \
+	      -e 's/@''HAVE_DECL_IMAXABS''@/$(HAVE_DECL_IMAXABS)/g' \
+	      -e 's/@''HAVE_DECL_IMAXDIV''@/$(HAVE_DECL_IMAXDIV)/g' \
+	      -e 's/@''HAVE_DECL_STRTOIMAX''@/$(HAVE_DECL_STRTOIMAX)/g' \
+	      -e 's/@''HAVE_DECL_STRTOUMAX''@/$(HAVE_DECL_STRTOUMAX)/g' \
+	      -e 's/@''HAVE_IMAXDIV_T''@/$(HAVE_IMAXDIV_T)/g' \
+	      -e 's/@''REPLACE_IMAXABS''@/$(REPLACE_IMAXABS)/g' \
+	      -e 's/@''REPLACE_IMAXDIV''@/$(REPLACE_IMAXDIV)/g' \
+	      -e 's/@''REPLACE_STRTOIMAX''@/$(REPLACE_STRTOIMAX)/g' \
+	      -e 's/@''REPLACE_STRTOUMAX''@/$(REPLACE_STRTOUMAX)/g' \
+	      -e 's/@''INT32_MAX_LT_INTMAX_MAX''@/$(INT32_MAX_LT_INTMAX_MAX)/g' \
+	      -e 's/@''INT64_MAX_EQ_LONG_MAX''@/$(INT64_MAX_EQ_LONG_MAX)/g' \
+	      -e 's/@''UINT32_MAX_LT_UINTMAX_MAX''@/$(UINT32_MAX_LT_UINTMAX_MAX)/g' \
+	      -e 's/@''UINT64_MAX_EQ_ULONG_MAX''@/$(UINT64_MAX_EQ_ULONG_MAX)/g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/inttypes.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += inttypes.h inttypes.h-t
+
+EXTRA_DIST += inttypes.in.h
+
+endif
+## end   gnulib module inttypes-incomplete
+
+## begin gnulib module lchmod
+ifeq (,$(OMIT_GNULIB_MODULE_lchmod))
+
+ifneq (,$(gl_GNULIB_ENABLED_lchmod_CONDITION))
+ifneq (,$(GL_COND_OBJ_LCHMOD_CONDITION))
+libgnu_a_SOURCES += lchmod.c
+endif
+
+endif
+endif
+## end   gnulib module lchmod
+
+## begin gnulib module libc-config
+ifeq (,$(OMIT_GNULIB_MODULE_libc-config))
+
+
+EXTRA_DIST += cdefs.h libc-config.h
+
+endif
+## end   gnulib module libc-config
+
+## begin gnulib module libgmp
+ifeq (,$(OMIT_GNULIB_MODULE_libgmp))
+
+BUILT_SOURCES += $(GMP_H)
+
+ifneq (,$(GL_GENERATE_GMP_H_CONDITION))
+ifneq (,$(GL_GENERATE_MINI_GMP_H_CONDITION))
+# Build gmp.h as a wrapper for mini-gmp.h when using mini-gmp.
+gmp.h: $(top_builddir)/config.status
+	echo '#include "mini-gmp.h"' > $@-t
+	mv $@-t $@
+endif
+ifneq (,$(GL_GENERATE_GMP_GMP_H_CONDITION))
+# Build gmp.h as a wrapper for gmp/gmp.h.
+gmp.h: $(top_builddir)/config.status
+	echo '#include <gmp/gmp.h>' > $@-t
+	mv $@-t $@
+endif
+else
+gmp.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += gmp.h gmp.h-t
+
+ifneq (,$(GL_COND_OBJ_MINI_GMP_GNULIB_CONDITION))
+libgnu_a_SOURCES += mini-gmp-gnulib.c
+endif
+
+EXTRA_DIST += mini-gmp.c mini-gmp.h
+
+EXTRA_libgnu_a_SOURCES += mini-gmp.c
+
+endif
+## end   gnulib module libgmp
+
+## begin gnulib module limits-h
+ifeq (,$(OMIT_GNULIB_MODULE_limits-h))
+
+BUILT_SOURCES += $(LIMITS_H)
+
+# We need the following in order to create <limits.h> when the system
+# doesn't have one that is compatible with GNU.
+ifneq (,$(GL_GENERATE_LIMITS_H_CONDITION))
+limits.h: limits.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_LIMITS_H''@|$(NEXT_LIMITS_H)|g' \
+	      $(srcdir)/limits.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+limits.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += limits.h limits.h-t
+
+EXTRA_DIST += limits.in.h
+
+endif
+## end   gnulib module limits-h
+
+## begin gnulib module lstat
+ifeq (,$(OMIT_GNULIB_MODULE_lstat))
+
+ifneq (,$(GL_COND_OBJ_LSTAT_CONDITION))
+libgnu_a_SOURCES += lstat.c
+endif
+
+endif
+## end   gnulib module lstat
+
+## begin gnulib module malloc-gnu
+ifeq (,$(OMIT_GNULIB_MODULE_malloc-gnu))
+
+
+EXTRA_DIST += malloc.c
+
+EXTRA_libgnu_a_SOURCES += malloc.c
+
+endif
+## end   gnulib module malloc-gnu
+
+## begin gnulib module malloc-posix
+ifeq (,$(OMIT_GNULIB_MODULE_malloc-posix))
+
+
+EXTRA_DIST += malloc.c
+
+EXTRA_libgnu_a_SOURCES += malloc.c
+
+endif
+## end   gnulib module malloc-posix
+
+## begin gnulib module memmem-simple
+ifeq (,$(OMIT_GNULIB_MODULE_memmem-simple))
+
+
+EXTRA_DIST += memmem.c str-two-way.h
+
+EXTRA_libgnu_a_SOURCES += memmem.c
+
+endif
+## end   gnulib module memmem-simple
+
+## begin gnulib module mempcpy
+ifeq (,$(OMIT_GNULIB_MODULE_mempcpy))
+
+ifneq (,$(GL_COND_OBJ_MEMPCPY_CONDITION))
+libgnu_a_SOURCES += mempcpy.c
+endif
+
+endif
+## end   gnulib module mempcpy
+
+## begin gnulib module memrchr
+ifeq (,$(OMIT_GNULIB_MODULE_memrchr))
+
+ifneq (,$(GL_COND_OBJ_MEMRCHR_CONDITION))
+libgnu_a_SOURCES += memrchr.c
+endif
+
+endif
+## end   gnulib module memrchr
+
+## begin gnulib module memset_explicit
+ifeq (,$(OMIT_GNULIB_MODULE_memset_explicit))
+
+ifneq (,$(GL_COND_OBJ_MEMSET_EXPLICIT_CONDITION))
+libgnu_a_SOURCES += memset_explicit.c
+endif
+
+endif
+## end   gnulib module memset_explicit
+
+## begin gnulib module minmax
+ifeq (,$(OMIT_GNULIB_MODULE_minmax))
+
+libgnu_a_SOURCES += minmax.h
+
+endif
+## end   gnulib module minmax
+
+## begin gnulib module mkostemp
+ifeq (,$(OMIT_GNULIB_MODULE_mkostemp))
+
+ifneq (,$(GL_COND_OBJ_MKOSTEMP_CONDITION))
+libgnu_a_SOURCES += mkostemp.c
+endif
+
+endif
+## end   gnulib module mkostemp
+
+## begin gnulib module mktime
+ifeq (,$(OMIT_GNULIB_MODULE_mktime))
+
+
+EXTRA_DIST += mktime-internal.h mktime.c
+
+EXTRA_libgnu_a_SOURCES += mktime.c
+
+endif
+## end   gnulib module mktime
+
+## begin gnulib module mktime-internal
+ifeq (,$(OMIT_GNULIB_MODULE_mktime-internal))
+
+ifneq (,$(gl_GNULIB_ENABLED_5264294aa0a5557541b53c8c741f7f31_CONDITION))
+
+endif
+EXTRA_DIST += mktime-internal.h mktime.c
+
+EXTRA_libgnu_a_SOURCES += mktime.c
+
+endif
+## end   gnulib module mktime-internal
+
+## begin gnulib module nanosleep
+ifeq (,$(OMIT_GNULIB_MODULE_nanosleep))
+
+ifneq (,$(GL_COND_OBJ_NANOSLEEP_CONDITION))
+libgnu_a_SOURCES += nanosleep.c
+endif
+
+endif
+## end   gnulib module nanosleep
+
+## begin gnulib module nproc
+ifeq (,$(OMIT_GNULIB_MODULE_nproc))
+
+libgnu_a_SOURCES += nproc.c
+
+EXTRA_DIST += nproc.h
+
+endif
+## end   gnulib module nproc
+
+## begin gnulib module nstrftime
+ifeq (,$(OMIT_GNULIB_MODULE_nstrftime))
+
+libgnu_a_SOURCES += nstrftime.c
+
+EXTRA_DIST += strftime.h
+
+endif
+## end   gnulib module nstrftime
+
+## begin gnulib module obstack
+ifeq (,$(OMIT_GNULIB_MODULE_obstack))
+
+BUILT_SOURCES += $(OBSTACK_H)
+
+# We need the following in order to create <obstack.h> when the system
+# doesn't have one that works with any size object.
+ifneq (,$(GL_GENERATE_OBSTACK_H_CONDITION))
+obstack.h: obstack.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''REPLACE_OBSTACK''@|$(REPLACE_OBSTACK)|g' \
+	      $(srcdir)/obstack.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+obstack.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += obstack.h obstack.h-t
+
+ifneq (,$(GL_COND_OBJ_OBSTACK_CONDITION))
+libgnu_a_SOURCES += obstack.c
+endif
+
+EXTRA_DIST += obstack.in.h
+
+endif
+## end   gnulib module obstack
+
+## begin gnulib module open
+ifeq (,$(OMIT_GNULIB_MODULE_open))
+
+ifneq (,$(gl_GNULIB_ENABLED_open_CONDITION))
+ifneq (,$(GL_COND_OBJ_OPEN_CONDITION))
+libgnu_a_SOURCES += open.c
+endif
+
+endif
+endif
+## end   gnulib module open
+
+## begin gnulib module openat-h
+ifeq (,$(OMIT_GNULIB_MODULE_openat-h))
+
+ifneq (,$(gl_GNULIB_ENABLED_03e0aaad4cb89ca757653bd367a6ccb7_CONDITION))
+
+endif
+EXTRA_DIST += openat.h
+
+endif
+## end   gnulib module openat-h
+
+## begin gnulib module pathmax
+ifeq (,$(OMIT_GNULIB_MODULE_pathmax))
+
+
+EXTRA_DIST += pathmax.h
+
+endif
+## end   gnulib module pathmax
+
+## begin gnulib module pipe2
+ifeq (,$(OMIT_GNULIB_MODULE_pipe2))
+
+libgnu_a_SOURCES += pipe2.c
+
+endif
+## end   gnulib module pipe2
+
+## begin gnulib module pselect
+ifeq (,$(OMIT_GNULIB_MODULE_pselect))
+
+ifneq (,$(GL_COND_OBJ_PSELECT_CONDITION))
+libgnu_a_SOURCES += pselect.c
+endif
+
+endif
+## end   gnulib module pselect
+
+## begin gnulib module pthread_sigmask
+ifeq (,$(OMIT_GNULIB_MODULE_pthread_sigmask))
+
+ifneq (,$(GL_COND_OBJ_PTHREAD_SIGMASK_CONDITION))
+libgnu_a_SOURCES += pthread_sigmask.c
+endif
+
+endif
+## end   gnulib module pthread_sigmask
+
+## begin gnulib module qcopy-acl
+ifeq (,$(OMIT_GNULIB_MODULE_qcopy-acl))
+
+libgnu_a_SOURCES += qcopy-acl.c
+
+endif
+## end   gnulib module qcopy-acl
+
+## begin gnulib module rawmemchr
+ifeq (,$(OMIT_GNULIB_MODULE_rawmemchr))
+
+ifneq (,$(gl_GNULIB_ENABLED_rawmemchr_CONDITION))
+ifneq (,$(GL_COND_OBJ_RAWMEMCHR_CONDITION))
+libgnu_a_SOURCES += rawmemchr.c
+endif
+
+endif
+EXTRA_DIST += rawmemchr.valgrind
+
+endif
+## end   gnulib module rawmemchr
+
+## begin gnulib module read
+ifeq (,$(OMIT_GNULIB_MODULE_read))
+
+ifneq (,$(GL_COND_OBJ_READ_CONDITION))
+libgnu_a_SOURCES += read.c
+endif
+
+endif
+## end   gnulib module read
+
+## begin gnulib module readlink
+ifeq (,$(OMIT_GNULIB_MODULE_readlink))
+
+ifneq (,$(GL_COND_OBJ_READLINK_CONDITION))
+libgnu_a_SOURCES += readlink.c
+endif
+
+endif
+## end   gnulib module readlink
+
+## begin gnulib module readlinkat
+ifeq (,$(OMIT_GNULIB_MODULE_readlinkat))
+
+ifneq (,$(GL_COND_OBJ_READLINKAT_CONDITION))
+libgnu_a_SOURCES += readlinkat.c
+endif
+
+EXTRA_DIST += at-func.c
+
+EXTRA_libgnu_a_SOURCES += at-func.c
+
+endif
+## end   gnulib module readlinkat
+
+## begin gnulib module realloc-gnu
+ifeq (,$(OMIT_GNULIB_MODULE_realloc-gnu))
+
+
+EXTRA_DIST += realloc.c
+
+EXTRA_libgnu_a_SOURCES += realloc.c
+
+endif
+## end   gnulib module realloc-gnu
+
+## begin gnulib module realloc-posix
+ifeq (,$(OMIT_GNULIB_MODULE_realloc-posix))
+
+
+EXTRA_DIST += realloc.c
+
+EXTRA_libgnu_a_SOURCES += realloc.c
+
+endif
+## end   gnulib module realloc-posix
+
+## begin gnulib module reallocarray
+ifeq (,$(OMIT_GNULIB_MODULE_reallocarray))
+
+ifneq (,$(GL_COND_OBJ_REALLOCARRAY_CONDITION))
+libgnu_a_SOURCES += reallocarray.c
+endif
+
+endif
+## end   gnulib module reallocarray
+
+## begin gnulib module regex
+ifeq (,$(OMIT_GNULIB_MODULE_regex))
+
+ifneq (,$(GL_COND_OBJ_REGEX_CONDITION))
+libgnu_a_SOURCES += regex.c
+endif
+
+EXTRA_DIST += regcomp.c regex.h regex_internal.c regex_internal.h regexec.c
+
+EXTRA_libgnu_a_SOURCES += regcomp.c regex_internal.c regexec.c
+
+endif
+## end   gnulib module regex
+
+## begin gnulib module root-uid
+ifeq (,$(OMIT_GNULIB_MODULE_root-uid))
+
+ifneq (,$(gl_GNULIB_ENABLED_6099e9737f757db36c47fa9d9f02e88c_CONDITION))
+
+endif
+EXTRA_DIST += root-uid.h
+
+endif
+## end   gnulib module root-uid
+
+## begin gnulib module safe-read
+ifeq (,$(OMIT_GNULIB_MODULE_safe-read))
+
+libgnu_a_SOURCES += safe-read.c
+
+EXTRA_DIST += safe-read.h sys-limits.h
+
+endif
+## end   gnulib module safe-read
+
+## begin gnulib module sig2str
+ifeq (,$(OMIT_GNULIB_MODULE_sig2str))
+
+ifneq (,$(GL_COND_OBJ_SIG2STR_CONDITION))
+libgnu_a_SOURCES += sig2str.c
+endif
+
+EXTRA_DIST += sig2str.h
+
+endif
+## end   gnulib module sig2str
+
+## begin gnulib module sigdescr_np
+ifeq (,$(OMIT_GNULIB_MODULE_sigdescr_np))
+
+ifneq (,$(GL_COND_OBJ_SIGDESCR_NP_CONDITION))
+libgnu_a_SOURCES += sigdescr_np.c
+endif
+
+endif
+## end   gnulib module sigdescr_np
+
+## begin gnulib module signal-h
+ifeq (,$(OMIT_GNULIB_MODULE_signal-h))
+
+BUILT_SOURCES += signal.h
+
+# We need the following in order to create <signal.h> when the system
+# doesn't have a complete one.
+signal.h: signal.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SIGNAL_H''@|$(NEXT_SIGNAL_H)|g' \
+	      -e 's/@''GNULIB_PTHREAD_SIGMASK''@/$(GL_GNULIB_PTHREAD_SIGMASK)/g' \
+	      -e 's/@''GNULIB_RAISE''@/$(GL_GNULIB_RAISE)/g' \
+	      -e 's/@''GNULIB_SIGNAL_H_SIGPIPE''@/$(GL_GNULIB_SIGNAL_H_SIGPIPE)/g' \
+	      -e 's/@''GNULIB_SIGPROCMASK''@/$(GL_GNULIB_SIGPROCMASK)/g' \
+	      -e 's/@''GNULIB_SIGACTION''@/$(GL_GNULIB_SIGACTION)/g' \
+	      -e 's|@''HAVE_POSIX_SIGNALBLOCKING''@|$(HAVE_POSIX_SIGNALBLOCKING)|g' \
+	      -e 's|@''HAVE_PTHREAD_SIGMASK''@|$(HAVE_PTHREAD_SIGMASK)|g' \
+	      -e 's|@''HAVE_RAISE''@|$(HAVE_RAISE)|g' \
+	      -e 's|@''HAVE_SIGSET_T''@|$(HAVE_SIGSET_T)|g' \
+	      -e 's|@''HAVE_SIGINFO_T''@|$(HAVE_SIGINFO_T)|g' \
+	      -e 's|@''HAVE_SIGACTION''@|$(HAVE_SIGACTION)|g' \
+	      -e 's|@''HAVE_STRUCT_SIGACTION_SA_SIGACTION''@|$(HAVE_STRUCT_SIGACTION_SA_SIGACTION)|g' \
+	      -e 's|@''HAVE_TYPE_VOLATILE_SIG_ATOMIC_T''@|$(HAVE_TYPE_VOLATILE_SIG_ATOMIC_T)|g' \
+	      -e 's|@''HAVE_SIGHANDLER_T''@|$(HAVE_SIGHANDLER_T)|g' \
+	      -e 's|@''REPLACE_PTHREAD_SIGMASK''@|$(REPLACE_PTHREAD_SIGMASK)|g' \
+	      -e 's|@''REPLACE_RAISE''@|$(REPLACE_RAISE)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/signal.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += signal.h signal.h-t
+
+EXTRA_DIST += signal.in.h
+
+endif
+## end   gnulib module signal-h
+
+## begin gnulib module snippet/_Noreturn
+ifeq (,$(OMIT_GNULIB_MODULE_snippet/_Noreturn))
+
+# Because this Makefile snippet defines a variable used by other
+# gnulib Makefile snippets, it must be present in all makefiles that
+# need it. This is ensured by the applicability 'all' defined above.
+
+_NORETURN_H=$(srcdir)/_Noreturn.h
+
+EXTRA_DIST += _Noreturn.h
+
+endif
+## end   gnulib module snippet/_Noreturn
+
+## begin gnulib module snippet/arg-nonnull
+ifeq (,$(OMIT_GNULIB_MODULE_snippet/arg-nonnull))
+
+# Because this Makefile snippet defines a variable used by other
+# gnulib Makefile snippets, it must be present in all makefiles that
+# need it. This is ensured by the applicability 'all' defined above.
+
+ARG_NONNULL_H=$(srcdir)/arg-nonnull.h
+
+EXTRA_DIST += arg-nonnull.h
+
+endif
+## end   gnulib module snippet/arg-nonnull
+
+## begin gnulib module snippet/c++defs
+ifeq (,$(OMIT_GNULIB_MODULE_snippet/c++defs))
+
+# Because this Makefile snippet defines a variable used by other
+# gnulib Makefile snippets, it must be present in all makefiles that
+# need it. This is ensured by the applicability 'all' defined above.
+
+CXXDEFS_H=$(srcdir)/c++defs.h
+
+EXTRA_DIST += c++defs.h
+
+endif
+## end   gnulib module snippet/c++defs
+
+## begin gnulib module snippet/warn-on-use
+ifeq (,$(OMIT_GNULIB_MODULE_snippet/warn-on-use))
+
+# Because this Makefile snippet defines a variable used by other
+# gnulib Makefile snippets, it must be present in all makefiles that
+# need it. This is ensured by the applicability 'all' defined above.
+
+WARN_ON_USE_H=$(srcdir)/warn-on-use.h
+
+EXTRA_DIST += warn-on-use.h
+
+endif
+## end   gnulib module snippet/warn-on-use
+
+## begin gnulib module stat-time
+ifeq (,$(OMIT_GNULIB_MODULE_stat-time))
+
+libgnu_a_SOURCES += stat-time.c
+
+EXTRA_DIST += stat-time.h
+
+endif
+## end   gnulib module stat-time
+
+## begin gnulib module stdckdint
+ifeq (,$(OMIT_GNULIB_MODULE_stdckdint))
+
+BUILT_SOURCES += $(STDCKDINT_H)
+
+# We need the following in order to create <stdckdint.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_STDCKDINT_H_CONDITION))
+stdckdint.h: stdckdint.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	  $(srcdir)/stdckdint.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+stdckdint.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += stdckdint.h stdckdint.h-t
+
+EXTRA_DIST += intprops-internal.h stdckdint.in.h
+
+endif
+## end   gnulib module stdckdint
+
+## begin gnulib module stddef
+ifeq (,$(OMIT_GNULIB_MODULE_stddef))
+
+BUILT_SOURCES += $(STDDEF_H)
+
+# We need the following in order to create <stddef.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_STDDEF_H_CONDITION))
+stddef.h: stddef.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STDDEF_H''@|$(NEXT_STDDEF_H)|g' \
+	      -e 's|@''HAVE_MAX_ALIGN_T''@|$(HAVE_MAX_ALIGN_T)|g' \
+	      -e 's|@''HAVE_WCHAR_T''@|$(HAVE_WCHAR_T)|g' \
+	      -e 's|@''REPLACE_NULL''@|$(REPLACE_NULL)|g' \
+	      $(srcdir)/stddef.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+stddef.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += stddef.h stddef.h-t
+
+EXTRA_DIST += stddef.in.h
+
+endif
+## end   gnulib module stddef
+
+## begin gnulib module stdint
+ifeq (,$(OMIT_GNULIB_MODULE_stdint))
+
+BUILT_SOURCES += $(STDINT_H)
+
+# We need the following in order to create <stdint.h> when the system
+# doesn't have one that works with the given compiler.
+ifneq (,$(GL_GENERATE_STDINT_H_CONDITION))
+stdint.h: stdint.in.h $(top_builddir)/config.status
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's/@''HAVE_STDINT_H''@/$(HAVE_STDINT_H)/g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STDINT_H''@|$(NEXT_STDINT_H)|g' \
+	      -e 's/@''HAVE_C99_STDINT_H''@/$(HAVE_C99_STDINT_H)/g' \
+	      -e 's/@''HAVE_SYS_TYPES_H''@/$(HAVE_SYS_TYPES_H)/g' \
+	      -e 's/@''HAVE_INTTYPES_H''@/$(HAVE_INTTYPES_H)/g' \
+	      -e 's/@''HAVE_SYS_INTTYPES_H''@/$(HAVE_SYS_INTTYPES_H)/g' \
+	      -e 's/@''HAVE_SYS_BITYPES_H''@/$(HAVE_SYS_BITYPES_H)/g' \
+	      -e 's/@''HAVE_WCHAR_H''@/$(HAVE_WCHAR_H)/g' \
+	      -e 's/@''APPLE_UNIVERSAL_BUILD''@/$(APPLE_UNIVERSAL_BUILD)/g' \
+	      -e 's/@''BITSIZEOF_PTRDIFF_T''@/$(BITSIZEOF_PTRDIFF_T)/g' \
+	      -e 's/@''PTRDIFF_T_SUFFIX''@/$(PTRDIFF_T_SUFFIX)/g' \
+	      -e 's/@''BITSIZEOF_SIG_ATOMIC_T''@/$(BITSIZEOF_SIG_ATOMIC_T)/g' \
+	      -e 's/@''HAVE_SIGNED_SIG_ATOMIC_T''@/$(HAVE_SIGNED_SIG_ATOMIC_T)/g' \
+	      -e 's/@''SIG_ATOMIC_T_SUFFIX''@/$(SIG_ATOMIC_T_SUFFIX)/g' \
+	      -e 's/@''BITSIZEOF_SIZE_T''@/$(BITSIZEOF_SIZE_T)/g' \
+	      -e 's/@''SIZE_T_SUFFIX''@/$(SIZE_T_SUFFIX)/g' \
+	      -e 's/@''BITSIZEOF_WCHAR_T''@/$(BITSIZEOF_WCHAR_T)/g' \
+	      -e 's/@''HAVE_SIGNED_WCHAR_T''@/$(HAVE_SIGNED_WCHAR_T)/g' \
+	      -e 's/@''WCHAR_T_SUFFIX''@/$(WCHAR_T_SUFFIX)/g' \
+	      -e 's/@''BITSIZEOF_WINT_T''@/$(BITSIZEOF_WINT_T)/g' \
+	      -e 's/@''HAVE_SIGNED_WINT_T''@/$(HAVE_SIGNED_WINT_T)/g' \
+	      -e 's/@''WINT_T_SUFFIX''@/$(WINT_T_SUFFIX)/g' \
+	      -e 's/@''GNULIBHEADERS_OVERRIDE_WINT_T''@/$(GNULIBHEADERS_OVERRIDE_WINT_T)/g' \
+	      $(srcdir)/stdint.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+else
+stdint.h: $(top_builddir)/config.status
+	rm -f $@
+endif
+MOSTLYCLEANFILES += stdint.h stdint.h-t
+
+EXTRA_DIST += stdint.in.h
+
+endif
+## end   gnulib module stdint
+
+## begin gnulib module stdio
+ifeq (,$(OMIT_GNULIB_MODULE_stdio))
+
+BUILT_SOURCES += stdio.h
+
+# We need the following in order to create <stdio.h> when the system
+# doesn't have one that works with the given compiler.
+stdio.h: stdio.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STDIO_H''@|$(NEXT_STDIO_H)|g' \
+	      -e 's/@''GNULIB_DPRINTF''@/$(GL_GNULIB_DPRINTF)/g' \
+	      -e 's/@''GNULIB_FCLOSE''@/$(GL_GNULIB_FCLOSE)/g' \
+	      -e 's/@''GNULIB_FDOPEN''@/$(GL_GNULIB_FDOPEN)/g' \
+	      -e 's/@''GNULIB_FFLUSH''@/$(GL_GNULIB_FFLUSH)/g' \
+	      -e 's/@''GNULIB_FGETC''@/$(GL_GNULIB_FGETC)/g' \
+	      -e 's/@''GNULIB_FGETS''@/$(GL_GNULIB_FGETS)/g' \
+	      -e 's/@''GNULIB_FOPEN''@/$(GL_GNULIB_FOPEN)/g' \
+	      -e 's/@''GNULIB_FOPEN_GNU''@/$(GL_GNULIB_FOPEN_GNU)/g' \
+	      -e 's/@''GNULIB_FPRINTF''@/$(GL_GNULIB_FPRINTF)/g' \
+	      -e 's/@''GNULIB_FPRINTF_POSIX''@/$(GL_GNULIB_FPRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_FPURGE''@/$(GL_GNULIB_FPURGE)/g' \
+	      -e 's/@''GNULIB_FPUTC''@/$(GL_GNULIB_FPUTC)/g' \
+	      -e 's/@''GNULIB_FPUTS''@/$(GL_GNULIB_FPUTS)/g' \
+	      -e 's/@''GNULIB_FREAD''@/$(GL_GNULIB_FREAD)/g' \
+	      -e 's/@''GNULIB_FREOPEN''@/$(GL_GNULIB_FREOPEN)/g' \
+	      -e 's/@''GNULIB_FSCANF''@/$(GL_GNULIB_FSCANF)/g' \
+	      -e 's/@''GNULIB_FSEEK''@/$(GL_GNULIB_FSEEK)/g' \
+	      -e 's/@''GNULIB_FSEEKO''@/$(GL_GNULIB_FSEEKO)/g' \
+	      -e 's/@''GNULIB_FTELL''@/$(GL_GNULIB_FTELL)/g' \
+	      -e 's/@''GNULIB_FTELLO''@/$(GL_GNULIB_FTELLO)/g' \
+	      -e 's/@''GNULIB_FWRITE''@/$(GL_GNULIB_FWRITE)/g' \
+	      -e 's/@''GNULIB_GETC''@/$(GL_GNULIB_GETC)/g' \
+	      -e 's/@''GNULIB_GETCHAR''@/$(GL_GNULIB_GETCHAR)/g' \
+	      -e 's/@''GNULIB_GETDELIM''@/$(GL_GNULIB_GETDELIM)/g' \
+	      -e 's/@''GNULIB_GETLINE''@/$(GL_GNULIB_GETLINE)/g' \
+	      -e 's/@''GNULIB_OBSTACK_PRINTF''@/$(GL_GNULIB_OBSTACK_PRINTF)/g' \
+	      -e 's/@''GNULIB_OBSTACK_PRINTF_POSIX''@/$(GL_GNULIB_OBSTACK_PRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_PCLOSE''@/$(GL_GNULIB_PCLOSE)/g' \
+	      -e 's/@''GNULIB_PERROR''@/$(GL_GNULIB_PERROR)/g' \
+	      -e 's/@''GNULIB_POPEN''@/$(GL_GNULIB_POPEN)/g' \
+	      -e 's/@''GNULIB_PRINTF''@/$(GL_GNULIB_PRINTF)/g' \
+	      -e 's/@''GNULIB_PRINTF_POSIX''@/$(GL_GNULIB_PRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_PUTC''@/$(GL_GNULIB_PUTC)/g' \
+	      -e 's/@''GNULIB_PUTCHAR''@/$(GL_GNULIB_PUTCHAR)/g' \
+	      -e 's/@''GNULIB_PUTS''@/$(GL_GNULIB_PUTS)/g' \
+	      -e 's/@''GNULIB_REMOVE''@/$(GL_GNULIB_REMOVE)/g' \
+	      -e 's/@''GNULIB_RENAME''@/$(GL_GNULIB_RENAME)/g' \
+	      -e 's/@''GNULIB_RENAMEAT''@/$(GL_GNULIB_RENAMEAT)/g' \
+	      -e 's/@''GNULIB_SCANF''@/$(GL_GNULIB_SCANF)/g' \
+	      -e 's/@''GNULIB_SNPRINTF''@/$(GL_GNULIB_SNPRINTF)/g' \
+	      -e 's/@''GNULIB_SPRINTF_POSIX''@/$(GL_GNULIB_SPRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_STDIO_H_NONBLOCKING''@/$(GL_GNULIB_STDIO_H_NONBLOCKING)/g' \
+	      -e 's/@''GNULIB_STDIO_H_SIGPIPE''@/$(GL_GNULIB_STDIO_H_SIGPIPE)/g' \
+	      -e 's/@''GNULIB_TMPFILE''@/$(GL_GNULIB_TMPFILE)/g' \
+	      -e 's/@''GNULIB_VASPRINTF''@/$(GL_GNULIB_VASPRINTF)/g' \
+	      -e 's/@''GNULIB_VDPRINTF''@/$(GL_GNULIB_VDPRINTF)/g' \
+	      -e 's/@''GNULIB_VFPRINTF''@/$(GL_GNULIB_VFPRINTF)/g' \
+	      -e 's/@''GNULIB_VFPRINTF_POSIX''@/$(GL_GNULIB_VFPRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_VFSCANF''@/$(GL_GNULIB_VFSCANF)/g' \
+	      -e 's/@''GNULIB_VSCANF''@/$(GL_GNULIB_VSCANF)/g' \
+	      -e 's/@''GNULIB_VPRINTF''@/$(GL_GNULIB_VPRINTF)/g' \
+	      -e 's/@''GNULIB_VPRINTF_POSIX''@/$(GL_GNULIB_VPRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_VSNPRINTF''@/$(GL_GNULIB_VSNPRINTF)/g' \
+	      -e 's/@''GNULIB_VSPRINTF_POSIX''@/$(GL_GNULIB_VSPRINTF_POSIX)/g' \
+	      -e 's/@''GNULIB_MDA_FCLOSEALL''@/$(GL_GNULIB_MDA_FCLOSEALL)/g' \
+	      -e 's/@''GNULIB_MDA_FDOPEN''@/$(GL_GNULIB_MDA_FDOPEN)/g' \
+	      -e 's/@''GNULIB_MDA_FILENO''@/$(GL_GNULIB_MDA_FILENO)/g' \
+	      -e 's/@''GNULIB_MDA_GETW''@/$(GL_GNULIB_MDA_GETW)/g' \
+	      -e 's/@''GNULIB_MDA_PUTW''@/$(GL_GNULIB_MDA_PUTW)/g' \
+	      -e 's/@''GNULIB_MDA_TEMPNAM''@/$(GL_GNULIB_MDA_TEMPNAM)/g' \
+	      < $(srcdir)/stdio.in.h > $@-t1
+	$(AM_V_at)sed \
+	      -e 's|@''HAVE_DECL_FCLOSEALL''@|$(HAVE_DECL_FCLOSEALL)|g' \
+	      -e 's|@''HAVE_DECL_FPURGE''@|$(HAVE_DECL_FPURGE)|g' \
+	      -e 's|@''HAVE_DECL_FSEEKO''@|$(HAVE_DECL_FSEEKO)|g' \
+	      -e 's|@''HAVE_DECL_FTELLO''@|$(HAVE_DECL_FTELLO)|g' \
+	      -e 's|@''HAVE_DECL_GETDELIM''@|$(HAVE_DECL_GETDELIM)|g' \
+	      -e 's|@''HAVE_DECL_GETLINE''@|$(HAVE_DECL_GETLINE)|g' \
+	      -e 's|@''HAVE_DECL_GETW''@|$(HAVE_DECL_GETW)|g' \
+	      -e 's|@''HAVE_DECL_OBSTACK_PRINTF''@|$(HAVE_DECL_OBSTACK_PRINTF)|g' \
+	      -e 's|@''HAVE_DECL_PUTW''@|$(HAVE_DECL_PUTW)|g' \
+	      -e 's|@''HAVE_DECL_SNPRINTF''@|$(HAVE_DECL_SNPRINTF)|g' \
+	      -e 's|@''HAVE_DECL_VSNPRINTF''@|$(HAVE_DECL_VSNPRINTF)|g' \
+	      -e 's|@''HAVE_DPRINTF''@|$(HAVE_DPRINTF)|g' \
+	      -e 's|@''HAVE_FSEEKO''@|$(HAVE_FSEEKO)|g' \
+	      -e 's|@''HAVE_FTELLO''@|$(HAVE_FTELLO)|g' \
+	      -e 's|@''HAVE_PCLOSE''@|$(HAVE_PCLOSE)|g' \
+	      -e 's|@''HAVE_POPEN''@|$(HAVE_POPEN)|g' \
+	      -e 's|@''HAVE_RENAMEAT''@|$(HAVE_RENAMEAT)|g' \
+	      -e 's|@''HAVE_VASPRINTF''@|$(HAVE_VASPRINTF)|g' \
+	      -e 's|@''HAVE_VDPRINTF''@|$(HAVE_VDPRINTF)|g' \
+	      < $@-t1 > $@-t2
+	$(AM_V_at)sed \
+	      -e 's|@''REPLACE_DPRINTF''@|$(REPLACE_DPRINTF)|g' \
+	      -e 's|@''REPLACE_FCLOSE''@|$(REPLACE_FCLOSE)|g' \
+	      -e 's|@''REPLACE_FDOPEN''@|$(REPLACE_FDOPEN)|g' \
+	      -e 's|@''REPLACE_FFLUSH''@|$(REPLACE_FFLUSH)|g' \
+	      -e 's|@''REPLACE_FOPEN''@|$(REPLACE_FOPEN)|g' \
+	      -e 's|@''REPLACE_FOPEN_FOR_FOPEN_GNU''@|$(REPLACE_FOPEN_FOR_FOPEN_GNU)|g' \
+	      -e 's|@''REPLACE_FPRINTF''@|$(REPLACE_FPRINTF)|g' \
+	      -e 's|@''REPLACE_FPURGE''@|$(REPLACE_FPURGE)|g' \
+	      -e 's|@''REPLACE_FREOPEN''@|$(REPLACE_FREOPEN)|g' \
+	      -e 's|@''REPLACE_FSEEK''@|$(REPLACE_FSEEK)|g' \
+	      -e 's|@''REPLACE_FSEEKO''@|$(REPLACE_FSEEKO)|g' \
+	      -e 's|@''REPLACE_FTELL''@|$(REPLACE_FTELL)|g' \
+	      -e 's|@''REPLACE_FTELLO''@|$(REPLACE_FTELLO)|g' \
+	      -e 's|@''REPLACE_GETDELIM''@|$(REPLACE_GETDELIM)|g' \
+	      -e 's|@''REPLACE_GETLINE''@|$(REPLACE_GETLINE)|g' \
+	      -e 's|@''REPLACE_OBSTACK_PRINTF''@|$(REPLACE_OBSTACK_PRINTF)|g' \
+	      -e 's|@''REPLACE_PERROR''@|$(REPLACE_PERROR)|g' \
+	      -e 's|@''REPLACE_POPEN''@|$(REPLACE_POPEN)|g' \
+	      -e 's|@''REPLACE_PRINTF''@|$(REPLACE_PRINTF)|g' \
+	      -e 's|@''REPLACE_REMOVE''@|$(REPLACE_REMOVE)|g' \
+	      -e 's|@''REPLACE_RENAME''@|$(REPLACE_RENAME)|g' \
+	      -e 's|@''REPLACE_RENAMEAT''@|$(REPLACE_RENAMEAT)|g' \
+	      -e 's|@''REPLACE_SNPRINTF''@|$(REPLACE_SNPRINTF)|g' \
+	      -e 's|@''REPLACE_SPRINTF''@|$(REPLACE_SPRINTF)|g' \
+	      -e 's|@''REPLACE_STDIO_READ_FUNCS''@|$(REPLACE_STDIO_READ_FUNCS)|g' \
+	      -e 's|@''REPLACE_STDIO_WRITE_FUNCS''@|$(REPLACE_STDIO_WRITE_FUNCS)|g' \
+	      -e 's|@''REPLACE_TMPFILE''@|$(REPLACE_TMPFILE)|g' \
+	      -e 's|@''REPLACE_VASPRINTF''@|$(REPLACE_VASPRINTF)|g' \
+	      -e 's|@''REPLACE_VDPRINTF''@|$(REPLACE_VDPRINTF)|g' \
+	      -e 's|@''REPLACE_VFPRINTF''@|$(REPLACE_VFPRINTF)|g' \
+	      -e 's|@''REPLACE_VPRINTF''@|$(REPLACE_VPRINTF)|g' \
+	      -e 's|@''REPLACE_VSNPRINTF''@|$(REPLACE_VSNPRINTF)|g' \
+	      -e 's|@''REPLACE_VSPRINTF''@|$(REPLACE_VSPRINTF)|g' \
+	      -e 's|@''ASM_SYMBOL_PREFIX''@|$(ASM_SYMBOL_PREFIX)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      < $@-t2 > $@-t3
+	$(AM_V_at)rm -f $@-t1 $@-t2
+	$(AM_V_at)mv $@-t3 $@
+MOSTLYCLEANFILES += stdio.h stdio.h-t1 stdio.h-t2 stdio.h-t3
+
+ifneq (,$(GL_COND_OBJ_STDIO_READ_CONDITION))
+libgnu_a_SOURCES += stdio-read.c
+endif
+ifneq (,$(GL_COND_OBJ_STDIO_WRITE_CONDITION))
+libgnu_a_SOURCES += stdio-write.c
+endif
+
+EXTRA_DIST += stdio.in.h
+
+endif
+## end   gnulib module stdio
+
+## begin gnulib module stdlib
+ifeq (,$(OMIT_GNULIB_MODULE_stdlib))
+
+BUILT_SOURCES += stdlib.h
+
+# We need the following in order to create <stdlib.h> when the system
+# doesn't have one that works with the given compiler.
+stdlib.h: stdlib.in.h $(top_builddir)/config.status $(CXXDEFS_H) \
+  $(_NORETURN_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STDLIB_H''@|$(NEXT_STDLIB_H)|g' \
+	      -e 's/@''GNULIB__EXIT''@/$(GL_GNULIB__EXIT)/g' \
+	      -e 's/@''GNULIB_ALIGNED_ALLOC''@/$(GL_GNULIB_ALIGNED_ALLOC)/g' \
+	      -e 's/@''GNULIB_ATOLL''@/$(GL_GNULIB_ATOLL)/g' \
+	      -e 's/@''GNULIB_CALLOC_GNU''@/$(GL_GNULIB_CALLOC_GNU)/g' \
+	      -e 's/@''GNULIB_CALLOC_POSIX''@/$(GL_GNULIB_CALLOC_POSIX)/g' \
+	      -e 's/@''GNULIB_CANONICALIZE_FILE_NAME''@/$(GL_GNULIB_CANONICALIZE_FILE_NAME)/g' \
+	      -e 's/@''GNULIB_FREE_POSIX''@/$(GL_GNULIB_FREE_POSIX)/g' \
+	      -e 's/@''GNULIB_GETLOADAVG''@/$(GL_GNULIB_GETLOADAVG)/g' \
+	      -e 's/@''GNULIB_GETPROGNAME''@/$(GL_GNULIB_GETPROGNAME)/g' \
+	      -e 's/@''GNULIB_GETSUBOPT''@/$(GL_GNULIB_GETSUBOPT)/g' \
+	      -e 's/@''GNULIB_GRANTPT''@/$(GL_GNULIB_GRANTPT)/g' \
+	      -e 's/@''GNULIB_MALLOC_GNU''@/$(GL_GNULIB_MALLOC_GNU)/g' \
+	      -e 's/@''GNULIB_MALLOC_POSIX''@/$(GL_GNULIB_MALLOC_POSIX)/g' \
+	      -e 's/@''GNULIB_MBSTOWCS''@/$(GL_GNULIB_MBSTOWCS)/g' \
+	      -e 's/@''GNULIB_MBTOWC''@/$(GL_GNULIB_MBTOWC)/g' \
+	      -e 's/@''GNULIB_MKDTEMP''@/$(GL_GNULIB_MKDTEMP)/g' \
+	      -e 's/@''GNULIB_MKOSTEMP''@/$(GL_GNULIB_MKOSTEMP)/g' \
+	      -e 's/@''GNULIB_MKOSTEMPS''@/$(GL_GNULIB_MKOSTEMPS)/g' \
+	      -e 's/@''GNULIB_MKSTEMP''@/$(GL_GNULIB_MKSTEMP)/g' \
+	      -e 's/@''GNULIB_MKSTEMPS''@/$(GL_GNULIB_MKSTEMPS)/g' \
+	      -e 's/@''GNULIB_POSIX_MEMALIGN''@/$(GL_GNULIB_POSIX_MEMALIGN)/g' \
+	      -e 's/@''GNULIB_POSIX_OPENPT''@/$(GL_GNULIB_POSIX_OPENPT)/g' \
+	      -e 's/@''GNULIB_PTSNAME''@/$(GL_GNULIB_PTSNAME)/g' \
+	      -e 's/@''GNULIB_PTSNAME_R''@/$(GL_GNULIB_PTSNAME_R)/g' \
+	      -e 's/@''GNULIB_PUTENV''@/$(GL_GNULIB_PUTENV)/g' \
+	      -e 's/@''GNULIB_QSORT_R''@/$(GL_GNULIB_QSORT_R)/g' \
+	      -e 's/@''GNULIB_RAND''@/$(GL_GNULIB_RAND)/g' \
+	      -e 's/@''GNULIB_RANDOM''@/$(GL_GNULIB_RANDOM)/g' \
+	      -e 's/@''GNULIB_RANDOM_R''@/$(GL_GNULIB_RANDOM_R)/g' \
+	      -e 's/@''GNULIB_REALLOC_GNU''@/$(GL_GNULIB_REALLOC_GNU)/g' \
+	      -e 's/@''GNULIB_REALLOC_POSIX''@/$(GL_GNULIB_REALLOC_POSIX)/g' \
+	      -e 's/@''GNULIB_REALLOCARRAY''@/$(GL_GNULIB_REALLOCARRAY)/g' \
+	      -e 's/@''GNULIB_REALPATH''@/$(GL_GNULIB_REALPATH)/g' \
+	      -e 's/@''GNULIB_RPMATCH''@/$(GL_GNULIB_RPMATCH)/g' \
+	      -e 's/@''GNULIB_SECURE_GETENV''@/$(GL_GNULIB_SECURE_GETENV)/g' \
+	      -e 's/@''GNULIB_SETENV''@/$(GL_GNULIB_SETENV)/g' \
+	      -e 's/@''GNULIB_STRTOD''@/$(GL_GNULIB_STRTOD)/g' \
+	      -e 's/@''GNULIB_STRTOL''@/$(GL_GNULIB_STRTOL)/g' \
+	      -e 's/@''GNULIB_STRTOLD''@/$(GL_GNULIB_STRTOLD)/g' \
+	      -e 's/@''GNULIB_STRTOLL''@/$(GL_GNULIB_STRTOLL)/g' \
+	      -e 's/@''GNULIB_STRTOUL''@/$(GL_GNULIB_STRTOUL)/g' \
+	      -e 's/@''GNULIB_STRTOULL''@/$(GL_GNULIB_STRTOULL)/g' \
+	      -e 's/@''GNULIB_SYSTEM_POSIX''@/$(GL_GNULIB_SYSTEM_POSIX)/g' \
+	      -e 's/@''GNULIB_UNLOCKPT''@/$(GL_GNULIB_UNLOCKPT)/g' \
+	      -e 's/@''GNULIB_UNSETENV''@/$(GL_GNULIB_UNSETENV)/g' \
+	      -e 's/@''GNULIB_WCTOMB''@/$(GL_GNULIB_WCTOMB)/g' \
+	      -e 's/@''GNULIB_MDA_ECVT''@/$(GL_GNULIB_MDA_ECVT)/g' \
+	      -e 's/@''GNULIB_MDA_FCVT''@/$(GL_GNULIB_MDA_FCVT)/g' \
+	      -e 's/@''GNULIB_MDA_GCVT''@/$(GL_GNULIB_MDA_GCVT)/g' \
+	      -e 's/@''GNULIB_MDA_MKTEMP''@/$(GL_GNULIB_MDA_MKTEMP)/g' \
+	      -e 's/@''GNULIB_MDA_PUTENV''@/$(GL_GNULIB_MDA_PUTENV)/g' \
+	      < $(srcdir)/stdlib.in.h > $@-t1
+	$(AM_V_at)sed \
+	      -e 's|@''HAVE__EXIT''@|$(HAVE__EXIT)|g' \
+	      -e 's|@''HAVE_ALIGNED_ALLOC''@|$(HAVE_ALIGNED_ALLOC)|g' \
+	      -e 's|@''HAVE_ATOLL''@|$(HAVE_ATOLL)|g' \
+	      -e 's|@''HAVE_CANONICALIZE_FILE_NAME''@|$(HAVE_CANONICALIZE_FILE_NAME)|g' \
+	      -e 's|@''HAVE_DECL_ECVT''@|$(HAVE_DECL_ECVT)|g' \
+	      -e 's|@''HAVE_DECL_FCVT''@|$(HAVE_DECL_FCVT)|g' \
+	      -e 's|@''HAVE_DECL_GCVT''@|$(HAVE_DECL_GCVT)|g' \
+	      -e 's|@''HAVE_DECL_GETLOADAVG''@|$(HAVE_DECL_GETLOADAVG)|g' \
+	      -e 's|@''HAVE_DECL_PROGRAM_INVOCATION_NAME''@|$(HAVE_DECL_PROGRAM_INVOCATION_NAME)|g' \
+	      -e 's|@''HAVE_GETPROGNAME''@|$(HAVE_GETPROGNAME)|g' \
+	      -e 's|@''HAVE_GETSUBOPT''@|$(HAVE_GETSUBOPT)|g' \
+	      -e 's|@''HAVE_GRANTPT''@|$(HAVE_GRANTPT)|g' \
+	      -e 's|@''HAVE_INITSTATE''@|$(HAVE_INITSTATE)|g' \
+	      -e 's|@''HAVE_DECL_INITSTATE''@|$(HAVE_DECL_INITSTATE)|g' \
+	      -e 's|@''HAVE_MBTOWC''@|$(HAVE_MBTOWC)|g' \
+	      -e 's|@''HAVE_MKDTEMP''@|$(HAVE_MKDTEMP)|g' \
+	      -e 's|@''HAVE_MKOSTEMP''@|$(HAVE_MKOSTEMP)|g' \
+	      -e 's|@''HAVE_MKOSTEMPS''@|$(HAVE_MKOSTEMPS)|g' \
+	      -e 's|@''HAVE_MKSTEMP''@|$(HAVE_MKSTEMP)|g' \
+	      -e 's|@''HAVE_MKSTEMPS''@|$(HAVE_MKSTEMPS)|g' \
+	      -e 's|@''HAVE_POSIX_MEMALIGN''@|$(HAVE_POSIX_MEMALIGN)|g' \
+	      -e 's|@''HAVE_POSIX_OPENPT''@|$(HAVE_POSIX_OPENPT)|g' \
+	      -e 's|@''HAVE_PTSNAME''@|$(HAVE_PTSNAME)|g' \
+	      -e 's|@''HAVE_PTSNAME_R''@|$(HAVE_PTSNAME_R)|g' \
+	      -e 's|@''HAVE_QSORT_R''@|$(HAVE_QSORT_R)|g' \
+	      -e 's|@''HAVE_RANDOM''@|$(HAVE_RANDOM)|g' \
+	      -e 's|@''HAVE_RANDOM_H''@|$(HAVE_RANDOM_H)|g' \
+	      -e 's|@''HAVE_RANDOM_R''@|$(HAVE_RANDOM_R)|g' \
+	      -e 's|@''HAVE_REALLOCARRAY''@|$(HAVE_REALLOCARRAY)|g' \
+	      -e 's|@''HAVE_REALPATH''@|$(HAVE_REALPATH)|g' \
+	      -e 's|@''HAVE_RPMATCH''@|$(HAVE_RPMATCH)|g' \
+	      -e 's|@''HAVE_SECURE_GETENV''@|$(HAVE_SECURE_GETENV)|g' \
+	      -e 's|@''HAVE_DECL_SETENV''@|$(HAVE_DECL_SETENV)|g' \
+	      -e 's|@''HAVE_SETSTATE''@|$(HAVE_SETSTATE)|g' \
+	      -e 's|@''HAVE_DECL_SETSTATE''@|$(HAVE_DECL_SETSTATE)|g' \
+	      -e 's|@''HAVE_STRTOD''@|$(HAVE_STRTOD)|g' \
+	      -e 's|@''HAVE_STRTOL''@|$(HAVE_STRTOL)|g' \
+	      -e 's|@''HAVE_STRTOLD''@|$(HAVE_STRTOLD)|g' \
+	      -e 's|@''HAVE_STRTOLL''@|$(HAVE_STRTOLL)|g' \
+	      -e 's|@''HAVE_STRTOUL''@|$(HAVE_STRTOUL)|g' \
+	      -e 's|@''HAVE_STRTOULL''@|$(HAVE_STRTOULL)|g' \
+	      -e 's|@''HAVE_STRUCT_RANDOM_DATA''@|$(HAVE_STRUCT_RANDOM_DATA)|g' \
+	      -e 's|@''HAVE_SYS_LOADAVG_H''@|$(HAVE_SYS_LOADAVG_H)|g' \
+	      -e 's|@''HAVE_UNLOCKPT''@|$(HAVE_UNLOCKPT)|g' \
+	      -e 's|@''HAVE_DECL_UNSETENV''@|$(HAVE_DECL_UNSETENV)|g' \
+	      < $@-t1 > $@-t2
+	$(AM_V_at)sed \
+	      -e 's|@''REPLACE__EXIT''@|$(REPLACE__EXIT)|g' \
+	      -e 's|@''REPLACE_ALIGNED_ALLOC''@|$(REPLACE_ALIGNED_ALLOC)|g' \
+	      -e 's|@''REPLACE_CALLOC_FOR_CALLOC_GNU''@|$(REPLACE_CALLOC_FOR_CALLOC_GNU)|g' \
+	      -e 's|@''REPLACE_CALLOC_FOR_CALLOC_POSIX''@|$(REPLACE_CALLOC_FOR_CALLOC_POSIX)|g' \
+	      -e 's|@''REPLACE_CANONICALIZE_FILE_NAME''@|$(REPLACE_CANONICALIZE_FILE_NAME)|g' \
+	      -e 's|@''REPLACE_FREE''@|$(REPLACE_FREE)|g' \
+	      -e 's|@''REPLACE_GETLOADAVG''@|$(REPLACE_GETLOADAVG)|g' \
+	      -e 's|@''REPLACE_GETPROGNAME''@|$(REPLACE_GETPROGNAME)|g' \
+	      -e 's|@''REPLACE_GETSUBOPT''@|$(REPLACE_GETSUBOPT)|g' \
+	      -e 's|@''REPLACE_INITSTATE''@|$(REPLACE_INITSTATE)|g' \
+	      -e 's|@''REPLACE_MALLOC_FOR_MALLOC_GNU''@|$(REPLACE_MALLOC_FOR_MALLOC_GNU)|g' \
+	      -e 's|@''REPLACE_MALLOC_FOR_MALLOC_POSIX''@|$(REPLACE_MALLOC_FOR_MALLOC_POSIX)|g' \
+	      -e 's|@''REPLACE_MB_CUR_MAX''@|$(REPLACE_MB_CUR_MAX)|g' \
+	      -e 's|@''REPLACE_MBSTOWCS''@|$(REPLACE_MBSTOWCS)|g' \
+	      -e 's|@''REPLACE_MBTOWC''@|$(REPLACE_MBTOWC)|g' \
+	      -e 's|@''REPLACE_MKOSTEMP''@|$(REPLACE_MKOSTEMP)|g' \
+	      -e 's|@''REPLACE_MKOSTEMPS''@|$(REPLACE_MKOSTEMPS)|g' \
+	      -e 's|@''REPLACE_MKSTEMP''@|$(REPLACE_MKSTEMP)|g' \
+	      -e 's|@''REPLACE_POSIX_MEMALIGN''@|$(REPLACE_POSIX_MEMALIGN)|g' \
+	      -e 's|@''REPLACE_POSIX_OPENPT''@|$(REPLACE_POSIX_OPENPT)|g' \
+	      -e 's|@''REPLACE_PTSNAME''@|$(REPLACE_PTSNAME)|g' \
+	      -e 's|@''REPLACE_PTSNAME_R''@|$(REPLACE_PTSNAME_R)|g' \
+	      -e 's|@''REPLACE_PUTENV''@|$(REPLACE_PUTENV)|g' \
+	      -e 's|@''REPLACE_QSORT_R''@|$(REPLACE_QSORT_R)|g' \
+	      -e 's|@''REPLACE_RAND''@|$(REPLACE_RAND)|g' \
+	      -e 's|@''REPLACE_RANDOM''@|$(REPLACE_RANDOM)|g' \
+	      -e 's|@''REPLACE_RANDOM_R''@|$(REPLACE_RANDOM_R)|g' \
+	      -e 's|@''REPLACE_REALLOC_FOR_REALLOC_GNU''@|$(REPLACE_REALLOC_FOR_REALLOC_GNU)|g' \
+	      -e 's|@''REPLACE_REALLOC_FOR_REALLOC_POSIX''@|$(REPLACE_REALLOC_FOR_REALLOC_POSIX)|g' \
+	      -e 's|@''REPLACE_REALLOCARRAY''@|$(REPLACE_REALLOCARRAY)|g' \
+	      -e 's|@''REPLACE_REALPATH''@|$(REPLACE_REALPATH)|g' \
+	      -e 's|@''REPLACE_SETENV''@|$(REPLACE_SETENV)|g' \
+	      -e 's|@''REPLACE_SETSTATE''@|$(REPLACE_SETSTATE)|g' \
+	      -e 's|@''REPLACE_STRTOD''@|$(REPLACE_STRTOD)|g' \
+	      -e 's|@''REPLACE_STRTOL''@|$(REPLACE_STRTOL)|g' \
+	      -e 's|@''REPLACE_STRTOLD''@|$(REPLACE_STRTOLD)|g' \
+	      -e 's|@''REPLACE_STRTOLL''@|$(REPLACE_STRTOLL)|g' \
+	      -e 's|@''REPLACE_STRTOUL''@|$(REPLACE_STRTOUL)|g' \
+	      -e 's|@''REPLACE_STRTOULL''@|$(REPLACE_STRTOULL)|g' \
+	      -e 's|@''REPLACE_UNSETENV''@|$(REPLACE_UNSETENV)|g' \
+	      -e 's|@''REPLACE_WCTOMB''@|$(REPLACE_WCTOMB)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _Noreturn/r $(_NORETURN_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      < $@-t2 > $@-t3
+	$(AM_V_at)rm -f $@-t1 $@-t2
+	$(AM_V_at)mv $@-t3 $@
+MOSTLYCLEANFILES += stdlib.h stdlib.h-t1 stdlib.h-t2 stdlib.h-t3
+
+EXTRA_DIST += stdlib.in.h
+
+endif
+## end   gnulib module stdlib
+
+## begin gnulib module stpcpy
+ifeq (,$(OMIT_GNULIB_MODULE_stpcpy))
+
+ifneq (,$(GL_COND_OBJ_STPCPY_CONDITION))
+libgnu_a_SOURCES += stpcpy.c
+endif
+
+endif
+## end   gnulib module stpcpy
+
+## begin gnulib module strerror
+ifeq (,$(OMIT_GNULIB_MODULE_strerror))
+
+ifneq (,$(gl_GNULIB_ENABLED_strerror_CONDITION))
+ifneq (,$(GL_COND_OBJ_STRERROR_CONDITION))
+libgnu_a_SOURCES += strerror.c
+endif
+
+endif
+endif
+## end   gnulib module strerror
+
+## begin gnulib module strerror-override
+ifeq (,$(OMIT_GNULIB_MODULE_strerror-override))
+
+ifneq (,$(gl_GNULIB_ENABLED_dbb57f49352be8fb86869629a254fb72_CONDITION))
+ifneq (,$(GL_COND_OBJ_STRERROR_OVERRIDE_CONDITION))
+libgnu_a_SOURCES += strerror-override.c
+endif
+
+endif
+EXTRA_DIST += strerror-override.h
+
+endif
+## end   gnulib module strerror-override
+
+## begin gnulib module string
+ifeq (,$(OMIT_GNULIB_MODULE_string))
+
+BUILT_SOURCES += string.h
+
+# We need the following in order to create <string.h> when the system
+# doesn't have one that works with the given compiler.
+string.h: string.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STRING_H''@|$(NEXT_STRING_H)|g' \
+	      -e 's/@''GNULIB_EXPLICIT_BZERO''@/$(GL_GNULIB_EXPLICIT_BZERO)/g' \
+	      -e 's/@''GNULIB_FFSL''@/$(GL_GNULIB_FFSL)/g' \
+	      -e 's/@''GNULIB_FFSLL''@/$(GL_GNULIB_FFSLL)/g' \
+	      -e 's/@''GNULIB_MBSLEN''@/$(GL_GNULIB_MBSLEN)/g' \
+	      -e 's/@''GNULIB_MBSNLEN''@/$(GL_GNULIB_MBSNLEN)/g' \
+	      -e 's/@''GNULIB_MBSCHR''@/$(GL_GNULIB_MBSCHR)/g' \
+	      -e 's/@''GNULIB_MBSRCHR''@/$(GL_GNULIB_MBSRCHR)/g' \
+	      -e 's/@''GNULIB_MBSSTR''@/$(GL_GNULIB_MBSSTR)/g' \
+	      -e 's/@''GNULIB_MBSCASECMP''@/$(GL_GNULIB_MBSCASECMP)/g' \
+	      -e 's/@''GNULIB_MBSNCASECMP''@/$(GL_GNULIB_MBSNCASECMP)/g' \
+	      -e 's/@''GNULIB_MBSPCASECMP''@/$(GL_GNULIB_MBSPCASECMP)/g' \
+	      -e 's/@''GNULIB_MBSCASESTR''@/$(GL_GNULIB_MBSCASESTR)/g' \
+	      -e 's/@''GNULIB_MBSCSPN''@/$(GL_GNULIB_MBSCSPN)/g' \
+	      -e 's/@''GNULIB_MBSPBRK''@/$(GL_GNULIB_MBSPBRK)/g' \
+	      -e 's/@''GNULIB_MBSSPN''@/$(GL_GNULIB_MBSSPN)/g' \
+	      -e 's/@''GNULIB_MBSSEP''@/$(GL_GNULIB_MBSSEP)/g' \
+	      -e 's/@''GNULIB_MBSTOK_R''@/$(GL_GNULIB_MBSTOK_R)/g' \
+	      -e 's/@''GNULIB_MEMCHR''@/$(GL_GNULIB_MEMCHR)/g' \
+	      -e 's/@''GNULIB_MEMMEM''@/$(GL_GNULIB_MEMMEM)/g' \
+	      -e 's/@''GNULIB_MEMPCPY''@/$(GL_GNULIB_MEMPCPY)/g' \
+	      -e 's/@''GNULIB_MEMRCHR''@/$(GL_GNULIB_MEMRCHR)/g' \
+	      -e 's/@''GNULIB_MEMSET_EXPLICIT''@/$(GL_GNULIB_MEMSET_EXPLICIT)/g' \
+	      -e 's/@''GNULIB_RAWMEMCHR''@/$(GL_GNULIB_RAWMEMCHR)/g' \
+	      -e 's/@''GNULIB_STPCPY''@/$(GL_GNULIB_STPCPY)/g' \
+	      -e 's/@''GNULIB_STPNCPY''@/$(GL_GNULIB_STPNCPY)/g' \
+	      -e 's/@''GNULIB_STRCHRNUL''@/$(GL_GNULIB_STRCHRNUL)/g' \
+	      -e 's/@''GNULIB_STRDUP''@/$(GL_GNULIB_STRDUP)/g' \
+	      -e 's/@''GNULIB_STRNCAT''@/$(GL_GNULIB_STRNCAT)/g' \
+	      -e 's/@''GNULIB_STRNDUP''@/$(GL_GNULIB_STRNDUP)/g' \
+	      -e 's/@''GNULIB_STRNLEN''@/$(GL_GNULIB_STRNLEN)/g' \
+	      -e 's/@''GNULIB_STRPBRK''@/$(GL_GNULIB_STRPBRK)/g' \
+	      -e 's/@''GNULIB_STRSEP''@/$(GL_GNULIB_STRSEP)/g' \
+	      -e 's/@''GNULIB_STRSTR''@/$(GL_GNULIB_STRSTR)/g' \
+	      -e 's/@''GNULIB_STRCASESTR''@/$(GL_GNULIB_STRCASESTR)/g' \
+	      -e 's/@''GNULIB_STRTOK_R''@/$(GL_GNULIB_STRTOK_R)/g' \
+	      -e 's/@''GNULIB_STRERROR''@/$(GL_GNULIB_STRERROR)/g' \
+	      -e 's/@''GNULIB_STRERROR_R''@/$(GL_GNULIB_STRERROR_R)/g' \
+	      -e 's/@''GNULIB_STRERRORNAME_NP''@/$(GL_GNULIB_STRERRORNAME_NP)/g' \
+	      -e 's/@''GNULIB_SIGABBREV_NP''@/$(GL_GNULIB_SIGABBREV_NP)/g' \
+	      -e 's/@''GNULIB_SIGDESCR_NP''@/$(GL_GNULIB_SIGDESCR_NP)/g' \
+	      -e 's/@''GNULIB_STRSIGNAL''@/$(GL_GNULIB_STRSIGNAL)/g' \
+	      -e 's/@''GNULIB_STRVERSCMP''@/$(GL_GNULIB_STRVERSCMP)/g' \
+	      -e 's/@''GNULIB_MDA_MEMCCPY''@/$(GL_GNULIB_MDA_MEMCCPY)/g' \
+	      -e 's/@''GNULIB_MDA_STRDUP''@/$(GL_GNULIB_MDA_STRDUP)/g' \
+	      -e 's/@''GNULIB_FREE_POSIX''@/$(GL_GNULIB_FREE_POSIX)/g' \
+	      < $(srcdir)/string.in.h > $@-t1
+	$(AM_V_at)sed \
+	      -e 's|@''HAVE_EXPLICIT_BZERO''@|$(HAVE_EXPLICIT_BZERO)|g' \
+	      -e 's|@''HAVE_FFSL''@|$(HAVE_FFSL)|g' \
+	      -e 's|@''HAVE_FFSLL''@|$(HAVE_FFSLL)|g' \
+	      -e 's|@''HAVE_MBSLEN''@|$(HAVE_MBSLEN)|g' \
+	      -e 's|@''HAVE_DECL_MEMMEM''@|$(HAVE_DECL_MEMMEM)|g' \
+	      -e 's|@''HAVE_MEMPCPY''@|$(HAVE_MEMPCPY)|g' \
+	      -e 's|@''HAVE_DECL_MEMRCHR''@|$(HAVE_DECL_MEMRCHR)|g' \
+	      -e 's|@''HAVE_MEMSET_EXPLICIT''@|$(HAVE_MEMSET_EXPLICIT)|g' \
+	      -e 's|@''HAVE_RAWMEMCHR''@|$(HAVE_RAWMEMCHR)|g' \
+	      -e 's|@''HAVE_STPCPY''@|$(HAVE_STPCPY)|g' \
+	      -e 's|@''HAVE_STPNCPY''@|$(HAVE_STPNCPY)|g' \
+	      -e 's|@''HAVE_STRCHRNUL''@|$(HAVE_STRCHRNUL)|g' \
+	      -e 's|@''HAVE_DECL_STRDUP''@|$(HAVE_DECL_STRDUP)|g' \
+	      -e 's|@''HAVE_DECL_STRNDUP''@|$(HAVE_DECL_STRNDUP)|g' \
+	      -e 's|@''HAVE_DECL_STRNLEN''@|$(HAVE_DECL_STRNLEN)|g' \
+	      -e 's|@''HAVE_STRPBRK''@|$(HAVE_STRPBRK)|g' \
+	      -e 's|@''HAVE_STRSEP''@|$(HAVE_STRSEP)|g' \
+	      -e 's|@''HAVE_STRCASESTR''@|$(HAVE_STRCASESTR)|g' \
+	      -e 's|@''HAVE_DECL_STRTOK_R''@|$(HAVE_DECL_STRTOK_R)|g' \
+	      -e 's|@''HAVE_DECL_STRERROR_R''@|$(HAVE_DECL_STRERROR_R)|g' \
+	      -e 's|@''HAVE_STRERRORNAME_NP''@|$(HAVE_STRERRORNAME_NP)|g' \
+	      -e 's|@''HAVE_SIGABBREV_NP''@|$(HAVE_SIGABBREV_NP)|g' \
+	      -e 's|@''HAVE_SIGDESCR_NP''@|$(HAVE_SIGDESCR_NP)|g' \
+	      -e 's|@''HAVE_DECL_STRSIGNAL''@|$(HAVE_DECL_STRSIGNAL)|g' \
+	      -e 's|@''HAVE_STRVERSCMP''@|$(HAVE_STRVERSCMP)|g' \
+	      -e 's|@''REPLACE_FFSLL''@|$(REPLACE_FFSLL)|g' \
+	      -e 's|@''REPLACE_MEMCHR''@|$(REPLACE_MEMCHR)|g' \
+	      -e 's|@''REPLACE_MEMMEM''@|$(REPLACE_MEMMEM)|g' \
+	      -e 's|@''REPLACE_MEMPCPY''@|$(REPLACE_MEMPCPY)|g' \
+	      -e 's|@''REPLACE_FREE''@|$(REPLACE_FREE)|g' \
+	      -e 's|@''REPLACE_STPCPY''@|$(REPLACE_STPCPY)|g' \
+	      -e 's|@''REPLACE_STPNCPY''@|$(REPLACE_STPNCPY)|g' \
+	      -e 's|@''REPLACE_STRCHRNUL''@|$(REPLACE_STRCHRNUL)|g' \
+	      -e 's|@''REPLACE_STRDUP''@|$(REPLACE_STRDUP)|g' \
+	      -e 's|@''REPLACE_STRNCAT''@|$(REPLACE_STRNCAT)|g' \
+	      -e 's|@''REPLACE_STRNDUP''@|$(REPLACE_STRNDUP)|g' \
+	      -e 's|@''REPLACE_STRNLEN''@|$(REPLACE_STRNLEN)|g' \
+	      -e 's|@''REPLACE_STRSTR''@|$(REPLACE_STRSTR)|g' \
+	      -e 's|@''REPLACE_STRCASESTR''@|$(REPLACE_STRCASESTR)|g' \
+	      -e 's|@''REPLACE_STRTOK_R''@|$(REPLACE_STRTOK_R)|g' \
+	      -e 's|@''REPLACE_STRERROR''@|$(REPLACE_STRERROR)|g' \
+	      -e 's|@''REPLACE_STRERROR_R''@|$(REPLACE_STRERROR_R)|g' \
+	      -e 's|@''REPLACE_STRERRORNAME_NP''@|$(REPLACE_STRERRORNAME_NP)|g' \
+	      -e 's|@''REPLACE_STRSIGNAL''@|$(REPLACE_STRSIGNAL)|g' \
+	      -e 's|@''REPLACE_STRVERSCMP''@|$(REPLACE_STRVERSCMP)|g' \
+	      -e 's|@''UNDEFINE_STRTOK_R''@|$(UNDEFINE_STRTOK_R)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      < $@-t1 > $@-t2
+	$(AM_V_at)rm -f $@-t1
+	$(AM_V_at)mv $@-t2 $@
+MOSTLYCLEANFILES += string.h string.h-t1 string.h-t2
+
+EXTRA_DIST += string.in.h
+
+endif
+## end   gnulib module string
+
+## begin gnulib module strings
+ifeq (,$(OMIT_GNULIB_MODULE_strings))
+
+ifneq (,$(gl_GNULIB_ENABLED_strings_CONDITION))
+BUILT_SOURCES += strings.h
+
+# We need the following in order to create <strings.h> when the system
+# doesn't have one that works with the given compiler.
+strings.h: strings.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(WARN_ON_USE_H) $(ARG_NONNULL_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''HAVE_STRINGS_H''@|$(HAVE_STRINGS_H)|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_STRINGS_H''@|$(NEXT_STRINGS_H)|g' \
+	      -e 's/@''GNULIB_FFS''@/$(GL_GNULIB_FFS)/g' \
+	      -e 's|@''HAVE_FFS''@|$(HAVE_FFS)|g' \
+	      -e 's|@''HAVE_STRCASECMP''@|$(HAVE_STRCASECMP)|g' \
+	      -e 's|@''HAVE_DECL_STRNCASECMP''@|$(HAVE_DECL_STRNCASECMP)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/strings.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += strings.h strings.h-t
+
+endif
+EXTRA_DIST += strings.in.h
+
+endif
+## end   gnulib module strings
+
+## begin gnulib module strnlen
+ifeq (,$(OMIT_GNULIB_MODULE_strnlen))
+
+ifneq (,$(GL_COND_OBJ_STRNLEN_CONDITION))
+libgnu_a_SOURCES += strnlen.c
+endif
+
+endif
+## end   gnulib module strnlen
+
+## begin gnulib module strtoimax
+ifeq (,$(OMIT_GNULIB_MODULE_strtoimax))
+
+ifneq (,$(GL_COND_OBJ_STRTOIMAX_CONDITION))
+libgnu_a_SOURCES += strtoimax.c
+endif
+
+endif
+## end   gnulib module strtoimax
+
+## begin gnulib module strtoll
+ifeq (,$(OMIT_GNULIB_MODULE_strtoll))
+
+ifneq (,$(gl_GNULIB_ENABLED_strtoll_CONDITION))
+ifneq (,$(GL_COND_OBJ_STRTOLL_CONDITION))
+libgnu_a_SOURCES += strtoll.c
+endif
+
+endif
+EXTRA_DIST += strtol.c
+
+EXTRA_libgnu_a_SOURCES += strtol.c
+
+endif
+## end   gnulib module strtoll
+
+## begin gnulib module symlink
+ifeq (,$(OMIT_GNULIB_MODULE_symlink))
+
+ifneq (,$(GL_COND_OBJ_SYMLINK_CONDITION))
+libgnu_a_SOURCES += symlink.c
+endif
+
+endif
+## end   gnulib module symlink
+
+## begin gnulib module sys_random
+ifeq (,$(OMIT_GNULIB_MODULE_sys_random))
+
+BUILT_SOURCES += sys/random.h
+
+# We need the following in order to create <sys/random.h> when the system
+# doesn't have one.
+sys/random.h: sys_random.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(AM_V_GEN)$(MKDIR_P) 'sys'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SYS_RANDOM_H''@|$(NEXT_SYS_RANDOM_H)|g' \
+	      -e 's|@''HAVE_SYS_RANDOM_H''@|$(HAVE_SYS_RANDOM_H)|g' \
+	      -e 's/@''GNULIB_GETRANDOM''@/$(GL_GNULIB_GETRANDOM)/g' \
+	      -e 's/@''HAVE_GETRANDOM''@/$(HAVE_GETRANDOM)/g' \
+	      -e 's/@''REPLACE_GETRANDOM''@/$(REPLACE_GETRANDOM)/g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/sys_random.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += sys/random.h sys/random.h-t
+MOSTLYCLEANDIRS += sys
+
+EXTRA_DIST += sys_random.in.h
+
+endif
+## end   gnulib module sys_random
+
+## begin gnulib module sys_select
+ifeq (,$(OMIT_GNULIB_MODULE_sys_select))
+
+BUILT_SOURCES += sys/select.h
+
+# We need the following in order to create <sys/select.h> when the system
+# doesn't have one that works with the given compiler.
+sys/select.h: sys_select.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(WARN_ON_USE_H)
+	$(AM_V_GEN)$(MKDIR_P) 'sys'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SYS_SELECT_H''@|$(NEXT_SYS_SELECT_H)|g' \
+	      -e 's|@''HAVE_SYS_SELECT_H''@|$(HAVE_SYS_SELECT_H)|g' \
+	      -e 's/@''GNULIB_PSELECT''@/$(GL_GNULIB_PSELECT)/g' \
+	      -e 's/@''GNULIB_SELECT''@/$(GL_GNULIB_SELECT)/g' \
+	      -e 's|@''HAVE_WINSOCK2_H''@|$(HAVE_WINSOCK2_H)|g' \
+	      -e 's|@''HAVE_PSELECT''@|$(HAVE_PSELECT)|g' \
+	      -e 's|@''REPLACE_PSELECT''@|$(REPLACE_PSELECT)|g' \
+	      -e 's|@''REPLACE_SELECT''@|$(REPLACE_SELECT)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/sys_select.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += sys/select.h sys/select.h-t
+MOSTLYCLEANDIRS += sys
+
+EXTRA_DIST += sys_select.in.h
+
+endif
+## end   gnulib module sys_select
+
+## begin gnulib module sys_stat
+ifeq (,$(OMIT_GNULIB_MODULE_sys_stat))
+
+BUILT_SOURCES += sys/stat.h
+
+# We need the following in order to create <sys/stat.h> when the system
+# has one that is incomplete.
+sys/stat.h: sys_stat.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(AM_V_GEN)$(MKDIR_P) 'sys'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SYS_STAT_H''@|$(NEXT_SYS_STAT_H)|g' \
+	      -e 's|@''WINDOWS_64_BIT_ST_SIZE''@|$(WINDOWS_64_BIT_ST_SIZE)|g' \
+	      -e 's|@''WINDOWS_STAT_TIMESPEC''@|$(WINDOWS_STAT_TIMESPEC)|g' \
+	      -e 's/@''GNULIB_CHMOD''@/$(GL_GNULIB_CHMOD)/g' \
+	      -e 's/@''GNULIB_FCHMODAT''@/$(GL_GNULIB_FCHMODAT)/g' \
+	      -e 's/@''GNULIB_FSTAT''@/$(GL_GNULIB_FSTAT)/g' \
+	      -e 's/@''GNULIB_FSTATAT''@/$(GL_GNULIB_FSTATAT)/g' \
+	      -e 's/@''GNULIB_FUTIMENS''@/$(GL_GNULIB_FUTIMENS)/g' \
+	      -e 's/@''GNULIB_GETUMASK''@/$(GL_GNULIB_GETUMASK)/g' \
+	      -e 's/@''GNULIB_LCHMOD''@/$(GL_GNULIB_LCHMOD)/g' \
+	      -e 's/@''GNULIB_LSTAT''@/$(GL_GNULIB_LSTAT)/g' \
+	      -e 's/@''GNULIB_MKDIR''@/$(GL_GNULIB_MKDIR)/g' \
+	      -e 's/@''GNULIB_MKDIRAT''@/$(GL_GNULIB_MKDIRAT)/g' \
+	      -e 's/@''GNULIB_MKFIFO''@/$(GL_GNULIB_MKFIFO)/g' \
+	      -e 's/@''GNULIB_MKFIFOAT''@/$(GL_GNULIB_MKFIFOAT)/g' \
+	      -e 's/@''GNULIB_MKNOD''@/$(GL_GNULIB_MKNOD)/g' \
+	      -e 's/@''GNULIB_MKNODAT''@/$(GL_GNULIB_MKNODAT)/g' \
+	      -e 's/@''GNULIB_STAT''@/$(GL_GNULIB_STAT)/g' \
+	      -e 's/@''GNULIB_UTIMENSAT''@/$(GL_GNULIB_UTIMENSAT)/g' \
+	      -e 's/@''GNULIB_OVERRIDES_STRUCT_STAT''@/$(GL_GNULIB_OVERRIDES_STRUCT_STAT)/g' \
+	      -e 's/@''GNULIB_MDA_CHMOD''@/$(GL_GNULIB_MDA_CHMOD)/g' \
+	      -e 's/@''GNULIB_MDA_MKDIR''@/$(GL_GNULIB_MDA_MKDIR)/g' \
+	      -e 's/@''GNULIB_MDA_UMASK''@/$(GL_GNULIB_MDA_UMASK)/g' \
+	      -e 's|@''HAVE_FCHMODAT''@|$(HAVE_FCHMODAT)|g' \
+	      -e 's|@''HAVE_FSTATAT''@|$(HAVE_FSTATAT)|g' \
+	      -e 's|@''HAVE_FUTIMENS''@|$(HAVE_FUTIMENS)|g' \
+	      -e 's|@''HAVE_GETUMASK''@|$(HAVE_GETUMASK)|g' \
+	      -e 's|@''HAVE_LCHMOD''@|$(HAVE_LCHMOD)|g' \
+	      -e 's|@''HAVE_LSTAT''@|$(HAVE_LSTAT)|g' \
+	      -e 's|@''HAVE_MKDIRAT''@|$(HAVE_MKDIRAT)|g' \
+	      -e 's|@''HAVE_MKFIFO''@|$(HAVE_MKFIFO)|g' \
+	      -e 's|@''HAVE_MKFIFOAT''@|$(HAVE_MKFIFOAT)|g' \
+	      -e 's|@''HAVE_MKNOD''@|$(HAVE_MKNOD)|g' \
+	      -e 's|@''HAVE_MKNODAT''@|$(HAVE_MKNODAT)|g' \
+	      -e 's|@''HAVE_UTIMENSAT''@|$(HAVE_UTIMENSAT)|g' \
+	      -e 's|@''REPLACE_CHMOD''@|$(REPLACE_CHMOD)|g' \
+	      -e 's|@''REPLACE_FCHMODAT''@|$(REPLACE_FCHMODAT)|g' \
+	      -e 's|@''REPLACE_FSTAT''@|$(REPLACE_FSTAT)|g' \
+	      -e 's|@''REPLACE_FSTATAT''@|$(REPLACE_FSTATAT)|g' \
+	      -e 's|@''REPLACE_FUTIMENS''@|$(REPLACE_FUTIMENS)|g' \
+	      -e 's|@''REPLACE_LSTAT''@|$(REPLACE_LSTAT)|g' \
+	      -e 's|@''REPLACE_MKDIR''@|$(REPLACE_MKDIR)|g' \
+	      -e 's|@''REPLACE_MKFIFO''@|$(REPLACE_MKFIFO)|g' \
+	      -e 's|@''REPLACE_MKFIFOAT''@|$(REPLACE_MKFIFOAT)|g' \
+	      -e 's|@''REPLACE_MKNOD''@|$(REPLACE_MKNOD)|g' \
+	      -e 's|@''REPLACE_MKNODAT''@|$(REPLACE_MKNODAT)|g' \
+	      -e 's|@''REPLACE_STAT''@|$(REPLACE_STAT)|g' \
+	      -e 's|@''REPLACE_UTIMENSAT''@|$(REPLACE_UTIMENSAT)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/sys_stat.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += sys/stat.h sys/stat.h-t
+MOSTLYCLEANDIRS += sys
+
+EXTRA_DIST += sys_stat.in.h
+
+endif
+## end   gnulib module sys_stat
+
+## begin gnulib module sys_time
+ifeq (,$(OMIT_GNULIB_MODULE_sys_time))
+
+BUILT_SOURCES += sys/time.h
+
+# We need the following in order to create <sys/time.h> when the system
+# doesn't have one that works with the given compiler.
+sys/time.h: sys_time.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(AM_V_GEN)$(MKDIR_P) 'sys'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's/@''HAVE_SYS_TIME_H''@/$(HAVE_SYS_TIME_H)/g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SYS_TIME_H''@|$(NEXT_SYS_TIME_H)|g' \
+	      -e 's/@''GNULIB_GETTIMEOFDAY''@/$(GL_GNULIB_GETTIMEOFDAY)/g' \
+	      -e 's|@''HAVE_WINSOCK2_H''@|$(HAVE_WINSOCK2_H)|g' \
+	      -e 's/@''HAVE_GETTIMEOFDAY''@/$(HAVE_GETTIMEOFDAY)/g' \
+	      -e 's/@''HAVE_STRUCT_TIMEVAL''@/$(HAVE_STRUCT_TIMEVAL)/g' \
+	      -e 's/@''REPLACE_GETTIMEOFDAY''@/$(REPLACE_GETTIMEOFDAY)/g' \
+	      -e 's/@''REPLACE_STRUCT_TIMEVAL''@/$(REPLACE_STRUCT_TIMEVAL)/g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/sys_time.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += sys/time.h sys/time.h-t
+
+EXTRA_DIST += sys_time.in.h
+
+endif
+## end   gnulib module sys_time
+
+## begin gnulib module sys_types
+ifeq (,$(OMIT_GNULIB_MODULE_sys_types))
+
+BUILT_SOURCES += sys/types.h
+
+# We need the following in order to create <sys/types.h> when the system
+# doesn't have one that works with the given compiler.
+sys/types.h: sys_types.in.h $(top_builddir)/config.status
+	$(AM_V_GEN)$(MKDIR_P) 'sys'
+	$(AM_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_SYS_TYPES_H''@|$(NEXT_SYS_TYPES_H)|g' \
+	      -e 's|@''WINDOWS_64_BIT_OFF_T''@|$(WINDOWS_64_BIT_OFF_T)|g' \
+	      -e 's|@''WINDOWS_STAT_INODES''@|$(WINDOWS_STAT_INODES)|g' \
+	      $(srcdir)/sys_types.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += sys/types.h sys/types.h-t
+
+EXTRA_DIST += sys_types.in.h
+
+endif
+## end   gnulib module sys_types
+
+## begin gnulib module tempname
+ifeq (,$(OMIT_GNULIB_MODULE_tempname))
+
+libgnu_a_SOURCES += tempname.c
+
+EXTRA_DIST += tempname.h
+
+endif
+## end   gnulib module tempname
+
+## begin gnulib module time-h
+ifeq (,$(OMIT_GNULIB_MODULE_time-h))
+
+BUILT_SOURCES += time.h
+
+# We need the following in order to create <time.h> when the system
+# doesn't have one that works with the given compiler.
+time.h: time.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_TIME_H''@|$(NEXT_TIME_H)|g' \
+	      -e 's/@''GNULIB_CTIME''@/$(GL_GNULIB_CTIME)/g' \
+	      -e 's/@''GNULIB_LOCALTIME''@/$(GL_GNULIB_LOCALTIME)/g' \
+	      -e 's/@''GNULIB_MKTIME''@/$(GL_GNULIB_MKTIME)/g' \
+	      -e 's/@''GNULIB_NANOSLEEP''@/$(GL_GNULIB_NANOSLEEP)/g' \
+	      -e 's/@''GNULIB_STRFTIME''@/$(GL_GNULIB_STRFTIME)/g' \
+	      -e 's/@''GNULIB_STRPTIME''@/$(GL_GNULIB_STRPTIME)/g' \
+	      -e 's/@''GNULIB_TIME''@/$(GL_GNULIB_TIME)/g' \
+	      -e 's/@''GNULIB_TIMEGM''@/$(GL_GNULIB_TIMEGM)/g' \
+	      -e 's/@''GNULIB_TIMESPEC_GET''@/$(GL_GNULIB_TIMESPEC_GET)/g' \
+	      -e 's/@''GNULIB_TIMESPEC_GETRES''@/$(GL_GNULIB_TIMESPEC_GETRES)/g' \
+	      -e 's/@''GNULIB_TIME_R''@/$(GL_GNULIB_TIME_R)/g' \
+	      -e 's/@''GNULIB_TIME_RZ''@/$(GL_GNULIB_TIME_RZ)/g' \
+	      -e 's/@''GNULIB_TZSET''@/$(GL_GNULIB_TZSET)/g' \
+	      -e 's/@''GNULIB_MDA_TZSET''@/$(GL_GNULIB_MDA_TZSET)/g' \
+	      -e 's|@''HAVE_DECL_LOCALTIME_R''@|$(HAVE_DECL_LOCALTIME_R)|g' \
+	      -e 's|@''HAVE_NANOSLEEP''@|$(HAVE_NANOSLEEP)|g' \
+	      -e 's|@''HAVE_STRPTIME''@|$(HAVE_STRPTIME)|g' \
+	      -e 's|@''HAVE_TIMEGM''@|$(HAVE_TIMEGM)|g' \
+	      -e 's|@''HAVE_TIMESPEC_GET''@|$(HAVE_TIMESPEC_GET)|g' \
+	      -e 's|@''HAVE_TIMESPEC_GETRES''@|$(HAVE_TIMESPEC_GETRES)|g' \
+	      -e 's|@''HAVE_TIMEZONE_T''@|$(HAVE_TIMEZONE_T)|g' \
+	      -e 's|@''REPLACE_CTIME''@|$(REPLACE_CTIME)|g' \
+	      -e 's|@''REPLACE_GMTIME''@|$(REPLACE_GMTIME)|g' \
+	      -e 's|@''REPLACE_LOCALTIME''@|$(REPLACE_LOCALTIME)|g' \
+	      -e 's|@''REPLACE_LOCALTIME_R''@|$(REPLACE_LOCALTIME_R)|g' \
+	      -e 's|@''REPLACE_MKTIME''@|$(REPLACE_MKTIME)|g' \
+	      -e 's|@''REPLACE_NANOSLEEP''@|$(REPLACE_NANOSLEEP)|g' \
+	      -e 's|@''REPLACE_STRFTIME''@|$(REPLACE_STRFTIME)|g' \
+	      -e 's|@''REPLACE_TIME''@|$(REPLACE_TIME)|g' \
+	      -e 's|@''REPLACE_TIMEGM''@|$(REPLACE_TIMEGM)|g' \
+	      -e 's|@''REPLACE_TIMESPEC_GET''@|$(REPLACE_TIMESPEC_GET)|g' \
+	      -e 's|@''REPLACE_TZSET''@|$(REPLACE_TZSET)|g' \
+	      -e 's|@''PTHREAD_H_DEFINES_STRUCT_TIMESPEC''@|$(PTHREAD_H_DEFINES_STRUCT_TIMESPEC)|g' \
+	      -e 's|@''SYS_TIME_H_DEFINES_STRUCT_TIMESPEC''@|$(SYS_TIME_H_DEFINES_STRUCT_TIMESPEC)|g' \
+	      -e 's|@''TIME_H_DEFINES_STRUCT_TIMESPEC''@|$(TIME_H_DEFINES_STRUCT_TIMESPEC)|g' \
+	      -e 's|@''UNISTD_H_DEFINES_STRUCT_TIMESPEC''@|$(UNISTD_H_DEFINES_STRUCT_TIMESPEC)|g' \
+	      -e 's|@''TIME_H_DEFINES_TIME_UTC''@|$(TIME_H_DEFINES_TIME_UTC)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      $(srcdir)/time.in.h > $@-t
+	$(AM_V_at)mv $@-t $@
+MOSTLYCLEANFILES += time.h time.h-t
+
+EXTRA_DIST += time.in.h
+
+endif
+## end   gnulib module time-h
+
+## begin gnulib module time_r
+ifeq (,$(OMIT_GNULIB_MODULE_time_r))
+
+ifneq (,$(GL_COND_OBJ_TIME_R_CONDITION))
+libgnu_a_SOURCES += time_r.c
+endif
+
+endif
+## end   gnulib module time_r
+
+## begin gnulib module time_rz
+ifeq (,$(OMIT_GNULIB_MODULE_time_rz))
+
+ifneq (,$(GL_COND_OBJ_TIME_RZ_CONDITION))
+libgnu_a_SOURCES += time_rz.c
+endif
+
+EXTRA_DIST += time-internal.h
+
+endif
+## end   gnulib module time_rz
+
+## begin gnulib module timegm
+ifeq (,$(OMIT_GNULIB_MODULE_timegm))
+
+ifneq (,$(GL_COND_OBJ_TIMEGM_CONDITION))
+libgnu_a_SOURCES += timegm.c
+endif
+
+EXTRA_DIST += mktime-internal.h
+
+endif
+## end   gnulib module timegm
+
+## begin gnulib module timespec
+ifeq (,$(OMIT_GNULIB_MODULE_timespec))
+
+libgnu_a_SOURCES += timespec.c
+
+EXTRA_DIST += timespec.h
+
+endif
+## end   gnulib module timespec
+
+## begin gnulib module timespec-add
+ifeq (,$(OMIT_GNULIB_MODULE_timespec-add))
+
+libgnu_a_SOURCES += timespec-add.c
+
+endif
+## end   gnulib module timespec-add
+
+## begin gnulib module timespec-sub
+ifeq (,$(OMIT_GNULIB_MODULE_timespec-sub))
+
+libgnu_a_SOURCES += timespec-sub.c
+
+endif
+## end   gnulib module timespec-sub
+
+## begin gnulib module u64
+ifeq (,$(OMIT_GNULIB_MODULE_u64))
+
+libgnu_a_SOURCES += u64.c
+
+EXTRA_DIST += u64.h
+
+endif
+## end   gnulib module u64
+
+## begin gnulib module unistd
+ifeq (,$(OMIT_GNULIB_MODULE_unistd))
+
+BUILT_SOURCES += unistd.h
+libgnu_a_SOURCES += unistd.c
+
+# We need the following in order to create an empty placeholder for
+# <unistd.h> when the system doesn't have one.
+unistd.h: unistd.in.h $(top_builddir)/config.status $(CXXDEFS_H) $(ARG_NONNULL_H) $(WARN_ON_USE_H)
+	$(gl_V_at)$(SED_HEADER_STDOUT) \
+	      -e 's|@''GUARD_PREFIX''@|GL|g' \
+	      -e 's|@''HAVE_UNISTD_H''@|$(HAVE_UNISTD_H)|g' \
+	      -e 's|@''INCLUDE_NEXT''@|$(INCLUDE_NEXT)|g' \
+	      -e 's|@''PRAGMA_SYSTEM_HEADER''@|#pragma GCC system_header|g' \
+	      -e 's|@''PRAGMA_COLUMNS''@||g' \
+	      -e 's|@''NEXT_UNISTD_H''@|$(NEXT_UNISTD_H)|g' \
+	      -e 's|@''WINDOWS_64_BIT_OFF_T''@|$(WINDOWS_64_BIT_OFF_T)|g' \
+	      -e 's/@''GNULIB_ACCESS''@/$(GL_GNULIB_ACCESS)/g' \
+	      -e 's/@''GNULIB_CHDIR''@/$(GL_GNULIB_CHDIR)/g' \
+	      -e 's/@''GNULIB_CHOWN''@/$(GL_GNULIB_CHOWN)/g' \
+	      -e 's/@''GNULIB_CLOSE''@/$(GL_GNULIB_CLOSE)/g' \
+	      -e 's/@''GNULIB_COPY_FILE_RANGE''@/$(GL_GNULIB_COPY_FILE_RANGE)/g' \
+	      -e 's/@''GNULIB_DUP''@/$(GL_GNULIB_DUP)/g' \
+	      -e 's/@''GNULIB_DUP2''@/$(GL_GNULIB_DUP2)/g' \
+	      -e 's/@''GNULIB_DUP3''@/$(GL_GNULIB_DUP3)/g' \
+	      -e 's/@''GNULIB_ENVIRON''@/$(GL_GNULIB_ENVIRON)/g' \
+	      -e 's/@''GNULIB_EUIDACCESS''@/$(GL_GNULIB_EUIDACCESS)/g' \
+	      -e 's/@''GNULIB_EXECL''@/$(GL_GNULIB_EXECL)/g' \
+	      -e 's/@''GNULIB_EXECLE''@/$(GL_GNULIB_EXECLE)/g' \
+	      -e 's/@''GNULIB_EXECLP''@/$(GL_GNULIB_EXECLP)/g' \
+	      -e 's/@''GNULIB_EXECV''@/$(GL_GNULIB_EXECV)/g' \
+	      -e 's/@''GNULIB_EXECVE''@/$(GL_GNULIB_EXECVE)/g' \
+	      -e 's/@''GNULIB_EXECVP''@/$(GL_GNULIB_EXECVP)/g' \
+	      -e 's/@''GNULIB_EXECVPE''@/$(GL_GNULIB_EXECVPE)/g' \
+	      -e 's/@''GNULIB_FACCESSAT''@/$(GL_GNULIB_FACCESSAT)/g' \
+	      -e 's/@''GNULIB_FCHDIR''@/$(GL_GNULIB_FCHDIR)/g' \
+	      -e 's/@''GNULIB_FCHOWNAT''@/$(GL_GNULIB_FCHOWNAT)/g' \
+	      -e 's/@''GNULIB_FDATASYNC''@/$(GL_GNULIB_FDATASYNC)/g' \
+	      -e 's/@''GNULIB_FSYNC''@/$(GL_GNULIB_FSYNC)/g' \
+	      -e 's/@''GNULIB_FTRUNCATE''@/$(GL_GNULIB_FTRUNCATE)/g' \
+	      < $(srcdir)/unistd.in.h > $@-t1
+	$(AM_V_at)sed \
+	      -e 's/@''GNULIB_GETCWD''@/$(GL_GNULIB_GETCWD)/g' \
+	      -e 's/@''GNULIB_GETDOMAINNAME''@/$(GL_GNULIB_GETDOMAINNAME)/g' \
+	      -e 's/@''GNULIB_GETDTABLESIZE''@/$(GL_GNULIB_GETDTABLESIZE)/g' \
+	      -e 's/@''GNULIB_GETENTROPY''@/$(GL_GNULIB_GETENTROPY)/g' \
+	      -e 's/@''GNULIB_GETGROUPS''@/$(GL_GNULIB_GETGROUPS)/g' \
+	      -e 's/@''GNULIB_GETHOSTNAME''@/$(GL_GNULIB_GETHOSTNAME)/g' \
+	      -e 's/@''GNULIB_GETLOGIN''@/$(GL_GNULIB_GETLOGIN)/g' \
+	      -e 's/@''GNULIB_GETLOGIN_R''@/$(GL_GNULIB_GETLOGIN_R)/g' \
+	      -e 's/@''GNULIB_GETOPT_POSIX''@/$(GL_GNULIB_GETOPT_POSIX)/g' \
+	      -e 's/@''GNULIB_GETPAGESIZE''@/$(GL_GNULIB_GETPAGESIZE)/g' \
+	      -e 's/@''GNULIB_GETPASS''@/$(GL_GNULIB_GETPASS)/g' \
+	      -e 's/@''GNULIB_GETPASS_GNU''@/$(GL_GNULIB_GETPASS_GNU)/g' \
+	      -e 's/@''GNULIB_GETUSERSHELL''@/$(GL_GNULIB_GETUSERSHELL)/g' \
+	      -e 's/@''GNULIB_GROUP_MEMBER''@/$(GL_GNULIB_GROUP_MEMBER)/g' \
+	      -e 's/@''GNULIB_ISATTY''@/$(GL_GNULIB_ISATTY)/g' \
+	      -e 's/@''GNULIB_LCHOWN''@/$(GL_GNULIB_LCHOWN)/g' \
+	      -e 's/@''GNULIB_LINK''@/$(GL_GNULIB_LINK)/g' \
+	      -e 's/@''GNULIB_LINKAT''@/$(GL_GNULIB_LINKAT)/g' \
+	      -e 's/@''GNULIB_LSEEK''@/$(GL_GNULIB_LSEEK)/g' \
+	      -e 's/@''GNULIB_PIPE''@/$(GL_GNULIB_PIPE)/g' \
+	      -e 's/@''GNULIB_PIPE2''@/$(GL_GNULIB_PIPE2)/g' \
+	      -e 's/@''GNULIB_PREAD''@/$(GL_GNULIB_PREAD)/g' \
+	      -e 's/@''GNULIB_PWRITE''@/$(GL_GNULIB_PWRITE)/g' \
+	      -e 's/@''GNULIB_READ''@/$(GL_GNULIB_READ)/g' \
+	      -e 's/@''GNULIB_READLINK''@/$(GL_GNULIB_READLINK)/g' \
+	      -e 's/@''GNULIB_READLINKAT''@/$(GL_GNULIB_READLINKAT)/g' \
+	      -e 's/@''GNULIB_RMDIR''@/$(GL_GNULIB_RMDIR)/g' \
+	      -e 's/@''GNULIB_SETHOSTNAME''@/$(GL_GNULIB_SETHOSTNAME)/g' \
+	      -e 's/@''GNULIB_SLEEP''@/$(GL_GNULIB_SLEEP)/g' \
+	      -e 's/@''GNULIB_SYMLINK''@/$(GL_GNULIB_SYMLINK)/g' \
+	      -e 's/@''GNULIB_SYMLINKAT''@/$(GL_GNULIB_SYMLINKAT)/g' \
+	      -e 's/@''GNULIB_TRUNCATE''@/$(GL_GNULIB_TRUNCATE)/g' \
+	      -e 's/@''GNULIB_TTYNAME_R''@/$(GL_GNULIB_TTYNAME_R)/g' \
+	      -e 's/@''GNULIB_UNISTD_H_GETOPT''@/0$(GL_GNULIB_UNISTD_H_GETOPT)/g' \
+	      -e 's/@''GNULIB_UNISTD_H_NONBLOCKING''@/$(GL_GNULIB_UNISTD_H_NONBLOCKING)/g' \
+	      -e 's/@''GNULIB_UNISTD_H_SIGPIPE''@/$(GL_GNULIB_UNISTD_H_SIGPIPE)/g' \
+	      -e 's/@''GNULIB_UNLINK''@/$(GL_GNULIB_UNLINK)/g' \
+	      -e 's/@''GNULIB_UNLINKAT''@/$(GL_GNULIB_UNLINKAT)/g' \
+	      -e 's/@''GNULIB_USLEEP''@/$(GL_GNULIB_USLEEP)/g' \
+	      -e 's/@''GNULIB_WRITE''@/$(GL_GNULIB_WRITE)/g' \
+	      -e 's/@''GNULIB_MDA_ACCESS''@/$(GL_GNULIB_MDA_ACCESS)/g' \
+	      -e 's/@''GNULIB_MDA_CHDIR''@/$(GL_GNULIB_MDA_CHDIR)/g' \
+	      -e 's/@''GNULIB_MDA_CLOSE''@/$(GL_GNULIB_MDA_CLOSE)/g' \
+	      -e 's/@''GNULIB_MDA_DUP''@/$(GL_GNULIB_MDA_DUP)/g' \
+	      -e 's/@''GNULIB_MDA_DUP2''@/$(GL_GNULIB_MDA_DUP2)/g' \
+	      -e 's/@''GNULIB_MDA_EXECL''@/$(GL_GNULIB_MDA_EXECL)/g' \
+	      -e 's/@''GNULIB_MDA_EXECLE''@/$(GL_GNULIB_MDA_EXECLE)/g' \
+	      -e 's/@''GNULIB_MDA_EXECLP''@/$(GL_GNULIB_MDA_EXECLP)/g' \
+	      -e 's/@''GNULIB_MDA_EXECV''@/$(GL_GNULIB_MDA_EXECV)/g' \
+	      -e 's/@''GNULIB_MDA_EXECVE''@/$(GL_GNULIB_MDA_EXECVE)/g' \
+	      -e 's/@''GNULIB_MDA_EXECVP''@/$(GL_GNULIB_MDA_EXECVP)/g' \
+	      -e 's/@''GNULIB_MDA_EXECVPE''@/$(GL_GNULIB_MDA_EXECVPE)/g' \
+	      -e 's/@''GNULIB_MDA_GETCWD''@/$(GL_GNULIB_MDA_GETCWD)/g' \
+	      -e 's/@''GNULIB_MDA_GETPID''@/$(GL_GNULIB_MDA_GETPID)/g' \
+	      -e 's/@''GNULIB_MDA_ISATTY''@/$(GL_GNULIB_MDA_ISATTY)/g' \
+	      -e 's/@''GNULIB_MDA_LSEEK''@/$(GL_GNULIB_MDA_LSEEK)/g' \
+	      -e 's/@''GNULIB_MDA_READ''@/$(GL_GNULIB_MDA_READ)/g' \
+	      -e 's/@''GNULIB_MDA_RMDIR''@/$(GL_GNULIB_MDA_RMDIR)/g' \
+	      -e 's/@''GNULIB_MDA_SWAB''@/$(GL_GNULIB_MDA_SWAB)/g' \
+	      -e 's/@''GNULIB_MDA_UNLINK''@/$(GL_GNULIB_MDA_UNLINK)/g' \
+	      -e 's/@''GNULIB_MDA_WRITE''@/$(GL_GNULIB_MDA_WRITE)/g' \
+	      < $@-t1 > $@-t2
+	$(AM_V_at)sed \
+	      -e 's|@''HAVE_CHOWN''@|$(HAVE_CHOWN)|g' \
+	      -e 's|@''HAVE_COPY_FILE_RANGE''@|$(HAVE_COPY_FILE_RANGE)|g' \
+	      -e 's|@''HAVE_DUP3''@|$(HAVE_DUP3)|g' \
+	      -e 's|@''HAVE_EUIDACCESS''@|$(HAVE_EUIDACCESS)|g' \
+	      -e 's|@''HAVE_EXECVPE''@|$(HAVE_EXECVPE)|g' \
+	      -e 's|@''HAVE_FACCESSAT''@|$(HAVE_FACCESSAT)|g' \
+	      -e 's|@''HAVE_FCHDIR''@|$(HAVE_FCHDIR)|g' \
+	      -e 's|@''HAVE_FCHOWNAT''@|$(HAVE_FCHOWNAT)|g' \
+	      -e 's|@''HAVE_FDATASYNC''@|$(HAVE_FDATASYNC)|g' \
+	      -e 's|@''HAVE_FSYNC''@|$(HAVE_FSYNC)|g' \
+	      -e 's|@''HAVE_FTRUNCATE''@|$(HAVE_FTRUNCATE)|g' \
+	      -e 's|@''HAVE_GETDTABLESIZE''@|$(HAVE_GETDTABLESIZE)|g' \
+	      -e 's|@''HAVE_GETENTROPY''@|$(HAVE_GETENTROPY)|g' \
+	      -e 's|@''HAVE_GETGROUPS''@|$(HAVE_GETGROUPS)|g' \
+	      -e 's|@''HAVE_GETHOSTNAME''@|$(HAVE_GETHOSTNAME)|g' \
+	      -e 's|@''HAVE_GETPAGESIZE''@|$(HAVE_GETPAGESIZE)|g' \
+	      -e 's|@''HAVE_GETPASS''@|$(HAVE_GETPASS)|g' \
+	      -e 's|@''HAVE_GROUP_MEMBER''@|$(HAVE_GROUP_MEMBER)|g' \
+	      -e 's|@''HAVE_LCHOWN''@|$(HAVE_LCHOWN)|g' \
+	      -e 's|@''HAVE_LINK''@|$(HAVE_LINK)|g' \
+	      -e 's|@''HAVE_LINKAT''@|$(HAVE_LINKAT)|g' \
+	      -e 's|@''HAVE_PIPE''@|$(HAVE_PIPE)|g' \
+	      -e 's|@''HAVE_PIPE2''@|$(HAVE_PIPE2)|g' \
+	      -e 's|@''HAVE_PREAD''@|$(HAVE_PREAD)|g' \
+	      -e 's|@''HAVE_PWRITE''@|$(HAVE_PWRITE)|g' \
+	      -e 's|@''HAVE_READLINK''@|$(HAVE_READLINK)|g' \
+	      -e 's|@''HAVE_READLINKAT''@|$(HAVE_READLINKAT)|g' \
+	      -e 's|@''HAVE_SETHOSTNAME''@|$(HAVE_SETHOSTNAME)|g' \
+	      -e 's|@''HAVE_SLEEP''@|$(HAVE_SLEEP)|g' \
+	      -e 's|@''HAVE_SYMLINK''@|$(HAVE_SYMLINK)|g' \
+	      -e 's|@''HAVE_SYMLINKAT''@|$(HAVE_SYMLINKAT)|g' \
+	      -e 's|@''HAVE_UNLINKAT''@|$(HAVE_UNLINKAT)|g' \
+	      -e 's|@''HAVE_USLEEP''@|$(HAVE_USLEEP)|g' \
+	      -e 's|@''HAVE_DECL_ENVIRON''@|$(HAVE_DECL_ENVIRON)|g' \
+	      -e 's|@''HAVE_DECL_EXECVPE''@|$(HAVE_DECL_EXECVPE)|g' \
+	      -e 's|@''HAVE_DECL_FCHDIR''@|$(HAVE_DECL_FCHDIR)|g' \
+	      -e 's|@''HAVE_DECL_FDATASYNC''@|$(HAVE_DECL_FDATASYNC)|g' \
+	      -e 's|@''HAVE_DECL_GETDOMAINNAME''@|$(HAVE_DECL_GETDOMAINNAME)|g' \
+	      -e 's|@''HAVE_DECL_GETLOGIN''@|$(HAVE_DECL_GETLOGIN)|g' \
+	      -e 's|@''HAVE_DECL_GETLOGIN_R''@|$(HAVE_DECL_GETLOGIN_R)|g' \
+	      -e 's|@''HAVE_DECL_GETPAGESIZE''@|$(HAVE_DECL_GETPAGESIZE)|g' \
+	      -e 's|@''HAVE_DECL_GETUSERSHELL''@|$(HAVE_DECL_GETUSERSHELL)|g' \
+	      -e 's|@''HAVE_DECL_SETHOSTNAME''@|$(HAVE_DECL_SETHOSTNAME)|g' \
+	      -e 's|@''HAVE_DECL_TRUNCATE''@|$(HAVE_DECL_TRUNCATE)|g' \
+	      -e 's|@''HAVE_DECL_TTYNAME_R''@|$(HAVE_DECL_TTYNAME_R)|g' \
+	      -e 's|@''HAVE_OS_H''@|$(HAVE_OS_H)|g' \
+	      -e 's|@''HAVE_SYS_PARAM_H''@|$(HAVE_SYS_PARAM_H)|g' \
+	      < $@-t2 > $@-t3
+	$(AM_V_at)sed \
+	      -e 's|@''REPLACE_ACCESS''@|$(REPLACE_ACCESS)|g' \
+	      -e 's|@''REPLACE_CHOWN''@|$(REPLACE_CHOWN)|g' \
+	      -e 's|@''REPLACE_CLOSE''@|$(REPLACE_CLOSE)|g' \
+	      -e 's|@''REPLACE_COPY_FILE_RANGE''@|$(REPLACE_COPY_FILE_RANGE)|g' \
+	      -e 's|@''REPLACE_DUP''@|$(REPLACE_DUP)|g' \
+	      -e 's|@''REPLACE_DUP2''@|$(REPLACE_DUP2)|g' \
+	      -e 's|@''REPLACE_DUP3''@|$(REPLACE_DUP3)|g' \
+	      -e 's|@''REPLACE_EXECL''@|$(REPLACE_EXECL)|g' \
+	      -e 's|@''REPLACE_EXECLE''@|$(REPLACE_EXECLE)|g' \
+	      -e 's|@''REPLACE_EXECLP''@|$(REPLACE_EXECLP)|g' \
+	      -e 's|@''REPLACE_EXECV''@|$(REPLACE_EXECV)|g' \
+	      -e 's|@''REPLACE_EXECVE''@|$(REPLACE_EXECVE)|g' \
+	      -e 's|@''REPLACE_EXECVP''@|$(REPLACE_EXECVP)|g' \
+	      -e 's|@''REPLACE_EXECVPE''@|$(REPLACE_EXECVPE)|g' \
+	      -e 's|@''REPLACE_FACCESSAT''@|$(REPLACE_FACCESSAT)|g' \
+	      -e 's|@''REPLACE_FCHDIR''@|$(REPLACE_FCHDIR)|g' \
+	      -e 's|@''REPLACE_FCHOWNAT''@|$(REPLACE_FCHOWNAT)|g' \
+	      -e 's|@''REPLACE_FDATASYNC''@|$(REPLACE_FDATASYNC)|g' \
+	      -e 's|@''REPLACE_FTRUNCATE''@|$(REPLACE_FTRUNCATE)|g' \
+	      -e 's|@''REPLACE_GETCWD''@|$(REPLACE_GETCWD)|g' \
+	      -e 's|@''REPLACE_GETDOMAINNAME''@|$(REPLACE_GETDOMAINNAME)|g' \
+	      -e 's|@''REPLACE_GETDTABLESIZE''@|$(REPLACE_GETDTABLESIZE)|g' \
+	      -e 's|@''REPLACE_GETENTROPY''@|$(REPLACE_GETENTROPY)|g' \
+	      -e 's|@''REPLACE_GETLOGIN_R''@|$(REPLACE_GETLOGIN_R)|g' \
+	      -e 's|@''REPLACE_GETGROUPS''@|$(REPLACE_GETGROUPS)|g' \
+	      -e 's|@''REPLACE_GETPAGESIZE''@|$(REPLACE_GETPAGESIZE)|g' \
+	      -e 's|@''REPLACE_GETPASS''@|$(REPLACE_GETPASS)|g' \
+	      -e 's|@''REPLACE_GETPASS_FOR_GETPASS_GNU''@|$(REPLACE_GETPASS_FOR_GETPASS_GNU)|g' \
+	      -e 's|@''REPLACE_ISATTY''@|$(REPLACE_ISATTY)|g' \
+	      -e 's|@''REPLACE_LCHOWN''@|$(REPLACE_LCHOWN)|g' \
+	      -e 's|@''REPLACE_LINK''@|$(REPLACE_LINK)|g' \
+	      -e 's|@''REPLACE_LINKAT''@|$(REPLACE_LINKAT)|g' \
+	      -e 's|@''REPLACE_LSEEK''@|$(REPLACE_LSEEK)|g' \
+	      -e 's|@''REPLACE_PIPE2''@|$(REPLACE_PIPE2)|g' \
+	      -e 's|@''REPLACE_PREAD''@|$(REPLACE_PREAD)|g' \
+	      -e 's|@''REPLACE_PWRITE''@|$(REPLACE_PWRITE)|g' \
+	      -e 's|@''REPLACE_READ''@|$(REPLACE_READ)|g' \
+	      -e 's|@''REPLACE_READLINK''@|$(REPLACE_READLINK)|g' \
+	      -e 's|@''REPLACE_READLINKAT''@|$(REPLACE_READLINKAT)|g' \
+	      -e 's|@''REPLACE_RMDIR''@|$(REPLACE_RMDIR)|g' \
+	      -e 's|@''REPLACE_SETHOSTNAME''@|$(REPLACE_SETHOSTNAME)|g' \
+	      -e 's|@''REPLACE_SLEEP''@|$(REPLACE_SLEEP)|g' \
+	      -e 's|@''REPLACE_SYMLINK''@|$(REPLACE_SYMLINK)|g' \
+	      -e 's|@''REPLACE_SYMLINKAT''@|$(REPLACE_SYMLINKAT)|g' \
+	      -e 's|@''REPLACE_TRUNCATE''@|$(REPLACE_TRUNCATE)|g' \
+	      -e 's|@''REPLACE_TTYNAME_R''@|$(REPLACE_TTYNAME_R)|g' \
+	      -e 's|@''REPLACE_UNLINK''@|$(REPLACE_UNLINK)|g' \
+	      -e 's|@''REPLACE_UNLINKAT''@|$(REPLACE_UNLINKAT)|g' \
+	      -e 's|@''REPLACE_USLEEP''@|$(REPLACE_USLEEP)|g' \
+	      -e 's|@''REPLACE_WRITE''@|$(REPLACE_WRITE)|g' \
+	      -e 's|@''UNISTD_H_HAVE_SYS_RANDOM_H''@|$(UNISTD_H_HAVE_SYS_RANDOM_H)|g' \
+	      -e 's|@''UNISTD_H_HAVE_WINSOCK2_H''@|$(UNISTD_H_HAVE_WINSOCK2_H)|g' \
+	      -e 's|@''UNISTD_H_HAVE_WINSOCK2_H_AND_USE_SOCKETS''@|$(UNISTD_H_HAVE_WINSOCK2_H_AND_USE_SOCKETS)|g' \
+	      -e '/definitions of _GL_FUNCDECL_RPL/r $(CXXDEFS_H)' \
+	      -e '/definition of _GL_ARG_NONNULL/r $(ARG_NONNULL_H)' \
+	      -e '/definition of _GL_WARN_ON_USE/r $(WARN_ON_USE_H)' \
+	      < $@-t3 > $@-t4
+	$(AM_V_at)rm -f $@-t1 $@-t2 $@-t3
+	$(AM_V_at)mv $@-t4 $@
+MOSTLYCLEANFILES += unistd.h unistd.h-t1 unistd.h-t2 unistd.h-t3 unistd.h-t4
+
+EXTRA_DIST += unistd.in.h
+
+endif
+## end   gnulib module unistd
+
+## begin gnulib module unlocked-io-internal
+ifeq (,$(OMIT_GNULIB_MODULE_unlocked-io-internal))
+
+
+EXTRA_DIST += unlocked-io.h
+
+endif
+## end   gnulib module unlocked-io-internal
+
+## begin gnulib module update-copyright
+ifeq (,$(OMIT_GNULIB_MODULE_update-copyright))
+
+
+EXTRA_DIST += $(top_srcdir)/build-aux/update-copyright
+
+endif
+## end   gnulib module update-copyright
+
+## begin gnulib module utimens
+ifeq (,$(OMIT_GNULIB_MODULE_utimens))
+
+ifneq (,$(gl_GNULIB_ENABLED_utimens_CONDITION))
+libgnu_a_SOURCES += utimens.c
+
+endif
+EXTRA_DIST += utimens.h
+
+endif
+## end   gnulib module utimens
+
+## begin gnulib module utimensat
+ifeq (,$(OMIT_GNULIB_MODULE_utimensat))
+
+ifneq (,$(GL_COND_OBJ_UTIMENSAT_CONDITION))
+libgnu_a_SOURCES += utimensat.c
+endif
+
+EXTRA_DIST += at-func.c
+
+EXTRA_libgnu_a_SOURCES += at-func.c
+
+endif
+## end   gnulib module utimensat
+
+## begin gnulib module verify
+ifeq (,$(OMIT_GNULIB_MODULE_verify))
+
+
+EXTRA_DIST += verify.h
+
+endif
+## end   gnulib module verify
+
+## begin gnulib module vla
+ifeq (,$(OMIT_GNULIB_MODULE_vla))
+
+
+EXTRA_DIST += vla.h
+
+endif
+## end   gnulib module vla
+
+## begin gnulib module xalloc
+ifeq (,$(OMIT_GNULIB_MODULE_xalloc))
+
+libgnu_a_SOURCES += xmalloc.c
+
+EXTRA_DIST += xalloc.h
+
+endif
+## end   gnulib module xalloc
+
+## begin gnulib module xalloc-die
+ifeq (,$(OMIT_GNULIB_MODULE_xalloc-die))
+
+libgnu_a_SOURCES += xalloc-die.c
+
+EXTRA_DIST += xalloc.h
+
+endif
+## end   gnulib module xalloc-die
+
+## begin gnulib module xalloc-oversized
+ifeq (,$(OMIT_GNULIB_MODULE_xalloc-oversized))
+
+ifneq (,$(gl_GNULIB_ENABLED_682e609604ccaac6be382e4ee3a4eaec_CONDITION))
+
+endif
+EXTRA_DIST += xalloc-oversized.h
+
+endif
+## end   gnulib module xalloc-oversized
+
+
+mostlyclean-local: mostlyclean-generic
+	@for dir in '' $(MOSTLYCLEANDIRS); do \
+	  if test -n "$$dir" && test -d $$dir; then \
+	    echo "rmdir $$dir"; rmdir $$dir; \
+	  fi; \
+	done; \
+	:
+distclean-local: distclean-gnulib-libobjs
+distclean-gnulib-libobjs:
+	-rm -f  ./$(DEPDIR)/fopen.Po
+maintainer-clean-local: distclean-gnulib-libobjs
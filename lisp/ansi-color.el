@@ -347,10 +347,6 @@ ansi-color-control-seq-regexp
   "\e\\[[\x30-\x3F]*[\x20-\x2F]*[\x40-\x7E]"
   "Regexp matching an ANSI control sequence.")
 
-(defconst ansi-color--control-seq-fragment-regexp
-  "\e\\[[\x30-\x3F]*[\x20-\x2F]*\\|\e"
-  "Regexp matching a partial ANSI control sequence.")
-
 (defconst ansi-color-parameter-regexp "\\([0-9]*\\)[m;]"
   "Regexp that matches SGR control sequence parameters.")
 
@@ -482,28 +478,17 @@ ansi-color-filter-apply
 
 This function can be added to `comint-preoutput-filter-functions'."
   (let ((context (ansi-color--ensure-context 'ansi-color-context nil))
-        (start 0) end result)
+        (start 0) result)
     ;; if context was saved and is a string, prepend it
     (setq string (concat (cadr context) string))
-    (setcar (cdr context) "")
-    ;; find the next escape sequence
-    (while (setq end (string-match ansi-color-control-seq-regexp string start))
-      (push (substring string start end) result)
-      (setq start (match-end 0)))
-    ;; save context, add the remainder of the string to the result
-    (let ((fragment ""))
-      (push (substring string start
-                       (if (string-match
-                            (concat "\\(?:"
-                                    ansi-color--control-seq-fragment-regexp
-                                    "\\)\\'")
-                            string start)
-                           (let ((pos (match-beginning 0)))
-                             (setq fragment (substring string pos))
-                             pos)
-                         nil))
-            result)
-      (setcar (cdr context) fragment))
+    (pcase-let ((`(,_ ,fragment ,sequences)
+                 (ansi-color--scan string 0 (length string) nil nil)))
+      (pcase-dolist (`(,beg ,end . ,_) sequences)
+        (push (substring string start beg) result)
+        (setq start end))
+      ;; save context, add the remainder of the string to the result
+      (push (substring string start fragment) result)
+      (setcar (cdr context) (if fragment (substring string fragment) "")))
     (apply #'concat (nreverse result))))
 
 (defun ansi-color-apply (string)
@@ -522,45 +507,26 @@ ansi-color-apply
 This function can be added to `comint-preoutput-filter-functions'."
   (let* ((context
           (ansi-color--ensure-context 'ansi-color-context nil))
-         (face-vec (car context))
          (start 0)
-         end result)
+         result)
     ;; If context was saved and is a string, prepend it.
     (setq string (concat (cadr context) string))
-    (setcar (cdr context) "")
-    ;; Find the next escape sequence.
-    (while (setq end (string-match ansi-color-control-seq-regexp string start))
-      (let ((esc-end (match-end 0)))
-        ;; Colorize the old block from start to end using old face.
-        (when-let ((face (ansi-color--face-vec-face face-vec)))
-          (put-text-property start end 'font-lock-face
-                             face string))
-        (push (substring string start end) result)
-        (setq start (match-end 0))
-        ;; If this is a color escape sequence,
-        (when (eq (aref string (1- esc-end)) ?m)
-          ;; create a new face from it.
-          (let ((cur-pos end))
-            (ansi-color--update-face-vec
-             face-vec
-             (lambda ()
-               (when (string-match ansi-color-parameter-regexp
-                                   string cur-pos)
-                 (setq cur-pos (match-end 0))
-                 (when (<= cur-pos esc-end)
-                   (string-to-number (match-string 1 string))))))))))
-    ;; if the rest of the string should have a face, put it there
-    (when-let ((face (ansi-color--face-vec-face face-vec)))
-      (put-text-property start (length string)
-                         'font-lock-face face string))
-    ;; save context, add the remainder of the string to the result
-    (if (string-match
-         (concat "\\(?:" ansi-color--control-seq-fragment-regexp "\\)\\'")
-         string start)
-        (let ((pos (match-beginning 0)))
-          (setcar (cdr context) (substring string pos))
-          (push (substring string start pos) result))
-      (push (substring string start) result))
+    (pcase-let ((`(,face ,fragment ,sequences)
+                 (ansi-color--scan string 0 (length string) (car context)
+                                   #'ansi-color--face-vec-face)))
+      (pcase-dolist (`(,beg ,end . ,old-face) sequences)
+        ;; Colorize the old block from start to beg using old face.
+        (when old-face
+          (put-text-property start beg 'font-lock-face old-face string))
+        (push (substring string start beg) result)
+        (setq start end))
+      ;; if the rest of the string should have a face, put it there
+      (when face
+        (put-text-property start (length string)
+                           'font-lock-face face string))
+      ;; save context, add the remainder of the string to the result
+      (push (substring string start fragment) result)
+      (setcar (cdr context) (if fragment (substring string fragment) "")))
     (apply 'concat (nreverse result))))
 
 (defun ansi-color--ensure-context (context-sym position)
@@ -686,19 +652,16 @@ ansi-color-filter-region
          (context (ansi-color--ensure-context
                    'ansi-color-context-region begin))
          (start (cadr context)))
-    (save-excursion
-      (goto-char start)
+    (pcase-let ((`(,_ ,fragment ,sequences)
+                 (ansi-color--scan nil start end-marker nil nil))
+                (deleted 0))
       ;; Delete escape sequences.
-      (while (re-search-forward ansi-color-control-seq-regexp end-marker t)
-        (delete-region (match-beginning 0) (match-end 0)))
-      ;; save context, add the remainder of the string to the result
-      (set-marker start (point))
-      (while (re-search-forward ansi-color--control-seq-fragment-regexp
-                                end-marker t))
-      (if (and (/= (point) start)
-               (= (point) end-marker))
-	  (set-marker start (match-beginning 0))
-        (set-marker start nil)))))
+      (pcase-dolist (`(,beg ,end . ,_) sequences)
+        (delete-region (- beg deleted) (- end deleted))
+        (setq deleted (+ deleted (- end beg))))
+      ;; save context
+      (set-marker start (and fragment (- fragment deleted))))
+    (set-marker end-marker nil)))
 
 (defun ansi-color-apply-on-region (begin end &optional preserve-sequences)
   "Translates SGR control sequences into overlays or extents.
@@ -725,45 +688,34 @@ ansi-color-apply-on-region
          (face-vec (car context))
          (start-marker (cadr context))
          (end-marker (copy-marker end)))
-    (save-excursion
-      (goto-char start-marker)
-      ;; Find the next escape sequence.
-      (while (re-search-forward ansi-color-control-seq-regexp end-marker t)
-        ;; Extract escape sequence.
-        (let ((esc-beg (match-beginning 0))
-              (esc-end (point)))
+    ;; Find all the escape sequences at once.  The positions they are
+    ;; at shift by the length of those deleted before them.
+    (pcase-let ((`(,faces ,fragment ,sequences)
+                 (ansi-color--scan nil start-marker end-marker face-vec
+                                   #'ansi-color--face-vec-face))
+                (deleted 0))
+      (save-excursion
+        (pcase-dolist (`(,esc-beg ,esc-end . ,face) sequences)
+          (setq esc-beg (- esc-beg deleted)
+                esc-end (- esc-end deleted))
           ;; Colorize the old block from start to end using old face.
           (funcall ansi-color-apply-face-function
                    (prog1 (marker-position start-marker)
                      ;; Store new start position.
                      (set-marker start-marker esc-end))
-                   esc-beg (ansi-color--face-vec-face face-vec))
-          ;; If this is a color sequence,
-          (when (eq (char-before esc-end) ?m)
-            (goto-char esc-beg)
-            (ansi-color--update-face-vec
-             face-vec (lambda ()
-                        (when (re-search-forward ansi-color-parameter-regexp
-                                                 esc-end t)
-                          (string-to-number (match-string 1))))))
-
+                   esc-beg face)
           (if preserve-sequences
               ;; Make the escape sequence transparent.
               (overlay-put (make-overlay esc-beg esc-end) 'invisible t)
             ;; Otherwise, strip.
-            (delete-region esc-beg esc-end))))
-      ;; search for the possible start of a new escape sequence
-      (while (re-search-forward ansi-color--control-seq-fragment-regexp
-                                end-marker t))
-      (if (and (/= (point) start-marker)
-               (= (point) end-marker))
-          (progn
-            (goto-char (match-beginning 0))
-            (funcall ansi-color-apply-face-function
-                     start-marker (point)
-                     (ansi-color--face-vec-face face-vec))
-            (set-marker start-marker (point)))
-        (let ((faces (ansi-color--face-vec-face face-vec)))
+            (delete-region esc-beg esc-end)
+            (setq deleted (+ deleted (- esc-end esc-beg)))))
+        (if fragment
+            ;; Leave the start of a new escape sequence for next time.
+            (let ((pos (- fragment deleted)))
+              (funcall ansi-color-apply-face-function
+                       start-marker pos faces)
+              (set-marker start-marker pos))
           (funcall ansi-color-apply-face-function
                    start-marker end-marker faces)
           ;; Save a restart position when there are codes active. It's
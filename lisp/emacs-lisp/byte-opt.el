@@ -1766,6 +1766,7 @@ byte-optimize-set
          object-intervals rassoc rassq reverse secure-hash
          string-as-multibyte string-as-unibyte string-bytes
          string-collate-equalp string-collate-lessp string-distance
+         string-distance-nearest
          string-equal string-lessp string-make-multibyte string-make-unibyte
          string-search string-to-multibyte string-to-unibyte
          string-version-lessp
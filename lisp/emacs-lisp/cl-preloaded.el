@@ -75,6 +75,7 @@ cl--typeof-types
     (bool-vector array sequence atom)
     (frame atom) (hash-table atom) (terminal atom)
     (thread atom) (mutex atom) (condvar atom)
+    (channel atom) (thread-pool atom) (future atom)
     (font-spec atom) (font-entity atom) (font-object atom)
     (vector array sequence atom)
     (user-ptr atom)
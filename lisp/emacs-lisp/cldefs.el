@@ -0,0 +1,27 @@
+;; Automatically generated from cldefs.el.in.  DO NOT EDIT.
+(defconst cldefs-cl-lib-functions
+(quote (cl--parsing-keywords cl--check-key cl--check-test-nokey
+  cl--check-test cl--check-match cl-endp cl-reduce cl-fill cl-replace
+  cl-remove cl-remove-if cl-remove-if-not cl-delete cl-delete-if
+  cl-delete-if-not cl-remove-duplicates cl-delete-duplicates
+  cl--delete-duplicates cl-substitute cl-substitute-if
+  cl-substitute-if-not cl-nsubstitute cl-nsubstitute-if
+  cl-nsubstitute-if-not cl-find cl-find-if cl-find-if-not cl-position
+  cl--position cl-position-if cl-position-if-not cl-count cl-count-if
+  cl-count-if-not cl-mismatch cl-search cl-sort cl-stable-sort
+  cl-merge cl-member cl-member-if cl-member-if-not cl--adjoin cl-assoc
+  cl-assoc-if cl-assoc-if-not cl-rassoc cl-rassoc-if cl-rassoc-if-not
+  cl-union cl-nunion cl-intersection cl-nintersection
+  cl-set-difference cl-nset-difference cl-set-exclusive-or
+  cl-nset-exclusive-or cl-subsetp cl-subst-if cl-subst-if-not
+  cl-nsubst cl-nsubst-if cl-nsubst-if-not cl-sublis cl--sublis-rec
+  cl-nsublis cl--nsublis-rec cl-tree-equal cl--tree-equal-rec)
+))
+(provide (quote cldefs))
+;; Local Variables:
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; coding: utf-8-emacs-unix
+;; End:
+;;; cldefs.el ends here
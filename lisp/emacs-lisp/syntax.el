@@ -491,20 +491,19 @@ syntax-ppss
              ;; syntax-ppss--data.
              (parse-partial-sexp pt-last pos nil nil ppss-last))
             (t
-             (cl-loop with ppss = ppss-best
-                      with step = syntax-ppss-max-span
-                      with new-cache = cache
-                      for i = 0 then (1+ i)
-                      for beg = (min pos (+ pt-best (* i step)))
-                      for end = (min pos (+ pt-best (* (1+ i) step)))
-                      while (/= end pos)
-                      do (setq ppss (parse-partial-sexp beg end nil nil ppss))
-                      do (syntax-ppss--cache-insert new-cache (cons end ppss))
-                      finally return
-                      (let ((result
-                             (parse-partial-sexp beg pos nil nil ppss)))
-                        (prog1 result
-                          (syntax-ppss--set-data pos result new-cache)))))))))
+             (let* ((step syntax-ppss-max-span)
+                    (ends (number-sequence (+ pt-best step) (1- pos) step))
+                    (states (parse-partial-sexp-states
+                             (cons pt-best (append ends (list pos)))
+                             ppss-best))
+                    (new-cache cache))
+               (cl-loop for end in ends
+                        for ppss in states
+                        do (syntax-ppss--cache-insert new-cache
+                                                      (cons end ppss)))
+               (let ((result (car (last states))))
+                 (prog1 result
+                   (syntax-ppss--set-data pos result new-cache)))))))))
 
 (provide 'syntax)
 
@@ -0,0 +1,199 @@
+;;; esh-groups.el --- automatically extracted autoloads (do not edit)   -*- lexical-binding: t -*-
+;; Generated by the `loaddefs-generate' function.
+
+;; This file is NOT part of GNU Emacs.
+
+;;; Code:
+
+
+
+;;; Generated autoloads from em-alias.el
+
+(defgroup eshell-alias nil "\
+Command aliases allow for easy definition of alternate commands." :tag "Command aliases" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-banner.el
+
+(defgroup eshell-banner nil "\
+This sample module displays a welcome banner at login.
+It exists so that others wishing to create their own Eshell extension
+modules may have a simple template to begin with." :tag "Login banner" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-basic.el
+
+(defgroup eshell-basic nil "\
+The \"basic\" code provides a set of convenience functions which
+are traditionally considered shell builtins.  Since all of the
+functionality provided by them is accessible through Lisp, they are
+not really builtins at all, but offer a command-oriented way to do the
+same thing." :tag "Basic shell commands" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-cmpl.el
+
+(defgroup eshell-cmpl nil "\
+This module provides a programmable completion function bound to
+the TAB key, which allows for completing command names, file names,
+variable names, arguments, etc." :tag "Argument completion" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-dirs.el
+
+(defgroup eshell-dirs nil "\
+Directory navigation involves changing directories, examining the
+current directory, maintaining a directory stack, and also keeping
+track of a history of the last directory locations the user was in.
+Emacs does provide standard Lisp definitions of `pwd' and `cd', but
+they lack somewhat in feel from the typical shell equivalents." :tag "Directory navigation" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-elecslash.el
+
+(defgroup eshell-elecslash nil "\
+Electric forward slash in remote Eshells.
+
+This module helps with supplying absolute file name arguments to
+remote commands.  After enabling it, typing a forward slash as
+the first character of a command line argument will automatically
+insert the Tramp prefix, /method:host:.  The automatic insertion
+applies only when `default-directory' is remote and the command
+is a Lisp function.
+
+The result is that in most cases of supplying absolute file name
+arguments to commands you should see the Tramp prefix inserted
+automatically only when that's what you'd reasonably expect.
+This frees you from having to keep track of whether commands are
+Lisp functions or external when typing command line arguments." :tag "Electric forward slash" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-glob.el
+
+(defgroup eshell-glob nil "\
+This module provides extended globbing syntax, similar what is used
+by zsh for filename generation." :tag "Extended filename globbing" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-hist.el
+
+(defgroup eshell-hist nil "\
+This module provides command history management." :tag "History list management" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-ls.el
+
+(defgroup eshell-ls nil "\
+This module implements the \"ls\" utility fully in Lisp.
+If it is passed any unrecognized command switches, it will revert
+to the operating system's version.  This version of \"ls\" uses
+text properties to colorize its output based on the setting of
+`eshell-ls-use-colors'." :tag "Implementation of `ls' in Lisp" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-pred.el
+
+(defgroup eshell-pred nil "\
+This module allows for predicates to be applied to globbing
+patterns (similar to zsh), in addition to string modifiers which can
+be applied either to globbing results, variable references, or just
+ordinary strings." :tag "Value modifiers and predicates" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-prompt.el
+
+(defgroup eshell-prompt nil "\
+This module provides command prompts, and navigation between them,
+as is common with most shells." :tag "Command prompts" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-rebind.el
+
+(defgroup eshell-rebind nil "\
+This module allows for special keybindings that only take effect
+while the point is in a region of input text.  The default
+keybindings mimic the bindings used in other shells when the user
+is editing new input text.
+
+For example, it binds C-u to kill the current input text and C-w
+to `backward-kill-word'.  If the history module is enabled, it
+also binds C-p and C-n to move through the input history, etc.
+
+If `eshell-confine-point-to-input' is non-nil, this module prevents
+certain commands from causing the point to leave the input area, such
+as `backward-word', `previous-line', etc." :tag "Rebind keys at input" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-script.el
+
+(defgroup eshell-script nil "\
+This module allows for the execution of files containing Eshell
+commands, as a script file." :tag "Running script files." :group 'eshell-module)
+
+
+;;; Generated autoloads from em-smart.el
+
+(defgroup eshell-smart nil "\
+This module combines the facility of normal, modern shells with
+some of the edit/review concepts inherent in the design of Plan 9's
+9term.  See the docs for more details.
+
+Most likely you will have to turn this option on and play around with
+it to get a real sense of how it works." :tag "Smart display of output" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-term.el
+
+(defgroup eshell-term nil "\
+This module causes visual commands (e.g., `vi') to be executed by
+the `term' package, which comes with Emacs.  This package handles most
+of the ANSI control codes, allowing curses-based applications to run
+within an Emacs window.  The variable `eshell-visual-commands' defines
+which commands are considered visual in nature." :tag "Running visual commands" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-tramp.el
+
+(defgroup eshell-tramp nil "\
+This module defines commands that use Tramp in a way that is
+  not transparent to the user.  So far, this includes only the
+  built-in su, sudo and doas commands, which are not compatible
+  with the full, external su, sudo, and doas commands, and
+  require the user to understand how to use the Tramp sudo
+  method." :tag "Tramp Eshell features" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-unix.el
+
+(defgroup eshell-unix nil "\
+This module defines many of the more common UNIX utilities as
+aliases implemented in Lisp.  These include mv, ln, cp, rm, etc.  If
+the user passes arguments which are too complex, or are unrecognized
+by the Lisp variant, the external version will be called (if
+available).  The only reason not to use them would be because they are
+usually much slower.  But in several cases their tight integration
+with Eshell makes them more versatile than their traditional cousins
+(such as being able to use `kill' to kill Eshell background processes
+by name)." :tag "UNIX commands in Lisp" :group 'eshell-module)
+
+
+;;; Generated autoloads from em-xtra.el
+
+(defgroup eshell-xtra nil "\
+This module defines some extra alias functions which are entirely
+optional.  They can be viewed as samples for how to write Eshell alias
+functions, or as aliases which make some of Emacs's behavior more
+naturally accessible within Emacs." :tag "Extra alias functions" :group 'eshell-module)
+
+;;; End of scraped data
+
+(provide 'esh-groups)
+
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; no-native-compile: t
+;; coding: utf-8-emacs-unix
+;; End:
+
+;;; esh-groups.el ends here
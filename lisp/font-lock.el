@@ -1358,6 +1358,33 @@ font-lock-fontify-anchored-keywords
     ;; Evaluate POST-MATCH-FORM.
     (eval (nth 2 keywords) t)))
 
+(defun font-lock--keyword-matches (keywords start end)
+  "Find the matches of the regexps of KEYWORDS between START and END.
+Return a list with an element for each of KEYWORDS: the match data of
+the matches of its regexp, or t if its matches have to be searched for
+while it is applied.  The matches of the keywords with a regexp that
+does not refer to point, and no anchored highlights, are all found in
+one pass over the text."
+  (let* ((regexps (mapcar (lambda (keyword)
+                            (and (stringp (car keyword))
+                                 (not (string-search "\\=" (car keyword)))
+                                 (not (memq nil (mapcar
+                                                 (lambda (highlight)
+                                                   (numberp (car highlight)))
+                                                 (cdr keyword))))
+                                 (car keyword)))
+                          keywords))
+         (matches (make-vector (length regexps) nil)))
+    (when (delq nil (copy-sequence regexps))
+      (pcase-dolist (`(,i . ,data)
+                     (search-regexps-in-region regexps start end))
+        (push data (aref matches i))))
+    (let ((i -1))
+      (mapcar (lambda (regexp)
+                (setq i (1+ i))
+                (if regexp (nreverse (aref matches i)) t))
+              regexps))))
+
 (defun font-lock-fontify-keywords-region (start end &optional loudly)
   "Fontify according to `font-lock-keywords' between START and END.
 START should be at the beginning of a line.
@@ -1365,11 +1392,15 @@ font-lock-fontify-keywords-region
   (unless (eq (car font-lock-keywords) t)
     (setq font-lock-keywords
 	  (font-lock-compile-keywords font-lock-keywords)))
-  (let ((case-fold-search font-lock-keywords-case-fold-search)
-	(keywords (cddr font-lock-keywords))
-	(bufname (buffer-name)) (count 0)
-        (pos (make-marker))
-	keyword matcher highlights)
+  (let* ((case-fold-search font-lock-keywords-case-fold-search)
+	 (keywords (cddr font-lock-keywords))
+	 (bufname (buffer-name)) (count 0)
+         (pos (make-marker))
+         ;; The matches of many keywords are found at once beforehand,
+         ;; and used as long as the text stays the same.
+         (matches (font-lock--keyword-matches keywords start end))
+         (tick (buffer-chars-modified-tick))
+	 keyword matcher highlights found)
     ;;
     ;; Fontify each item in `font-lock-keywords' from `start' to `end'.
     (while keywords
@@ -1377,12 +1408,22 @@ font-lock-fontify-keywords-region
 			  (make-string (cl-incf count) ?.)))
       ;;
       ;; Find an occurrence of `matcher' from `start' to `end'.
-      (setq keyword (car keywords) matcher (car keyword))
+      (setq keyword (car keywords) matcher (car keyword)
+            found (pop matches))
       (goto-char start)
       (while (and (< (point) end)
-		  (if (stringp matcher)
-		      (re-search-forward matcher end t)
-		    (funcall matcher end))
+		  (cond
+                   ((and (listp found)
+                         (= tick (buffer-chars-modified-tick)))
+                    (while (and found (< (car (car found)) (point)))
+                      (setq found (cdr found)))
+                    (when found
+                      (set-match-data (car found))
+                      (setq found (cdr found))
+                      (goto-char (match-end 0))))
+                   ((stringp matcher)
+		    (re-search-forward matcher end t))
+                   (t (funcall matcher end)))
                   ;; Beware empty string matches since they will
                   ;; loop indefinitely.
                   (or (> (point) (match-beginning 0))
@@ -4338,6 +4338,31 @@ gnus-nov-parse-line
       (funcall gnus-alter-header-function header))
     (gnus-dependencies-add-header header dependencies force-new)))
 
+(defsubst gnus-nov-add-header (header dependencies &optional force-new)
+  "Finish HEADER from `nnheader--parse-nov-region' and enter it.
+Decode its subject and From as `nnheader-parse-nov' does, make up a
+Message-ID if it has none, and add it to DEPENDENCIES.  Return HEADER
+if it was entered, nil otherwise."
+  (let (x)
+    (setf (mail-header-subject header)
+	  (condition-case ()
+	      (gnus-remove-odd-characters
+	       (funcall gnus-decode-encoded-word-function
+			(setq x (mail-header-subject header))))
+	    (error x)))
+    (setf (mail-header-from header)
+	  (condition-case ()
+	      (gnus-remove-odd-characters
+	       (funcall gnus-decode-encoded-address-function
+			(setq x (mail-header-from header))))
+	    (error x))))
+  (unless (mail-header-id header)
+    (setf (mail-header-id header)
+	  (nnheader-generate-fake-message-id (mail-header-number header))))
+  (when gnus-alter-header-function
+    (funcall gnus-alter-header-function header))
+  (gnus-dependencies-add-header header dependencies force-new))
+
 (defun gnus-build-get-header (id)
   "Look through the buffer of NOV lines and find the header to ID.
 Enter this line into the dependencies hash table, and return
@@ -6214,7 +6239,6 @@ gnus-get-newsgroup-headers-xover
   (add-hook 'gnus-article-internal-prepare-hook 'gnus-article-get-xrefs nil t)
   (let ((mail-parse-charset gnus-newsgroup-charset)
 	(mail-parse-ignored-charsets gnus-newsgroup-ignored-charsets)
-	(cur nntp-server-buffer)
 	(dependencies (or dependencies gnus-newsgroup-dependencies))
 	(allp (cond
 	       ((eq gnus-read-all-available-headers t)
@@ -6224,30 +6248,25 @@ gnus-get-newsgroup-headers-xover
 		(string-match gnus-read-all-available-headers group))
 	       (t
 		nil)))
-	number headers header)
+	parsed headers)
     (with-current-buffer nntp-server-buffer
       (subst-char-in-region (point-min) (point-max) ?\r ?  t)
       ;; Allow the user to mangle the headers before parsing them.
       (gnus-run-hooks 'gnus-parse-headers-hook)
       (goto-char (point-min))
-      (gnus-parse-without-error
-	(while (and (or sequence allp)
-		    (not (eobp)))
-	  (setq number (read cur))
-	  (when (not allp)
-	    (while (and sequence
-			(< (car sequence) number))
-	      (setq sequence (cdr sequence))))
-	  (when (and (or allp
-			 (and sequence
-			      (eq number (car sequence))))
-		     (progn
-		       (setq sequence (cdr sequence))
-		       (setq header (inline
-				      (gnus-nov-parse-line
-				       number dependencies force-new)))))
-	    (push header headers))
-	  (forward-line 1)))
+      (when (or sequence allp)
+	(setq parsed (nnheader--parse-nov-region (point-min) (point-max)
+						 (if allp t sequence))
+	      sequence (if allp
+			   (nthcdr (length (car parsed)) sequence)
+			 (cdr parsed)))
+	(dolist (header (car parsed))
+	  (condition-case ()
+	      (when (gnus-nov-add-header header dependencies force-new)
+		(push header headers))
+	    (error
+	     (gnus-error 4 "Invalid data for article %d"
+			 (mail-header-number header))))))
       ;; A common bug in inn is that if you have posted an article and
       ;; then retrieves the active file, it will answer correctly --
       ;; the new article is included.  However, a NOV entry for the
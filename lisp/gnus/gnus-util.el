@@ -545,7 +545,11 @@ gnus-parent-id
 	  (while (nthcdr n ids)
 	    (setq ids (cdr ids)))
 	  (car ids))
-      (let ((references (mail-header-remove-comments references)))
+      ;; Removing comments is costly and rarely needed: it only
+      ;; changes references with parentheses or folded lines in them.
+      (let ((references (if (string-match-p "[(\n[:nonascii:]]" references)
+			    (mail-header-remove-comments references)
+			  references)))
 	(when (string-match "\\(<[^<]+>\\)[ \t]*\\'" references)
 	  (match-string 1 references))))))
 
@@ -190,7 +190,8 @@ nnimap-keepalive-timer
 
 (cl-defstruct nnimap
   group process commands capabilities select-result newlinep server
-  last-command-time greeting examined stream-type initial-resync)
+  last-command-time greeting examined stream-type initial-resync
+  scan-marker last-tag)
 
 (defvar-local nnimap-object nil)
 
@@ -2005,8 +2006,26 @@ nnimap-command
 				    (car response) " "))))))
 
 (defun nnimap-get-response (sequence)
-  (nnimap-wait-for-response sequence)
-  (nnimap-parse-response))
+  (let (lines donep)
+    ;; Collect the untagged lines of the response as they arrive,
+    ;; rather than looking for them again afterwards.
+    (nnimap-wait-for-response
+     sequence nil
+     (lambda (beg end)
+       (let ((char (char-after beg)))
+	 (cond
+	  ((eql char ?*)
+	   (push (buffer-substring beg end) lines))
+	  ;; Continuation requests.
+	  ((not (and char (<= ?0 char ?9))))
+	  ((eql (nnimap-last-tag nnimap-object) sequence)
+	   (push (buffer-substring beg end) lines)
+	   (setq donep t))
+	  ;; The response to an earlier command.
+	  (t
+	   (setq lines nil))))))
+    (nnimap-parse-response
+     (and donep (apply #'concat (nreverse lines))))))
 
 (defun nnimap-wait-for-connection (&optional regexp)
   (nnimap-wait-for-line (or regexp "^[*.] .*\n") "[*.] \\([A-Z0-9]+\\)"))
@@ -2023,22 +2042,18 @@ nnimap-wait-for-line
     (and (looking-at (or response-regexp regexp))
 	 (match-string 1))))
 
-(defun nnimap-wait-for-response (sequence &optional messagep)
+(defun nnimap-wait-for-response (sequence &optional messagep callback)
+  "Wait until the server has completed the command SEQUENCE.
+Leave point at the start of its tagged response.  If CALLBACK is
+non-nil, call it with the start and end of each response line, as
+they arrive.  Return non-nil unless the connection was closed."
   (let (openp
         (process (get-buffer-process (current-buffer))))
     (condition-case nil
         (progn
-	  (goto-char (point-max))
 	  (while (and (setq openp (memq (process-status process)
 					'(open run)))
-		      (progn
-			;; Skip past any "*" lines that the server has
-			;; output.
-			(while (and (not (bobp))
-				    (progn
-				      (forward-line -1)
-				      (looking-at "\\*\\|[0-9]+ OK NOOP"))))
-			(not (looking-at (format "%d .*\n" sequence)))))
+		      (not (nnimap-scan-responses sequence callback)))
 	    (when messagep
 	      (nnheader-message-maybe
 	       7 "nnimap read %dk from %s%s" (/ (buffer-size) 1000)
@@ -2050,8 +2065,7 @@ nnimap-wait-for-response
 			 (if (= (nnimap-initial-resync nnimap-object) 1)
 			     ""
 			   "s")))))
-	    (nnheader-accept-process-output process)
-	    (goto-char (point-max)))
+	    (nnheader-accept-process-output process))
 	  (setf (nnimap-initial-resync nnimap-object) 0)
           openp)
       (quit
@@ -2062,8 +2076,47 @@ nnimap-wait-for-response
        ;; NAT routers).
        (prog1 nil (delete-process process))))))
 
-(defun nnimap-parse-response ()
-  (let ((lines (split-string (nnimap-last-response-string) "\r\n" t))
+(defun nnimap-scan-responses (sequence &optional callback)
+  "Scan the response lines that arrived since the last scan.
+Call CALLBACK with the start and end of each complete line.  Stop at
+the tagged response to SEQUENCE and return non-nil, with point at its
+start, once the server has completed that command."
+  ;; Resume after the last complete line scanned.  The marker follows
+  ;; the text when the buffer is changed or erased in between.
+  (let ((marker (nnimap-scan-marker nnimap-object))
+	found end)
+    (unless (and marker (eq (marker-buffer marker) (current-buffer)))
+      (setq marker (setf (nnimap-scan-marker nnimap-object)
+			 (point-min-marker))))
+    (goto-char marker)
+    (unless (bolp)
+      (forward-line 1))
+    (while (and (not found)
+		(setq end (nnimap--response-end (point))))
+      (when (looking-at "\\([0-9]+\\) ")
+	(setf (nnimap-last-tag nnimap-object)
+	      (string-to-number (match-string 1)))
+	(when (eql (nnimap-last-tag nnimap-object) sequence)
+	  (setq found (point))))
+      (when callback
+	(funcall callback (point) end))
+      (goto-char end))
+    (set-marker marker (point))
+    (cond
+     (found
+      (goto-char found))
+     ;; Tags increase, and responses arrive in the order of the
+     ;; commands, so this command completed before an earlier scan.
+     ((and (nnimap-last-tag nnimap-object)
+	   (>= (nnimap-last-tag nnimap-object) sequence))
+      (goto-char marker)
+      (or (re-search-backward (format "^%d .*\n" sequence) nil t)
+	  (goto-char (point-max)))))))
+
+(defun nnimap-parse-response (&optional string)
+  "Parse the response STRING, or the last response before point."
+  (let ((lines (split-string (or string (nnimap-last-response-string))
+			     "\r\n" t))
 	result)
     (dolist (line lines)
       (push (cdr (nnimap-parse-line line)) result))
@@ -1606,18 +1606,48 @@ compilation--note-type
     (1 (cl-incf compilation-num-warnings-found))
     (2 (cl-incf compilation-num-errors-found))))
 
+(defun compilation--rule-regexp (item omake-included)
+  "Return the regexp of the error rule ITEM.
+OMAKE-INCLUDED non-nil means also allow the indentation of omake."
+  (let ((pat (car item)))
+    ;; omake reports some error indented, so skip the indentation.
+    ;; another solution is to modify (some?) regexps in
+    ;; `compilation-error-regexp-alist'.
+    ;; note that omake usage is not limited to ocaml and C (for stubs).
+    ;; FIXME-omake: Doing it here seems wrong, at least it should depend on
+    ;; whether or not omake's own error messages are recognized.
+    (cond
+     ((or (not omake-included) (not pat))
+      pat)
+     ((string-match "\\`\\([^^]\\|\\^\\( \\*\\|\\[\\)\\)" pat)
+      pat) ;; Not anchored or anchored but already allows empty spaces.
+     (t (concat "^\\(?:      \\)?" (substring pat 1))))))
+
 (defun compilation-parse-errors (start end &rest rules)
   "Parse errors between START and END.
 The errors recognized are the ones specified in RULES which default
 to `compilation-error-regexp-alist' if RULES is nil."
-  (let ((case-fold-search compilation-error-case-fold-search)
-        (omake-included (memq 'omake compilation-error-regexp-alist)))
-    (dolist (rule-item (or rules compilation-error-regexp-alist))
-      (let* ((item
-              (if (symbolp rule-item)
-                  (cdr (assq rule-item compilation-error-regexp-alist-alist))
-                rule-item))
-             (pat (car item))
+  (let* ((case-fold-search compilation-error-case-fold-search)
+         (omake-included (memq 'omake compilation-error-regexp-alist))
+         (rule-items (or rules compilation-error-regexp-alist))
+         (items (mapcar (lambda (rule-item)
+                          (if (symbolp rule-item)
+                              (cdr (assq rule-item
+                                         compilation-error-regexp-alist-alist))
+                            rule-item))
+                        rule-items))
+         (pats (mapcar (lambda (item)
+                         (compilation--rule-regexp item omake-included))
+                       items))
+         (matches (make-vector (length items) nil))
+         (index 0))
+    ;; Find the matches of all the rules in a single pass over the
+    ;; region, and then handle them rule by rule, so that the text
+    ;; properties of later rules still override those of earlier ones.
+    (pcase-dolist (`(,i . ,data) (search-regexps-in-region pats start end))
+      (push data (aref matches i)))
+    (dolist (rule-item rule-items)
+      (let* ((item (pop items))
              (file (nth 1 item))
              (line (nth 2 item))
              (col (nth 3 item))
@@ -1626,19 +1656,6 @@ compilation-parse-errors
              end-line end-col fmt
              props)
 
-        ;; omake reports some error indented, so skip the indentation.
-        ;; another solution is to modify (some?) regexps in
-        ;; `compilation-error-regexp-alist'.
-        ;; note that omake usage is not limited to ocaml and C (for stubs).
-        ;; FIXME-omake: Doing it here seems wrong, at least it should depend on
-        ;; whether or not omake's own error messages are recognized.
-        (cond
-         ((or (not omake-included) (not pat))
-          nil)
-         ((string-match "\\`\\([^^]\\|\\^\\( \\*\\|\\[\\)\\)" pat)
-          nil) ;; Not anchored or anchored but already allows empty spaces.
-         (t (setq pat (concat "^\\(?:      \\)?" (substring pat 1)))))
-
         (if (and (consp file) (not (functionp file)))
             (setq fmt (cdr file)
                   file (car file)))
@@ -1652,8 +1669,9 @@ compilation-parse-errors
         (unless (or (null (nth 5 item)) (integerp (nth 5 item)))
           (error "HYPERLINK should be an integer: %s" (nth 5 item)))
 
-        (goto-char start)
-        (while (and pat (re-search-forward pat end t))
+        (dolist (data (nreverse (aref matches index)))
+          (set-match-data data)
+          (goto-char (match-end 0))
           (when (setq props (compilation-error-properties
                              file line end-line col end-col
                              (or type 2) fmt rule))
@@ -1713,7 +1731,8 @@ compilation-parse-errors
                (cddr props))
               (font-lock-append-text-property
                (match-beginning mn) (match-end mn)
-               'font-lock-face (cadr props)))))))))
+               'font-lock-face (cadr props))))))
+      (setq index (1+ index)))))
 
 (defvar-local compilation--parsed -1)
 
@@ -2985,7 +2985,9 @@ term-control-seq-regexp
    "AnSiT[^\n]+\n\\|"
    ;; or an escape sequence (section 5.4 "Control Sequences"),
    "\\[\\([\x30-\x3F]*\\)[\x20-\x2F]*[\x40-\x7E]\\)\\)")
-  "Regexp matching control sequences handled by term.el.")
+  "Regexp matching control sequences handled by term.el.
+`term-emulate-terminal' finds them with `term--next-control', which
+matches them case-sensitively.")
 
 (defconst term-control-seq-prefix-regexp
   "[\032\e]")
@@ -2993,7 +2995,7 @@ term-control-seq-prefix-regexp
 (defun term-emulate-terminal (proc str)
   (when (buffer-live-p (process-buffer proc))
     (with-current-buffer (process-buffer proc)
-      (let* ((i 0) funny
+      (let* ((i 0) funny control
 	     decoded-substring
 	     save-point save-marker win
 	     (inhibit-read-only t)
@@ -3034,10 +3036,12 @@ term-emulate-terminal
               (setq term-terminal-undecoded-bytes nil))
 
             (while (< i str-length)
-              (setq funny (string-match term-control-seq-regexp str i))
-              (let ((ctl-params (and funny (match-string 1 str)))
-                    (ctl-params-end (and funny (match-end 1)))
-                    (ctl-end (if funny (match-end 0)
+              ;; This finds what `term-control-seq-regexp' matches,
+              ;; and parses the parameters of escape sequences.
+              (setq control (term--next-control str i)
+                    funny (car control))
+              (let ((ctl-params (cddr control))
+                    (ctl-end (if funny (cadr control)
                                (setq funny (string-match term-control-seq-prefix-regexp str i))
                                (if funny
                                    (setq term-terminal-undecoded-bytes
@@ -3058,6 +3062,32 @@ term-emulate-terminal
                         (decode-coding-string
                          (substring str i funny)
                          locale-coding-system t))
+                  (put-text-property 0 (length decoded-substring)
+                                     'font-lock-face term-current-face
+                                     decoded-substring)
+                  ;; Take in the text after any changes of graphic
+                  ;; rendition that follow, so that text drawn in
+                  ;; several colors is inserted at once.
+                  (let (next text)
+                    (while (and (< ctl-end str-length)
+                                (eq (aref str funny) ?\e)
+                                (eq (aref str (1+ funny)) ?\[)
+                                (eq (aref str (1- ctl-end)) ?m)
+                                ctl-params
+                                (setq next (term--next-control str ctl-end))
+                                (> (car next) ctl-end))
+                      (term-handle-ansi-escape proc ctl-params ?m)
+                      (setq text (decode-coding-string
+                                  (substring str ctl-end (car next))
+                                  locale-coding-system t))
+                      (put-text-property 0 (length text)
+                                         'font-lock-face term-current-face
+                                         text)
+                      (setq decoded-substring (concat decoded-substring text)
+                            control next
+                            funny (car control)
+                            ctl-params (cddr control)
+                            ctl-end (cadr control))))
                   ;; Check for multibyte characters that ends
                   ;; before end of string, and save it for
                   ;; next time.
@@ -3081,7 +3111,6 @@ term-emulate-terminal
                   ;; we moved, then delete that many columns
                   ;; following point if not eob nor insert-mode.
                   (let ((old-column (term-horizontal-column))
-                        (old-point (point))
                         columns)
                     (unless term-suppress-hard-newline
                       (while (> (+ (length decoded-substring) old-column)
@@ -3116,10 +3145,7 @@ term-emulate-terminal
                         (when (> (current-column) term-width)
                           (delete-region (- (point) (- (current-column) term-width))
                                          (point)))
-                        (goto-char pos)))
-
-                    (put-text-property old-point (point)
-                                       'font-lock-face term-current-face))
+                        (goto-char pos))))
                   ;; If the last char was written in last column,
                   ;; back up one column, but remember we did so.
                   ;; Thus we emulate xterm/vt100-style line-wrapping.
@@ -3161,17 +3187,14 @@ term-emulate-terminal
                    (pcase (aref str (1+ i))
                      (?\[
                       ;; We only handle control sequences with a single
-                      ;; "Final" byte (see [ECMA-48] section 5.4).
-                      (when (eq ctl-params-end (1- ctl-end))
+                      ;; "Final" byte (see [ECMA-48] section 5.4), the
+                      ;; ones with parameters.  We don't distinguish
+                      ;; empty params from 0 (according to [ECMA-48]
+                      ;; we should, but all commands we support
+                      ;; default to 0 values anyway).
+                      (when ctl-params
                         (term-handle-ansi-escape
-                         proc
-                         (mapcar ;; We don't distinguish empty params
-                          ;; from 0 (according to [ECMA-48] we
-                          ;; should, but all commands we support
-                          ;; default to 0 values anyway).
-                          #'string-to-number
-                          (split-string ctl-params ";"))
-                         (aref str (1- ctl-end)))))
+                         proc ctl-params (aref str (1- ctl-end)))))
                      (?D ;; Scroll forward (apparently not documented in
                       ;; [ECMA-48], [ctlseqs] mentions it as C1
                       ;; character "Index" though).
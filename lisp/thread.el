@@ -36,6 +36,9 @@
 (declare-function current-thread "thread.c")
 (declare-function thread-live-p "thread.c")
 (declare-function all-threads "thread.c")
+(declare-function make-thread-pool "thread.c")
+(declare-function thread-pool-submit "thread.c")
+(declare-function future-await "thread.c")
 
 ;;;###autoload
 (defun thread-handle-event (event)
@@ -50,6 +53,31 @@ thread-handle-event
             (err (cddr event)))
         (message "Error %s: %S" thread err))))
 
+;;; Parallel mapping
+
+(defvar thread--pmapcar-pool nil
+  "Thread pool shared by calls to `pmapcar', made on first use.")
+
+;;;###autoload
+(defun pmapcar (function sequence)
+  "Apply FUNCTION to each element of SEQUENCE, and make a list of the results.
+Like `mapcar', except that the calls run in parallel on a shared
+pool of uncooperative threads (see `make-thread-pool').  FUNCTION
+must be safe to call from such a thread: it may read buffers but not
+change them, and should not depend on the order of the calls.  If
+FUNCTION signals an error, `pmapcar' signals it again after the
+calls before it have finished.  Where Emacs was built without
+multithreading, this is just `mapcar'."
+  (if (not (fboundp 'make-thread-pool))
+      (mapcar function sequence)
+    (unless thread--pmapcar-pool
+      (setq thread--pmapcar-pool (make-thread-pool nil "pmapcar")))
+    (mapcar #'future-await
+            (mapcar (lambda (elt)
+                      (thread-pool-submit thread--pmapcar-pool
+                                          (lambda () (funcall function elt))))
+                    sequence))))
+
 ;;; The thread list buffer and list-threads command
 
 (defcustom thread-list-refresh-seconds 0.5
@@ -42,8 +42,11 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
    actual data.
 
    Storage for actual data is doled from `struct sblock`s in units of
-   `struct sdata`.  Strings larger than LARGE_STRING_THRESH, get their
-   own sblock.
+   `struct sdata`.  Strings up to SMALL_STRING_THRESH share small
+   sblocks, those up to LARGE_STRING_THRESH share medium sblocks, and
+   larger ones get their own sblock.  Packing medium strings rather
+   than malloc'ing each spares the malloc heap the holes they would
+   leave, and lets the GC compact them as it does small strings.
 
    A back-pointer from sdata points to its parent Lisp_String.  The
    Lisp_String, sadly, does not point to its sdata, but rather its
@@ -60,21 +63,25 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include "syssignal.h"
 
 #ifdef HAVE_GCC_TLS
-# define mem_root (current_thread->m_mem_root)
 # define interval_blocks (current_thread->m_interval_blocks)
 # define interval_block_index (current_thread->m_interval_block_index)
 # define interval_free_list (current_thread->m_interval_free_list)
 # define oldest_sblock (current_thread->m_oldest_sblock)
 # define current_sblock (current_thread->m_current_sblock)
+# define oldest_medium_sblock (current_thread->m_oldest_medium_sblock)
+# define current_medium_sblock (current_thread->m_current_medium_sblock)
+# define spare_sblocks (current_thread->m_spare_sblocks)
 # define large_sblocks (current_thread->m_large_sblocks)
 # define string_blocks (current_thread->m_string_blocks)
 # define string_free_list (current_thread->m_string_free_list)
 # define float_blocks (current_thread->m_float_blocks)
 # define float_block_index (current_thread->m_float_block_index)
 # define float_free_list (current_thread->m_float_free_list)
+# define float_unswept (current_thread->m_float_unswept)
 # define cons_blocks (current_thread->m_cons_blocks)
 # define cons_block_index (current_thread->m_cons_block_index)
 # define cons_free_list (current_thread->m_cons_free_list)
+# define cons_unswept (current_thread->m_cons_unswept)
 # define vector_blocks (current_thread->m_vector_blocks)
 # define vector_free_lists (current_thread->m_vector_free_lists)
 # define most_recent_free_slot (current_thread->m_most_recent_free_slot)
@@ -82,22 +89,27 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 # define symbol_blocks (current_thread->m_symbol_blocks)
 # define symbol_block_index (current_thread->m_symbol_block_index)
 # define symbol_free_list (current_thread->m_symbol_free_list)
+# define symbol_unswept (current_thread->m_symbol_unswept)
 #else
-# define mem_root (main_thread->m_mem_root)
 # define interval_blocks (main_thread->m_interval_blocks)
 # define interval_block_index (main_thread->m_interval_block_index)
 # define interval_free_list (main_thread->m_interval_free_list)
 # define oldest_sblock (main_thread->m_oldest_sblock)
 # define current_sblock (main_thread->m_current_sblock)
+# define oldest_medium_sblock (main_thread->m_oldest_medium_sblock)
+# define current_medium_sblock (main_thread->m_current_medium_sblock)
+# define spare_sblocks (main_thread->m_spare_sblocks)
 # define large_sblocks (main_thread->m_large_sblocks)
 # define string_blocks (main_thread->m_string_blocks)
 # define string_free_list (main_thread->m_string_free_list)
 # define float_blocks (main_thread->m_float_blocks)
 # define float_block_index (main_thread->m_float_block_index)
 # define float_free_list (main_thread->m_float_free_list)
+# define float_unswept (main_thread->m_float_unswept)
 # define cons_blocks (main_thread->m_cons_blocks)
 # define cons_block_index (main_thread->m_cons_block_index)
 # define cons_free_list (main_thread->m_cons_free_list)
+# define cons_unswept (main_thread->m_cons_unswept)
 # define vector_blocks (main_thread->m_vector_blocks)
 # define vector_free_lists (main_thread->m_vector_free_lists)
 # define most_recent_free_slot (main_thread->m_most_recent_free_slot)
@@ -105,6 +117,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 # define symbol_blocks (main_thread->m_symbol_blocks)
 # define symbol_block_index (main_thread->m_symbol_block_index)
 # define symbol_free_list (main_thread->m_symbol_free_list)
+# define symbol_unswept (main_thread->m_symbol_unswept)
 #endif
 
 struct Lisp_String *(*static_string_allocator) (void);
@@ -136,6 +149,51 @@ INTERVAL (*static_interval_allocator) (void);
   size_t total_hash_table_bytes;
 } gcstat;
 
+/* Object categories of a collection's census, as in `gc-counts'.  */
+enum gc_census
+{
+  GC_CENSUS_CONSES,
+  GC_CENSUS_SYMBOLS,
+  GC_CENSUS_STRINGS,
+  GC_CENSUS_STRING_BYTES,
+  GC_CENSUS_VECTOR_SLOTS,
+  GC_CENSUS_FLOATS,
+  GC_CENSUS_INTERVALS,
+  GC_CENSUS_N,
+};
+
+/* Record of one collection for `gc-events'.  */
+struct gc_event
+{
+  EMACS_INT number;
+  bool explicit;
+  struct timespec start, elapsed, mark, sweep, finalize;
+
+  /* Bytes live after, and freed by, the collection.  */
+  EMACS_INT live[GC_CENSUS_N], freed[GC_CENSUS_N];
+
+  /* Bytes of string data moved, and sblocks released, by
+     sweep_sdata().  */
+  EMACS_INT sdata_moved, sblocks_freed;
+
+  /* Bytes held by sblocks after sweep_sdata(), and the part of them
+     taken up by live string data.  */
+  EMACS_INT sblock_bytes, sdata_live;
+};
+
+enum { GC_EVENTS_MAX = 64 };
+
+/* Ring of the last GC_EVENTS_MAX collections, and the number of
+   collections ever recorded.  */
+static struct gc_event gc_events[GC_EVENTS_MAX];
+static EMACS_INT gc_events_count;
+
+/* The collection in progress.  */
+static struct gc_event gc_event;
+
+/* Whether Lisp asked for the next collection.  */
+static bool gc_explicit;
+
 /* Total size of ancillary arrays of all allocated hash-table objects,
    both dead and alive.  This number is always kept up-to-date.  */
 static ptrdiff_t hash_table_allocated_bytes = 0;
@@ -160,6 +218,10 @@ #define MALLOC_PROBE(size)			\
 static void mark_buffer (struct buffer *);
 
 static void sweep_sdata (struct thread_state *);
+static void sweep_conses_some (struct thread_state *);
+static void sweep_floats_some (struct thread_state *);
+static void sweep_symbols_some (struct thread_state *);
+static void finish_sweep (struct thread_state *);
 extern Lisp_Object which_symbols (Lisp_Object, EMACS_INT) EXTERNALLY_VISIBLE;
 
 static bool vectorlike_marked_p (const union vectorlike_header *);
@@ -517,7 +579,7 @@ lisp_malloc (size_t nbytes, bool q_clear, enum mem_type mtype)
   if (!val)
     memory_full (nbytes);
   else if (mtype != MEM_TYPE_NON_LISP)
-    mem_insert (val, (char *) val + nbytes, mtype, &mem_root);
+    mem_insert (val, (char *) val + nbytes, mtype, current_thread);
   MALLOC_PROBE (nbytes);
   return val;
 }
@@ -530,8 +592,8 @@ lisp_free (struct thread_state *thr, void *block)
 {
   if (block && !pdumper_object_p (block))
     {
+      mem_delete (mem_find (block));
       free (block);
-      mem_delete (mem_find (thr, block), &THREAD_FIELD (thr, m_mem_root));
     }
 }
 
@@ -681,7 +743,7 @@ lisp_align_malloc (struct thread_state *thr, size_t nbytes, enum mem_type type)
 
   /* Register with block lookup */
   if (type != MEM_TYPE_NON_LISP)
-    mem_insert (val, (char *) val + nbytes, type, &THREAD_FIELD (thr, m_mem_root));
+    mem_insert (val, (char *) val + nbytes, type, thr);
 
   MALLOC_PROBE (nbytes);
   eassert (0 == (uintptr_t) val % BLOCK_ALIGN);
@@ -692,7 +754,7 @@ lisp_align_malloc (struct thread_state *thr, size_t nbytes, enum mem_type type)
 lisp_align_free (struct thread_state *thr, void *block)
 {
   /* Deregister from block lookup.  */
-  mem_delete (mem_find (thr, block), &THREAD_FIELD (thr, m_mem_root));
+  mem_delete (mem_find (block));
 
   /* Put on free list.  */
   struct ablock *ablock = block;
@@ -710,28 +772,24 @@ lisp_align_free (struct thread_state *thr, void *block)
       const int nblocks = ABLOCKS_NBLOCKS - (ABASE_SENTINEL (abase) ? 0 : 1);
       struct ablock *const abase_end = &abase->blocks[nblocks];
 
-#ifdef HAVE_GCC_TLS
-      for (struct thread_state *thr = all_threads;
-	   thr != NULL;
-	   thr = thr->next_thread)
-#endif
+      /* Traverse m_free_ablocks, collapsing ABASE's blocks.  These
+	 all sit on THR's list, since blocks change hands only
+	 wholesale in reap_thread_allocations.  Other threads' lists
+	 are not ours to walk while they allocate.  */
+      struct ablock **pptr = &THREAD_FIELD (thr, m_free_ablocks);
+      while (*pptr)
 	{
-	  /* Traverse m_free_ablocks, collapsing ABASE's blocks. */
-	  struct ablock **pptr = &THREAD_FIELD (thr, m_free_ablocks);
-	  while (*pptr)
-	    {
 #if GC_ASAN_POISON_OBJECTS
-	      /* shouldn't this be in collapsed clause? */
-	      __asan_unpoison_memory_region (&(*pptr)->x, sizeof ((*pptr)->x));
+	  /* shouldn't this be in collapsed clause? */
+	  __asan_unpoison_memory_region (&(*pptr)->x, sizeof ((*pptr)->x));
 #endif
-	      if ((struct ablock *) abase <= *pptr && *pptr < abase_end)
-		{
-		  ++ncollapsed;
-		  *pptr = (*pptr)->x.next;
-		}
-	      else
-		pptr = &(*pptr)->x.next;
+	  if ((struct ablock *) abase <= *pptr && *pptr < abase_end)
+	    {
+	      ++ncollapsed;
+	      *pptr = (*pptr)->x.next;
 	    }
+	  else
+	    pptr = &(*pptr)->x.next;
 	}
       eassert (ncollapsed == nblocks);
 #ifdef USE_POSIX_MEMALIGN
@@ -975,6 +1033,8 @@ check_all_sblocks (struct thread_state *thr)
     }
   for (struct sblock *b = THREAD_FIELD (thr, m_oldest_sblock); b != NULL; b = b->next)
     check_sblock (b);
+  for (struct sblock *b = THREAD_FIELD (thr, m_oldest_medium_sblock); b != NULL; b = b->next)
+    check_sblock (b);
 }
 
 /* Walk the free list looking for bogus next pointers.
@@ -1041,8 +1101,51 @@ allocate_string (void)
   return s;
 }
 
-/* Populate S with the next free sdata in CURRENT_SBLOCK.
-   Large strings get their own sblock in LARGE_SBLOCKS.
+/* Return a fresh sblock of BLOCK_NBYTES, preferring a spare for the
+   medium class.  */
+
+static struct sblock *
+allocate_sblock (ptrdiff_t block_nbytes)
+{
+  struct sblock *b;
+  if (block_nbytes == MEDIUM_SBLOCK_NBYTES && spare_sblocks)
+    {
+      b = spare_sblocks;
+      spare_sblocks = b->next;
+    }
+  else
+    b = lisp_malloc (block_nbytes, false, MEM_TYPE_NON_LISP);
+  b->next = NULL;
+  b->data_slot = b->data;
+  ASAN_POISON_SBLOCK_DATA (b, block_nbytes - FLEXSIZEOF (struct sblock, data, 0));
+  return b;
+}
+
+/* Return the sblock of the chain OLDEST...CURRENT with room for
+   SDATA_NBYTES, appending one of BLOCK_NBYTES if the current is
+   full.  */
+
+static struct sblock *
+sblock_with_room (struct sblock **oldest, struct sblock **current,
+		  ptrdiff_t block_nbytes, ptrdiff_t sdata_nbytes)
+{
+  struct sblock *b = *current;
+  if (b == NULL
+      || ((block_nbytes - GC_STRING_OVERRUN_COOKIE_SIZE) <
+	  ((char *) b->data_slot - (char *) b + sdata_nbytes)))
+    {
+      b = allocate_sblock (block_nbytes);
+      if (*current)
+	(*current)->next = b;
+      else
+	*oldest = b;
+      *current = b;
+    }
+  return b;
+}
+
+/* Populate S with the next free sdata in the sblocks of its size
+   class.  Large strings get their own sblock in LARGE_SBLOCKS.
 */
 
 static void
@@ -1055,7 +1158,7 @@ allocate_sdata (struct Lisp_String *s,
     error ("Requested %ld bytes exceeds %ld", nbytes, STRING_BYTES_MAX);
 
   ptrdiff_t sdata_nbytes = sdata_size (nbytes);
-  struct sblock *b = current_sblock;
+  struct sblock *b;
   if (nbytes > LARGE_STRING_THRESH || immovable)
     {
       const size_t size = FLEXSIZEOF (struct sblock, data, sdata_nbytes);
@@ -1065,21 +1168,12 @@ allocate_sdata (struct Lisp_String *s,
       b->data_slot = b->data;
       ASAN_POISON_SBLOCK_DATA (b, size);
     }
-  else if (b == NULL
-	   || ((SBLOCK_NBYTES - GC_STRING_OVERRUN_COOKIE_SIZE) <
-	       ((char *) b->data_slot - (char *) b + sdata_nbytes)))
-    {
-      /* Not enough room in the current sblock.  */
-      b = lisp_malloc (SBLOCK_NBYTES, false, MEM_TYPE_NON_LISP);
-      b->next = NULL;
-      b->data_slot = b->data;
-      if (current_sblock)
-	current_sblock->next = b;
-      else
-	oldest_sblock = b;
-      current_sblock = b;
-      ASAN_POISON_SBLOCK_DATA (b, SBLOCK_SIZE);
-    }
+  else if (nbytes > SMALL_STRING_THRESH)
+    b = sblock_with_room (&oldest_medium_sblock, &current_medium_sblock,
+			  MEDIUM_SBLOCK_NBYTES, sdata_nbytes);
+  else
+    b = sblock_with_room (&oldest_sblock, &current_sblock,
+			  SBLOCK_NBYTES, sdata_nbytes);
 
   ASAN_PREPARE_LIVE_SDATA (data, nbytes);
   b->data_slot->string = s;
@@ -1241,47 +1335,117 @@ sweep_strings (struct thread_state *thr)
 #endif
 }
 
+enum
+{
+  /* Emptied medium sblocks no longer needed are kept at most this
+     many, with their pages returned to the OS.  */
+  SPARE_SBLOCKS_MAX = 8,
+
+  /* Seconds over which the peak demand for medium sblocks is
+     remembered.  */
+  SPARE_SBLOCKS_DECAY = 10,
+};
+
+/* Dispose of emptied sblock B of BLOCK_NBYTES.  Medium sblocks are
+   kept as spares for allocate_sblock().  */
+
 static void
-sweep_sdata (struct thread_state *thr)
+release_sblock (struct thread_state *thr, struct sblock *b,
+		ptrdiff_t block_nbytes)
 {
-  /* Simple sweep of large sblocks.  Side effect: reverses list.  */
-  struct sblock *swept_large_sblocks = NULL;
-  for (struct sblock *next, *b = THREAD_FIELD (thr, m_large_sblocks);
-       b != NULL; b = next)
+  ++gc_event.sblocks_freed;
+  if (block_nbytes == MEDIUM_SBLOCK_NBYTES)
     {
-      next = b->next;
+      b->next = THREAD_FIELD (thr, m_spare_sblocks);
+      THREAD_FIELD (thr, m_spare_sblocks) = b;
+    }
+  else
+    lisp_free (thr, b);
+}
 
-      if (b->data[0].string == NULL)
-	lisp_free (thr, b);
-      else
+static ptrdiff_t
+sblocks_length (struct sblock *b)
+{
+  ptrdiff_t n = 0;
+  for (; b != NULL; b = b->next)
+    ++n;
+  return n;
+}
+
+/* Trim the spare medium sblocks to what the peak demand of the last
+   SPARE_SBLOCKS_DECAY seconds, NUSED at this collection, could want
+   atop the NLIVE now in use.  Pages of the excess go back to the OS,
+   even for those past the SPARE_SBLOCKS_MAX we keep, since free()
+   would not necessarily do so.  Bursts of string churn thus reuse
+   their sblocks without faulting them back in, while a daemon's RSS
+   recedes once the burst is over.  */
+
+static void
+trim_spare_sblocks (struct thread_state *thr, ptrdiff_t nused,
+		    ptrdiff_t nlive)
+{
+  if (nused >= THREAD_FIELD (thr, m_medium_sblocks_peak)
+      || (timespec_cmp (timespec_sub (gc_event.start,
+				      THREAD_FIELD (thr, m_medium_sblocks_peak_time)),
+			make_timespec (SPARE_SBLOCKS_DECAY, 0))
+	  > 0))
+    {
+      THREAD_FIELD (thr, m_medium_sblocks_peak) = nused;
+      THREAD_FIELD (thr, m_medium_sblocks_peak_time) = gc_event.start;
+    }
+
+  ptrdiff_t nwanted = THREAD_FIELD (thr, m_medium_sblocks_peak) - nlive;
+  struct sblock **tail = &THREAD_FIELD (thr, m_spare_sblocks);
+  for (; *tail != NULL && nwanted > 0; tail = &(*tail)->next)
+    --nwanted;
+
+  int nkept = 0;
+  for (struct sblock *next, *b = *tail; b != NULL; b = next)
+    {
+      next = b->next;
+#ifdef MADV_DONTNEED
+      uintptr_t page = getpagesize ();
+      uintptr_t from = ROUNDUP ((uintptr_t) b->data, page);
+      uintptr_t to = ((uintptr_t) b + MEDIUM_SBLOCK_NBYTES) & ~(page - 1);
+      if (from < to)
+	madvise ((void *) from, to - from, MADV_DONTNEED);
+#endif
+      if (nkept < SPARE_SBLOCKS_MAX)
 	{
-	  b->next = swept_large_sblocks;
-	  swept_large_sblocks = b;
+	  *tail = b;
+	  tail = &b->next;
+	  ++nkept;
 	}
+      else
+	lisp_free (thr, b);
     }
-  THREAD_FIELD (thr, m_large_sblocks) = swept_large_sblocks;
+  *tail = NULL;
+}
 
-  /* Less simple compaction of non-large sblocks.
+/* Slide the live sdata of the sblocks OLDEST...CURRENT, each of
+   BLOCK_NBYTES, toward OLDEST, and release the sblocks so emptied.
+   Return the new current sblock.
 
-     TB is the "to block", or the prevailing memmove destination sblock.
-     B is the "from block", or the current memmove source sblock.
+   TB is the "to block", or the prevailing memmove destination sblock.
+   B is the "from block", or the current memmove source sblock.
 
-     The TO sdata tortoise lags with TB.
-     The FROM sdata hare iterates over current B.
+   The TO sdata tortoise lags with TB.
+   The FROM sdata hare iterates over current B.
+*/
 
-     We memmove FROM to TO for all B in the sblock list
-     (oldest_sblock...current_sblock), and therein lies the
-     compaction.
-  */
-  struct sblock *tb = THREAD_FIELD (thr, m_oldest_sblock);
+static struct sblock *
+compact_sblocks (struct thread_state *thr, struct sblock *oldest,
+		 ptrdiff_t block_nbytes)
+{
+  struct sblock *tb = oldest;
   if (tb)
     {
-      sdata *end_tb = (sdata *) ((char *) tb + SBLOCK_NBYTES);
+      sdata *end_tb = (sdata *) ((char *) tb + block_nbytes);
       sdata *to = tb->data;
 
       for (struct sblock *b = tb; b != NULL; b = b->next)
 	{
-	  eassert ((char *) b->data_slot <= (char *) b + SBLOCK_NBYTES);
+	  eassert ((char *) b->data_slot <= (char *) b + block_nbytes);
 	  for (sdata *next_from, *end_from = b->data_slot, *from = b->data;
 	       from < end_from;
 	       from = next_from)
@@ -1290,7 +1454,7 @@ sweep_sdata (struct thread_state *thr)
 	      const ptrdiff_t nbytes = from->nbytes;
 	      const ptrdiff_t step = sdata_size (nbytes) + GC_STRING_OVERRUN_COOKIE_SIZE;
 	      eassert (!s || !XSTRING_MARKED_P (s));
-	      eassert (nbytes <= LARGE_STRING_THRESH);
+	      eassert (nbytes <= (block_nbytes >> 3));
 
 	      /* Check that the string size recorded in the string is the
 		 same as the one recorded in the sdata structure.  */
@@ -1310,8 +1474,9 @@ sweep_sdata (struct thread_state *thr)
 		    {
 		      /* TB is full, proceed with the next sblock.  */
 		      tb->data_slot = to;
+		      gc_event.sblock_bytes += block_nbytes;
 		      tb = tb->next;
-		      end_tb = (sdata *) ((char *) tb + SBLOCK_NBYTES);
+		      end_tb = (sdata *) ((char *) tb + block_nbytes);
 		      to = tb->data;
 		      next_to = (sdata *) ((char *) to + step);
 		    }
@@ -1322,25 +1487,65 @@ sweep_sdata (struct thread_state *thr)
 		      ASAN_PREPARE_LIVE_SDATA (to, nbytes);
 		      memmove (to, from, step);
 		      to->string->u.s.data = to->data;
+		      gc_event.sdata_moved += step;
 		    }
 
+		  gc_event.sdata_live += step;
 		  to = next_to;
 		}
 	    }
 	}
 
-      /* Any sblocks following TB can be free'd.  */
+      /* Any sblocks following TB can be released.  */
       for (struct sblock *b = tb->next; b != NULL; )
 	{
 	  struct sblock *next = b->next;
-	  lisp_free (thr, b);
+	  release_sblock (thr, b, block_nbytes);
 	  b = next;
 	}
 
       tb->data_slot = to;
       tb->next = NULL;
+      gc_event.sblock_bytes += block_nbytes;
     }
-  THREAD_FIELD (thr, m_current_sblock) = tb;
+  return tb;
+}
+
+static void
+sweep_sdata (struct thread_state *thr)
+{
+  ptrdiff_t nused = sblocks_length (THREAD_FIELD (thr, m_oldest_medium_sblock));
+
+  /* Simple sweep of large sblocks.  Side effect: reverses list.  */
+  struct sblock *swept_large_sblocks = NULL;
+  for (struct sblock *next, *b = THREAD_FIELD (thr, m_large_sblocks);
+       b != NULL; b = next)
+    {
+      next = b->next;
+
+      if (b->data[0].string == NULL)
+	release_sblock (thr, b, 0);
+      else
+	{
+	  ptrdiff_t step = (sdata_size (b->data[0].nbytes)
+			    + GC_STRING_OVERRUN_COOKIE_SIZE);
+	  gc_event.sblock_bytes += FLEXSIZEOF (struct sblock, data, step);
+	  gc_event.sdata_live += step;
+	  b->next = swept_large_sblocks;
+	  swept_large_sblocks = b;
+	}
+    }
+  THREAD_FIELD (thr, m_large_sblocks) = swept_large_sblocks;
+
+  /* Less simple compaction of the small and medium classes.  */
+  THREAD_FIELD (thr, m_current_sblock)
+    = compact_sblocks (thr, THREAD_FIELD (thr, m_oldest_sblock),
+		       SBLOCK_NBYTES);
+  THREAD_FIELD (thr, m_current_medium_sblock)
+    = compact_sblocks (thr, THREAD_FIELD (thr, m_oldest_medium_sblock),
+		       MEDIUM_SBLOCK_NBYTES);
+  trim_spare_sblocks (thr, nused,
+		     sblocks_length (THREAD_FIELD (thr, m_oldest_medium_sblock)));
 }
 
 static Lisp_Object new_lisp_string (EMACS_INT, EMACS_INT, bool);
@@ -1644,6 +1849,8 @@ #define XFLOAT_UNMARK(fptr) \
 make_float (double float_value)
 {
   Lisp_Object val;
+  if (!float_free_list && float_unswept)
+    sweep_floats_some (current_thread);
   if (float_free_list)
     {
       XSETFLOAT (val, float_free_list);
@@ -1730,6 +1937,8 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 {
   register Lisp_Object val;
 
+  if (!cons_free_list && cons_unswept)
+    sweep_conses_some (current_thread);
   if (cons_free_list)
     {
       ASAN_UNPOISON_CONS (cons_free_list);
@@ -1996,7 +2205,7 @@ allocate_vector_block (void)
 {
   struct vector_block *newblk = xmalloc (sizeof *newblk);
   mem_insert (newblk->data, newblk->data + VBLOCK_NBYTES,
-	      MEM_TYPE_VBLOCK, &mem_root);
+	      MEM_TYPE_VBLOCK, current_thread);
   newblk->next = vector_blocks;
   vector_blocks = newblk;
   return newblk;
@@ -2104,6 +2313,12 @@ free_by_pvtype (struct Lisp_Vector *vector)
     case PVEC_CONDVAR:
       finalize_one_condvar (PSEUDOVEC_STRUCT (vector, Lisp_CondVar));
       break;
+    case PVEC_CHANNEL:
+      finalize_one_channel (PSEUDOVEC_STRUCT (vector, Lisp_Channel));
+      break;
+    case PVEC_THREAD_POOL:
+      finalize_one_thread_pool (PSEUDOVEC_STRUCT (vector, Lisp_Thread_Pool));
+      break;
     case PVEC_MARKER:
       /* sweep_buffer() ought to have unchained it.  */
       eassert (!PSEUDOVEC_STRUCT (vector, Lisp_Marker)->buffer);
@@ -2176,6 +2391,8 @@ free_by_pvtype (struct Lisp_Vector *vector)
 	  ts_tree_delete(lisp_parser->tree);
 	if (lisp_parser->prev_tree != NULL)
 	  ts_tree_delete(lisp_parser->prev_tree);
+	if (lisp_parser->node_tree != NULL)
+	  ts_tree_delete (lisp_parser->node_tree);
 	if (lisp_parser->indents_query != NULL)
 	  ts_query_delete (lisp_parser->indents_query);
 	if (lisp_parser->parser != NULL)
@@ -2262,9 +2479,9 @@ sweep_vectors (struct thread_state *thr)
 	  /* If RUN_VECTOR never wavered from its initial
 	     assignment, then nothing in the block was marked.
 	     Harvest it back to OS.  */
-	  struct mem_node *node = mem_find (thr, block->data);
-	  eassert (node != mem_nil);
-	  mem_delete (node, &THREAD_FIELD (thr, m_mem_root));
+	  struct mem_node *node = mem_find (block->data);
+	  eassert (node && node->thread == thr);
+	  mem_delete (node);
 	  *bprev = block->next;
 	  xfree (block);
 	}
@@ -2575,6 +2792,15 @@ DEFUN ("make-closure", Fmake_closure, Smake_closure, 1, MANY, 0,
   struct symbol_block *next;
 };
 
+/* The page map of mem_node.c requires registered blocks be no
+   smaller than a granule.  */
+verify (sizeof (struct string_block) >= 1 << MEM_GRANULE_BITS);
+verify (sizeof (struct float_block) >= 1 << MEM_GRANULE_BITS);
+verify (sizeof (struct cons_block) >= 1 << MEM_GRANULE_BITS);
+verify (sizeof (struct symbol_block) >= 1 << MEM_GRANULE_BITS);
+verify (VBLOCK_NBYTES >= 1 << MEM_GRANULE_BITS);
+verify (LARGE_VECTOR_THRESH >= 1 << MEM_GRANULE_BITS);
+
 #if GC_ASAN_POISON_OBJECTS
 # define ASAN_POISON_SYMBOL_BLOCK(s) \
   __asan_poison_memory_region ((s)->symbols, sizeof ((s)->symbols))
@@ -2627,6 +2853,8 @@ DEFUN ("make-symbol", Fmake_symbol, Smake_symbol, 1, 1, 0,
 
   CHECK_STRING (name);
 
+  if (!symbol_free_list && symbol_unswept)
+    sweep_symbols_some (current_thread);
   if (symbol_free_list)
     {
       ASAN_UNPOISON_SYMBOL (symbol_free_list);
@@ -2952,7 +3180,10 @@ set_cons_marked (struct Lisp_Cons *c)
   if (pdumper_object_p (c))
     pdumper_set_marked (c);
   else
-    XMARK_CONS (c);
+    {
+      XMARK_CONS (c);
+      ++gcstat.total_conses;
+    }
 }
 
 static bool
@@ -2991,7 +3222,11 @@ set_symbol_marked (struct Lisp_Symbol *s)
   if (pdumper_object_p (s))
     pdumper_set_marked (s);
   else
-    s->u.s.gcmarkbit = true;
+    {
+      s->u.s.gcmarkbit = true;
+      if (!c_symbol_p (s))
+	++gcstat.total_symbols;
+    }
 }
 
 static bool
@@ -3273,7 +3508,6 @@ mark_maybe_pointer (void *const *p)
   struct mem_node *m;
   enum Space_Type xpntr_type;
   void *xpntr, *p_sym;
-  struct thread_state *thr = NULL;
 
   /* Research Bug#41321.  If we didn't special-case Lisp_Symbol
      to subtract off lispsym in make_lisp_ptr(), this hack wouldn't
@@ -3329,8 +3563,9 @@ mark_maybe_pointer (void *const *p)
       INT_SUBTRACT_WRAPV ((uintptr_t) *p, (uintptr_t) xpntr, &offset);
       INT_ADD_WRAPV ((uintptr_t) forwarded, offset, (uintptr_t *) p);
     }
-  else if ((m = mem_find_which_thread (*p, &thr)) != mem_nil)
+  else if ((m = mem_find (*p)) != NULL)
     {
+      struct thread_state *thr = m->thread;
       switch (m->type)
 	{
 	case MEM_TYPE_NON_LISP:
@@ -3400,10 +3635,10 @@ mark_maybe_pointer (void *const *p)
 	  break;
 	}
     }
-  else if ((m = mem_find_which_thread (p_sym, &thr)) != mem_nil
+  else if ((m = mem_find (p_sym)) != NULL
 	   && m->type == MEM_TYPE_SYMBOL)
     {
-      struct Lisp_Symbol *h = live_symbol_holding (thr, m, p_sym);
+      struct Lisp_Symbol *h = live_symbol_holding (m->thread, m, p_sym);
       if (h)
 	{
 	  mark_automatic_object (make_lisp_ptr (h, Lisp_Symbol));
@@ -3623,12 +3858,10 @@ valid_lisp_object_p (Lisp_Object obj)
   if (pdumper_object_p (p))
     return pdumper_object_p_precise (p) ? 1 : 0;
 
-  struct thread_state *thr = NULL;
-  struct mem_node *m = mem_find_which_thread (p, &thr);
-  if (m == mem_nil)
+  struct mem_node *m = mem_find (p);
+  if (!m)
     {
       int valid = -1; /* whether P is a valid pointer */
-      eassert (thr == NULL);
 #ifdef WINDOWSNT
       valid = w32_valid_pointer_p (p, 16);
 #else
@@ -3654,7 +3887,7 @@ valid_lisp_object_p (Lisp_Object obj)
 	? 1 : 0;
     }
 
-  eassert (thr != NULL);
+  struct thread_state *thr = m->thread;
   switch (m->type)
     {
     case MEM_TYPE_NON_LISP:
@@ -4283,6 +4516,7 @@ DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
 For further details, see Info node `(elisp)Garbage Collection'.  */)
   (void)
 {
+  gc_explicit = true;
   garbage_collect ();
   return Fgc_counts ();
 }
@@ -4342,6 +4576,7 @@ DEFUN ("garbage-collect-maybe", Fgarbage_collect_maybe,
 
   if (fact >= 1 && bytes_since_gc > bytes_between_gc / fact)
     {
+      gc_explicit = true;
       garbage_collect ();
       return Qt;
     }
@@ -4631,6 +4866,29 @@ mark_stack_push (Lisp_Object *value)
 }
 
 #ifdef HAVE_GCC_TLS
+/* Wait out the main thread's collection.  Run with a flushed stack so
+   that the collection sees what we hold.  */
+static void
+halt_for_gc (void *ignore)
+{
+  int nonmain_halted;
+
+  // gc began, halt myself
+  if (sem_post (&sem_nonmain_halted) != 0)
+    return; /* til next time */
+
+  // wait until main gc's
+  sem_wait_ (&sem_nonmain_resumed, current_thread);
+
+  // one step closer to main's release
+  sem_wait_ (&sem_nonmain_halted, current_thread);
+
+  if (sem_getvalue (&sem_nonmain_halted, &nonmain_halted) != 0)
+    sem_post (&sem_main_resumed); /* abort abort abort */
+  else if (nonmain_halted == 0)
+    sem_post (&sem_main_resumed); /* home free */
+}
+
 /* Nonmain threads are currently allowed to blow up.  */
 void
 maybe_garbage_collect (void)
@@ -4659,7 +4917,10 @@ maybe_garbage_collect (void)
 	      garbage_collect ();
 	      if (nonmain_halted)
 		{
-		  sem_init (&sem_nonmain_resumed, 0, nonmain_halted);
+		  /* Post rather than sem_init, which would strand the
+		     halted threads already waiting.  */
+		  for (int i = 0; i < nonmain_halted; ++i)
+		    sem_post (&sem_nonmain_resumed);
 		  sem_wait_ (&sem_main_resumed, current_thread);
 		}
 	      restore_signal_mask (&oldset);
@@ -4675,27 +4936,198 @@ maybe_garbage_collect (void)
 	return; /* til next time */
 
       if (main_halted)
-	{
-	  int nonmain_halted;
+	with_flushed_stack (halt_for_gc, NULL);
+    }
+}
+#endif /* HAVE_GCC_TLS */
+
+/* Return the time since *SINCE, and advance *SINCE to now.  */
+
+static struct timespec
+gc_phase (struct timespec *since)
+{
+  struct timespec now = current_timespec ();
+  struct timespec elapsed = timespec_sub (now, *since);
+  *since = now;
+  return elapsed;
+}
+
+static Lisp_Object
+gc_census_symbol (enum gc_census i)
+{
+  switch (i)
+    {
+    case GC_CENSUS_CONSES: return Qconses;
+    case GC_CENSUS_SYMBOLS: return Qsymbols;
+    case GC_CENSUS_STRINGS: return Qstrings;
+    case GC_CENSUS_STRING_BYTES: return Qstring_bytes;
+    case GC_CENSUS_VECTOR_SLOTS: return Qvector_slots;
+    case GC_CENSUS_FLOATS: return Qfloats;
+    case GC_CENSUS_INTERVALS: return Qintervals;
+    default: emacs_abort ();
+    }
+}
+
+/* Store in LIVE the bytes now live, and in CONSED the bytes ever
+   allocated, for each census category.  */
+
+static void
+gc_census (EMACS_INT live[GC_CENSUS_N], EMACS_INT consed[GC_CENSUS_N])
+{
+  live[GC_CENSUS_CONSES] = gcstat.total_conses * sizeof (struct Lisp_Cons);
+  consed[GC_CENSUS_CONSES] = cons_cells_consed * sizeof (struct Lisp_Cons);
+  live[GC_CENSUS_SYMBOLS] = gcstat.total_symbols * sizeof (struct Lisp_Symbol);
+  consed[GC_CENSUS_SYMBOLS] = symbols_consed * sizeof (struct Lisp_Symbol);
+  live[GC_CENSUS_STRINGS] = gcstat.total_strings * sizeof (struct Lisp_String);
+  consed[GC_CENSUS_STRINGS] = strings_consed * sizeof (struct Lisp_String);
+  live[GC_CENSUS_STRING_BYTES] = gcstat.total_string_bytes;
+  consed[GC_CENSUS_STRING_BYTES] = string_chars_consed;
+  live[GC_CENSUS_VECTOR_SLOTS] = gcstat.total_vector_slots * word_size;
+  consed[GC_CENSUS_VECTOR_SLOTS] = vector_cells_consed * word_size;
+  live[GC_CENSUS_FLOATS] = gcstat.total_floats * sizeof (struct Lisp_Float);
+  consed[GC_CENSUS_FLOATS] = floats_consed * sizeof (struct Lisp_Float);
+  live[GC_CENSUS_INTERVALS] = gcstat.total_intervals * sizeof (struct interval);
+  consed[GC_CENSUS_INTERVALS] = intervals_consed * sizeof (struct interval);
+}
+
+/* Return the fraction of E's sblock bytes not holding live string
+   data.  */
+
+static double
+gc_event_fragmentation (struct gc_event const *e)
+{
+  return e->sblock_bytes ? 1 - (double) e->sdata_live / e->sblock_bytes : 0;
+}
+
+/* The expanded and encoded name of `gc-event-log-file', or NULL.
+   It is worked out when the variable is set, since a collection must
+   not call out to Lisp.  */
+static char *gc_event_log_name;
+
+static Lisp_Object
+watch_gc_event_log_file (Lisp_Object symbol, Lisp_Object newval,
+			 Lisp_Object operation, Lisp_Object where)
+{
+  char *name = NULL;
+  if (STRINGP (newval))
+    name = xstrdup (SSDATA (ENCODE_FILE (Fexpand_file_name (newval, Qnil))));
+  xfree (gc_event_log_name);
+  gc_event_log_name = name;
+  return Qnil;
+}
 
-	  // gc began, halt myself
-	  if (sem_post (&sem_nonmain_halted) != 0)
-	    return; /* til next time */
+/* Append a line describing E to `gc-event-log-file'.  */
 
-	  // wait until main gc's
-	  sem_wait_ (&sem_nonmain_resumed, current_thread);
+static void
+log_gc_event (struct gc_event const *e)
+{
+  /* Room for the widest doubles, so nothing is cut short.  */
+  char line[4096];
+  int n = snprintf (line, sizeof line,
+		    "gc=%"pI"d trigger=%s start=%.6f elapsed=%.6f"
+		    " mark=%.6f sweep=%.6f finalize=%.6f",
+		    e->number, e->explicit ? "explicit" : "threshold",
+		    timespectod (e->start), timespectod (e->elapsed),
+		    timespectod (e->mark), timespectod (e->sweep),
+		    timespectod (e->finalize));
+  for (int i = 0; i < GC_CENSUS_N; ++i)
+    n += snprintf (line + n, sizeof line - n, " %s=%"pI"d/%"pI"d",
+		   SSDATA (SYMBOL_NAME (gc_census_symbol (i))),
+		   e->live[i], e->freed[i]);
+  n += snprintf (line + n, sizeof line - n,
+		 " string-bytes-moved=%"pI"d sblocks-freed=%"pI"d"
+		 " sblock-bytes=%"pI"d string-fragmentation=%.4f\n",
+		 e->sdata_moved, e->sblocks_freed,
+		 e->sblock_bytes, gc_event_fragmentation (e));
+
+  int fd = emacs_open_noquit (gc_event_log_name,
+			      O_WRONLY | O_APPEND | O_CREAT, 0666);
+  if (fd < 0)
+    return;
+  emacs_write (fd, line, n);
+  emacs_close (fd);
+}
 
-	  // one step closer to main's release
-	  sem_wait_ (&sem_nonmain_halted, current_thread);
+/* Complete gc_event and add it to the ring.  */
 
-	  if (sem_getvalue (&sem_nonmain_halted, &nonmain_halted) != 0)
-	    sem_post (&sem_main_resumed); /* abort abort abort */
-	  else if (nonmain_halted == 0)
-	    sem_post (&sem_main_resumed); /* home free */
+static void
+record_gc_event (void)
+{
+  static EMACS_INT last_live[GC_CENSUS_N], last_consed[GC_CENSUS_N];
+  EMACS_INT consed[GC_CENSUS_N];
+
+  gc_census (gc_event.live, consed);
+  for (int i = 0; i < GC_CENSUS_N; ++i)
+    {
+      /* Whatever was live last time or allocated since, and is not
+	 live now, was freed.  */
+      gc_event.freed[i] = max (0, (last_live[i] + consed[i] - last_consed[i]
+				   - gc_event.live[i]));
+      last_live[i] = gc_event.live[i];
+      last_consed[i] = consed[i];
+    }
+  gc_event.number = gcs_done;
+  gc_event.elapsed = timespec_sub (current_timespec (), gc_event.start);
+  gc_events[gc_events_count++ % GC_EVENTS_MAX] = gc_event;
+
+  if (gc_event_log_name)
+    log_gc_event (&gc_event);
+}
+
+DEFUN ("gc-events", Fgc_events, Sgc_events, 0, 0, 0,
+       doc: /* Return a list of recent garbage collections, newest first.
+At most the last 64 are kept.  Each entry is a plist with properties:
+- `:number', the value of `gcs-done' after the collection.
+- `:trigger', `explicit' if requested by Lisp, e.g., by calling
+  `garbage-collect', or `threshold' if due to `gc-cons-threshold' or
+  `gc-cons-percentage'.
+- `:start', the Lisp timestamp at which the collection began.
+- `:elapsed', `:mark', `:sweep' and `:finalize', the seconds spent
+  overall and in each phase.
+- `:live' and `:freed', alists of (NAME . BYTES), where NAME is as in
+  `gc-counts', of the bytes live after the collection and the bytes
+  it reclaimed.  Freed bytes are estimated from the allocation
+  counters such as `cons-cells-consed'.
+- `:string-bytes-moved', the bytes of string data moved by compaction.
+- `:sblocks-freed', the blocks of string data released.
+- `:sblock-bytes', the bytes of string data blocks held afterwards.
+- `:string-fragmentation', the fraction of those bytes not holding
+  live string data.
+See also `gc-event-log-file'.  */)
+  (void)
+{
+  Lisp_Object events = Qnil;
+  for (EMACS_INT n = max (0, gc_events_count - GC_EVENTS_MAX);
+       n < gc_events_count; ++n)
+    {
+      struct gc_event const *e = &gc_events[n % GC_EVENTS_MAX];
+      Lisp_Object live = Qnil, freed = Qnil;
+      for (int i = GC_CENSUS_N - 1; i >= 0; --i)
+	{
+	  live = Fcons (Fcons (gc_census_symbol (i), make_int (e->live[i])),
+			live);
+	  freed = Fcons (Fcons (gc_census_symbol (i), make_int (e->freed[i])),
+			 freed);
 	}
+      events = Fcons (CALLN (Flist,
+			     QCnumber, make_int (e->number),
+			     QCtrigger, e->explicit ? Qexplicit : Qthreshold,
+			     QCstart, make_lisp_time (e->start),
+			     QCelapsed, make_float (timespectod (e->elapsed)),
+			     QCmark, make_float (timespectod (e->mark)),
+			     QCsweep, make_float (timespectod (e->sweep)),
+			     QCfinalize, make_float (timespectod (e->finalize)),
+			     QClive, live,
+			     QCfreed, freed,
+			     QCstring_bytes_moved, make_int (e->sdata_moved),
+			     QCsblocks_freed, make_int (e->sblocks_freed),
+			     QCsblock_bytes, make_int (e->sblock_bytes),
+			     QCstring_fragmentation,
+			     make_float (gc_event_fragmentation (e))),
+		      events);
     }
+  return events;
 }
-#endif /* HAVE_GCC_TLS */
 
 /* Subroutine of Fgarbage_collect that does most of the work.  */
 
@@ -4709,6 +5141,9 @@ garbage_collect (void)
   reap_threads (); // as good a place for this as any
 #endif
 
+  bool explicit = gc_explicit;
+  gc_explicit = false;
+
   if (gc_inhibited)
     return false;
 
@@ -4722,6 +5157,11 @@ garbage_collect (void)
 			     : (size_t) -1);
 
   const struct timespec start = current_timespec ();
+  struct timespec phase = start;
+  gc_event = (struct gc_event) { .explicit = explicit, .start = start };
+
+  /* Char-tables freed below may see their addresses reused.  */
+  ++chartab_tick;
 
   /* Discretionary trimming before marking.  */
   Lisp_Object tail, buffer;
@@ -4729,6 +5169,12 @@ garbage_collect (void)
     compact_buffer (XBUFFER (buffer));
   compact_regexp_cache ();
 
+  /* Marks of the last collection linger in blocks not yet swept.  */
+  finish_sweeps ();
+  gc_event.sweep = gc_phase (&phase);
+  gcstat.total_conses = gcstat.total_floats = 0;
+  gcstat.total_symbols = ARRAYELTS (lispsym);
+
   eassert (weak_hash_tables == NULL && mark_stack_empty_p ());
   mark_most_objects ();
   mark_pinned_objects ();
@@ -4783,10 +5229,12 @@ garbage_collect (void)
   eassert (weak_hash_tables == NULL && mark_stack_empty_p ());
 
   mgc_flip_space ();
+  gc_event.mark = gc_phase (&phase);
 
   gc_sweep ();
 
   unmark_main_thread ();
+  gc_event.sweep = timespec_add (gc_event.sweep, gc_phase (&phase));
 
   bytes_since_gc = 0;
 
@@ -4799,6 +5247,7 @@ garbage_collect (void)
 
   /* GC is complete: now we can run our finalizer callbacks.  */
   bool finalizer_run = run_finalizers (&doomed_finalizers);
+  gc_event.finalize = gc_phase (&phase);
 
   if (main_thread_p (current_thread))
     {
@@ -4807,6 +5256,8 @@ garbage_collect (void)
       ++gcs_done;
     }
 
+  record_gc_event ();
+
   /* Collect profiling data.  */
   if (tot_before != (size_t) -1)
     {
@@ -4871,10 +5322,10 @@ check_live (void *xpntr, enum mem_type mtype)
     }
   else
     {
-      struct thread_state *thr = NULL;
-      struct mem_node *m = mem_find_which_thread (xpntr, &thr);
-      if (m == mem_nil && thr == NULL)
+      struct mem_node *m = mem_find (xpntr);
+      if (!m)
 	return false;
+      struct thread_state *thr = m->thread;
       switch (mtype)
 	{
 	case MEM_TYPE_CONS:
@@ -5148,7 +5599,10 @@ process_mark_stack (ptrdiff_t base_sp)
 		  {
 		    eassert (check_live (xpntr, MEM_TYPE_FLOAT));
 		    if (!XFLOAT_MARKED_P (ptr))
-		      XFLOAT_MARK (ptr);
+		      {
+			XFLOAT_MARK (ptr);
+			++gcstat.total_floats;
+		      }
 		  }
 	      }
 	  }
@@ -5232,129 +5686,195 @@ survives_gc_p (Lisp_Object obj)
 
    A probably un-portable and certainly incomprehensible foray into
    void-star-star gymnastics.
-*/
-static void
-sweep_void (struct thread_state *thr,
-	    void **free_list,
-	    int block_index,
-	    void **current_block,
-	    enum Lisp_Type xtype,
-	    size_t block_nitems,
-	    ptrdiff_t offset_items,
-	    ptrdiff_t offset_chain_from_item,
-	    ptrdiff_t offset_next,
-	    size_t xsize,
-	    size_t *tally_used,
-	    size_t *tally_free)
+
+   Sweep the first BLK_END items of BLK onto FREE_LIST.  Return the
+   number of items freed.  */
+static size_t
+sweep_void_block (void *blk,
+		  int blk_end,
+		  void **free_list,
+		  enum Lisp_Type xtype,
+		  ptrdiff_t offset_items,
+		  ptrdiff_t offset_chain_from_item,
+		  size_t xsize)
 {
-  size_t cum_free = 0, cum_used = 0;
-  int blk_end = block_index;
+  size_t blk_free = 0;
 
   eassume (offset_items == 0);
-  *free_list = NULL;
-
-  /* NEXT pointers point from CURRENT_BLOCK into the past.  The first
-     iteration processes CURRENT_BLOCK to the prevailing BLOCK_INDEX.
-     Subsequent iterations process whole blocks of BLOCK_NITEMS items.  */
-  for (void **prev = current_block, *blk = *prev;
-       blk != NULL;
-       blk = *prev, blk_end = block_nitems)
+  switch (xtype)
     {
-      size_t blk_free = 0;
-      switch (xtype)
-        {
-        case Lisp_Float:
-          ASAN_UNPOISON_FLOAT_BLOCK ((struct Lisp_Float *) *blk);
-          break;
-        case Lisp_Cons:
-          break;
-        default:
-          emacs_abort ();
-          break;
-        }
+    case Lisp_Float:
+      ASAN_UNPOISON_FLOAT_BLOCK ((struct float_block *) blk);
+      break;
+    case Lisp_Cons:
+      break;
+    default:
+      emacs_abort ();
+      break;
+    }
 
-      /* Currently BLOCK_NITEMS < BITS_PER_BITS_WORD (gcmarkbits needs
-	 but one word to describe all items in the block), so the
-	 WEND assignment effectively rounds up to 1.  */
-      int wend = (blk_end + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
-      for (int w = 0; w < wend; ++w)
-	for (int start = w * BITS_PER_BITS_WORD, c = start;
-	     c < start + min (blk_end - start, BITS_PER_BITS_WORD);
-	     ++c)
+  /* Currently BLOCK_NITEMS < BITS_PER_BITS_WORD (gcmarkbits needs
+     but one word to describe all items in the block), so the
+     WEND assignment effectively rounds up to 1.  */
+  int wend = (blk_end + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+  for (int w = 0; w < wend; ++w)
+    for (int start = w * BITS_PER_BITS_WORD, c = start;
+	 c < start + min (blk_end - start, BITS_PER_BITS_WORD);
+	 ++c)
+      {
+	void *xpntr = (void *) ((uintptr_t) blk + offset_items + c * xsize);
+	bool marked = false;
+
+	switch (xtype)
 	  {
-	    void *xpntr = (void *) ((uintptr_t) blk + offset_items + c * xsize);
-	    bool marked = false;
+	  case Lisp_Float:
+	    marked = XFLOAT_MARKED_P (xpntr);
+	    break;
+	  case Lisp_Cons:
+	    marked = XCONS_MARKED_P (xpntr);
+	    break;
+	  default:
+	    emacs_abort ();
+	    break;
+	  }
 
+	if (marked)
+	  {
 	    switch (xtype)
 	      {
 	      case Lisp_Float:
-		marked = XFLOAT_MARKED_P (xpntr);
+		XFLOAT_UNMARK (xpntr);
 		break;
 	      case Lisp_Cons:
-		marked = XCONS_MARKED_P (xpntr);
+		XUNMARK_CONS (xpntr);
 		break;
 	      default:
 		emacs_abort ();
 		break;
 	      }
-
-	    if (marked)
-	      {
-		++cum_used;
-		switch (xtype)
-		  {
-		  case Lisp_Float:
-		    XFLOAT_UNMARK (xpntr);
-		    break;
-		  case Lisp_Cons:
-		    XUNMARK_CONS (xpntr);
-		    break;
-		  default:
-		    emacs_abort ();
-		    break;
-		  }
-	      }
-	    else
+	  }
+	else
+	  {
+	    ++blk_free;
+	    /* prepend RECLAIM to free list. */
+	    void *reclaim = (void *) ((uintptr_t) blk + offset_items + c * xsize),
+	      *reclaim_next = (void *) ((uintptr_t) reclaim + offset_chain_from_item);
+	    switch (xtype)
 	      {
-		++blk_free;
-		/* prepend RECLAIM to free list. */
-		void *reclaim = (void *) ((uintptr_t) blk + offset_items + c * xsize),
-		  *reclaim_next = (void *) ((uintptr_t) reclaim + offset_chain_from_item);
-		switch (xtype)
-		  {
-		  case Lisp_Cons:
-		    {
-		      struct Lisp_Cons *reclaimed_cons
-			= (struct Lisp_Cons *) reclaim;
-                      ASAN_UNPOISON_CONS (reclaimed_cons);
-		      *(struct Lisp_Cons **) reclaim_next
-			= *(struct Lisp_Cons **) free_list;
-		      *(struct Lisp_Cons **) free_list
-			= reclaimed_cons;
-		      reclaimed_cons->u.s.car = dead_object ();
-                      ASAN_UNPOISON_CONS (reclaimed_cons);
-		    }
-		    break;
-		  case Lisp_Float:
-		    {
-		      *(struct Lisp_Float **) reclaim_next
-			= *(struct Lisp_Float **) free_list;
-		      *(struct Lisp_Float **) free_list
-			= (struct Lisp_Float *) reclaim;
-                      ASAN_POISON_FLOAT (reclaim);
-		    }
-		    break;
-		  default:
-		    emacs_abort ();
-		    break;
-		  }
+	      case Lisp_Cons:
+		{
+		  struct Lisp_Cons *reclaimed_cons
+		    = (struct Lisp_Cons *) reclaim;
+		  ASAN_UNPOISON_CONS (reclaimed_cons);
+		  *(struct Lisp_Cons **) reclaim_next
+		    = *(struct Lisp_Cons **) free_list;
+		  *(struct Lisp_Cons **) free_list
+		    = reclaimed_cons;
+		  reclaimed_cons->u.s.car = dead_object ();
+		  ASAN_UNPOISON_CONS (reclaimed_cons);
+		}
+		break;
+	      case Lisp_Float:
+		{
+		  *(struct Lisp_Float **) reclaim_next
+		    = *(struct Lisp_Float **) free_list;
+		  *(struct Lisp_Float **) free_list
+		    = (struct Lisp_Float *) reclaim;
+		  ASAN_POISON_FLOAT (reclaim);
+		}
+		break;
+	      default:
+		emacs_abort ();
+		break;
 	      }
 	  }
+      }
+  return blk_free;
+}
+
+/* Sweeping is lazy.  At collection, only CURRENT_BLOCK, whose items
+   at and beyond BLOCK_INDEX were never allocated, is swept.  The
+   remaining blocks are left to sweep_void_some(), called as
+   allocation exhausts FREE_LIST, and to sweep_void_finish(), called
+   before the next collection marks anything.  UNSWEPT records the
+   next-pointer of the last swept block, or NULL if none remain.
 
+   Live counts come from marking, so only add the number of
+   allocated items to TALLY_ITEMS.  */
+static void
+sweep_void (void **free_list,
+	    int block_index,
+	    void **current_block,
+	    void ***unswept,
+	    enum Lisp_Type xtype,
+	    size_t block_nitems,
+	    ptrdiff_t offset_items,
+	    ptrdiff_t offset_chain_from_item,
+	    ptrdiff_t offset_next,
+	    size_t xsize,
+	    size_t *tally_items)
+{
+  void *blk = *current_block;
+
+  eassert (*unswept == NULL);
+  *free_list = NULL;
+  if (blk)
+    {
+      void **block_next = (void **) ((uintptr_t) blk + offset_next);
+      sweep_void_block (blk, block_index, free_list, xtype,
+			offset_items, offset_chain_from_item, xsize);
+      *tally_items += block_index;
+      for (void *b = *block_next; b != NULL;
+	   b = *(void **) ((uintptr_t) b + offset_next))
+	*tally_items += block_nitems;
+      if (*block_next)
+	*unswept = block_next;
+    }
+}
+
+/* Sweep unswept blocks until FREE_LIST is nonempty.  */
+static void
+sweep_void_some (void **free_list,
+		 void ***unswept,
+		 enum Lisp_Type xtype,
+		 size_t block_nitems,
+		 ptrdiff_t offset_items,
+		 ptrdiff_t offset_chain_from_item,
+		 ptrdiff_t offset_next,
+		 size_t xsize)
+{
+  while (*free_list == NULL && *unswept != NULL)
+    {
+      void *blk = **unswept;
+      void **block_next = (void **) ((uintptr_t) blk + offset_next);
+      sweep_void_block (blk, block_nitems, free_list, xtype,
+			offset_items, offset_chain_from_item, xsize);
+      *unswept = *block_next ? block_next : NULL;
+    }
+}
+
+/* Sweep all unswept blocks, deallocating those without live items
+   once more than a block's worth of free items has accumulated.  */
+static void
+sweep_void_finish (struct thread_state *thr,
+		   void **free_list,
+		   void ***unswept,
+		   enum Lisp_Type xtype,
+		   size_t block_nitems,
+		   ptrdiff_t offset_items,
+		   ptrdiff_t offset_chain_from_item,
+		   ptrdiff_t offset_next,
+		   size_t xsize)
+{
+  size_t cum_free = 0;
+
+  for (void **prev = *unswept, *blk; prev != NULL && (blk = *prev) != NULL; )
+    {
+      size_t blk_free
+	= sweep_void_block (blk, block_nitems, free_list, xtype,
+			    offset_items, offset_chain_from_item, xsize);
       void *block_next = (void *) ((uintptr_t) blk + offset_next);
 
-      /* If BLK contains only free items and cumulative free items
-         would exceed two blocks worth, deallocate BLK.  */
       if (blk_free >= block_nitems && cum_free > block_nitems)
         {
 	  void *free_next = (void *) ((uintptr_t) blk + offset_items
@@ -5389,9 +5909,7 @@ sweep_void (struct thread_state *thr,
 	  cum_free += blk_free;
         }
     }
-
-  *tally_used = cum_used;
-  *tally_free = cum_free;
+  *unswept = NULL;
 }
 
 static void
@@ -5448,52 +5966,83 @@ sweep_intervals (struct thread_state *thr)
   gcstat.total_free_intervals = cum_free;
 }
 
+/* Sweep the first BLK_END symbols of SBLK onto THR's free list.
+   Return the number of symbols freed.  */
+static int
+sweep_symbol_block (struct thread_state *thr, struct symbol_block *sblk,
+		    int blk_end)
+{
+  int blk_free = 0;
+
+  ASAN_UNPOISON_SYMBOL_BLOCK (sblk);
+  for (struct Lisp_Symbol *sym = sblk->symbols, *end = sym + blk_end;
+       sym < end; ++sym)
+    {
+      if (sym->u.s.gcmarkbit)
+	sym->u.s.gcmarkbit = false;
+      else
+	{
+	  if (sym->u.s.type == SYMBOL_LOCAL_SOMEWHERE)
+	    {
+	      /* Avoid re-free (bug#29066).  */
+	      sym->u.s.type = SYMBOL_PLAINVAL;
+	    }
+	  sym->u.s.next = THREAD_FIELD (thr, m_symbol_free_list);
+	  sym->u.s.function = dead_object ();
+	  THREAD_FIELD (thr, m_symbol_free_list) = sym;
+	  ++blk_free;
+	  ASAN_POISON_SYMBOL (sym);
+	}
+    }
+  return blk_free;
+}
+
+/* Sweep lazily as in sweep_void().  */
 static void
-sweep_symbols (struct thread_state *thr)
+sweep_symbols (struct thread_state *thr, size_t *tally_items)
 {
-  struct symbol_block *sblk;
-  struct symbol_block **sprev = &THREAD_FIELD (thr, m_symbol_blocks);
-  size_t cum_free = 0, cum_used = ARRAYELTS (lispsym);
+  struct symbol_block *sblk = THREAD_FIELD (thr, m_symbol_blocks);
 
+  eassert (THREAD_FIELD (thr, m_symbol_unswept) == NULL);
   THREAD_FIELD (thr, m_symbol_free_list) = NULL;
   for (int i = 0; i < ARRAYELTS (lispsym); ++i)
     lispsym[i].u.s.gcmarkbit = false;
 
-  for (sblk = THREAD_FIELD (thr, m_symbol_blocks); sblk != NULL; sblk = *sprev)
+  if (sblk)
     {
-      ASAN_UNPOISON_SYMBOL_BLOCK (sblk);
-      int blk_free = 0;
-      struct Lisp_Symbol *sym = sblk->symbols;
+      sweep_symbol_block (thr, sblk, THREAD_FIELD (thr, m_symbol_block_index));
+      *tally_items += THREAD_FIELD (thr, m_symbol_block_index);
+      for (struct symbol_block *b = sblk->next; b != NULL; b = b->next)
+	*tally_items += BLOCK_NSYMBOLS;
+      if (sblk->next)
+	THREAD_FIELD (thr, m_symbol_unswept) = &sblk->next;
+    }
+}
 
-      /* First iteration processes up to prevailing
-	 SYMBOL_BLOCK_INDEX.  Subsequent iterations traverse whole
-	 blocks of BLOCK_NSYMBOLS. */
-      struct Lisp_Symbol *end
-	= sym + (sblk == THREAD_FIELD (thr, m_symbol_blocks)
-		 ? THREAD_FIELD (thr, m_symbol_block_index)
-		 : BLOCK_NSYMBOLS);
+/* Sweep unswept symbol blocks until the free list is nonempty.  */
+static void
+sweep_symbols_some (struct thread_state *thr)
+{
+  struct symbol_block ***unswept = &THREAD_FIELD (thr, m_symbol_unswept);
+  while (THREAD_FIELD (thr, m_symbol_free_list) == NULL && *unswept != NULL)
+    {
+      struct symbol_block *sblk = **unswept;
+      sweep_symbol_block (thr, sblk, BLOCK_NSYMBOLS);
+      *unswept = sblk->next ? &sblk->next : NULL;
+    }
+}
 
-      for (; sym < end; ++sym)
-        {
-          if (sym->u.s.gcmarkbit)
-            {
-              ++cum_used;
-              sym->u.s.gcmarkbit = false;
-            }
-	  else
-            {
-              if (sym->u.s.type == SYMBOL_LOCAL_SOMEWHERE)
-		{
-                  /* Avoid re-free (bug#29066).  */
-                  sym->u.s.type = SYMBOL_PLAINVAL;
-                }
-              sym->u.s.next = THREAD_FIELD (thr, m_symbol_free_list);
-	      sym->u.s.function = dead_object ();
-              THREAD_FIELD (thr, m_symbol_free_list) = sym;
-              ++blk_free;
-	      ASAN_POISON_SYMBOL (sym);
-            }
-        }
+/* Sweep all unswept symbol blocks, deallocating as in
+   sweep_void_finish().  */
+static void
+sweep_symbols_finish (struct thread_state *thr)
+{
+  struct symbol_block **sprev = THREAD_FIELD (thr, m_symbol_unswept);
+  int cum_free = 0;
+
+  for (struct symbol_block *sblk; sprev != NULL && (sblk = *sprev) != NULL; )
+    {
+      int blk_free = sweep_symbol_block (thr, sblk, BLOCK_NSYMBOLS);
 
       /* If BLK contains only free items and we've already seen more
          than two such blocks, then deallocate BLK.  */
@@ -5511,8 +6060,7 @@ sweep_symbols (struct thread_state *thr)
           sprev = &sblk->next;
         }
     }
-  gcstat.total_symbols = cum_used;
-  gcstat.total_free_symbols = cum_free;
+  THREAD_FIELD (thr, m_symbol_unswept) = NULL;
 }
 
 /* Markers are weak pointers.  Invalidate all markers pointing to the
@@ -5549,9 +6097,75 @@ sweep_buffers (struct thread_state *thr)
     }
 }
 
+static void
+sweep_conses_some (struct thread_state *thr)
+{
+  sweep_void_some ((void **) &THREAD_FIELD (thr, m_cons_free_list),
+		   (void ***) &THREAD_FIELD (thr, m_cons_unswept),
+		   Lisp_Cons,
+		   BLOCK_NCONS,
+		   offsetof (struct cons_block, conses),
+		   offsetof (struct Lisp_Cons, u.s.u.chain),
+		   offsetof (struct cons_block, next),
+		   sizeof (struct Lisp_Cons));
+}
+
+static void
+sweep_floats_some (struct thread_state *thr)
+{
+  sweep_void_some ((void **) &THREAD_FIELD (thr, m_float_free_list),
+		   (void ***) &THREAD_FIELD (thr, m_float_unswept),
+		   Lisp_Float,
+		   BLOCK_NFLOATS,
+		   offsetof (struct float_block, floats),
+		   offsetof (struct Lisp_Float, u.chain),
+		   offsetof (struct float_block, next),
+		   sizeof (struct Lisp_Float));
+}
+
+/* Complete THR's lazy sweep of the last collection.  */
+
+static void
+finish_sweep (struct thread_state *thr)
+{
+  sweep_void_finish (thr,
+		     (void **) &THREAD_FIELD (thr, m_cons_free_list),
+		     (void ***) &THREAD_FIELD (thr, m_cons_unswept),
+		     Lisp_Cons,
+		     BLOCK_NCONS,
+		     offsetof (struct cons_block, conses),
+		     offsetof (struct Lisp_Cons, u.s.u.chain),
+		     offsetof (struct cons_block, next),
+		     sizeof (struct Lisp_Cons));
+  sweep_void_finish (thr,
+		     (void **) &THREAD_FIELD (thr, m_float_free_list),
+		     (void ***) &THREAD_FIELD (thr, m_float_unswept),
+		     Lisp_Float,
+		     BLOCK_NFLOATS,
+		     offsetof (struct float_block, floats),
+		     offsetof (struct Lisp_Float, u.chain),
+		     offsetof (struct float_block, next),
+		     sizeof (struct Lisp_Float));
+  sweep_symbols_finish (thr);
+}
+
+void
+finish_sweeps (void)
+{
+#ifdef HAVE_GCC_TLS
+  for (struct thread_state *thr = all_threads;
+       thr != NULL;
+       thr = thr->next_thread)
+#else
+  struct thread_state *thr = current_thread;
+#endif
+  finish_sweep (thr);
+}
+
 static void
 gc_sweep (void)
 {
+  size_t conses = 0, floats = 0, symbols = ARRAYELTS (lispsym);
 #ifdef HAVE_GCC_TLS
   for (struct thread_state *thr = all_threads;
        thr != NULL;
@@ -5561,35 +6175,41 @@ gc_sweep (void)
 #endif
   {
     sweep_strings (thr);
-    sweep_void (thr,
-		(void **) &THREAD_FIELD (thr, m_cons_free_list),
+    sweep_void ((void **) &THREAD_FIELD (thr, m_cons_free_list),
 		THREAD_FIELD (thr, m_cons_block_index),
 		(void **) &THREAD_FIELD (thr, m_cons_blocks),
+		(void ***) &THREAD_FIELD (thr, m_cons_unswept),
 		Lisp_Cons,
 		BLOCK_NCONS,
 		offsetof (struct cons_block, conses),
 		offsetof (struct Lisp_Cons, u.s.u.chain),
 		offsetof (struct cons_block, next),
 		sizeof (struct Lisp_Cons),
-		&gcstat.total_conses,
-		&gcstat.total_free_conses);
-    sweep_void (thr,
-		(void **) &THREAD_FIELD (thr, m_float_free_list),
+		&conses);
+    sweep_void ((void **) &THREAD_FIELD (thr, m_float_free_list),
 		THREAD_FIELD (thr, m_float_block_index),
 		(void **) &THREAD_FIELD (thr, m_float_blocks),
+		(void ***) &THREAD_FIELD (thr, m_float_unswept),
 		Lisp_Float,
 		BLOCK_NFLOATS,
 		offsetof (struct float_block, floats),
 		offsetof (struct Lisp_Float, u.chain),
 		offsetof (struct float_block, next),
 		sizeof (struct Lisp_Float),
-		&gcstat.total_floats,
-		&gcstat.total_free_floats);
+		&floats);
     sweep_intervals (thr);
-    sweep_symbols (thr);
+    sweep_symbols (thr, &symbols);
     sweep_buffers (thr);
     sweep_vectors (thr);
   }
+
+  /* Items not marked are free, or will be once lazily swept.  */
+  eassert (gcstat.total_conses <= conses
+	   && gcstat.total_floats <= floats
+	   && gcstat.total_symbols <= symbols);
+  gcstat.total_free_conses = conses - gcstat.total_conses;
+  gcstat.total_free_floats = floats - gcstat.total_floats;
+  gcstat.total_free_symbols = symbols - gcstat.total_symbols;
   pdumper_clear_marks ();
 }
 
@@ -5599,9 +6219,24 @@ gc_sweep (void)
 void
 reap_thread_allocations (struct thread_state *thr)
 {
-  mem_merge_into (&main_thread->m_mem_root, thr->m_mem_root);
-  mem_delete_root (&thr->m_mem_root);
-  eassume (thr->m_mem_root == mem_nil);
+  finish_sweep (thr);
+
+#define REOWN_ONTO_MAIN(type, what, data)				\
+  do {									\
+    for (struct type *p = thr->what; p != NULL; p = p->next)		\
+      {									\
+	struct mem_node *m = mem_find (data);				\
+	eassert (m && m->thread == thr);				\
+	m->thread = main_thread;					\
+      }									\
+  } while (0);
+
+  REOWN_ONTO_MAIN (string_block, m_string_blocks, p);
+  REOWN_ONTO_MAIN (float_block, m_float_blocks, p);
+  REOWN_ONTO_MAIN (cons_block, m_cons_blocks, p);
+  REOWN_ONTO_MAIN (symbol_block, m_symbol_blocks, p);
+  REOWN_ONTO_MAIN (vector_block, m_vector_blocks, p->data);
+  REOWN_ONTO_MAIN (large_vector, m_large_vectors, p);
 
 #ifdef ENABLE_CHECKING
 #define CHECKSUM_BEFORE(type, next, what)				\
@@ -5666,6 +6301,20 @@ #define PREPEND_ONTO_MAIN(type, next, what)			\
 	main_thread->m_current_sblock = thr->m_current_sblock;
     }
 
+  if (thr->m_current_medium_sblock)
+    {
+      thr->m_current_medium_sblock->next = main_thread->m_oldest_medium_sblock;
+      main_thread->m_oldest_medium_sblock = thr->m_oldest_medium_sblock;
+      if (! main_thread->m_current_medium_sblock)
+	main_thread->m_current_medium_sblock = thr->m_current_medium_sblock;
+    }
+
+  for (struct sblock *next, *b = thr->m_spare_sblocks; b != NULL; b = next)
+    {
+      next = b->next;
+      lisp_free (thr, b);
+    }
+
   if (thr->m_string_blocks)
     {
       PREPEND_ONTO_MAIN (string_block, next, m_string_blocks);
@@ -5746,6 +6395,7 @@ #define PREPEND_ONTO_MAIN(type, next, what)			\
     }
 }
 #undef PREPEND_ONTO_MAIN
+#undef REOWN_ONTO_MAIN
 #undef CHECKSUM_BEFORE
 #undef CHECKSUM_AFTER
 #endif /* HAVE_GCC_TLS */
@@ -5905,6 +6555,7 @@ which_symbols (Lisp_Object obj, EMACS_INT find_max)
 
    if (!deadp (obj))
      {
+       finish_sweep (current_thread);
        for (int i = 0; i < ARRAYELTS (lispsym); ++i)
 	 {
 	   Lisp_Object sym = builtin_lisp_symbol (i);
@@ -6006,12 +6657,7 @@ init_runtime (void)
   static_string_allocator = &allocate_string;
   static_vector_allocator = &allocate_vector;
   static_interval_allocator = &allocate_interval;
-  mem_nil->left = mem_nil->right = mem_nil;
-  mem_nil->parent = NULL;
-  mem_nil->color = MEM_BLACK;
-  mem_nil->start = mem_nil->end = NULL;
   eassume (main_thread_p (current_thread));
-  mem_root = mem_nil;
   interval_block_index = BLOCK_NINTERVALS;
   float_block_index = BLOCK_NFLOATS;
   cons_block_index = BLOCK_NCONS;
@@ -6115,6 +6761,32 @@ syms_of_alloc (void)
               doc: /* Accumulated number of garbage collections done.  */);
   gcs_done = 0;
 
+  DEFVAR_LISP ("gc-event-log-file", Vgc_event_log_file,
+	       doc: /* File to which to append a line per garbage collection.
+If nil, collections are only recorded for `gc-events'.  Each line
+consists of space-separated KEY=VALUE fields, the same as the
+properties of `gc-events' entries, with times in seconds and live and
+freed bytes written as NAME=LIVE/FREED.  A relative name is expanded
+against `default-directory' as of when the variable is set.  */);
+  Vgc_event_log_file = Qnil;
+  DEFSYM (Qgc_event_log_file, "gc-event-log-file");
+
+  DEFSYM (QCnumber, ":number");
+  DEFSYM (QCtrigger, ":trigger");
+  DEFSYM (QCstart, ":start");
+  DEFSYM (QCelapsed, ":elapsed");
+  DEFSYM (QCmark, ":mark");
+  DEFSYM (QCsweep, ":sweep");
+  DEFSYM (QCfinalize, ":finalize");
+  DEFSYM (QClive, ":live");
+  DEFSYM (QCfreed, ":freed");
+  DEFSYM (QCstring_bytes_moved, ":string-bytes-moved");
+  DEFSYM (QCsblocks_freed, ":sblocks-freed");
+  DEFSYM (QCsblock_bytes, ":sblock-bytes");
+  DEFSYM (QCstring_fragmentation, ":string-fragmentation");
+  DEFSYM (Qexplicit, "explicit");
+  DEFSYM (Qthreshold, "threshold");
+
   DEFVAR_INT ("integer-width", integer_width,
 	      doc: /* Maximum number N of bits in safely-calculated integers.
 Integers with absolute values less than 2**N do not signal a range error.
@@ -6139,6 +6811,7 @@ syms_of_alloc (void)
   defsubr (&Sgarbage_collect);
   defsubr (&Sgarbage_collect_maybe);
   defsubr (&Sgc_counts);
+  defsubr (&Sgc_events);
   defsubr (&Smemory_info);
   defsubr (&Smemory_full);
   defsubr (&Smemory_use_counts);
@@ -6165,6 +6838,13 @@ syms_of_alloc (void)
        4, 4, "watch_gc_cons_percentage", {0}, lisp_h_Qnil}};
   XSETSUBR (watcher, &Swatch_gc_cons_percentage.s);
   Fadd_variable_watcher (Qgc_cons_percentage, watcher);
+
+  static union Aligned_Lisp_Subr Swatch_gc_event_log_file =
+     {{{ PSEUDOVECTOR_FLAG | (PVEC_SUBR << PSEUDOVECTOR_AREA_BITS) },
+       { .a4 = watch_gc_event_log_file },
+       4, 4, "watch_gc_event_log_file", {0}, lisp_h_Qnil}};
+  XSETSUBR (watcher, &Swatch_gc_event_log_file.s);
+  Fadd_variable_watcher (Qgc_event_log_file, watcher);
 }
 
 #ifdef HAVE_X_WINDOWS
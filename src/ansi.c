@@ -0,0 +1,481 @@
+/* Interpreting ANSI control sequences in process output.
+
+Copyright (C) 2024 Free Software Foundation, Inc.
+
+This file is NOT part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* Programs write control sequences (ECMA 48, section 5.4) into their
+   output to color it.  ansi-color.el used to find them with regexps
+   and interpret their Select Graphic Rendition (SGR) parameters in
+   Lisp, which could not keep up with the megabytes per second that
+   test runners and build tools produce.  Here they are found in a
+   single pass over the text, and SGR parameters drive a compact
+   state from which faces are computed only when it changes.  */
+
+#include <config.h>
+
+#include <c-ctype.h>
+
+#include "lisp.h"
+#include "character.h"
+#include "buffer.h"
+
+/* What SGR parameters select: the basic faces of
+   `ansi-color-basic-faces-vector' as bits, and the foreground and
+   background colors as ANSI color codes, or -1 for none.  */
+
+struct sgr_state
+{
+  unsigned char basic;
+  int fg, bg;
+};
+
+/* SGR parameters still to be interpreted, as the semicolon-separated
+   fields of the text of OBJECT from byte position POS up to LIM.  */
+
+struct sgr_params
+{
+  Lisp_Object object;
+  ptrdiff_t pos, lim;
+};
+
+/* Return the byte at POS_BYTE in the string OBJECT, or in the current
+   buffer if OBJECT is nil.  */
+
+static int
+scan_byte (Lisp_Object object, ptrdiff_t pos_byte)
+{
+  return NILP (object) ? FETCH_BYTE (pos_byte) : SREF (object, pos_byte);
+}
+
+/* Store the next of PARAMS in *VAL and return true, or return false if
+   there is none left.  As for `ansi-color-parameter-regexp', the value
+   of a field is that of the digits it ends with, so that an empty
+   field is 0.  Values too large to be meaningful are capped.  */
+
+static bool
+sgr_next_param (struct sgr_params *params, int *val)
+{
+  if (params->pos > params->lim)
+    return false;
+  int v = 0;
+  for (; params->pos < params->lim; params->pos++)
+    {
+      int c = scan_byte (params->object, params->pos);
+      if (c == ';')
+	break;
+      else if ('0' <= c && c <= '9')
+	v = v < 100000000 ? v * 10 + (c - '0') : 1 << 30;
+      else
+	v = 0;
+    }
+  params->pos++;
+  *val = v;
+  return true;
+}
+
+/* Update STATE according to the parameters of an SGR control sequence,
+   in the same way as `ansi-color--update-face-vec'.  */
+
+static void
+sgr_update (struct sgr_state *state, struct sgr_params *params)
+{
+  int new;
+  while (sgr_next_param (params, &new))
+    {
+      bool clear = false;
+      int q = new / 10, r = new % 10;
+      switch (q)
+	{
+	case 0:
+	  if (new == 0 || new == 8 || new == 9)
+	    clear = true;
+	  else
+	    state->basic |= 1 << new;
+	  break;
+
+	case 2:
+	  if (new == 20 || new == 26 || new == 28 || new == 29)
+	    clear = true;
+	  else
+	    /* The standard says `21 doubly underlined' while
+	       https://en.wikipedia.org/wiki/ANSI_escape_code claims
+	       `21 Bright/Bold: off or Underline: Double'.  */
+	    state->basic &= ~((1 << r)
+			      | (1 << (new == 22 ? 1 : new == 25 ? 6 : 0)));
+	  break;
+
+	case 3: case 4: case 9: case 10:
+	  {
+	    int *color = q == 3 || q == 9 ? &state->fg : &state->bg;
+	    int mode, red, green, blue;
+	    switch (r)
+	      {
+	      case 8:
+		if (!sgr_next_param (params, &mode))
+		  clear = true;
+		else if (mode == 5)
+		  {
+		    if (sgr_next_param (params, color))
+		      clear = *color >= 256;
+		    else
+		      clear = true;
+		  }
+		else if (mode == 2)
+		  {
+		    bool have_red = sgr_next_param (params, &red);
+		    bool have_green = sgr_next_param (params, &green);
+		    bool have_blue = sgr_next_param (params, &blue);
+		    intmax_t rgb = (((intmax_t) red << 16)
+				    + ((intmax_t) green << 8) + blue);
+		    if (have_red && have_green && have_blue
+			&& rgb <= 0xFFFFFF)
+		      *color = 256 + rgb;
+		    else
+		      clear = true;
+		  }
+		else
+		  clear = true;
+		break;
+
+	      case 9:
+		*color = -1;
+		break;
+
+	      default:
+		*color = (q == 3 || q == 4 ? 0 : 8) + r;
+		break;
+	      }
+	  }
+	  break;
+
+	default:
+	  clear = true;
+	  break;
+	}
+
+      if (clear)
+	*state = (struct sgr_state) { .fg = -1, .bg = -1 };
+    }
+}
+
+static bool
+sgr_state_equal (struct sgr_state a, struct sgr_state b)
+{
+  return a.basic == b.basic && a.fg == b.fg && a.bg == b.bg;
+}
+
+static Lisp_Object
+color_code (int code)
+{
+  return code < 0 ? Qnil : make_fixnum (code);
+}
+
+/* Store STATE into FACE_VEC, a list (BASIC-FACES FG BG) as described
+   in `ansi-color-context-region'.  */
+
+static void
+sgr_store (struct sgr_state state, Lisp_Object face_vec)
+{
+  Lisp_Object basic_faces = XCAR (face_vec);
+  for (int i = 0; i < 8; i++)
+    bool_vector_set (basic_faces, i, state.basic & (1 << i));
+  XSETCAR (XCDR (face_vec), color_code (state.fg));
+  XSETCAR (XCDR (XCDR (face_vec)), color_code (state.bg));
+}
+
+static int
+check_color_code (Lisp_Object code)
+{
+  if (NILP (code))
+    return -1;
+  CHECK_FIXNAT (code);
+  if (XFIXNAT (code) > 256 + 0xFFFFFF)
+    args_out_of_range (code, make_fixnum (256 + 0xFFFFFF));
+  return XFIXNAT (code);
+}
+
+DEFUN ("ansi-color--scan", Fansi_color__scan, Sansi_color__scan, 5, 5, 0,
+       doc: /* Find the ANSI control sequences in OBJECT from START to END.
+OBJECT is a string, or nil for the current buffer.  Return a list
+\(FACE FRAGMENT SEQUENCES), where SEQUENCES has an element
+\(BEG END . SEQUENCE-FACE) for each control sequence from BEG to END,
+in order.  FRAGMENT is the position at which the start of a
+control sequence is cut short by END, or nil if there is none.
+
+FACE-VEC is nil, or a list describing the current face as in
+`ansi-color-context-region', which is updated as the Select Graphic
+Rendition (SGR) sequences go by.  FACE-FUNCTION is nil, or a function
+called with FACE-VEC each time it changes, to compute a face for it.
+SEQUENCE-FACE is the face then in effect for the text before the
+sequence, and FACE the face in effect after the last sequence.
+FACE-FUNCTION must not modify the text of OBJECT.  */)
+  (Lisp_Object object, Lisp_Object start, Lisp_Object end,
+   Lisp_Object face_vec, Lisp_Object face_function)
+{
+  ptrdiff_t from, to, from_byte, to_byte;
+  bool multibyte;
+  if (NILP (object))
+    {
+      validate_region (&start, &end);
+      from = XFIXNUM (start);
+      to = XFIXNUM (end);
+      from_byte = CHAR_TO_BYTE (from);
+      to_byte = CHAR_TO_BYTE (to);
+      multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+    }
+  else
+    {
+      CHECK_STRING (object);
+      validate_subarray (object, start, end, SCHARS (object), &from, &to);
+      from_byte = string_char_to_byte (object, from);
+      to_byte = string_char_to_byte (object, to);
+      multibyte = STRING_MULTIBYTE (object);
+    }
+
+  struct sgr_state state = { .fg = -1, .bg = -1 };
+  if (!NILP (face_vec))
+    {
+      CHECK_CONS (face_vec);
+      CHECK_BOOL_VECTOR (XCAR (face_vec));
+      if (bool_vector_size (XCAR (face_vec)) < 8)
+	args_out_of_range (XCAR (face_vec), make_fixnum (8));
+      for (int i = 0; i < 8; i++)
+	if (bool_vector_ref (XCAR (face_vec), i))
+	  state.basic |= 1 << i;
+      Lisp_Object colors = XCDR (face_vec);
+      CHECK_CONS (colors);
+      CHECK_CONS (XCDR (colors));
+      state.fg = check_color_code (XCAR (colors));
+      state.bg = check_color_code (XCAR (XCDR (colors)));
+    }
+  else
+    face_function = Qnil;
+
+  /* The state FACE was computed for.  */
+  struct sgr_state face_state = state;
+  Lisp_Object face = NILP (face_function) ? Qnil : call1 (face_function,
+							   face_vec);
+  Lisp_Object sequences = Qnil, fragment = Qnil;
+  ptrdiff_t pos = from, pos_byte = from_byte;
+  intmax_t quit_count = 0;
+  while (pos_byte < to_byte)
+    {
+      rarely_quit (++quit_count);
+      int c = scan_byte (object, pos_byte);
+      if (c == '\033')
+	{
+	  /* Look for a control sequence: "\e[", parameter bytes,
+	     intermediate bytes and a final byte.  */
+	  ptrdiff_t b = pos_byte + 1;
+	  if (b < to_byte && scan_byte (object, b) == '[')
+	    {
+	      ptrdiff_t params_byte = ++b;
+	      while (b < to_byte
+		     && 0x30 <= scan_byte (object, b)
+		     && scan_byte (object, b) <= 0x3F)
+		b++;
+	      while (b < to_byte
+		     && 0x20 <= scan_byte (object, b)
+		     && scan_byte (object, b) <= 0x2F)
+		b++;
+	      int final = b < to_byte ? scan_byte (object, b) : -1;
+	      if (0x40 <= final && final <= 0x7E)
+		{
+		  /* All the bytes of the sequence are ASCII.  */
+		  ptrdiff_t seq_end = pos + (b + 1 - pos_byte);
+		  if (final == 'm' && !NILP (face_function))
+		    {
+		      struct sgr_params params = { object, params_byte, b };
+		      sgr_update (&state, &params);
+		    }
+		  sequences = Fcons (Fcons (make_fixnum (pos),
+					    Fcons (make_fixnum (seq_end),
+						   face)),
+				     sequences);
+		  if (!sgr_state_equal (state, face_state))
+		    {
+		      sgr_store (state, face_vec);
+		      face = call1 (face_function, face_vec);
+		      face_state = state;
+		    }
+		  pos = seq_end;
+		  pos_byte = b + 1;
+		  continue;
+		}
+	    }
+	  if (b == to_byte)
+	    {
+	      fragment = make_fixnum (pos);
+	      break;
+	    }
+	}
+      pos++;
+      pos_byte += multibyte ? BYTES_BY_CHAR_HEAD (c) : 1;
+    }
+
+  return list3 (face, fragment, Fnreverse (sequences));
+}
+
+/* term.el's filter runs the following over the output of programs in
+   a terminal, to split it into text and the control sequences of
+   `term-control-seq-regexp'.  */
+
+/* If the text of STRING at byte position POS_BYTE is one or more
+   characters other than newline and then a newline, return the byte
+   position after the newline, and otherwise -1.  */
+
+static ptrdiff_t
+rest_of_line_end (Lisp_Object string, ptrdiff_t pos_byte)
+{
+  ptrdiff_t nbytes = SBYTES (string);
+  if (pos_byte == nbytes || SREF (string, pos_byte) == '\n')
+    return -1;
+  unsigned char *nl = memchr (SDATA (string) + pos_byte, '\n',
+			      nbytes - pos_byte);
+  return nl ? nl - SDATA (string) + 1 : -1;
+}
+
+/* Return the numeric parameters of the control sequence of STRING
+   whose parameter bytes are from byte position FROM to LIM, the same
+   as `string-to-number' returns for each of their semicolon-separated
+   fields.  */
+
+static Lisp_Object
+control_params (Lisp_Object string, ptrdiff_t from, ptrdiff_t lim)
+{
+  Lisp_Object params = Qnil;
+  ptrdiff_t field = from;
+  for (ptrdiff_t b = from; ; b++)
+    if (b == lim || SREF (string, b) == ';')
+      {
+	ptrdiff_t digits = field;
+	while (digits < b && c_isdigit (SREF (string, digits)))
+	  digits++;
+	Lisp_Object val;
+	/* Fewer digits than this cannot overflow.  */
+	if (digits - field < INTMAX_WIDTH / 4)
+	  {
+	    intmax_t v = 0;
+	    for (ptrdiff_t d = field; d < digits; d++)
+	      v = v * 10 + (SREF (string, d) - '0');
+	    val = make_int (v);
+	  }
+	else
+	  val = string_to_number (SSDATA (make_unibyte_string
+					  (SSDATA (string) + field,
+					   digits - field)),
+				  10, NULL);
+	params = Fcons (val, params);
+	if (b == lim)
+	  return Fnreverse (params);
+	field = b + 1;
+      }
+}
+
+DEFUN ("term--next-control", Fterm__next_control, Sterm__next_control,
+       2, 2, 0,
+       doc: /* Find the first control sequence in STRING from START.
+The control sequences are those `term-control-seq-regexp' matches.
+Return nil if there is none, and otherwise a list (BEG END . PARAMS)
+where BEG and END are the bounds of the sequence.  PARAMS is nil,
+except for a control sequence of ECMA 48 with no intermediate bytes,
+for which it is the list of its parameters as numbers.  */)
+  (Lisp_Object string, Lisp_Object start)
+{
+  CHECK_STRING (string);
+  ptrdiff_t pos, to;
+  validate_subarray (string, start, Qnil, SCHARS (string), &pos, &to);
+  ptrdiff_t pos_byte = string_char_to_byte (string, pos);
+  ptrdiff_t nbytes = SBYTES (string);
+  bool multibyte = STRING_MULTIBYTE (string);
+
+  for (; pos_byte < nbytes;
+       pos++, pos_byte += (multibyte
+			   ? BYTES_BY_CHAR_HEAD (SREF (string, pos_byte))
+			   : 1))
+    {
+      ptrdiff_t end_byte = -1;
+      Lisp_Object params = Qnil;
+      switch (SREF (string, pos_byte))
+	{
+	case '\r': case '\n': case '\0': case '\a': case '\t': case '\b':
+	case '\016': case '\017':
+	  end_byte = pos_byte + 1;
+	  break;
+
+	case '\032':
+	  end_byte = rest_of_line_end (string, pos_byte + 1);
+	  break;
+
+	case '\033':
+	  if (pos_byte + 1 == nbytes)
+	    break;
+	  switch (SREF (string, pos_byte + 1))
+	    {
+	    case 'D': case 'M': case '7': case '8': case 'c':
+	      end_byte = pos_byte + 2;
+	      break;
+
+	    case 'A':
+	      if (pos_byte + 6 <= nbytes
+		  && !memcmp (SDATA (string) + pos_byte + 2, "nSiT", 4))
+		end_byte = rest_of_line_end (string, pos_byte + 6);
+	      break;
+
+	    case '[':
+	      {
+		ptrdiff_t params_byte = pos_byte + 2, b = params_byte;
+		while (b < nbytes
+		       && 0x30 <= SREF (string, b) && SREF (string, b) <= 0x3F)
+		  b++;
+		ptrdiff_t params_end = b;
+		while (b < nbytes
+		       && 0x20 <= SREF (string, b) && SREF (string, b) <= 0x2F)
+		  b++;
+		if (b < nbytes
+		    && 0x40 <= SREF (string, b) && SREF (string, b) <= 0x7E)
+		  {
+		    end_byte = b + 1;
+		    if (params_end == b)
+		      params = control_params (string, params_byte, b);
+		  }
+	      }
+	      break;
+	    }
+	  break;
+	}
+
+      if (end_byte >= 0)
+	{
+	  ptrdiff_t end = pos + (multibyte
+				 ? multibyte_chars_in_text (SDATA (string)
+							    + pos_byte,
+							    end_byte
+							    - pos_byte)
+				 : end_byte - pos_byte);
+	  return Fcons (make_fixnum (pos), Fcons (make_fixnum (end), params));
+	}
+    }
+  return Qnil;
+}
+
+void
+syms_of_ansi (void)
+{
+  defsubr (&Sansi_color__scan);
+  defsubr (&Sterm__next_control);
+}
@@ -561,6 +561,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   b->indirections = 0;
   /* No one shows us now.  */
   b->window_count = 0;
+  b->text_readers = 0;
+  b->text_locked = b->text_lock_wanted = false;
 
   memset (&b->local_flags, 0, sizeof (b->local_flags));
 
@@ -603,6 +605,7 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->column_cache = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -809,6 +812,8 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->base_buffer->indirections++;
   /* Always -1 for an indirect buffer.  */
   b->window_count = -1;
+  b->text_readers = 0;
+  b->text_locked = b->text_lock_wanted = false;
 
   memset (&b->local_flags, 0, sizeof (b->local_flags));
 
@@ -823,6 +828,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->column_cache = 0;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -1928,6 +1934,8 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
      This gets rid of them for certain.  */
   reset_buffer_local_variables (b, 1);
 
+  /* Readers blocked on the text give up once the name is gone.  */
+  buffer_text_write_lock (b);
   bset_name (b, Qnil);
 
   block_input ();
@@ -1963,6 +1971,11 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->column_cache)
+    {
+      free_column_cache (b->column_cache);
+      b->column_cache = 0;
+    }
   bset_width_table (b, Qnil);
   unblock_input ();
 
@@ -2368,6 +2381,8 @@ #define swapfield_(field, type) \
     bset_##field (current_buffer, tmp##field);			\
   } while (0)
 
+  buffer_text_write_lock (current_buffer);
+  buffer_text_write_lock (other_buffer);
   swapfield (own_text, struct buffer_text);
   eassert (current_buffer->text == &current_buffer->own_text);
   eassert (other_buffer->text == &other_buffer->own_text);
@@ -2391,6 +2406,7 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (column_cache, struct column_cache *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
   swapfield_ (undo_list, Lisp_Object);
@@ -2526,6 +2542,8 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
   if (narrowed)
     error ("Changing multibyteness in a narrowed buffer");
 
+  buffer_text_write_lock (current_buffer);
+
   invalidate_buffer_caches (current_buffer, BEGV, ZV);
 
   if (NILP (flag))
@@ -4331,6 +4349,65 @@ mmap_realloc (void **var, size_t nbytes)
 
 #endif /* USE_MMAP_FOR_BUFFERS */
 
+/* Where mremap is available, the text of a big buffer gets a mapping
+   of its own, which can grow without the text being copied, and
+   which is backed by huge pages where the system supports that.  */
+
+#if (!defined USE_MMAP_FOR_BUFFERS && !defined REL_ALLOC \
+     && defined HAVE_MMAP && !defined WINDOWSNT)
+# include <sys/mman.h>
+# ifdef MREMAP_MAYMOVE
+#  define MAP_BIG_BUFFER_TEXT
+# endif
+#endif
+
+#ifdef MAP_BIG_BUFFER_TEXT
+
+/* Size from which buffer text is mapped, in bytes.  */
+enum { BUFFER_TEXT_MAP_THRESHOLD = 2 * 1024 * 1024 };
+
+/* Resize the text of buffer B, which is OLD_NBYTES long, to NBYTES,
+   mapping it if it is not mapped already.  Return the new address of
+   the text, or NULL if there is not enough memory.  */
+
+static void *
+map_buffer_text (struct buffer *b, ptrdiff_t old_nbytes, ptrdiff_t nbytes)
+{
+  static ptrdiff_t page_size;
+  unsigned char *beg = b->text->beg;
+  ptrdiff_t map_size;
+  void *p;
+
+  if (!page_size)
+    page_size = getpagesize ();
+  map_size = ROUNDUP (nbytes, page_size);
+
+  if (b->text->map_size)
+    p = mremap (beg, b->text->map_size, map_size, MREMAP_MAYMOVE);
+  else
+    {
+      p = mmap (NULL, map_size, PROT_READ | PROT_WRITE,
+		MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+      if (p == MAP_FAILED)
+	return xrealloc (beg, nbytes);
+      if (beg)
+	{
+	  memcpy (p, beg, min (old_nbytes, nbytes));
+	  xfree (beg);
+	}
+    }
+  if (p == MAP_FAILED)
+    return NULL;
+
+#ifdef MADV_HUGEPAGE
+  madvise (p, map_size, MADV_HUGEPAGE);
+#endif
+  b->text->map_size = map_size;
+  return p;
+}
+
+#endif /* MAP_BIG_BUFFER_TEXT */
+
 /* Allocate NBYTES bytes for buffer B's text buffer.  */
 
 static void
@@ -4354,6 +4431,7 @@ alloc_buffer_text (struct buffer *b, ptrdiff_t nbytes)
     }
 
   b->text->beg = p;
+  b->text->map_size = 0;
   unblock_input ();
 }
 
@@ -4380,7 +4458,12 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
 #elif defined REL_ALLOC
   p = r_re_alloc ((void **) &b->text->beg, new_nbytes);
 #else
-  p = xrealloc (b->text->beg, new_nbytes);
+# ifdef MAP_BIG_BUFFER_TEXT
+  if (b->text->map_size || new_nbytes >= BUFFER_TEXT_MAP_THRESHOLD)
+    p = map_buffer_text (b, old_nbytes, new_nbytes);
+  else
+# endif
+    p = xrealloc (b->text->beg, new_nbytes);
 #endif
   __lsan_ignore_object (p);
 
@@ -4411,7 +4494,16 @@ free_buffer_text (struct buffer *b)
 #elif defined REL_ALLOC
       r_alloc_free ((void **) &b->text->beg);
 #else
-      xfree (b->text->beg);
+# ifdef MAP_BIG_BUFFER_TEXT
+      if (b->text->map_size)
+	{
+	  if (munmap (b->text->beg, b->text->map_size) == -1)
+	    fprintf (stderr, "munmap: %s\n", emacs_strerror (errno));
+	  b->text->map_size = 0;
+	}
+      else
+# endif
+	xfree (b->text->beg);
 #endif
     }
 
@@ -234,6 +234,10 @@ #define BUF_BYTES_MAX \
 
 enum { GAP_BYTES_DFL = 2000 };
 
+/* Most extra space make_gap_larger reserves, in bytes.  */
+
+enum { GAP_BYTES_MAX = 4 * 1024 * 1024 };
+
 /* Minimum gap size after compact_buffer, in bytes.  Also
    used in make_gap_smaller to avoid too small gap size.  */
 
@@ -261,6 +265,10 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
      into a buffer's text to functions that malloc.  */
   unsigned char *beg;
 
+  /* If nonzero, BEG was allocated with mmap, and this is the size of
+     the mapping.  See enlarge_buffer_text.  */
+  ptrdiff_t map_size;
+
   ptrdiff_t gpt;                /* Char pos of gap in buffer.  */
   ptrdiff_t z;                  /* Char pos of end of buffer.  */
   ptrdiff_t gpt_byte;           /* Byte pos of gap in buffer.  */
@@ -642,6 +650,13 @@ #define BVAR(buf, field) ((buf)->field ## _)
      an indirect buffer since it counts as its base buffer.  */
   int window_count;
 
+  /* Shared text lock between uncooperative readers and the thread
+     holding the global lock, see buffer_text_read_lock in thread.c.
+     Only meaningful in a base buffer.  */
+  int text_readers;
+  bool_bf text_locked : 1;
+  bool_bf text_lock_wanted : 1;
+
   /* Boolean array indicating whether slot (see header) at index was
      surfaced to lisp.  */
   char local_flags[MAX_PER_BUFFER_VARS];
@@ -701,6 +716,10 @@ #define BVAR(buf, field) ((buf)->field ## _)
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* Column checkpoints along the last long line whose columns were
+     computed, or NULL.  See indent.c.  */
+  struct column_cache *column_cache;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -1541,7 +1560,7 @@ CHARACTER_WIDTH (int c)
 {
   return (0x20 <= c && c < 0x7f ? 1
 	  : 0x7f < c ? (sanitize_char_width
-			(XFIXNUM (CHAR_TABLE_REF (Vchar_width_table, c))))
+			(XFIXNUM (CHAR_TABLE_REF_FLAT (Vchar_width_table, c))))
 	  : c == '\t' ? SANE_TAB_WIDTH (current_buffer)
 	  : c == '\n' ? 0
 	  : ! NILP (BVAR (current_buffer, ctl_arrow)) ? 2 : 4);
@@ -61,6 +61,14 @@ Copyright (C) 1985, 1994, 1997-1999, 2001-2024 Free Software Foundation,
 
   /* What the last operation was.  */
   bool downcase_last;
+
+  /* For casing ASCII text in a buffer without going through
+     case_character: how each ASCII character is cased when it does
+     not or does follow a character within a word, or -1 if it needs
+     case_character; and whether it leaves the context within a word.
+     Set up by prepare_ascii_casing.  */
+  signed char ascii_cased[2][128];
+  bool ascii_inword[2][128];
 };
 
 /* Initialize CTX structure for casing characters.  */
@@ -431,6 +439,88 @@ DEFUN ("upcase-initials", Fupcase_initials, Supcase_initials, 1, 1, 0,
   return casify_object (CASE_CAPITALIZE_UP, obj);
 }
 
+/* Set up the ASCII tables of CTX, which is about to case text in the
+   current buffer, by running every ASCII character through the path
+   that casing the buffer would take.  */
+static void
+prepare_ascii_casing (struct casing_context *ctx)
+{
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+
+  for (int was_inword = 0; was_inword < 2; was_inword++)
+    for (int c = 0; c < 128; c++)
+      {
+	int cased;
+	ctx->inword = was_inword;
+	if (multibyte)
+	  {
+	    struct casing_str_buf buf;
+	    if (!case_character_impl (&buf, ctx, c))
+	      cased = c;
+	    else
+	      cased = (buf.len_chars == 1 && buf.len_bytes == 1
+		       ? buf.data[0] : -1);
+	  }
+	else
+	  cased = case_single_character (ctx, c);
+	ctx->ascii_cased[was_inword][c] = ASCII_CHAR_P (cased) ? cased : -1;
+	ctx->ascii_inword[was_inword][c] = ctx->inword;
+      }
+
+  /* Let one lookup tell whether a character can be cased from the
+     tables.  */
+  for (int c = 0; c < 128; c++)
+    if (ctx->ascii_cased[0][c] < 0 || ctx->ascii_cased[1][c] < 0)
+      ctx->ascii_cased[0][c] = ctx->ascii_cased[1][c] = -1;
+
+  ctx->inword = false;
+}
+
+/* Based on CTX, case the ASCII characters in the current buffer from
+   POS (POS_BYTE in bytes), stopping after SIZE characters or before
+   the first character that is not ASCII or that the ASCII tables of
+   CTX do not handle.  Case them in place, a run of bytes at a time on
+   either side of the gap.  Update *FIRST and *LAST as the region
+   functions do, and return the number of characters done.  */
+static ptrdiff_t
+casify_ascii_run (struct casing_context *ctx, ptrdiff_t pos,
+		  ptrdiff_t pos_byte, ptrdiff_t size,
+		  ptrdiff_t *first, ptrdiff_t *last)
+{
+  ptrdiff_t done = 0;
+  bool inword = ctx->inword;
+
+  while (done < size)
+    {
+      ptrdiff_t from_byte = pos_byte + done;
+      ptrdiff_t seg_end = from_byte < GPT_BYTE ? GPT_BYTE : Z_BYTE;
+      ptrdiff_t n = min (size - done, seg_end - from_byte), i;
+      unsigned char *p = BYTE_POS_ADDR (from_byte);
+
+      for (i = 0; i < n; i++)
+	{
+	  int c = p[i];
+	  if (!ASCII_CHAR_P (c) || ctx->ascii_cased[0][c] < 0)
+	    break;
+	  int cased = ctx->ascii_cased[inword][c];
+	  inword = ctx->ascii_inword[inword][c];
+	  if (cased != c)
+	    {
+	      p[i] = cased;
+	      *last = pos + done + i + 1;
+	      if (*first < 0)
+		*first = pos + done + i;
+	    }
+	}
+      done += i;
+      if (i < n)
+	break;
+    }
+
+  ctx->inword = inword;
+  return done;
+}
+
 /* Based on CTX, case region in a unibyte buffer from *STARTP to *ENDP.
 
    Save first and last positions that has changed in *STARTP and *ENDP
@@ -448,6 +538,10 @@ do_casify_unibyte_region (struct casing_context *ctx,
 
   for (ptrdiff_t pos = *startp; pos < end; ++pos)
     {
+      pos += casify_ascii_run (ctx, pos, pos, end - pos, &first, &last);
+      if (pos == end)
+	break;
+
       int ch = make_char_multibyte (FETCH_BYTE (pos));
       int cased = case_single_character (ctx, ch);
       if (cased == ch)
@@ -481,6 +575,14 @@ do_casify_multibyte_region (struct casing_context *ctx,
 
   for (; size; --size)
     {
+      ptrdiff_t ascii = casify_ascii_run (ctx, pos, pos_byte, size,
+					  &first, &last);
+      pos += ascii;
+      pos_byte += ascii;
+      size -= ascii;
+      if (!size)
+	break;
+
       int len, ch = string_char_and_length (BYTE_POS_ADDR (pos_byte), &len);
       struct casing_str_buf buf;
       if (!case_character (&buf, ctx, ch,
@@ -539,6 +641,7 @@ casify_region (enum case_action flag, Lisp_Object b, Lisp_Object e)
     return end;
   modify_text (start, end);
   prepare_casing_context (&ctx, flag, true);
+  prepare_ascii_casing (&ctx);
   record_delete (start, make_buffer_string (start, end, true), false);
   if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
     {
@@ -954,7 +954,7 @@ DEFUN ("get-byte", Fget_byte, Sget_byte, 0, 2, 0,
 bool
 alphabeticp (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
   EMACS_INT gen_cat = XFIXNUM (category);
@@ -977,7 +977,7 @@ alphabeticp (int c)
 bool
 alphanumericp (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
   EMACS_INT gen_cat = XFIXNUM (category);
@@ -999,7 +999,7 @@ alphanumericp (int c)
 bool
 graphicp (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
   EMACS_INT gen_cat = XFIXNUM (category);
@@ -1017,7 +1017,7 @@ graphicp (int c)
 bool
 printablep (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
   EMACS_INT gen_cat = XFIXNUM (category);
@@ -1032,7 +1032,7 @@ printablep (int c)
 bool
 graphic_base_p (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
   EMACS_INT gen_cat = XFIXNUM (category);
@@ -1054,7 +1054,7 @@ graphic_base_p (int c)
 bool
 blankp (int c)
 {
-  Lisp_Object category = CHAR_TABLE_REF (Vunicode_category_table, c);
+  Lisp_Object category = CHAR_TABLE_REF_FLAT (Vunicode_category_table, c);
   if (!FIXNUMP (category))
     return false;
 
@@ -98,6 +98,7 @@ set_char_table_ascii (Lisp_Object table, Lisp_Object val)
 set_char_table_parent (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->parent = val;
+  ++chartab_tick;
 }
 
 DEFUN ("make-char-table", Fmake_char_table, Smake_char_table, 1, 2, 0,
@@ -368,6 +369,127 @@ char_table_ref_and_range (Lisp_Object table, int c, int *from, int *to)
 }
 
 
+/* Flattened char-tables.
+
+   Scanning loops look up a few char-tables, e.g., syntax tables and
+   `char-width-table', once per character.  For these, CHAR_TABLE_REF_FLAT
+   keeps a flattened copy of the table: the values, with defaults and
+   parents applied, of each block of 128 characters, filled on first
+   use.  Blocks are found through a page per 65536 characters, page 0
+   covering the BMP, so that a lookup costs a few indexed loads rather
+   than a descent through up to four sub char-tables and the parent's.
+
+   Modifying any char-table, and garbage collection, which may free a
+   table only for another to take its address, increment chartab_tick,
+   staling all copies at once.  Copies are kept for the CHARTAB_NFLAT
+   most recently used tables, and for the main thread only.  */
+
+enum
+{
+  CHARTAB_NFLAT = 8,
+  CHARTAB_FLAT_BLOCK_BITS = CHARTAB_SIZE_BITS_3,
+  CHARTAB_FLAT_PAGE_BITS = CHARTAB_SIZE_BITS_1 + CHARTAB_SIZE_BITS_2,
+};
+
+struct chartab_flat_block
+{
+  /* The chartab_tick VALS were filled at.  */
+  EMACS_UINT tick;
+  Lisp_Object *vals;
+};
+
+struct chartab_flat
+{
+  struct Lisp_Char_Table *table;
+  struct chartab_flat_block *pages[1 << CHARTAB_SIZE_BITS_0];
+};
+
+/* Starts at 1 so that zeroed blocks are stale.  */
+EMACS_UINT chartab_tick = 1;
+
+static struct chartab_flat chartab_flats[CHARTAB_NFLAT];
+
+/* Index of the most recently used, and next evicted, flats.  */
+static int chartab_flat_last, chartab_flat_victim;
+
+/* Return the flat copy of TBL, evicting another if none.  */
+
+static struct chartab_flat *
+chartab_flat (struct Lisp_Char_Table *tbl)
+{
+  for (int i = 0; i < CHARTAB_NFLAT; ++i)
+    if (chartab_flats[i].table == tbl)
+      return &chartab_flats[chartab_flat_last = i];
+
+  struct chartab_flat *flat = &chartab_flats[chartab_flat_victim];
+  for (int i = 0; i < ARRAYELTS (flat->pages); ++i)
+    if (flat->pages[i])
+      {
+	for (int j = 0; j < 1 << CHARTAB_FLAT_PAGE_BITS; ++j)
+	  xfree (flat->pages[i][j].vals);
+	xfree (flat->pages[i]);
+	flat->pages[i] = NULL;
+      }
+  flat->table = tbl;
+  chartab_flat_last = chartab_flat_victim;
+  chartab_flat_victim = (chartab_flat_victim + 1) % CHARTAB_NFLAT;
+  return flat;
+}
+
+/* Fill BLOCK of TABLE, starting at character FROM.  */
+
+static void
+chartab_flat_fill (Lisp_Object table, struct chartab_flat_block *block,
+		   int from)
+{
+  int to = from + (1 << CHARTAB_FLAT_BLOCK_BITS) - 1;
+  if (!block->vals)
+    block->vals = xmalloc (sizeof *block->vals << CHARTAB_FLAT_BLOCK_BITS);
+
+  for (int c = from; c <= to; )
+    {
+      int run_from = c, run_to = to;
+      Lisp_Object val = char_table_ref_and_range (table, c, &run_from, &run_to);
+      for (; c <= run_to; ++c)
+	/* Inherit per character, the parent's runs being its own.  */
+	block->vals[c - from] = (NILP (val) && !NILP (XCHAR_TABLE (table)->parent)
+				 ? char_table_ref (table, c)
+				 : val);
+    }
+
+  /* Filling may uncompress uniprop tables, which changes no value
+     but increments chartab_tick, hence reading it last.  */
+  block->tick = chartab_tick;
+}
+
+/* Return the value of TABLE for C like char_table_ref, but from
+   TABLE's flat copy.  */
+
+Lisp_Object
+char_table_ref_flat (Lisp_Object table, int c)
+{
+  if (current_thread != main_thread)
+    return char_table_ref (table, c);
+
+  struct Lisp_Char_Table *tbl = XCHAR_TABLE (table);
+  struct chartab_flat *flat = &chartab_flats[chartab_flat_last];
+  if (flat->table != tbl)
+    flat = chartab_flat (tbl);
+
+  int page = c >> (CHARTAB_FLAT_PAGE_BITS + CHARTAB_FLAT_BLOCK_BITS);
+  if (!flat->pages[page])
+    flat->pages[page] = xzalloc (sizeof *flat->pages[page]
+				 << CHARTAB_FLAT_PAGE_BITS);
+
+  struct chartab_flat_block *block
+    = &flat->pages[page][(c >> CHARTAB_FLAT_BLOCK_BITS)
+			 & ((1 << CHARTAB_FLAT_PAGE_BITS) - 1)];
+  if (block->tick != chartab_tick)
+    chartab_flat_fill (table, block, c & -(1 << CHARTAB_FLAT_BLOCK_BITS));
+  return block->vals[c & ((1 << CHARTAB_FLAT_BLOCK_BITS) - 1)];
+}
+
+
 static void
 sub_char_table_set (Lisp_Object table, int c, Lisp_Object val, bool is_uniprop)
 {
@@ -5697,6 +5697,7 @@ setup_coding_system (Lisp_Object coding_system, struct coding_system *coding)
   coding->default_char = XFIXNUM (CODING_ATTR_DEFAULT_CHAR (attrs));
   coding->carryover_bytes = 0;
   coding->raw_destination = 0;
+  coding->insert_before_markers = 0;
 
   coding_type = CODING_ATTR_TYPE (attrs);
   if (EQ (coding_type, Qundecided))
@@ -7174,7 +7175,12 @@ produce_chars (struct coding_system *coding, Lisp_Object translation_table,
 
   produced = dst - (coding->destination + coding->produced);
   if (BUFFERP (coding->dst_object) && produced_chars > 0)
-    insert_from_gap (produced_chars, produced, 0);
+    {
+      if (coding->insert_before_markers)
+	insert_from_gap_before_markers (produced_chars, produced, 0);
+      else
+	insert_from_gap (produced_chars, produced, 0);
+    }
   coding->produced += produced;
   coding->produced_char += produced_chars;
   return carryover;
@@ -9578,6 +9584,70 @@ code_convert_string_norecord (Lisp_Object string, Lisp_Object coding_system,
 }
 
 
+/* Return true if encoding the text of the current buffer between
+   FROM and TO (FROM_BYTE and TO_BYTE in bytes) with CODING_SYSTEM
+   would leave its bytes as they are, so that there is no need to
+   encode it.  This is so for ASCII text and a coding system that is
+   compatible with ASCII, as in code_convert_string, and for text
+   without raw bytes and a plain UTF-8 coding system, unless there
+   are newlines to convert.  A nil CODING_SYSTEM means no conversion,
+   as in code_convert_string.  When returning true, and NORECORD is
+   false, set `last-coding-system-used' as encoding the text would.  */
+
+bool
+encoding_unchanged_p (Lisp_Object coding_system,
+		      ptrdiff_t from, ptrdiff_t from_byte,
+		      ptrdiff_t to, ptrdiff_t to_byte, bool norecord)
+{
+  ptrdiff_t gpt_byte = clip_to_bounds (from_byte, GPT_BYTE, to_byte);
+  unsigned char *p1 = BYTE_POS_ADDR (from_byte);
+  unsigned char *p2 = BYTE_POS_ADDR (gpt_byte);
+  ptrdiff_t n1 = gpt_byte - from_byte, n2 = to_byte - gpt_byte;
+  bool newlines = memchr (p1, '\n', n1) || memchr (p2, '\n', n2);
+  Lisp_Object attrs, eol_type, name;
+  ptrdiff_t id;
+
+  if (NILP (coding_system))
+    {
+      if (!norecord)
+	Vlast_coding_system_used = Qno_conversion;
+      return true;
+    }
+
+  CHECK_CODING_SYSTEM_GET_ID (coding_system, id);
+  attrs = CODING_ID_ATTRS (id);
+  eol_type = CODING_ID_EOL_TYPE (id);
+  if (NILP (CODING_ATTR_ASCII_COMPAT (attrs)))
+    return false;
+
+  if (to - from == to_byte - from_byte)
+    {
+      if (!(EQ (eol_type, Qunix) || inhibit_eol_conversion || !newlines))
+	return false;
+      name = coding_system;
+    }
+  else
+    {
+      /* encode_coding_utf_8 leaves alone all characters but raw
+	 bytes, whose multibyte forms start with 0xC0 or 0xC1.  */
+      if (!(EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
+	    && NILP (AREF (attrs, coding_attr_utf_bom))
+	    && NILP (CODING_ATTR_PRE_WRITE (attrs))
+	    && NILP (get_translation_table (attrs, true, NULL))
+	    && (EQ (eol_type, Qunix) || VECTORP (eol_type)
+		|| inhibit_eol_conversion || !newlines)
+	    && !memchr (p1, 0xC0, n1) && !memchr (p1, 0xC1, n1)
+	    && !memchr (p2, 0xC0, n2) && !memchr (p2, 0xC1, n2)))
+	return false;
+      name = CODING_ID_NAME (id);
+    }
+
+  if (!norecord)
+    Vlast_coding_system_used = name;
+  return true;
+}
+
+
 /* Return the gap address of BUFFER.  If the gap size is less than
    NBYTES, enlarge the gap in advance.  */
 
@@ -428,6 +428,10 @@ #define CODING_MODE_SAFE_ENCODING		0x10
   /* Set to true if charbuf contains an annotation.  */
   bool_bf annotated : 1;
 
+  /* True if decoded text inserted into a buffer `dst_object' should
+     be inserted before markers, as by `insert-before-markers'.  */
+  bool_bf insert_before_markers : 1;
+
   /* Used internally in coding.c.  See the comment of detect_ascii.  */
   unsigned eol_seen : 3;
 
@@ -686,6 +690,8 @@ #define UTF_16_LOW_SURROGATE_P(val) \
                                         Lisp_Object, bool, bool, bool);
 extern Lisp_Object code_convert_string_norecord (Lisp_Object, Lisp_Object,
                                                  bool);
+extern bool encoding_unchanged_p (Lisp_Object, ptrdiff_t, ptrdiff_t,
+				  ptrdiff_t, ptrdiff_t, bool);
 extern Lisp_Object encode_string_utf_8 (Lisp_Object, Lisp_Object, bool,
 					Lisp_Object, Lisp_Object);
 extern Lisp_Object decode_string_utf_8 (Lisp_Object, const char *, ptrdiff_t,
@@ -882,7 +882,7 @@ fill_gstring_body (Lisp_Object gstring)
         }
       else
 	{
-	  int width = XFIXNAT (CHAR_TABLE_REF (Vchar_width_table, c));
+	  int width = XFIXNAT (CHAR_TABLE_REF_FLAT (Vchar_width_table, c));
 
 	  LGLYPH_SET_CODE (g, c);
 	  LGLYPH_SET_LBEARING (g, 0);
@@ -1050,7 +1050,7 @@ composition_compute_stop_pos (struct composition_it *cmp_it, ptrdiff_t charpos,
 	  int c = STRINGP (string)
 	    ? fetch_string_char_advance (string, &charpos, &bytepos)
 	    : fetch_char_advance (&charpos, &bytepos);
-	  Lisp_Object val = CHAR_TABLE_REF (Vcomposition_function_table, c);
+	  Lisp_Object val = CHAR_TABLE_REF_FLAT (Vcomposition_function_table, c);
 	  if (c == '\n')
 	    break;
 	  if (!NILP (val))
@@ -345,6 +345,9 @@ DEFUN ("type-of", Ftype_of, Stype_of, 1, 1, 0,
         case PVEC_THREAD: return Qthread;
         case PVEC_MUTEX: return Qmutex;
         case PVEC_CONDVAR: return Qcondition_variable;
+        case PVEC_CHANNEL: return Qchannel;
+        case PVEC_THREAD_POOL: return Qthread_pool;
+        case PVEC_FUTURE: return Qfuture;
         case PVEC_TERMINAL: return Qterminal;
         case PVEC_RECORD:
           {
@@ -3897,6 +3900,9 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qthread, "thread");
   DEFSYM (Qmutex, "mutex");
   DEFSYM (Qcondition_variable, "condition-variable");
+  DEFSYM (Qchannel, "channel");
+  DEFSYM (Qthread_pool, "thread-pool");
+  DEFSYM (Qfuture, "future");
   DEFSYM (Qfont_spec, "font-spec");
   DEFSYM (Qfont_entity, "font-entity");
   DEFSYM (Qfont_object, "font-object");
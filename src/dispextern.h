@@ -1735,6 +1735,10 @@ #define FONT_TOO_HIGH(ft)						\
      attributes except the font.  */
   struct face *ascii_face;
 
+  /* If this face is an ASCII face, the results of face_for_char for
+     non-ASCII characters, allocated on first use.  */
+  struct face_char_cache *char_cache;
+
 #if defined HAVE_XFT || defined HAVE_FREETYPE
 /* Extra member that a font-driver uses privately.  */
   void *extra;
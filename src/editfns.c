@@ -1610,7 +1610,9 @@ make_buffer_string (ptrdiff_t start, ptrdiff_t end, bool props)
 
    If text properties are in use and the current buffer
    has properties in the range specified, the resulting string will also
-   have them, if PROPS is true.
+   have them, if PROPS is true.  Uncooperative threads, which must hold
+   buffer_text_read_lock, neither run fontification hooks nor read
+   intervals, so they get no properties.
 
    We don't want to use plain old make_string here, because it calls
    make_unibyte_string, which can cause the buffer area to be
@@ -1655,7 +1657,7 @@ make_buffer_string_both (ptrdiff_t start, ptrdiff_t start_byte,
     memcpy (SDATA (result) + size, BEG_ADDR + beg1, end1 - beg1);
 
   /* If desired, update and copy the text properties.  */
-  if (props)
+  if (props && current_thread->cooperative)
     {
       update_buffer_properties (start, end);
 
@@ -1709,12 +1711,14 @@ DEFUN ("buffer-substring", Fbuffer_substring, Sbuffer_substring, 2, 2, 0,
   (Lisp_Object start, Lisp_Object end)
 {
   register ptrdiff_t b, e;
+  specpdl_ref count = SPECPDL_INDEX ();
 
+  buffer_text_read_lock (current_buffer);
   validate_region (&start, &end);
   b = XFIXNUM (start);
   e = XFIXNUM (end);
 
-  return make_buffer_string (b, e, 1);
+  return unbind_to (count, make_buffer_string (b, e, 1));
 }
 
 DEFUN ("buffer-substring-no-properties", Fbuffer_substring_no_properties,
@@ -1725,12 +1729,14 @@ DEFUN ("buffer-substring-no-properties", Fbuffer_substring_no_properties,
   (Lisp_Object start, Lisp_Object end)
 {
   register ptrdiff_t b, e;
+  specpdl_ref count = SPECPDL_INDEX ();
 
+  buffer_text_read_lock (current_buffer);
   validate_region (&start, &end);
   b = XFIXNUM (start);
   e = XFIXNUM (end);
 
-  return make_buffer_string (b, e, 0);
+  return unbind_to (count, make_buffer_string (b, e, 0));
 }
 
 DEFUN ("buffer-string", Fbuffer_string, Sbuffer_string, 0, 0, 0,
@@ -1743,7 +1749,10 @@ DEFUN ("buffer-string", Fbuffer_string, Sbuffer_string, 0, 0, 0,
 use `buffer-substring-no-properties' instead.  */)
   (void)
 {
-  return make_buffer_string_both (BEGV, BEGV_BYTE, ZV, ZV_BYTE, 1);
+  specpdl_ref count = SPECPDL_INDEX ();
+  buffer_text_read_lock (current_buffer);
+  return unbind_to (count,
+		    make_buffer_string_both (BEGV, BEGV_BYTE, ZV, ZV_BYTE, 1));
 }
 
 DEFUN ("insert-buffer-substring", Finsert_buffer_substring, Sinsert_buffer_substring,
@@ -2276,6 +2276,9 @@ main (int argc, char **argv)
       syms_of_sound ();
 #endif
       syms_of_textprop ();
+      syms_of_ansi ();
+      syms_of_nov ();
+      syms_of_imap ();
       syms_of_composite ();
 #ifdef WINDOWSNT
       syms_of_ntproc ();
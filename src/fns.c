@@ -19,6 +19,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 
 #include <config.h>
 
+#include <fcntl.h>
 #include <stdlib.h>
 #include <sys/random.h>
 #include <unistd.h>
@@ -38,6 +39,7 @@ Copyright (C) 1985-2024 Free Software Foundation, Inc.
 #include "window.h"
 #include "puresize.h"
 #include "gnutls.h"
+#include "pdumper.h"
 
 enum equal_kind { EQUAL_NO_QUIT, EQUAL_PLAIN, EQUAL_INCLUDING_PROPERTIES };
 static bool internal_equal (Lisp_Object, Lisp_Object,
@@ -266,6 +268,174 @@ DEFUN ("string-bytes", Fstring_bytes, Sstring_bytes, 1, 1, 0,
   return make_fixnum (SBYTES (string));
 }
 
+/* Levenshtein distance.  The strings compared are turned into arrays
+   of "symbols", which are their characters, or their bytes when
+   comparing bytes.  The distance from a pattern of up to
+   DISTANCE_PATTERN_MAX symbols is computed with the bit-parallel
+   algorithm of Myers, as reformulated by Hyyrö; longer strings fall
+   back on dynamic programming, confined to a diagonal band when the
+   distance is bounded.  */
+
+enum { DISTANCE_PATTERN_MAX = 64 };
+
+/* The symbols of a pattern, as bit masks of the positions where each
+   symbol occurs in it.  */
+
+struct distance_pattern
+{
+  ptrdiff_t len;
+  uint_least64_t byte_eq[UCHAR_MAX + 1];
+  int nchars;
+  int chars[DISTANCE_PATTERN_MAX];
+  uint_least64_t char_eq[DISTANCE_PATTERN_MAX];
+};
+
+/* Store into *SYMBOLS the symbols of STRING, its bytes if BYTES,
+   else its characters, and return their number.  */
+
+static ptrdiff_t
+distance_symbols (Lisp_Object string, bool bytes, int *symbols)
+{
+  if (bytes)
+    {
+      ptrdiff_t nbytes = SBYTES (string);
+      for (ptrdiff_t i = 0; i < nbytes; i++)
+	symbols[i] = SREF (string, i);
+      return nbytes;
+    }
+
+  ptrdiff_t nchars = SCHARS (string), i = 0, i_byte = 0;
+  for (ptrdiff_t n = 0; n < nchars; n++)
+    symbols[n] = fetch_string_char_advance (string, &i, &i_byte);
+  return nchars;
+}
+
+/* Set up P for the LEN <= DISTANCE_PATTERN_MAX symbols at A.  */
+
+static void
+init_distance_pattern (struct distance_pattern *p, int const *a,
+		       ptrdiff_t len)
+{
+  p->len = len;
+  p->nchars = 0;
+  memset (p->byte_eq, 0, sizeof p->byte_eq);
+  for (ptrdiff_t i = 0; i < len; i++)
+    {
+      uint_least64_t bit = (uint_least64_t) 1 << i;
+      if (a[i] <= UCHAR_MAX)
+	p->byte_eq[a[i]] |= bit;
+      else
+	{
+	  int j;
+	  for (j = 0; j < p->nchars && p->chars[j] != a[i]; j++)
+	    continue;
+	  if (j == p->nchars)
+	    {
+	      p->chars[p->nchars++] = a[i];
+	      p->char_eq[j] = 0;
+	    }
+	  p->char_eq[j] |= bit;
+	}
+    }
+}
+
+static uint_least64_t
+distance_pattern_eq (struct distance_pattern const *p, int c)
+{
+  if (c <= UCHAR_MAX)
+    return p->byte_eq[c];
+  for (int j = 0; j < p->nchars; j++)
+    if (p->chars[j] == c)
+      return p->char_eq[j];
+  return 0;
+}
+
+/* Return the distance between the nonempty pattern P and the N
+   symbols at B, or BOUND + 1 if it exceeds BOUND.  */
+
+static ptrdiff_t
+bit_parallel_distance (struct distance_pattern const *p,
+		       int const *b, ptrdiff_t n, ptrdiff_t bound)
+{
+  uint_least64_t pv = -1, mv = 0;
+  uint_least64_t last = (uint_least64_t) 1 << (p->len - 1);
+  ptrdiff_t score = p->len;
+
+  for (ptrdiff_t j = 0; j < n; j++)
+    {
+      uint_least64_t eq = distance_pattern_eq (p, b[j]);
+      uint_least64_t xv = eq | mv;
+      uint_least64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+      uint_least64_t ph = mv | ~(xh | pv);
+      uint_least64_t mh = pv & xh;
+      if (ph & last)
+	score++;
+      else if (mh & last)
+	score--;
+      /* Each remaining symbol of B can lower the score by one.  */
+      if (bound < score - (n - 1 - j))
+	return bound + 1;
+      ph = (ph << 1) | 1;
+      mh <<= 1;
+      pv = mh | ~(xv | ph);
+      mv = ph & xv;
+    }
+  return score;
+}
+
+/* Return the distance between the M symbols at A and the N symbols
+   at B, or BOUND + 1 if it exceeds BOUND, using COLUMN, which has room
+   for M + 1 elements.  Only cells within BOUND of the diagonal are
+   computed, since no path cheaper than BOUND leaves that band.  */
+
+static ptrdiff_t
+banded_distance (int const *a, ptrdiff_t m, int const *b, ptrdiff_t n,
+		 ptrdiff_t bound, ptrdiff_t *column)
+{
+  ptrdiff_t band = min (bound, max (m, n));
+  ptrdiff_t far = max (m, n) + 1;
+
+  for (ptrdiff_t y = 0; y <= m; y++)
+    column[y] = y <= band ? y : far;
+
+  for (ptrdiff_t x = 1; x <= n; x++)
+    {
+      ptrdiff_t lo = max (1, x - band), hi = min (m, x + band);
+      ptrdiff_t lastdiag = column[lo - 1], best;
+      column[lo - 1] = lo == 1 ? x : far;
+      best = column[lo - 1];
+      for (ptrdiff_t y = lo; y <= hi; y++)
+	{
+	  ptrdiff_t olddiag = column[y];
+	  column[y] = min (min (column[y] + 1, column[y - 1] + 1),
+			   lastdiag + (a[y - 1] != b[x - 1]));
+	  lastdiag = olddiag;
+	  best = min (best, column[y]);
+	}
+      if (bound < best)
+	return bound + 1;
+    }
+  return min (column[m], bound + 1);
+}
+
+/* Return the distance between the M symbols at A and the N symbols
+   at B, or BOUND + 1 if it exceeds BOUND.  P is the pattern for A, or
+   null if A is too long for one.  COLUMN is as for banded_distance.  */
+
+static ptrdiff_t
+symbols_distance (struct distance_pattern const *p,
+		  int const *a, ptrdiff_t m, int const *b, ptrdiff_t n,
+		  ptrdiff_t bound, ptrdiff_t *column)
+{
+  if (bound < eabs (m - n))
+    return bound + 1;
+  if (m == 0 || n == 0)
+    return max (m, n);
+  if (p)
+    return bit_parallel_distance (p, b, n, bound);
+  return banded_distance (a, m, b, n, bound, column);
+}
+
 DEFUN ("string-distance", Fstring_distance, Sstring_distance, 2, 3, 0,
        doc: /* Return Levenshtein distance between STRING1 and STRING2.
 The distance is the number of deletions, insertions, and substitutions
@@ -284,52 +454,158 @@ DEFUN ("string-distance", Fstring_distance, Sstring_distance, 2, 3, 0,
     || (!STRING_MULTIBYTE (string1) && !STRING_MULTIBYTE (string2));
   ptrdiff_t len1 = use_byte_compare ? SBYTES (string1) : SCHARS (string1);
   ptrdiff_t len2 = use_byte_compare ? SBYTES (string2) : SCHARS (string2);
-  ptrdiff_t x, y, lastdiag, olddiag;
+  struct distance_pattern pattern, *p = NULL;
 
   USE_SAFE_ALLOCA;
-  ptrdiff_t *column = SAFE_ALLOCA ((len1 + 1) * sizeof (ptrdiff_t));
-  for (y = 0; y <= len1; y++)
-    column[y] = y;
+  int *s1, *s2;
+  ptrdiff_t *column;
+  SAFE_NALLOCA (s1, 1, len1);
+  SAFE_NALLOCA (s2, 1, len2);
+  distance_symbols (string1, use_byte_compare, s1);
+  distance_symbols (string2, use_byte_compare, s2);
+
+  /* The distance is symmetric, so make the shorter string the pattern.  */
+  if (len2 < len1)
+    {
+      int *s = s1; s1 = s2; s2 = s;
+      ptrdiff_t len = len1; len1 = len2; len2 = len;
+    }
+  if (len1 <= DISTANCE_PATTERN_MAX)
+    init_distance_pattern (p = &pattern, s1, len1);
+  SAFE_NALLOCA (column, 1, len1 + 1);
 
-  if (use_byte_compare)
+  ptrdiff_t distance = symbols_distance (p, s1, len1, s2, len2,
+					 PTRDIFF_MAX - 1, column);
+  SAFE_FREE ();
+  return make_fixnum (distance);
+}
+
+/* Return the string that stands for ELT, a candidate of
+   `string-distance-nearest'.  */
+
+static Lisp_Object
+distance_candidate (Lisp_Object elt)
+{
+  if (SYMBOLP (elt))
+    return SYMBOL_NAME (elt);
+  CHECK_STRING (elt);
+  return elt;
+}
+
+DEFUN ("string-distance-nearest", Fstring_distance_nearest,
+       Sstring_distance_nearest, 2, 5, 0,
+       doc: /* Return the elements of CANDIDATES nearest to STRING.
+CANDIDATES is a list or vector of strings or symbols, whose names are
+used.  The value is a list of at most COUNT of them, nearest first,
+where nearness is the Levenshtein distance that `string-distance'
+computes.  Candidates at the same distance are in the order they have
+in CANDIDATES.  COUNT defaults to 1.
+
+If MAX-DISTANCE is non-nil, it should be a natural number, and only
+candidates whose distance from STRING is at most MAX-DISTANCE are
+returned.  BYTECOMPARE is as in `string-distance'.
+
+This is much faster than calling `string-distance' for each
+candidate, especially when COUNT or MAX-DISTANCE is small, since it
+stops measuring a candidate as soon as it is known not to qualify.  */)
+  (Lisp_Object string, Lisp_Object candidates, Lisp_Object count,
+   Lisp_Object max_distance, Lisp_Object bytecompare)
+{
+  CHECK_STRING (string);
+  EMACS_INT k = 1;
+  if (!NILP (count))
+    {
+      CHECK_FIXNAT (count);
+      k = XFIXNAT (count);
+    }
+  ptrdiff_t bound = PTRDIFF_MAX - 1;
+  if (!NILP (max_distance))
     {
-      char *s1 = SSDATA (string1);
-      char *s2 = SSDATA (string2);
+      CHECK_FIXNAT (max_distance);
+      bound = min (bound, XFIXNAT (max_distance));
+    }
+  bool bytes = !NILP (bytecompare);
 
-      for (x = 1; x <= len2; x++)
-        {
-          column[0] = x;
-          for (y = 1, lastdiag = x - 1; y <= len1; y++)
-            {
-              olddiag = column[y];
-              column[y] = min (min (column[y] + 1, column[y-1] + 1),
-			       lastdiag + (s1[y-1] == s2[x-1] ? 0 : 1));
-              lastdiag = olddiag;
-            }
-        }
+  /* Check the candidates, and find how much room their symbols need.  */
+  ptrdiff_t ncandidates = 0, longest = 0;
+  Lisp_Object vector = Qnil, tail = candidates;
+  if (VECTORP (candidates))
+    {
+      vector = candidates;
+      ncandidates = ASIZE (vector);
+      for (ptrdiff_t i = 0; i < ncandidates; i++)
+	longest = max (longest, SBYTES (distance_candidate (AREF (vector, i))));
     }
   else
     {
-      int c1, c2;
-      ptrdiff_t i1, i1_byte, i2 = 0, i2_byte = 0;
-      for (x = 1; x <= len2; x++)
-        {
-          column[0] = x;
-          c2 = fetch_string_char_advance (string2, &i2, &i2_byte);
-          i1 = i1_byte = 0;
-          for (y = 1, lastdiag = x - 1; y <= len1; y++)
-            {
-              olddiag = column[y];
-              c1 = fetch_string_char_advance (string1, &i1, &i1_byte);
-              column[y] = min (min (column[y] + 1, column[y-1] + 1),
-			       lastdiag + (c1 == c2 ? 0 : 1));
-              lastdiag = olddiag;
-            }
-        }
+      FOR_EACH_TAIL (tail)
+	{
+	  longest = max (longest, SBYTES (distance_candidate (XCAR (tail))));
+	  ncandidates++;
+	}
+      CHECK_LIST_END (tail, candidates);
+      tail = candidates;
     }
+  k = min (k, ncandidates);
+  if (k == 0)
+    return Qnil;
 
+  USE_SAFE_ALLOCA;
+  ptrdiff_t m = bytes ? SBYTES (string) : SCHARS (string);
+  int *a, *b;
+  ptrdiff_t *column, *best_distance;
+  Lisp_Object *best;
+  SAFE_NALLOCA (a, 1, m);
+  SAFE_NALLOCA (b, 1, longest);
+  SAFE_NALLOCA (column, 1, m + 1);
+  SAFE_NALLOCA (best_distance, 1, k);
+  SAFE_ALLOCA_LISP (best, k);
+  distance_symbols (string, bytes, a);
+
+  struct distance_pattern pattern, *p = NULL;
+  if (m <= DISTANCE_PATTERN_MAX)
+    init_distance_pattern (p = &pattern, a, m);
+
+  ptrdiff_t nbest = 0;
+  for (ptrdiff_t i = 0; i < ncandidates; i++)
+    {
+      Lisp_Object elt;
+      if (NILP (vector))
+	{
+	  elt = XCAR (tail);
+	  tail = XCDR (tail);
+	}
+      else
+	elt = AREF (vector, i);
+      rarely_quit (i);
+
+      /* A candidate must be nearer than the farthest of K found so
+	 far, since ties go to the earlier one.  */
+      ptrdiff_t limit = (nbest < k ? bound
+			 : min (bound, best_distance[k - 1] - 1));
+      if (limit < 0)
+	break;
+
+      Lisp_Object str = distance_candidate (elt);
+      ptrdiff_t n = distance_symbols (str, bytes, b);
+      ptrdiff_t d = symbols_distance (p, a, m, b, n, limit, column);
+      if (limit < d)
+	continue;
+
+      ptrdiff_t j = min (nbest, k - 1);
+      for (; 0 < j && d < best_distance[j - 1]; j--)
+	{
+	  best_distance[j] = best_distance[j - 1];
+	  best[j] = best[j - 1];
+	}
+      best_distance[j] = d;
+      best[j] = elt;
+      nbest = min (nbest + 1, k);
+    }
+
+  Lisp_Object result = Flist (nbest, best);
   SAFE_FREE ();
-  return make_fixnum (column[len1]);
+  return result;
 }
 
 DEFUN ("string-equal", Fstring_equal, Sstring_equal, 2, 2, 0,
@@ -2335,13 +2611,14 @@ DEFUN ("reverse", Freverse, Sreverse, 1, 1, 0,
 }
 
 
-/* Stably sort LIST ordered by PREDICATE using the TIMSORT
-   algorithm.  This converts the list to a vector, sorts the vector,
-   and returns the result converted back to a list.  The input list
-   is destructively reused to hold the sorted result.  */
+/* Stably sort LIST ordered by PREDICATE, applied to the result of
+   KEY if non-nil, using the TIMSORT algorithm.  This converts the
+   list to a vector, sorts the vector, and returns the result
+   converted back to a list.  The input list is destructively reused
+   to hold the sorted result.  */
 
 static Lisp_Object
-sort_list (Lisp_Object list, Lisp_Object predicate)
+sort_list (Lisp_Object list, Lisp_Object predicate, Lisp_Object key)
 {
   ptrdiff_t length = list_length (list);
   if (length < 2)
@@ -2357,7 +2634,7 @@ sort_list (Lisp_Object list, Lisp_Object predicate)
 	  result[i] = Fcar (tail);
 	  tail = XCDR (tail);
 	}
-      tim_sort (predicate, result, length);
+      tim_sort (predicate, key, result, length);
 
       ptrdiff_t i = 0;
       tail = list;
@@ -2372,31 +2649,38 @@ sort_list (Lisp_Object list, Lisp_Object predicate)
     }
 }
 
-/* Stably sort VECTOR ordered by PREDICATE using the TIMSORT
-   algorithm.  */
+/* Stably sort VECTOR ordered by PREDICATE, applied to the result of
+   KEY if non-nil, using the TIMSORT algorithm.  */
 
 static void
-sort_vector (Lisp_Object vector, Lisp_Object predicate)
+sort_vector (Lisp_Object vector, Lisp_Object predicate, Lisp_Object key)
 {
   ptrdiff_t length = ASIZE (vector);
   if (length < 2)
     return;
 
-  tim_sort (predicate, XVECTOR (vector)->contents, length);
+  tim_sort (predicate, key, XVECTOR (vector)->contents, length);
 }
 
-DEFUN ("sort", Fsort, Ssort, 2, 2, 0,
+DEFUN ("sort", Fsort, Ssort, 2, 3, 0,
        doc: /* Sort SEQ, stably, comparing elements using PREDICATE.
 Returns the sorted sequence.  SEQ should be a list or vector.  SEQ is
 modified by side effects.  PREDICATE is called with two elements of
 SEQ, and should return non-nil if the first element should sort before
-the second.  */)
-  (Lisp_Object seq, Lisp_Object predicate)
+the second.
+
+If KEY is non-nil, it is a function of one argument, called exactly
+once on each element of SEQ.  PREDICATE then compares the values
+returned by KEY rather than the elements themselves.
+
+Sorting is fastest when PREDICATE is `<', `>' or `string<', which are
+compared without calling them.  */)
+  (Lisp_Object seq, Lisp_Object predicate, Lisp_Object key)
 {
   if (CONSP (seq))
-    seq = sort_list (seq, predicate);
+    seq = sort_list (seq, predicate, key);
   else if (VECTORP (seq))
-    sort_vector (seq, predicate);
+    sort_vector (seq, predicate, key);
   else if (!NILP (seq))
     wrong_type_argument (Qlist_or_vector_p, seq);
   return seq;
@@ -3629,7 +3913,7 @@ #define MIME_LINE_LENGTH 76
 
 /* Tables of base64 values for bytes.  -1 means ignorable, 0 invalid,
    positive means 1 + the represented value.  */
-static signed char const base64_char_to_value[2][UCHAR_MAX] =
+static signed char const base64_char_to_value[2][UCHAR_MAX + 1] =
 {
  /* base64 */
  {
@@ -3685,6 +3969,124 @@ #define MIME_LINE_LENGTH 76
    The octets are divided into 6 bit chunks, which are then encoded into
    base64 characters.  */
 
+/* Tables for encoding twelve bits at a time, and for decoding a whole
+   quadruplet at a time.  BASE64_PAIRS[URL][V] are the two characters
+   coding the 12-bit value V.  BASE64_QUADS[URL][I][C] is the value of
+   byte C as the Ith character of a quadruplet, shifted into place, or
+   BASE64_INVALID if C is padding, ignorable or invalid, so that the
+   slower code deals with it.  */
+
+enum { BASE64_INVALID = 1 << 24 };
+static char base64_pairs[2][1 << 12][2];
+static unsigned int base64_quads[2][4][UCHAR_MAX + 1];
+
+static void
+init_base64_tables (void)
+{
+  for (int url = 0; url < 2; url++)
+    {
+      for (int v = 0; v < 1 << 12; v++)
+	{
+	  base64_pairs[url][v][0] = base64_value_to_char[url][v >> 6];
+	  base64_pairs[url][v][1] = base64_value_to_char[url][v & 0x3f];
+	}
+      for (int c = 0; c <= UCHAR_MAX; c++)
+	{
+	  int v = base64_char_to_value[url][c];
+	  for (int i = 0; i < 4; i++)
+	    base64_quads[url][i][c] = (v <= 0 ? BASE64_INVALID
+				       : (v - 1u) << (18 - 6 * i));
+	}
+    }
+}
+
+/* Return the length of the base64 encoding of LENGTH bytes.  */
+
+static ptrdiff_t
+base64_encoded_length (ptrdiff_t length, bool line_break, bool pad)
+{
+  ptrdiff_t triplets = length / 3 + (length % 3 != 0);
+  ptrdiff_t encoded = (pad ? 4 * triplets
+		       : length / 3 * 4 + (length % 3 ? length % 3 + 1 : 0));
+  if (line_break && triplets)
+    encoded += (triplets - 1) / (MIME_LINE_LENGTH / 4);
+  return encoded;
+}
+
+/* Replace the text between FROM and TO of the current buffer, which
+   is just after the gap, by the NCHARS characters of NBYTES bytes at
+   the start of the gap.  Markers within the text, or at its end, end
+   up after the new text, as if it had been inserted before the old
+   text was deleted.  The modification hooks have been run already.  */
+
+static void
+replace_region_from_gap (ptrdiff_t from, ptrdiff_t from_byte,
+			 ptrdiff_t to, ptrdiff_t to_byte,
+			 ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  bool inhibit_shrinking = current_buffer->text->inhibit_shrinking;
+  bool need_marker_adjustment = false;
+  struct Lisp_Marker *tail;
+
+  eassert (GPT_BYTE == from_byte);
+  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
+    {
+      tail->need_adjustment = from < tail->charpos && tail->charpos <= to;
+      need_marker_adjustment |= tail->need_adjustment;
+    }
+
+  /* Stop the deletion from anchoring the gap over the new text.  */
+  current_buffer->text->inhibit_shrinking = true;
+  del_range_2 (from, from_byte, to, to_byte, false);
+  current_buffer->text->inhibit_shrinking = inhibit_shrinking;
+  insert_from_gap (nchars, nbytes, false);
+
+  if (need_marker_adjustment)
+    for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
+      if (tail->need_adjustment)
+	{
+	  tail->need_adjustment = false;
+	  tail->charpos = from + nchars;
+	  tail->bytepos = from_byte + nbytes;
+	}
+
+  signal_after_change (from, to - from, nchars);
+  update_compositions (from, from + nchars, CHECK_BORDER);
+}
+
+static void
+unwind_inhibit_shrinking (void *ptr)
+{
+  struct buffer *b = ptr;
+  b->text->inhibit_shrinking = false;
+}
+
+/* Run the before-change hooks for replacing the region between *BEG
+   and *END, whose replacement has been put at the start of the gap,
+   just before the region.  Validate the region again afterwards.
+   Return true if the replacement is still there, false if the hooks
+   changed the text and it has to be made again.  */
+
+static bool
+prepare_to_replace_from_gap (Lisp_Object *beg, Lisp_Object *end)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  ptrdiff_t gpt = GPT, gap_size = GAP_SIZE;
+  modiff_count chars_modiff = CHARS_MODIFF;
+
+  /* Keep a collection from shrinking the gap.  */
+  if (!current_buffer->text->inhibit_shrinking)
+    {
+      record_unwind_protect_ptr (unwind_inhibit_shrinking, current_buffer);
+      current_buffer->text->inhibit_shrinking = true;
+    }
+  prepare_to_modify_buffer (XFIXNAT (*beg), XFIXNAT (*end), NULL);
+  unbind_to (count, Qnil);
+  validate_region (beg, end);
+  return (CHARS_MODIFF == chars_modiff && GPT == gpt
+	  && GAP_SIZE == gap_size && XFIXNAT (*beg) == gpt);
+}
+
 
 static ptrdiff_t base64_encode_1 (const char *, char *, ptrdiff_t, bool, bool,
 				  bool, bool);
@@ -3728,50 +4130,60 @@ DEFUN ("base64url-encode-region", Fbase64url_encode_region, Sbase64url_encode_re
   return base64_encode_region_1 (beg, end, false, NILP(no_pad), true);
 }
 
+/* Encode the region between BEG and END, which has been validated,
+   into the gap, which is moved to just before it.  Each character of
+   the text codes one byte of data.  Return the length of the
+   encoding.  */
+
+static ptrdiff_t
+base64_encode_region_to_gap (Lisp_Object beg, Lisp_Object end,
+			     bool line_break, bool pad, bool base64url)
+{
+  ptrdiff_t ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
+  ptrdiff_t iend = CHAR_TO_BYTE (XFIXNAT (end));
+  ptrdiff_t allength = base64_encoded_length (XFIXNAT (end) - XFIXNAT (beg),
+					      line_break, pad);
+  move_gap (XFIXNAT (beg), ibeg);
+  if (GAP_SIZE < allength)
+    make_gap (allength - GAP_SIZE);
+  ptrdiff_t encoded_length
+    = base64_encode_1 ((char *) GAP_END_ADDR, (char *) GAP_BEG_ADDR,
+		       iend - ibeg, line_break, pad, base64url,
+		       !NILP (BVAR (current_buffer, enable_multibyte_characters)));
+  if (encoded_length < 0)
+    {
+      /* The encoding wasn't possible. */
+      error ("Multibyte character in data for base64 encoding");
+    }
+  if (encoded_length != allength)
+    emacs_abort ();
+  return encoded_length;
+}
+
 static Lisp_Object
 base64_encode_region_1 (Lisp_Object beg, Lisp_Object end, bool line_break,
 			bool pad, bool base64url)
 {
-  char *encoded;
-  ptrdiff_t allength, length;
   ptrdiff_t ibeg, iend, encoded_length;
   ptrdiff_t old_pos = PT;
-  USE_SAFE_ALLOCA;
 
   validate_region (&beg, &end);
-
+  if (XFIXNAT (beg) == XFIXNAT (end))
+    return make_fixnum (0);
+
+  /* Encode before running any hook, so that text that cannot be
+     encoded leaves the buffer alone.  */
+  encoded_length = base64_encode_region_to_gap (beg, end, line_break,
+						pad, base64url);
+  if (!prepare_to_replace_from_gap (&beg, &end))
+    encoded_length = base64_encode_region_to_gap (beg, end, line_break,
+						  pad, base64url);
   ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
   iend = CHAR_TO_BYTE (XFIXNAT (end));
-  move_gap (XFIXNAT (beg), ibeg);
 
-  /* We need to allocate enough room for encoding the text.
-     We need 33 1/3% more space, plus a newline every 76
-     characters, and then we round up. */
-  length = iend - ibeg;
-  allength = length + length/3 + 1;
-  allength += allength / MIME_LINE_LENGTH + 1 + 6;
-
-  encoded = SAFE_ALLOCA (allength);
-  encoded_length = base64_encode_1 ((char *) BYTE_POS_ADDR (ibeg),
-				    encoded, length, line_break,
-				    pad, base64url,
-				    !NILP (BVAR (current_buffer, enable_multibyte_characters)));
-  if (encoded_length > allength)
-    emacs_abort ();
-
-  if (encoded_length < 0)
-    {
-      /* The encoding wasn't possible. */
-      SAFE_FREE ();
-      error ("Multibyte character in data for base64 encoding");
-    }
-
-  /* Now we have encoded the region, so we insert the new contents
-     and delete the old.  (Insert first in order to preserve markers.)  */
-  SET_PT_BOTH (XFIXNAT (beg), ibeg);
-  insert (encoded, encoded_length);
-  SAFE_FREE ();
-  del_range_byte (ibeg + encoded_length, iend + encoded_length);
+  /* Now replace the old contents by the encoded ones.  */
+  replace_region_from_gap (XFIXNAT (beg), ibeg, XFIXNAT (end), iend,
+			   encoded_length, encoded_length);
 
   /* If point was outside of the region, restore it exactly; else just
      move to the beginning of the region.  */
@@ -3812,38 +4224,27 @@ DEFUN ("base64url-encode-string", Fbase64url_encode_string,
 base64_encode_string_1 (Lisp_Object string, bool line_break,
 			bool pad, bool base64url)
 {
-  ptrdiff_t allength, length, encoded_length;
-  char *encoded;
+  ptrdiff_t allength, encoded_length;
   Lisp_Object encoded_string;
-  USE_SAFE_ALLOCA;
 
   CHECK_STRING (string);
 
-  /* We need to allocate enough room for encoding the text.
-     We need 33 1/3% more space, plus a newline every 76
-     characters, and then we round up. */
-  length = SBYTES (string);
-  allength = length + length/3 + 1;
-  allength += allength / MIME_LINE_LENGTH + 1 + 6;
-
-  /* We need to allocate enough room for decoding the text. */
-  encoded = SAFE_ALLOCA (allength);
+  /* Each character of STRING codes one byte of data, so the length
+     of the result is known in advance: encode right into it.  */
+  allength = base64_encoded_length (SCHARS (string), line_break, pad);
+  encoded_string = make_unibyte_string (NULL, allength);
 
   encoded_length = base64_encode_1 (SSDATA (string),
-				    encoded, length, line_break,
-				    pad, base64url,
+				    SSDATA (encoded_string), SBYTES (string),
+				    line_break, pad, base64url,
 				    STRING_MULTIBYTE (string));
-  if (encoded_length > allength)
-    emacs_abort ();
-
   if (encoded_length < 0)
     {
       /* The encoding wasn't possible. */
       error ("Multibyte character in data for base64 encoding");
     }
-
-  encoded_string = make_unibyte_string (encoded, encoded_length);
-  SAFE_FREE ();
+  if (encoded_length != allength)
+    emacs_abort ();
 
   return encoded_string;
 }
@@ -3861,8 +4262,39 @@ base64_encode_1 (const char *from, char *to, ptrdiff_t length,
   int bytes;
   char const *b64_value_to_char = base64_value_to_char[base64url];
 
+  char const (*b64_pairs)[2] = base64_pairs[base64url];
+
   while (i < length)
     {
+      /* Encode whole triplets of single-byte characters twelve bits
+	 at a time, up to the end of the line.  */
+
+      if (line_break && counter == MIME_LINE_LENGTH / 4)
+	{
+	  *e++ = '\n';
+	  counter = 0;
+	}
+
+      ptrdiff_t triplets = (length - i) / 3;
+      if (line_break)
+	triplets = min (triplets, MIME_LINE_LENGTH / 4 - counter);
+      unsigned char const *f = (unsigned char const *) from + i;
+      unsigned char const *flim = f + 3 * triplets;
+      for (; f < flim; f += 3, e += 4)
+	{
+	  if (multibyte && (f[0] | f[1] | f[2]) & 0x80)
+	    break;
+	  value = f[0] << 16 | f[1] << 8 | f[2];
+	  memcpy (e, b64_pairs[value >> 12], 2);
+	  memcpy (e + 2, b64_pairs[value & 0xfff], 2);
+	}
+      if (f != (unsigned char const *) from + i)
+	{
+	  counter += (f - ((unsigned char const *) from + i)) / 3;
+	  i = f - (unsigned char const *) from;
+	  continue;
+	}
+
       if (multibyte)
 	{
 	  c = string_char_and_length ((unsigned char *) from + i, &bytes);
@@ -3951,6 +4383,40 @@ base64_encode_1 (const char *from, char *to, ptrdiff_t length,
 }
 
 
+/* Decode the region between BEG and END, which has been validated,
+   into the gap, which is moved to just before it.  Return the length
+   of the decoded data and store its number of characters in
+   *INSERTED_CHARS.  */
+
+static ptrdiff_t
+base64_decode_region_to_gap (Lisp_Object beg, Lisp_Object end,
+			     bool base64url, bool ignore_invalid,
+			     ptrdiff_t *inserted_chars)
+{
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  ptrdiff_t ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
+  ptrdiff_t length = CHAR_TO_BYTE (XFIXNAT (end)) - ibeg;
+
+  /* If we are working on a multibyte buffer, each decoded code may
+     occupy at most two bytes.  */
+  ptrdiff_t allength = multibyte ? length * 2 : length;
+  move_gap (XFIXNAT (beg), ibeg);
+  if (GAP_SIZE < allength)
+    make_gap (allength - GAP_SIZE);
+  ptrdiff_t decoded_length
+    = base64_decode_1 ((char *) GAP_END_ADDR, (char *) GAP_BEG_ADDR, length,
+		       base64url, multibyte, ignore_invalid, inserted_chars);
+  if (decoded_length > allength)
+    emacs_abort ();
+
+  if (decoded_length < 0)
+    {
+      /* The decoding wasn't possible. */
+      error ("Invalid base64 data");
+    }
+  return decoded_length;
+}
+
 DEFUN ("base64-decode-region", Fbase64_decode_region, Sbase64_decode_region,
        2, 4, "r",
        doc: /* Base64-decode the region between BEG and END.
@@ -3969,51 +4435,31 @@ DEFUN ("base64-decode-region", Fbase64_decode_region, Sbase64_decode_region,
      (Lisp_Object beg, Lisp_Object end, Lisp_Object base64url,
       Lisp_Object ignore_invalid)
 {
-  ptrdiff_t ibeg, iend, length, allength;
-  char *decoded;
+  ptrdiff_t ibeg, iend;
   ptrdiff_t old_pos = PT;
   ptrdiff_t decoded_length;
   ptrdiff_t inserted_chars;
-  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
-  USE_SAFE_ALLOCA;
 
   validate_region (&beg, &end);
-
+  if (XFIXNAT (beg) == XFIXNAT (end))
+    return make_fixnum (0);
+
+  /* Decode before running any hook, so that invalid data leaves the
+     buffer alone.  */
+  decoded_length = base64_decode_region_to_gap (beg, end, !NILP (base64url),
+						!NILP (ignore_invalid),
+						&inserted_chars);
+  if (!prepare_to_replace_from_gap (&beg, &end))
+    decoded_length = base64_decode_region_to_gap (beg, end,
+						  !NILP (base64url),
+						  !NILP (ignore_invalid),
+						  &inserted_chars);
   ibeg = CHAR_TO_BYTE (XFIXNAT (beg));
   iend = CHAR_TO_BYTE (XFIXNAT (end));
 
-  length = iend - ibeg;
-
-  /* We need to allocate enough room for decoding the text.  If we are
-     working on a multibyte buffer, each decoded code may occupy at
-     most two bytes.  */
-  allength = multibyte ? length * 2 : length;
-  decoded = SAFE_ALLOCA (allength);
-
-  move_gap (XFIXNAT (beg), ibeg);
-  decoded_length = base64_decode_1 ((char *) BYTE_POS_ADDR (ibeg),
-				    decoded, length, !NILP (base64url),
-				    multibyte, !NILP (ignore_invalid),
-				    &inserted_chars);
-  if (decoded_length > allength)
-    emacs_abort ();
-
-  if (decoded_length < 0)
-    {
-      /* The decoding wasn't possible. */
-      error ("Invalid base64 data");
-    }
-
-  /* Now we have decoded the region, so we insert the new contents
-     and delete the old.  (Insert first in order to preserve markers.)  */
-  TEMP_SET_PT_BOTH (XFIXNAT (beg), ibeg);
-  insert_1_both (decoded, inserted_chars, decoded_length, 0, 1, 0);
-  signal_after_change (XFIXNAT (beg), 0, inserted_chars);
-  SAFE_FREE ();
-
-  /* Delete the original text.  */
-  del_range_both (PT, PT_BYTE, XFIXNAT (end) + inserted_chars,
-		  iend + decoded_length, 1);
+  /* Now replace the old contents by the decoded ones.  */
+  replace_region_from_gap (XFIXNAT (beg), ibeg, XFIXNAT (end), iend,
+			   inserted_chars, decoded_length);
 
   /* If point was outside of the region, restore it exactly; else just
      move to the beginning of the region.  */
@@ -4082,11 +4528,41 @@ base64_decode_1 (const char *from, char *to, ptrdiff_t length,
   signed char const *b64_char_to_value = base64_char_to_value[base64url];
   unsigned char multibyte_bit = multibyte << 7;
 
+  unsigned int const (*b64_quads)[UCHAR_MAX + 1] = base64_quads[base64url];
+
   while (true)
     {
       unsigned char c;
       int v1;
 
+      /* Decode whole quadruplets of ordinary characters at once.  */
+
+      for (; flim - f >= 4; f += 4)
+	{
+	  unsigned char const *u = (unsigned char const *) f;
+	  unsigned int value = (b64_quads[0][u[0]] | b64_quads[1][u[1]]
+				| b64_quads[2][u[2]] | b64_quads[3][u[3]]);
+	  if (value & BASE64_INVALID)
+	    break;
+	  if (value & (multibyte_bit * 0x010101u))
+	    for (int shift = 16; 0 <= shift; shift -= 8)
+	      {
+		c = value >> shift & 0xff;
+		if (c & multibyte_bit)
+		  e += BYTE8_STRING (c, (unsigned char *) e);
+		else
+		  *e++ = c;
+	      }
+	  else
+	    {
+	      e[0] = value >> 16;
+	      e[1] = value >> 8 & 0xff;
+	      e[2] = value & 0xff;
+	      e += 3;
+	    }
+	  nchars += 3;
+	}
+
       /* Process first byte of a quadruplet. */
 
       do
@@ -5701,6 +6177,227 @@ DEFUN ("secure-hash-algorithms", Fsecure_hash_algorithms,
   return list (Qmd5, Qsha1, Qsha224, Qsha256, Qsha384, Qsha512);
 }
 
+/* The state of a `secure-hash' computation, fed incrementally.  */
+
+struct secure_hash_ctx
+{
+  Lisp_Object algorithm;
+  int digest_size;
+  union
+  {
+    struct md5_ctx md5;
+    struct sha1_ctx sha1;
+    struct sha256_ctx sha256;
+    struct sha512_ctx sha512;
+  } u;
+};
+
+/* Start computing into CTX a hash with ALGORITHM, a symbol: md5,
+   sha1, sha224 and so on.  */
+
+static void
+secure_hash_init (struct secure_hash_ctx *ctx, Lisp_Object algorithm)
+{
+  ctx->algorithm = algorithm;
+  if (EQ (algorithm, Qmd5))
+    {
+      ctx->digest_size = MD5_DIGEST_SIZE;
+      md5_init_ctx (&ctx->u.md5);
+    }
+  else if (EQ (algorithm, Qsha1))
+    {
+      ctx->digest_size = SHA1_DIGEST_SIZE;
+      sha1_init_ctx (&ctx->u.sha1);
+    }
+  else if (EQ (algorithm, Qsha224))
+    {
+      ctx->digest_size = SHA224_DIGEST_SIZE;
+      sha224_init_ctx (&ctx->u.sha256);
+    }
+  else if (EQ (algorithm, Qsha256))
+    {
+      ctx->digest_size = SHA256_DIGEST_SIZE;
+      sha256_init_ctx (&ctx->u.sha256);
+    }
+  else if (EQ (algorithm, Qsha384))
+    {
+      ctx->digest_size = SHA384_DIGEST_SIZE;
+      sha384_init_ctx (&ctx->u.sha512);
+    }
+  else if (EQ (algorithm, Qsha512))
+    {
+      ctx->digest_size = SHA512_DIGEST_SIZE;
+      sha512_init_ctx (&ctx->u.sha512);
+    }
+  else
+    error ("Invalid algorithm arg: %s", SDATA (Fsymbol_name (algorithm)));
+}
+
+/* Feed the LEN bytes at BUFFER to the hash computation CTX.  */
+
+static void
+secure_hash_process (struct secure_hash_ctx *ctx, const char *buffer,
+		     ptrdiff_t len)
+{
+  if (len == 0)
+    return;
+  if (EQ (ctx->algorithm, Qmd5))
+    md5_process_bytes (buffer, len, &ctx->u.md5);
+  else if (EQ (ctx->algorithm, Qsha1))
+    sha1_process_bytes (buffer, len, &ctx->u.sha1);
+  else if (EQ (ctx->algorithm, Qsha224) || EQ (ctx->algorithm, Qsha256))
+    sha256_process_bytes (buffer, len, &ctx->u.sha256);
+  else
+    sha512_process_bytes (buffer, len, &ctx->u.sha512);
+}
+
+/* Finish the hash computation CTX and return its digest, in binary
+   form if BINARY is non-nil, else in hexadecimal.  */
+
+static Lisp_Object
+secure_hash_finish (struct secure_hash_ctx *ctx, Lisp_Object binary)
+{
+  /* allocate 2 x digest_size so that it can be re-used to hold the
+     hexified value */
+  Lisp_Object digest = make_unibyte_string (NULL, ctx->digest_size * 2);
+  char *p = SSDATA (digest);
+
+  if (EQ (ctx->algorithm, Qmd5))
+    md5_finish_ctx (&ctx->u.md5, p);
+  else if (EQ (ctx->algorithm, Qsha1))
+    sha1_finish_ctx (&ctx->u.sha1, p);
+  else if (EQ (ctx->algorithm, Qsha224))
+    sha224_finish_ctx (&ctx->u.sha256, p);
+  else if (EQ (ctx->algorithm, Qsha256))
+    sha256_finish_ctx (&ctx->u.sha256, p);
+  else if (EQ (ctx->algorithm, Qsha384))
+    sha384_finish_ctx (&ctx->u.sha512, p);
+  else
+    sha512_finish_ctx (&ctx->u.sha512, p);
+
+  if (NILP (binary))
+    return make_digest_string (digest, ctx->digest_size);
+  else
+    return make_unibyte_string (SSDATA (digest), ctx->digest_size);
+}
+
+/* Return the text of BUFFER between START and END, encoded as
+   specified for `secure-hash' by CODING_SYSTEM and NOERROR, in a
+   string.  But if CTX is non-null and encoding would not change the
+   text, feed the text to CTX from where it lies in BUFFER, and return
+   nil instead.  */
+
+static Lisp_Object
+buffer_data (Lisp_Object buffer, Lisp_Object start, Lisp_Object end,
+	     Lisp_Object coding_system, Lisp_Object noerror,
+	     struct secure_hash_ctx *ctx)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  EMACS_INT b, e;
+  Lisp_Object object;
+
+  record_unwind_current_buffer ();
+  set_buffer_internal (XBUFFER (buffer));
+
+  b = !NILP (start) ? fix_position (start) : BEGV;
+  e = !NILP (end) ? fix_position (end) : ZV;
+  if (b > e)
+    {
+      EMACS_INT temp = b;
+      b = e;
+      e = temp;
+    }
+
+  if (!(BEGV <= b && e <= ZV))
+    args_out_of_range (start, end);
+
+  if (NILP (coding_system))
+    {
+      /* Decide the coding-system to encode the data with.
+	 See fileio.c:Fwrite-region */
+
+      if (!NILP (Vcoding_system_for_write))
+	coding_system = Vcoding_system_for_write;
+      else
+	{
+	  bool force_raw_text = false;
+
+	  coding_system = BVAR (current_buffer, buffer_file_coding_system);
+	  if (NILP (coding_system)
+	      || NILP (Flocal_variable_p (Qbuffer_file_coding_system, Qnil)))
+	    {
+	      coding_system = Qnil;
+	      if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
+		force_raw_text = true;
+	    }
+
+	  if (NILP (coding_system) && !NILP (Fbuffer_file_name (buffer)))
+	    {
+	      /* Check file-coding-system-alist.  */
+	      Lisp_Object val = CALLN (Ffind_operation_coding_system,
+				       Qwrite_region,
+				       make_fixnum (b), make_fixnum (e),
+				       Fbuffer_file_name (buffer));
+	      if (CONSP (val) && !NILP (XCDR (val)))
+		coding_system = XCDR (val);
+	    }
+
+	  if (NILP (coding_system)
+	      && !NILP (BVAR (current_buffer, buffer_file_coding_system)))
+	    {
+	      /* If we still have not decided a coding system, use the
+		 default value of buffer-file-coding-system.  */
+	      coding_system = BVAR (current_buffer, buffer_file_coding_system);
+	    }
+
+	  if (!force_raw_text
+	      && !NILP (Ffboundp (Vselect_safe_coding_system_function)))
+	    /* Confirm that VAL can surely encode the current region.  */
+	    coding_system = call4 (Vselect_safe_coding_system_function,
+				   make_fixnum (b), make_fixnum (e),
+				   coding_system, Qnil);
+
+	  if (force_raw_text)
+	    coding_system = Qraw_text;
+	}
+
+      if (NILP (Fcoding_system_p (coding_system)))
+	{
+	  /* Invalid coding system.  */
+
+	  if (!NILP (noerror))
+	    coding_system = Qraw_text;
+	  else
+	    xsignal1 (Qcoding_system_error, coding_system);
+	}
+    }
+
+  if (ctx)
+    {
+      ptrdiff_t b_byte = CHAR_TO_BYTE (b), e_byte = CHAR_TO_BYTE (e);
+
+      if (NILP (BVAR (current_buffer, enable_multibyte_characters))
+	  || encoding_unchanged_p (coding_system, b, b_byte, e, e_byte, false))
+	{
+	  /* Hash the text on either side of the gap in place.  */
+	  ptrdiff_t gpt_byte = clip_to_bounds (b_byte, GPT_BYTE, e_byte);
+	  secure_hash_process (ctx, (char *) BYTE_POS_ADDR (b_byte),
+			       gpt_byte - b_byte);
+	  secure_hash_process (ctx, (char *) BYTE_POS_ADDR (gpt_byte),
+			       e_byte - gpt_byte);
+	  return unbind_to (count, Qnil);
+	}
+    }
+
+  object = make_buffer_string (b, e, false);
+  unbind_to (count, Qnil);
+
+  if (STRING_MULTIBYTE (object))
+    object = code_convert_string (object, coding_system,
+				  Qnil, true, false, false);
+  return object;
+}
+
 /* Extract data from a string or a buffer. SPEC is a list of
 (BUFFER-OR-STRING-OR-SYMBOL START END CODING-SYSTEM NOERROR) which behave as
 specified with `secure-hash' and in Info node
@@ -5761,96 +6458,7 @@ extract_data_from_object (Lisp_Object spec,
     }
   else if (BUFFERP (object))
     {
-      struct buffer *prev = current_buffer;
-      EMACS_INT b, e;
-
-      record_unwind_current_buffer ();
-
-      struct buffer *bp = XBUFFER (object);
-      set_buffer_internal (bp);
-
-      b = !NILP (start) ? fix_position (start) : BEGV;
-      e = !NILP (end) ? fix_position (end) : ZV;
-      if (b > e)
-	{
-	  EMACS_INT temp = b;
-	  b = e;
-	  e = temp;
-	}
-
-      if (!(BEGV <= b && e <= ZV))
-	args_out_of_range (start, end);
-
-      if (NILP (coding_system))
-	{
-	  /* Decide the coding-system to encode the data with.
-	     See fileio.c:Fwrite-region */
-
-	  if (!NILP (Vcoding_system_for_write))
-	    coding_system = Vcoding_system_for_write;
-	  else
-	    {
-	      bool force_raw_text = false;
-
-	      coding_system = BVAR (XBUFFER (object), buffer_file_coding_system);
-	      if (NILP (coding_system)
-		  || NILP (Flocal_variable_p (Qbuffer_file_coding_system, Qnil)))
-		{
-		  coding_system = Qnil;
-		  if (NILP (BVAR (current_buffer, enable_multibyte_characters)))
-		    force_raw_text = true;
-		}
-
-	      if (NILP (coding_system) && !NILP (Fbuffer_file_name (object)))
-		{
-		  /* Check file-coding-system-alist.  */
-		  Lisp_Object val = CALLN (Ffind_operation_coding_system,
-					   Qwrite_region,
-					   make_fixnum (b), make_fixnum (e),
-					   Fbuffer_file_name (object));
-		  if (CONSP (val) && !NILP (XCDR (val)))
-		    coding_system = XCDR (val);
-		}
-
-	      if (NILP (coding_system)
-		  && !NILP (BVAR (XBUFFER (object), buffer_file_coding_system)))
-		{
-		  /* If we still have not decided a coding system, use the
-		     default value of buffer-file-coding-system.  */
-		  coding_system = BVAR (XBUFFER (object), buffer_file_coding_system);
-		}
-
-	      if (!force_raw_text
-		  && !NILP (Ffboundp (Vselect_safe_coding_system_function)))
-		/* Confirm that VAL can surely encode the current region.  */
-		coding_system = call4 (Vselect_safe_coding_system_function,
-				       make_fixnum (b), make_fixnum (e),
-				       coding_system, Qnil);
-
-	      if (force_raw_text)
-		coding_system = Qraw_text;
-	    }
-
-	  if (NILP (Fcoding_system_p (coding_system)))
-	    {
-	      /* Invalid coding system.  */
-
-	      if (!NILP (noerror))
-		coding_system = Qraw_text;
-	      else
-		xsignal1 (Qcoding_system_error, coding_system);
-	    }
-	}
-
-      object = make_buffer_string (b, e, false);
-      set_buffer_internal (prev);
-      /* Discard the unwind protect for recovering the current
-	 buffer.  */
-      specpdl_ptr--;
-
-      if (STRING_MULTIBYTE (object))
-	object = code_convert_string (object, coding_system,
-				      Qnil, true, false, false);
+      object = buffer_data (object, start, end, coding_system, noerror, NULL);
       *start_byte = 0;
       *end_byte = SBYTES (object);
     }
@@ -5893,65 +6501,33 @@ secure_hash (Lisp_Object algorithm, Lisp_Object object, Lisp_Object start,
 	     Lisp_Object end, Lisp_Object coding_system, Lisp_Object noerror,
 	     Lisp_Object binary)
 {
-  ptrdiff_t start_byte, end_byte;
-  int digest_size;
-  void *(*hash_func) (const char *, size_t, void *);
-  Lisp_Object digest;
+  struct secure_hash_ctx ctx;
 
   CHECK_SYMBOL (algorithm);
+  secure_hash_init (&ctx, algorithm);
 
-  Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
-
-  const char *input = extract_data_from_object (spec, &start_byte, &end_byte);
-
-  if (input == NULL)
-    error ("secure_hash: failed to extract data from object, aborting!");
-
-  if (EQ (algorithm, Qmd5))
-    {
-      digest_size = MD5_DIGEST_SIZE;
-      hash_func	  = md5_buffer;
-    }
-  else if (EQ (algorithm, Qsha1))
-    {
-      digest_size = SHA1_DIGEST_SIZE;
-      hash_func	  = sha1_buffer;
-    }
-  else if (EQ (algorithm, Qsha224))
-    {
-      digest_size = SHA224_DIGEST_SIZE;
-      hash_func	  = sha224_buffer;
-    }
-  else if (EQ (algorithm, Qsha256))
+  if (BUFFERP (object))
     {
-      digest_size = SHA256_DIGEST_SIZE;
-      hash_func	  = sha256_buffer;
-    }
-  else if (EQ (algorithm, Qsha384))
-    {
-      digest_size = SHA384_DIGEST_SIZE;
-      hash_func	  = sha384_buffer;
-    }
-  else if (EQ (algorithm, Qsha512))
-    {
-      digest_size = SHA512_DIGEST_SIZE;
-      hash_func	  = sha512_buffer;
+      /* Hash the text in place if it needs no encoding.  */
+      Lisp_Object data = buffer_data (object, start, end, coding_system,
+				      noerror, &ctx);
+      if (STRINGP (data))
+	secure_hash_process (&ctx, SSDATA (data), SBYTES (data));
     }
   else
-    error ("Invalid algorithm arg: %s", SDATA (Fsymbol_name (algorithm)));
+    {
+      ptrdiff_t start_byte, end_byte;
+      Lisp_Object spec = list5 (object, start, end, coding_system, noerror);
+      const char *input = extract_data_from_object (spec, &start_byte,
+						    &end_byte);
 
-  /* allocate 2 x digest_size so that it can be re-used to hold the
-     hexified value */
-  digest = make_unibyte_string (NULL, digest_size * 2);
+      if (input == NULL)
+	error ("secure_hash: failed to extract data from object, aborting!");
 
-  hash_func (input + start_byte,
-	     end_byte - start_byte,
-	     SSDATA (digest));
+      secure_hash_process (&ctx, input + start_byte, end_byte - start_byte);
+    }
 
-  if (NILP (binary))
-    return make_digest_string (digest, digest_size);
-  else
-    return make_unibyte_string (SSDATA (digest), digest_size);
+  return secure_hash_finish (&ctx, binary);
 }
 
 DEFUN ("md5", Fmd5, Smd5, 1, 5, 0,
@@ -6016,6 +6592,50 @@ DEFUN ("secure-hash", Fsecure_hash, Ssecure_hash, 2, 5, 0,
   return secure_hash (algorithm, object, start, end, Qnil, Qnil, binary);
 }
 
+DEFUN ("secure-hash-file", Fsecure_hash_file, Ssecure_hash_file, 2, 3, 0,
+       doc: /* Return the secure hash of the contents of FILE.
+ALGORITHM is a symbol specifying the hash to use, as in `secure-hash'.
+
+The hash is computed from the bytes of FILE as they are, without
+decoding them, as `secure-hash' would compute it for a unibyte buffer
+holding the contents of FILE.  But FILE is read a piece at a time, so
+it need not fit in memory.
+
+If BINARY is non-nil, returns a string in binary form.  */)
+  (Lisp_Object algorithm, Lisp_Object file, Lisp_Object binary)
+{
+  struct secure_hash_ctx ctx;
+  char buf[MAX_ALLOCA];
+  ptrdiff_t nread;
+
+  CHECK_SYMBOL (algorithm);
+  CHECK_STRING (file);
+  file = Fexpand_file_name (file, Qnil);
+
+  /* If the file name has special constructs in it,
+     call the corresponding file name handler.  */
+  Lisp_Object handler = Ffind_file_name_handler (file, Qsecure_hash_file);
+  if (!NILP (handler))
+    return call4 (handler, Qsecure_hash_file, algorithm, file, binary);
+
+  secure_hash_init (&ctx, algorithm);
+  int fd = emacs_open (SSDATA (ENCODE_FILE (file)), O_RDONLY, 0);
+  if (fd < 0)
+    report_file_error ("Opening input file", file);
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect_int (close_file_unwind, fd);
+
+  while ((nread = emacs_read_quit (fd, buf, sizeof buf)) != 0)
+    {
+      if (nread < 0)
+	report_file_error ("Read error", file);
+      secure_hash_process (&ctx, buf, nread);
+    }
+
+  unbind_to (count, Qnil);
+  return secure_hash_finish (&ctx, binary);
+}
+
 DEFUN ("buffer-hash", Fbuffer_hash, Sbuffer_hash, 0, 1, 0,
        doc: /* Return a hash of the contents of BUFFER-OR-NAME.
 This hash is performed on the raw internal format of the buffer,
@@ -6312,6 +6932,8 @@ DEFUN ("line-number-at-pos", Fline_number_at_pos,
 void
 syms_of_fns (void)
 {
+  pdumper_do_now_and_after_load (init_base64_tables);
+
   /* Hash table stuff.  */
   DEFSYM (Qhash_table_p, "hash-table-p");
   DEFSYM (Qeq, "eq");
@@ -6364,6 +6986,7 @@ syms_of_fns (void)
   DEFSYM (Qsha256, "sha256");
   DEFSYM (Qsha384, "sha384");
   DEFSYM (Qsha512, "sha512");
+  DEFSYM (Qsecure_hash_file, "secure-hash-file");
 
   /* Miscellaneous stuff.  */
 
@@ -6451,6 +7074,7 @@ syms_of_fns (void)
   defsubr (&Scircular_list_p);
   defsubr (&Sstring_bytes);
   defsubr (&Sstring_distance);
+  defsubr (&Sstring_distance_nearest);
   defsubr (&Sstring_equal);
   defsubr (&Scompare_strings);
   defsubr (&Sstring_lessp);
@@ -6519,6 +7143,7 @@ syms_of_fns (void)
   defsubr (&Smd5);
   defsubr (&Ssecure_hash_algorithms);
   defsubr (&Ssecure_hash);
+  defsubr (&Ssecure_hash_file);
   defsubr (&Sbuffer_hash);
   defsubr (&Slocale_info);
   defsubr (&Sbuffer_line_statistics);
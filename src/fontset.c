@@ -167,6 +167,31 @@ Copyright (C) 2003, 2006
    font for each character.  */
 static Lisp_Object Vdefault_fontset;
 
+/* Each realized ASCII face caches, for non-ASCII characters, the ID
+   of the face face_for_char found for them, so that redisplay of
+   multilingual text need not search the fontset glyph by glyph.  The
+   cache is direct-mapped by character code.  */
+
+enum { FACE_CHAR_CACHE_SIZE = 256 };
+
+struct face_char_cache
+{
+  /* face_char_cache_tick, charset_ordered_list_tick and
+     use_default_font_for_symbols when the entries were filled.  */
+  EMACS_UINT tick, charset_tick;
+  bool symbols;
+
+  /* C is zero for an empty entry, ASCII being never cached.  */
+  struct
+  {
+    int c, face_id;
+  } entries[FACE_CHAR_CACHE_SIZE];
+};
+
+/* Incremented when fontsets, fonts or faces change so that cached
+   face IDs may be stale.  */
+static EMACS_UINT face_char_cache_tick;
+
 /* Prototype declarations for static functions.  */
 static Lisp_Object make_fontset (Lisp_Object, Lisp_Object, Lisp_Object);
 
@@ -910,20 +935,71 @@ free_face_fontset (struct frame *f, struct face *face)
   face->fontset = -1;
 }
 
-/* Return ID of face suitable for displaying character C at buffer position
-   POS on frame F.  FACE must be realized for ASCII characters in advance.
-   Called from the macro FACE_FOR_CHAR.  */
+/* Invalidate the caches of face_for_char.  */
 
-int
-face_for_char (struct frame *f, struct face *face, int c,
-	       ptrdiff_t pos, Lisp_Object object)
+void
+invalidate_face_char_caches (void)
 {
-  Lisp_Object fontset, rfont_def, charset;
-  int face_id;
-  int id;
+  ++face_char_cache_tick;
+}
 
-  if (ASCII_CHAR_P (c) || CHAR_BYTE8_P (c))
-    return face->ascii_face->id;
+/* Return the ID of the charset given by the `charset' property at
+   buffer or string position POS of OBJECT, or -1 if none.  */
+
+static int
+charset_id_at (ptrdiff_t pos, Lisp_Object object)
+{
+  if (pos < 0)
+    return -1;
+
+  Lisp_Object charset = Fget_char_property (make_fixnum (pos), Qcharset,
+					    object);
+  if (!CHARSETP (charset))
+    return -1;
+
+  Lisp_Object val = assq_no_quit (charset, Vfont_encoding_charset_alist);
+  if (CONSP (val) && CHARSETP (XCDR (val)))
+    charset = XCDR (val);
+  return XFIXNUM (CHARSET_SYMBOL_ID (charset));
+}
+
+/* Return the cached face ID slot of character C for ASCII_FACE,
+   emptying its cache first if stale.  */
+
+static int *
+face_char_cache_slot (struct face *ascii_face, int c)
+{
+  struct face_char_cache *cache = ascii_face->char_cache;
+  if (!cache)
+    cache = ascii_face->char_cache = xzalloc (sizeof *cache);
+  if (cache->tick != face_char_cache_tick
+      || cache->charset_tick != charset_ordered_list_tick
+      || cache->symbols != use_default_font_for_symbols)
+    {
+      memset (cache->entries, 0, sizeof cache->entries);
+      cache->tick = face_char_cache_tick;
+      cache->charset_tick = charset_ordered_list_tick;
+      cache->symbols = use_default_font_for_symbols;
+    }
+
+  int i = c & (FACE_CHAR_CACHE_SIZE - 1);
+  if (cache->entries[i].c != c)
+    {
+      cache->entries[i].c = c;
+      cache->entries[i].face_id = -1;
+    }
+  return &cache->entries[i].face_id;
+}
+
+/* Return ID of face suitable for displaying non-ASCII character C
+   with charset ID preferred, or -1 for no preference, on frame F.
+   Subroutine of face_for_char.  */
+
+static int
+find_face_for_char (struct frame *f, struct face *face, int c, int id)
+{
+  Lisp_Object fontset, rfont_def;
+  int face_id;
 
   if (use_default_font_for_symbols  /* let the user disable this feature */
       && c > 0 && EQ (CHAR_TABLE_REF (Vchar_script_table, c), Qsymbol))
@@ -980,27 +1056,6 @@ face_for_char (struct frame *f, struct face *face, int c,
   fontset = FONTSET_FROM_ID (face->fontset);
   eassert (!BASE_FONTSET_P (fontset));
 
-  if (pos < 0)
-    {
-      id = -1;
-      charset = Qnil;
-    }
-  else
-    {
-      charset = Fget_char_property (make_fixnum (pos), Qcharset, object);
-      if (CHARSETP (charset))
-	{
-	  Lisp_Object val;
-
-	  val = assq_no_quit (charset, Vfont_encoding_charset_alist);
-	  if (CONSP (val) && CHARSETP (XCDR (val)))
-	    charset = XCDR (val);
-	  id = XFIXNUM (CHARSET_SYMBOL_ID (charset));
-	}
-      else
-	id = -1;
-    }
-
   rfont_def = fontset_font (fontset, c, face, id);
   if (VECTORP (rfont_def))
     {
@@ -1029,11 +1084,43 @@ face_for_char (struct frame *f, struct face *face, int c,
   return face_id;
 }
 
+/* Return ID of face suitable for displaying character C at buffer position
+   POS on frame F.  FACE must be realized for ASCII characters in advance.
+   Called from the macro FACE_FOR_CHAR.  */
+
+int
+face_for_char (struct frame *f, struct face *face, int c,
+	       ptrdiff_t pos, Lisp_Object object)
+{
+  if (ASCII_CHAR_P (c) || CHAR_BYTE8_P (c))
+    return face->ascii_face->id;
+
+  int id = charset_id_at (pos, object);
+
+  /* Faces sharing an ASCII face share its fontset and thus its
+     answers, except when a charset is preferred, or there is no
+     fontset and FACE itself is the answer.  */
+  if (id >= 0 || face->fontset < 0)
+    return find_face_for_char (f, face, c, id);
+
+  int *slot = face_char_cache_slot (face->ascii_face, c);
+  if (*slot >= 0)
+    return *slot;
+
+  /* Realizing fonts and faces may invalidate the cache, freeing it
+     even, in which case the answer must not be kept.  */
+  EMACS_UINT tick = face_char_cache_tick;
+  int face_id = find_face_for_char (f, face, c, id);
+  if (tick == face_char_cache_tick)
+    *slot = face_id;
+  return face_id;
+}
+
 
 Lisp_Object
 font_for_char (struct face *face, int c, ptrdiff_t pos, Lisp_Object object)
 {
-  Lisp_Object fontset, rfont_def, charset;
+  Lisp_Object fontset, rfont_def;
   int id;
 
   if (ASCII_CHAR_P (c))
@@ -1047,26 +1134,7 @@ font_for_char (struct face *face, int c, ptrdiff_t pos, Lisp_Object object)
   eassert (fontset_id_valid_p (face->fontset));
   fontset = FONTSET_FROM_ID (face->fontset);
   eassert (!BASE_FONTSET_P (fontset));
-  if (pos < 0)
-    {
-      id = -1;
-      charset = Qnil;
-    }
-  else
-    {
-      charset = Fget_char_property (make_fixnum (pos), Qcharset, object);
-      if (CHARSETP (charset))
-	{
-	  Lisp_Object val;
-
-	  val = assq_no_quit (charset, Vfont_encoding_charset_alist);
-	  if (CONSP (val) && CHARSETP (XCDR (val)))
-	    charset = XCDR (val);
-	  id = XFIXNUM (CHARSET_SYMBOL_ID (charset));
-	}
-      else
-	id = -1;
-    }
+  id = charset_id_at (pos, object);
 
   rfont_def = fontset_font (fontset, c, face, id);
   return (VECTORP (rfont_def)
@@ -1302,6 +1370,8 @@ free_realized_fontsets (Lisp_Object base)
 {
   int id;
 
+  invalidate_face_char_caches ();
+
 #if 0
   /* For the moment, this doesn't work because free_realized_face
      doesn't remove FACE from a cache.  Until we find a solution, we
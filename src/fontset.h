@@ -33,6 +33,7 @@ #define EMACS_FONTSET_H
 extern void free_face_fontset (struct frame *, struct face *);
 extern int face_for_char (struct frame *, struct face *, int,
                           ptrdiff_t, Lisp_Object);
+extern void invalidate_face_char_caches (void);
 extern Lisp_Object font_for_char (struct face *, int, ptrdiff_t, Lisp_Object);
 
 extern int make_fontset_for_ascii_face (struct frame *, int, struct face *);
@@ -0,0 +1,7731 @@
+/* This file was auto-generated by make-docfile.  */
+/* DO NOT EDIT.  */
+struct emacs_globals {
+  Lisp_Object f_V_comp_no_native_file_h;
+#define V_comp_no_native_file_h globals.f_V_comp_no_native_file_h
+  Lisp_Object f_Vafter_change_functions;
+#define Vafter_change_functions globals.f_Vafter_change_functions
+  Lisp_Object f_Vafter_delete_frame_functions;
+#define Vafter_delete_frame_functions globals.f_Vafter_delete_frame_functions
+  Lisp_Object f_Vafter_init_time;
+#define Vafter_init_time globals.f_Vafter_init_time
+  Lisp_Object f_Vafter_insert_file_functions;
+#define Vafter_insert_file_functions globals.f_Vafter_insert_file_functions
+  Lisp_Object f_Vafter_load_alist;
+#define Vafter_load_alist globals.f_Vafter_load_alist
+  Lisp_Object f_Vambiguous_width_chars;
+#define Vambiguous_width_chars globals.f_Vambiguous_width_chars
+  Lisp_Object f_Vauto_composition_emoji_eligible_codepoints;
+#define Vauto_composition_emoji_eligible_codepoints globals.f_Vauto_composition_emoji_eligible_codepoints
+  Lisp_Object f_Vauto_composition_function;
+#define Vauto_composition_function globals.f_Vauto_composition_function
+  Lisp_Object f_Vauto_composition_mode;
+#define Vauto_composition_mode globals.f_Vauto_composition_mode
+  Lisp_Object f_Vauto_fill_chars;
+#define Vauto_fill_chars globals.f_Vauto_fill_chars
+  Lisp_Object f_Vauto_resize_tab_bars;
+#define Vauto_resize_tab_bars globals.f_Vauto_resize_tab_bars
+  Lisp_Object f_Vauto_resize_tool_bars;
+#define Vauto_resize_tool_bars globals.f_Vauto_resize_tool_bars
+  Lisp_Object f_Vauto_save_include_big_deletions;
+#define Vauto_save_include_big_deletions globals.f_Vauto_save_include_big_deletions
+  Lisp_Object f_Vauto_save_list_file_name;
+#define Vauto_save_list_file_name globals.f_Vauto_save_list_file_name
+  Lisp_Object f_Vauto_save_timeout;
+#define Vauto_save_timeout globals.f_Vauto_save_timeout
+  Lisp_Object f_Vauto_save_visited_file_name;
+#define Vauto_save_visited_file_name globals.f_Vauto_save_visited_file_name
+  Lisp_Object f_Vbefore_change_functions;
+#define Vbefore_change_functions globals.f_Vbefore_change_functions
+  Lisp_Object f_Vbefore_init_time;
+#define Vbefore_init_time globals.f_Vbefore_init_time
+  Lisp_Object f_Vblink_cursor_alist;
+#define Vblink_cursor_alist globals.f_Vblink_cursor_alist
+  Lisp_Object f_Vbuffer_access_fontified_property;
+#define Vbuffer_access_fontified_property globals.f_Vbuffer_access_fontified_property
+  Lisp_Object f_Vbuffer_access_fontify_functions;
+#define Vbuffer_access_fontify_functions globals.f_Vbuffer_access_fontify_functions
+  Lisp_Object f_Vbuffer_list_update_hook;
+#define Vbuffer_list_update_hook globals.f_Vbuffer_list_update_hook
+  Lisp_Object f_Vbuild_files;
+#define Vbuild_files globals.f_Vbuild_files
+  Lisp_Object f_Vbyte_boolean_vars;
+#define Vbyte_boolean_vars globals.f_Vbyte_boolean_vars
+  Lisp_Object f_Vbyte_code_meter;
+#define Vbyte_code_meter globals.f_Vbyte_code_meter
+  Lisp_Object f_Vbytecomp_version_regexp;
+#define Vbytecomp_version_regexp globals.f_Vbytecomp_version_regexp
+  Lisp_Object f_Vcase_fold_search;
+#define Vcase_fold_search globals.f_Vcase_fold_search
+  Lisp_Object f_Vchange_major_mode_hook;
+#define Vchange_major_mode_hook globals.f_Vchange_major_mode_hook
+  Lisp_Object f_Vchar_code_property_alist;
+#define Vchar_code_property_alist globals.f_Vchar_code_property_alist
+  Lisp_Object f_Vchar_property_alias_alist;
+#define Vchar_property_alias_alist globals.f_Vchar_property_alias_alist
+  Lisp_Object f_Vchar_script_table;
+#define Vchar_script_table globals.f_Vchar_script_table
+  Lisp_Object f_Vchar_width_table;
+#define Vchar_width_table globals.f_Vchar_width_table
+  Lisp_Object f_Vcharset_list;
+#define Vcharset_list globals.f_Vcharset_list
+  Lisp_Object f_Vcharset_map_path;
+#define Vcharset_map_path globals.f_Vcharset_map_path
+  Lisp_Object f_Vcharset_revision_table;
+#define Vcharset_revision_table globals.f_Vcharset_revision_table
+  Lisp_Object f_Vclear_message_function;
+#define Vclear_message_function globals.f_Vclear_message_function
+  Lisp_Object f_Vcode_conversion_map_vector;
+#define Vcode_conversion_map_vector globals.f_Vcode_conversion_map_vector
+  Lisp_Object f_Vcoding_category_list;
+#define Vcoding_category_list globals.f_Vcoding_category_list
+  Lisp_Object f_Vcoding_system_alist;
+#define Vcoding_system_alist globals.f_Vcoding_system_alist
+  Lisp_Object f_Vcoding_system_for_read;
+#define Vcoding_system_for_read globals.f_Vcoding_system_for_read
+  Lisp_Object f_Vcoding_system_for_write;
+#define Vcoding_system_for_write globals.f_Vcoding_system_for_write
+  Lisp_Object f_Vcoding_system_list;
+#define Vcoding_system_list globals.f_Vcoding_system_list
+  Lisp_Object f_Vcommand_debug_status;
+#define Vcommand_debug_status globals.f_Vcommand_debug_status
+  Lisp_Object f_Vcommand_error_function;
+#define Vcommand_error_function globals.f_Vcommand_error_function
+  Lisp_Object f_Vcommand_history;
+#define Vcommand_history globals.f_Vcommand_history
+  Lisp_Object f_Vcommand_line_args;
+#define Vcommand_line_args globals.f_Vcommand_line_args
+  Lisp_Object f_Vcomment_use_syntax_ppss;
+#define Vcomment_use_syntax_ppss globals.f_Vcomment_use_syntax_ppss
+  Lisp_Object f_Vcomp_abi_hash;
+#define Vcomp_abi_hash globals.f_Vcomp_abi_hash
+  Lisp_Object f_Vcomp_ctxt;
+#define Vcomp_ctxt globals.f_Vcomp_ctxt
+  Lisp_Object f_Vcomp_deferred_pending_h;
+#define Vcomp_deferred_pending_h globals.f_Vcomp_deferred_pending_h
+  Lisp_Object f_Vcomp_eln_to_el_h;
+#define Vcomp_eln_to_el_h globals.f_Vcomp_eln_to_el_h
+  Lisp_Object f_Vcomp_installed_trampolines_h;
+#define Vcomp_installed_trampolines_h globals.f_Vcomp_installed_trampolines_h
+  Lisp_Object f_Vcomp_loaded_comp_units_h;
+#define Vcomp_loaded_comp_units_h globals.f_Vcomp_loaded_comp_units_h
+  Lisp_Object f_Vcomp_native_version_dir;
+#define Vcomp_native_version_dir globals.f_Vcomp_native_version_dir
+  Lisp_Object f_Vcomp_subr_arities_h;
+#define Vcomp_subr_arities_h globals.f_Vcomp_subr_arities_h
+  Lisp_Object f_Vcomp_subr_list;
+#define Vcomp_subr_list globals.f_Vcomp_subr_list
+  Lisp_Object f_Vcompletion_ignored_extensions;
+#define Vcompletion_ignored_extensions globals.f_Vcompletion_ignored_extensions
+  Lisp_Object f_Vcompletion_regexp_list;
+#define Vcompletion_regexp_list globals.f_Vcompletion_regexp_list
+  Lisp_Object f_Vcompose_chars_after_function;
+#define Vcompose_chars_after_function globals.f_Vcompose_chars_after_function
+  Lisp_Object f_Vcomposition_function_table;
+#define Vcomposition_function_table globals.f_Vcomposition_function_table
+  Lisp_Object f_Vconfigure_info_directory;
+#define Vconfigure_info_directory globals.f_Vconfigure_info_directory
+  Lisp_Object f_Vcurrent_iso639_language;
+#define Vcurrent_iso639_language globals.f_Vcurrent_iso639_language
+  Lisp_Object f_Vcurrent_load_list;
+#define Vcurrent_load_list globals.f_Vcurrent_load_list
+  Lisp_Object f_Vcurrent_minibuffer_command;
+#define Vcurrent_minibuffer_command globals.f_Vcurrent_minibuffer_command
+  Lisp_Object f_Vcurrent_prefix_arg;
+#define Vcurrent_prefix_arg globals.f_Vcurrent_prefix_arg
+  Lisp_Object f_Vdata_directory;
+#define Vdata_directory globals.f_Vdata_directory
+  Lisp_Object f_Vdeactivate_mark;
+#define Vdeactivate_mark globals.f_Vdeactivate_mark
+  Lisp_Object f_Vdebug_ignored_errors;
+#define Vdebug_ignored_errors globals.f_Vdebug_ignored_errors
+  Lisp_Object f_Vdebug_on_error;
+#define Vdebug_on_error globals.f_Vdebug_on_error
+  Lisp_Object f_Vdebug_on_event;
+#define Vdebug_on_event globals.f_Vdebug_on_event
+  Lisp_Object f_Vdebug_on_message;
+#define Vdebug_on_message globals.f_Vdebug_on_message
+  Lisp_Object f_Vdebug_on_signal;
+#define Vdebug_on_signal globals.f_Vdebug_on_signal
+  Lisp_Object f_Vdebugger;
+#define Vdebugger globals.f_Vdebugger
+  Lisp_Object f_Vdefault_file_name_coding_system;
+#define Vdefault_file_name_coding_system globals.f_Vdefault_file_name_coding_system
+  Lisp_Object f_Vdefault_frame_alist;
+#define Vdefault_frame_alist globals.f_Vdefault_frame_alist
+  Lisp_Object f_Vdefault_frame_scroll_bars;
+#define Vdefault_frame_scroll_bars globals.f_Vdefault_frame_scroll_bars
+  Lisp_Object f_Vdefault_process_coding_system;
+#define Vdefault_process_coding_system globals.f_Vdefault_process_coding_system
+  Lisp_Object f_Vdefault_text_properties;
+#define Vdefault_text_properties globals.f_Vdefault_text_properties
+  Lisp_Object f_Vdelayed_warnings_list;
+#define Vdelayed_warnings_list globals.f_Vdelayed_warnings_list
+  Lisp_Object f_Vdelete_frame_functions;
+#define Vdelete_frame_functions globals.f_Vdelete_frame_functions
+  Lisp_Object f_Vdelete_terminal_functions;
+#define Vdelete_terminal_functions globals.f_Vdelete_terminal_functions
+  Lisp_Object f_Vdescribe_bindings_check_shadowing_in_ranges;
+#define Vdescribe_bindings_check_shadowing_in_ranges globals.f_Vdescribe_bindings_check_shadowing_in_ranges
+  Lisp_Object f_Vdisable_point_adjustment;
+#define Vdisable_point_adjustment globals.f_Vdisable_point_adjustment
+  Lisp_Object f_Vdisplay_fill_column_indicator_character;
+#define Vdisplay_fill_column_indicator_character globals.f_Vdisplay_fill_column_indicator_character
+  Lisp_Object f_Vdisplay_fill_column_indicator_column;
+#define Vdisplay_fill_column_indicator_column globals.f_Vdisplay_fill_column_indicator_column
+  Lisp_Object f_Vdisplay_line_numbers;
+#define Vdisplay_line_numbers globals.f_Vdisplay_line_numbers
+  Lisp_Object f_Vdisplay_line_numbers_current_absolute;
+#define Vdisplay_line_numbers_current_absolute globals.f_Vdisplay_line_numbers_current_absolute
+  Lisp_Object f_Vdisplay_line_numbers_width;
+#define Vdisplay_line_numbers_width globals.f_Vdisplay_line_numbers_width
+  Lisp_Object f_Vdisplay_monitors_changed_functions;
+#define Vdisplay_monitors_changed_functions globals.f_Vdisplay_monitors_changed_functions
+  Lisp_Object f_Vdisplay_pixels_per_inch;
+#define Vdisplay_pixels_per_inch globals.f_Vdisplay_pixels_per_inch
+  Lisp_Object f_Vdoc_directory;
+#define Vdoc_directory globals.f_Vdoc_directory
+  Lisp_Object f_Vdoc_file_name;
+#define Vdoc_file_name globals.f_Vdoc_file_name
+  Lisp_Object f_Vdouble_click_time;
+#define Vdouble_click_time globals.f_Vdouble_click_time
+  Lisp_Object f_Vdump_mode;
+#define Vdump_mode globals.f_Vdump_mode
+  Lisp_Object f_Vdynamic_library_alist;
+#define Vdynamic_library_alist globals.f_Vdynamic_library_alist
+  Lisp_Object f_Vdynamic_library_suffixes;
+#define Vdynamic_library_suffixes globals.f_Vdynamic_library_suffixes
+  Lisp_Object f_Vecho_keystrokes;
+#define Vecho_keystrokes globals.f_Vecho_keystrokes
+  Lisp_Object f_Vemacs_copyright;
+#define Vemacs_copyright globals.f_Vemacs_copyright
+  Lisp_Object f_Vemacs_version;
+#define Vemacs_version globals.f_Vemacs_version
+  Lisp_Object f_Vemulation_mode_map_alists;
+#define Vemulation_mode_map_alists globals.f_Vemulation_mode_map_alists
+  Lisp_Object f_Venable_character_translation;
+#define Venable_character_translation globals.f_Venable_character_translation
+  Lisp_Object f_Venable_disabled_menus_and_buttons;
+#define Venable_disabled_menus_and_buttons globals.f_Venable_disabled_menus_and_buttons
+  Lisp_Object f_Veval_buffer_list;
+#define Veval_buffer_list globals.f_Veval_buffer_list
+  Lisp_Object f_Vexec_directory;
+#define Vexec_directory globals.f_Vexec_directory
+  Lisp_Object f_Vexec_path;
+#define Vexec_path globals.f_Vexec_path
+  Lisp_Object f_Vexec_suffixes;
+#define Vexec_suffixes globals.f_Vexec_suffixes
+  Lisp_Object f_Vexecuting_kbd_macro;
+#define Vexecuting_kbd_macro globals.f_Vexecuting_kbd_macro
+  Lisp_Object f_Vface_default_stipple;
+#define Vface_default_stipple globals.f_Vface_default_stipple
+  Lisp_Object f_Vface_font_lax_matched_attributes;
+#define Vface_font_lax_matched_attributes globals.f_Vface_font_lax_matched_attributes
+  Lisp_Object f_Vface_font_rescale_alist;
+#define Vface_font_rescale_alist globals.f_Vface_font_rescale_alist
+  Lisp_Object f_Vface_ignored_fonts;
+#define Vface_ignored_fonts globals.f_Vface_ignored_fonts
+  Lisp_Object f_Vface_new_frame_defaults;
+#define Vface_new_frame_defaults globals.f_Vface_new_frame_defaults
+  Lisp_Object f_Vface_remapping_alist;
+#define Vface_remapping_alist globals.f_Vface_remapping_alist
+  Lisp_Object f_Vfeatures;
+#define Vfeatures globals.f_Vfeatures
+  Lisp_Object f_Vfile_coding_system_alist;
+#define Vfile_coding_system_alist globals.f_Vfile_coding_system_alist
+  Lisp_Object f_Vfile_name_coding_system;
+#define Vfile_name_coding_system globals.f_Vfile_name_coding_system
+  Lisp_Object f_Vfile_name_handler_alist;
+#define Vfile_name_handler_alist globals.f_Vfile_name_handler_alist
+  Lisp_Object f_Vfind_word_boundary_function_table;
+#define Vfind_word_boundary_function_table globals.f_Vfind_word_boundary_function_table
+  Lisp_Object f_Vfirst_change_hook;
+#define Vfirst_change_hook globals.f_Vfirst_change_hook
+  Lisp_Object f_Vfloat_output_format;
+#define Vfloat_output_format globals.f_Vfloat_output_format
+  Lisp_Object f_Vfont_ccl_encoder_alist;
+#define Vfont_ccl_encoder_alist globals.f_Vfont_ccl_encoder_alist
+  Lisp_Object f_Vfont_encoding_alist;
+#define Vfont_encoding_alist globals.f_Vfont_encoding_alist
+  Lisp_Object f_Vfont_log;
+#define Vfont_log globals.f_Vfont_log
+  Lisp_Object f_Vfont_slant_table;
+#define Vfont_slant_table globals.f_Vfont_slant_table
+  Lisp_Object f_Vfont_weight_table;
+#define Vfont_weight_table globals.f_Vfont_weight_table
+  Lisp_Object f_Vfont_width_table;
+#define Vfont_width_table globals.f_Vfont_width_table
+  Lisp_Object f_Vfontification_functions;
+#define Vfontification_functions globals.f_Vfontification_functions
+  Lisp_Object f_Vframe_alpha_lower_limit;
+#define Vframe_alpha_lower_limit globals.f_Vframe_alpha_lower_limit
+  Lisp_Object f_Vframe_title_format;
+#define Vframe_title_format globals.f_Vframe_title_format
+  Lisp_Object f_Vfunction_key_map;
+#define Vfunction_key_map globals.f_Vfunction_key_map
+  Lisp_Object f_Vgc_cons_percentage;
+#define Vgc_cons_percentage globals.f_Vgc_cons_percentage
+  Lisp_Object f_Vgc_elapsed;
+#define Vgc_elapsed globals.f_Vgc_elapsed
+  Lisp_Object f_Vgc_event_log_file;
+#define Vgc_event_log_file globals.f_Vgc_event_log_file
+  Lisp_Object f_Vglobal_disable_point_adjustment;
+#define Vglobal_disable_point_adjustment globals.f_Vglobal_disable_point_adjustment
+  Lisp_Object f_Vglobal_mark_ring;
+#define Vglobal_mark_ring globals.f_Vglobal_mark_ring
+  Lisp_Object f_Vglobal_mode_string;
+#define Vglobal_mode_string globals.f_Vglobal_mode_string
+  Lisp_Object f_Vglyph_table;
+#define Vglyph_table globals.f_Vglyph_table
+  Lisp_Object f_Vglyphless_char_display;
+#define Vglyphless_char_display globals.f_Vglyphless_char_display
+  Lisp_Object f_Vhelp_char;
+#define Vhelp_char globals.f_Vhelp_char
+  Lisp_Object f_Vhelp_event_list;
+#define Vhelp_event_list globals.f_Vhelp_event_list
+  Lisp_Object f_Vhelp_form;
+#define Vhelp_form globals.f_Vhelp_form
+  Lisp_Object f_Vhistory_add_new_input;
+#define Vhistory_add_new_input globals.f_Vhistory_add_new_input
+  Lisp_Object f_Vhistory_length;
+#define Vhistory_length globals.f_Vhistory_length
+  Lisp_Object f_Vhourglass_delay;
+#define Vhourglass_delay globals.f_Vhourglass_delay
+  Lisp_Object f_Vhscroll_step;
+#define Vhscroll_step globals.f_Vhscroll_step
+  Lisp_Object f_Vicon_title_format;
+#define Vicon_title_format globals.f_Vicon_title_format
+  Lisp_Object f_Vinhibit_changing_match_data;
+#define Vinhibit_changing_match_data globals.f_Vinhibit_changing_match_data
+  Lisp_Object f_Vinhibit_debugger;
+#define Vinhibit_debugger globals.f_Vinhibit_debugger
+  Lisp_Object f_Vinhibit_field_text_motion;
+#define Vinhibit_field_text_motion globals.f_Vinhibit_field_text_motion
+  Lisp_Object f_Vinhibit_file_name_handlers;
+#define Vinhibit_file_name_handlers globals.f_Vinhibit_file_name_handlers
+  Lisp_Object f_Vinhibit_file_name_operation;
+#define Vinhibit_file_name_operation globals.f_Vinhibit_file_name_operation
+  Lisp_Object f_Vinhibit_point_motion_hooks;
+#define Vinhibit_point_motion_hooks globals.f_Vinhibit_point_motion_hooks
+  Lisp_Object f_Vinhibit_quit;
+#define Vinhibit_quit globals.f_Vinhibit_quit
+  Lisp_Object f_Vinhibit_read_only;
+#define Vinhibit_read_only globals.f_Vinhibit_read_only
+  Lisp_Object f_Vinhibit_redisplay;
+#define Vinhibit_redisplay globals.f_Vinhibit_redisplay
+  Lisp_Object f_Vinitial_environment;
+#define Vinitial_environment globals.f_Vinitial_environment
+  Lisp_Object f_Vinitial_window_system;
+#define Vinitial_window_system globals.f_Vinitial_window_system
+  Lisp_Object f_Vinput_method_function;
+#define Vinput_method_function globals.f_Vinput_method_function
+  Lisp_Object f_Vinput_method_previous_message;
+#define Vinput_method_previous_message globals.f_Vinput_method_previous_message
+  Lisp_Object f_Vinstallation_directory;
+#define Vinstallation_directory globals.f_Vinstallation_directory
+  Lisp_Object f_Vinstalled_directory;
+#define Vinstalled_directory globals.f_Vinstalled_directory
+  Lisp_Object f_Vinternal__daemon_sockname;
+#define Vinternal__daemon_sockname globals.f_Vinternal__daemon_sockname
+  Lisp_Object f_Vinternal__top_level_message;
+#define Vinternal__top_level_message globals.f_Vinternal__top_level_message
+  Lisp_Object f_Vinternal_make_interpreted_closure_function;
+#define Vinternal_make_interpreted_closure_function globals.f_Vinternal_make_interpreted_closure_function
+  Lisp_Object f_Vinterrupt_process_functions;
+#define Vinterrupt_process_functions globals.f_Vinterrupt_process_functions
+  Lisp_Object f_Vinvocation_directory;
+#define Vinvocation_directory globals.f_Vinvocation_directory
+  Lisp_Object f_Vinvocation_name;
+#define Vinvocation_name globals.f_Vinvocation_name
+  Lisp_Object f_Vkbd_macro_termination_hook;
+#define Vkbd_macro_termination_hook globals.f_Vkbd_macro_termination_hook
+  Lisp_Object f_Vkey_translation_map;
+#define Vkey_translation_map globals.f_Vkey_translation_map
+  Lisp_Object f_Vkill_buffer_query_functions;
+#define Vkill_buffer_query_functions globals.f_Vkill_buffer_query_functions
+  Lisp_Object f_Vkill_emacs_hook;
+#define Vkill_emacs_hook globals.f_Vkill_emacs_hook
+  Lisp_Object f_Vlast_code_conversion_error;
+#define Vlast_code_conversion_error globals.f_Vlast_code_conversion_error
+  Lisp_Object f_Vlast_coding_system_used;
+#define Vlast_coding_system_used globals.f_Vlast_coding_system_used
+  Lisp_Object f_Vlast_event_device;
+#define Vlast_event_device globals.f_Vlast_event_device
+  Lisp_Object f_Vlast_event_frame;
+#define Vlast_event_frame globals.f_Vlast_event_frame
+  Lisp_Object f_Vlatin_extra_code_table;
+#define Vlatin_extra_code_table globals.f_Vlatin_extra_code_table
+  Lisp_Object f_Vlexical_binding;
+#define Vlexical_binding globals.f_Vlexical_binding
+  Lisp_Object f_Vlibgnutls_version;
+#define Vlibgnutls_version globals.f_Vlibgnutls_version
+  Lisp_Object f_Vline_number_display_limit;
+#define Vline_number_display_limit globals.f_Vline_number_display_limit
+  Lisp_Object f_Vline_prefix;
+#define Vline_prefix globals.f_Vline_prefix
+  Lisp_Object f_Vload_file_name;
+#define Vload_file_name globals.f_Vload_file_name
+  Lisp_Object f_Vload_file_rep_suffixes;
+#define Vload_file_rep_suffixes globals.f_Vload_file_rep_suffixes
+  Lisp_Object f_Vload_history;
+#define Vload_history globals.f_Vload_history
+  Lisp_Object f_Vload_path;
+#define Vload_path globals.f_Vload_path
+  Lisp_Object f_Vload_read_function;
+#define Vload_read_function globals.f_Vload_read_function
+  Lisp_Object f_Vload_source_file_function;
+#define Vload_source_file_function globals.f_Vload_source_file_function
+  Lisp_Object f_Vload_suffixes;
+#define Vload_suffixes globals.f_Vload_suffixes
+  Lisp_Object f_Vload_true_file_name;
+#define Vload_true_file_name globals.f_Vload_true_file_name
+  Lisp_Object f_Vloadup_pure_table;
+#define Vloadup_pure_table globals.f_Vloadup_pure_table
+  Lisp_Object f_Vlocale_coding_system;
+#define Vlocale_coding_system globals.f_Vlocale_coding_system
+  Lisp_Object f_Vlread_unescaped_character_literals;
+#define Vlread_unescaped_character_literals globals.f_Vlread_unescaped_character_literals
+  Lisp_Object f_Vmacroexp__dynvars;
+#define Vmacroexp__dynvars globals.f_Vmacroexp__dynvars
+  Lisp_Object f_Vmain_thread;
+#define Vmain_thread globals.f_Vmain_thread
+  Lisp_Object f_Vmake_cursor_line_fully_visible;
+#define Vmake_cursor_line_fully_visible globals.f_Vmake_cursor_line_fully_visible
+  Lisp_Object f_Vmake_pointer_invisible;
+#define Vmake_pointer_invisible globals.f_Vmake_pointer_invisible
+  Lisp_Object f_Vmark_even_if_inactive;
+#define Vmark_even_if_inactive globals.f_Vmark_even_if_inactive
+  Lisp_Object f_Vmax_mini_window_height;
+#define Vmax_mini_window_height globals.f_Vmax_mini_window_height
+  Lisp_Object f_Vmaximum_scroll_margin;
+#define Vmaximum_scroll_margin globals.f_Vmaximum_scroll_margin
+  Lisp_Object f_Vmemory__protect_p;
+#define Vmemory__protect_p globals.f_Vmemory__protect_p
+  Lisp_Object f_Vmenu_bar_final_items;
+#define Vmenu_bar_final_items globals.f_Vmenu_bar_final_items
+  Lisp_Object f_Vmenu_bar_mode;
+#define Vmenu_bar_mode globals.f_Vmenu_bar_mode
+  Lisp_Object f_Vmenu_bar_update_hook;
+#define Vmenu_bar_update_hook globals.f_Vmenu_bar_update_hook
+  Lisp_Object f_Vmenu_updating_frame;
+#define Vmenu_updating_frame globals.f_Vmenu_updating_frame
+  Lisp_Object f_Vmessage_log_max;
+#define Vmessage_log_max globals.f_Vmessage_log_max
+  Lisp_Object f_Vmessages_buffer_name;
+#define Vmessages_buffer_name globals.f_Vmessages_buffer_name
+  Lisp_Object f_Vminibuf_scroll_window;
+#define Vminibuf_scroll_window globals.f_Vminibuf_scroll_window
+  Lisp_Object f_Vminibuffer_completing_file_name;
+#define Vminibuffer_completing_file_name globals.f_Vminibuffer_completing_file_name
+  Lisp_Object f_Vminibuffer_completion_confirm;
+#define Vminibuffer_completion_confirm globals.f_Vminibuffer_completion_confirm
+  Lisp_Object f_Vminibuffer_completion_predicate;
+#define Vminibuffer_completion_predicate globals.f_Vminibuffer_completion_predicate
+  Lisp_Object f_Vminibuffer_completion_table;
+#define Vminibuffer_completion_table globals.f_Vminibuffer_completion_table
+  Lisp_Object f_Vminibuffer_exit_hook;
+#define Vminibuffer_exit_hook globals.f_Vminibuffer_exit_hook
+  Lisp_Object f_Vminibuffer_help_form;
+#define Vminibuffer_help_form globals.f_Vminibuffer_help_form
+  Lisp_Object f_Vminibuffer_history_position;
+#define Vminibuffer_history_position globals.f_Vminibuffer_history_position
+  Lisp_Object f_Vminibuffer_history_variable;
+#define Vminibuffer_history_variable globals.f_Vminibuffer_history_variable
+  Lisp_Object f_Vminibuffer_local_map;
+#define Vminibuffer_local_map globals.f_Vminibuffer_local_map
+  Lisp_Object f_Vminibuffer_message_timeout;
+#define Vminibuffer_message_timeout globals.f_Vminibuffer_message_timeout
+  Lisp_Object f_Vminibuffer_prompt_properties;
+#define Vminibuffer_prompt_properties globals.f_Vminibuffer_prompt_properties
+  Lisp_Object f_Vminibuffer_setup_hook;
+#define Vminibuffer_setup_hook globals.f_Vminibuffer_setup_hook
+  Lisp_Object f_Vminor_mode_map_alist;
+#define Vminor_mode_map_alist globals.f_Vminor_mode_map_alist
+  Lisp_Object f_Vminor_mode_overriding_map_alist;
+#define Vminor_mode_overriding_map_alist globals.f_Vminor_mode_overriding_map_alist
+  Lisp_Object f_Vmode_line_compact;
+#define Vmode_line_compact globals.f_Vmode_line_compact
+  Lisp_Object f_Vmodule_file_suffix;
+#define Vmodule_file_suffix globals.f_Vmodule_file_suffix
+  Lisp_Object f_Vmost_negative_fixnum;
+#define Vmost_negative_fixnum globals.f_Vmost_negative_fixnum
+  Lisp_Object f_Vmost_positive_fixnum;
+#define Vmost_positive_fixnum globals.f_Vmost_positive_fixnum
+  Lisp_Object f_Vmouse_autoselect_window;
+#define Vmouse_autoselect_window globals.f_Vmouse_autoselect_window
+  Lisp_Object f_Vmouse_highlight;
+#define Vmouse_highlight globals.f_Vmouse_highlight
+  Lisp_Object f_Vmouse_leave_buffer_hook;
+#define Vmouse_leave_buffer_hook globals.f_Vmouse_leave_buffer_hook
+  Lisp_Object f_Vmouse_position_function;
+#define Vmouse_position_function globals.f_Vmouse_position_function
+  Lisp_Object f_Vmove_frame_functions;
+#define Vmove_frame_functions globals.f_Vmove_frame_functions
+  Lisp_Object f_Vnative_comp_eln_load_path;
+#define Vnative_comp_eln_load_path globals.f_Vnative_comp_eln_load_path
+  Lisp_Object f_Vnative_comp_enable_subr_trampolines;
+#define Vnative_comp_enable_subr_trampolines globals.f_Vnative_comp_enable_subr_trampolines
+  Lisp_Object f_Vnetwork_coding_system_alist;
+#define Vnetwork_coding_system_alist globals.f_Vnetwork_coding_system_alist
+  Lisp_Object f_Vnobreak_char_display;
+#define Vnobreak_char_display globals.f_Vnobreak_char_display
+  Lisp_Object f_Vobarray;
+#define Vobarray globals.f_Vobarray
+  Lisp_Object f_Voperating_system_release;
+#define Voperating_system_release globals.f_Voperating_system_release
+  Lisp_Object f_Vother_window_scroll_buffer;
+#define Vother_window_scroll_buffer globals.f_Vother_window_scroll_buffer
+  Lisp_Object f_Vother_window_scroll_default;
+#define Vother_window_scroll_default globals.f_Vother_window_scroll_default
+  Lisp_Object f_Voverlay_arrow_position;
+#define Voverlay_arrow_position globals.f_Voverlay_arrow_position
+  Lisp_Object f_Voverlay_arrow_string;
+#define Voverlay_arrow_string globals.f_Voverlay_arrow_string
+  Lisp_Object f_Voverlay_arrow_variable_list;
+#define Voverlay_arrow_variable_list globals.f_Voverlay_arrow_variable_list
+  Lisp_Object f_Voverriding_local_map;
+#define Voverriding_local_map globals.f_Voverriding_local_map
+  Lisp_Object f_Voverriding_local_map_menu_flag;
+#define Voverriding_local_map_menu_flag globals.f_Voverriding_local_map_menu_flag
+  Lisp_Object f_Voverriding_plist_environment;
+#define Voverriding_plist_environment globals.f_Voverriding_plist_environment
+  Lisp_Object f_Vpath_separator;
+#define Vpath_separator globals.f_Vpath_separator
+  Lisp_Object f_Vpolling_period;
+#define Vpolling_period globals.f_Vpolling_period
+  Lisp_Object f_Vpost_command_hook;
+#define Vpost_command_hook globals.f_Vpost_command_hook
+  Lisp_Object f_Vpost_gc_hook;
+#define Vpost_gc_hook globals.f_Vpost_gc_hook
+  Lisp_Object f_Vpost_select_region_hook;
+#define Vpost_select_region_hook globals.f_Vpost_select_region_hook
+  Lisp_Object f_Vpost_self_insert_hook;
+#define Vpost_self_insert_hook globals.f_Vpost_self_insert_hook
+  Lisp_Object f_Vpre_command_hook;
+#define Vpre_command_hook globals.f_Vpre_command_hook
+  Lisp_Object f_Vpre_redisplay_function;
+#define Vpre_redisplay_function globals.f_Vpre_redisplay_function
+  Lisp_Object f_Vprefix_help_command;
+#define Vprefix_help_command globals.f_Vprefix_help_command
+  Lisp_Object f_Vpreloaded_file_list;
+#define Vpreloaded_file_list globals.f_Vpreloaded_file_list
+  Lisp_Object f_Vprint__unreadable_callback_buffer;
+#define Vprint__unreadable_callback_buffer globals.f_Vprint__unreadable_callback_buffer
+  Lisp_Object f_Vprint_charset_text_property;
+#define Vprint_charset_text_property globals.f_Vprint_charset_text_property
+  Lisp_Object f_Vprint_circle;
+#define Vprint_circle globals.f_Vprint_circle
+  Lisp_Object f_Vprint_continuous_numbering;
+#define Vprint_continuous_numbering globals.f_Vprint_continuous_numbering
+  Lisp_Object f_Vprint_gensym;
+#define Vprint_gensym globals.f_Vprint_gensym
+  Lisp_Object f_Vprint_length;
+#define Vprint_length globals.f_Vprint_length
+  Lisp_Object f_Vprint_level;
+#define Vprint_level globals.f_Vprint_level
+  Lisp_Object f_Vprint_number_table;
+#define Vprint_number_table globals.f_Vprint_number_table
+  Lisp_Object f_Vprint_unreadable_function;
+#define Vprint_unreadable_function globals.f_Vprint_unreadable_function
+  Lisp_Object f_Vprintable_chars;
+#define Vprintable_chars globals.f_Vprintable_chars
+  Lisp_Object f_Vprocess_adaptive_read_buffering;
+#define Vprocess_adaptive_read_buffering globals.f_Vprocess_adaptive_read_buffering
+  Lisp_Object f_Vprocess_coding_system_alist;
+#define Vprocess_coding_system_alist globals.f_Vprocess_coding_system_alist
+  Lisp_Object f_Vprocess_connection_type;
+#define Vprocess_connection_type globals.f_Vprocess_connection_type
+  Lisp_Object f_Vprocess_environment;
+#define Vprocess_environment globals.f_Vprocess_environment
+  Lisp_Object f_Vquit_flag;
+#define Vquit_flag globals.f_Vquit_flag
+  Lisp_Object f_Vread_buffer_function;
+#define Vread_buffer_function globals.f_Vread_buffer_function
+  Lisp_Object f_Vread_circle;
+#define Vread_circle globals.f_Vread_circle
+  Lisp_Object f_Vread_expression_history;
+#define Vread_expression_history globals.f_Vread_expression_history
+  Lisp_Object f_Vread_hide_char;
+#define Vread_hide_char globals.f_Vread_hide_char
+  Lisp_Object f_Vread_symbol_shorthands;
+#define Vread_symbol_shorthands globals.f_Vread_symbol_shorthands
+  Lisp_Object f_Vreal_this_command;
+#define Vreal_this_command globals.f_Vreal_this_command
+  Lisp_Object f_Vrecenter_redisplay;
+#define Vrecenter_redisplay globals.f_Vrecenter_redisplay
+  Lisp_Object f_Vredisplay__all_windows_cause;
+#define Vredisplay__all_windows_cause globals.f_Vredisplay__all_windows_cause
+  Lisp_Object f_Vredisplay__mode_lines_cause;
+#define Vredisplay__mode_lines_cause globals.f_Vredisplay__mode_lines_cause
+  Lisp_Object f_Vregion_extract_function;
+#define Vregion_extract_function globals.f_Vregion_extract_function
+  Lisp_Object f_Vreport_emacs_bug_address;
+#define Vreport_emacs_bug_address globals.f_Vreport_emacs_bug_address
+  Lisp_Object f_Vresize_mini_windows;
+#define Vresize_mini_windows globals.f_Vresize_mini_windows
+  Lisp_Object f_Vresume_tty_functions;
+#define Vresume_tty_functions globals.f_Vresume_tty_functions
+  Lisp_Object f_Vring_bell_function;
+#define Vring_bell_function globals.f_Vring_bell_function
+  Lisp_Object f_Vsaved_region_selection;
+#define Vsaved_region_selection globals.f_Vsaved_region_selection
+  Lisp_Object f_Vscalable_fonts_allowed;
+#define Vscalable_fonts_allowed globals.f_Vscalable_fonts_allowed
+  Lisp_Object f_Vscript_representative_chars;
+#define Vscript_representative_chars globals.f_Vscript_representative_chars
+  Lisp_Object f_Vscroll_preserve_screen_position;
+#define Vscroll_preserve_screen_position globals.f_Vscroll_preserve_screen_position
+  Lisp_Object f_Vsearch_spaces_regexp;
+#define Vsearch_spaces_regexp globals.f_Vsearch_spaces_regexp
+  Lisp_Object f_Vselect_active_regions;
+#define Vselect_active_regions globals.f_Vselect_active_regions
+  Lisp_Object f_Vselect_safe_coding_system_function;
+#define Vselect_safe_coding_system_function globals.f_Vselect_safe_coding_system_function
+  Lisp_Object f_Vselection_inhibit_update_commands;
+#define Vselection_inhibit_update_commands globals.f_Vselection_inhibit_update_commands
+  Lisp_Object f_Vset_auto_coding_function;
+#define Vset_auto_coding_function globals.f_Vset_auto_coding_function
+  Lisp_Object f_Vset_message_function;
+#define Vset_message_function globals.f_Vset_message_function
+  Lisp_Object f_Vshared_game_score_directory;
+#define Vshared_game_score_directory globals.f_Vshared_game_score_directory
+  Lisp_Object f_Vshell_file_name;
+#define Vshell_file_name globals.f_Vshell_file_name
+  Lisp_Object f_Vshow_help_function;
+#define Vshow_help_function globals.f_Vshow_help_function
+  Lisp_Object f_Vshow_trailing_whitespace;
+#define Vshow_trailing_whitespace globals.f_Vshow_trailing_whitespace
+  Lisp_Object f_Vsignal_hook_function;
+#define Vsignal_hook_function globals.f_Vsignal_hook_function
+  Lisp_Object f_Vsignal_process_functions;
+#define Vsignal_process_functions globals.f_Vsignal_process_functions
+  Lisp_Object f_Vsource_directory;
+#define Vsource_directory globals.f_Vsource_directory
+  Lisp_Object f_Vspecial_event_map;
+#define Vspecial_event_map globals.f_Vspecial_event_map
+  Lisp_Object f_Vstandard_display_table;
+#define Vstandard_display_table globals.f_Vstandard_display_table
+  Lisp_Object f_Vstandard_input;
+#define Vstandard_input globals.f_Vstandard_input
+  Lisp_Object f_Vstandard_output;
+#define Vstandard_output globals.f_Vstandard_output
+  Lisp_Object f_Vstandard_translation_table_for_decode;
+#define Vstandard_translation_table_for_decode globals.f_Vstandard_translation_table_for_decode
+  Lisp_Object f_Vstandard_translation_table_for_encode;
+#define Vstandard_translation_table_for_encode globals.f_Vstandard_translation_table_for_encode
+  Lisp_Object f_Vsuspend_tty_functions;
+#define Vsuspend_tty_functions globals.f_Vsuspend_tty_functions
+  Lisp_Object f_Vsystem_configuration;
+#define Vsystem_configuration globals.f_Vsystem_configuration
+  Lisp_Object f_Vsystem_configuration_features;
+#define Vsystem_configuration_features globals.f_Vsystem_configuration_features
+  Lisp_Object f_Vsystem_configuration_options;
+#define Vsystem_configuration_options globals.f_Vsystem_configuration_options
+  Lisp_Object f_Vsystem_messages_locale;
+#define Vsystem_messages_locale globals.f_Vsystem_messages_locale
+  Lisp_Object f_Vsystem_name;
+#define Vsystem_name globals.f_Vsystem_name
+  Lisp_Object f_Vsystem_time_locale;
+#define Vsystem_time_locale globals.f_Vsystem_time_locale
+  Lisp_Object f_Vsystem_type;
+#define Vsystem_type globals.f_Vsystem_type
+  Lisp_Object f_Vtab_bar_border;
+#define Vtab_bar_border globals.f_Vtab_bar_border
+  Lisp_Object f_Vtab_bar_button_margin;
+#define Vtab_bar_button_margin globals.f_Vtab_bar_button_margin
+  Lisp_Object f_Vtab_bar_mode;
+#define Vtab_bar_mode globals.f_Vtab_bar_mode
+  Lisp_Object f_Vtab_bar_position;
+#define Vtab_bar_position globals.f_Vtab_bar_position
+  Lisp_Object f_Vtab_bar_separator_image_expression;
+#define Vtab_bar_separator_image_expression globals.f_Vtab_bar_separator_image_expression
+  Lisp_Object f_Vtemp_buffer_show_function;
+#define Vtemp_buffer_show_function globals.f_Vtemp_buffer_show_function
+  Lisp_Object f_Vtemporary_file_directory;
+#define Vtemporary_file_directory globals.f_Vtemporary_file_directory
+  Lisp_Object f_Vterminal_frame;
+#define Vterminal_frame globals.f_Vterminal_frame
+  Lisp_Object f_Vtext_property_default_nonsticky;
+#define Vtext_property_default_nonsticky globals.f_Vtext_property_default_nonsticky
+  Lisp_Object f_Vtext_quoting_style;
+#define Vtext_quoting_style globals.f_Vtext_quoting_style
+  Lisp_Object f_Vthis_command;
+#define Vthis_command globals.f_Vthis_command
+  Lisp_Object f_Vthis_command_keys_shift_translated;
+#define Vthis_command_keys_shift_translated globals.f_Vthis_command_keys_shift_translated
+  Lisp_Object f_Vthis_original_command;
+#define Vthis_original_command globals.f_Vthis_original_command
+  Lisp_Object f_Vthrow_on_input;
+#define Vthrow_on_input globals.f_Vthrow_on_input
+  Lisp_Object f_Vtimer_idle_list;
+#define Vtimer_idle_list globals.f_Vtimer_idle_list
+  Lisp_Object f_Vtimer_list;
+#define Vtimer_list globals.f_Vtimer_list
+  Lisp_Object f_Vtool_bar_border;
+#define Vtool_bar_border globals.f_Vtool_bar_border
+  Lisp_Object f_Vtool_bar_button_margin;
+#define Vtool_bar_button_margin globals.f_Vtool_bar_button_margin
+  Lisp_Object f_Vtool_bar_mode;
+#define Vtool_bar_mode globals.f_Vtool_bar_mode
+  Lisp_Object f_Vtool_bar_separator_image_expression;
+#define Vtool_bar_separator_image_expression globals.f_Vtool_bar_separator_image_expression
+  Lisp_Object f_Vtool_bar_style;
+#define Vtool_bar_style globals.f_Vtool_bar_style
+  Lisp_Object f_Vtop_level;
+#define Vtop_level globals.f_Vtop_level
+  Lisp_Object f_Vtransient_mark_mode;
+#define Vtransient_mark_mode globals.f_Vtransient_mark_mode
+  Lisp_Object f_Vtranslation_hash_table_vector;
+#define Vtranslation_hash_table_vector globals.f_Vtranslation_hash_table_vector
+  Lisp_Object f_Vtranslation_table_for_input;
+#define Vtranslation_table_for_input globals.f_Vtranslation_table_for_input
+  Lisp_Object f_Vtranslation_table_vector;
+#define Vtranslation_table_vector globals.f_Vtranslation_table_vector
+  Lisp_Object f_Vtruncate_partial_width_windows;
+#define Vtruncate_partial_width_windows globals.f_Vtruncate_partial_width_windows
+  Lisp_Object f_Vtty_defined_color_alist;
+#define Vtty_defined_color_alist globals.f_Vtty_defined_color_alist
+  Lisp_Object f_Vtty_erase_char;
+#define Vtty_erase_char globals.f_Vtty_erase_char
+  Lisp_Object f_Vundo_outer_limit;
+#define Vundo_outer_limit globals.f_Vundo_outer_limit
+  Lisp_Object f_Vundo_outer_limit_function;
+#define Vundo_outer_limit_function globals.f_Vundo_outer_limit_function
+  Lisp_Object f_Vunicode_category_table;
+#define Vunicode_category_table globals.f_Vunicode_category_table
+  Lisp_Object f_Vunread_command_events;
+#define Vunread_command_events globals.f_Vunread_command_events
+  Lisp_Object f_Vunread_input_method_events;
+#define Vunread_input_method_events globals.f_Vunread_input_method_events
+  Lisp_Object f_Vunread_post_input_method_events;
+#define Vunread_post_input_method_events globals.f_Vunread_post_input_method_events
+  Lisp_Object f_Vuser_full_name;
+#define Vuser_full_name globals.f_Vuser_full_name
+  Lisp_Object f_Vuser_init_file;
+#define Vuser_init_file globals.f_Vuser_init_file
+  Lisp_Object f_Vuser_login_name;
+#define Vuser_login_name globals.f_Vuser_login_name
+  Lisp_Object f_Vuser_real_login_name;
+#define Vuser_real_login_name globals.f_Vuser_real_login_name
+  Lisp_Object f_Vvalues;
+#define Vvalues globals.f_Vvalues
+  Lisp_Object f_Vvoid_text_area_pointer;
+#define Vvoid_text_area_pointer globals.f_Vvoid_text_area_pointer
+  Lisp_Object f_Vwhere_is_preferred_modifier;
+#define Vwhere_is_preferred_modifier globals.f_Vwhere_is_preferred_modifier
+  Lisp_Object f_Vwhile_no_input_ignore_events;
+#define Vwhile_no_input_ignore_events globals.f_Vwhile_no_input_ignore_events
+  Lisp_Object f_Vwindow_buffer_change_functions;
+#define Vwindow_buffer_change_functions globals.f_Vwindow_buffer_change_functions
+  Lisp_Object f_Vwindow_combination_limit;
+#define Vwindow_combination_limit globals.f_Vwindow_combination_limit
+  Lisp_Object f_Vwindow_combination_resize;
+#define Vwindow_combination_resize globals.f_Vwindow_combination_resize
+  Lisp_Object f_Vwindow_configuration_change_hook;
+#define Vwindow_configuration_change_hook globals.f_Vwindow_configuration_change_hook
+  Lisp_Object f_Vwindow_persistent_parameters;
+#define Vwindow_persistent_parameters globals.f_Vwindow_persistent_parameters
+  Lisp_Object f_Vwindow_point_insertion_type;
+#define Vwindow_point_insertion_type globals.f_Vwindow_point_insertion_type
+  Lisp_Object f_Vwindow_scroll_functions;
+#define Vwindow_scroll_functions globals.f_Vwindow_scroll_functions
+  Lisp_Object f_Vwindow_selection_change_functions;
+#define Vwindow_selection_change_functions globals.f_Vwindow_selection_change_functions
+  Lisp_Object f_Vwindow_size_change_functions;
+#define Vwindow_size_change_functions globals.f_Vwindow_size_change_functions
+  Lisp_Object f_Vwindow_state_change_functions;
+#define Vwindow_state_change_functions globals.f_Vwindow_state_change_functions
+  Lisp_Object f_Vwindow_state_change_hook;
+#define Vwindow_state_change_hook globals.f_Vwindow_state_change_hook
+  Lisp_Object f_Vword_combining_categories;
+#define Vword_combining_categories globals.f_Vword_combining_categories
+  Lisp_Object f_Vword_separating_categories;
+#define Vword_separating_categories globals.f_Vword_separating_categories
+  Lisp_Object f_Vwrap_prefix;
+#define Vwrap_prefix globals.f_Vwrap_prefix
+  Lisp_Object f_Vwrite_region_annotate_functions;
+#define Vwrite_region_annotate_functions globals.f_Vwrite_region_annotate_functions
+  Lisp_Object f_Vwrite_region_annotations_so_far;
+#define Vwrite_region_annotations_so_far globals.f_Vwrite_region_annotations_so_far
+  Lisp_Object f_Vwrite_region_post_annotation_function;
+#define Vwrite_region_post_annotation_function globals.f_Vwrite_region_post_annotation_function
+  Lisp_Object f_Vx_pre_popup_menu_hook;
+#define Vx_pre_popup_menu_hook globals.f_Vx_pre_popup_menu_hook
+  Lisp_Object f_Vx_resource_class;
+#define Vx_resource_class globals.f_Vx_resource_class
+  Lisp_Object f_Vx_resource_name;
+#define Vx_resource_name globals.f_Vx_resource_name
+  Lisp_Object f_Vx_show_tooltip_timeout;
+#define Vx_show_tooltip_timeout globals.f_Vx_show_tooltip_timeout
+  Lisp_Object f_Vyes_or_no_prompt;
+#define Vyes_or_no_prompt globals.f_Vyes_or_no_prompt
+  Lisp_Object f_automatic_hscrolling;
+#define automatic_hscrolling globals.f_automatic_hscrolling
+  Lisp_Object f_eol_mnemonic_dos;
+#define eol_mnemonic_dos globals.f_eol_mnemonic_dos
+  Lisp_Object f_eol_mnemonic_mac;
+#define eol_mnemonic_mac globals.f_eol_mnemonic_mac
+  Lisp_Object f_eol_mnemonic_undecided;
+#define eol_mnemonic_undecided globals.f_eol_mnemonic_undecided
+  Lisp_Object f_eol_mnemonic_unix;
+#define eol_mnemonic_unix globals.f_eol_mnemonic_unix
+  Lisp_Object f_focus_follows_mouse;
+#define focus_follows_mouse globals.f_focus_follows_mouse
+  Lisp_Object f_frame_inhibit_implied_resize;
+#define frame_inhibit_implied_resize globals.f_frame_inhibit_implied_resize
+  Lisp_Object f_frame_internal_parameters;
+#define frame_internal_parameters globals.f_frame_internal_parameters
+  Lisp_Object f_frame_size_history;
+#define frame_size_history globals.f_frame_size_history
+  Lisp_Object f_iconify_child_frame;
+#define iconify_child_frame globals.f_iconify_child_frame
+  Lisp_Object f_last_command_event;
+#define last_command_event globals.f_last_command_event
+  Lisp_Object f_last_input_event;
+#define last_input_event globals.f_last_input_event
+  Lisp_Object f_last_nonmenu_event;
+#define last_nonmenu_event globals.f_last_nonmenu_event
+  Lisp_Object f_menu_prompt_more_char;
+#define menu_prompt_more_char globals.f_menu_prompt_more_char
+  Lisp_Object f_meta_prefix_char;
+#define meta_prefix_char globals.f_meta_prefix_char
+  Lisp_Object f_minibuffer_follows_selected_frame;
+#define minibuffer_follows_selected_frame globals.f_minibuffer_follows_selected_frame
+  Lisp_Object f_resize_mini_frames;
+#define resize_mini_frames globals.f_resize_mini_frames
+  Lisp_Object f_track_mouse;
+#define track_mouse globals.f_track_mouse
+  intmax_t f_auto_save_interval;
+#define auto_save_interval globals.f_auto_save_interval
+  intmax_t f_baud_rate;
+#define baud_rate globals.f_baud_rate
+  intmax_t f_cons_cells_consed;
+#define cons_cells_consed globals.f_cons_cells_consed
+  intmax_t f_display_line_numbers_major_tick;
+#define display_line_numbers_major_tick globals.f_display_line_numbers_major_tick
+  intmax_t f_display_line_numbers_minor_tick;
+#define display_line_numbers_minor_tick globals.f_display_line_numbers_minor_tick
+  intmax_t f_display_line_numbers_offset;
+#define display_line_numbers_offset globals.f_display_line_numbers_offset
+  intmax_t f_double_click_fuzz;
+#define double_click_fuzz globals.f_double_click_fuzz
+  intmax_t f_emacs_scroll_step;
+#define emacs_scroll_step globals.f_emacs_scroll_step
+  intmax_t f_executing_kbd_macro_index;
+#define executing_kbd_macro_index globals.f_executing_kbd_macro_index
+  intmax_t f_extra_keyboard_modifiers;
+#define extra_keyboard_modifiers globals.f_extra_keyboard_modifiers
+  intmax_t f_face_near_same_color_threshold;
+#define face_near_same_color_threshold globals.f_face_near_same_color_threshold
+  intmax_t f_floats_consed;
+#define floats_consed globals.f_floats_consed
+  intmax_t f_gc_cons_threshold;
+#define gc_cons_threshold globals.f_gc_cons_threshold
+  intmax_t f_gcs_done;
+#define gcs_done globals.f_gcs_done
+  intmax_t f_global_gnutls_log_level;
+#define global_gnutls_log_level globals.f_global_gnutls_log_level
+  intmax_t f_global_mark_ring_max;
+#define global_mark_ring_max globals.f_global_mark_ring_max
+  intmax_t f_hscroll_margin;
+#define hscroll_margin globals.f_hscroll_margin
+  intmax_t f_integer_width;
+#define integer_width globals.f_integer_width
+  intmax_t f_intervals_consed;
+#define intervals_consed globals.f_intervals_consed
+  intmax_t f_line_number_display_limit_width;
+#define line_number_display_limit_width globals.f_line_number_display_limit_width
+  intmax_t f_max_lisp_eval_depth;
+#define max_lisp_eval_depth globals.f_max_lisp_eval_depth
+  intmax_t f_next_screen_context_lines;
+#define next_screen_context_lines globals.f_next_screen_context_lines
+  intmax_t f_num_input_keys;
+#define num_input_keys globals.f_num_input_keys
+  intmax_t f_num_nonmacro_input_events;
+#define num_nonmacro_input_events globals.f_num_nonmacro_input_events
+  intmax_t f_overline_margin;
+#define overline_margin globals.f_overline_margin
+  intmax_t f_parse_sexp_parallel_threshold;
+#define parse_sexp_parallel_threshold globals.f_parse_sexp_parallel_threshold
+  intmax_t f_process_error_pause_time;
+#define process_error_pause_time globals.f_process_error_pause_time
+  intmax_t f_profiler_log_size;
+#define profiler_log_size globals.f_profiler_log_size
+  intmax_t f_profiler_max_stack_depth;
+#define profiler_max_stack_depth globals.f_profiler_max_stack_depth
+  intmax_t f_read_process_output_max;
+#define read_process_output_max globals.f_read_process_output_max
+  intmax_t f_scroll_conservatively;
+#define scroll_conservatively globals.f_scroll_conservatively
+  intmax_t f_scroll_margin;
+#define scroll_margin globals.f_scroll_margin
+  intmax_t f_string_chars_consed;
+#define string_chars_consed globals.f_string_chars_consed
+  intmax_t f_strings_consed;
+#define strings_consed globals.f_strings_consed
+  intmax_t f_symbols_consed;
+#define symbols_consed globals.f_symbols_consed
+  intmax_t f_syntax_propertize__done;
+#define syntax_propertize__done globals.f_syntax_propertize__done
+  intmax_t f_tab_bar_button_relief;
+#define tab_bar_button_relief globals.f_tab_bar_button_relief
+  intmax_t f_tool_bar_button_relief;
+#define tool_bar_button_relief globals.f_tool_bar_button_relief
+  intmax_t f_tool_bar_max_label_size;
+#define tool_bar_max_label_size globals.f_tool_bar_max_label_size
+  intmax_t f_underline_minimum_offset;
+#define underline_minimum_offset globals.f_underline_minimum_offset
+  intmax_t f_undo_limit;
+#define undo_limit globals.f_undo_limit
+  intmax_t f_undo_strong_limit;
+#define undo_strong_limit globals.f_undo_strong_limit
+  intmax_t f_vector_cells_consed;
+#define vector_cells_consed globals.f_vector_cells_consed
+  intmax_t f_when_entered_debugger;
+#define when_entered_debugger globals.f_when_entered_debugger
+  bool f_align_columns_display;
+#define align_columns_display globals.f_align_columns_display
+  bool f_attempt_orderly_shutdown_on_fatal_signal;
+#define attempt_orderly_shutdown_on_fatal_signal globals.f_attempt_orderly_shutdown_on_fatal_signal
+  bool f_attempt_stack_overflow_recovery;
+#define attempt_stack_overflow_recovery globals.f_attempt_stack_overflow_recovery
+  bool f_auto_raise_tab_bar_buttons_p;
+#define auto_raise_tab_bar_buttons_p globals.f_auto_raise_tab_bar_buttons_p
+  bool f_auto_raise_tool_bar_buttons_p;
+#define auto_raise_tool_bar_buttons_p globals.f_auto_raise_tool_bar_buttons_p
+  bool f_auto_save_no_message;
+#define auto_save_no_message globals.f_auto_save_no_message
+  bool f_auto_window_vscroll_p;
+#define auto_window_vscroll_p globals.f_auto_window_vscroll_p
+  bool f_backtrace_on_error_noninteractive;
+#define backtrace_on_error_noninteractive globals.f_backtrace_on_error_noninteractive
+  bool f_bidi_inhibit_bpa;
+#define bidi_inhibit_bpa globals.f_bidi_inhibit_bpa
+  bool f_binary_as_unsigned;
+#define binary_as_unsigned globals.f_binary_as_unsigned
+  bool f_byte_metering_on;
+#define byte_metering_on globals.f_byte_metering_on
+  bool f_cannot_suspend;
+#define cannot_suspend globals.f_cannot_suspend
+  bool f_case_symbols_as_words;
+#define case_symbols_as_words globals.f_case_symbols_as_words
+  bool f_coding_system_require_warning;
+#define coding_system_require_warning globals.f_coding_system_require_warning
+  bool f_comment_end_can_be_escaped;
+#define comment_end_can_be_escaped globals.f_comment_end_can_be_escaped
+  bool f_comp_file_preloaded_p;
+#define comp_file_preloaded_p globals.f_comp_file_preloaded_p
+  bool f_completion_ignore_case;
+#define completion_ignore_case globals.f_completion_ignore_case
+  bool f_composition_break_at_point;
+#define composition_break_at_point globals.f_composition_break_at_point
+  bool f_create_lockfiles;
+#define create_lockfiles globals.f_create_lockfiles
+  bool f_current_time_list;
+#define current_time_list globals.f_current_time_list
+  bool f_cursor_in_echo_area;
+#define cursor_in_echo_area globals.f_cursor_in_echo_area
+  bool f_debug_on_next_call;
+#define debug_on_next_call globals.f_debug_on_next_call
+  bool f_debug_on_quit;
+#define debug_on_quit globals.f_debug_on_quit
+  bool f_debugger_may_continue;
+#define debugger_may_continue globals.f_debugger_may_continue
+  bool f_debugger_stack_frame_as_list;
+#define debugger_stack_frame_as_list globals.f_debugger_stack_frame_as_list
+  bool f_delete_auto_save_files;
+#define delete_auto_save_files globals.f_delete_auto_save_files
+  bool f_delete_by_moving_to_trash;
+#define delete_by_moving_to_trash globals.f_delete_by_moving_to_trash
+  bool f_delete_exited_processes;
+#define delete_exited_processes globals.f_delete_exited_processes
+  bool f_disable_ascii_optimization;
+#define disable_ascii_optimization globals.f_disable_ascii_optimization
+  bool f_display_fill_column_indicator;
+#define display_fill_column_indicator globals.f_display_fill_column_indicator
+  bool f_display_hourglass_p;
+#define display_hourglass_p globals.f_display_hourglass_p
+  bool f_display_line_numbers_widen;
+#define display_line_numbers_widen globals.f_display_line_numbers_widen
+  bool f_display_raw_bytes_as_hex;
+#define display_raw_bytes_as_hex globals.f_display_raw_bytes_as_hex
+  bool f_enable_recursive_minibuffers;
+#define enable_recursive_minibuffers globals.f_enable_recursive_minibuffers
+  bool f_face_filters_always_match;
+#define face_filters_always_match globals.f_face_filters_always_match
+  bool f_fast_but_imprecise_scrolling;
+#define fast_but_imprecise_scrolling globals.f_fast_but_imprecise_scrolling
+  bool f_force_load_messages;
+#define force_load_messages globals.f_force_load_messages
+  bool f_frame_resize_pixelwise;
+#define frame_resize_pixelwise globals.f_frame_resize_pixelwise
+  bool f_highlight_nonselected_windows;
+#define highlight_nonselected_windows globals.f_highlight_nonselected_windows
+  bool f_history_delete_duplicates;
+#define history_delete_duplicates globals.f_history_delete_duplicates
+  bool f_indent_tabs_mode;
+#define indent_tabs_mode globals.f_indent_tabs_mode
+  bool f_inherit_process_coding_system;
+#define inherit_process_coding_system globals.f_inherit_process_coding_system
+  bool f_inhibit_bidi_mirroring;
+#define inhibit_bidi_mirroring globals.f_inhibit_bidi_mirroring
+  bool f_inhibit_compacting_font_caches;
+#define inhibit_compacting_font_caches globals.f_inhibit_compacting_font_caches
+  bool f_inhibit_eol_conversion;
+#define inhibit_eol_conversion globals.f_inhibit_eol_conversion
+  bool f_inhibit_eval_during_redisplay;
+#define inhibit_eval_during_redisplay globals.f_inhibit_eval_during_redisplay
+  bool f_inhibit_free_realized_faces;
+#define inhibit_free_realized_faces globals.f_inhibit_free_realized_faces
+  bool f_inhibit_interaction;
+#define inhibit_interaction globals.f_inhibit_interaction
+  bool f_inhibit_iso_escape_detection;
+#define inhibit_iso_escape_detection globals.f_inhibit_iso_escape_detection
+  bool f_inhibit_load_charset_map;
+#define inhibit_load_charset_map globals.f_inhibit_load_charset_map
+  bool f_inhibit_menubar_update;
+#define inhibit_menubar_update globals.f_inhibit_menubar_update
+  bool f_inhibit_message;
+#define inhibit_message globals.f_inhibit_message
+  bool f_inhibit_modification_hooks;
+#define inhibit_modification_hooks globals.f_inhibit_modification_hooks
+  bool f_inhibit_mouse_event_check;
+#define inhibit_mouse_event_check globals.f_inhibit_mouse_event_check
+  bool f_inhibit_null_byte_detection;
+#define inhibit_null_byte_detection globals.f_inhibit_null_byte_detection
+  bool f_inhibit_record_char;
+#define inhibit_record_char globals.f_inhibit_record_char
+  bool f_inhibit_x_resources;
+#define inhibit_x_resources globals.f_inhibit_x_resources
+  bool f_input_pending_p_filter_events;
+#define input_pending_p_filter_events globals.f_input_pending_p_filter_events
+  bool f_inverse_video;
+#define inverse_video globals.f_inverse_video
+  bool f_kill_buffer_delete_auto_save_files;
+#define kill_buffer_delete_auto_save_files globals.f_kill_buffer_delete_auto_save_files
+  bool f_load_convert_to_unibyte;
+#define load_convert_to_unibyte globals.f_load_convert_to_unibyte
+  bool f_load_dangerous_libraries;
+#define load_dangerous_libraries globals.f_load_dangerous_libraries
+  bool f_load_force_doc_strings;
+#define load_force_doc_strings globals.f_load_force_doc_strings
+  bool f_load_in_progress;
+#define load_in_progress globals.f_load_in_progress
+  bool f_load_no_native;
+#define load_no_native globals.f_load_no_native
+  bool f_load_prefer_newer;
+#define load_prefer_newer globals.f_load_prefer_newer
+  bool f_lucid__menu_grab_keyboard;
+#define lucid__menu_grab_keyboard globals.f_lucid__menu_grab_keyboard
+  bool f_make_window_start_visible;
+#define make_window_start_visible globals.f_make_window_start_visible
+  bool f_menu_prompting;
+#define menu_prompting globals.f_menu_prompting
+  bool f_message_truncate_lines;
+#define message_truncate_lines globals.f_message_truncate_lines
+  bool f_minibuffer_allow_text_properties;
+#define minibuffer_allow_text_properties globals.f_minibuffer_allow_text_properties
+  bool f_minibuffer_auto_raise;
+#define minibuffer_auto_raise globals.f_minibuffer_auto_raise
+  bool f_mode_line_in_non_selected_windows;
+#define mode_line_in_non_selected_windows globals.f_mode_line_in_non_selected_windows
+  bool f_mouse_fine_grained_tracking;
+#define mouse_fine_grained_tracking globals.f_mouse_fine_grained_tracking
+  bool f_multibyte_syntax_as_symbol;
+#define multibyte_syntax_as_symbol globals.f_multibyte_syntax_as_symbol
+  bool f_multiple_frames;
+#define multiple_frames globals.f_multiple_frames
+  bool f_mwheel_coalesce_scroll_events;
+#define mwheel_coalesce_scroll_events globals.f_mwheel_coalesce_scroll_events
+  bool f_native_comp_jit_compilation;
+#define native_comp_jit_compilation globals.f_native_comp_jit_compilation
+  bool f_no_redraw_on_reenter;
+#define no_redraw_on_reenter globals.f_no_redraw_on_reenter
+  bool f_nobreak_char_ascii_display;
+#define nobreak_char_ascii_display globals.f_nobreak_char_ascii_display
+  bool f_noninteractive1;
+#define noninteractive1 globals.f_noninteractive1
+  bool f_open_paren_in_column_0_is_defun_start;
+#define open_paren_in_column_0_is_defun_start globals.f_open_paren_in_column_0_is_defun_start
+  bool f_parse_sexp_ignore_comments;
+#define parse_sexp_ignore_comments globals.f_parse_sexp_ignore_comments
+  bool f_parse_sexp_lookup_properties;
+#define parse_sexp_lookup_properties globals.f_parse_sexp_lookup_properties
+  bool f_print_escape_control_characters;
+#define print_escape_control_characters globals.f_print_escape_control_characters
+  bool f_print_escape_multibyte;
+#define print_escape_multibyte globals.f_print_escape_multibyte
+  bool f_print_escape_newlines;
+#define print_escape_newlines globals.f_print_escape_newlines
+  bool f_print_escape_nonascii;
+#define print_escape_nonascii globals.f_print_escape_nonascii
+  bool f_print_integers_as_characters;
+#define print_integers_as_characters globals.f_print_integers_as_characters
+  bool f_print_quoted;
+#define print_quoted globals.f_print_quoted
+  bool f_query_all_font_backends;
+#define query_all_font_backends globals.f_query_all_font_backends
+  bool f_read_buffer_completion_ignore_case;
+#define read_buffer_completion_ignore_case globals.f_read_buffer_completion_ignore_case
+  bool f_read_minibuffer_restore_windows;
+#define read_minibuffer_restore_windows globals.f_read_minibuffer_restore_windows
+  bool f_record_all_keys;
+#define record_all_keys globals.f_record_all_keys
+  bool f_redisplay_adhoc_scroll_in_resize_mini_windows;
+#define redisplay_adhoc_scroll_in_resize_mini_windows globals.f_redisplay_adhoc_scroll_in_resize_mini_windows
+  bool f_redisplay_dont_pause;
+#define redisplay_dont_pause globals.f_redisplay_dont_pause
+  bool f_redisplay_skip_fontification_on_input;
+#define redisplay_skip_fontification_on_input globals.f_redisplay_skip_fontification_on_input
+  bool f_redisplay_skip_initial_frame;
+#define redisplay_skip_initial_frame globals.f_redisplay_skip_initial_frame
+  bool f_scroll_bar_adjust_thumb_portion_p;
+#define scroll_bar_adjust_thumb_portion_p globals.f_scroll_bar_adjust_thumb_portion_p
+  bool f_scroll_minibuffer_conservatively;
+#define scroll_minibuffer_conservatively globals.f_scroll_minibuffer_conservatively
+  bool f_system_uses_terminfo;
+#define system_uses_terminfo globals.f_system_uses_terminfo
+  bool f_tab_bar__dragging_in_progress;
+#define tab_bar__dragging_in_progress globals.f_tab_bar__dragging_in_progress
+  bool f_text_quoting_flag;
+#define text_quoting_flag globals.f_text_quoting_flag
+  bool f_tooltip_reuse_hidden_frame;
+#define tooltip_reuse_hidden_frame globals.f_tooltip_reuse_hidden_frame
+  bool f_translate_upper_case_key_bindings;
+#define translate_upper_case_key_bindings globals.f_translate_upper_case_key_bindings
+  bool f_tty_menu_calls_mouse_position_function;
+#define tty_menu_calls_mouse_position_function globals.f_tty_menu_calls_mouse_position_function
+  bool f_undo_inhibit_record_point;
+#define undo_inhibit_record_point globals.f_undo_inhibit_record_point
+  bool f_unibyte_display_via_language_environment;
+#define unibyte_display_via_language_environment globals.f_unibyte_display_via_language_environment
+  bool f_use_dialog_box;
+#define use_dialog_box globals.f_use_dialog_box
+  bool f_use_file_dialog;
+#define use_file_dialog globals.f_use_file_dialog
+  bool f_use_short_answers;
+#define use_short_answers globals.f_use_short_answers
+  bool f_use_system_tooltips;
+#define use_system_tooltips globals.f_use_system_tooltips
+  bool f_visible_bell;
+#define visible_bell globals.f_visible_bell
+  bool f_visible_cursor;
+#define visible_cursor globals.f_visible_cursor
+  bool f_window_resize_pixelwise;
+#define window_resize_pixelwise globals.f_window_resize_pixelwise
+  bool f_word_wrap_by_category;
+#define word_wrap_by_category globals.f_word_wrap_by_category
+  bool f_words_include_escapes;
+#define words_include_escapes globals.f_words_include_escapes
+  bool f_write_region_inhibit_fsync;
+#define write_region_inhibit_fsync globals.f_write_region_inhibit_fsync
+  bool f_x_stretch_cursor_p;
+#define x_stretch_cursor_p globals.f_x_stretch_cursor_p
+  bool f_xft_ignore_color_fonts;
+#define xft_ignore_color_fonts globals.f_xft_ignore_color_fonts
+};
+extern struct emacs_globals globals;
+
+#ifndef DEFINE_SYMBOLS
+extern
+#endif
+struct Lisp_Symbol lispsym[1313];
+
+#define iQnil 0
+DEFINE_LISP_SYMBOL (Qnil)
+#define iQt 1
+DEFINE_LISP_SYMBOL (Qt)
+#define iQunbound 2
+DEFINE_LISP_SYMBOL (Qunbound)
+#define iQerror 3
+DEFINE_LISP_SYMBOL (Qerror)
+#define iQlambda 4
+DEFINE_LISP_SYMBOL (Qlambda)
+#define iQAutomatic_GC 5
+DEFINE_LISP_SYMBOL (QAutomatic_GC)
+#define iQCadstyle 6
+DEFINE_LISP_SYMBOL (QCadstyle)
+#define iQCadvertised_binding 7
+DEFINE_LISP_SYMBOL (QCadvertised_binding)
+#define iQCalign_to 8
+DEFINE_LISP_SYMBOL (QCalign_to)
+#define iQCantialias 9
+DEFINE_LISP_SYMBOL (QCantialias)
+#define iQCascii_compatible_p 10
+DEFINE_LISP_SYMBOL (QCascii_compatible_p)
+#define iQCavgwidth 11
+DEFINE_LISP_SYMBOL (QCavgwidth)
+#define iQCbackground 12
+DEFINE_LISP_SYMBOL (QCbackground)
+#define iQCbold 13
+DEFINE_LISP_SYMBOL (QCbold)
+#define iQCbox 14
+DEFINE_LISP_SYMBOL (QCbox)
+#define iQCbuffer 15
+DEFINE_LISP_SYMBOL (QCbuffer)
+#define iQCbutton 16
+DEFINE_LISP_SYMBOL (QCbutton)
+#define iQCbytesize 17
+DEFINE_LISP_SYMBOL (QCbytesize)
+#define iQCcategory 18
+DEFINE_LISP_SYMBOL (QCcategory)
+#define iQCcipher_aead_capable 19
+DEFINE_LISP_SYMBOL (QCcipher_aead_capable)
+#define iQCcipher_blocksize 20
+DEFINE_LISP_SYMBOL (QCcipher_blocksize)
+#define iQCcipher_id 21
+DEFINE_LISP_SYMBOL (QCcipher_id)
+#define iQCcipher_ivsize 22
+DEFINE_LISP_SYMBOL (QCcipher_ivsize)
+#define iQCcipher_keysize 23
+DEFINE_LISP_SYMBOL (QCcipher_keysize)
+#define iQCcipher_tagsize 24
+DEFINE_LISP_SYMBOL (QCcipher_tagsize)
+#define iQCcoding 25
+DEFINE_LISP_SYMBOL (QCcoding)
+#define iQCcolor 26
+DEFINE_LISP_SYMBOL (QCcolor)
+#define iQCcombining_capability 27
+DEFINE_LISP_SYMBOL (QCcombining_capability)
+#define iQCcommand 28
+DEFINE_LISP_SYMBOL (QCcommand)
+#define iQCcomplete_negotiation 29
+DEFINE_LISP_SYMBOL (QCcomplete_negotiation)
+#define iQCconnection_type 30
+DEFINE_LISP_SYMBOL (QCconnection_type)
+#define iQCcrlfiles 31
+DEFINE_LISP_SYMBOL (QCcrlfiles)
+#define iQCdata 32
+DEFINE_LISP_SYMBOL (QCdata)
+#define iQCdebug_on_exit 33
+DEFINE_LISP_SYMBOL (QCdebug_on_exit)
+#define iQCdecode_translation_table 34
+DEFINE_LISP_SYMBOL (QCdecode_translation_table)
+#define iQCdefault_char 35
+DEFINE_LISP_SYMBOL (QCdefault_char)
+#define iQCdevice 36
+DEFINE_LISP_SYMBOL (QCdevice)
+#define iQCdigest_algorithm_id 37
+DEFINE_LISP_SYMBOL (QCdigest_algorithm_id)
+#define iQCdigest_algorithm_length 38
+DEFINE_LISP_SYMBOL (QCdigest_algorithm_length)
+#define iQCdistant_foreground 39
+DEFINE_LISP_SYMBOL (QCdistant_foreground)
+#define iQCdocumentation 40
+DEFINE_LISP_SYMBOL (QCdocumentation)
+#define iQCdpi 41
+DEFINE_LISP_SYMBOL (QCdpi)
+#define iQCelapsed 42
+DEFINE_LISP_SYMBOL (QCelapsed)
+#define iQCenable 43
+DEFINE_LISP_SYMBOL (QCenable)
+#define iQCencode_translation_table 44
+DEFINE_LISP_SYMBOL (QCencode_translation_table)
+#define iQCeval 45
+DEFINE_LISP_SYMBOL (QCeval)
+#define iQCextend 46
+DEFINE_LISP_SYMBOL (QCextend)
+#define iQCfamily 47
+DEFINE_LISP_SYMBOL (QCfamily)
+#define iQCfile 48
+DEFINE_LISP_SYMBOL (QCfile)
+#define iQCfile_handler 49
+DEFINE_LISP_SYMBOL (QCfile_handler)
+#define iQCfilter 50
+DEFINE_LISP_SYMBOL (QCfilter)
+#define iQCfiltered 51
+DEFINE_LISP_SYMBOL (QCfiltered)
+#define iQCfinalize 52
+DEFINE_LISP_SYMBOL (QCfinalize)
+#define iQCflags 53
+DEFINE_LISP_SYMBOL (QCflags)
+#define iQCflowcontrol 54
+DEFINE_LISP_SYMBOL (QCflowcontrol)
+#define iQCfont 55
+DEFINE_LISP_SYMBOL (QCfont)
+#define iQCfont_entity 56
+DEFINE_LISP_SYMBOL (QCfont_entity)
+#define iQCfontset 57
+DEFINE_LISP_SYMBOL (QCfontset)
+#define iQCforeground 58
+DEFINE_LISP_SYMBOL (QCforeground)
+#define iQCfoundry 59
+DEFINE_LISP_SYMBOL (QCfoundry)
+#define iQCfreed 60
+DEFINE_LISP_SYMBOL (QCfreed)
+#define iQCheight 61
+DEFINE_LISP_SYMBOL (QCheight)
+#define iQChelp 62
+DEFINE_LISP_SYMBOL (QChelp)
+#define iQChost 63
+DEFINE_LISP_SYMBOL (QChost)
+#define iQChostname 64
+DEFINE_LISP_SYMBOL (QChostname)
+#define iQCignore_defface 65
+DEFINE_LISP_SYMBOL (QCignore_defface)
+#define iQCimage 66
+DEFINE_LISP_SYMBOL (QCimage)
+#define iQCinherit 67
+DEFINE_LISP_SYMBOL (QCinherit)
+#define iQCinverse_video 68
+DEFINE_LISP_SYMBOL (QCinverse_video)
+#define iQCitalic 69
+DEFINE_LISP_SYMBOL (QCitalic)
+#define iQCkey_sequence 70
+DEFINE_LISP_SYMBOL (QCkey_sequence)
+#define iQCkeylist 71
+DEFINE_LISP_SYMBOL (QCkeylist)
+#define iQCkeys 72
+DEFINE_LISP_SYMBOL (QCkeys)
+#define iQClabel 73
+DEFINE_LISP_SYMBOL (QClabel)
+#define iQClang 74
+DEFINE_LISP_SYMBOL (QClang)
+#define iQCline_width 75
+DEFINE_LISP_SYMBOL (QCline_width)
+#define iQClive 76
+DEFINE_LISP_SYMBOL (QClive)
+#define iQClocal 77
+DEFINE_LISP_SYMBOL (QClocal)
+#define iQClog 78
+DEFINE_LISP_SYMBOL (QClog)
+#define iQCloglevel 79
+DEFINE_LISP_SYMBOL (QCloglevel)
+#define iQCmac_algorithm_id 80
+DEFINE_LISP_SYMBOL (QCmac_algorithm_id)
+#define iQCmac_algorithm_keysize 81
+DEFINE_LISP_SYMBOL (QCmac_algorithm_keysize)
+#define iQCmac_algorithm_length 82
+DEFINE_LISP_SYMBOL (QCmac_algorithm_length)
+#define iQCmac_algorithm_noncesize 83
+DEFINE_LISP_SYMBOL (QCmac_algorithm_noncesize)
+#define iQCmap 84
+DEFINE_LISP_SYMBOL (QCmap)
+#define iQCmark 85
+DEFINE_LISP_SYMBOL (QCmark)
+#define iQCmin_prime_bits 86
+DEFINE_LISP_SYMBOL (QCmin_prime_bits)
+#define iQCmnemonic 87
+DEFINE_LISP_SYMBOL (QCmnemonic)
+#define iQCname 88
+DEFINE_LISP_SYMBOL (QCname)
+#define iQCnoquery 89
+DEFINE_LISP_SYMBOL (QCnoquery)
+#define iQCnowait 90
+DEFINE_LISP_SYMBOL (QCnowait)
+#define iQCnumber 91
+DEFINE_LISP_SYMBOL (QCnumber)
+#define iQCotf 92
+DEFINE_LISP_SYMBOL (QCotf)
+#define iQCoverline 93
+DEFINE_LISP_SYMBOL (QCoverline)
+#define iQCparity 94
+DEFINE_LISP_SYMBOL (QCparity)
+#define iQCpass 95
+DEFINE_LISP_SYMBOL (QCpass)
+#define iQCplist 96
+DEFINE_LISP_SYMBOL (QCplist)
+#define iQCpointer 97
+DEFINE_LISP_SYMBOL (QCpointer)
+#define iQCport 98
+DEFINE_LISP_SYMBOL (QCport)
+#define iQCposition 99
+DEFINE_LISP_SYMBOL (QCposition)
+#define iQCpost_read_conversion 100
+DEFINE_LISP_SYMBOL (QCpost_read_conversion)
+#define iQCpre_write_conversion 101
+DEFINE_LISP_SYMBOL (QCpre_write_conversion)
+#define iQCpriority 102
+DEFINE_LISP_SYMBOL (QCpriority)
+#define iQCprocess 103
+DEFINE_LISP_SYMBOL (QCprocess)
+#define iQCpropertize 104
+DEFINE_LISP_SYMBOL (QCpropertize)
+#define iQCpurecopy 105
+DEFINE_LISP_SYMBOL (QCpurecopy)
+#define iQCradio 106
+DEFINE_LISP_SYMBOL (QCradio)
+#define iQCrcvbuf 107
+DEFINE_LISP_SYMBOL (QCrcvbuf)
+#define iQCrcvtimeo 108
+DEFINE_LISP_SYMBOL (QCrcvtimeo)
+#define iQCregistry 109
+DEFINE_LISP_SYMBOL (QCregistry)
+#define iQCrehash_size 110
+DEFINE_LISP_SYMBOL (QCrehash_size)
+#define iQCrehash_threshold 111
+DEFINE_LISP_SYMBOL (QCrehash_threshold)
+#define iQCrelative_height 112
+DEFINE_LISP_SYMBOL (QCrelative_height)
+#define iQCrelative_width 113
+DEFINE_LISP_SYMBOL (QCrelative_width)
+#define iQCremote 114
+DEFINE_LISP_SYMBOL (QCremote)
+#define iQCreverse_video 115
+DEFINE_LISP_SYMBOL (QCreverse_video)
+#define iQCrtl 116
+DEFINE_LISP_SYMBOL (QCrtl)
+#define iQCsblock_bytes 117
+DEFINE_LISP_SYMBOL (QCsblock_bytes)
+#define iQCsblocks_freed 118
+DEFINE_LISP_SYMBOL (QCsblocks_freed)
+#define iQCscalable 119
+DEFINE_LISP_SYMBOL (QCscalable)
+#define iQCscript 120
+DEFINE_LISP_SYMBOL (QCscript)
+#define iQCsentinel 121
+DEFINE_LISP_SYMBOL (QCsentinel)
+#define iQCserver 122
+DEFINE_LISP_SYMBOL (QCserver)
+#define iQCservice 123
+DEFINE_LISP_SYMBOL (QCservice)
+#define iQCsize 124
+DEFINE_LISP_SYMBOL (QCsize)
+#define iQCslant 125
+DEFINE_LISP_SYMBOL (QCslant)
+#define iQCsndbuf 126
+DEFINE_LISP_SYMBOL (QCsndbuf)
+#define iQCsndtimeo 127
+DEFINE_LISP_SYMBOL (QCsndtimeo)
+#define iQCspacing 128
+DEFINE_LISP_SYMBOL (QCspacing)
+#define iQCspeed 129
+DEFINE_LISP_SYMBOL (QCspeed)
+#define iQCstart 130
+DEFINE_LISP_SYMBOL (QCstart)
+#define iQCstderr 131
+DEFINE_LISP_SYMBOL (QCstderr)
+#define iQCstipple 132
+DEFINE_LISP_SYMBOL (QCstipple)
+#define iQCstop 133
+DEFINE_LISP_SYMBOL (QCstop)
+#define iQCstopbits 134
+DEFINE_LISP_SYMBOL (QCstopbits)
+#define iQCstrike_through 135
+DEFINE_LISP_SYMBOL (QCstrike_through)
+#define iQCstring_bytes_moved 136
+DEFINE_LISP_SYMBOL (QCstring_bytes_moved)
+#define iQCstring_fragmentation 137
+DEFINE_LISP_SYMBOL (QCstring_fragmentation)
+#define iQCstyle 138
+DEFINE_LISP_SYMBOL (QCstyle)
+#define iQCsuccess 139
+DEFINE_LISP_SYMBOL (QCsuccess)
+#define iQCsummary 140
+DEFINE_LISP_SYMBOL (QCsummary)
+#define iQCsweep 141
+DEFINE_LISP_SYMBOL (QCsweep)
+#define iQCtcpnodelay 142
+DEFINE_LISP_SYMBOL (QCtcpnodelay)
+#define iQCtest 143
+DEFINE_LISP_SYMBOL (QCtest)
+#define iQCtls_parameters 144
+DEFINE_LISP_SYMBOL (QCtls_parameters)
+#define iQCtoggle 145
+DEFINE_LISP_SYMBOL (QCtoggle)
+#define iQCtrigger 146
+DEFINE_LISP_SYMBOL (QCtrigger)
+#define iQCtrustfiles 147
+DEFINE_LISP_SYMBOL (QCtrustfiles)
+#define iQCtype 148
+DEFINE_LISP_SYMBOL (QCtype)
+#define iQCunderline 149
+DEFINE_LISP_SYMBOL (QCunderline)
+#define iQCuse_external_socket 150
+DEFINE_LISP_SYMBOL (QCuse_external_socket)
+#define iQCuser_spec 151
+DEFINE_LISP_SYMBOL (QCuser_spec)
+#define iQCverify_error 152
+DEFINE_LISP_SYMBOL (QCverify_error)
+#define iQCverify_flags 153
+DEFINE_LISP_SYMBOL (QCverify_flags)
+#define iQCvert_only 154
+DEFINE_LISP_SYMBOL (QCvert_only)
+#define iQCvisible 155
+DEFINE_LISP_SYMBOL (QCvisible)
+#define iQCvolume 156
+DEFINE_LISP_SYMBOL (QCvolume)
+#define iQCweakness 157
+DEFINE_LISP_SYMBOL (QCweakness)
+#define iQCweight 158
+DEFINE_LISP_SYMBOL (QCweight)
+#define iQCwidth 159
+DEFINE_LISP_SYMBOL (QCwidth)
+#define iQCwindow 160
+DEFINE_LISP_SYMBOL (QCwindow)
+#define iQDiscarded_Samples 161
+DEFINE_LISP_SYMBOL (QDiscarded_Samples)
+#define iQIn_Reply_To 162
+DEFINE_LISP_SYMBOL (QIn_Reply_To)
+#define iQL2R 163
+DEFINE_LISP_SYMBOL (QL2R)
+#define iQPRIMARY 164
+DEFINE_LISP_SYMBOL (QPRIMARY)
+#define iQR2L 165
+DEFINE_LISP_SYMBOL (QR2L)
+#define iQabove 166
+DEFINE_LISP_SYMBOL (Qabove)
+#define iQabove_handle 167
+DEFINE_LISP_SYMBOL (Qabove_handle)
+#define iQabove_suspended 168
+DEFINE_LISP_SYMBOL (Qabove_suspended)
+#define iQaccess_file 169
+DEFINE_LISP_SYMBOL (Qaccess_file)
+#define iQactivate_input_method 170
+DEFINE_LISP_SYMBOL (Qactivate_input_method)
+#define iQactivate_menubar_hook 171
+DEFINE_LISP_SYMBOL (Qactivate_menubar_hook)
+#define iQadd1 172
+DEFINE_LISP_SYMBOL (Qadd1)
+#define iQadd_name_to_file 173
+DEFINE_LISP_SYMBOL (Qadd_name_to_file)
+#define iQadd_to_history 174
+DEFINE_LISP_SYMBOL (Qadd_to_history)
+#define iQafter_change_functions 175
+DEFINE_LISP_SYMBOL (Qafter_change_functions)
+#define iQafter_delete_frame_functions 176
+DEFINE_LISP_SYMBOL (Qafter_delete_frame_functions)
+#define iQafter_handle 177
+DEFINE_LISP_SYMBOL (Qafter_handle)
+#define iQafter_insert_file_set_coding 178
+DEFINE_LISP_SYMBOL (Qafter_insert_file_set_coding)
+#define iQafter_pdump_load_hook 179
+DEFINE_LISP_SYMBOL (Qafter_pdump_load_hook)
+#define iQafter_string 180
+DEFINE_LISP_SYMBOL (Qafter_string)
+#define iQall 181
+DEFINE_LISP_SYMBOL (Qall)
+#define iQalpha 182
+DEFINE_LISP_SYMBOL (Qalpha)
+#define iQalpha_background 183
+DEFINE_LISP_SYMBOL (Qalpha_background)
+#define iQand_optional 184
+DEFINE_LISP_SYMBOL (Qand_optional)
+#define iQand_rest 185
+DEFINE_LISP_SYMBOL (Qand_rest)
+#define iQapply 186
+DEFINE_LISP_SYMBOL (Qapply)
+#define iQaref 187
+DEFINE_LISP_SYMBOL (Qaref)
+#define iQargs 188
+DEFINE_LISP_SYMBOL (Qargs)
+#define iQargs_out_of_range 189
+DEFINE_LISP_SYMBOL (Qargs_out_of_range)
+#define iQarith_error 190
+DEFINE_LISP_SYMBOL (Qarith_error)
+#define iQarrayp 191
+DEFINE_LISP_SYMBOL (Qarrayp)
+#define iQarrow 192
+DEFINE_LISP_SYMBOL (Qarrow)
+#define iQascii 193
+DEFINE_LISP_SYMBOL (Qascii)
+#define iQascii_0 194
+DEFINE_LISP_SYMBOL (Qascii_0)
+#define iQascii_character 195
+DEFINE_LISP_SYMBOL (Qascii_character)
+#define iQaset 196
+DEFINE_LISP_SYMBOL (Qaset)
+#define iQassume 197
+DEFINE_LISP_SYMBOL (Qassume)
+#define iQauto_composed 198
+DEFINE_LISP_SYMBOL (Qauto_composed)
+#define iQauto_fill_chars 199
+DEFINE_LISP_SYMBOL (Qauto_fill_chars)
+#define iQauto_hscroll_mode 200
+DEFINE_LISP_SYMBOL (Qauto_hscroll_mode)
+#define iQauto_lower 201
+DEFINE_LISP_SYMBOL (Qauto_lower)
+#define iQauto_raise 202
+DEFINE_LISP_SYMBOL (Qauto_raise)
+#define iQauto_save_coding 203
+DEFINE_LISP_SYMBOL (Qauto_save_coding)
+#define iQautoload 204
+DEFINE_LISP_SYMBOL (Qautoload)
+#define iQautosaved 205
+DEFINE_LISP_SYMBOL (Qautosaved)
+#define iQbackground_color 206
+DEFINE_LISP_SYMBOL (Qbackground_color)
+#define iQbackground_mode 207
+DEFINE_LISP_SYMBOL (Qbackground_mode)
+#define iQbackquote 208
+DEFINE_LISP_SYMBOL (Qbackquote)
+#define iQbar 209
+DEFINE_LISP_SYMBOL (Qbar)
+#define iQbefore_change_functions 210
+DEFINE_LISP_SYMBOL (Qbefore_change_functions)
+#define iQbefore_handle 211
+DEFINE_LISP_SYMBOL (Qbefore_handle)
+#define iQbefore_string 212
+DEFINE_LISP_SYMBOL (Qbefore_string)
+#define iQbeginning_of_buffer 213
+DEFINE_LISP_SYMBOL (Qbeginning_of_buffer)
+#define iQbelow 214
+DEFINE_LISP_SYMBOL (Qbelow)
+#define iQbelow_handle 215
+DEFINE_LISP_SYMBOL (Qbelow_handle)
+#define iQbidi_class 216
+DEFINE_LISP_SYMBOL (Qbidi_class)
+#define iQbig 217
+DEFINE_LISP_SYMBOL (Qbig)
+#define iQbig5 218
+DEFINE_LISP_SYMBOL (Qbig5)
+#define iQbitmap_spec_p 219
+DEFINE_LISP_SYMBOL (Qbitmap_spec_p)
+#define iQblack 220
+DEFINE_LISP_SYMBOL (Qblack)
+#define iQbold 221
+DEFINE_LISP_SYMBOL (Qbold)
+#define iQbook 222
+DEFINE_LISP_SYMBOL (Qbook)
+#define iQbool_vector 223
+DEFINE_LISP_SYMBOL (Qbool_vector)
+#define iQbool_vector_p 224
+DEFINE_LISP_SYMBOL (Qbool_vector_p)
+#define iQbooleanp 225
+DEFINE_LISP_SYMBOL (Qbooleanp)
+#define iQborder 226
+DEFINE_LISP_SYMBOL (Qborder)
+#define iQborder_color 227
+DEFINE_LISP_SYMBOL (Qborder_color)
+#define iQborder_width 228
+DEFINE_LISP_SYMBOL (Qborder_width)
+#define iQboth 229
+DEFINE_LISP_SYMBOL (Qboth)
+#define iQboth_horiz 230
+DEFINE_LISP_SYMBOL (Qboth_horiz)
+#define iQbottom 231
+DEFINE_LISP_SYMBOL (Qbottom)
+#define iQbottom_divider 232
+DEFINE_LISP_SYMBOL (Qbottom_divider)
+#define iQbottom_divider_width 233
+DEFINE_LISP_SYMBOL (Qbottom_divider_width)
+#define iQbottom_edge 234
+DEFINE_LISP_SYMBOL (Qbottom_edge)
+#define iQbottom_left_corner 235
+DEFINE_LISP_SYMBOL (Qbottom_left_corner)
+#define iQbottom_right_corner 236
+DEFINE_LISP_SYMBOL (Qbottom_right_corner)
+#define iQboundary 237
+DEFINE_LISP_SYMBOL (Qboundary)
+#define iQbounds 238
+DEFINE_LISP_SYMBOL (Qbounds)
+#define iQbox 239
+DEFINE_LISP_SYMBOL (Qbox)
+#define iQbracket_type 240
+DEFINE_LISP_SYMBOL (Qbracket_type)
+#define iQbuffer 241
+DEFINE_LISP_SYMBOL (Qbuffer)
+#define iQbuffer_access_fontify_functions 242
+DEFINE_LISP_SYMBOL (Qbuffer_access_fontify_functions)
+#define iQbuffer_file_coding_system 243
+DEFINE_LISP_SYMBOL (Qbuffer_file_coding_system)
+#define iQbuffer_list 244
+DEFINE_LISP_SYMBOL (Qbuffer_list)
+#define iQbuffer_list_update_hook 245
+DEFINE_LISP_SYMBOL (Qbuffer_list_update_hook)
+#define iQbuffer_name_history 246
+DEFINE_LISP_SYMBOL (Qbuffer_name_history)
+#define iQbuffer_or_string_p 247
+DEFINE_LISP_SYMBOL (Qbuffer_or_string_p)
+#define iQbuffer_position 248
+DEFINE_LISP_SYMBOL (Qbuffer_position)
+#define iQbuffer_predicate 249
+DEFINE_LISP_SYMBOL (Qbuffer_predicate)
+#define iQbuffer_read_only 250
+DEFINE_LISP_SYMBOL (Qbuffer_read_only)
+#define iQbuffer_stale_function 251
+DEFINE_LISP_SYMBOL (Qbuffer_stale_function)
+#define iQbufferp 252
+DEFINE_LISP_SYMBOL (Qbufferp)
+#define iQbuffers 253
+DEFINE_LISP_SYMBOL (Qbuffers)
+#define iQburied_buffer_list 254
+DEFINE_LISP_SYMBOL (Qburied_buffer_list)
+#define iQbyte_code_function_p 255
+DEFINE_LISP_SYMBOL (Qbyte_code_function_p)
+#define iQbyte_code_meter 256
+DEFINE_LISP_SYMBOL (Qbyte_code_meter)
+#define iQc 257
+DEFINE_LISP_SYMBOL (Qc)
+#define iQcall 258
+DEFINE_LISP_SYMBOL (Qcall)
+#define iQcall_process 259
+DEFINE_LISP_SYMBOL (Qcall_process)
+#define iQcall_process_region 260
+DEFINE_LISP_SYMBOL (Qcall_process_region)
+#define iQcallref 261
+DEFINE_LISP_SYMBOL (Qcallref)
+#define iQcanonical_combining_class 262
+DEFINE_LISP_SYMBOL (Qcanonical_combining_class)
+#define iQcar 263
+DEFINE_LISP_SYMBOL (Qcar)
+#define iQcar_less_than_car 264
+DEFINE_LISP_SYMBOL (Qcar_less_than_car)
+#define iQcase_fold_search 265
+DEFINE_LISP_SYMBOL (Qcase_fold_search)
+#define iQcase_symbols_as_words 266
+DEFINE_LISP_SYMBOL (Qcase_symbols_as_words)
+#define iQcase_table 267
+DEFINE_LISP_SYMBOL (Qcase_table)
+#define iQcase_table_p 268
+DEFINE_LISP_SYMBOL (Qcase_table_p)
+#define iQcatcher 269
+DEFINE_LISP_SYMBOL (Qcatcher)
+#define iQcategory 270
+DEFINE_LISP_SYMBOL (Qcategory)
+#define iQcategory_table 271
+DEFINE_LISP_SYMBOL (Qcategory_table)
+#define iQcategory_table_p 272
+DEFINE_LISP_SYMBOL (Qcategory_table_p)
+#define iQcategoryp 273
+DEFINE_LISP_SYMBOL (Qcategoryp)
+#define iQcategorysetp 274
+DEFINE_LISP_SYMBOL (Qcategorysetp)
+#define iQccl 275
+DEFINE_LISP_SYMBOL (Qccl)
+#define iQccl_program_idx 276
+DEFINE_LISP_SYMBOL (Qccl_program_idx)
+#define iQcclp 277
+DEFINE_LISP_SYMBOL (Qcclp)
+#define iQcdr 278
+DEFINE_LISP_SYMBOL (Qcdr)
+#define iQceiling 279
+DEFINE_LISP_SYMBOL (Qceiling)
+#define iQcenter 280
+DEFINE_LISP_SYMBOL (Qcenter)
+#define iQchange_frame_size 281
+DEFINE_LISP_SYMBOL (Qchange_frame_size)
+#define iQchange_major_mode_hook 282
+DEFINE_LISP_SYMBOL (Qchange_major_mode_hook)
+#define iQchannel 283
+DEFINE_LISP_SYMBOL (Qchannel)
+#define iQchannelp 284
+DEFINE_LISP_SYMBOL (Qchannelp)
+#define iQchar_code_property_table 285
+DEFINE_LISP_SYMBOL (Qchar_code_property_table)
+#define iQchar_from_name 286
+DEFINE_LISP_SYMBOL (Qchar_from_name)
+#define iQchar_or_string_p 287
+DEFINE_LISP_SYMBOL (Qchar_or_string_p)
+#define iQchar_script_table 288
+DEFINE_LISP_SYMBOL (Qchar_script_table)
+#define iQchar_table 289
+DEFINE_LISP_SYMBOL (Qchar_table)
+#define iQchar_table_extra_slots 290
+DEFINE_LISP_SYMBOL (Qchar_table_extra_slots)
+#define iQchar_table_p 291
+DEFINE_LISP_SYMBOL (Qchar_table_p)
+#define iQcharacterp 292
+DEFINE_LISP_SYMBOL (Qcharacterp)
+#define iQcharset 293
+DEFINE_LISP_SYMBOL (Qcharset)
+#define iQcharsetp 294
+DEFINE_LISP_SYMBOL (Qcharsetp)
+#define iQchild_frame_border 295
+DEFINE_LISP_SYMBOL (Qchild_frame_border)
+#define iQchild_frame_border_width 296
+DEFINE_LISP_SYMBOL (Qchild_frame_border_width)
+#define iQchoice 297
+DEFINE_LISP_SYMBOL (Qchoice)
+#define iQcircle 298
+DEFINE_LISP_SYMBOL (Qcircle)
+#define iQcircular_list 299
+DEFINE_LISP_SYMBOL (Qcircular_list)
+#define iQclone_indirect_buffer_hook 300
+DEFINE_LISP_SYMBOL (Qclone_indirect_buffer_hook)
+#define iQclone_of 301
+DEFINE_LISP_SYMBOL (Qclone_of)
+#define iQclose_tab 302
+DEFINE_LISP_SYMBOL (Qclose_tab)
+#define iQclosed 303
+DEFINE_LISP_SYMBOL (Qclosed)
+#define iQclosure 304
+DEFINE_LISP_SYMBOL (Qclosure)
+#define iQcmajflt 305
+DEFINE_LISP_SYMBOL (Qcmajflt)
+#define iQcminflt 306
+DEFINE_LISP_SYMBOL (Qcminflt)
+#define iQcode_conversion_map 307
+DEFINE_LISP_SYMBOL (Qcode_conversion_map)
+#define iQcode_conversion_map_id 308
+DEFINE_LISP_SYMBOL (Qcode_conversion_map_id)
+#define iQcodeset 309
+DEFINE_LISP_SYMBOL (Qcodeset)
+#define iQcoding 310
+DEFINE_LISP_SYMBOL (Qcoding)
+#define iQcoding_system_define_form 311
+DEFINE_LISP_SYMBOL (Qcoding_system_define_form)
+#define iQcoding_system_error 312
+DEFINE_LISP_SYMBOL (Qcoding_system_error)
+#define iQcoding_system_history 313
+DEFINE_LISP_SYMBOL (Qcoding_system_history)
+#define iQcoding_system_p 314
+DEFINE_LISP_SYMBOL (Qcoding_system_p)
+#define iQcolumns 315
+DEFINE_LISP_SYMBOL (Qcolumns)
+#define iQcomm 316
+DEFINE_LISP_SYMBOL (Qcomm)
+#define iQcomma 317
+DEFINE_LISP_SYMBOL (Qcomma)
+#define iQcomma_at 318
+DEFINE_LISP_SYMBOL (Qcomma_at)
+#define iQcommand_debug_status 319
+DEFINE_LISP_SYMBOL (Qcommand_debug_status)
+#define iQcommand_execute 320
+DEFINE_LISP_SYMBOL (Qcommand_execute)
+#define iQcommand_modes 321
+DEFINE_LISP_SYMBOL (Qcommand_modes)
+#define iQcommandp 322
+DEFINE_LISP_SYMBOL (Qcommandp)
+#define iQcomment 323
+DEFINE_LISP_SYMBOL (Qcomment)
+#define iQcomment_end_can_be_escaped 324
+DEFINE_LISP_SYMBOL (Qcomment_end_can_be_escaped)
+#define iQcomp 325
+DEFINE_LISP_SYMBOL (Qcomp)
+#define iQcomp_libgccjit_reproducer 326
+DEFINE_LISP_SYMBOL (Qcomp_libgccjit_reproducer)
+#define iQcomp_maybe_gc_or_quit 327
+DEFINE_LISP_SYMBOL (Qcomp_maybe_gc_or_quit)
+#define iQcomp_mvar 328
+DEFINE_LISP_SYMBOL (Qcomp_mvar)
+#define iQcomp_subr_trampoline_install 329
+DEFINE_LISP_SYMBOL (Qcomp_subr_trampoline_install)
+#define iQcompiled_function 330
+DEFINE_LISP_SYMBOL (Qcompiled_function)
+#define iQcompletion_ignore_case 331
+DEFINE_LISP_SYMBOL (Qcompletion_ignore_case)
+#define iQcomposition 332
+DEFINE_LISP_SYMBOL (Qcomposition)
+#define iQcond_jump 333
+DEFINE_LISP_SYMBOL (Qcond_jump)
+#define iQcond_jump_narg_leq 334
+DEFINE_LISP_SYMBOL (Qcond_jump_narg_leq)
+#define iQcondition_case 335
+DEFINE_LISP_SYMBOL (Qcondition_case)
+#define iQcondition_variable 336
+DEFINE_LISP_SYMBOL (Qcondition_variable)
+#define iQcondition_variable_p 337
+DEFINE_LISP_SYMBOL (Qcondition_variable_p)
+#define iQconfig_changed_event 338
+DEFINE_LISP_SYMBOL (Qconfig_changed_event)
+#define iQconnect 339
+DEFINE_LISP_SYMBOL (Qconnect)
+#define iQcons 340
+DEFINE_LISP_SYMBOL (Qcons)
+#define iQconses 341
+DEFINE_LISP_SYMBOL (Qconses)
+#define iQconsp 342
+DEFINE_LISP_SYMBOL (Qconsp)
+#define iQcopy_directory 343
+DEFINE_LISP_SYMBOL (Qcopy_directory)
+#define iQcopy_file 344
+DEFINE_LISP_SYMBOL (Qcopy_file)
+#define iQcstime 345
+DEFINE_LISP_SYMBOL (Qcstime)
+#define iQctime 346
+DEFINE_LISP_SYMBOL (Qctime)
+#define iQcurrent 347
+DEFINE_LISP_SYMBOL (Qcurrent)
+#define iQcurrent_input_method 348
+DEFINE_LISP_SYMBOL (Qcurrent_input_method)
+#define iQcurrent_line 349
+DEFINE_LISP_SYMBOL (Qcurrent_line)
+#define iQcurrent_load_list 350
+DEFINE_LISP_SYMBOL (Qcurrent_load_list)
+#define iQcurrent_minibuffer_command 351
+DEFINE_LISP_SYMBOL (Qcurrent_minibuffer_command)
+#define iQcursor 352
+DEFINE_LISP_SYMBOL (Qcursor)
+#define iQcursor_color 353
+DEFINE_LISP_SYMBOL (Qcursor_color)
+#define iQcursor_in_echo_area 354
+DEFINE_LISP_SYMBOL (Qcursor_in_echo_area)
+#define iQcursor_type 355
+DEFINE_LISP_SYMBOL (Qcursor_type)
+#define iQcurve 356
+DEFINE_LISP_SYMBOL (Qcurve)
+#define iQcustom_variable_history 357
+DEFINE_LISP_SYMBOL (Qcustom_variable_history)
+#define iQcustom_variable_p 358
+DEFINE_LISP_SYMBOL (Qcustom_variable_p)
+#define iQcutime 359
+DEFINE_LISP_SYMBOL (Qcutime)
+#define iQcycle_sort_function 360
+DEFINE_LISP_SYMBOL (Qcycle_sort_function)
+#define iQcyclic_function_indirection 361
+DEFINE_LISP_SYMBOL (Qcyclic_function_indirection)
+#define iQcyclic_variable_indirection 362
+DEFINE_LISP_SYMBOL (Qcyclic_variable_indirection)
+#define iQd 363
+DEFINE_LISP_SYMBOL (Qd)
+#define iQd_default 364
+DEFINE_LISP_SYMBOL (Qd_default)
+#define iQd_ephemeral 365
+DEFINE_LISP_SYMBOL (Qd_ephemeral)
+#define iQd_impure 366
+DEFINE_LISP_SYMBOL (Qd_impure)
+#define iQdata 367
+DEFINE_LISP_SYMBOL (Qdata)
+#define iQdatagram 368
+DEFINE_LISP_SYMBOL (Qdatagram)
+#define iQdays 369
+DEFINE_LISP_SYMBOL (Qdays)
+#define iQdbus_event 370
+DEFINE_LISP_SYMBOL (Qdbus_event)
+#define iQdeactivate_mark 371
+DEFINE_LISP_SYMBOL (Qdeactivate_mark)
+#define iQdebug 372
+DEFINE_LISP_SYMBOL (Qdebug)
+#define iQdebug_early 373
+DEFINE_LISP_SYMBOL (Qdebug_early)
+#define iQdebugger 374
+DEFINE_LISP_SYMBOL (Qdebugger)
+#define iQdecomposed_characters 375
+DEFINE_LISP_SYMBOL (Qdecomposed_characters)
+#define iQdefalias_fset_function 376
+DEFINE_LISP_SYMBOL (Qdefalias_fset_function)
+#define iQdefault 377
+DEFINE_LISP_SYMBOL (Qdefault)
+#define iQdefault_directory 378
+DEFINE_LISP_SYMBOL (Qdefault_directory)
+#define iQdefun 379
+DEFINE_LISP_SYMBOL (Qdefun)
+#define iQdefvaralias 380
+DEFINE_LISP_SYMBOL (Qdefvaralias)
+#define iQdelayed_warnings_hook 381
+DEFINE_LISP_SYMBOL (Qdelayed_warnings_hook)
+#define iQdelete_before 382
+DEFINE_LISP_SYMBOL (Qdelete_before)
+#define iQdelete_by_moving_to_trash 383
+DEFINE_LISP_SYMBOL (Qdelete_by_moving_to_trash)
+#define iQdelete_directory 384
+DEFINE_LISP_SYMBOL (Qdelete_directory)
+#define iQdelete_file 385
+DEFINE_LISP_SYMBOL (Qdelete_file)
+#define iQdelete_file_internal 386
+DEFINE_LISP_SYMBOL (Qdelete_file_internal)
+#define iQdelete_frame 387
+DEFINE_LISP_SYMBOL (Qdelete_frame)
+#define iQdelete_frame_functions 388
+DEFINE_LISP_SYMBOL (Qdelete_frame_functions)
+#define iQdelete_terminal_functions 389
+DEFINE_LISP_SYMBOL (Qdelete_terminal_functions)
+#define iQdelete_window 390
+DEFINE_LISP_SYMBOL (Qdelete_window)
+#define iQdir_ok 391
+DEFINE_LISP_SYMBOL (Qdir_ok)
+#define iQdirect_call 392
+DEFINE_LISP_SYMBOL (Qdirect_call)
+#define iQdirect_callref 393
+DEFINE_LISP_SYMBOL (Qdirect_callref)
+#define iQdirectory_file_name 394
+DEFINE_LISP_SYMBOL (Qdirectory_file_name)
+#define iQdirectory_files 395
+DEFINE_LISP_SYMBOL (Qdirectory_files)
+#define iQdirectory_files_and_attributes 396
+DEFINE_LISP_SYMBOL (Qdirectory_files_and_attributes)
+#define iQdisable_eval 397
+DEFINE_LISP_SYMBOL (Qdisable_eval)
+#define iQdisabled 398
+DEFINE_LISP_SYMBOL (Qdisabled)
+#define iQdisplay 399
+DEFINE_LISP_SYMBOL (Qdisplay)
+#define iQdisplay_buffer 400
+DEFINE_LISP_SYMBOL (Qdisplay_buffer)
+#define iQdisplay_fill_column_indicator 401
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator)
+#define iQdisplay_fill_column_indicator_character 402
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_character)
+#define iQdisplay_fill_column_indicator_column 403
+DEFINE_LISP_SYMBOL (Qdisplay_fill_column_indicator_column)
+#define iQdisplay_line_numbers 404
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers)
+#define iQdisplay_line_numbers_disable 405
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_disable)
+#define iQdisplay_line_numbers_offset 406
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_offset)
+#define iQdisplay_line_numbers_widen 407
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_widen)
+#define iQdisplay_line_numbers_width 408
+DEFINE_LISP_SYMBOL (Qdisplay_line_numbers_width)
+#define iQdisplay_monitors_changed_functions 409
+DEFINE_LISP_SYMBOL (Qdisplay_monitors_changed_functions)
+#define iQdisplay_table 410
+DEFINE_LISP_SYMBOL (Qdisplay_table)
+#define iQdisplay_type 411
+DEFINE_LISP_SYMBOL (Qdisplay_type)
+#define iQdo_after_load_evaluation 412
+DEFINE_LISP_SYMBOL (Qdo_after_load_evaluation)
+#define iQdomain_error 413
+DEFINE_LISP_SYMBOL (Qdomain_error)
+#define iQdos 414
+DEFINE_LISP_SYMBOL (Qdos)
+#define iQdown 415
+DEFINE_LISP_SYMBOL (Qdown)
+#define iQdrag_internal_border 416
+DEFINE_LISP_SYMBOL (Qdrag_internal_border)
+#define iQdrag_n_drop 417
+DEFINE_LISP_SYMBOL (Qdrag_n_drop)
+#define iQdrag_source 418
+DEFINE_LISP_SYMBOL (Qdrag_source)
+#define iQdrag_with_header_line 419
+DEFINE_LISP_SYMBOL (Qdrag_with_header_line)
+#define iQdrag_with_mode_line 420
+DEFINE_LISP_SYMBOL (Qdrag_with_mode_line)
+#define iQdrag_with_tab_line 421
+DEFINE_LISP_SYMBOL (Qdrag_with_tab_line)
+#define iQdragging 422
+DEFINE_LISP_SYMBOL (Qdragging)
+#define iQdropping 423
+DEFINE_LISP_SYMBOL (Qdropping)
+#define iQdump_emacs_portable__sort_predicate 424
+DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate)
+#define iQdump_emacs_portable__sort_predicate_copied 425
+DEFINE_LISP_SYMBOL (Qdump_emacs_portable__sort_predicate_copied)
+#define iQdump_file_name 426
+DEFINE_LISP_SYMBOL (Qdump_file_name)
+#define iQdumped_with_pdumper 427
+DEFINE_LISP_SYMBOL (Qdumped_with_pdumper)
+#define iQecho_area_clear_hook 428
+DEFINE_LISP_SYMBOL (Qecho_area_clear_hook)
+#define iQecho_keystrokes 429
+DEFINE_LISP_SYMBOL (Qecho_keystrokes)
+#define iQegid 430
+DEFINE_LISP_SYMBOL (Qegid)
+#define iQeight_bit 431
+DEFINE_LISP_SYMBOL (Qeight_bit)
+#define iQelt 432
+DEFINE_LISP_SYMBOL (Qelt)
+#define iQemacs 433
+DEFINE_LISP_SYMBOL (Qemacs)
+#define iQemacs_mule 434
+DEFINE_LISP_SYMBOL (Qemacs_mule)
+#define iQemoji 435
+DEFINE_LISP_SYMBOL (Qemoji)
+#define iQempty_box 436
+DEFINE_LISP_SYMBOL (Qempty_box)
+#define iQenable_recursive_minibuffers 437
+DEFINE_LISP_SYMBOL (Qenable_recursive_minibuffers)
+#define iQencode_time 438
+DEFINE_LISP_SYMBOL (Qencode_time)
+#define iQencoded 439
+DEFINE_LISP_SYMBOL (Qencoded)
+#define iQend_of_buffer 440
+DEFINE_LISP_SYMBOL (Qend_of_buffer)
+#define iQend_of_file 441
+DEFINE_LISP_SYMBOL (Qend_of_file)
+#define iQend_scroll 442
+DEFINE_LISP_SYMBOL (Qend_scroll)
+#define iQend_session 443
+DEFINE_LISP_SYMBOL (Qend_session)
+#define iQentry 444
+DEFINE_LISP_SYMBOL (Qentry)
+#define iQeq 445
+DEFINE_LISP_SYMBOL (Qeq)
+#define iQeql 446
+DEFINE_LISP_SYMBOL (Qeql)
+#define iQequal 447
+DEFINE_LISP_SYMBOL (Qequal)
+#define iQerror_conditions 448
+DEFINE_LISP_SYMBOL (Qerror_conditions)
+#define iQerror_message 449
+DEFINE_LISP_SYMBOL (Qerror_message)
+#define iQescape_glyph 450
+DEFINE_LISP_SYMBOL (Qescape_glyph)
+#define iQetime 451
+DEFINE_LISP_SYMBOL (Qetime)
+#define iQeuid 452
+DEFINE_LISP_SYMBOL (Qeuid)
+#define iQeval 453
+DEFINE_LISP_SYMBOL (Qeval)
+#define iQeval_buffer_list 454
+DEFINE_LISP_SYMBOL (Qeval_buffer_list)
+#define iQevaporate 455
+DEFINE_LISP_SYMBOL (Qevaporate)
+#define iQeven 456
+DEFINE_LISP_SYMBOL (Qeven)
+#define iQevent_kind 457
+DEFINE_LISP_SYMBOL (Qevent_kind)
+#define iQevent_symbol_element_mask 458
+DEFINE_LISP_SYMBOL (Qevent_symbol_element_mask)
+#define iQevent_symbol_elements 459
+DEFINE_LISP_SYMBOL (Qevent_symbol_elements)
+#define iQexcessive_lisp_nesting 460
+DEFINE_LISP_SYMBOL (Qexcessive_lisp_nesting)
+#define iQexcessive_variable_binding 461
+DEFINE_LISP_SYMBOL (Qexcessive_variable_binding)
+#define iQexcl 462
+DEFINE_LISP_SYMBOL (Qexcl)
+#define iQexit 463
+DEFINE_LISP_SYMBOL (Qexit)
+#define iQexpand_abbrev 464
+DEFINE_LISP_SYMBOL (Qexpand_abbrev)
+#define iQexpand_file_name 465
+DEFINE_LISP_SYMBOL (Qexpand_file_name)
+#define iQexplicit 466
+DEFINE_LISP_SYMBOL (Qexplicit)
+#define iQexplicit_name 467
+DEFINE_LISP_SYMBOL (Qexplicit_name)
+#define iQexternal_border_size 468
+DEFINE_LISP_SYMBOL (Qexternal_border_size)
+#define iQexternal_debugging_output 469
+DEFINE_LISP_SYMBOL (Qexternal_debugging_output)
+#define iQextra_bold 470
+DEFINE_LISP_SYMBOL (Qextra_bold)
+#define iQextra_light 471
+DEFINE_LISP_SYMBOL (Qextra_light)
+#define iQface 472
+DEFINE_LISP_SYMBOL (Qface)
+#define iQface_alias 473
+DEFINE_LISP_SYMBOL (Qface_alias)
+#define iQface_no_inherit 474
+DEFINE_LISP_SYMBOL (Qface_no_inherit)
+#define iQface_remapping_alist 475
+DEFINE_LISP_SYMBOL (Qface_remapping_alist)
+#define iQface_set_after_frame_default 476
+DEFINE_LISP_SYMBOL (Qface_set_after_frame_default)
+#define iQfailed 477
+DEFINE_LISP_SYMBOL (Qfailed)
+#define iQfboundp 478
+DEFINE_LISP_SYMBOL (Qfboundp)
+#define iQfeatures 479
+DEFINE_LISP_SYMBOL (Qfeatures)
+#define iQfield 480
+DEFINE_LISP_SYMBOL (Qfield)
+#define iQfile_accessible_directory_p 481
+DEFINE_LISP_SYMBOL (Qfile_accessible_directory_p)
+#define iQfile_acl 482
+DEFINE_LISP_SYMBOL (Qfile_acl)
+#define iQfile_already_exists 483
+DEFINE_LISP_SYMBOL (Qfile_already_exists)
+#define iQfile_attributes 484
+DEFINE_LISP_SYMBOL (Qfile_attributes)
+#define iQfile_attributes_lessp 485
+DEFINE_LISP_SYMBOL (Qfile_attributes_lessp)
+#define iQfile_date_error 486
+DEFINE_LISP_SYMBOL (Qfile_date_error)
+#define iQfile_directory_p 487
+DEFINE_LISP_SYMBOL (Qfile_directory_p)
+#define iQfile_error 488
+DEFINE_LISP_SYMBOL (Qfile_error)
+#define iQfile_executable_p 489
+DEFINE_LISP_SYMBOL (Qfile_executable_p)
+#define iQfile_exists_p 490
+DEFINE_LISP_SYMBOL (Qfile_exists_p)
+#define iQfile_locked_p 491
+DEFINE_LISP_SYMBOL (Qfile_locked_p)
+#define iQfile_missing 492
+DEFINE_LISP_SYMBOL (Qfile_missing)
+#define iQfile_modes 493
+DEFINE_LISP_SYMBOL (Qfile_modes)
+#define iQfile_name_all_completions 494
+DEFINE_LISP_SYMBOL (Qfile_name_all_completions)
+#define iQfile_name_as_directory 495
+DEFINE_LISP_SYMBOL (Qfile_name_as_directory)
+#define iQfile_name_case_insensitive_p 496
+DEFINE_LISP_SYMBOL (Qfile_name_case_insensitive_p)
+#define iQfile_name_completion 497
+DEFINE_LISP_SYMBOL (Qfile_name_completion)
+#define iQfile_name_directory 498
+DEFINE_LISP_SYMBOL (Qfile_name_directory)
+#define iQfile_name_handler_alist 499
+DEFINE_LISP_SYMBOL (Qfile_name_handler_alist)
+#define iQfile_name_history 500
+DEFINE_LISP_SYMBOL (Qfile_name_history)
+#define iQfile_name_nondirectory 501
+DEFINE_LISP_SYMBOL (Qfile_name_nondirectory)
+#define iQfile_newer_than_file_p 502
+DEFINE_LISP_SYMBOL (Qfile_newer_than_file_p)
+#define iQfile_notify 503
+DEFINE_LISP_SYMBOL (Qfile_notify)
+#define iQfile_notify_error 504
+DEFINE_LISP_SYMBOL (Qfile_notify_error)
+#define iQfile_offset 505
+DEFINE_LISP_SYMBOL (Qfile_offset)
+#define iQfile_readable_p 506
+DEFINE_LISP_SYMBOL (Qfile_readable_p)
+#define iQfile_regular_p 507
+DEFINE_LISP_SYMBOL (Qfile_regular_p)
+#define iQfile_selinux_context 508
+DEFINE_LISP_SYMBOL (Qfile_selinux_context)
+#define iQfile_symlink_p 509
+DEFINE_LISP_SYMBOL (Qfile_symlink_p)
+#define iQfile_system_info 510
+DEFINE_LISP_SYMBOL (Qfile_system_info)
+#define iQfile_writable_p 511
+DEFINE_LISP_SYMBOL (Qfile_writable_p)
+#define iQfilenamep 512
+DEFINE_LISP_SYMBOL (Qfilenamep)
+#define iQfill_column_indicator 513
+DEFINE_LISP_SYMBOL (Qfill_column_indicator)
+#define iQfinalizer 514
+DEFINE_LISP_SYMBOL (Qfinalizer)
+#define iQfind_file_literally_line_length 515
+DEFINE_LISP_SYMBOL (Qfind_file_literally_line_length)
+#define iQfirst_change_hook 516
+DEFINE_LISP_SYMBOL (Qfirst_change_hook)
+#define iQfixnum 517
+DEFINE_LISP_SYMBOL (Qfixnum)
+#define iQfixnump 518
+DEFINE_LISP_SYMBOL (Qfixnump)
+#define iQflat_button 519
+DEFINE_LISP_SYMBOL (Qflat_button)
+#define iQfloat 520
+DEFINE_LISP_SYMBOL (Qfloat)
+#define iQfloatp 521
+DEFINE_LISP_SYMBOL (Qfloatp)
+#define iQfloats 522
+DEFINE_LISP_SYMBOL (Qfloats)
+#define iQfloor 523
+DEFINE_LISP_SYMBOL (Qfloor)
+#define iQfocus_in 524
+DEFINE_LISP_SYMBOL (Qfocus_in)
+#define iQfocus_out 525
+DEFINE_LISP_SYMBOL (Qfocus_out)
+#define iQfont 526
+DEFINE_LISP_SYMBOL (Qfont)
+#define iQfont_backend 527
+DEFINE_LISP_SYMBOL (Qfont_backend)
+#define iQfont_driver_superseded_by 528
+DEFINE_LISP_SYMBOL (Qfont_driver_superseded_by)
+#define iQfont_entity 529
+DEFINE_LISP_SYMBOL (Qfont_entity)
+#define iQfont_extra_type 530
+DEFINE_LISP_SYMBOL (Qfont_extra_type)
+#define iQfont_lock_face 531
+DEFINE_LISP_SYMBOL (Qfont_lock_face)
+#define iQfont_object 532
+DEFINE_LISP_SYMBOL (Qfont_object)
+#define iQfont_spec 533
+DEFINE_LISP_SYMBOL (Qfont_spec)
+#define iQfontification_functions 534
+DEFINE_LISP_SYMBOL (Qfontification_functions)
+#define iQfontified 535
+DEFINE_LISP_SYMBOL (Qfontified)
+#define iQforeground_color 536
+DEFINE_LISP_SYMBOL (Qforeground_color)
+#define iQformat_annotate_function 537
+DEFINE_LISP_SYMBOL (Qformat_annotate_function)
+#define iQformat_decode 538
+DEFINE_LISP_SYMBOL (Qformat_decode)
+#define iQfraction 539
+DEFINE_LISP_SYMBOL (Qfraction)
+#define iQframe 540
+DEFINE_LISP_SYMBOL (Qframe)
+#define iQframe_edges 541
+DEFINE_LISP_SYMBOL (Qframe_edges)
+#define iQframe_live_p 542
+DEFINE_LISP_SYMBOL (Qframe_live_p)
+#define iQframe_monitor_attributes 543
+DEFINE_LISP_SYMBOL (Qframe_monitor_attributes)
+#define iQframe_set_background_mode 544
+DEFINE_LISP_SYMBOL (Qframe_set_background_mode)
+#define iQframe_windows_min_size 545
+DEFINE_LISP_SYMBOL (Qframe_windows_min_size)
+#define iQframep 546
+DEFINE_LISP_SYMBOL (Qframep)
+#define iQframes 547
+DEFINE_LISP_SYMBOL (Qframes)
+#define iQfringe 548
+DEFINE_LISP_SYMBOL (Qfringe)
+#define iQfrom__tty_menu_p 549
+DEFINE_LISP_SYMBOL (Qfrom__tty_menu_p)
+#define iQfront_sticky 550
+DEFINE_LISP_SYMBOL (Qfront_sticky)
+#define iQfullboth 551
+DEFINE_LISP_SYMBOL (Qfullboth)
+#define iQfullheight 552
+DEFINE_LISP_SYMBOL (Qfullheight)
+#define iQfullscreen 553
+DEFINE_LISP_SYMBOL (Qfullscreen)
+#define iQfullwidth 554
+DEFINE_LISP_SYMBOL (Qfullwidth)
+#define iQfuncall 555
+DEFINE_LISP_SYMBOL (Qfuncall)
+#define iQfuncall_interactively 556
+DEFINE_LISP_SYMBOL (Qfuncall_interactively)
+#define iQfunction 557
+DEFINE_LISP_SYMBOL (Qfunction)
+#define iQfunction_documentation 558
+DEFINE_LISP_SYMBOL (Qfunction_documentation)
+#define iQfunction_history 559
+DEFINE_LISP_SYMBOL (Qfunction_history)
+#define iQfunction_key 560
+DEFINE_LISP_SYMBOL (Qfunction_key)
+#define iQfunctionp 561
+DEFINE_LISP_SYMBOL (Qfunctionp)
+#define iQfundamental_mode 562
+DEFINE_LISP_SYMBOL (Qfundamental_mode)
+#define iQfuture 563
+DEFINE_LISP_SYMBOL (Qfuture)
+#define iQfuturep 564
+DEFINE_LISP_SYMBOL (Qfuturep)
+#define iQgc_cons_percentage 565
+DEFINE_LISP_SYMBOL (Qgc_cons_percentage)
+#define iQgc_cons_threshold 566
+DEFINE_LISP_SYMBOL (Qgc_cons_threshold)
+#define iQgc_event_log_file 567
+DEFINE_LISP_SYMBOL (Qgc_event_log_file)
+#define iQgccjit 568
+DEFINE_LISP_SYMBOL (Qgccjit)
+#define iQgeometry 569
+DEFINE_LISP_SYMBOL (Qgeometry)
+#define iQget_buffer_window_list 570
+DEFINE_LISP_SYMBOL (Qget_buffer_window_list)
+#define iQget_emacs_mule_file_char 571
+DEFINE_LISP_SYMBOL (Qget_emacs_mule_file_char)
+#define iQget_file_buffer 572
+DEFINE_LISP_SYMBOL (Qget_file_buffer)
+#define iQget_file_char 573
+DEFINE_LISP_SYMBOL (Qget_file_char)
+#define iQget_mru_window 574
+DEFINE_LISP_SYMBOL (Qget_mru_window)
+#define iQget_scratch_buffer_create 575
+DEFINE_LISP_SYMBOL (Qget_scratch_buffer_create)
+#define iQglobal_mark_ring 576
+DEFINE_LISP_SYMBOL (Qglobal_mark_ring)
+#define iQglobal_mark_ring_max 577
+DEFINE_LISP_SYMBOL (Qglobal_mark_ring_max)
+#define iQglyphless_char 578
+DEFINE_LISP_SYMBOL (Qglyphless_char)
+#define iQglyphless_char_display 579
+DEFINE_LISP_SYMBOL (Qglyphless_char_display)
+#define iQgnutls_anon 580
+DEFINE_LISP_SYMBOL (Qgnutls_anon)
+#define iQgnutls_code 581
+DEFINE_LISP_SYMBOL (Qgnutls_code)
+#define iQgnutls_e_again 582
+DEFINE_LISP_SYMBOL (Qgnutls_e_again)
+#define iQgnutls_e_interrupted 583
+DEFINE_LISP_SYMBOL (Qgnutls_e_interrupted)
+#define iQgnutls_e_invalid_session 584
+DEFINE_LISP_SYMBOL (Qgnutls_e_invalid_session)
+#define iQgnutls_e_not_ready_for_handshake 585
+DEFINE_LISP_SYMBOL (Qgnutls_e_not_ready_for_handshake)
+#define iQgnutls_pkcs_null_password 586
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_null_password)
+#define iQgnutls_pkcs_pbes1_des_md5 587
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes1_des_md5)
+#define iQgnutls_pkcs_pbes2_3des 588
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_3des)
+#define iQgnutls_pkcs_pbes2_aes_128 589
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_128)
+#define iQgnutls_pkcs_pbes2_aes_192 590
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_192)
+#define iQgnutls_pkcs_pbes2_aes_256 591
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_aes_256)
+#define iQgnutls_pkcs_pbes2_des 592
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_des)
+#define iQgnutls_pkcs_pbes2_gost_cpa 593
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpa)
+#define iQgnutls_pkcs_pbes2_gost_cpb 594
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpb)
+#define iQgnutls_pkcs_pbes2_gost_cpc 595
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpc)
+#define iQgnutls_pkcs_pbes2_gost_cpd 596
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_cpd)
+#define iQgnutls_pkcs_pbes2_gost_tc26z 597
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pbes2_gost_tc26z)
+#define iQgnutls_pkcs_pkcs12_3des 598
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_3des)
+#define iQgnutls_pkcs_pkcs12_arcfour 599
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_arcfour)
+#define iQgnutls_pkcs_pkcs12_rc2_40 600
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_pkcs12_rc2_40)
+#define iQgnutls_pkcs_plain 601
+DEFINE_LISP_SYMBOL (Qgnutls_pkcs_plain)
+#define iQgnutls_type_cipher 602
+DEFINE_LISP_SYMBOL (Qgnutls_type_cipher)
+#define iQgnutls_type_digest_algorithm 603
+DEFINE_LISP_SYMBOL (Qgnutls_type_digest_algorithm)
+#define iQgnutls_type_mac_algorithm 604
+DEFINE_LISP_SYMBOL (Qgnutls_type_mac_algorithm)
+#define iQgnutls_x509pki 605
+DEFINE_LISP_SYMBOL (Qgnutls_x509pki)
+#define iQgrave 606
+DEFINE_LISP_SYMBOL (Qgrave)
+#define iQgroup 607
+DEFINE_LISP_SYMBOL (Qgroup)
+#define iQgrow_only 608
+DEFINE_LISP_SYMBOL (Qgrow_only)
+#define iQgui_figure_window_size 609
+DEFINE_LISP_SYMBOL (Qgui_figure_window_size)
+#define iQgui_set_selection 610
+DEFINE_LISP_SYMBOL (Qgui_set_selection)
+#define iQhaiku 611
+DEFINE_LISP_SYMBOL (Qhaiku)
+#define iQhand 612
+DEFINE_LISP_SYMBOL (Qhand)
+#define iQhandle 613
+DEFINE_LISP_SYMBOL (Qhandle)
+#define iQhandle_select_window 614
+DEFINE_LISP_SYMBOL (Qhandle_select_window)
+#define iQhandle_shift_selection 615
+DEFINE_LISP_SYMBOL (Qhandle_shift_selection)
+#define iQhandle_switch_frame 616
+DEFINE_LISP_SYMBOL (Qhandle_switch_frame)
+#define iQhash_table 617
+DEFINE_LISP_SYMBOL (Qhash_table)
+#define iQhash_table_p 618
+DEFINE_LISP_SYMBOL (Qhash_table_p)
+#define iQhash_table_test 619
+DEFINE_LISP_SYMBOL (Qhash_table_test)
+#define iQhbar 620
+DEFINE_LISP_SYMBOL (Qhbar)
+#define iQheader_line 621
+DEFINE_LISP_SYMBOL (Qheader_line)
+#define iQheader_line_format 622
+DEFINE_LISP_SYMBOL (Qheader_line_format)
+#define iQheap 623
+DEFINE_LISP_SYMBOL (Qheap)
+#define iQheavy 624
+DEFINE_LISP_SYMBOL (Qheavy)
+#define iQheight 625
+DEFINE_LISP_SYMBOL (Qheight)
+#define iQheight_only 626
+DEFINE_LISP_SYMBOL (Qheight_only)
+#define iQhelp__describe_map_tree 627
+DEFINE_LISP_SYMBOL (Qhelp__describe_map_tree)
+#define iQhelp_echo 628
+DEFINE_LISP_SYMBOL (Qhelp_echo)
+#define iQhelp_echo_inhibit_substitution 629
+DEFINE_LISP_SYMBOL (Qhelp_echo_inhibit_substitution)
+#define iQhelp_form_show 630
+DEFINE_LISP_SYMBOL (Qhelp_form_show)
+#define iQhelp_key_binding 631
+DEFINE_LISP_SYMBOL (Qhelp_key_binding)
+#define iQhelper_save_restriction 632
+DEFINE_LISP_SYMBOL (Qhelper_save_restriction)
+#define iQhelper_unbind_n 633
+DEFINE_LISP_SYMBOL (Qhelper_unbind_n)
+#define iQhelper_unwind_protect 634
+DEFINE_LISP_SYMBOL (Qhelper_unwind_protect)
+#define iQhex_code 635
+DEFINE_LISP_SYMBOL (Qhex_code)
+#define iQhide 636
+DEFINE_LISP_SYMBOL (Qhide)
+#define iQhollow 637
+DEFINE_LISP_SYMBOL (Qhollow)
+#define iQhorizontal_handle 638
+DEFINE_LISP_SYMBOL (Qhorizontal_handle)
+#define iQhorizontal_scroll_bar 639
+DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bar)
+#define iQhorizontal_scroll_bars 640
+DEFINE_LISP_SYMBOL (Qhorizontal_scroll_bars)
+#define iQhw 641
+DEFINE_LISP_SYMBOL (Qhw)
+#define iQicon 642
+DEFINE_LISP_SYMBOL (Qicon)
+#define iQicon_left 643
+DEFINE_LISP_SYMBOL (Qicon_left)
+#define iQicon_name 644
+DEFINE_LISP_SYMBOL (Qicon_name)
+#define iQicon_top 645
+DEFINE_LISP_SYMBOL (Qicon_top)
+#define iQicon_type 646
+DEFINE_LISP_SYMBOL (Qicon_type)
+#define iQiconify_frame 647
+DEFINE_LISP_SYMBOL (Qiconify_frame)
+#define iQiconify_top_level 648
+DEFINE_LISP_SYMBOL (Qiconify_top_level)
+#define iQidentity 649
+DEFINE_LISP_SYMBOL (Qidentity)
+#define iQif 650
+DEFINE_LISP_SYMBOL (Qif)
+#define iQif_regular 651
+DEFINE_LISP_SYMBOL (Qif_regular)
+#define iQignore_self_insert 652
+DEFINE_LISP_SYMBOL (Qignore_self_insert)
+#define iQignored 653
+DEFINE_LISP_SYMBOL (Qignored)
+#define iQimage 654
+DEFINE_LISP_SYMBOL (Qimage)
+#define iQinc_args 655
+DEFINE_LISP_SYMBOL (Qinc_args)
+#define iQinhibit_changing_match_data 656
+DEFINE_LISP_SYMBOL (Qinhibit_changing_match_data)
+#define iQinhibit_debugger 657
+DEFINE_LISP_SYMBOL (Qinhibit_debugger)
+#define iQinhibit_double_buffering 658
+DEFINE_LISP_SYMBOL (Qinhibit_double_buffering)
+#define iQinhibit_eval_during_redisplay 659
+DEFINE_LISP_SYMBOL (Qinhibit_eval_during_redisplay)
+#define iQinhibit_file_name_operation 660
+DEFINE_LISP_SYMBOL (Qinhibit_file_name_operation)
+#define iQinhibit_free_realized_faces 661
+DEFINE_LISP_SYMBOL (Qinhibit_free_realized_faces)
+#define iQinhibit_menubar_update 662
+DEFINE_LISP_SYMBOL (Qinhibit_menubar_update)
+#define iQinhibit_modification_hooks 663
+DEFINE_LISP_SYMBOL (Qinhibit_modification_hooks)
+#define iQinhibit_point_motion_hooks 664
+DEFINE_LISP_SYMBOL (Qinhibit_point_motion_hooks)
+#define iQinhibit_quit 665
+DEFINE_LISP_SYMBOL (Qinhibit_quit)
+#define iQinhibit_read_only 666
+DEFINE_LISP_SYMBOL (Qinhibit_read_only)
+#define iQinhibit_redisplay 667
+DEFINE_LISP_SYMBOL (Qinhibit_redisplay)
+#define iQinhibited_interaction 668
+DEFINE_LISP_SYMBOL (Qinhibited_interaction)
+#define iQinner_edges 669
+DEFINE_LISP_SYMBOL (Qinner_edges)
+#define iQinput_method_exit_on_first_char 670
+DEFINE_LISP_SYMBOL (Qinput_method_exit_on_first_char)
+#define iQinput_method_use_echo_area 671
+DEFINE_LISP_SYMBOL (Qinput_method_use_echo_area)
+#define iQinsert_behind_hooks 672
+DEFINE_LISP_SYMBOL (Qinsert_behind_hooks)
+#define iQinsert_file_contents 673
+DEFINE_LISP_SYMBOL (Qinsert_file_contents)
+#define iQinsert_in_front_hooks 674
+DEFINE_LISP_SYMBOL (Qinsert_in_front_hooks)
+#define iQinserted_chars 675
+DEFINE_LISP_SYMBOL (Qinserted_chars)
+#define iQinsufficient_source 676
+DEFINE_LISP_SYMBOL (Qinsufficient_source)
+#define iQintangible 677
+DEFINE_LISP_SYMBOL (Qintangible)
+#define iQinteger 678
+DEFINE_LISP_SYMBOL (Qinteger)
+#define iQinteger_or_marker_p 679
+DEFINE_LISP_SYMBOL (Qinteger_or_marker_p)
+#define iQintegerp 680
+DEFINE_LISP_SYMBOL (Qintegerp)
+#define iQinteractive 681
+DEFINE_LISP_SYMBOL (Qinteractive)
+#define iQinteractive_args 682
+DEFINE_LISP_SYMBOL (Qinteractive_args)
+#define iQinteractive_form 683
+DEFINE_LISP_SYMBOL (Qinteractive_form)
+#define iQinteractive_p 684
+DEFINE_LISP_SYMBOL (Qinteractive_p)
+#define iQinternal__syntax_propertize 685
+DEFINE_LISP_SYMBOL (Qinternal__syntax_propertize)
+#define iQinternal_auto_fill 686
+DEFINE_LISP_SYMBOL (Qinternal_auto_fill)
+#define iQinternal_border 687
+DEFINE_LISP_SYMBOL (Qinternal_border)
+#define iQinternal_border_width 688
+DEFINE_LISP_SYMBOL (Qinternal_border_width)
+#define iQinternal_default_interrupt_process 689
+DEFINE_LISP_SYMBOL (Qinternal_default_interrupt_process)
+#define iQinternal_default_process_filter 690
+DEFINE_LISP_SYMBOL (Qinternal_default_process_filter)
+#define iQinternal_default_process_sentinel 691
+DEFINE_LISP_SYMBOL (Qinternal_default_process_sentinel)
+#define iQinternal_default_signal_process 692
+DEFINE_LISP_SYMBOL (Qinternal_default_signal_process)
+#define iQinternal_echo_keystrokes_prefix 693
+DEFINE_LISP_SYMBOL (Qinternal_echo_keystrokes_prefix)
+#define iQinternal_when_entered_debugger 694
+DEFINE_LISP_SYMBOL (Qinternal_when_entered_debugger)
+#define iQinterrupt_process_functions 695
+DEFINE_LISP_SYMBOL (Qinterrupt_process_functions)
+#define iQinterrupted 696
+DEFINE_LISP_SYMBOL (Qinterrupted)
+#define iQintervals 697
+DEFINE_LISP_SYMBOL (Qintervals)
+#define iQinvalid_function 698
+DEFINE_LISP_SYMBOL (Qinvalid_function)
+#define iQinvalid_read_syntax 699
+DEFINE_LISP_SYMBOL (Qinvalid_read_syntax)
+#define iQinvalid_regexp 700
+DEFINE_LISP_SYMBOL (Qinvalid_regexp)
+#define iQinvalid_source 701
+DEFINE_LISP_SYMBOL (Qinvalid_source)
+#define iQinvisible 702
+DEFINE_LISP_SYMBOL (Qinvisible)
+#define iQipv4 703
+DEFINE_LISP_SYMBOL (Qipv4)
+#define iQipv6 704
+DEFINE_LISP_SYMBOL (Qipv6)
+#define iQiso10646_1 705
+DEFINE_LISP_SYMBOL (Qiso10646_1)
+#define iQiso8859_1 706
+DEFINE_LISP_SYMBOL (Qiso8859_1)
+#define iQiso_2022 707
+DEFINE_LISP_SYMBOL (Qiso_2022)
+#define iQiso_8859_1 708
+DEFINE_LISP_SYMBOL (Qiso_8859_1)
+#define iQitalic 709
+DEFINE_LISP_SYMBOL (Qitalic)
+#define iQiv_auto 710
+DEFINE_LISP_SYMBOL (Qiv_auto)
+#define iQja 711
+DEFINE_LISP_SYMBOL (Qja)
+#define iQjump 712
+DEFINE_LISP_SYMBOL (Qjump)
+#define iQkbd_macro_termination_hook 713
+DEFINE_LISP_SYMBOL (Qkbd_macro_termination_hook)
+#define iQkeep_ratio 714
+DEFINE_LISP_SYMBOL (Qkeep_ratio)
+#define iQkey 715
+DEFINE_LISP_SYMBOL (Qkey)
+#define iQkey_and_value 716
+DEFINE_LISP_SYMBOL (Qkey_and_value)
+#define iQkey_or_value 717
+DEFINE_LISP_SYMBOL (Qkey_or_value)
+#define iQkey_parse 718
+DEFINE_LISP_SYMBOL (Qkey_parse)
+#define iQkey_valid_p 719
+DEFINE_LISP_SYMBOL (Qkey_valid_p)
+#define iQkeymap 720
+DEFINE_LISP_SYMBOL (Qkeymap)
+#define iQkeymap_canonicalize 721
+DEFINE_LISP_SYMBOL (Qkeymap_canonicalize)
+#define iQkeymapp 722
+DEFINE_LISP_SYMBOL (Qkeymapp)
+#define iQkill_buffer__possibly_save 723
+DEFINE_LISP_SYMBOL (Qkill_buffer__possibly_save)
+#define iQkill_buffer_hook 724
+DEFINE_LISP_SYMBOL (Qkill_buffer_hook)
+#define iQkill_buffer_query_functions 725
+DEFINE_LISP_SYMBOL (Qkill_buffer_query_functions)
+#define iQkill_emacs 726
+DEFINE_LISP_SYMBOL (Qkill_emacs)
+#define iQkill_emacs_hook 727
+DEFINE_LISP_SYMBOL (Qkill_emacs_hook)
+#define iQkill_forward_chars 728
+DEFINE_LISP_SYMBOL (Qkill_forward_chars)
+#define iQko 729
+DEFINE_LISP_SYMBOL (Qko)
+#define iQlambda_fixup 730
+DEFINE_LISP_SYMBOL (Qlambda_fixup)
+#define iQlanguage_change 731
+DEFINE_LISP_SYMBOL (Qlanguage_change)
+#define iQlast_arrow_position 732
+DEFINE_LISP_SYMBOL (Qlast_arrow_position)
+#define iQlast_arrow_string 733
+DEFINE_LISP_SYMBOL (Qlast_arrow_string)
+#define iQlast_nonmenu_event 734
+DEFINE_LISP_SYMBOL (Qlast_nonmenu_event)
+#define iQlast_selected_window 735
+DEFINE_LISP_SYMBOL (Qlast_selected_window)
+#define iQlate 736
+DEFINE_LISP_SYMBOL (Qlate)
+#define iQleft 737
+DEFINE_LISP_SYMBOL (Qleft)
+#define iQleft_edge 738
+DEFINE_LISP_SYMBOL (Qleft_edge)
+#define iQleft_fringe 739
+DEFINE_LISP_SYMBOL (Qleft_fringe)
+#define iQleft_margin 740
+DEFINE_LISP_SYMBOL (Qleft_margin)
+#define iQleft_only 741
+DEFINE_LISP_SYMBOL (Qleft_only)
+#define iQleft_to_right 742
+DEFINE_LISP_SYMBOL (Qleft_to_right)
+#define iQleftmost 743
+DEFINE_LISP_SYMBOL (Qleftmost)
+#define iQlet 744
+DEFINE_LISP_SYMBOL (Qlet)
+#define iQletx 745
+DEFINE_LISP_SYMBOL (Qletx)
+#define iQlexical_binding 746
+DEFINE_LISP_SYMBOL (Qlexical_binding)
+#define iQlight 747
+DEFINE_LISP_SYMBOL (Qlight)
+#define iQline 748
+DEFINE_LISP_SYMBOL (Qline)
+#define iQline_height 749
+DEFINE_LISP_SYMBOL (Qline_height)
+#define iQline_number 750
+DEFINE_LISP_SYMBOL (Qline_number)
+#define iQline_number_current_line 751
+DEFINE_LISP_SYMBOL (Qline_number_current_line)
+#define iQline_number_major_tick 752
+DEFINE_LISP_SYMBOL (Qline_number_major_tick)
+#define iQline_number_minor_tick 753
+DEFINE_LISP_SYMBOL (Qline_number_minor_tick)
+#define iQline_prefix 754
+DEFINE_LISP_SYMBOL (Qline_prefix)
+#define iQline_spacing 755
+DEFINE_LISP_SYMBOL (Qline_spacing)
+#define iQlisp_directory 756
+DEFINE_LISP_SYMBOL (Qlisp_directory)
+#define iQlist 757
+DEFINE_LISP_SYMBOL (Qlist)
+#define iQlist_or_vector_p 758
+DEFINE_LISP_SYMBOL (Qlist_or_vector_p)
+#define iQlist_system_processes 759
+DEFINE_LISP_SYMBOL (Qlist_system_processes)
+#define iQlisten 760
+DEFINE_LISP_SYMBOL (Qlisten)
+#define iQlistp 761
+DEFINE_LISP_SYMBOL (Qlistp)
+#define iQlittle 762
+DEFINE_LISP_SYMBOL (Qlittle)
+#define iQload 763
+DEFINE_LISP_SYMBOL (Qload)
+#define iQload_file_name 764
+DEFINE_LISP_SYMBOL (Qload_file_name)
+#define iQload_force_doc_strings 765
+DEFINE_LISP_SYMBOL (Qload_force_doc_strings)
+#define iQload_in_progress 766
+DEFINE_LISP_SYMBOL (Qload_in_progress)
+#define iQload_time 767
+DEFINE_LISP_SYMBOL (Qload_time)
+#define iQload_true_file_name 768
+DEFINE_LISP_SYMBOL (Qload_true_file_name)
+#define iQlocal 769
+DEFINE_LISP_SYMBOL (Qlocal)
+#define iQlocal_map 770
+DEFINE_LISP_SYMBOL (Qlocal_map)
+#define iQlock_file 771
+DEFINE_LISP_SYMBOL (Qlock_file)
+#define iQlong 772
+DEFINE_LISP_SYMBOL (Qlong)
+#define iQlowercase 773
+DEFINE_LISP_SYMBOL (Qlowercase)
+#define iQlread_unescaped_character_literals 774
+DEFINE_LISP_SYMBOL (Qlread_unescaped_character_literals)
+#define iQm 775
+DEFINE_LISP_SYMBOL (Qm)
+#define iQmac 776
+DEFINE_LISP_SYMBOL (Qmac)
+#define iQmacro 777
+DEFINE_LISP_SYMBOL (Qmacro)
+#define iQmacroexp__dynvars 778
+DEFINE_LISP_SYMBOL (Qmacroexp__dynvars)
+#define iQmajflt 779
+DEFINE_LISP_SYMBOL (Qmajflt)
+#define iQmake_cursor_line_fully_visible 780
+DEFINE_LISP_SYMBOL (Qmake_cursor_line_fully_visible)
+#define iQmake_directory 781
+DEFINE_LISP_SYMBOL (Qmake_directory)
+#define iQmake_directory_internal 782
+DEFINE_LISP_SYMBOL (Qmake_directory_internal)
+#define iQmake_frame_visible 783
+DEFINE_LISP_SYMBOL (Qmake_frame_visible)
+#define iQmake_invisible 784
+DEFINE_LISP_SYMBOL (Qmake_invisible)
+#define iQmake_lock_file_name 785
+DEFINE_LISP_SYMBOL (Qmake_lock_file_name)
+#define iQmake_process 786
+DEFINE_LISP_SYMBOL (Qmake_process)
+#define iQmake_symbolic_link 787
+DEFINE_LISP_SYMBOL (Qmake_symbolic_link)
+#define iQmake_window_start_visible 788
+DEFINE_LISP_SYMBOL (Qmake_window_start_visible)
+#define iQmakunbound 789
+DEFINE_LISP_SYMBOL (Qmakunbound)
+#define iQmany 790
+DEFINE_LISP_SYMBOL (Qmany)
+#define iQmargin 791
+DEFINE_LISP_SYMBOL (Qmargin)
+#define iQmark_for_redisplay 792
+DEFINE_LISP_SYMBOL (Qmark_for_redisplay)
+#define iQmark_inactive 793
+DEFINE_LISP_SYMBOL (Qmark_inactive)
+#define iQmarker 794
+DEFINE_LISP_SYMBOL (Qmarker)
+#define iQmarkerp 795
+DEFINE_LISP_SYMBOL (Qmarkerp)
+#define iQmaximized 796
+DEFINE_LISP_SYMBOL (Qmaximized)
+#define iQmd5 797
+DEFINE_LISP_SYMBOL (Qmd5)
+#define iQmedium 798
+DEFINE_LISP_SYMBOL (Qmedium)
+#define iQmemory_info 799
+DEFINE_LISP_SYMBOL (Qmemory_info)
+#define iQmenu 800
+DEFINE_LISP_SYMBOL (Qmenu)
+#define iQmenu_bar 801
+DEFINE_LISP_SYMBOL (Qmenu_bar)
+#define iQmenu_bar_external 802
+DEFINE_LISP_SYMBOL (Qmenu_bar_external)
+#define iQmenu_bar_lines 803
+DEFINE_LISP_SYMBOL (Qmenu_bar_lines)
+#define iQmenu_bar_size 804
+DEFINE_LISP_SYMBOL (Qmenu_bar_size)
+#define iQmenu_bar_update_hook 805
+DEFINE_LISP_SYMBOL (Qmenu_bar_update_hook)
+#define iQmenu_enable 806
+DEFINE_LISP_SYMBOL (Qmenu_enable)
+#define iQmenu_item 807
+DEFINE_LISP_SYMBOL (Qmenu_item)
+#define iQmessage 808
+DEFINE_LISP_SYMBOL (Qmessage)
+#define iQmetadata 809
+DEFINE_LISP_SYMBOL (Qmetadata)
+#define iQmin_height 810
+DEFINE_LISP_SYMBOL (Qmin_height)
+#define iQmin_width 811
+DEFINE_LISP_SYMBOL (Qmin_width)
+#define iQminflt 812
+DEFINE_LISP_SYMBOL (Qminflt)
+#define iQminibuffer 813
+DEFINE_LISP_SYMBOL (Qminibuffer)
+#define iQminibuffer_completing_file_name 814
+DEFINE_LISP_SYMBOL (Qminibuffer_completing_file_name)
+#define iQminibuffer_completion_table 815
+DEFINE_LISP_SYMBOL (Qminibuffer_completion_table)
+#define iQminibuffer_default 816
+DEFINE_LISP_SYMBOL (Qminibuffer_default)
+#define iQminibuffer_exit 817
+DEFINE_LISP_SYMBOL (Qminibuffer_exit)
+#define iQminibuffer_exit_hook 818
+DEFINE_LISP_SYMBOL (Qminibuffer_exit_hook)
+#define iQminibuffer_follows_selected_frame 819
+DEFINE_LISP_SYMBOL (Qminibuffer_follows_selected_frame)
+#define iQminibuffer_history 820
+DEFINE_LISP_SYMBOL (Qminibuffer_history)
+#define iQminibuffer_inactive_mode 821
+DEFINE_LISP_SYMBOL (Qminibuffer_inactive_mode)
+#define iQminibuffer_mode 822
+DEFINE_LISP_SYMBOL (Qminibuffer_mode)
+#define iQminibuffer_prompt 823
+DEFINE_LISP_SYMBOL (Qminibuffer_prompt)
+#define iQminibuffer_quit 824
+DEFINE_LISP_SYMBOL (Qminibuffer_quit)
+#define iQminibuffer_setup_hook 825
+DEFINE_LISP_SYMBOL (Qminibuffer_setup_hook)
+#define iQminus 826
+DEFINE_LISP_SYMBOL (Qminus)
+#define iQmirroring 827
+DEFINE_LISP_SYMBOL (Qmirroring)
+#define iQmm_size 828
+DEFINE_LISP_SYMBOL (Qmm_size)
+#define iQmode_class 829
+DEFINE_LISP_SYMBOL (Qmode_class)
+#define iQmode_line 830
+DEFINE_LISP_SYMBOL (Qmode_line)
+#define iQmode_line_active 831
+DEFINE_LISP_SYMBOL (Qmode_line_active)
+#define iQmode_line_default_help_echo 832
+DEFINE_LISP_SYMBOL (Qmode_line_default_help_echo)
+#define iQmode_line_format 833
+DEFINE_LISP_SYMBOL (Qmode_line_format)
+#define iQmode_line_inactive 834
+DEFINE_LISP_SYMBOL (Qmode_line_inactive)
+#define iQmodeline 835
+DEFINE_LISP_SYMBOL (Qmodeline)
+#define iQmodification_hooks 836
+DEFINE_LISP_SYMBOL (Qmodification_hooks)
+#define iQmodifier_cache 837
+DEFINE_LISP_SYMBOL (Qmodifier_cache)
+#define iQmodule_function 838
+DEFINE_LISP_SYMBOL (Qmodule_function)
+#define iQmonths 839
+DEFINE_LISP_SYMBOL (Qmonths)
+#define iQmouse 840
+DEFINE_LISP_SYMBOL (Qmouse)
+#define iQmouse_click 841
+DEFINE_LISP_SYMBOL (Qmouse_click)
+#define iQmouse_color 842
+DEFINE_LISP_SYMBOL (Qmouse_color)
+#define iQmouse_face 843
+DEFINE_LISP_SYMBOL (Qmouse_face)
+#define iQmouse_fixup_help_message 844
+DEFINE_LISP_SYMBOL (Qmouse_fixup_help_message)
+#define iQmouse_leave_buffer_hook 845
+DEFINE_LISP_SYMBOL (Qmouse_leave_buffer_hook)
+#define iQmouse_movement 846
+DEFINE_LISP_SYMBOL (Qmouse_movement)
+#define iQmouse_wheel_frame 847
+DEFINE_LISP_SYMBOL (Qmouse_wheel_frame)
+#define iQmove_frame 848
+DEFINE_LISP_SYMBOL (Qmove_frame)
+#define iQmove_toolbar 849
+DEFINE_LISP_SYMBOL (Qmove_toolbar)
+#define iQmutex 850
+DEFINE_LISP_SYMBOL (Qmutex)
+#define iQmutexp 851
+DEFINE_LISP_SYMBOL (Qmutexp)
+#define iQname 852
+DEFINE_LISP_SYMBOL (Qname)
+#define iQnative__compile_async 853
+DEFINE_LISP_SYMBOL (Qnative__compile_async)
+#define iQnative_comp_compiler_options 854
+DEFINE_LISP_SYMBOL (Qnative_comp_compiler_options)
+#define iQnative_comp_debug 855
+DEFINE_LISP_SYMBOL (Qnative_comp_debug)
+#define iQnative_comp_driver_options 856
+DEFINE_LISP_SYMBOL (Qnative_comp_driver_options)
+#define iQnative_comp_speed 857
+DEFINE_LISP_SYMBOL (Qnative_comp_speed)
+#define iQnative_comp_unit 858
+DEFINE_LISP_SYMBOL (Qnative_comp_unit)
+#define iQnative_comp_warning_on_missing_source 859
+DEFINE_LISP_SYMBOL (Qnative_comp_warning_on_missing_source)
+#define iQnative_compiler_error 860
+DEFINE_LISP_SYMBOL (Qnative_compiler_error)
+#define iQnative_edges 861
+DEFINE_LISP_SYMBOL (Qnative_edges)
+#define iQnative_ice 862
+DEFINE_LISP_SYMBOL (Qnative_ice)
+#define iQnative_lisp_file_inconsistent 863
+DEFINE_LISP_SYMBOL (Qnative_lisp_file_inconsistent)
+#define iQnative_lisp_load_failed 864
+DEFINE_LISP_SYMBOL (Qnative_lisp_load_failed)
+#define iQnative_lisp_wrong_reloc 865
+DEFINE_LISP_SYMBOL (Qnative_lisp_wrong_reloc)
+#define iQnatnump 866
+DEFINE_LISP_SYMBOL (Qnatnump)
+#define iQnegate 867
+DEFINE_LISP_SYMBOL (Qnegate)
+#define iQnetwork 868
+DEFINE_LISP_SYMBOL (Qnetwork)
+#define iQnice 869
+DEFINE_LISP_SYMBOL (Qnice)
+#define iQno_accept_focus 870
+DEFINE_LISP_SYMBOL (Qno_accept_focus)
+#define iQno_catch 871
+DEFINE_LISP_SYMBOL (Qno_catch)
+#define iQno_conversion 872
+DEFINE_LISP_SYMBOL (Qno_conversion)
+#define iQno_focus_on_map 873
+DEFINE_LISP_SYMBOL (Qno_focus_on_map)
+#define iQno_other_frame 874
+DEFINE_LISP_SYMBOL (Qno_other_frame)
+#define iQno_other_window 875
+DEFINE_LISP_SYMBOL (Qno_other_window)
+#define iQno_record 876
+DEFINE_LISP_SYMBOL (Qno_record)
+#define iQno_special_glyphs 877
+DEFINE_LISP_SYMBOL (Qno_special_glyphs)
+#define iQnobreak_hyphen 878
+DEFINE_LISP_SYMBOL (Qnobreak_hyphen)
+#define iQnobreak_space 879
+DEFINE_LISP_SYMBOL (Qnobreak_space)
+#define iQnoelisp 880
+DEFINE_LISP_SYMBOL (Qnoelisp)
+#define iQnon_ascii 881
+DEFINE_LISP_SYMBOL (Qnon_ascii)
+#define iQnon_key_event 882
+DEFINE_LISP_SYMBOL (Qnon_key_event)
+#define iQnone 883
+DEFINE_LISP_SYMBOL (Qnone)
+#define iQnormal 884
+DEFINE_LISP_SYMBOL (Qnormal)
+#define iQnormal_top_level 885
+DEFINE_LISP_SYMBOL (Qnormal_top_level)
+#define iQns 886
+DEFINE_LISP_SYMBOL (Qns)
+#define iQns_appearance 887
+DEFINE_LISP_SYMBOL (Qns_appearance)
+#define iQns_parse_geometry 888
+DEFINE_LISP_SYMBOL (Qns_parse_geometry)
+#define iQns_transparent_titlebar 889
+DEFINE_LISP_SYMBOL (Qns_transparent_titlebar)
+#define iQnsm_verify_connection 890
+DEFINE_LISP_SYMBOL (Qnsm_verify_connection)
+#define iQnth 891
+DEFINE_LISP_SYMBOL (Qnth)
+#define iQnull 892
+DEFINE_LISP_SYMBOL (Qnull)
+#define iQnumber_or_marker_p 893
+DEFINE_LISP_SYMBOL (Qnumber_or_marker_p)
+#define iQnumberp 894
+DEFINE_LISP_SYMBOL (Qnumberp)
+#define iQnumeric 895
+DEFINE_LISP_SYMBOL (Qnumeric)
+#define iQobarray_cache 896
+DEFINE_LISP_SYMBOL (Qobarray_cache)
+#define iQobarrayp 897
+DEFINE_LISP_SYMBOL (Qobarrayp)
+#define iQobject 898
+DEFINE_LISP_SYMBOL (Qobject)
+#define iQoblique 899
+DEFINE_LISP_SYMBOL (Qoblique)
+#define iQoclosure_interactive_form 900
+DEFINE_LISP_SYMBOL (Qoclosure_interactive_form)
+#define iQodd 901
+DEFINE_LISP_SYMBOL (Qodd)
+#define iQonly 902
+DEFINE_LISP_SYMBOL (Qonly)
+#define iQopen 903
+DEFINE_LISP_SYMBOL (Qopen)
+#define iQopen_network_stream 904
+DEFINE_LISP_SYMBOL (Qopen_network_stream)
+#define iQopentype 905
+DEFINE_LISP_SYMBOL (Qopentype)
+#define iQoperations 906
+DEFINE_LISP_SYMBOL (Qoperations)
+#define iQouter_border_width 907
+DEFINE_LISP_SYMBOL (Qouter_border_width)
+#define iQouter_edges 908
+DEFINE_LISP_SYMBOL (Qouter_edges)
+#define iQouter_position 909
+DEFINE_LISP_SYMBOL (Qouter_position)
+#define iQouter_size 910
+DEFINE_LISP_SYMBOL (Qouter_size)
+#define iQouter_window_id 911
+DEFINE_LISP_SYMBOL (Qouter_window_id)
+#define iQoverflow_error 912
+DEFINE_LISP_SYMBOL (Qoverflow_error)
+#define iQoverlay 913
+DEFINE_LISP_SYMBOL (Qoverlay)
+#define iQoverlay_arrow_bitmap 914
+DEFINE_LISP_SYMBOL (Qoverlay_arrow_bitmap)
+#define iQoverlay_arrow_string 915
+DEFINE_LISP_SYMBOL (Qoverlay_arrow_string)
+#define iQoverlayp 916
+DEFINE_LISP_SYMBOL (Qoverlayp)
+#define iQoverride_redirect 917
+DEFINE_LISP_SYMBOL (Qoverride_redirect)
+#define iQoverriding_local_map 918
+DEFINE_LISP_SYMBOL (Qoverriding_local_map)
+#define iQoverriding_plist_environment 919
+DEFINE_LISP_SYMBOL (Qoverriding_plist_environment)
+#define iQoverriding_terminal_local_map 920
+DEFINE_LISP_SYMBOL (Qoverriding_terminal_local_map)
+#define iQoverwrite_mode 921
+DEFINE_LISP_SYMBOL (Qoverwrite_mode)
+#define iQoverwrite_mode_binary 922
+DEFINE_LISP_SYMBOL (Qoverwrite_mode_binary)
+#define iQp 923
+DEFINE_LISP_SYMBOL (Qp)
+#define iQpaper 924
+DEFINE_LISP_SYMBOL (Qpaper)
+#define iQparent_frame 925
+DEFINE_LISP_SYMBOL (Qparent_frame)
+#define iQparent_id 926
+DEFINE_LISP_SYMBOL (Qparent_id)
+#define iQpc 927
+DEFINE_LISP_SYMBOL (Qpc)
+#define iQpcpu 928
+DEFINE_LISP_SYMBOL (Qpcpu)
+#define iQpermanent_local 929
+DEFINE_LISP_SYMBOL (Qpermanent_local)
+#define iQpermanent_local_hook 930
+DEFINE_LISP_SYMBOL (Qpermanent_local_hook)
+#define iQpermission_denied 931
+DEFINE_LISP_SYMBOL (Qpermission_denied)
+#define iQpgrp 932
+DEFINE_LISP_SYMBOL (Qpgrp)
+#define iQpgtk 933
+DEFINE_LISP_SYMBOL (Qpgtk)
+#define iQphi 934
+DEFINE_LISP_SYMBOL (Qphi)
+#define iQpinch 935
+DEFINE_LISP_SYMBOL (Qpinch)
+#define iQpipe 936
+DEFINE_LISP_SYMBOL (Qpipe)
+#define iQpipe_process_p 937
+DEFINE_LISP_SYMBOL (Qpipe_process_p)
+#define iQplay_sound_functions 938
+DEFINE_LISP_SYMBOL (Qplay_sound_functions)
+#define iQplistp 939
+DEFINE_LISP_SYMBOL (Qplistp)
+#define iQplus 940
+DEFINE_LISP_SYMBOL (Qplus)
+#define iQpmem 941
+DEFINE_LISP_SYMBOL (Qpmem)
+#define iQpoint_entered 942
+DEFINE_LISP_SYMBOL (Qpoint_entered)
+#define iQpoint_left 943
+DEFINE_LISP_SYMBOL (Qpoint_left)
+#define iQpointer 944
+DEFINE_LISP_SYMBOL (Qpointer)
+#define iQpolling_period 945
+DEFINE_LISP_SYMBOL (Qpolling_period)
+#define iQpoly 946
+DEFINE_LISP_SYMBOL (Qpoly)
+#define iQposition 947
+DEFINE_LISP_SYMBOL (Qposition)
+#define iQpost_command_hook 948
+DEFINE_LISP_SYMBOL (Qpost_command_hook)
+#define iQpost_gc_hook 949
+DEFINE_LISP_SYMBOL (Qpost_gc_hook)
+#define iQpost_select_region_hook 950
+DEFINE_LISP_SYMBOL (Qpost_select_region_hook)
+#define iQpost_self_insert_hook 951
+DEFINE_LISP_SYMBOL (Qpost_self_insert_hook)
+#define iQppid 952
+DEFINE_LISP_SYMBOL (Qppid)
+#define iQpre_command_hook 953
+DEFINE_LISP_SYMBOL (Qpre_command_hook)
+#define iQpreedit_text 954
+DEFINE_LISP_SYMBOL (Qpreedit_text)
+#define iQpressed_button 955
+DEFINE_LISP_SYMBOL (Qpressed_button)
+#define iQpri 956
+DEFINE_LISP_SYMBOL (Qpri)
+#define iQprint__unreadable_callback_buffer 957
+DEFINE_LISP_SYMBOL (Qprint__unreadable_callback_buffer)
+#define iQprint_escape_multibyte 958
+DEFINE_LISP_SYMBOL (Qprint_escape_multibyte)
+#define iQprint_escape_nonascii 959
+DEFINE_LISP_SYMBOL (Qprint_escape_nonascii)
+#define iQprint_unreadable_function 960
+DEFINE_LISP_SYMBOL (Qprint_unreadable_function)
+#define iQpriority 961
+DEFINE_LISP_SYMBOL (Qpriority)
+#define iQprocess 962
+DEFINE_LISP_SYMBOL (Qprocess)
+#define iQprocess_attributes 963
+DEFINE_LISP_SYMBOL (Qprocess_attributes)
+#define iQprocessp 964
+DEFINE_LISP_SYMBOL (Qprocessp)
+#define iQprogn 965
+DEFINE_LISP_SYMBOL (Qprogn)
+#define iQpropertize 966
+DEFINE_LISP_SYMBOL (Qpropertize)
+#define iQprotected_field 967
+DEFINE_LISP_SYMBOL (Qprotected_field)
+#define iQprovide 968
+DEFINE_LISP_SYMBOL (Qprovide)
+#define iQpty 969
+DEFINE_LISP_SYMBOL (Qpty)
+#define iQpurecopy 970
+DEFINE_LISP_SYMBOL (Qpurecopy)
+#define iQpush_exception 971
+DEFINE_LISP_SYMBOL (Qpush_exception)
+#define iQpush_window_buffer_onto_prev 972
+DEFINE_LISP_SYMBOL (Qpush_window_buffer_onto_prev)
+#define iQquit 973
+DEFINE_LISP_SYMBOL (Qquit)
+#define iQquote 974
+DEFINE_LISP_SYMBOL (Qquote)
+#define iQraise 975
+DEFINE_LISP_SYMBOL (Qraise)
+#define iQrange 976
+DEFINE_LISP_SYMBOL (Qrange)
+#define iQrange_error 977
+DEFINE_LISP_SYMBOL (Qrange_error)
+#define iQratio 978
+DEFINE_LISP_SYMBOL (Qratio)
+#define iQraw_text 979
+DEFINE_LISP_SYMBOL (Qraw_text)
+#define iQread 980
+DEFINE_LISP_SYMBOL (Qread)
+#define iQread_char 981
+DEFINE_LISP_SYMBOL (Qread_char)
+#define iQread_number 982
+DEFINE_LISP_SYMBOL (Qread_number)
+#define iQread_only 983
+DEFINE_LISP_SYMBOL (Qread_only)
+#define iQreal 984
+DEFINE_LISP_SYMBOL (Qreal)
+#define iQreal_this_command 985
+DEFINE_LISP_SYMBOL (Qreal_this_command)
+#define iQrear_nonsticky 986
+DEFINE_LISP_SYMBOL (Qrear_nonsticky)
+#define iQrecord 987
+DEFINE_LISP_SYMBOL (Qrecord)
+#define iQrecord_unwind_current_buffer 988
+DEFINE_LISP_SYMBOL (Qrecord_unwind_current_buffer)
+#define iQrecord_unwind_protect_excursion 989
+DEFINE_LISP_SYMBOL (Qrecord_unwind_protect_excursion)
+#define iQrecord_window_buffer 990
+DEFINE_LISP_SYMBOL (Qrecord_window_buffer)
+#define iQrecordp 991
+DEFINE_LISP_SYMBOL (Qrecordp)
+#define iQrect 992
+DEFINE_LISP_SYMBOL (Qrect)
+#define iQrecursion_error 993
+DEFINE_LISP_SYMBOL (Qrecursion_error)
+#define iQredisplay_dont_pause 994
+DEFINE_LISP_SYMBOL (Qredisplay_dont_pause)
+#define iQredisplay_internal_xC_functionx 995
+DEFINE_LISP_SYMBOL (Qredisplay_internal_xC_functionx)
+#define iQrelative 996
+DEFINE_LISP_SYMBOL (Qrelative)
+#define iQreleased_button 997
+DEFINE_LISP_SYMBOL (Qreleased_button)
+#define iQremap 998
+DEFINE_LISP_SYMBOL (Qremap)
+#define iQremote_file_error 999
+DEFINE_LISP_SYMBOL (Qremote_file_error)
+#define iQrename_file 1000
+DEFINE_LISP_SYMBOL (Qrename_file)
+#define iQreplace_buffer_in_windows 1001
+DEFINE_LISP_SYMBOL (Qreplace_buffer_in_windows)
+#define iQrequire 1002
+DEFINE_LISP_SYMBOL (Qrequire)
+#define iQreset 1003
+DEFINE_LISP_SYMBOL (Qreset)
+#define iQreturn 1004
+DEFINE_LISP_SYMBOL (Qreturn)
+#define iQright 1005
+DEFINE_LISP_SYMBOL (Qright)
+#define iQright_divider 1006
+DEFINE_LISP_SYMBOL (Qright_divider)
+#define iQright_divider_width 1007
+DEFINE_LISP_SYMBOL (Qright_divider_width)
+#define iQright_edge 1008
+DEFINE_LISP_SYMBOL (Qright_edge)
+#define iQright_fringe 1009
+DEFINE_LISP_SYMBOL (Qright_fringe)
+#define iQright_margin 1010
+DEFINE_LISP_SYMBOL (Qright_margin)
+#define iQright_to_left 1011
+DEFINE_LISP_SYMBOL (Qright_to_left)
+#define iQrightmost 1012
+DEFINE_LISP_SYMBOL (Qrightmost)
+#define iQrisky_local_variable 1013
+DEFINE_LISP_SYMBOL (Qrisky_local_variable)
+#define iQrss 1014
+DEFINE_LISP_SYMBOL (Qrss)
+#define iQrun 1015
+DEFINE_LISP_SYMBOL (Qrun)
+#define iQrun_hook_query_error_with_timeout 1016
+DEFINE_LISP_SYMBOL (Qrun_hook_query_error_with_timeout)
+#define iQrun_hook_with_args 1017
+DEFINE_LISP_SYMBOL (Qrun_hook_with_args)
+#define iQsafe 1018
+DEFINE_LISP_SYMBOL (Qsafe)
+#define iQsave_excursion 1019
+DEFINE_LISP_SYMBOL (Qsave_excursion)
+#define iQsave_session 1020
+DEFINE_LISP_SYMBOL (Qsave_session)
+#define iQscale_factor 1021
+DEFINE_LISP_SYMBOL (Qscale_factor)
+#define iQscan_error 1022
+DEFINE_LISP_SYMBOL (Qscan_error)
+#define iQscratch 1023
+DEFINE_LISP_SYMBOL (Qscratch)
+#define iQscreen_gamma 1024
+DEFINE_LISP_SYMBOL (Qscreen_gamma)
+#define iQscroll_bar 1025
+DEFINE_LISP_SYMBOL (Qscroll_bar)
+#define iQscroll_bar_background 1026
+DEFINE_LISP_SYMBOL (Qscroll_bar_background)
+#define iQscroll_bar_foreground 1027
+DEFINE_LISP_SYMBOL (Qscroll_bar_foreground)
+#define iQscroll_bar_height 1028
+DEFINE_LISP_SYMBOL (Qscroll_bar_height)
+#define iQscroll_bar_movement 1029
+DEFINE_LISP_SYMBOL (Qscroll_bar_movement)
+#define iQscroll_bar_width 1030
+DEFINE_LISP_SYMBOL (Qscroll_bar_width)
+#define iQscroll_command 1031
+DEFINE_LISP_SYMBOL (Qscroll_command)
+#define iQscroll_down 1032
+DEFINE_LISP_SYMBOL (Qscroll_down)
+#define iQscroll_up 1033
+DEFINE_LISP_SYMBOL (Qscroll_up)
+#define iQsearch_failed 1034
+DEFINE_LISP_SYMBOL (Qsearch_failed)
+#define iQsecure_hash_file 1035
+DEFINE_LISP_SYMBOL (Qsecure_hash_file)
+#define iQselect_frame_set_input_focus 1036
+DEFINE_LISP_SYMBOL (Qselect_frame_set_input_focus)
+#define iQselect_window 1037
+DEFINE_LISP_SYMBOL (Qselect_window)
+#define iQselection_request 1038
+DEFINE_LISP_SYMBOL (Qselection_request)
+#define iQself_insert_command 1039
+DEFINE_LISP_SYMBOL (Qself_insert_command)
+#define iQsemi_bold 1040
+DEFINE_LISP_SYMBOL (Qsemi_bold)
+#define iQsemi_light 1041
+DEFINE_LISP_SYMBOL (Qsemi_light)
+#define iQseqpacket 1042
+DEFINE_LISP_SYMBOL (Qseqpacket)
+#define iQsequencep 1043
+DEFINE_LISP_SYMBOL (Qsequencep)
+#define iQserial 1044
+DEFINE_LISP_SYMBOL (Qserial)
+#define iQsess 1045
+DEFINE_LISP_SYMBOL (Qsess)
+#define iQset 1046
+DEFINE_LISP_SYMBOL (Qset)
+#define iQset_args_to_local 1047
+DEFINE_LISP_SYMBOL (Qset_args_to_local)
+#define iQset_default 1048
+DEFINE_LISP_SYMBOL (Qset_default)
+#define iQset_file_acl 1049
+DEFINE_LISP_SYMBOL (Qset_file_acl)
+#define iQset_file_modes 1050
+DEFINE_LISP_SYMBOL (Qset_file_modes)
+#define iQset_file_selinux_context 1051
+DEFINE_LISP_SYMBOL (Qset_file_selinux_context)
+#define iQset_file_times 1052
+DEFINE_LISP_SYMBOL (Qset_file_times)
+#define iQset_internal 1053
+DEFINE_LISP_SYMBOL (Qset_internal)
+#define iQset_par_to_local 1054
+DEFINE_LISP_SYMBOL (Qset_par_to_local)
+#define iQset_rest_args_to_local 1055
+DEFINE_LISP_SYMBOL (Qset_rest_args_to_local)
+#define iQset_visited_file_modtime 1056
+DEFINE_LISP_SYMBOL (Qset_visited_file_modtime)
+#define iQset_window_configuration 1057
+DEFINE_LISP_SYMBOL (Qset_window_configuration)
+#define iQsetcar 1058
+DEFINE_LISP_SYMBOL (Qsetcar)
+#define iQsetcdr 1059
+DEFINE_LISP_SYMBOL (Qsetcdr)
+#define iQsetimm 1060
+DEFINE_LISP_SYMBOL (Qsetimm)
+#define iQsetq 1061
+DEFINE_LISP_SYMBOL (Qsetq)
+#define iQsetting_constant 1062
+DEFINE_LISP_SYMBOL (Qsetting_constant)
+#define iQsha1 1063
+DEFINE_LISP_SYMBOL (Qsha1)
+#define iQsha224 1064
+DEFINE_LISP_SYMBOL (Qsha224)
+#define iQsha256 1065
+DEFINE_LISP_SYMBOL (Qsha256)
+#define iQsha384 1066
+DEFINE_LISP_SYMBOL (Qsha384)
+#define iQsha512 1067
+DEFINE_LISP_SYMBOL (Qsha512)
+#define iQshaded 1068
+DEFINE_LISP_SYMBOL (Qshaded)
+#define iQshift_jis 1069
+DEFINE_LISP_SYMBOL (Qshift_jis)
+#define iQsignal 1070
+DEFINE_LISP_SYMBOL (Qsignal)
+#define iQsignal_process_functions 1071
+DEFINE_LISP_SYMBOL (Qsignal_process_functions)
+#define iQsingularity_error 1072
+DEFINE_LISP_SYMBOL (Qsingularity_error)
+#define iQsize 1073
+DEFINE_LISP_SYMBOL (Qsize)
+#define iQskip_taskbar 1074
+DEFINE_LISP_SYMBOL (Qskip_taskbar)
+#define iQslice 1075
+DEFINE_LISP_SYMBOL (Qslice)
+#define iQsound 1076
+DEFINE_LISP_SYMBOL (Qsound)
+#define iQsource 1077
+DEFINE_LISP_SYMBOL (Qsource)
+#define iQspace 1078
+DEFINE_LISP_SYMBOL (Qspace)
+#define iQspace_width 1079
+DEFINE_LISP_SYMBOL (Qspace_width)
+#define iQspecial_lowercase 1080
+DEFINE_LISP_SYMBOL (Qspecial_lowercase)
+#define iQspecial_titlecase 1081
+DEFINE_LISP_SYMBOL (Qspecial_titlecase)
+#define iQspecial_uppercase 1082
+DEFINE_LISP_SYMBOL (Qspecial_uppercase)
+#define iQsqlite 1083
+DEFINE_LISP_SYMBOL (Qsqlite)
+#define iQstandard_input 1084
+DEFINE_LISP_SYMBOL (Qstandard_input)
+#define iQstandard_output 1085
+DEFINE_LISP_SYMBOL (Qstandard_output)
+#define iQstart 1086
+DEFINE_LISP_SYMBOL (Qstart)
+#define iQstart_process 1087
+DEFINE_LISP_SYMBOL (Qstart_process)
+#define iQstate 1088
+DEFINE_LISP_SYMBOL (Qstate)
+#define iQstderr 1089
+DEFINE_LISP_SYMBOL (Qstderr)
+#define iQstdin 1090
+DEFINE_LISP_SYMBOL (Qstdin)
+#define iQstdout 1091
+DEFINE_LISP_SYMBOL (Qstdout)
+#define iQsticky 1092
+DEFINE_LISP_SYMBOL (Qsticky)
+#define iQstime 1093
+DEFINE_LISP_SYMBOL (Qstime)
+#define iQstop 1094
+DEFINE_LISP_SYMBOL (Qstop)
+#define iQstraight 1095
+DEFINE_LISP_SYMBOL (Qstraight)
+#define iQstring 1096
+DEFINE_LISP_SYMBOL (Qstring)
+#define iQstring_bytes 1097
+DEFINE_LISP_SYMBOL (Qstring_bytes)
+#define iQstring_lessp 1098
+DEFINE_LISP_SYMBOL (Qstring_lessp)
+#define iQstringp 1099
+DEFINE_LISP_SYMBOL (Qstringp)
+#define iQstrings 1100
+DEFINE_LISP_SYMBOL (Qstrings)
+#define iQsub1 1101
+DEFINE_LISP_SYMBOL (Qsub1)
+#define iQsub_char_table 1102
+DEFINE_LISP_SYMBOL (Qsub_char_table)
+#define iQsubfeatures 1103
+DEFINE_LISP_SYMBOL (Qsubfeatures)
+#define iQsubr 1104
+DEFINE_LISP_SYMBOL (Qsubr)
+#define iQsubrp 1105
+DEFINE_LISP_SYMBOL (Qsubrp)
+#define iQsubstitute_command_keys 1106
+DEFINE_LISP_SYMBOL (Qsubstitute_command_keys)
+#define iQsubstitute_env_in_file_name 1107
+DEFINE_LISP_SYMBOL (Qsubstitute_env_in_file_name)
+#define iQsubstitute_in_file_name 1108
+DEFINE_LISP_SYMBOL (Qsubstitute_in_file_name)
+#define iQsw 1109
+DEFINE_LISP_SYMBOL (Qsw)
+#define iQswitch_frame 1110
+DEFINE_LISP_SYMBOL (Qswitch_frame)
+#define iQsymbol 1111
+DEFINE_LISP_SYMBOL (Qsymbol)
+#define iQsymbolp 1112
+DEFINE_LISP_SYMBOL (Qsymbolp)
+#define iQsymbols 1113
+DEFINE_LISP_SYMBOL (Qsymbols)
+#define iQsyntax_ppss 1114
+DEFINE_LISP_SYMBOL (Qsyntax_ppss)
+#define iQsyntax_table 1115
+DEFINE_LISP_SYMBOL (Qsyntax_table)
+#define iQsyntax_table_p 1116
+DEFINE_LISP_SYMBOL (Qsyntax_table_p)
+#define iQtab_bar 1117
+DEFINE_LISP_SYMBOL (Qtab_bar)
+#define iQtab_bar_lines 1118
+DEFINE_LISP_SYMBOL (Qtab_bar_lines)
+#define iQtab_bar_size 1119
+DEFINE_LISP_SYMBOL (Qtab_bar_size)
+#define iQtab_line 1120
+DEFINE_LISP_SYMBOL (Qtab_line)
+#define iQtab_line_format 1121
+DEFINE_LISP_SYMBOL (Qtab_line_format)
+#define iQtarget_idx 1122
+DEFINE_LISP_SYMBOL (Qtarget_idx)
+#define iQtemp_buffer_setup_hook 1123
+DEFINE_LISP_SYMBOL (Qtemp_buffer_setup_hook)
+#define iQtemp_buffer_show_hook 1124
+DEFINE_LISP_SYMBOL (Qtemp_buffer_show_hook)
+#define iQterminal 1125
+DEFINE_LISP_SYMBOL (Qterminal)
+#define iQterminal_frame 1126
+DEFINE_LISP_SYMBOL (Qterminal_frame)
+#define iQterminal_live_p 1127
+DEFINE_LISP_SYMBOL (Qterminal_live_p)
+#define iQtest 1128
+DEFINE_LISP_SYMBOL (Qtest)
+#define iQtext 1129
+DEFINE_LISP_SYMBOL (Qtext)
+#define iQtext_image_horiz 1130
+DEFINE_LISP_SYMBOL (Qtext_image_horiz)
+#define iQtext_pixels 1131
+DEFINE_LISP_SYMBOL (Qtext_pixels)
+#define iQtext_read_only 1132
+DEFINE_LISP_SYMBOL (Qtext_read_only)
+#define iQthcount 1133
+DEFINE_LISP_SYMBOL (Qthcount)
+#define iQthin 1134
+DEFINE_LISP_SYMBOL (Qthin)
+#define iQthin_space 1135
+DEFINE_LISP_SYMBOL (Qthin_space)
+#define iQthread 1136
+DEFINE_LISP_SYMBOL (Qthread)
+#define iQthread_event 1137
+DEFINE_LISP_SYMBOL (Qthread_event)
+#define iQthread_pool 1138
+DEFINE_LISP_SYMBOL (Qthread_pool)
+#define iQthread_pool_p 1139
+DEFINE_LISP_SYMBOL (Qthread_pool_p)
+#define iQthreadp 1140
+DEFINE_LISP_SYMBOL (Qthreadp)
+#define iQthreshold 1141
+DEFINE_LISP_SYMBOL (Qthreshold)
+#define iQtime 1142
+DEFINE_LISP_SYMBOL (Qtime)
+#define iQtimer_event_handler 1143
+DEFINE_LISP_SYMBOL (Qtimer_event_handler)
+#define iQtip_frame 1144
+DEFINE_LISP_SYMBOL (Qtip_frame)
+#define iQtitle 1145
+DEFINE_LISP_SYMBOL (Qtitle)
+#define iQtitle_bar_size 1146
+DEFINE_LISP_SYMBOL (Qtitle_bar_size)
+#define iQtitlecase 1147
+DEFINE_LISP_SYMBOL (Qtitlecase)
+#define iQtool_bar 1148
+DEFINE_LISP_SYMBOL (Qtool_bar)
+#define iQtool_bar_external 1149
+DEFINE_LISP_SYMBOL (Qtool_bar_external)
+#define iQtool_bar_lines 1150
+DEFINE_LISP_SYMBOL (Qtool_bar_lines)
+#define iQtool_bar_position 1151
+DEFINE_LISP_SYMBOL (Qtool_bar_position)
+#define iQtool_bar_size 1152
+DEFINE_LISP_SYMBOL (Qtool_bar_size)
+#define iQtooltip 1153
+DEFINE_LISP_SYMBOL (Qtooltip)
+#define iQtop 1154
+DEFINE_LISP_SYMBOL (Qtop)
+#define iQtop_edge 1155
+DEFINE_LISP_SYMBOL (Qtop_edge)
+#define iQtop_left_corner 1156
+DEFINE_LISP_SYMBOL (Qtop_left_corner)
+#define iQtop_level 1157
+DEFINE_LISP_SYMBOL (Qtop_level)
+#define iQtop_only 1158
+DEFINE_LISP_SYMBOL (Qtop_only)
+#define iQtop_right_corner 1159
+DEFINE_LISP_SYMBOL (Qtop_right_corner)
+#define iQtouch_end 1160
+DEFINE_LISP_SYMBOL (Qtouch_end)
+#define iQtouchscreen_begin 1161
+DEFINE_LISP_SYMBOL (Qtouchscreen_begin)
+#define iQtouchscreen_end 1162
+DEFINE_LISP_SYMBOL (Qtouchscreen_end)
+#define iQtouchscreen_update 1163
+DEFINE_LISP_SYMBOL (Qtouchscreen_update)
+#define iQtpgid 1164
+DEFINE_LISP_SYMBOL (Qtpgid)
+#define iQtrailing_whitespace 1165
+DEFINE_LISP_SYMBOL (Qtrailing_whitespace)
+#define iQtranslation_table 1166
+DEFINE_LISP_SYMBOL (Qtranslation_table)
+#define iQtranslation_table_id 1167
+DEFINE_LISP_SYMBOL (Qtranslation_table_id)
+#define iQtrapping_constant 1168
+DEFINE_LISP_SYMBOL (Qtrapping_constant)
+#define iQtree_sitter 1169
+DEFINE_LISP_SYMBOL (Qtree_sitter)
+#define iQtree_sitter_cursor 1170
+DEFINE_LISP_SYMBOL (Qtree_sitter_cursor)
+#define iQtree_sitter_node 1171
+DEFINE_LISP_SYMBOL (Qtree_sitter_node)
+#define iQttname 1172
+DEFINE_LISP_SYMBOL (Qttname)
+#define iQtty 1173
+DEFINE_LISP_SYMBOL (Qtty)
+#define iQtty_color_alist 1174
+DEFINE_LISP_SYMBOL (Qtty_color_alist)
+#define iQtty_color_by_index 1175
+DEFINE_LISP_SYMBOL (Qtty_color_by_index)
+#define iQtty_color_desc 1176
+DEFINE_LISP_SYMBOL (Qtty_color_desc)
+#define iQtty_color_mode 1177
+DEFINE_LISP_SYMBOL (Qtty_color_mode)
+#define iQtty_color_standard_values 1178
+DEFINE_LISP_SYMBOL (Qtty_color_standard_values)
+#define iQtty_menu_exit 1179
+DEFINE_LISP_SYMBOL (Qtty_menu_exit)
+#define iQtty_menu_ignore 1180
+DEFINE_LISP_SYMBOL (Qtty_menu_ignore)
+#define iQtty_menu_mouse_movement 1181
+DEFINE_LISP_SYMBOL (Qtty_menu_mouse_movement)
+#define iQtty_menu_navigation_map 1182
+DEFINE_LISP_SYMBOL (Qtty_menu_navigation_map)
+#define iQtty_menu_next_item 1183
+DEFINE_LISP_SYMBOL (Qtty_menu_next_item)
+#define iQtty_menu_next_menu 1184
+DEFINE_LISP_SYMBOL (Qtty_menu_next_menu)
+#define iQtty_menu_prev_item 1185
+DEFINE_LISP_SYMBOL (Qtty_menu_prev_item)
+#define iQtty_menu_prev_menu 1186
+DEFINE_LISP_SYMBOL (Qtty_menu_prev_menu)
+#define iQtty_menu_select 1187
+DEFINE_LISP_SYMBOL (Qtty_menu_select)
+#define iQtty_mode_reset_strings 1188
+DEFINE_LISP_SYMBOL (Qtty_mode_reset_strings)
+#define iQtty_mode_set_strings 1189
+DEFINE_LISP_SYMBOL (Qtty_mode_set_strings)
+#define iQtty_type 1190
+DEFINE_LISP_SYMBOL (Qtty_type)
+#define iQultra_bold 1191
+DEFINE_LISP_SYMBOL (Qultra_bold)
+#define iQultra_heavy 1192
+DEFINE_LISP_SYMBOL (Qultra_heavy)
+#define iQultra_light 1193
+DEFINE_LISP_SYMBOL (Qultra_light)
+#define iQundecided 1194
+DEFINE_LISP_SYMBOL (Qundecided)
+#define iQundecorated 1195
+DEFINE_LISP_SYMBOL (Qundecorated)
+#define iQundefined 1196
+DEFINE_LISP_SYMBOL (Qundefined)
+#define iQunderflow_error 1197
+DEFINE_LISP_SYMBOL (Qunderflow_error)
+#define iQunderline_minimum_offset 1198
+DEFINE_LISP_SYMBOL (Qunderline_minimum_offset)
+#define iQundo_auto__add_boundary 1199
+DEFINE_LISP_SYMBOL (Qundo_auto__add_boundary)
+#define iQundo_auto__last_boundary_cause 1200
+DEFINE_LISP_SYMBOL (Qundo_auto__last_boundary_cause)
+#define iQundo_auto__this_command_amalgamating 1201
+DEFINE_LISP_SYMBOL (Qundo_auto__this_command_amalgamating)
+#define iQundo_auto__undoable_change 1202
+DEFINE_LISP_SYMBOL (Qundo_auto__undoable_change)
+#define iQundo_auto__undoably_changed_buffers 1203
+DEFINE_LISP_SYMBOL (Qundo_auto__undoably_changed_buffers)
+#define iQundo_auto_amalgamate 1204
+DEFINE_LISP_SYMBOL (Qundo_auto_amalgamate)
+#define iQunevalled 1205
+DEFINE_LISP_SYMBOL (Qunevalled)
+#define iQunhandled_file_name_directory 1206
+DEFINE_LISP_SYMBOL (Qunhandled_file_name_directory)
+#define iQunicode 1207
+DEFINE_LISP_SYMBOL (Qunicode)
+#define iQunicode_bmp 1208
+DEFINE_LISP_SYMBOL (Qunicode_bmp)
+#define iQunix 1209
+DEFINE_LISP_SYMBOL (Qunix)
+#define iQunlet 1210
+DEFINE_LISP_SYMBOL (Qunlet)
+#define iQunlock_file 1211
+DEFINE_LISP_SYMBOL (Qunlock_file)
+#define iQunreachable 1212
+DEFINE_LISP_SYMBOL (Qunreachable)
+#define iQunspecified 1213
+DEFINE_LISP_SYMBOL (Qunspecified)
+#define iQunsplittable 1214
+DEFINE_LISP_SYMBOL (Qunsplittable)
+#define iQup 1215
+DEFINE_LISP_SYMBOL (Qup)
+#define iQuppercase 1216
+DEFINE_LISP_SYMBOL (Quppercase)
+#define iQus_ascii 1217
+DEFINE_LISP_SYMBOL (Qus_ascii)
+#define iQuse_frame_synchronization 1218
+DEFINE_LISP_SYMBOL (Quse_frame_synchronization)
+#define iQuser 1219
+DEFINE_LISP_SYMBOL (Quser)
+#define iQuser_error 1220
+DEFINE_LISP_SYMBOL (Quser_error)
+#define iQuser_position 1221
+DEFINE_LISP_SYMBOL (Quser_position)
+#define iQuser_ptr 1222
+DEFINE_LISP_SYMBOL (Quser_ptr)
+#define iQuser_ptrp 1223
+DEFINE_LISP_SYMBOL (Quser_ptrp)
+#define iQuser_search_failed 1224
+DEFINE_LISP_SYMBOL (Quser_search_failed)
+#define iQuser_size 1225
+DEFINE_LISP_SYMBOL (Quser_size)
+#define iQutf_16 1226
+DEFINE_LISP_SYMBOL (Qutf_16)
+#define iQutf_16le 1227
+DEFINE_LISP_SYMBOL (Qutf_16le)
+#define iQutf_8 1228
+DEFINE_LISP_SYMBOL (Qutf_8)
+#define iQutf_8_emacs 1229
+DEFINE_LISP_SYMBOL (Qutf_8_emacs)
+#define iQutf_8_string_p 1230
+DEFINE_LISP_SYMBOL (Qutf_8_string_p)
+#define iQutf_8_unix 1231
+DEFINE_LISP_SYMBOL (Qutf_8_unix)
+#define iQutime 1232
+DEFINE_LISP_SYMBOL (Qutime)
+#define iQvalue 1233
+DEFINE_LISP_SYMBOL (Qvalue)
+#define iQvariable_documentation 1234
+DEFINE_LISP_SYMBOL (Qvariable_documentation)
+#define iQvector 1235
+DEFINE_LISP_SYMBOL (Qvector)
+#define iQvector_or_char_table_p 1236
+DEFINE_LISP_SYMBOL (Qvector_or_char_table_p)
+#define iQvector_slots 1237
+DEFINE_LISP_SYMBOL (Qvector_slots)
+#define iQvectorp 1238
+DEFINE_LISP_SYMBOL (Qvectorp)
+#define iQvectors 1239
+DEFINE_LISP_SYMBOL (Qvectors)
+#define iQverify_visited_file_modtime 1240
+DEFINE_LISP_SYMBOL (Qverify_visited_file_modtime)
+#define iQvertical_border 1241
+DEFINE_LISP_SYMBOL (Qvertical_border)
+#define iQvertical_line 1242
+DEFINE_LISP_SYMBOL (Qvertical_line)
+#define iQvertical_scroll_bar 1243
+DEFINE_LISP_SYMBOL (Qvertical_scroll_bar)
+#define iQvertical_scroll_bars 1244
+DEFINE_LISP_SYMBOL (Qvertical_scroll_bars)
+#define iQvisibility 1245
+DEFINE_LISP_SYMBOL (Qvisibility)
+#define iQvisible 1246
+DEFINE_LISP_SYMBOL (Qvisible)
+#define iQvisual 1247
+DEFINE_LISP_SYMBOL (Qvisual)
+#define iQvoid_function 1248
+DEFINE_LISP_SYMBOL (Qvoid_function)
+#define iQvoid_variable 1249
+DEFINE_LISP_SYMBOL (Qvoid_variable)
+#define iQvsize 1250
+DEFINE_LISP_SYMBOL (Qvsize)
+#define iQw32 1251
+DEFINE_LISP_SYMBOL (Qw32)
+#define iQwait_for_wm 1252
+DEFINE_LISP_SYMBOL (Qwait_for_wm)
+#define iQwall 1253
+DEFINE_LISP_SYMBOL (Qwall)
+#define iQwatchers 1254
+DEFINE_LISP_SYMBOL (Qwatchers)
+#define iQwave 1255
+DEFINE_LISP_SYMBOL (Qwave)
+#define iQweakness 1256
+DEFINE_LISP_SYMBOL (Qweakness)
+#define iQwhen 1257
+DEFINE_LISP_SYMBOL (Qwhen)
+#define iQwholenump 1258
+DEFINE_LISP_SYMBOL (Qwholenump)
+#define iQwidget_type 1259
+DEFINE_LISP_SYMBOL (Qwidget_type)
+#define iQwidth 1260
+DEFINE_LISP_SYMBOL (Qwidth)
+#define iQwidth_only 1261
+DEFINE_LISP_SYMBOL (Qwidth_only)
+#define iQwindow 1262
+DEFINE_LISP_SYMBOL (Qwindow)
+#define iQwindow__pixel_to_total 1263
+DEFINE_LISP_SYMBOL (Qwindow__pixel_to_total)
+#define iQwindow__resize_mini_frame 1264
+DEFINE_LISP_SYMBOL (Qwindow__resize_mini_frame)
+#define iQwindow__resize_root_window 1265
+DEFINE_LISP_SYMBOL (Qwindow__resize_root_window)
+#define iQwindow__resize_root_window_vertically 1266
+DEFINE_LISP_SYMBOL (Qwindow__resize_root_window_vertically)
+#define iQwindow_buffer_change_functions 1267
+DEFINE_LISP_SYMBOL (Qwindow_buffer_change_functions)
+#define iQwindow_configuration 1268
+DEFINE_LISP_SYMBOL (Qwindow_configuration)
+#define iQwindow_configuration_change_hook 1269
+DEFINE_LISP_SYMBOL (Qwindow_configuration_change_hook)
+#define iQwindow_configuration_p 1270
+DEFINE_LISP_SYMBOL (Qwindow_configuration_p)
+#define iQwindow_deletable_p 1271
+DEFINE_LISP_SYMBOL (Qwindow_deletable_p)
+#define iQwindow_divider 1272
+DEFINE_LISP_SYMBOL (Qwindow_divider)
+#define iQwindow_divider_first_pixel 1273
+DEFINE_LISP_SYMBOL (Qwindow_divider_first_pixel)
+#define iQwindow_divider_last_pixel 1274
+DEFINE_LISP_SYMBOL (Qwindow_divider_last_pixel)
+#define iQwindow_edges 1275
+DEFINE_LISP_SYMBOL (Qwindow_edges)
+#define iQwindow_id 1276
+DEFINE_LISP_SYMBOL (Qwindow_id)
+#define iQwindow_live_p 1277
+DEFINE_LISP_SYMBOL (Qwindow_live_p)
+#define iQwindow_point_insertion_type 1278
+DEFINE_LISP_SYMBOL (Qwindow_point_insertion_type)
+#define iQwindow_scroll_functions 1279
+DEFINE_LISP_SYMBOL (Qwindow_scroll_functions)
+#define iQwindow_selection_change_functions 1280
+DEFINE_LISP_SYMBOL (Qwindow_selection_change_functions)
+#define iQwindow_size 1281
+DEFINE_LISP_SYMBOL (Qwindow_size)
+#define iQwindow_size_change_functions 1282
+DEFINE_LISP_SYMBOL (Qwindow_size_change_functions)
+#define iQwindow_state_change_functions 1283
+DEFINE_LISP_SYMBOL (Qwindow_state_change_functions)
+#define iQwindow_state_change_hook 1284
+DEFINE_LISP_SYMBOL (Qwindow_state_change_hook)
+#define iQwindow_valid_p 1285
+DEFINE_LISP_SYMBOL (Qwindow_valid_p)
+#define iQwindowp 1286
+DEFINE_LISP_SYMBOL (Qwindowp)
+#define iQworkarea 1287
+DEFINE_LISP_SYMBOL (Qworkarea)
+#define iQwrap_prefix 1288
+DEFINE_LISP_SYMBOL (Qwrap_prefix)
+#define iQwrite_region 1289
+DEFINE_LISP_SYMBOL (Qwrite_region)
+#define iQwrite_region_annotate_functions 1290
+DEFINE_LISP_SYMBOL (Qwrite_region_annotate_functions)
+#define iQwrong_length_argument 1291
+DEFINE_LISP_SYMBOL (Qwrong_length_argument)
+#define iQwrong_number_of_arguments 1292
+DEFINE_LISP_SYMBOL (Qwrong_number_of_arguments)
+#define iQwrong_register_subr_call 1293
+DEFINE_LISP_SYMBOL (Qwrong_register_subr_call)
+#define iQwrong_type_argument 1294
+DEFINE_LISP_SYMBOL (Qwrong_type_argument)
+#define iQx 1295
+DEFINE_LISP_SYMBOL (Qx)
+#define iQx_create_frame_1 1296
+DEFINE_LISP_SYMBOL (Qx_create_frame_1)
+#define iQx_create_frame_2 1297
+DEFINE_LISP_SYMBOL (Qx_create_frame_2)
+#define iQx_frame_parameter 1298
+DEFINE_LISP_SYMBOL (Qx_frame_parameter)
+#define iQx_pre_popup_menu_hook 1299
+DEFINE_LISP_SYMBOL (Qx_pre_popup_menu_hook)
+#define iQx_resource_name 1300
+DEFINE_LISP_SYMBOL (Qx_resource_name)
+#define iQx_set_menu_bar_lines 1301
+DEFINE_LISP_SYMBOL (Qx_set_menu_bar_lines)
+#define iQx_set_window_size_1 1302
+DEFINE_LISP_SYMBOL (Qx_set_window_size_1)
+#define iQxg_frame_set_char_size 1303
+DEFINE_LISP_SYMBOL (Qxg_frame_set_char_size)
+#define iQxterm__set_selection 1304
+DEFINE_LISP_SYMBOL (Qxterm__set_selection)
+#define iQxterm_select_active_regions 1305
+DEFINE_LISP_SYMBOL (Qxterm_select_active_regions)
+#define iQxwidget 1306
+DEFINE_LISP_SYMBOL (Qxwidget)
+#define iQxwidget_display_event 1307
+DEFINE_LISP_SYMBOL (Qxwidget_display_event)
+#define iQxwidget_event 1308
+DEFINE_LISP_SYMBOL (Qxwidget_event)
+#define iQxwidget_view 1309
+DEFINE_LISP_SYMBOL (Qxwidget_view)
+#define iQyes_or_no_p_history 1310
+DEFINE_LISP_SYMBOL (Qyes_or_no_p_history)
+#define iQz_group 1311
+DEFINE_LISP_SYMBOL (Qz_group)
+#define iQzero_width 1312
+DEFINE_LISP_SYMBOL (Qzero_width)
+EXFUN (Fabort_minibuffers, 0);
+_Noreturn EXFUN (Fabort_recursive_edit, 0) ATTRIBUTE_COLD;
+EXFUN (Fabs, 1);
+EXFUN (Faccept_process_output, 4);
+EXFUN (Faccess_file, 2);
+EXFUN (Faccessible_keymaps, 2);
+EXFUN (Facos, 1);
+EXFUN (Factive_minibuffer_window, 0);
+EXFUN (Fadd1, 1);
+EXFUN (Fadd_face_text_property, 5);
+EXFUN (Fadd_name_to_file, 3);
+EXFUN (Fadd_text_properties, 4);
+EXFUN (Fadd_variable_watcher, 2);
+EXFUN (Fall_completions, 4);
+EXFUN (Fall_threads, 0);
+EXFUN (Fand, UNEVALLED);
+EXFUN (Fansi_color__scan, 5);
+EXFUN (Fappend, MANY);
+EXFUN (Fapply, MANY);
+EXFUN (Faref, 2);
+EXFUN (Farrayp, 1);
+EXFUN (Faset, 3);
+EXFUN (Fash, 2);
+EXFUN (Fasin, 1);
+EXFUN (Fassoc, 3);
+EXFUN (Fassoc_string, 3);
+EXFUN (Fassq, 2);
+EXFUN (Fatan, 2);
+EXFUN (Fatom, 1) ATTRIBUTE_CONST;
+EXFUN (Fautoload, 5);
+EXFUN (Fautoload_do_load, 3);
+EXFUN (Fbacktrace__locals, 2);
+EXFUN (Fbacktrace_debug, 3);
+EXFUN (Fbacktrace_eval, 3);
+EXFUN (Fbacktrace_frame_internal, 3);
+EXFUN (Fbacktrace_frames_from_thread, 1);
+EXFUN (Fbackward_char, 1);
+EXFUN (Fbackward_prefix_chars, 0);
+EXFUN (Fbarf_if_buffer_read_only, 1);
+EXFUN (Fbase64_decode_region, 4);
+EXFUN (Fbase64_decode_string, 3);
+EXFUN (Fbase64_encode_region, 3);
+EXFUN (Fbase64_encode_string, 2);
+EXFUN (Fbase64url_encode_region, 3);
+EXFUN (Fbase64url_encode_string, 2);
+EXFUN (Fbeginning_of_line, 1);
+EXFUN (Fbidi_find_overridden_directionality, 4);
+EXFUN (Fbidi_resolved_levels, 1);
+EXFUN (Fbitmap_spec_p, 1);
+EXFUN (Fbobp, 0);
+EXFUN (Fbolp, 0);
+EXFUN (Fbool_vector, MANY);
+EXFUN (Fbool_vector_count_consecutive, 3);
+EXFUN (Fbool_vector_count_population, 1);
+EXFUN (Fbool_vector_exclusive_or, 3);
+EXFUN (Fbool_vector_intersection, 3);
+EXFUN (Fbool_vector_not, 2);
+EXFUN (Fbool_vector_p, 1);
+EXFUN (Fbool_vector_set_difference, 3);
+EXFUN (Fbool_vector_subsetp, 2);
+EXFUN (Fbool_vector_union, 3);
+EXFUN (Fbottom_divider_width, 1);
+EXFUN (Fboundp, 1);
+EXFUN (Fbuffer_base_buffer, 1);
+EXFUN (Fbuffer_chars_modified_tick, 1);
+EXFUN (Fbuffer_enable_undo, 1);
+EXFUN (Fbuffer_file_name, 1);
+EXFUN (Fbuffer_hash, 1);
+EXFUN (Fbuffer_line_statistics, 1);
+EXFUN (Fbuffer_list, 1);
+EXFUN (Fbuffer_live_p, 1);
+EXFUN (Fbuffer_local_value, 2);
+EXFUN (Fbuffer_local_variables, 1);
+EXFUN (Fbuffer_modified_p, 1);
+EXFUN (Fbuffer_modified_tick, 1);
+EXFUN (Fbuffer_monospace_p, 1);
+EXFUN (Fbuffer_name, 1);
+EXFUN (Fbuffer_size, 1);
+EXFUN (Fbuffer_string, 0);
+EXFUN (Fbuffer_substring, 2);
+EXFUN (Fbuffer_substring_no_properties, 2);
+EXFUN (Fbuffer_swap_text, 1);
+EXFUN (Fbuffer_text_pixel_size, 4);
+EXFUN (Fbufferp, 1);
+EXFUN (Fbury_buffer_internal, 1);
+EXFUN (Fbyte_code, 3);
+EXFUN (Fbyte_code_function_p, 1);
+EXFUN (Fbyte_to_position, 1);
+EXFUN (Fbyte_to_string, 1);
+EXFUN (Fbyteorder, 0) ATTRIBUTE_CONST;
+EXFUN (Fcall_interactively, 3);
+EXFUN (Fcall_last_kbd_macro, 2);
+EXFUN (Fcall_process, MANY);
+EXFUN (Fcall_process_region, MANY);
+EXFUN (Fcancel_kbd_macro_events, 0);
+EXFUN (Fcapitalize, 1);
+EXFUN (Fcapitalize_region, 3);
+EXFUN (Fcapitalize_word, 1);
+EXFUN (Fcar, 1);
+EXFUN (Fcar_less_than_car, 2);
+EXFUN (Fcar_safe, 1);
+EXFUN (Fcase_table_p, 1);
+EXFUN (Fcatch, UNEVALLED);
+EXFUN (Fcategory_docstring, 2);
+EXFUN (Fcategory_set_mnemonics, 1);
+EXFUN (Fcategory_table, 0);
+EXFUN (Fcategory_table_p, 1);
+EXFUN (Fccl_execute, 2);
+EXFUN (Fccl_execute_on_string, 5);
+EXFUN (Fccl_program_p, 1);
+EXFUN (Fcdr, 1);
+EXFUN (Fcdr_safe, 1);
+EXFUN (Fceiling, 2);
+EXFUN (Fchannel_name, 1);
+EXFUN (Fchannel_receive, 1);
+EXFUN (Fchannel_send, 2);
+EXFUN (Fchannel_try_receive, 2);
+EXFUN (Fchannelp, 1);
+EXFUN (Fchar_after, 1);
+EXFUN (Fchar_before, 1);
+EXFUN (Fchar_category_set, 1);
+EXFUN (Fchar_charset, 2);
+EXFUN (Fchar_equal, 2);
+EXFUN (Fchar_or_string_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fchar_resolve_modifiers, 1);
+EXFUN (Fchar_syntax, 1);
+EXFUN (Fchar_table_extra_slot, 2);
+EXFUN (Fchar_table_p, 1);
+EXFUN (Fchar_table_parent, 1);
+EXFUN (Fchar_table_range, 2);
+EXFUN (Fchar_table_subtype, 1);
+EXFUN (Fchar_to_string, 1);
+EXFUN (Fchar_width, 1);
+EXFUN (Fcharacterp, 2) ATTRIBUTE_CONST;
+EXFUN (Fcharset_after, 1);
+EXFUN (Fcharset_id_internal, 1);
+EXFUN (Fcharset_plist, 1);
+EXFUN (Fcharset_priority_list, 1);
+EXFUN (Fcharsetp, 1);
+EXFUN (Fcheck_coding_system, 1);
+EXFUN (Fcheck_coding_systems_region, 3);
+EXFUN (Fcircular_list_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fclear_buffer_auto_save_failure, 0);
+EXFUN (Fclear_charset_maps, 0);
+EXFUN (Fclear_composition_cache, 0);
+EXFUN (Fclear_face_cache, 1);
+EXFUN (Fclear_font_cache, 0);
+EXFUN (Fclear_string, 1);
+EXFUN (Fclear_this_command_keys, 1);
+EXFUN (Fclose_font, 2);
+EXFUN (Fclrhash, 1);
+EXFUN (Fcoding_system_aliases, 1);
+EXFUN (Fcoding_system_base, 1);
+EXFUN (Fcoding_system_eol_type, 1);
+EXFUN (Fcoding_system_p, 1);
+EXFUN (Fcoding_system_plist, 1);
+EXFUN (Fcoding_system_priority_list, 1);
+EXFUN (Fcoding_system_put, 3);
+EXFUN (Fcolor_distance, 4);
+EXFUN (Fcolor_gray_p, 2);
+EXFUN (Fcolor_supported_p, 3);
+EXFUN (Fcolor_values_from_color_spec, 1);
+EXFUN (Fcommand_error_default_function, 3);
+EXFUN (Fcommand_modes, 1);
+EXFUN (Fcommand_remapping, 3);
+EXFUN (Fcommandp, 2);
+EXFUN (Fcomp__compile_ctxt_to_file, 1);
+EXFUN (Fcomp__init_ctxt, 0);
+EXFUN (Fcomp__install_trampoline, 2);
+EXFUN (Fcomp__late_register_subr, 7);
+EXFUN (Fcomp__register_lambda, 7);
+EXFUN (Fcomp__register_subr, 7);
+EXFUN (Fcomp__release_ctxt, 0);
+EXFUN (Fcomp__subr_signature, 1);
+EXFUN (Fcomp_el_to_eln_filename, 2);
+EXFUN (Fcomp_el_to_eln_rel_filename, 1);
+EXFUN (Fcomp_libgccjit_version, 0);
+EXFUN (Fcomp_native_compiler_options_effective_p, 0);
+EXFUN (Fcomp_native_driver_options_effective_p, 0);
+EXFUN (Fcompare_buffer_substrings, 6);
+EXFUN (Fcompare_strings, 7);
+EXFUN (Fcompleting_read, 8);
+EXFUN (Fcompose_region_internal, 4);
+EXFUN (Fcompose_string_internal, 5);
+EXFUN (Fcomposition_get_gstring, 4);
+EXFUN (Fcomposition_sort_rules, 1);
+EXFUN (Fcompute_motion, 7);
+EXFUN (Fconcat, MANY);
+EXFUN (Fcond, UNEVALLED);
+EXFUN (Fcondition_case, UNEVALLED);
+EXFUN (Fcondition_mutex, 1);
+EXFUN (Fcondition_name, 1);
+EXFUN (Fcondition_notify, 2);
+EXFUN (Fcondition_variable_p, 1);
+EXFUN (Fcondition_wait, 1);
+EXFUN (Fcons, 2);
+EXFUN (Fconsp, 1) ATTRIBUTE_CONST;
+EXFUN (Fconstrain_to_field, 5);
+EXFUN (Fcontinue_process, 2);
+EXFUN (Fcontrolling_tty_p, 1);
+EXFUN (Fcoordinates_in_window_p, 2);
+EXFUN (Fcopy_alist, 1);
+EXFUN (Fcopy_category_table, 1);
+EXFUN (Fcopy_file, 6);
+EXFUN (Fcopy_hash_table, 1);
+EXFUN (Fcopy_keymap, 1);
+EXFUN (Fcopy_marker, 2);
+EXFUN (Fcopy_sequence, 1);
+EXFUN (Fcopy_syntax_table, 1);
+EXFUN (Fcopysign, 2);
+EXFUN (Fcos, 1);
+EXFUN (Fcurrent_active_maps, 2);
+EXFUN (Fcurrent_bidi_paragraph_direction, 1);
+EXFUN (Fcurrent_buffer, 0);
+EXFUN (Fcurrent_case_table, 0);
+EXFUN (Fcurrent_column, 0);
+EXFUN (Fcurrent_cpu_time, 0);
+EXFUN (Fcurrent_global_map, 0);
+EXFUN (Fcurrent_idle_time, 0);
+EXFUN (Fcurrent_indentation, 1);
+EXFUN (Fcurrent_input_mode, 0);
+EXFUN (Fcurrent_local_map, 0);
+EXFUN (Fcurrent_message, 0);
+EXFUN (Fcurrent_minor_mode_maps, 0);
+EXFUN (Fcurrent_thread, 0);
+EXFUN (Fcurrent_time, 0);
+EXFUN (Fcurrent_time_string, 2);
+EXFUN (Fcurrent_time_zone, 2);
+EXFUN (Fcurrent_window_configuration, 1);
+EXFUN (Fdaemon_initialized, 0);
+EXFUN (Fdaemonp, 0);
+EXFUN (Fdebug_timer_check, 0);
+EXFUN (Fdeclare_equiv_charset, 4);
+EXFUN (Fdecode_big5_char, 1);
+EXFUN (Fdecode_char, 2);
+EXFUN (Fdecode_coding_region, 4);
+EXFUN (Fdecode_coding_string, 4);
+EXFUN (Fdecode_sjis_char, 1);
+EXFUN (Fdecode_time, 3);
+EXFUN (Fdefalias, 3);
+EXFUN (Fdefault_boundp, 1);
+EXFUN (Fdefault_file_modes, 0);
+EXFUN (Fdefault_toplevel_value, 1);
+EXFUN (Fdefault_value, 1);
+EXFUN (Fdefconst, UNEVALLED);
+EXFUN (Fdefconst_1, 3);
+EXFUN (Fdefine_category, 3);
+EXFUN (Fdefine_charset_alias, 2);
+EXFUN (Fdefine_charset_internal, MANY);
+EXFUN (Fdefine_coding_system_alias, 2);
+EXFUN (Fdefine_coding_system_internal, MANY);
+EXFUN (Fdefine_hash_table_test, 3);
+EXFUN (Fdefine_key, 4);
+EXFUN (Fdefvar, UNEVALLED);
+EXFUN (Fdefvar_1, 3);
+EXFUN (Fdefvaralias, 3);
+EXFUN (Fdelete, 2);
+EXFUN (Fdelete_all_overlays, 1);
+EXFUN (Fdelete_and_extract_region, 2);
+EXFUN (Fdelete_char, 2);
+EXFUN (Fdelete_directory_internal, 1);
+EXFUN (Fdelete_field, 1);
+EXFUN (Fdelete_file_internal, 1);
+EXFUN (Fdelete_frame, 2);
+EXFUN (Fdelete_other_windows_internal, 2);
+EXFUN (Fdelete_overlay, 1);
+EXFUN (Fdelete_process, 1);
+EXFUN (Fdelete_region, 2);
+EXFUN (Fdelete_terminal, 2);
+EXFUN (Fdelete_window_internal, 1);
+EXFUN (Fdelq, 2);
+EXFUN (Fdescribe_buffer_bindings, 3);
+EXFUN (Fdescribe_vector, 2);
+EXFUN (Fdetect_coding_region, 3);
+EXFUN (Fdetect_coding_string, 2);
+EXFUN (Fding, 1);
+EXFUN (Fdirectory_file_name, 1);
+EXFUN (Fdirectory_files, 5);
+EXFUN (Fdirectory_files_and_attributes, 6);
+EXFUN (Fdirectory_name_p, 1);
+EXFUN (Fdiscard_input, 0);
+EXFUN (Fdisplay__line_is_continued_p, 0);
+EXFUN (Fdisplay__update_for_mouse_movement, 2);
+EXFUN (Fdisplay_supports_face_attributes_p, 2);
+EXFUN (Fdo_auto_save, 2);
+EXFUN (Fdocumentation, 2);
+EXFUN (Fdocumentation_property, 3);
+EXFUN (Fdowncase, 1);
+EXFUN (Fdowncase_region, 3);
+EXFUN (Fdowncase_word, 1);
+EXFUN (Fdraw_string, 2);
+EXFUN (Fdump_colors, 0);
+EXFUN (Fdump_emacs_portable, 2);
+EXFUN (Fdump_emacs_portable__sort_predicate, 2);
+EXFUN (Fdump_emacs_portable__sort_predicate_copied, 2);
+EXFUN (Fdump_face, 1);
+EXFUN (Fdump_redisplay_history, 0);
+EXFUN (Felt, 2);
+EXFUN (Femacs_pid, 0);
+EXFUN (Fencode_big5_char, 1);
+EXFUN (Fencode_char, 2);
+EXFUN (Fencode_coding_region, 4);
+EXFUN (Fencode_coding_string, 4);
+EXFUN (Fencode_sjis_char, 1);
+EXFUN (Fencode_time, MANY);
+EXFUN (Fend_kbd_macro, 2);
+EXFUN (Fend_of_line, 1);
+EXFUN (Feobp, 0);
+EXFUN (Feolp, 0);
+EXFUN (Feq, 2) ATTRIBUTE_CONST;
+EXFUN (Feql, 2);
+EXFUN (Feqlsign, MANY);
+EXFUN (Fequal, 2);
+EXFUN (Fequal_including_properties, 2);
+EXFUN (Ferase_buffer, 0);
+EXFUN (Ferror_message_string, 1);
+EXFUN (Feval, 2);
+EXFUN (Feval_buffer, 5);
+EXFUN (Feval_region, 4);
+EXFUN (Fevent_convert_list, 1);
+EXFUN (Fevent_symbol_parse_modifiers, 1);
+EXFUN (Fexecute_kbd_macro, 3);
+_Noreturn EXFUN (Fexit_recursive_edit, 0) ATTRIBUTE_COLD;
+EXFUN (Fexp, 1);
+EXFUN (Fexpand_file_name, 2);
+EXFUN (Fexpt, 2);
+EXFUN (Fexternal_debugging_output, 1);
+EXFUN (Fface_attribute_relative_p, 2) ATTRIBUTE_CONST;
+EXFUN (Fface_attributes_as_vector, 1);
+EXFUN (Fface_font, 3);
+EXFUN (Ffboundp, 1);
+EXFUN (Ffceiling, 1);
+EXFUN (Ffeaturep, 2);
+EXFUN (Ffetch_bytecode, 1);
+EXFUN (Fffloor, 1);
+EXFUN (Ffield_beginning, 3);
+EXFUN (Ffield_end, 3);
+EXFUN (Ffield_string, 1);
+EXFUN (Ffield_string_no_properties, 1);
+EXFUN (Ffile_accessible_directory_p, 1);
+EXFUN (Ffile_acl, 1);
+EXFUN (Ffile_attributes, 2);
+EXFUN (Ffile_attributes_lessp, 2);
+EXFUN (Ffile_directory_p, 1);
+EXFUN (Ffile_executable_p, 1);
+EXFUN (Ffile_exists_p, 1);
+EXFUN (Ffile_locked_p, 1);
+EXFUN (Ffile_modes, 2);
+EXFUN (Ffile_name_absolute_p, 1);
+EXFUN (Ffile_name_all_completions, 2);
+EXFUN (Ffile_name_as_directory, 1);
+EXFUN (Ffile_name_case_insensitive_p, 1);
+EXFUN (Ffile_name_completion, 3);
+EXFUN (Ffile_name_concat, MANY);
+EXFUN (Ffile_name_directory, 1);
+EXFUN (Ffile_name_nondirectory, 1);
+EXFUN (Ffile_newer_than_file_p, 2);
+EXFUN (Ffile_readable_p, 1);
+EXFUN (Ffile_regular_p, 1);
+EXFUN (Ffile_selinux_context, 1);
+EXFUN (Ffile_symlink_p, 1);
+EXFUN (Ffile_system_info, 1);
+EXFUN (Ffile_writable_p, 1);
+EXFUN (Ffillarray, 2);
+EXFUN (Ffind_buffer, 2);
+EXFUN (Ffind_charset_region, 3);
+EXFUN (Ffind_charset_string, 2);
+EXFUN (Ffind_coding_systems_region_internal, 3);
+EXFUN (Ffind_composition_internal, 4);
+EXFUN (Ffind_file_long_lines_p, 1);
+EXFUN (Ffind_file_name_handler, 2);
+EXFUN (Ffind_font, 2);
+EXFUN (Ffind_operation_coding_system, MANY);
+EXFUN (Ffloat, 1);
+EXFUN (Ffloat_time, 1);
+EXFUN (Ffloatp, 1) ATTRIBUTE_CONST;
+EXFUN (Ffloor, 2);
+EXFUN (Fflush_standard_output, 0);
+EXFUN (Ffmakunbound, 1);
+EXFUN (Ffollowing_char, 0);
+EXFUN (Ffont_at, 3);
+EXFUN (Ffont_drive_otf, 6);
+EXFUN (Ffont_face_attributes, 2);
+EXFUN (Ffont_family_list, 1);
+EXFUN (Ffont_get, 2);
+EXFUN (Ffont_get_glyphs, 4);
+EXFUN (Ffont_has_char_p, 3);
+EXFUN (Ffont_info, 2);
+EXFUN (Ffont_match_p, 2);
+EXFUN (Ffont_otf_alternates, 3);
+EXFUN (Ffont_put, 3);
+EXFUN (Ffont_shape_gstring, 2);
+EXFUN (Ffont_spec, MANY);
+EXFUN (Ffont_variation_glyphs, 2);
+EXFUN (Ffont_xlfd_name, 3);
+EXFUN (Ffontp, 2);
+EXFUN (Fforce_mode_line_update, 1);
+EXFUN (Fforce_window_update, 1);
+EXFUN (Fformat, MANY);
+EXFUN (Fformat_message, MANY);
+EXFUN (Fformat_mode_line, 4);
+EXFUN (Fformat_network_address, 2);
+EXFUN (Fformat_time_string, 3);
+EXFUN (Fforward_char, 1);
+EXFUN (Fforward_comment, 1);
+EXFUN (Fforward_line, 1);
+EXFUN (Fforward_word, 1);
+EXFUN (Fframe__set_was_invisible, 2);
+EXFUN (Fframe_after_make_frame, 2);
+EXFUN (Fframe_ancestor_p, 2);
+EXFUN (Fframe_char_height, 1);
+EXFUN (Fframe_char_width, 1);
+EXFUN (Fframe_child_frame_border_width, 1);
+EXFUN (Fframe_face_hash_table, 1);
+EXFUN (Fframe_first_window, 1);
+EXFUN (Fframe_focus, 1);
+EXFUN (Fframe_font_cache, 1);
+EXFUN (Fframe_internal_border_width, 1);
+EXFUN (Fframe_list, 0);
+EXFUN (Fframe_live_p, 1);
+EXFUN (Fframe_native_height, 1);
+EXFUN (Fframe_native_width, 1);
+EXFUN (Fframe_old_selected_window, 1);
+EXFUN (Fframe_or_buffer_changed_p, 1);
+EXFUN (Fframe_parameter, 2);
+EXFUN (Fframe_parameters, 1);
+EXFUN (Fframe_parent, 1);
+EXFUN (Fframe_pointer_visible_p, 1);
+EXFUN (Fframe_position, 1);
+EXFUN (Fframe_root_window, 1);
+EXFUN (Fframe_scale_factor, 1);
+EXFUN (Fframe_selected_window, 1);
+EXFUN (Fframe_terminal, 1);
+EXFUN (Fframe_text_cols, 1);
+EXFUN (Fframe_text_height, 1);
+EXFUN (Fframe_text_lines, 1);
+EXFUN (Fframe_text_width, 1);
+EXFUN (Fframe_total_cols, 1);
+EXFUN (Fframe_total_lines, 1);
+EXFUN (Fframe_visible_p, 1);
+EXFUN (Fframe_window_state_change, 1);
+EXFUN (Fframe_windows_min_size, 4) ATTRIBUTE_CONST;
+EXFUN (Fframep, 1);
+EXFUN (Ffrexp, 1);
+EXFUN (Ffringe_width, 1);
+EXFUN (Ffround, 1);
+EXFUN (Ffset, 2);
+EXFUN (Fftruncate, 1);
+EXFUN (Ffunc_arity, 1);
+EXFUN (Ffuncall, MANY);
+EXFUN (Ffuncall_interactively, MANY);
+EXFUN (Ffuncall_with_delayed_message, 3);
+EXFUN (Ffunction, UNEVALLED);
+EXFUN (Ffunction_equal, 2);
+EXFUN (Ffunctionp, 1);
+EXFUN (Ffuture_await, 1);
+EXFUN (Ffuture_done_p, 1);
+EXFUN (Ffuturep, 1);
+EXFUN (Fgap_position, 0);
+EXFUN (Fgap_size, 0);
+EXFUN (Fgarbage_collect, 0);
+EXFUN (Fgarbage_collect_maybe, 1);
+EXFUN (Fgc_counts, 0);
+EXFUN (Fgc_events, 0);
+EXFUN (Fgenerate_new_buffer_name, 2);
+EXFUN (Fgeq, MANY);
+EXFUN (Fget, 2);
+EXFUN (Fget_buffer, 1);
+EXFUN (Fget_buffer_create, 2);
+EXFUN (Fget_buffer_process, 1);
+EXFUN (Fget_buffer_window, 2);
+EXFUN (Fget_byte, 2);
+EXFUN (Fget_char_property, 3);
+EXFUN (Fget_char_property_and_overlay, 3);
+EXFUN (Fget_display_property, 4);
+EXFUN (Fget_file_buffer, 1);
+EXFUN (Fget_file_char, 0);
+EXFUN (Fget_internal_run_time, 0);
+EXFUN (Fget_load_suffixes, 0);
+EXFUN (Fget_pos_property, 3);
+EXFUN (Fget_process, 1);
+EXFUN (Fget_text_property, 3);
+EXFUN (Fget_truename_buffer, 1);
+EXFUN (Fget_unicode_property_internal, 2);
+EXFUN (Fget_unused_category, 1);
+EXFUN (Fget_unused_iso_final_char, 2);
+EXFUN (Fget_variable_watchers, 1);
+EXFUN (Fgetenv_internal, 2);
+EXFUN (Fgethash, 3);
+EXFUN (Fgnutls_asynchronous_parameters, 2);
+EXFUN (Fgnutls_available_p, 0);
+EXFUN (Fgnutls_boot, 4);
+EXFUN (Fgnutls_bye, 2);
+EXFUN (Fgnutls_ciphers, 0);
+EXFUN (Fgnutls_deinit, 1);
+EXFUN (Fgnutls_digests, 0);
+EXFUN (Fgnutls_error_fatalp, 1);
+EXFUN (Fgnutls_error_string, 1);
+EXFUN (Fgnutls_errorp, 1) ATTRIBUTE_CONST;
+EXFUN (Fgnutls_format_certificate, 1);
+EXFUN (Fgnutls_get_initstage, 1);
+EXFUN (Fgnutls_hash_digest, 2);
+EXFUN (Fgnutls_hash_mac, 3);
+EXFUN (Fgnutls_macs, 0);
+EXFUN (Fgnutls_peer_status, 1);
+EXFUN (Fgnutls_peer_status_warning_describe, 1);
+EXFUN (Fgnutls_symmetric_decrypt, 5);
+EXFUN (Fgnutls_symmetric_encrypt, 5);
+EXFUN (Fgoto_char, 1);
+EXFUN (Fgpm_mouse_start, 0);
+EXFUN (Fgpm_mouse_stop, 0);
+EXFUN (Fgroup_gid, 0);
+EXFUN (Fgroup_name, 1);
+EXFUN (Fgroup_real_gid, 0);
+EXFUN (Fgtr, MANY);
+EXFUN (Fhandle_switch_frame, 1);
+EXFUN (Fhash_table_count, 1);
+EXFUN (Fhash_table_p, 1);
+EXFUN (Fhash_table_rehash_size, 1);
+EXFUN (Fhash_table_rehash_threshold, 1);
+EXFUN (Fhash_table_size, 1);
+EXFUN (Fhash_table_test, 1);
+EXFUN (Fhash_table_weakness, 1);
+EXFUN (Fhelp__describe_vector, 7);
+EXFUN (Ficonify_frame, 1);
+EXFUN (Fidentity, 1) ATTRIBUTE_CONST;
+EXFUN (Fif, UNEVALLED);
+EXFUN (Findent_to, 2);
+EXFUN (Findirect_function, 2);
+EXFUN (Findirect_variable, 1);
+EXFUN (Finnermost_minibuffer_p, 1);
+EXFUN (Finput_pending_p, 1);
+EXFUN (Finsert, MANY);
+EXFUN (Finsert_and_inherit, MANY);
+EXFUN (Finsert_and_inherit_before_markers, MANY);
+EXFUN (Finsert_before_markers, MANY);
+EXFUN (Finsert_buffer_substring, 3);
+EXFUN (Finsert_byte, 3);
+EXFUN (Finsert_char, 3);
+EXFUN (Finsert_file_contents, 5);
+EXFUN (Finteger_or_marker_p, 1);
+EXFUN (Fintegerp, 1) ATTRIBUTE_CONST;
+EXFUN (Finteractive, UNEVALLED) ATTRIBUTE_CONST;
+EXFUN (Finteractive_form, 1);
+EXFUN (Fintern, 2);
+EXFUN (Fintern_soft, 2);
+EXFUN (Finternal__define_uninitialized_variable, 2);
+EXFUN (Finternal__hash_table_buckets, 1);
+EXFUN (Finternal__hash_table_histogram, 1);
+EXFUN (Finternal__hash_table_index_size, 1);
+EXFUN (Finternal__set_buffer_modified_tick, 2);
+EXFUN (Finternal_char_font, 2);
+EXFUN (Finternal_complete_buffer, 3);
+EXFUN (Finternal_copy_lisp_face, 4);
+EXFUN (Finternal_decode_string_utf_8, 7);
+EXFUN (Finternal_default_interrupt_process, 2);
+EXFUN (Finternal_default_process_filter, 2);
+EXFUN (Finternal_default_process_sentinel, 2);
+EXFUN (Finternal_default_signal_process, 3);
+EXFUN (Finternal_describe_syntax_value, 1);
+EXFUN (Finternal_encode_string_utf_8, 7);
+EXFUN (Finternal_face_x_get_resource, 3);
+EXFUN (Finternal_get_lisp_face_attribute, 3);
+EXFUN (Finternal_handle_focus_in, 1);
+EXFUN (Finternal_lisp_face_attribute_values, 1);
+EXFUN (Finternal_lisp_face_empty_p, 2);
+EXFUN (Finternal_lisp_face_equal_p, 3);
+EXFUN (Finternal_lisp_face_p, 2);
+EXFUN (Finternal_make_lisp_face, 2);
+EXFUN (Finternal_merge_in_global_face, 2);
+EXFUN (Finternal_set_alternative_font_family_alist, 1);
+EXFUN (Finternal_set_alternative_font_registry_alist, 1);
+EXFUN (Finternal_set_font_selection_order, 1);
+EXFUN (Finternal_set_lisp_face_attribute, 4);
+EXFUN (Finternal_set_lisp_face_attribute_from_resource, 4);
+EXFUN (Finternal_show_cursor, 2);
+EXFUN (Finternal_show_cursor_p, 1);
+EXFUN (Finternal_stack_stats, 0);
+EXFUN (Finternal_track_mouse, 1);
+EXFUN (Finterrupt_process, 2);
+EXFUN (Finvisible_p, 1);
+EXFUN (Finvocation_directory, 0);
+EXFUN (Finvocation_name, 0);
+EXFUN (Fisnan, 1);
+EXFUN (Fiso_charset, 3);
+EXFUN (Fkey_binding, 4);
+EXFUN (Fkey_description, 2);
+EXFUN (Fkeyboard_coding_system, 1);
+EXFUN (Fkeymap__get_keyelt, 2);
+EXFUN (Fkeymap_parent, 1);
+EXFUN (Fkeymap_prompt, 1);
+EXFUN (Fkeymapp, 1);
+EXFUN (Fkeywordp, 1);
+EXFUN (Fkill_all_local_variables, 1);
+EXFUN (Fkill_buffer, 1);
+_Noreturn EXFUN (Fkill_emacs, 2) ATTRIBUTE_COLD;
+EXFUN (Fkill_local_variable, 1);
+EXFUN (Fkill_process, 2);
+EXFUN (Flast_nonminibuf_frame, 0);
+EXFUN (Flcms2_available_p, 0);
+EXFUN (Flcms_cam02_ucs, 4);
+EXFUN (Flcms_cie_de2000, 5);
+EXFUN (Flcms_jab_to_jch, 3);
+EXFUN (Flcms_jch_to_jab, 3);
+EXFUN (Flcms_jch_to_xyz, 3);
+EXFUN (Flcms_temp_to_white_point, 1);
+EXFUN (Flcms_xyz_to_jch, 3);
+EXFUN (Fldexp, 2);
+EXFUN (Flength, 1);
+EXFUN (Flength_equal, 2);
+EXFUN (Flength_greater, 2);
+EXFUN (Flength_less, 2);
+EXFUN (Fleq, MANY);
+EXFUN (Flet, UNEVALLED);
+EXFUN (FletX, UNEVALLED);
+EXFUN (Flibxml_available_p, 0);
+EXFUN (Flibxml_parse_html_region, 4);
+EXFUN (Flibxml_parse_xml_region, 4);
+EXFUN (Fline_beginning_position, 1);
+EXFUN (Fline_end_position, 1);
+EXFUN (Fline_number_at_pos, 2);
+EXFUN (Fline_number_display_width, 1);
+EXFUN (Fline_pixel_height, 0);
+EXFUN (Flist, MANY);
+EXFUN (Flist_fonts, 4);
+EXFUN (Flist_system_processes, 0);
+EXFUN (Flistp, 1) ATTRIBUTE_CONST;
+EXFUN (Fload, 5);
+EXFUN (Fload_average, 1);
+EXFUN (Flocal_variable_if_set_p, 2);
+EXFUN (Flocal_variable_p, 2);
+EXFUN (Flocale_info, 1);
+EXFUN (Flocate_file_internal, 4);
+EXFUN (Flock_buffer, 1);
+EXFUN (Flock_file, 1);
+EXFUN (Flog, 2);
+EXFUN (Flogand, MANY);
+EXFUN (Flogb, 1);
+EXFUN (Flogcount, 1);
+EXFUN (Flogior, MANY);
+EXFUN (Flognot, 1);
+EXFUN (Flogxor, MANY);
+EXFUN (Flooking_at, 2);
+EXFUN (Flookup_image_map, 3);
+EXFUN (Flookup_key, 3);
+EXFUN (Flossage_size, 1);
+EXFUN (Flower_frame, 1);
+EXFUN (Flread__substitute_object_in_subtree, 3);
+EXFUN (Flss, MANY);
+EXFUN (Fmacroexpand, 2);
+EXFUN (Fmake_bool_vector, 2);
+EXFUN (Fmake_byte_code, MANY);
+EXFUN (Fmake_category_set, 1);
+EXFUN (Fmake_category_table, 0);
+EXFUN (Fmake_channel, 2);
+EXFUN (Fmake_char, 5);
+EXFUN (Fmake_char_table, 2);
+EXFUN (Fmake_closure, MANY);
+EXFUN (Fmake_condition_variable, 2);
+EXFUN (Fmake_directory_internal, 1);
+EXFUN (Fmake_finalizer, 1);
+EXFUN (Fmake_frame_invisible, 2);
+EXFUN (Fmake_frame_visible, 1);
+EXFUN (Fmake_hash_table, MANY);
+EXFUN (Fmake_indirect_buffer, 4);
+EXFUN (Fmake_jsonrpc_thread, 2);
+EXFUN (Fmake_jsonrpc_thread__body, 1);
+EXFUN (Fmake_keymap, 1);
+EXFUN (Fmake_list, 2);
+EXFUN (Fmake_local_variable, 1);
+EXFUN (Fmake_marker, 0);
+EXFUN (Fmake_mutex, 1);
+EXFUN (Fmake_network_process, MANY);
+EXFUN (Fmake_overlay, 5);
+EXFUN (Fmake_pipe_process, MANY);
+EXFUN (Fmake_process, MANY);
+EXFUN (Fmake_record, 3);
+EXFUN (Fmake_serial_process, MANY);
+EXFUN (Fmake_sparse_keymap, 1);
+EXFUN (Fmake_string, 3);
+EXFUN (Fmake_symbol, 1);
+EXFUN (Fmake_symbolic_link, 3);
+EXFUN (Fmake_temp_file_internal, 4);
+EXFUN (Fmake_temp_name, 1);
+EXFUN (Fmake_terminal_frame, 1);
+EXFUN (Fmake_thread, 3);
+EXFUN (Fmake_thread_pool, 2);
+EXFUN (Fmake_var_non_special, 1);
+EXFUN (Fmake_variable_buffer_local, 1);
+EXFUN (Fmake_vector, 2);
+EXFUN (Fmakunbound, 1);
+EXFUN (Fmalloc_info, 0);
+EXFUN (Fmalloc_trim, 1);
+EXFUN (Fmap_char_table, 2);
+EXFUN (Fmap_charset_chars, 5);
+EXFUN (Fmap_keymap, 3);
+EXFUN (Fmap_keymap_internal, 2);
+EXFUN (Fmapatoms, 2);
+EXFUN (Fmapbacktrace, 2);
+EXFUN (Fmapc, 2);
+EXFUN (Fmapcan, 2);
+EXFUN (Fmapcar, 2);
+EXFUN (Fmapconcat, 3);
+EXFUN (Fmaphash, 2);
+EXFUN (Fmark_marker, 0);
+EXFUN (Fmarker_buffer, 1);
+EXFUN (Fmarker_insertion_type, 1);
+EXFUN (Fmarker_position, 1);
+EXFUN (Fmarkerp, 1);
+EXFUN (Fmatch_beginning, 1);
+EXFUN (Fmatch_data, 3);
+EXFUN (Fmatch_data__translate, 1);
+EXFUN (Fmatch_end, 1);
+EXFUN (Fmatching_paren, 1);
+EXFUN (Fmax, MANY);
+EXFUN (Fmax_char, 1) ATTRIBUTE_CONST;
+EXFUN (Fmd5, 5);
+EXFUN (Fmember, 2);
+EXFUN (Fmemory_full, 0);
+EXFUN (Fmemory_info, 0);
+EXFUN (Fmemory_protect_now, 0);
+EXFUN (Fmemory_use_counts, 0);
+EXFUN (Fmemq, 2);
+EXFUN (Fmemql, 2);
+EXFUN (Fmenu_bar_menu_at_x_y, 3);
+EXFUN (Fmerge_face_attribute, 3);
+EXFUN (Fmessage, MANY);
+EXFUN (Fmessage_box, MANY);
+EXFUN (Fmessage_or_box, MANY);
+EXFUN (Fmgc_bool_vector, MANY);
+EXFUN (Fmgc_cons, 2);
+EXFUN (Fmgc_counts, 0);
+EXFUN (Fmgc_float, 1);
+EXFUN (Fmgc_make_bool_vector, 2);
+EXFUN (Fmgc_make_string, 3);
+EXFUN (Fmgc_make_symbol, 1);
+EXFUN (Fmgc_make_vector, 2);
+EXFUN (Fmgc_vector, MANY);
+EXFUN (Fmin, MANY);
+EXFUN (Fminibuffer_contents, 0);
+EXFUN (Fminibuffer_contents_no_properties, 0);
+EXFUN (Fminibuffer_depth, 0);
+EXFUN (Fminibuffer_innermost_command_loop_p, 1);
+EXFUN (Fminibuffer_prompt, 0);
+EXFUN (Fminibuffer_prompt_end, 0);
+EXFUN (Fminibuffer_selected_window, 0);
+EXFUN (Fminibuffer_window, 1);
+EXFUN (Fminibufferp, 2);
+EXFUN (Fminor_mode_key_binding, 2);
+EXFUN (Fminus, MANY);
+EXFUN (Fmod, 2);
+EXFUN (Fmodify_category_entry, 4);
+EXFUN (Fmodify_frame_parameters, 2);
+EXFUN (Fmodify_syntax_entry, 3);
+EXFUN (Fmodule_function_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fmouse_pixel_position, 0);
+EXFUN (Fmouse_position, 0);
+EXFUN (Fmove_overlay, 4);
+EXFUN (Fmove_point_visually, 1);
+EXFUN (Fmove_to_column, 2);
+EXFUN (Fmove_to_window_line, 1);
+EXFUN (Fmultibyte_char_to_unibyte, 1);
+EXFUN (Fmultibyte_string_p, 1);
+EXFUN (Fmutex_lock, 1);
+EXFUN (Fmutex_name, 1);
+EXFUN (Fmutex_unlock, 1);
+EXFUN (Fmutexp, 1);
+EXFUN (Fnarrow_to_region, 2);
+EXFUN (Fnative_comp_available_p, 0);
+EXFUN (Fnative_comp_unit_file, 1);
+EXFUN (Fnative_comp_unit_set_file, 2);
+EXFUN (Fnative_elisp_load, 2);
+EXFUN (Fnatnump, 1) ATTRIBUTE_CONST;
+EXFUN (Fnconc, MANY);
+EXFUN (Fneq, 2);
+EXFUN (Fnetwork_interface_info, 1);
+EXFUN (Fnetwork_interface_list, 2);
+EXFUN (Fnetwork_lookup_address_info, 3);
+EXFUN (Fnewline_cache_check, 1);
+EXFUN (Fnext_char_property_change, 2);
+EXFUN (Fnext_frame, 2);
+EXFUN (Fnext_overlay_change, 1);
+EXFUN (Fnext_property_change, 3);
+EXFUN (Fnext_read_file_uses_dialog_p, 0);
+EXFUN (Fnext_single_char_property_change, 4);
+EXFUN (Fnext_single_property_change, 4);
+EXFUN (Fnext_window, 3);
+EXFUN (Fngettext, 3);
+EXFUN (Fnlistp, 1) ATTRIBUTE_CONST;
+EXFUN (Fnnheader__parse_nov_region, 3);
+EXFUN (Fnnimap__response_end, 1);
+EXFUN (Fnreverse, 1);
+EXFUN (Fntake, 2);
+EXFUN (Fnth, 2);
+EXFUN (Fnthcdr, 2);
+EXFUN (Fnull, 1) ATTRIBUTE_CONST;
+EXFUN (Fnum_processors, 1);
+EXFUN (Fnumber_or_marker_p, 1);
+EXFUN (Fnumber_to_string, 1);
+EXFUN (Fnumberp, 1) ATTRIBUTE_CONST;
+EXFUN (Fobject_intervals, 1);
+EXFUN (Fold_selected_frame, 0);
+EXFUN (Fold_selected_window, 0);
+EXFUN (Fopen_dribble_file, 1);
+EXFUN (Fopen_font, 3);
+EXFUN (Fopen_termscript, 1);
+EXFUN (Foptimize_char_table, 2);
+EXFUN (For, UNEVALLED);
+EXFUN (Fother_buffer, 3);
+EXFUN (Fother_window_for_scrolling, 0);
+EXFUN (Foverlay_buffer, 1);
+EXFUN (Foverlay_end, 1);
+EXFUN (Foverlay_get, 2);
+EXFUN (Foverlay_lists, 0);
+EXFUN (Foverlay_properties, 1);
+EXFUN (Foverlay_put, 3);
+EXFUN (Foverlay_recenter, 1);
+EXFUN (Foverlay_start, 1);
+EXFUN (Foverlay_tree, 1);
+EXFUN (Foverlayp, 1);
+EXFUN (Foverlays_at, 2);
+EXFUN (Foverlays_in, 2);
+EXFUN (Fparse_partial_sexp, 6);
+EXFUN (Fparse_partial_sexp_states, 2);
+EXFUN (Fpdumper_stats, 0);
+EXFUN (Fplay_sound_internal, 1);
+EXFUN (Fplist_get, 3);
+EXFUN (Fplist_member, 3);
+EXFUN (Fplist_put, 4);
+EXFUN (Fplus, MANY);
+EXFUN (Fpoint, 0);
+EXFUN (Fpoint_marker, 0);
+EXFUN (Fpoint_max, 0);
+EXFUN (Fpoint_max_marker, 0);
+EXFUN (Fpoint_min, 0);
+EXFUN (Fpoint_min_marker, 0);
+EXFUN (Fpos_bol, 1);
+EXFUN (Fpos_eol, 1);
+EXFUN (Fpos_visible_in_window_p, 3);
+EXFUN (Fposition_bytes, 1);
+EXFUN (Fposix_looking_at, 2);
+EXFUN (Fposix_search_backward, 4);
+EXFUN (Fposix_search_forward, 4);
+EXFUN (Fposix_string_match, 4);
+EXFUN (Fposn_at_point, 2);
+EXFUN (Fposn_at_x_y, 4);
+EXFUN (Fprefix_numeric_value, 1);
+EXFUN (Fprevious_char, 0);
+EXFUN (Fprevious_char_property_change, 2);
+EXFUN (Fprevious_frame, 2);
+EXFUN (Fprevious_overlay_change, 1);
+EXFUN (Fprevious_property_change, 3);
+EXFUN (Fprevious_single_char_property_change, 4);
+EXFUN (Fprevious_single_property_change, 4);
+EXFUN (Fprevious_window, 3);
+EXFUN (Fprin1, 3);
+EXFUN (Fprin1_to_string, 3);
+EXFUN (Fprinc, 2);
+EXFUN (Fprint, 2);
+EXFUN (Fprint_preprocess, 1);
+EXFUN (Fprocess_attributes, 1);
+EXFUN (Fprocess_buffer, 1);
+EXFUN (Fprocess_coding_system, 1);
+EXFUN (Fprocess_command, 1);
+EXFUN (Fprocess_contact, 3);
+EXFUN (Fprocess_datagram_address, 1);
+EXFUN (Fprocess_descriptors, 1);
+EXFUN (Fprocess_exit_status, 1);
+EXFUN (Fprocess_filter, 1);
+EXFUN (Fprocess_id, 1);
+EXFUN (Fprocess_inherit_coding_system_flag, 1);
+EXFUN (Fprocess_list, 0);
+EXFUN (Fprocess_mark, 1);
+EXFUN (Fprocess_name, 1);
+EXFUN (Fprocess_plist, 1);
+EXFUN (Fprocess_query_on_exit_flag, 1);
+EXFUN (Fprocess_running_child_p, 1);
+EXFUN (Fprocess_select, 1);
+EXFUN (Fprocess_send_eof, 1);
+EXFUN (Fprocess_send_region, 3);
+EXFUN (Fprocess_send_string, 2);
+EXFUN (Fprocess_sentinel, 1);
+EXFUN (Fprocess_status, 1);
+EXFUN (Fprocess_thread, 1);
+EXFUN (Fprocess_tty_name, 2);
+EXFUN (Fprocess_type, 1);
+EXFUN (Fprocessp, 1);
+EXFUN (Fprofiler_cpu_log, 0);
+EXFUN (Fprofiler_cpu_running_p, 0);
+EXFUN (Fprofiler_cpu_start, 1);
+EXFUN (Fprofiler_cpu_stop, 0);
+EXFUN (Fprofiler_memory_log, 0);
+EXFUN (Fprofiler_memory_running_p, 0);
+EXFUN (Fprofiler_memory_start, 0);
+EXFUN (Fprofiler_memory_stop, 0);
+EXFUN (Fprog1, UNEVALLED);
+EXFUN (Fprogn, UNEVALLED);
+EXFUN (Fprogram_version, 0);
+EXFUN (Fproper_list_p, 1) ATTRIBUTE_CONST;
+EXFUN (Fpropertize, MANY);
+EXFUN (Fprovide, 2);
+EXFUN (Fpurecopy, 1);
+EXFUN (Fpush_global_mark, 0);
+EXFUN (Fput, 3);
+EXFUN (Fput_text_property, 5);
+EXFUN (Fput_unicode_property_internal, 3);
+EXFUN (Fputhash, 3);
+EXFUN (Fquery_font, 1);
+EXFUN (Fquit_process, 2);
+EXFUN (Fquo, MANY);
+EXFUN (Fquote, UNEVALLED);
+EXFUN (Fraise_frame, 1);
+EXFUN (Frandom, 1);
+EXFUN (Frassoc, 2);
+EXFUN (Frassq, 2);
+EXFUN (Fre__describe_compiled, 2);
+EXFUN (Fre_search_backward, 4);
+EXFUN (Fre_search_forward, 4);
+EXFUN (Fread, 1);
+EXFUN (Fread_annotated, 1);
+EXFUN (Fread_buffer, 4);
+EXFUN (Fread_char, 3);
+EXFUN (Fread_char_exclusive, 3);
+EXFUN (Fread_coding_system, 2);
+EXFUN (Fread_command, 2);
+EXFUN (Fread_event, 3);
+EXFUN (Fread_from_minibuffer, 7);
+EXFUN (Fread_from_string, 3);
+EXFUN (Fread_function, 1);
+EXFUN (Fread_key_sequence, 5);
+EXFUN (Fread_key_sequence_vector, 5);
+EXFUN (Fread_non_nil_coding_system, 1);
+EXFUN (Fread_string, 5);
+EXFUN (Fread_variable, 2);
+EXFUN (Frecent_auto_save_p, 0);
+EXFUN (Frecent_keys, 1);
+EXFUN (Frecenter, 2);
+EXFUN (Freconsider_frame_fonts, 1);
+EXFUN (Frecord, MANY);
+EXFUN (Frecordp, 1);
+EXFUN (Frecursion_depth, 0);
+EXFUN (Frecursive_edit, 0);
+EXFUN (Fredirect_debugging_output, 2);
+EXFUN (Fredirect_frame_focus, 2);
+EXFUN (Fredisplay, 1);
+EXFUN (Fredraw_display, 0);
+EXFUN (Fredraw_frame, 1);
+EXFUN (Fregexp_quote, 1);
+EXFUN (Fregion_beginning, 0);
+EXFUN (Fregion_end, 0);
+EXFUN (Fregister_ccl_program, 2);
+EXFUN (Fregister_code_conversion_map, 2);
+EXFUN (Frem, 2);
+EXFUN (Fremhash, 2);
+EXFUN (Fremove_list_of_text_properties, 4);
+EXFUN (Fremove_text_properties, 4);
+EXFUN (Fremove_variable_watcher, 2);
+EXFUN (Frename_buffer, 2);
+EXFUN (Frename_file, 3);
+EXFUN (Freplace_buffer_contents, 3);
+EXFUN (Freplace_match, 5);
+EXFUN (Frequire, 3);
+EXFUN (Fresize_mini_window_internal, 1);
+EXFUN (Frestore_buffer_modified_p, 1);
+EXFUN (Fresume_tty, 1);
+EXFUN (Freverse, 1);
+EXFUN (Fright_divider_width, 1);
+EXFUN (Fround, 2);
+EXFUN (Frun_hook_with_args, MANY);
+EXFUN (Frun_hook_with_args_until_failure, MANY);
+EXFUN (Frun_hook_with_args_until_success, MANY);
+EXFUN (Frun_hook_wrapped, MANY);
+EXFUN (Frun_hooks, MANY);
+EXFUN (Frun_window_configuration_change_hook, 1);
+EXFUN (Frun_window_scroll_functions, 1);
+EXFUN (Fsafe_length, 1);
+EXFUN (Fsave_current_buffer, UNEVALLED);
+EXFUN (Fsave_excursion, UNEVALLED);
+EXFUN (Fsave_restriction, UNEVALLED);
+EXFUN (Fscan_lists, 3);
+EXFUN (Fscan_sexps, 2);
+EXFUN (Fscroll_bar_height, 1);
+EXFUN (Fscroll_bar_width, 1);
+EXFUN (Fscroll_down, 1);
+EXFUN (Fscroll_left, 2);
+EXFUN (Fscroll_right, 2);
+EXFUN (Fscroll_up, 1);
+EXFUN (Fsearch_backward, 4);
+EXFUN (Fsearch_forward, 4);
+EXFUN (Fsearch_forward_regexps, 3);
+EXFUN (Fsearch_regexps_in_region, 3);
+EXFUN (Fsecure_hash, 5);
+EXFUN (Fsecure_hash_algorithms, 0);
+EXFUN (Fsecure_hash_file, 3);
+EXFUN (Fselect_frame, 2);
+EXFUN (Fselect_window, 2);
+EXFUN (Fselected_frame, 0);
+EXFUN (Fselected_window, 0);
+EXFUN (Fself_insert_command, 2);
+EXFUN (Fsend_string_to_terminal, 2);
+EXFUN (Fsequencep, 1);
+EXFUN (Fserial_process_configure, MANY);
+EXFUN (Fset, 2);
+EXFUN (Fset__this_command_keys, 1);
+EXFUN (Fset_binary_mode, 2);
+EXFUN (Fset_buffer, 1);
+EXFUN (Fset_buffer_auto_saved, 0);
+EXFUN (Fset_buffer_major_mode, 1);
+EXFUN (Fset_buffer_modified_p, 1);
+EXFUN (Fset_buffer_multibyte, 1);
+EXFUN (Fset_buffer_redisplay, 4);
+EXFUN (Fset_case_table, 1);
+EXFUN (Fset_category_table, 1);
+EXFUN (Fset_char_table_extra_slot, 3);
+EXFUN (Fset_char_table_parent, 2);
+EXFUN (Fset_char_table_range, 3);
+EXFUN (Fset_charset_plist, 2);
+EXFUN (Fset_charset_priority, MANY);
+EXFUN (Fset_coding_system_priority, MANY);
+EXFUN (Fset_default, 2);
+EXFUN (Fset_default_file_modes, 1);
+EXFUN (Fset_default_toplevel_value, 2);
+EXFUN (Fset_file_acl, 2);
+EXFUN (Fset_file_modes, 3);
+EXFUN (Fset_file_selinux_context, 2);
+EXFUN (Fset_file_times, 3);
+EXFUN (Fset_frame_height, 4);
+EXFUN (Fset_frame_position, 3);
+EXFUN (Fset_frame_selected_window, 3);
+EXFUN (Fset_frame_size, 4);
+EXFUN (Fset_frame_width, 4);
+EXFUN (Fset_frame_window_state_change, 2);
+EXFUN (Fset_input_interrupt_mode, 1);
+EXFUN (Fset_input_meta_mode, 2);
+EXFUN (Fset_input_mode, 4);
+EXFUN (Fset_keyboard_coding_system_internal, 2);
+EXFUN (Fset_keymap_parent, 2);
+EXFUN (Fset_marker, 3);
+EXFUN (Fset_marker_insertion_type, 2);
+EXFUN (Fset_match_data, 2);
+EXFUN (Fset_minibuffer_window, 1);
+EXFUN (Fset_mouse_pixel_position, 3);
+EXFUN (Fset_mouse_position, 3);
+EXFUN (Fset_network_process_option, 4);
+EXFUN (Fset_output_flow_control, 2);
+EXFUN (Fset_process_buffer, 2);
+EXFUN (Fset_process_coding_system, 3);
+EXFUN (Fset_process_datagram_address, 2);
+EXFUN (Fset_process_filter, 2);
+EXFUN (Fset_process_inherit_coding_system_flag, 2);
+EXFUN (Fset_process_plist, 2);
+EXFUN (Fset_process_query_on_exit_flag, 2);
+EXFUN (Fset_process_sentinel, 2);
+EXFUN (Fset_process_thread, 2);
+EXFUN (Fset_process_window_size, 3);
+EXFUN (Fset_quit_char, 1);
+EXFUN (Fset_safe_terminal_coding_system_internal, 1);
+EXFUN (Fset_standard_case_table, 1);
+EXFUN (Fset_syntax_table, 1);
+EXFUN (Fset_terminal_coding_system_internal, 2);
+EXFUN (Fset_terminal_parameter, 3);
+EXFUN (Fset_text_properties, 4);
+EXFUN (Fset_time_zone_rule, 1);
+EXFUN (Fset_visited_file_modtime, 1);
+EXFUN (Fset_window_buffer, 3);
+EXFUN (Fset_window_combination_limit, 2);
+EXFUN (Fset_window_configuration, 3);
+EXFUN (Fset_window_dedicated_p, 2);
+EXFUN (Fset_window_display_table, 2);
+EXFUN (Fset_window_fringes, 5);
+EXFUN (Fset_window_hscroll, 2);
+EXFUN (Fset_window_margins, 3);
+EXFUN (Fset_window_new_normal, 2);
+EXFUN (Fset_window_new_pixel, 3);
+EXFUN (Fset_window_new_total, 3);
+EXFUN (Fset_window_next_buffers, 2);
+EXFUN (Fset_window_parameter, 3);
+EXFUN (Fset_window_point, 2);
+EXFUN (Fset_window_prev_buffers, 2);
+EXFUN (Fset_window_scroll_bars, 6);
+EXFUN (Fset_window_start, 3);
+EXFUN (Fset_window_vscroll, 4);
+EXFUN (Fsetcar, 2);
+EXFUN (Fsetcdr, 2);
+EXFUN (Fsetplist, 2);
+EXFUN (Fsetq, UNEVALLED);
+EXFUN (Fshow_face_resources, 0);
+_Noreturn EXFUN (Fsignal, 2) ATTRIBUTE_COLD;
+EXFUN (Fsignal_names, 0);
+EXFUN (Fsignal_process, 3);
+EXFUN (Fsin, 1);
+EXFUN (Fsingle_key_description, 2);
+EXFUN (Fskip_chars_backward, 2);
+EXFUN (Fskip_chars_forward, 2);
+EXFUN (Fskip_syntax_backward, 2);
+EXFUN (Fskip_syntax_forward, 2);
+EXFUN (Fsleep_for, 2);
+EXFUN (Fsnarf_documentation, 1);
+EXFUN (Fsort, 3);
+EXFUN (Fsort_charsets, 1);
+EXFUN (Fspecial_variable_p, 1);
+EXFUN (Fsplit_char, 1);
+EXFUN (Fsplit_window_internal, 4);
+EXFUN (Fsqrt, 1);
+EXFUN (Fstandard_case_table, 0);
+EXFUN (Fstandard_category_table, 0);
+EXFUN (Fstandard_syntax_table, 0);
+EXFUN (Fstart_kbd_macro, 2);
+EXFUN (Fstop_process, 2);
+EXFUN (Fstore_kbd_macro_event, 1);
+EXFUN (Fstring, MANY);
+EXFUN (Fstring_as_multibyte, 1);
+EXFUN (Fstring_as_unibyte, 1);
+EXFUN (Fstring_bytes, 1);
+EXFUN (Fstring_collate_equalp, 4);
+EXFUN (Fstring_collate_lessp, 4);
+EXFUN (Fstring_distance, 3);
+EXFUN (Fstring_distance_nearest, 5);
+EXFUN (Fstring_equal, 2);
+EXFUN (Fstring_lessp, 2);
+EXFUN (Fstring_make_multibyte, 1);
+EXFUN (Fstring_make_unibyte, 1);
+EXFUN (Fstring_match, 4);
+EXFUN (Fstring_search, 3);
+EXFUN (Fstring_to_char, 1);
+EXFUN (Fstring_to_multibyte, 1);
+EXFUN (Fstring_to_number, 2);
+EXFUN (Fstring_to_syntax, 1);
+EXFUN (Fstring_to_unibyte, 1);
+EXFUN (Fstring_version_lessp, 2);
+EXFUN (Fstring_width, 3);
+EXFUN (Fstringp, 1) ATTRIBUTE_CONST;
+EXFUN (Fsub1, 1);
+EXFUN (Fsubr_arity, 1);
+EXFUN (Fsubr_documentation, 1);
+EXFUN (Fsubr_name, 1);
+EXFUN (Fsubr_native_comp_unit, 1);
+EXFUN (Fsubr_native_elisp_p, 1);
+EXFUN (Fsubr_native_lambda_list, 1);
+EXFUN (Fsubr_type, 1);
+EXFUN (Fsubrp, 1);
+EXFUN (Fsubst_char_in_region, 5);
+EXFUN (Fsubstitute_in_file_name, 1);
+EXFUN (Fsubstring, 3);
+EXFUN (Fsubstring_no_properties, 3);
+EXFUN (Fsuspend_emacs, 1);
+EXFUN (Fsuspend_tty, 1);
+EXFUN (Fsxhash_eq, 1);
+EXFUN (Fsxhash_eql, 1);
+EXFUN (Fsxhash_equal, 1);
+EXFUN (Fsxhash_equal_including_properties, 1);
+EXFUN (Fsymbol_function, 1);
+EXFUN (Fsymbol_name, 1);
+EXFUN (Fsymbol_plist, 1);
+EXFUN (Fsymbol_value, 1);
+EXFUN (Fsymbolp, 1) ATTRIBUTE_CONST;
+EXFUN (Fsyntax_class_to_char, 1);
+EXFUN (Fsyntax_table, 0);
+EXFUN (Fsyntax_table_p, 1);
+EXFUN (Fsystem_groups, 0);
+EXFUN (Fsystem_name, 0);
+EXFUN (Fsystem_users, 0);
+EXFUN (Ftab_bar_height, 2);
+EXFUN (Ftake, 2);
+EXFUN (Ftan, 1);
+EXFUN (Fterm__next_control, 2);
+EXFUN (Fterminal_coding_system, 1);
+EXFUN (Fterminal_list, 0);
+EXFUN (Fterminal_live_p, 1);
+EXFUN (Fterminal_name, 1);
+EXFUN (Fterminal_parameter, 2);
+EXFUN (Fterminal_parameters, 1);
+EXFUN (Fterpri, 2);
+EXFUN (Ftest_completion, 3);
+EXFUN (Ftext_char_description, 1);
+EXFUN (Ftext_properties_at, 2);
+EXFUN (Ftext_property_any, 5);
+EXFUN (Ftext_property_not_all, 5);
+EXFUN (Ftext_quoting_style, 0);
+EXFUN (Fthis_command_keys, 0);
+EXFUN (Fthis_command_keys_vector, 0);
+EXFUN (Fthis_single_command_keys, 0);
+EXFUN (Fthis_single_command_raw_keys, 0);
+EXFUN (Fthread_blocker, 1);
+EXFUN (Fthread_join, 1);
+EXFUN (Fthread_last_error, 1);
+EXFUN (Fthread_live_p, 1);
+EXFUN (Fthread_name, 1);
+EXFUN (Fthread_pool_p, 1);
+EXFUN (Fthread_pool_shutdown, 1);
+EXFUN (Fthread_pool_submit, 2);
+EXFUN (Fthread_signal, 3);
+EXFUN (Fthread_yield, 0);
+EXFUN (Fthreadp, 1);
+_Noreturn EXFUN (Fthrow, 2) ATTRIBUTE_COLD;
+EXFUN (Ftime_add, 2);
+EXFUN (Ftime_convert, 2);
+EXFUN (Ftime_equal_p, 2);
+EXFUN (Ftime_less_p, 2);
+EXFUN (Ftime_subtract, 2);
+EXFUN (Ftimes, MANY);
+EXFUN (Ftool_bar_height, 2);
+EXFUN (Ftool_bar_pixel_width, 1);
+_Noreturn EXFUN (Ftop_level, 0) ATTRIBUTE_COLD;
+EXFUN (Ftranslate_region_internal, 3);
+EXFUN (Ftranspose_regions, 5);
+EXFUN (Ftruncate, 2);
+EXFUN (Ftry_completion, 3);
+EXFUN (Ftty__output_buffer_size, 1);
+EXFUN (Ftty__set_output_buffer_size, 2);
+EXFUN (Ftty_display_color_cells, 1);
+EXFUN (Ftty_display_color_p, 1);
+EXFUN (Ftty_no_underline, 1);
+EXFUN (Ftty_suppress_bold_inverse_default_colors, 1);
+EXFUN (Ftty_top_frame, 1);
+EXFUN (Ftty_type, 1);
+EXFUN (Ftype_of, 1);
+EXFUN (Fundo_boundary, 0);
+EXFUN (Funencodable_char_position, 5);
+EXFUN (Funhandled_file_name_directory, 1);
+EXFUN (Funibyte_char_to_multibyte, 1);
+EXFUN (Funibyte_string, MANY);
+EXFUN (Funicode_property_table_internal, 1);
+EXFUN (Funify_charset, 3);
+EXFUN (Funintern, 2);
+EXFUN (Funix_sync, 0);
+EXFUN (Funlock_buffer, 0);
+EXFUN (Funlock_file, 1);
+EXFUN (Funwind_protect, UNEVALLED);
+EXFUN (Fupcase, 1);
+EXFUN (Fupcase_initials, 1);
+EXFUN (Fupcase_initials_region, 3);
+EXFUN (Fupcase_region, 3);
+EXFUN (Fupcase_word, 1);
+EXFUN (Fuse_global_map, 1);
+EXFUN (Fuse_local_map, 1);
+EXFUN (Fuser_full_name, 1);
+EXFUN (Fuser_login_name, 1);
+EXFUN (Fuser_ptrp, 1);
+EXFUN (Fuser_real_login_name, 0);
+EXFUN (Fuser_real_uid, 0);
+EXFUN (Fuser_uid, 0);
+EXFUN (Fvariable_binding_locus, 1);
+EXFUN (Fvconcat, MANY);
+EXFUN (Fvector, MANY);
+EXFUN (Fvector_or_char_table_p, 1);
+EXFUN (Fvectorp, 1);
+EXFUN (Fverify_visited_file_modtime, 1);
+EXFUN (Fvertical_motion, 3);
+EXFUN (Fvisible_frame_list, 0);
+EXFUN (Fvisited_file_modtime, 0);
+EXFUN (Fwaiting_for_user_input_p, 0);
+EXFUN (Fwhere_is_internal, 5);
+EXFUN (Fwhile, UNEVALLED);
+EXFUN (Fwiden, 0);
+EXFUN (Fwidget_apply, MANY);
+EXFUN (Fwidget_get, 2);
+EXFUN (Fwidget_put, 3);
+EXFUN (Fwindow_at, 3);
+EXFUN (Fwindow_body_height, 2);
+EXFUN (Fwindow_body_width, 2);
+EXFUN (Fwindow_bottom_divider_width, 1);
+EXFUN (Fwindow_buffer, 1);
+EXFUN (Fwindow_bump_use_time, 1);
+EXFUN (Fwindow_combination_limit, 1);
+EXFUN (Fwindow_configuration_equal_p, 2);
+EXFUN (Fwindow_configuration_frame, 1);
+EXFUN (Fwindow_configuration_p, 1);
+EXFUN (Fwindow_dedicated_p, 1);
+EXFUN (Fwindow_display_table, 1);
+EXFUN (Fwindow_end, 2);
+EXFUN (Fwindow_frame, 1);
+EXFUN (Fwindow_fringes, 1);
+EXFUN (Fwindow_header_line_height, 1);
+EXFUN (Fwindow_hscroll, 1);
+EXFUN (Fwindow_left_child, 1);
+EXFUN (Fwindow_left_column, 1);
+EXFUN (Fwindow_line_height, 2);
+EXFUN (Fwindow_lines_pixel_dimensions, 6);
+EXFUN (Fwindow_list, 3);
+EXFUN (Fwindow_list_1, 3);
+EXFUN (Fwindow_live_p, 1);
+EXFUN (Fwindow_margins, 1);
+EXFUN (Fwindow_minibuffer_p, 1);
+EXFUN (Fwindow_mode_line_height, 1);
+EXFUN (Fwindow_new_normal, 1);
+EXFUN (Fwindow_new_pixel, 1);
+EXFUN (Fwindow_new_total, 1);
+EXFUN (Fwindow_next_buffers, 1);
+EXFUN (Fwindow_next_sibling, 1);
+EXFUN (Fwindow_normal_size, 2);
+EXFUN (Fwindow_old_body_pixel_height, 1);
+EXFUN (Fwindow_old_body_pixel_width, 1);
+EXFUN (Fwindow_old_buffer, 1);
+EXFUN (Fwindow_old_pixel_height, 1);
+EXFUN (Fwindow_old_pixel_width, 1);
+EXFUN (Fwindow_old_point, 1);
+EXFUN (Fwindow_parameter, 2);
+EXFUN (Fwindow_parameters, 1);
+EXFUN (Fwindow_parent, 1);
+EXFUN (Fwindow_pixel_height, 1);
+EXFUN (Fwindow_pixel_left, 1);
+EXFUN (Fwindow_pixel_top, 1);
+EXFUN (Fwindow_pixel_width, 1);
+EXFUN (Fwindow_point, 1);
+EXFUN (Fwindow_prev_buffers, 1);
+EXFUN (Fwindow_prev_sibling, 1);
+EXFUN (Fwindow_resize_apply, 2);
+EXFUN (Fwindow_resize_apply_total, 2);
+EXFUN (Fwindow_right_divider_width, 1);
+EXFUN (Fwindow_scroll_bar_height, 1);
+EXFUN (Fwindow_scroll_bar_width, 1);
+EXFUN (Fwindow_scroll_bars, 1);
+EXFUN (Fwindow_start, 1);
+EXFUN (Fwindow_system, 1);
+EXFUN (Fwindow_tab_line_height, 1);
+EXFUN (Fwindow_text_height, 2);
+EXFUN (Fwindow_text_pixel_size, 6);
+EXFUN (Fwindow_text_width, 2);
+EXFUN (Fwindow_top_child, 1);
+EXFUN (Fwindow_top_line, 1);
+EXFUN (Fwindow_total_height, 2);
+EXFUN (Fwindow_total_width, 2);
+EXFUN (Fwindow_use_time, 1);
+EXFUN (Fwindow_valid_p, 1);
+EXFUN (Fwindow_vscroll, 2);
+EXFUN (Fwindowp, 1);
+EXFUN (Fwrite_char, 2);
+EXFUN (Fwrite_region, 7);
+EXFUN (Fx_family_fonts, 2);
+EXFUN (Fx_focus_frame, 2);
+EXFUN (Fx_get_resource, 4);
+EXFUN (Fx_list_fonts, 5);
+EXFUN (Fx_load_color_file, 1);
+EXFUN (Fx_parse_geometry, 1);
+EXFUN (Fx_popup_dialog, 3);
+EXFUN (Fx_popup_menu, 2);
+EXFUN (Fyes_or_no_p, 1);
+EXFUN (Fzlib_available_p, 0);
+EXFUN (Fzlib_decompress_region, 3);
+#ifdef DEFINE_SYMBOLS
+static char const *const defsym_name[] = {
+	"nil",
+	"t",
+	"unbound",
+	"error",
+	"lambda",
+	"Automatic GC",
+	":adstyle",
+	":advertised-binding",
+	":align-to",
+	":antialias",
+	":ascii-compatible-p",
+	":avgwidth",
+	":background",
+	":bold",
+	":box",
+	":buffer",
+	":button",
+	":bytesize",
+	":category",
+	":cipher-aead-capable",
+	":cipher-blocksize",
+	":cipher-id",
+	":cipher-ivsize",
+	":cipher-keysize",
+	":cipher-tagsize",
+	":coding",
+	":color",
+	":combining-capability",
+	":command",
+	":complete-negotiation",
+	":connection-type",
+	":crlfiles",
+	":data",
+	":debug-on-exit",
+	":decode-translation-table",
+	":default-char",
+	":device",
+	":digest-algorithm-id",
+	":digest-algorithm-length",
+	":distant-foreground",
+	":documentation",
+	":dpi",
+	":elapsed",
+	":enable",
+	":encode-translation-table",
+	":eval",
+	":extend",
+	":family",
+	":file",
+	":file-handler",
+	":filter",
+	":filtered",
+	":finalize",
+	":flags",
+	":flowcontrol",
+	":font",
+	":font-entity",
+	":fontset",
+	":foreground",
+	":foundry",
+	":freed",
+	":height",
+	":help",
+	":host",
+	":hostname",
+	":ignore-defface",
+	":image",
+	":inherit",
+	":inverse-video",
+	":italic",
+	":key-sequence",
+	":keylist",
+	":keys",
+	":label",
+	":lang",
+	":line-width",
+	":live",
+	":local",
+	":log",
+	":loglevel",
+	":mac-algorithm-id",
+	":mac-algorithm-keysize",
+	":mac-algorithm-length",
+	":mac-algorithm-noncesize",
+	":map",
+	":mark",
+	":min-prime-bits",
+	":mnemonic",
+	":name",
+	":noquery",
+	":nowait",
+	":number",
+	":otf",
+	":overline",
+	":parity",
+	":pass",
+	":plist",
+	":pointer",
+	":port",
+	":position",
+	":post-read-conversion",
+	":pre-write-conversion",
+	":priority",
+	":process",
+	":propertize",
+	":purecopy",
+	":radio",
+	":rcvbuf",
+	":rcvtimeo",
+	":registry",
+	":rehash-size",
+	":rehash-threshold",
+	":relative-height",
+	":relative-width",
+	":remote",
+	":reverse-video",
+	":rtl",
+	":sblock-bytes",
+	":sblocks-freed",
+	":scalable",
+	":script",
+	":sentinel",
+	":server",
+	":service",
+	":size",
+	":slant",
+	":sndbuf",
+	":sndtimeo",
+	":spacing",
+	":speed",
+	":start",
+	":stderr",
+	":stipple",
+	":stop",
+	":stopbits",
+	":strike-through",
+	":string-bytes-moved",
+	":string-fragmentation",
+	":style",
+	":success",
+	":summary",
+	":sweep",
+	":tcpnodelay",
+	":test",
+	":tls-parameters",
+	":toggle",
+	":trigger",
+	":trustfiles",
+	":type",
+	":underline",
+	":use-external-socket",
+	":user-spec",
+	":verify-error",
+	":verify-flags",
+	":vert-only",
+	":visible",
+	":volume",
+	":weakness",
+	":weight",
+	":width",
+	":window",
+	"Discarded Samples",
+	"In-Reply-To",
+	"L2R",
+	"PRIMARY",
+	"R2L",
+	"above",
+	"above-handle",
+	"above-suspended",
+	"access-file",
+	"activate-input-method",
+	"activate-menubar-hook",
+	"1+",
+	"add-name-to-file",
+	"add-to-history",
+	"after-change-functions",
+	"after-delete-frame-functions",
+	"after-handle",
+	"after-insert-file-set-coding",
+	"after-pdump-load-hook",
+	"after-string",
+	"all",
+	"alpha",
+	"alpha-background",
+	"&optional",
+	"&rest",
+	"apply",
+	"aref",
+	"args",
+	"args-out-of-range",
+	"arith-error",
+	"arrayp",
+	"arrow",
+	"ascii",
+	"ascii-0",
+	"ascii-character",
+	"aset",
+	"assume",
+	"auto-composed",
+	"auto-fill-chars",
+	"auto-hscroll-mode",
+	"auto-lower",
+	"auto-raise",
+	"auto-save-coding",
+	"autoload",
+	"autosaved",
+	"background-color",
+	"background-mode",
+	"`",
+	"bar",
+	"before-change-functions",
+	"before-handle",
+	"before-string",
+	"beginning-of-buffer",
+	"below",
+	"below-handle",
+	"bidi-class",
+	"big",
+	"big5",
+	"bitmap-spec-p",
+	"black",
+	"bold",
+	"book",
+	"bool-vector",
+	"bool-vector-p",
+	"booleanp",
+	"border",
+	"border-color",
+	"border-width",
+	"both",
+	"both-horiz",
+	"bottom",
+	"bottom-divider",
+	"bottom-divider-width",
+	"bottom-edge",
+	"bottom-left-corner",
+	"bottom-right-corner",
+	"boundary",
+	"bounds",
+	"box",
+	"bracket-type",
+	"buffer",
+	"buffer-access-fontify-functions",
+	"buffer-file-coding-system",
+	"buffer-list",
+	"buffer-list-update-hook",
+	"buffer-name-history",
+	"buffer-or-string-p",
+	"buffer-position",
+	"buffer-predicate",
+	"buffer-read-only",
+	"buffer-stale-function",
+	"bufferp",
+	"buffers",
+	"buried-buffer-list",
+	"byte-code-function-p",
+	"byte-code-meter",
+	"c",
+	"call",
+	"call-process",
+	"call-process-region",
+	"callref",
+	"canonical-combining-class",
+	"car",
+	"car-less-than-car",
+	"case-fold-search",
+	"case-symbols-as-words",
+	"case-table",
+	"case-table-p",
+	"catcher",
+	"category",
+	"category-table",
+	"category-table-p",
+	"categoryp",
+	"categorysetp",
+	"ccl",
+	"ccl-program-idx",
+	"cclp",
+	"cdr",
+	"ceiling",
+	"center",
+	"change_frame_size",
+	"change-major-mode-hook",
+	"channel",
+	"channelp",
+	"char-code-property-table",
+	"char-from-name",
+	"char-or-string-p",
+	"char-script-table",
+	"char-table",
+	"char-table-extra-slots",
+	"char-table-p",
+	"characterp",
+	"charset",
+	"charsetp",
+	"child-frame-border",
+	"child-frame-border-width",
+	"choice",
+	"circle",
+	"circular-list",
+	"clone-indirect-buffer-hook",
+	"clone-of",
+	"close-tab",
+	"closed",
+	"closure",
+	"cmajflt",
+	"cminflt",
+	"code-conversion-map",
+	"code-conversion-map-id",
+	"codeset",
+	"coding",
+	"coding-system-define-form",
+	"coding-system-error",
+	"coding-system-history",
+	"coding-system-p",
+	"columns",
+	"comm",
+	",",
+	",@",
+	"command-debug-status",
+	"command-execute",
+	"command-modes",
+	"commandp",
+	"comment",
+	"comment-end-can-be-escaped",
+	"comp",
+	"comp-libgccjit-reproducer",
+	"comp-maybe-gc-or-quit",
+	"comp-mvar",
+	"comp-subr-trampoline-install",
+	"compiled-function",
+	"completion-ignore-case",
+	"composition",
+	"cond-jump",
+	"cond-jump-narg-leq",
+	"condition-case",
+	"condition-variable",
+	"condition-variable-p",
+	"config-changed-event",
+	"connect",
+	"cons",
+	"conses",
+	"consp",
+	"copy-directory",
+	"copy-file",
+	"cstime",
+	"ctime",
+	"current",
+	"current-input-method",
+	"current-line",
+	"current-load-list",
+	"current-minibuffer-command",
+	"cursor",
+	"cursor-color",
+	"cursor-in-echo-area",
+	"cursor-type",
+	"curve",
+	"custom-variable-history",
+	"custom-variable-p",
+	"cutime",
+	"cycle-sort-function",
+	"cyclic-function-indirection",
+	"cyclic-variable-indirection",
+	"d",
+	"d-default",
+	"d-ephemeral",
+	"d-impure",
+	"data",
+	"datagram",
+	"days",
+	"dbus-event",
+	"deactivate-mark",
+	"debug",
+	"debug-early",
+	"debugger",
+	"decomposed-characters",
+	"defalias-fset-function",
+	"default",
+	"default-directory",
+	"defun",
+	"defvaralias",
+	"delayed-warnings-hook",
+	"delete-before",
+	"delete-by-moving-to-trash",
+	"delete-directory",
+	"delete-file",
+	"delete-file-internal",
+	"delete-frame",
+	"delete-frame-functions",
+	"delete-terminal-functions",
+	"delete-window",
+	"dir-ok",
+	"direct-call",
+	"direct-callref",
+	"directory-file-name",
+	"directory-files",
+	"directory-files-and-attributes",
+	"disable-eval",
+	"disabled",
+	"display",
+	"display-buffer",
+	"display-fill-column-indicator",
+	"display-fill-column-indicator-character",
+	"display-fill-column-indicator-column",
+	"display-line-numbers",
+	"display-line-numbers-disable",
+	"display-line-numbers-offset",
+	"display-line-numbers-widen",
+	"display-line-numbers-width",
+	"display-monitors-changed-functions",
+	"display-table",
+	"display-type",
+	"do-after-load-evaluation",
+	"domain-error",
+	"dos",
+	"down",
+	"drag-internal-border",
+	"drag-n-drop",
+	"drag-source",
+	"drag-with-header-line",
+	"drag-with-mode-line",
+	"drag-with-tab-line",
+	"dragging",
+	"dropping",
+	"dump-emacs-portable--sort-predicate",
+	"dump-emacs-portable--sort-predicate-copied",
+	"dump-file-name",
+	"dumped-with-pdumper",
+	"echo-area-clear-hook",
+	"echo-keystrokes",
+	"egid",
+	"eight-bit",
+	"elt",
+	"emacs",
+	"emacs-mule",
+	"emoji",
+	"empty-box",
+	"enable-recursive-minibuffers",
+	"encode-time",
+	"encoded",
+	"end-of-buffer",
+	"end-of-file",
+	"end-scroll",
+	"end-session",
+	"entry",
+	"eq",
+	"eql",
+	"equal",
+	"error-conditions",
+	"error-message",
+	"escape-glyph",
+	"etime",
+	"euid",
+	"eval",
+	"eval-buffer-list",
+	"evaporate",
+	"even",
+	"event-kind",
+	"event-symbol-element-mask",
+	"event-symbol-elements",
+	"excessive-lisp-nesting",
+	"excessive-variable-binding",
+	"excl",
+	"exit",
+	"expand-abbrev",
+	"expand-file-name",
+	"explicit",
+	"explicit-name",
+	"external-border-size",
+	"external-debugging-output",
+	"extra-bold",
+	"extra-light",
+	"face",
+	"face-alias",
+	"face-no-inherit",
+	"face-remapping-alist",
+	"face-set-after-frame-default",
+	"failed",
+	"fboundp",
+	"features",
+	"field",
+	"file-accessible-directory-p",
+	"file-acl",
+	"file-already-exists",
+	"file-attributes",
+	"file-attributes-lessp",
+	"file-date-error",
+	"file-directory-p",
+	"file-error",
+	"file-executable-p",
+	"file-exists-p",
+	"file-locked-p",
+	"file-missing",
+	"file-modes",
+	"file-name-all-completions",
+	"file-name-as-directory",
+	"file-name-case-insensitive-p",
+	"file-name-completion",
+	"file-name-directory",
+	"file-name-handler-alist",
+	"file-name-history",
+	"file-name-nondirectory",
+	"file-newer-than-file-p",
+	"file-notify",
+	"file-notify-error",
+	"file-offset",
+	"file-readable-p",
+	"file-regular-p",
+	"file-selinux-context",
+	"file-symlink-p",
+	"file-system-info",
+	"file-writable-p",
+	"filenamep",
+	"fill-column-indicator",
+	"finalizer",
+	"find-file-literally-line-length",
+	"first-change-hook",
+	"fixnum",
+	"fixnump",
+	"flat-button",
+	"float",
+	"floatp",
+	"floats",
+	"floor",
+	"focus-in",
+	"focus-out",
+	"font",
+	"font-backend",
+	"font-driver-superseded-by",
+	"font-entity",
+	"font-extra-type",
+	"font-lock-face",
+	"font-object",
+	"font-spec",
+	"fontification-functions",
+	"fontified",
+	"foreground-color",
+	"format-annotate-function",
+	"format-decode",
+	"fraction",
+	"frame",
+	"frame-edges",
+	"frame-live-p",
+	"frame-monitor-attributes",
+	"frame-set-background-mode",
+	"frame-windows-min-size",
+	"framep",
+	"frames",
+	"fringe",
+	"from--tty-menu-p",
+	"front-sticky",
+	"fullboth",
+	"fullheight",
+	"fullscreen",
+	"fullwidth",
+	"funcall",
+	"funcall-interactively",
+	"function",
+	"function-documentation",
+	"function-history",
+	"function-key",
+	"functionp",
+	"fundamental-mode",
+	"future",
+	"futurep",
+	"gc-cons-percentage",
+	"gc-cons-threshold",
+	"gc-event-log-file",
+	"gccjit",
+	"geometry",
+	"get-buffer-window-list",
+	"get-emacs-mule-file-char",
+	"get-file-buffer",
+	"get-file-char",
+	"get-mru-window",
+	"get-scratch-buffer-create",
+	"global-mark-ring",
+	"global-mark-ring-max",
+	"glyphless-char",
+	"glyphless-char-display",
+	"gnutls-anon",
+	"gnutls-code",
+	"gnutls-e-again",
+	"gnutls-e-interrupted",
+	"gnutls-e-invalid-session",
+	"gnutls-e-not-ready-for-handshake",
+	"GNUTLS_PKCS_NULL_PASSWORD",
+	"GNUTLS_PKCS_PBES1_DES_MD5",
+	"GNUTLS_PKCS_PBES2_3DES",
+	"GNUTLS_PKCS_PBES2_AES_128",
+	"GNUTLS_PKCS_PBES2_AES_192",
+	"GNUTLS_PKCS_PBES2_AES_256",
+	"GNUTLS_PKCS_PBES2_DES",
+	"GNUTLS_PKCS_PBES2_GOST_CPA",
+	"GNUTLS_PKCS_PBES2_GOST_CPB",
+	"GNUTLS_PKCS_PBES2_GOST_CPC",
+	"GNUTLS_PKCS_PBES2_GOST_CPD",
+	"GNUTLS_PKCS_PBES2_GOST_TC26Z",
+	"GNUTLS_PKCS_PKCS12_3DES",
+	"GNUTLS_PKCS_PKCS12_ARCFOUR",
+	"GNUTLS_PKCS_PKCS12_RC2_40",
+	"GNUTLS_PKCS_PLAIN",
+	"gnutls-symmetric-cipher",
+	"gnutls-digest-algorithm",
+	"gnutls-mac-algorithm",
+	"gnutls-x509pki",
+	"grave",
+	"group",
+	"grow-only",
+	"gui_figure_window_size",
+	"gui-set-selection",
+	"haiku",
+	"hand",
+	"handle",
+	"handle-select-window",
+	"handle-shift-selection",
+	"handle-switch-frame",
+	"hash-table",
+	"hash-table-p",
+	"hash-table-test",
+	"hbar",
+	"header-line",
+	"header-line-format",
+	"heap",
+	"heavy",
+	"height",
+	"height-only",
+	"help--describe-map-tree",
+	"help-echo",
+	"help-echo-inhibit-substitution",
+	"help-form-show",
+	"help-key-binding",
+	"helper_save_restriction",
+	"helper_unbind_n",
+	"helper_unwind_protect",
+	"hex-code",
+	"hide",
+	"hollow",
+	"horizontal-handle",
+	"horizontal-scroll-bar",
+	"horizontal-scroll-bars",
+	"hw",
+	"icon",
+	"icon-left",
+	"icon-name",
+	"icon-top",
+	"icon-type",
+	"iconify-frame",
+	"iconify-top-level",
+	"identity",
+	"if",
+	"if-regular",
+	"ignore-self-insert",
+	"ignored",
+	"image",
+	"inc-args",
+	"inhibit-changing-match-data",
+	"inhibit-debugger",
+	"inhibit-double-buffering",
+	"inhibit-eval-during-redisplay",
+	"inhibit-file-name-operation",
+	"inhibit-free-realized-faces",
+	"inhibit-menubar-update",
+	"inhibit-modification-hooks",
+	"inhibit-point-motion-hooks",
+	"inhibit-quit",
+	"inhibit-read-only",
+	"inhibit-redisplay",
+	"inhibited-interaction",
+	"inner-edges",
+	"input-method-exit-on-first-char",
+	"input-method-use-echo-area",
+	"insert-behind-hooks",
+	"insert-file-contents",
+	"insert-in-front-hooks",
+	"inserted-chars",
+	"insufficient-source",
+	"intangible",
+	"integer",
+	"integer-or-marker-p",
+	"integerp",
+	"interactive",
+	"interactive-args",
+	"interactive-form",
+	"interactive-p",
+	"internal--syntax-propertize",
+	"internal-auto-fill",
+	"internal-border",
+	"internal-border-width",
+	"internal-default-interrupt-process",
+	"internal-default-process-filter",
+	"internal-default-process-sentinel",
+	"internal-default-signal-process",
+	"internal-echo-keystrokes-prefix",
+	"internal-when-entered-debugger",
+	"interrupt-process-functions",
+	"interrupted",
+	"intervals",
+	"invalid-function",
+	"invalid-read-syntax",
+	"invalid-regexp",
+	"invalid-source",
+	"invisible",
+	"ipv4",
+	"ipv6",
+	"iso10646-1",
+	"iso8859-1",
+	"iso-2022",
+	"iso-8859-1",
+	"italic",
+	"iv-auto",
+	"ja",
+	"jump",
+	"kbd-macro-termination-hook",
+	"keep-ratio",
+	"key",
+	"key-and-value",
+	"key-or-value",
+	"key-parse",
+	"key-valid-p",
+	"keymap",
+	"keymap-canonicalize",
+	"keymapp",
+	"kill-buffer--possibly-save",
+	"kill-buffer-hook",
+	"kill-buffer-query-functions",
+	"kill-emacs",
+	"kill-emacs-hook",
+	"kill-forward-chars",
+	"ko",
+	"lambda-fixup",
+	"language-change",
+	"last-arrow-position",
+	"last-arrow-string",
+	"last-nonmenu-event",
+	"last-selected-window",
+	"late",
+	"left",
+	"left-edge",
+	"left-fringe",
+	"left-margin",
+	"left-only",
+	"left-to-right",
+	"leftmost",
+	"let",
+	"let*",
+	"lexical-binding",
+	"light",
+	"line",
+	"line-height",
+	"line-number",
+	"line-number-current-line",
+	"line-number-major-tick",
+	"line-number-minor-tick",
+	"line-prefix",
+	"line-spacing",
+	"lisp-directory",
+	"list",
+	"list-or-vector-p",
+	"list-system-processes",
+	"listen",
+	"listp",
+	"little",
+	"load",
+	"load-file-name",
+	"load-force-doc-strings",
+	"load-in-progress",
+	"load-time",
+	"load-true-file-name",
+	"local",
+	"local-map",
+	"lock-file",
+	"long",
+	"lowercase",
+	"lread--unescaped-character-literals",
+	"m",
+	"mac",
+	"macro",
+	"macroexp--dynvars",
+	"majflt",
+	"make-cursor-line-fully-visible",
+	"make-directory",
+	"make-directory-internal",
+	"make-frame-visible",
+	"make-invisible",
+	"make-lock-file-name",
+	"make-process",
+	"make-symbolic-link",
+	"make-window-start-visible",
+	"makunbound",
+	"many",
+	"margin",
+	"mark-for-redisplay",
+	"mark-inactive",
+	"marker",
+	"markerp",
+	"maximized",
+	"md5",
+	"medium",
+	"memory-info",
+	"menu",
+	"menu-bar",
+	"menu-bar-external",
+	"menu-bar-lines",
+	"menu-bar-size",
+	"menu-bar-update-hook",
+	"menu-enable",
+	"menu-item",
+	"message",
+	"metadata",
+	"min-height",
+	"min-width",
+	"minflt",
+	"minibuffer",
+	"minibuffer-completing-file-name",
+	"minibuffer-completion-table",
+	"minibuffer-default",
+	"minibuffer-exit",
+	"minibuffer-exit-hook",
+	"minibuffer-follows-selected-frame",
+	"minibuffer-history",
+	"minibuffer-inactive-mode",
+	"minibuffer-mode",
+	"minibuffer-prompt",
+	"minibuffer-quit",
+	"minibuffer-setup-hook",
+	"-",
+	"mirroring",
+	"mm-size",
+	"mode-class",
+	"mode-line",
+	"mode-line-active",
+	"mode-line-default-help-echo",
+	"mode-line-format",
+	"mode-line-inactive",
+	"modeline",
+	"modification-hooks",
+	"modifier-cache",
+	"module-function",
+	"months",
+	"mouse",
+	"mouse-click",
+	"mouse-color",
+	"mouse-face",
+	"mouse-fixup-help-message",
+	"mouse-leave-buffer-hook",
+	"mouse-movement",
+	"mouse-wheel-frame",
+	"move-frame",
+	"move-toolbar",
+	"mutex",
+	"mutexp",
+	"name",
+	"native--compile-async",
+	"native-comp-compiler-options",
+	"native-comp-debug",
+	"native-comp-driver-options",
+	"native-comp-speed",
+	"native-comp-unit",
+	"native-comp-warning-on-missing-source",
+	"native-compiler-error",
+	"native-edges",
+	"native-ice",
+	"native-lisp-file-inconsistent",
+	"native-lisp-load-failed",
+	"native-lisp-wrong-reloc",
+	"natnump",
+	"negate",
+	"network",
+	"nice",
+	"no-accept-focus",
+	"no-catch",
+	"no-conversion",
+	"no-focus-on-map",
+	"no-other-frame",
+	"no-other-window",
+	"no-record",
+	"no-special-glyphs",
+	"nobreak-hyphen",
+	"nobreak-space",
+	"noelisp",
+	"non-ascii",
+	"non-key-event",
+	"none",
+	"normal",
+	"normal-top-level",
+	"ns",
+	"ns-appearance",
+	"ns-parse-geometry",
+	"ns-transparent-titlebar",
+	"nsm-verify-connection",
+	"nth",
+	"null",
+	"number-or-marker-p",
+	"numberp",
+	"numeric",
+	"obarray-cache",
+	"obarrayp",
+	"object",
+	"oblique",
+	"oclosure-interactive-form",
+	"odd",
+	"only",
+	"open",
+	"open-network-stream",
+	"opentype",
+	"operations",
+	"outer-border-width",
+	"outer-edges",
+	"outer-position",
+	"outer-size",
+	"outer-window-id",
+	"overflow-error",
+	"overlay",
+	"overlay-arrow-bitmap",
+	"overlay-arrow-string",
+	"overlayp",
+	"override-redirect",
+	"overriding-local-map",
+	"overriding-plist-environment",
+	"overriding-terminal-local-map",
+	"overwrite-mode",
+	"overwrite-mode-binary",
+	"p",
+	"paper",
+	"parent-frame",
+	"parent-id",
+	"pc",
+	"pcpu",
+	"permanent-local",
+	"permanent-local-hook",
+	"permission-denied",
+	"pgrp",
+	"pgtk",
+	"phi",
+	"pinch",
+	"pipe",
+	"pipe-process-p",
+	"play-sound-functions",
+	"plistp",
+	"+",
+	"pmem",
+	"point-entered",
+	"point-left",
+	"pointer",
+	"polling-period",
+	"poly",
+	"position",
+	"post-command-hook",
+	"post-gc-hook",
+	"post-select-region-hook",
+	"post-self-insert-hook",
+	"ppid",
+	"pre-command-hook",
+	"preedit-text",
+	"pressed-button",
+	"pri",
+	"print--unreadable-callback-buffer",
+	"print-escape-multibyte",
+	"print-escape-nonascii",
+	"print-unreadable-function",
+	"priority",
+	"process",
+	"process-attributes",
+	"processp",
+	"progn",
+	"propertize",
+	"protected-field",
+	"provide",
+	"pty",
+	"purecopy",
+	"push-exception",
+	"push-window-buffer-onto-prev",
+	"quit",
+	"quote",
+	"raise",
+	"range",
+	"range-error",
+	"ratio",
+	"raw-text",
+	"read",
+	"read-char",
+	"read-number",
+	"read-only",
+	"real",
+	"real-this-command",
+	"rear-nonsticky",
+	"record",
+	"record_unwind_current_buffer",
+	"record_unwind_protect_excursion",
+	"record-window-buffer",
+	"recordp",
+	"rect",
+	"recursion-error",
+	"redisplay-dont-pause",
+	"redisplay_internal (C function)",
+	"relative",
+	"released-button",
+	"remap",
+	"remote-file-error",
+	"rename-file",
+	"replace-buffer-in-windows",
+	"require",
+	"reset",
+	"return",
+	"right",
+	"right-divider",
+	"right-divider-width",
+	"right-edge",
+	"right-fringe",
+	"right-margin",
+	"right-to-left",
+	"rightmost",
+	"risky-local-variable",
+	"rss",
+	"run",
+	"run-hook-query-error-with-timeout",
+	"run-hook-with-args",
+	"safe",
+	"save-excursion",
+	"save-session",
+	"scale-factor",
+	"scan-error",
+	"scratch",
+	"screen-gamma",
+	"scroll-bar",
+	"scroll-bar-background",
+	"scroll-bar-foreground",
+	"scroll-bar-height",
+	"scroll-bar-movement",
+	"scroll-bar-width",
+	"scroll-command",
+	"scroll-down",
+	"scroll-up",
+	"search-failed",
+	"secure-hash-file",
+	"select-frame-set-input-focus",
+	"select-window",
+	"selection-request",
+	"self-insert-command",
+	"semi-bold",
+	"semi-light",
+	"seqpacket",
+	"sequencep",
+	"serial",
+	"sess",
+	"set",
+	"set-args-to-local",
+	"set-default",
+	"set-file-acl",
+	"set-file-modes",
+	"set-file-selinux-context",
+	"set-file-times",
+	"set_internal",
+	"set-par-to-local",
+	"set-rest-args-to-local",
+	"set-visited-file-modtime",
+	"set_window_configuration",
+	"setcar",
+	"setcdr",
+	"setimm",
+	"setq",
+	"setting-constant",
+	"sha1",
+	"sha224",
+	"sha256",
+	"sha384",
+	"sha512",
+	"shaded",
+	"shift-jis",
+	"signal",
+	"signal-process-functions",
+	"singularity-error",
+	"size",
+	"skip-taskbar",
+	"slice",
+	"sound",
+	"source",
+	"space",
+	"space-width",
+	"special-lowercase",
+	"special-titlecase",
+	"special-uppercase",
+	"sqlite",
+	"standard-input",
+	"standard-output",
+	"start",
+	"start-process",
+	"state",
+	"stderr",
+	"stdin",
+	"stdout",
+	"sticky",
+	"stime",
+	"stop",
+	"straight",
+	"string",
+	"string-bytes",
+	"string-lessp",
+	"stringp",
+	"strings",
+	"1-",
+	"sub-char-table",
+	"subfeatures",
+	"subr",
+	"subrp",
+	"substitute-command-keys",
+	"substitute-env-in-file-name",
+	"substitute-in-file-name",
+	"sw",
+	"switch-frame",
+	"symbol",
+	"symbolp",
+	"symbols",
+	"syntax-ppss",
+	"syntax-table",
+	"syntax-table-p",
+	"tab-bar",
+	"tab-bar-lines",
+	"tab-bar-size",
+	"tab-line",
+	"tab-line-format",
+	"target-idx",
+	"temp-buffer-setup-hook",
+	"temp-buffer-show-hook",
+	"terminal",
+	"terminal_frame",
+	"terminal-live-p",
+	"test",
+	"text",
+	"text-image-horiz",
+	"text-pixels",
+	"text-read-only",
+	"thcount",
+	"thin",
+	"thin-space",
+	"thread",
+	"thread-event",
+	"thread-pool",
+	"thread-pool-p",
+	"threadp",
+	"threshold",
+	"time",
+	"timer-event-handler",
+	"tip_frame",
+	"title",
+	"title-bar-size",
+	"titlecase",
+	"tool-bar",
+	"tool-bar-external",
+	"tool-bar-lines",
+	"tool-bar-position",
+	"tool-bar-size",
+	"tooltip",
+	"top",
+	"top-edge",
+	"top-left-corner",
+	"top-level",
+	"top-only",
+	"top-right-corner",
+	"touch-end",
+	"touchscreen-begin",
+	"touchscreen-end",
+	"touchscreen-update",
+	"tpgid",
+	"trailing-whitespace",
+	"translation-table",
+	"translation-table-id",
+	"trapping-constant",
+	"tree-sitter",
+	"tree-sitter-cursor",
+	"tree-sitter-node",
+	"ttname",
+	"tty",
+	"tty-color-alist",
+	"tty-color-by-index",
+	"tty-color-desc",
+	"tty-color-mode",
+	"tty-color-standard-values",
+	"tty-menu-exit",
+	"tty-menu-ignore",
+	"tty-menu-mouse-movement",
+	"tty-menu-navigation-map",
+	"tty-menu-next-item",
+	"tty-menu-next-menu",
+	"tty-menu-prev-item",
+	"tty-menu-prev-menu",
+	"tty-menu-select",
+	"tty-mode-reset-strings",
+	"tty-mode-set-strings",
+	"tty-type",
+	"ultra-bold",
+	"ultra-heavy",
+	"ultra-light",
+	"undecided",
+	"undecorated",
+	"undefined",
+	"underflow-error",
+	"underline-minimum-offset",
+	"undo-auto--add-boundary",
+	"undo-auto--last-boundary-cause",
+	"undo-auto--this-command-amalgamating",
+	"undo-auto--undoable-change",
+	"undo-auto--undoably-changed-buffers",
+	"undo-auto-amalgamate",
+	"unevalled",
+	"unhandled-file-name-directory",
+	"unicode",
+	"unicode-bmp",
+	"unix",
+	"unlet",
+	"unlock-file",
+	"unreachable",
+	"unspecified",
+	"unsplittable",
+	"up",
+	"uppercase",
+	"us-ascii",
+	"use-frame-synchronization",
+	"user",
+	"user-error",
+	"user-position",
+	"user-ptr",
+	"user-ptrp",
+	"user-search-failed",
+	"user-size",
+	"utf-16",
+	"utf-16le",
+	"utf-8",
+	"utf-8-emacs",
+	"utf-8-string-p",
+	"utf-8-unix",
+	"utime",
+	"value",
+	"variable-documentation",
+	"vector",
+	"vector-or-char-table-p",
+	"vector-slots",
+	"vectorp",
+	"vectors",
+	"verify-visited-file-modtime",
+	"vertical-border",
+	"vertical-line",
+	"vertical-scroll-bar",
+	"vertical-scroll-bars",
+	"visibility",
+	"visible",
+	"visual",
+	"void-function",
+	"void-variable",
+	"vsize",
+	"w32",
+	"wait-for-wm",
+	"wall",
+	"watchers",
+	"wave",
+	"weakness",
+	"when",
+	"wholenump",
+	"widget-type",
+	"width",
+	"width-only",
+	"window",
+	"window--pixel-to-total",
+	"window--resize-mini-frame",
+	"window--resize-root-window",
+	"window--resize-root-window-vertically",
+	"window-buffer-change-functions",
+	"window-configuration",
+	"window-configuration-change-hook",
+	"window-configuration-p",
+	"window-deletable-p",
+	"window-divider",
+	"window-divider-first-pixel",
+	"window-divider-last-pixel",
+	"window-edges",
+	"window-id",
+	"window-live-p",
+	"window-point-insertion-type",
+	"window-scroll-functions",
+	"window-selection-change-functions",
+	"window-size",
+	"window-size-change-functions",
+	"window-state-change-functions",
+	"window-state-change-hook",
+	"window-valid-p",
+	"windowp",
+	"workarea",
+	"wrap-prefix",
+	"write-region",
+	"write-region-annotate-functions",
+	"wrong-length-argument",
+	"wrong-number-of-arguments",
+	"wrong-register-subr-call",
+	"wrong-type-argument",
+	"x",
+	"x_create_frame_1",
+	"x_create_frame_2",
+	"x-frame-parameter",
+	"x-pre-popup-menu-hook",
+	"x-resource-name",
+	"x_set_menu_bar_lines",
+	"x_set_window_size_1",
+	"xg_frame_set_char_size",
+	"xterm--set-selection",
+	"xterm-select-active-regions",
+	"xwidget",
+	"xwidget-display-event",
+	"xwidget-event",
+	"xwidget-view",
+	"yes-or-no-p-history",
+	"z-group",
+	"zero-width",
+};
+#endif
+#define Qnil builtin_lisp_symbol (0)
+#if DEFINE_NON_NIL_Q_SYMBOL_MACROS
+# define Qt builtin_lisp_symbol (1)
+# define Qunbound builtin_lisp_symbol (2)
+# define Qerror builtin_lisp_symbol (3)
+# define Qlambda builtin_lisp_symbol (4)
+# define QAutomatic_GC builtin_lisp_symbol (5)
+# define QCadstyle builtin_lisp_symbol (6)
+# define QCadvertised_binding builtin_lisp_symbol (7)
+# define QCalign_to builtin_lisp_symbol (8)
+# define QCantialias builtin_lisp_symbol (9)
+# define QCascii_compatible_p builtin_lisp_symbol (10)
+# define QCavgwidth builtin_lisp_symbol (11)
+# define QCbackground builtin_lisp_symbol (12)
+# define QCbold builtin_lisp_symbol (13)
+# define QCbox builtin_lisp_symbol (14)
+# define QCbuffer builtin_lisp_symbol (15)
+# define QCbutton builtin_lisp_symbol (16)
+# define QCbytesize builtin_lisp_symbol (17)
+# define QCcategory builtin_lisp_symbol (18)
+# define QCcipher_aead_capable builtin_lisp_symbol (19)
+# define QCcipher_blocksize builtin_lisp_symbol (20)
+# define QCcipher_id builtin_lisp_symbol (21)
+# define QCcipher_ivsize builtin_lisp_symbol (22)
+# define QCcipher_keysize builtin_lisp_symbol (23)
+# define QCcipher_tagsize builtin_lisp_symbol (24)
+# define QCcoding builtin_lisp_symbol (25)
+# define QCcolor builtin_lisp_symbol (26)
+# define QCcombining_capability builtin_lisp_symbol (27)
+# define QCcommand builtin_lisp_symbol (28)
+# define QCcomplete_negotiation builtin_lisp_symbol (29)
+# define QCconnection_type builtin_lisp_symbol (30)
+# define QCcrlfiles builtin_lisp_symbol (31)
+# define QCdata builtin_lisp_symbol (32)
+# define QCdebug_on_exit builtin_lisp_symbol (33)
+# define QCdecode_translation_table builtin_lisp_symbol (34)
+# define QCdefault_char builtin_lisp_symbol (35)
+# define QCdevice builtin_lisp_symbol (36)
+# define QCdigest_algorithm_id builtin_lisp_symbol (37)
+# define QCdigest_algorithm_length builtin_lisp_symbol (38)
+# define QCdistant_foreground builtin_lisp_symbol (39)
+# define QCdocumentation builtin_lisp_symbol (40)
+# define QCdpi builtin_lisp_symbol (41)
+# define QCelapsed builtin_lisp_symbol (42)
+# define QCenable builtin_lisp_symbol (43)
+# define QCencode_translation_table builtin_lisp_symbol (44)
+# define QCeval builtin_lisp_symbol (45)
+# define QCextend builtin_lisp_symbol (46)
+# define QCfamily builtin_lisp_symbol (47)
+# define QCfile builtin_lisp_symbol (48)
+# define QCfile_handler builtin_lisp_symbol (49)
+# define QCfilter builtin_lisp_symbol (50)
+# define QCfiltered builtin_lisp_symbol (51)
+# define QCfinalize builtin_lisp_symbol (52)
+# define QCflags builtin_lisp_symbol (53)
+# define QCflowcontrol builtin_lisp_symbol (54)
+# define QCfont builtin_lisp_symbol (55)
+# define QCfont_entity builtin_lisp_symbol (56)
+# define QCfontset builtin_lisp_symbol (57)
+# define QCforeground builtin_lisp_symbol (58)
+# define QCfoundry builtin_lisp_symbol (59)
+# define QCfreed builtin_lisp_symbol (60)
+# define QCheight builtin_lisp_symbol (61)
+# define QChelp builtin_lisp_symbol (62)
+# define QChost builtin_lisp_symbol (63)
+# define QChostname builtin_lisp_symbol (64)
+# define QCignore_defface builtin_lisp_symbol (65)
+# define QCimage builtin_lisp_symbol (66)
+# define QCinherit builtin_lisp_symbol (67)
+# define QCinverse_video builtin_lisp_symbol (68)
+# define QCitalic builtin_lisp_symbol (69)
+# define QCkey_sequence builtin_lisp_symbol (70)
+# define QCkeylist builtin_lisp_symbol (71)
+# define QCkeys builtin_lisp_symbol (72)
+# define QClabel builtin_lisp_symbol (73)
+# define QClang builtin_lisp_symbol (74)
+# define QCline_width builtin_lisp_symbol (75)
+# define QClive builtin_lisp_symbol (76)
+# define QClocal builtin_lisp_symbol (77)
+# define QClog builtin_lisp_symbol (78)
+# define QCloglevel builtin_lisp_symbol (79)
+# define QCmac_algorithm_id builtin_lisp_symbol (80)
+# define QCmac_algorithm_keysize builtin_lisp_symbol (81)
+# define QCmac_algorithm_length builtin_lisp_symbol (82)
+# define QCmac_algorithm_noncesize builtin_lisp_symbol (83)
+# define QCmap builtin_lisp_symbol (84)
+# define QCmark builtin_lisp_symbol (85)
+# define QCmin_prime_bits builtin_lisp_symbol (86)
+# define QCmnemonic builtin_lisp_symbol (87)
+# define QCname builtin_lisp_symbol (88)
+# define QCnoquery builtin_lisp_symbol (89)
+# define QCnowait builtin_lisp_symbol (90)
+# define QCnumber builtin_lisp_symbol (91)
+# define QCotf builtin_lisp_symbol (92)
+# define QCoverline builtin_lisp_symbol (93)
+# define QCparity builtin_lisp_symbol (94)
+# define QCpass builtin_lisp_symbol (95)
+# define QCplist builtin_lisp_symbol (96)
+# define QCpointer builtin_lisp_symbol (97)
+# define QCport builtin_lisp_symbol (98)
+# define QCposition builtin_lisp_symbol (99)
+# define QCpost_read_conversion builtin_lisp_symbol (100)
+# define QCpre_write_conversion builtin_lisp_symbol (101)
+# define QCpriority builtin_lisp_symbol (102)
+# define QCprocess builtin_lisp_symbol (103)
+# define QCpropertize builtin_lisp_symbol (104)
+# define QCpurecopy builtin_lisp_symbol (105)
+# define QCradio builtin_lisp_symbol (106)
+# define QCrcvbuf builtin_lisp_symbol (107)
+# define QCrcvtimeo builtin_lisp_symbol (108)
+# define QCregistry builtin_lisp_symbol (109)
+# define QCrehash_size builtin_lisp_symbol (110)
+# define QCrehash_threshold builtin_lisp_symbol (111)
+# define QCrelative_height builtin_lisp_symbol (112)
+# define QCrelative_width builtin_lisp_symbol (113)
+# define QCremote builtin_lisp_symbol (114)
+# define QCreverse_video builtin_lisp_symbol (115)
+# define QCrtl builtin_lisp_symbol (116)
+# define QCsblock_bytes builtin_lisp_symbol (117)
+# define QCsblocks_freed builtin_lisp_symbol (118)
+# define QCscalable builtin_lisp_symbol (119)
+# define QCscript builtin_lisp_symbol (120)
+# define QCsentinel builtin_lisp_symbol (121)
+# define QCserver builtin_lisp_symbol (122)
+# define QCservice builtin_lisp_symbol (123)
+# define QCsize builtin_lisp_symbol (124)
+# define QCslant builtin_lisp_symbol (125)
+# define QCsndbuf builtin_lisp_symbol (126)
+# define QCsndtimeo builtin_lisp_symbol (127)
+# define QCspacing builtin_lisp_symbol (128)
+# define QCspeed builtin_lisp_symbol (129)
+# define QCstart builtin_lisp_symbol (130)
+# define QCstderr builtin_lisp_symbol (131)
+# define QCstipple builtin_lisp_symbol (132)
+# define QCstop builtin_lisp_symbol (133)
+# define QCstopbits builtin_lisp_symbol (134)
+# define QCstrike_through builtin_lisp_symbol (135)
+# define QCstring_bytes_moved builtin_lisp_symbol (136)
+# define QCstring_fragmentation builtin_lisp_symbol (137)
+# define QCstyle builtin_lisp_symbol (138)
+# define QCsuccess builtin_lisp_symbol (139)
+# define QCsummary builtin_lisp_symbol (140)
+# define QCsweep builtin_lisp_symbol (141)
+# define QCtcpnodelay builtin_lisp_symbol (142)
+# define QCtest builtin_lisp_symbol (143)
+# define QCtls_parameters builtin_lisp_symbol (144)
+# define QCtoggle builtin_lisp_symbol (145)
+# define QCtrigger builtin_lisp_symbol (146)
+# define QCtrustfiles builtin_lisp_symbol (147)
+# define QCtype builtin_lisp_symbol (148)
+# define QCunderline builtin_lisp_symbol (149)
+# define QCuse_external_socket builtin_lisp_symbol (150)
+# define QCuser_spec builtin_lisp_symbol (151)
+# define QCverify_error builtin_lisp_symbol (152)
+# define QCverify_flags builtin_lisp_symbol (153)
+# define QCvert_only builtin_lisp_symbol (154)
+# define QCvisible builtin_lisp_symbol (155)
+# define QCvolume builtin_lisp_symbol (156)
+# define QCweakness builtin_lisp_symbol (157)
+# define QCweight builtin_lisp_symbol (158)
+# define QCwidth builtin_lisp_symbol (159)
+# define QCwindow builtin_lisp_symbol (160)
+# define QDiscarded_Samples builtin_lisp_symbol (161)
+# define QIn_Reply_To builtin_lisp_symbol (162)
+# define QL2R builtin_lisp_symbol (163)
+# define QPRIMARY builtin_lisp_symbol (164)
+# define QR2L builtin_lisp_symbol (165)
+# define Qabove builtin_lisp_symbol (166)
+# define Qabove_handle builtin_lisp_symbol (167)
+# define Qabove_suspended builtin_lisp_symbol (168)
+# define Qaccess_file builtin_lisp_symbol (169)
+# define Qactivate_input_method builtin_lisp_symbol (170)
+# define Qactivate_menubar_hook builtin_lisp_symbol (171)
+# define Qadd1 builtin_lisp_symbol (172)
+# define Qadd_name_to_file builtin_lisp_symbol (173)
+# define Qadd_to_history builtin_lisp_symbol (174)
+# define Qafter_change_functions builtin_lisp_symbol (175)
+# define Qafter_delete_frame_functions builtin_lisp_symbol (176)
+# define Qafter_handle builtin_lisp_symbol (177)
+# define Qafter_insert_file_set_coding builtin_lisp_symbol (178)
+# define Qafter_pdump_load_hook builtin_lisp_symbol (179)
+# define Qafter_string builtin_lisp_symbol (180)
+# define Qall builtin_lisp_symbol (181)
+# define Qalpha builtin_lisp_symbol (182)
+# define Qalpha_background builtin_lisp_symbol (183)
+# define Qand_optional builtin_lisp_symbol (184)
+# define Qand_rest builtin_lisp_symbol (185)
+# define Qapply builtin_lisp_symbol (186)
+# define Qaref builtin_lisp_symbol (187)
+# define Qargs builtin_lisp_symbol (188)
+# define Qargs_out_of_range builtin_lisp_symbol (189)
+# define Qarith_error builtin_lisp_symbol (190)
+# define Qarrayp builtin_lisp_symbol (191)
+# define Qarrow builtin_lisp_symbol (192)
+# define Qascii builtin_lisp_symbol (193)
+# define Qascii_0 builtin_lisp_symbol (194)
+# define Qascii_character builtin_lisp_symbol (195)
+# define Qaset builtin_lisp_symbol (196)
+# define Qassume builtin_lisp_symbol (197)
+# define Qauto_composed builtin_lisp_symbol (198)
+# define Qauto_fill_chars builtin_lisp_symbol (199)
+# define Qauto_hscroll_mode builtin_lisp_symbol (200)
+# define Qauto_lower builtin_lisp_symbol (201)
+# define Qauto_raise builtin_lisp_symbol (202)
+# define Qauto_save_coding builtin_lisp_symbol (203)
+# define Qautoload builtin_lisp_symbol (204)
+# define Qautosaved builtin_lisp_symbol (205)
+# define Qbackground_color builtin_lisp_symbol (206)
+# define Qbackground_mode builtin_lisp_symbol (207)
+# define Qbackquote builtin_lisp_symbol (208)
+# define Qbar builtin_lisp_symbol (209)
+# define Qbefore_change_functions builtin_lisp_symbol (210)
+# define Qbefore_handle builtin_lisp_symbol (211)
+# define Qbefore_string builtin_lisp_symbol (212)
+# define Qbeginning_of_buffer builtin_lisp_symbol (213)
+# define Qbelow builtin_lisp_symbol (214)
+# define Qbelow_handle builtin_lisp_symbol (215)
+# define Qbidi_class builtin_lisp_symbol (216)
+# define Qbig builtin_lisp_symbol (217)
+# define Qbig5 builtin_lisp_symbol (218)
+# define Qbitmap_spec_p builtin_lisp_symbol (219)
+# define Qblack builtin_lisp_symbol (220)
+# define Qbold builtin_lisp_symbol (221)
+# define Qbook builtin_lisp_symbol (222)
+# define Qbool_vector builtin_lisp_symbol (223)
+# define Qbool_vector_p builtin_lisp_symbol (224)
+# define Qbooleanp builtin_lisp_symbol (225)
+# define Qborder builtin_lisp_symbol (226)
+# define Qborder_color builtin_lisp_symbol (227)
+# define Qborder_width builtin_lisp_symbol (228)
+# define Qboth builtin_lisp_symbol (229)
+# define Qboth_horiz builtin_lisp_symbol (230)
+# define Qbottom builtin_lisp_symbol (231)
+# define Qbottom_divider builtin_lisp_symbol (232)
+# define Qbottom_divider_width builtin_lisp_symbol (233)
+# define Qbottom_edge builtin_lisp_symbol (234)
+# define Qbottom_left_corner builtin_lisp_symbol (235)
+# define Qbottom_right_corner builtin_lisp_symbol (236)
+# define Qboundary builtin_lisp_symbol (237)
+# define Qbounds builtin_lisp_symbol (238)
+# define Qbox builtin_lisp_symbol (239)
+# define Qbracket_type builtin_lisp_symbol (240)
+# define Qbuffer builtin_lisp_symbol (241)
+# define Qbuffer_access_fontify_functions builtin_lisp_symbol (242)
+# define Qbuffer_file_coding_system builtin_lisp_symbol (243)
+# define Qbuffer_list builtin_lisp_symbol (244)
+# define Qbuffer_list_update_hook builtin_lisp_symbol (245)
+# define Qbuffer_name_history builtin_lisp_symbol (246)
+# define Qbuffer_or_string_p builtin_lisp_symbol (247)
+# define Qbuffer_position builtin_lisp_symbol (248)
+# define Qbuffer_predicate builtin_lisp_symbol (249)
+# define Qbuffer_read_only builtin_lisp_symbol (250)
+# define Qbuffer_stale_function builtin_lisp_symbol (251)
+# define Qbufferp builtin_lisp_symbol (252)
+# define Qbuffers builtin_lisp_symbol (253)
+# define Qburied_buffer_list builtin_lisp_symbol (254)
+# define Qbyte_code_function_p builtin_lisp_symbol (255)
+# define Qbyte_code_meter builtin_lisp_symbol (256)
+# define Qc builtin_lisp_symbol (257)
+# define Qcall builtin_lisp_symbol (258)
+# define Qcall_process builtin_lisp_symbol (259)
+# define Qcall_process_region builtin_lisp_symbol (260)
+# define Qcallref builtin_lisp_symbol (261)
+# define Qcanonical_combining_class builtin_lisp_symbol (262)
+# define Qcar builtin_lisp_symbol (263)
+# define Qcar_less_than_car builtin_lisp_symbol (264)
+# define Qcase_fold_search builtin_lisp_symbol (265)
+# define Qcase_symbols_as_words builtin_lisp_symbol (266)
+# define Qcase_table builtin_lisp_symbol (267)
+# define Qcase_table_p builtin_lisp_symbol (268)
+# define Qcatcher builtin_lisp_symbol (269)
+# define Qcategory builtin_lisp_symbol (270)
+# define Qcategory_table builtin_lisp_symbol (271)
+# define Qcategory_table_p builtin_lisp_symbol (272)
+# define Qcategoryp builtin_lisp_symbol (273)
+# define Qcategorysetp builtin_lisp_symbol (274)
+# define Qccl builtin_lisp_symbol (275)
+# define Qccl_program_idx builtin_lisp_symbol (276)
+# define Qcclp builtin_lisp_symbol (277)
+# define Qcdr builtin_lisp_symbol (278)
+# define Qceiling builtin_lisp_symbol (279)
+# define Qcenter builtin_lisp_symbol (280)
+# define Qchange_frame_size builtin_lisp_symbol (281)
+# define Qchange_major_mode_hook builtin_lisp_symbol (282)
+# define Qchannel builtin_lisp_symbol (283)
+# define Qchannelp builtin_lisp_symbol (284)
+# define Qchar_code_property_table builtin_lisp_symbol (285)
+# define Qchar_from_name builtin_lisp_symbol (286)
+# define Qchar_or_string_p builtin_lisp_symbol (287)
+# define Qchar_script_table builtin_lisp_symbol (288)
+# define Qchar_table builtin_lisp_symbol (289)
+# define Qchar_table_extra_slots builtin_lisp_symbol (290)
+# define Qchar_table_p builtin_lisp_symbol (291)
+# define Qcharacterp builtin_lisp_symbol (292)
+# define Qcharset builtin_lisp_symbol (293)
+# define Qcharsetp builtin_lisp_symbol (294)
+# define Qchild_frame_border builtin_lisp_symbol (295)
+# define Qchild_frame_border_width builtin_lisp_symbol (296)
+# define Qchoice builtin_lisp_symbol (297)
+# define Qcircle builtin_lisp_symbol (298)
+# define Qcircular_list builtin_lisp_symbol (299)
+# define Qclone_indirect_buffer_hook builtin_lisp_symbol (300)
+# define Qclone_of builtin_lisp_symbol (301)
+# define Qclose_tab builtin_lisp_symbol (302)
+# define Qclosed builtin_lisp_symbol (303)
+# define Qclosure builtin_lisp_symbol (304)
+# define Qcmajflt builtin_lisp_symbol (305)
+# define Qcminflt builtin_lisp_symbol (306)
+# define Qcode_conversion_map builtin_lisp_symbol (307)
+# define Qcode_conversion_map_id builtin_lisp_symbol (308)
+# define Qcodeset builtin_lisp_symbol (309)
+# define Qcoding builtin_lisp_symbol (310)
+# define Qcoding_system_define_form builtin_lisp_symbol (311)
+# define Qcoding_system_error builtin_lisp_symbol (312)
+# define Qcoding_system_history builtin_lisp_symbol (313)
+# define Qcoding_system_p builtin_lisp_symbol (314)
+# define Qcolumns builtin_lisp_symbol (315)
+# define Qcomm builtin_lisp_symbol (316)
+# define Qcomma builtin_lisp_symbol (317)
+# define Qcomma_at builtin_lisp_symbol (318)
+# define Qcommand_debug_status builtin_lisp_symbol (319)
+# define Qcommand_execute builtin_lisp_symbol (320)
+# define Qcommand_modes builtin_lisp_symbol (321)
+# define Qcommandp builtin_lisp_symbol (322)
+# define Qcomment builtin_lisp_symbol (323)
+# define Qcomment_end_can_be_escaped builtin_lisp_symbol (324)
+# define Qcomp builtin_lisp_symbol (325)
+# define Qcomp_libgccjit_reproducer builtin_lisp_symbol (326)
+# define Qcomp_maybe_gc_or_quit builtin_lisp_symbol (327)
+# define Qcomp_mvar builtin_lisp_symbol (328)
+# define Qcomp_subr_trampoline_install builtin_lisp_symbol (329)
+# define Qcompiled_function builtin_lisp_symbol (330)
+# define Qcompletion_ignore_case builtin_lisp_symbol (331)
+# define Qcomposition builtin_lisp_symbol (332)
+# define Qcond_jump builtin_lisp_symbol (333)
+# define Qcond_jump_narg_leq builtin_lisp_symbol (334)
+# define Qcondition_case builtin_lisp_symbol (335)
+# define Qcondition_variable builtin_lisp_symbol (336)
+# define Qcondition_variable_p builtin_lisp_symbol (337)
+# define Qconfig_changed_event builtin_lisp_symbol (338)
+# define Qconnect builtin_lisp_symbol (339)
+# define Qcons builtin_lisp_symbol (340)
+# define Qconses builtin_lisp_symbol (341)
+# define Qconsp builtin_lisp_symbol (342)
+# define Qcopy_directory builtin_lisp_symbol (343)
+# define Qcopy_file builtin_lisp_symbol (344)
+# define Qcstime builtin_lisp_symbol (345)
+# define Qctime builtin_lisp_symbol (346)
+# define Qcurrent builtin_lisp_symbol (347)
+# define Qcurrent_input_method builtin_lisp_symbol (348)
+# define Qcurrent_line builtin_lisp_symbol (349)
+# define Qcurrent_load_list builtin_lisp_symbol (350)
+# define Qcurrent_minibuffer_command builtin_lisp_symbol (351)
+# define Qcursor builtin_lisp_symbol (352)
+# define Qcursor_color builtin_lisp_symbol (353)
+# define Qcursor_in_echo_area builtin_lisp_symbol (354)
+# define Qcursor_type builtin_lisp_symbol (355)
+# define Qcurve builtin_lisp_symbol (356)
+# define Qcustom_variable_history builtin_lisp_symbol (357)
+# define Qcustom_variable_p builtin_lisp_symbol (358)
+# define Qcutime builtin_lisp_symbol (359)
+# define Qcycle_sort_function builtin_lisp_symbol (360)
+# define Qcyclic_function_indirection builtin_lisp_symbol (361)
+# define Qcyclic_variable_indirection builtin_lisp_symbol (362)
+# define Qd builtin_lisp_symbol (363)
+# define Qd_default builtin_lisp_symbol (364)
+# define Qd_ephemeral builtin_lisp_symbol (365)
+# define Qd_impure builtin_lisp_symbol (366)
+# define Qdata builtin_lisp_symbol (367)
+# define Qdatagram builtin_lisp_symbol (368)
+# define Qdays builtin_lisp_symbol (369)
+# define Qdbus_event builtin_lisp_symbol (370)
+# define Qdeactivate_mark builtin_lisp_symbol (371)
+# define Qdebug builtin_lisp_symbol (372)
+# define Qdebug_early builtin_lisp_symbol (373)
+# define Qdebugger builtin_lisp_symbol (374)
+# define Qdecomposed_characters builtin_lisp_symbol (375)
+# define Qdefalias_fset_function builtin_lisp_symbol (376)
+# define Qdefault builtin_lisp_symbol (377)
+# define Qdefault_directory builtin_lisp_symbol (378)
+# define Qdefun builtin_lisp_symbol (379)
+# define Qdefvaralias builtin_lisp_symbol (380)
+# define Qdelayed_warnings_hook builtin_lisp_symbol (381)
+# define Qdelete_before builtin_lisp_symbol (382)
+# define Qdelete_by_moving_to_trash builtin_lisp_symbol (383)
+# define Qdelete_directory builtin_lisp_symbol (384)
+# define Qdelete_file builtin_lisp_symbol (385)
+# define Qdelete_file_internal builtin_lisp_symbol (386)
+# define Qdelete_frame builtin_lisp_symbol (387)
+# define Qdelete_frame_functions builtin_lisp_symbol (388)
+# define Qdelete_terminal_functions builtin_lisp_symbol (389)
+# define Qdelete_window builtin_lisp_symbol (390)
+# define Qdir_ok builtin_lisp_symbol (391)
+# define Qdirect_call builtin_lisp_symbol (392)
+# define Qdirect_callref builtin_lisp_symbol (393)
+# define Qdirectory_file_name builtin_lisp_symbol (394)
+# define Qdirectory_files builtin_lisp_symbol (395)
+# define Qdirectory_files_and_attributes builtin_lisp_symbol (396)
+# define Qdisable_eval builtin_lisp_symbol (397)
+# define Qdisabled builtin_lisp_symbol (398)
+# define Qdisplay builtin_lisp_symbol (399)
+# define Qdisplay_buffer builtin_lisp_symbol (400)
+# define Qdisplay_fill_column_indicator builtin_lisp_symbol (401)
+# define Qdisplay_fill_column_indicator_character builtin_lisp_symbol (402)
+# define Qdisplay_fill_column_indicator_column builtin_lisp_symbol (403)
+# define Qdisplay_line_numbers builtin_lisp_symbol (404)
+# define Qdisplay_line_numbers_disable builtin_lisp_symbol (405)
+# define Qdisplay_line_numbers_offset builtin_lisp_symbol (406)
+# define Qdisplay_line_numbers_widen builtin_lisp_symbol (407)
+# define Qdisplay_line_numbers_width builtin_lisp_symbol (408)
+# define Qdisplay_monitors_changed_functions builtin_lisp_symbol (409)
+# define Qdisplay_table builtin_lisp_symbol (410)
+# define Qdisplay_type builtin_lisp_symbol (411)
+# define Qdo_after_load_evaluation builtin_lisp_symbol (412)
+# define Qdomain_error builtin_lisp_symbol (413)
+# define Qdos builtin_lisp_symbol (414)
+# define Qdown builtin_lisp_symbol (415)
+# define Qdrag_internal_border builtin_lisp_symbol (416)
+# define Qdrag_n_drop builtin_lisp_symbol (417)
+# define Qdrag_source builtin_lisp_symbol (418)
+# define Qdrag_with_header_line builtin_lisp_symbol (419)
+# define Qdrag_with_mode_line builtin_lisp_symbol (420)
+# define Qdrag_with_tab_line builtin_lisp_symbol (421)
+# define Qdragging builtin_lisp_symbol (422)
+# define Qdropping builtin_lisp_symbol (423)
+# define Qdump_emacs_portable__sort_predicate builtin_lisp_symbol (424)
+# define Qdump_emacs_portable__sort_predicate_copied builtin_lisp_symbol (425)
+# define Qdump_file_name builtin_lisp_symbol (426)
+# define Qdumped_with_pdumper builtin_lisp_symbol (427)
+# define Qecho_area_clear_hook builtin_lisp_symbol (428)
+# define Qecho_keystrokes builtin_lisp_symbol (429)
+# define Qegid builtin_lisp_symbol (430)
+# define Qeight_bit builtin_lisp_symbol (431)
+# define Qelt builtin_lisp_symbol (432)
+# define Qemacs builtin_lisp_symbol (433)
+# define Qemacs_mule builtin_lisp_symbol (434)
+# define Qemoji builtin_lisp_symbol (435)
+# define Qempty_box builtin_lisp_symbol (436)
+# define Qenable_recursive_minibuffers builtin_lisp_symbol (437)
+# define Qencode_time builtin_lisp_symbol (438)
+# define Qencoded builtin_lisp_symbol (439)
+# define Qend_of_buffer builtin_lisp_symbol (440)
+# define Qend_of_file builtin_lisp_symbol (441)
+# define Qend_scroll builtin_lisp_symbol (442)
+# define Qend_session builtin_lisp_symbol (443)
+# define Qentry builtin_lisp_symbol (444)
+# define Qeq builtin_lisp_symbol (445)
+# define Qeql builtin_lisp_symbol (446)
+# define Qequal builtin_lisp_symbol (447)
+# define Qerror_conditions builtin_lisp_symbol (448)
+# define Qerror_message builtin_lisp_symbol (449)
+# define Qescape_glyph builtin_lisp_symbol (450)
+# define Qetime builtin_lisp_symbol (451)
+# define Qeuid builtin_lisp_symbol (452)
+# define Qeval builtin_lisp_symbol (453)
+# define Qeval_buffer_list builtin_lisp_symbol (454)
+# define Qevaporate builtin_lisp_symbol (455)
+# define Qeven builtin_lisp_symbol (456)
+# define Qevent_kind builtin_lisp_symbol (457)
+# define Qevent_symbol_element_mask builtin_lisp_symbol (458)
+# define Qevent_symbol_elements builtin_lisp_symbol (459)
+# define Qexcessive_lisp_nesting builtin_lisp_symbol (460)
+# define Qexcessive_variable_binding builtin_lisp_symbol (461)
+# define Qexcl builtin_lisp_symbol (462)
+# define Qexit builtin_lisp_symbol (463)
+# define Qexpand_abbrev builtin_lisp_symbol (464)
+# define Qexpand_file_name builtin_lisp_symbol (465)
+# define Qexplicit builtin_lisp_symbol (466)
+# define Qexplicit_name builtin_lisp_symbol (467)
+# define Qexternal_border_size builtin_lisp_symbol (468)
+# define Qexternal_debugging_output builtin_lisp_symbol (469)
+# define Qextra_bold builtin_lisp_symbol (470)
+# define Qextra_light builtin_lisp_symbol (471)
+# define Qface builtin_lisp_symbol (472)
+# define Qface_alias builtin_lisp_symbol (473)
+# define Qface_no_inherit builtin_lisp_symbol (474)
+# define Qface_remapping_alist builtin_lisp_symbol (475)
+# define Qface_set_after_frame_default builtin_lisp_symbol (476)
+# define Qfailed builtin_lisp_symbol (477)
+# define Qfboundp builtin_lisp_symbol (478)
+# define Qfeatures builtin_lisp_symbol (479)
+# define Qfield builtin_lisp_symbol (480)
+# define Qfile_accessible_directory_p builtin_lisp_symbol (481)
+# define Qfile_acl builtin_lisp_symbol (482)
+# define Qfile_already_exists builtin_lisp_symbol (483)
+# define Qfile_attributes builtin_lisp_symbol (484)
+# define Qfile_attributes_lessp builtin_lisp_symbol (485)
+# define Qfile_date_error builtin_lisp_symbol (486)
+# define Qfile_directory_p builtin_lisp_symbol (487)
+# define Qfile_error builtin_lisp_symbol (488)
+# define Qfile_executable_p builtin_lisp_symbol (489)
+# define Qfile_exists_p builtin_lisp_symbol (490)
+# define Qfile_locked_p builtin_lisp_symbol (491)
+# define Qfile_missing builtin_lisp_symbol (492)
+# define Qfile_modes builtin_lisp_symbol (493)
+# define Qfile_name_all_completions builtin_lisp_symbol (494)
+# define Qfile_name_as_directory builtin_lisp_symbol (495)
+# define Qfile_name_case_insensitive_p builtin_lisp_symbol (496)
+# define Qfile_name_completion builtin_lisp_symbol (497)
+# define Qfile_name_directory builtin_lisp_symbol (498)
+# define Qfile_name_handler_alist builtin_lisp_symbol (499)
+# define Qfile_name_history builtin_lisp_symbol (500)
+# define Qfile_name_nondirectory builtin_lisp_symbol (501)
+# define Qfile_newer_than_file_p builtin_lisp_symbol (502)
+# define Qfile_notify builtin_lisp_symbol (503)
+# define Qfile_notify_error builtin_lisp_symbol (504)
+# define Qfile_offset builtin_lisp_symbol (505)
+# define Qfile_readable_p builtin_lisp_symbol (506)
+# define Qfile_regular_p builtin_lisp_symbol (507)
+# define Qfile_selinux_context builtin_lisp_symbol (508)
+# define Qfile_symlink_p builtin_lisp_symbol (509)
+# define Qfile_system_info builtin_lisp_symbol (510)
+# define Qfile_writable_p builtin_lisp_symbol (511)
+# define Qfilenamep builtin_lisp_symbol (512)
+# define Qfill_column_indicator builtin_lisp_symbol (513)
+# define Qfinalizer builtin_lisp_symbol (514)
+# define Qfind_file_literally_line_length builtin_lisp_symbol (515)
+# define Qfirst_change_hook builtin_lisp_symbol (516)
+# define Qfixnum builtin_lisp_symbol (517)
+# define Qfixnump builtin_lisp_symbol (518)
+# define Qflat_button builtin_lisp_symbol (519)
+# define Qfloat builtin_lisp_symbol (520)
+# define Qfloatp builtin_lisp_symbol (521)
+# define Qfloats builtin_lisp_symbol (522)
+# define Qfloor builtin_lisp_symbol (523)
+# define Qfocus_in builtin_lisp_symbol (524)
+# define Qfocus_out builtin_lisp_symbol (525)
+# define Qfont builtin_lisp_symbol (526)
+# define Qfont_backend builtin_lisp_symbol (527)
+# define Qfont_driver_superseded_by builtin_lisp_symbol (528)
+# define Qfont_entity builtin_lisp_symbol (529)
+# define Qfont_extra_type builtin_lisp_symbol (530)
+# define Qfont_lock_face builtin_lisp_symbol (531)
+# define Qfont_object builtin_lisp_symbol (532)
+# define Qfont_spec builtin_lisp_symbol (533)
+# define Qfontification_functions builtin_lisp_symbol (534)
+# define Qfontified builtin_lisp_symbol (535)
+# define Qforeground_color builtin_lisp_symbol (536)
+# define Qformat_annotate_function builtin_lisp_symbol (537)
+# define Qformat_decode builtin_lisp_symbol (538)
+# define Qfraction builtin_lisp_symbol (539)
+# define Qframe builtin_lisp_symbol (540)
+# define Qframe_edges builtin_lisp_symbol (541)
+# define Qframe_live_p builtin_lisp_symbol (542)
+# define Qframe_monitor_attributes builtin_lisp_symbol (543)
+# define Qframe_set_background_mode builtin_lisp_symbol (544)
+# define Qframe_windows_min_size builtin_lisp_symbol (545)
+# define Qframep builtin_lisp_symbol (546)
+# define Qframes builtin_lisp_symbol (547)
+# define Qfringe builtin_lisp_symbol (548)
+# define Qfrom__tty_menu_p builtin_lisp_symbol (549)
+# define Qfront_sticky builtin_lisp_symbol (550)
+# define Qfullboth builtin_lisp_symbol (551)
+# define Qfullheight builtin_lisp_symbol (552)
+# define Qfullscreen builtin_lisp_symbol (553)
+# define Qfullwidth builtin_lisp_symbol (554)
+# define Qfuncall builtin_lisp_symbol (555)
+# define Qfuncall_interactively builtin_lisp_symbol (556)
+# define Qfunction builtin_lisp_symbol (557)
+# define Qfunction_documentation builtin_lisp_symbol (558)
+# define Qfunction_history builtin_lisp_symbol (559)
+# define Qfunction_key builtin_lisp_symbol (560)
+# define Qfunctionp builtin_lisp_symbol (561)
+# define Qfundamental_mode builtin_lisp_symbol (562)
+# define Qfuture builtin_lisp_symbol (563)
+# define Qfuturep builtin_lisp_symbol (564)
+# define Qgc_cons_percentage builtin_lisp_symbol (565)
+# define Qgc_cons_threshold builtin_lisp_symbol (566)
+# define Qgc_event_log_file builtin_lisp_symbol (567)
+# define Qgccjit builtin_lisp_symbol (568)
+# define Qgeometry builtin_lisp_symbol (569)
+# define Qget_buffer_window_list builtin_lisp_symbol (570)
+# define Qget_emacs_mule_file_char builtin_lisp_symbol (571)
+# define Qget_file_buffer builtin_lisp_symbol (572)
+# define Qget_file_char builtin_lisp_symbol (573)
+# define Qget_mru_window builtin_lisp_symbol (574)
+# define Qget_scratch_buffer_create builtin_lisp_symbol (575)
+# define Qglobal_mark_ring builtin_lisp_symbol (576)
+# define Qglobal_mark_ring_max builtin_lisp_symbol (577)
+# define Qglyphless_char builtin_lisp_symbol (578)
+# define Qglyphless_char_display builtin_lisp_symbol (579)
+# define Qgnutls_anon builtin_lisp_symbol (580)
+# define Qgnutls_code builtin_lisp_symbol (581)
+# define Qgnutls_e_again builtin_lisp_symbol (582)
+# define Qgnutls_e_interrupted builtin_lisp_symbol (583)
+# define Qgnutls_e_invalid_session builtin_lisp_symbol (584)
+# define Qgnutls_e_not_ready_for_handshake builtin_lisp_symbol (585)
+# define Qgnutls_pkcs_null_password builtin_lisp_symbol (586)
+# define Qgnutls_pkcs_pbes1_des_md5 builtin_lisp_symbol (587)
+# define Qgnutls_pkcs_pbes2_3des builtin_lisp_symbol (588)
+# define Qgnutls_pkcs_pbes2_aes_128 builtin_lisp_symbol (589)
+# define Qgnutls_pkcs_pbes2_aes_192 builtin_lisp_symbol (590)
+# define Qgnutls_pkcs_pbes2_aes_256 builtin_lisp_symbol (591)
+# define Qgnutls_pkcs_pbes2_des builtin_lisp_symbol (592)
+# define Qgnutls_pkcs_pbes2_gost_cpa builtin_lisp_symbol (593)
+# define Qgnutls_pkcs_pbes2_gost_cpb builtin_lisp_symbol (594)
+# define Qgnutls_pkcs_pbes2_gost_cpc builtin_lisp_symbol (595)
+# define Qgnutls_pkcs_pbes2_gost_cpd builtin_lisp_symbol (596)
+# define Qgnutls_pkcs_pbes2_gost_tc26z builtin_lisp_symbol (597)
+# define Qgnutls_pkcs_pkcs12_3des builtin_lisp_symbol (598)
+# define Qgnutls_pkcs_pkcs12_arcfour builtin_lisp_symbol (599)
+# define Qgnutls_pkcs_pkcs12_rc2_40 builtin_lisp_symbol (600)
+# define Qgnutls_pkcs_plain builtin_lisp_symbol (601)
+# define Qgnutls_type_cipher builtin_lisp_symbol (602)
+# define Qgnutls_type_digest_algorithm builtin_lisp_symbol (603)
+# define Qgnutls_type_mac_algorithm builtin_lisp_symbol (604)
+# define Qgnutls_x509pki builtin_lisp_symbol (605)
+# define Qgrave builtin_lisp_symbol (606)
+# define Qgroup builtin_lisp_symbol (607)
+# define Qgrow_only builtin_lisp_symbol (608)
+# define Qgui_figure_window_size builtin_lisp_symbol (609)
+# define Qgui_set_selection builtin_lisp_symbol (610)
+# define Qhaiku builtin_lisp_symbol (611)
+# define Qhand builtin_lisp_symbol (612)
+# define Qhandle builtin_lisp_symbol (613)
+# define Qhandle_select_window builtin_lisp_symbol (614)
+# define Qhandle_shift_selection builtin_lisp_symbol (615)
+# define Qhandle_switch_frame builtin_lisp_symbol (616)
+# define Qhash_table builtin_lisp_symbol (617)
+# define Qhash_table_p builtin_lisp_symbol (618)
+# define Qhash_table_test builtin_lisp_symbol (619)
+# define Qhbar builtin_lisp_symbol (620)
+# define Qheader_line builtin_lisp_symbol (621)
+# define Qheader_line_format builtin_lisp_symbol (622)
+# define Qheap builtin_lisp_symbol (623)
+# define Qheavy builtin_lisp_symbol (624)
+# define Qheight builtin_lisp_symbol (625)
+# define Qheight_only builtin_lisp_symbol (626)
+# define Qhelp__describe_map_tree builtin_lisp_symbol (627)
+# define Qhelp_echo builtin_lisp_symbol (628)
+# define Qhelp_echo_inhibit_substitution builtin_lisp_symbol (629)
+# define Qhelp_form_show builtin_lisp_symbol (630)
+# define Qhelp_key_binding builtin_lisp_symbol (631)
+# define Qhelper_save_restriction builtin_lisp_symbol (632)
+# define Qhelper_unbind_n builtin_lisp_symbol (633)
+# define Qhelper_unwind_protect builtin_lisp_symbol (634)
+# define Qhex_code builtin_lisp_symbol (635)
+# define Qhide builtin_lisp_symbol (636)
+# define Qhollow builtin_lisp_symbol (637)
+# define Qhorizontal_handle builtin_lisp_symbol (638)
+# define Qhorizontal_scroll_bar builtin_lisp_symbol (639)
+# define Qhorizontal_scroll_bars builtin_lisp_symbol (640)
+# define Qhw builtin_lisp_symbol (641)
+# define Qicon builtin_lisp_symbol (642)
+# define Qicon_left builtin_lisp_symbol (643)
+# define Qicon_name builtin_lisp_symbol (644)
+# define Qicon_top builtin_lisp_symbol (645)
+# define Qicon_type builtin_lisp_symbol (646)
+# define Qiconify_frame builtin_lisp_symbol (647)
+# define Qiconify_top_level builtin_lisp_symbol (648)
+# define Qidentity builtin_lisp_symbol (649)
+# define Qif builtin_lisp_symbol (650)
+# define Qif_regular builtin_lisp_symbol (651)
+# define Qignore_self_insert builtin_lisp_symbol (652)
+# define Qignored builtin_lisp_symbol (653)
+# define Qimage builtin_lisp_symbol (654)
+# define Qinc_args builtin_lisp_symbol (655)
+# define Qinhibit_changing_match_data builtin_lisp_symbol (656)
+# define Qinhibit_debugger builtin_lisp_symbol (657)
+# define Qinhibit_double_buffering builtin_lisp_symbol (658)
+# define Qinhibit_eval_during_redisplay builtin_lisp_symbol (659)
+# define Qinhibit_file_name_operation builtin_lisp_symbol (660)
+# define Qinhibit_free_realized_faces builtin_lisp_symbol (661)
+# define Qinhibit_menubar_update builtin_lisp_symbol (662)
+# define Qinhibit_modification_hooks builtin_lisp_symbol (663)
+# define Qinhibit_point_motion_hooks builtin_lisp_symbol (664)
+# define Qinhibit_quit builtin_lisp_symbol (665)
+# define Qinhibit_read_only builtin_lisp_symbol (666)
+# define Qinhibit_redisplay builtin_lisp_symbol (667)
+# define Qinhibited_interaction builtin_lisp_symbol (668)
+# define Qinner_edges builtin_lisp_symbol (669)
+# define Qinput_method_exit_on_first_char builtin_lisp_symbol (670)
+# define Qinput_method_use_echo_area builtin_lisp_symbol (671)
+# define Qinsert_behind_hooks builtin_lisp_symbol (672)
+# define Qinsert_file_contents builtin_lisp_symbol (673)
+# define Qinsert_in_front_hooks builtin_lisp_symbol (674)
+# define Qinserted_chars builtin_lisp_symbol (675)
+# define Qinsufficient_source builtin_lisp_symbol (676)
+# define Qintangible builtin_lisp_symbol (677)
+# define Qinteger builtin_lisp_symbol (678)
+# define Qinteger_or_marker_p builtin_lisp_symbol (679)
+# define Qintegerp builtin_lisp_symbol (680)
+# define Qinteractive builtin_lisp_symbol (681)
+# define Qinteractive_args builtin_lisp_symbol (682)
+# define Qinteractive_form builtin_lisp_symbol (683)
+# define Qinteractive_p builtin_lisp_symbol (684)
+# define Qinternal__syntax_propertize builtin_lisp_symbol (685)
+# define Qinternal_auto_fill builtin_lisp_symbol (686)
+# define Qinternal_border builtin_lisp_symbol (687)
+# define Qinternal_border_width builtin_lisp_symbol (688)
+# define Qinternal_default_interrupt_process builtin_lisp_symbol (689)
+# define Qinternal_default_process_filter builtin_lisp_symbol (690)
+# define Qinternal_default_process_sentinel builtin_lisp_symbol (691)
+# define Qinternal_default_signal_process builtin_lisp_symbol (692)
+# define Qinternal_echo_keystrokes_prefix builtin_lisp_symbol (693)
+# define Qinternal_when_entered_debugger builtin_lisp_symbol (694)
+# define Qinterrupt_process_functions builtin_lisp_symbol (695)
+# define Qinterrupted builtin_lisp_symbol (696)
+# define Qintervals builtin_lisp_symbol (697)
+# define Qinvalid_function builtin_lisp_symbol (698)
+# define Qinvalid_read_syntax builtin_lisp_symbol (699)
+# define Qinvalid_regexp builtin_lisp_symbol (700)
+# define Qinvalid_source builtin_lisp_symbol (701)
+# define Qinvisible builtin_lisp_symbol (702)
+# define Qipv4 builtin_lisp_symbol (703)
+# define Qipv6 builtin_lisp_symbol (704)
+# define Qiso10646_1 builtin_lisp_symbol (705)
+# define Qiso8859_1 builtin_lisp_symbol (706)
+# define Qiso_2022 builtin_lisp_symbol (707)
+# define Qiso_8859_1 builtin_lisp_symbol (708)
+# define Qitalic builtin_lisp_symbol (709)
+# define Qiv_auto builtin_lisp_symbol (710)
+# define Qja builtin_lisp_symbol (711)
+# define Qjump builtin_lisp_symbol (712)
+# define Qkbd_macro_termination_hook builtin_lisp_symbol (713)
+# define Qkeep_ratio builtin_lisp_symbol (714)
+# define Qkey builtin_lisp_symbol (715)
+# define Qkey_and_value builtin_lisp_symbol (716)
+# define Qkey_or_value builtin_lisp_symbol (717)
+# define Qkey_parse builtin_lisp_symbol (718)
+# define Qkey_valid_p builtin_lisp_symbol (719)
+# define Qkeymap builtin_lisp_symbol (720)
+# define Qkeymap_canonicalize builtin_lisp_symbol (721)
+# define Qkeymapp builtin_lisp_symbol (722)
+# define Qkill_buffer__possibly_save builtin_lisp_symbol (723)
+# define Qkill_buffer_hook builtin_lisp_symbol (724)
+# define Qkill_buffer_query_functions builtin_lisp_symbol (725)
+# define Qkill_emacs builtin_lisp_symbol (726)
+# define Qkill_emacs_hook builtin_lisp_symbol (727)
+# define Qkill_forward_chars builtin_lisp_symbol (728)
+# define Qko builtin_lisp_symbol (729)
+# define Qlambda_fixup builtin_lisp_symbol (730)
+# define Qlanguage_change builtin_lisp_symbol (731)
+# define Qlast_arrow_position builtin_lisp_symbol (732)
+# define Qlast_arrow_string builtin_lisp_symbol (733)
+# define Qlast_nonmenu_event builtin_lisp_symbol (734)
+# define Qlast_selected_window builtin_lisp_symbol (735)
+# define Qlate builtin_lisp_symbol (736)
+# define Qleft builtin_lisp_symbol (737)
+# define Qleft_edge builtin_lisp_symbol (738)
+# define Qleft_fringe builtin_lisp_symbol (739)
+# define Qleft_margin builtin_lisp_symbol (740)
+# define Qleft_only builtin_lisp_symbol (741)
+# define Qleft_to_right builtin_lisp_symbol (742)
+# define Qleftmost builtin_lisp_symbol (743)
+# define Qlet builtin_lisp_symbol (744)
+# define Qletx builtin_lisp_symbol (745)
+# define Qlexical_binding builtin_lisp_symbol (746)
+# define Qlight builtin_lisp_symbol (747)
+# define Qline builtin_lisp_symbol (748)
+# define Qline_height builtin_lisp_symbol (749)
+# define Qline_number builtin_lisp_symbol (750)
+# define Qline_number_current_line builtin_lisp_symbol (751)
+# define Qline_number_major_tick builtin_lisp_symbol (752)
+# define Qline_number_minor_tick builtin_lisp_symbol (753)
+# define Qline_prefix builtin_lisp_symbol (754)
+# define Qline_spacing builtin_lisp_symbol (755)
+# define Qlisp_directory builtin_lisp_symbol (756)
+# define Qlist builtin_lisp_symbol (757)
+# define Qlist_or_vector_p builtin_lisp_symbol (758)
+# define Qlist_system_processes builtin_lisp_symbol (759)
+# define Qlisten builtin_lisp_symbol (760)
+# define Qlistp builtin_lisp_symbol (761)
+# define Qlittle builtin_lisp_symbol (762)
+# define Qload builtin_lisp_symbol (763)
+# define Qload_file_name builtin_lisp_symbol (764)
+# define Qload_force_doc_strings builtin_lisp_symbol (765)
+# define Qload_in_progress builtin_lisp_symbol (766)
+# define Qload_time builtin_lisp_symbol (767)
+# define Qload_true_file_name builtin_lisp_symbol (768)
+# define Qlocal builtin_lisp_symbol (769)
+# define Qlocal_map builtin_lisp_symbol (770)
+# define Qlock_file builtin_lisp_symbol (771)
+# define Qlong builtin_lisp_symbol (772)
+# define Qlowercase builtin_lisp_symbol (773)
+# define Qlread_unescaped_character_literals builtin_lisp_symbol (774)
+# define Qm builtin_lisp_symbol (775)
+# define Qmac builtin_lisp_symbol (776)
+# define Qmacro builtin_lisp_symbol (777)
+# define Qmacroexp__dynvars builtin_lisp_symbol (778)
+# define Qmajflt builtin_lisp_symbol (779)
+# define Qmake_cursor_line_fully_visible builtin_lisp_symbol (780)
+# define Qmake_directory builtin_lisp_symbol (781)
+# define Qmake_directory_internal builtin_lisp_symbol (782)
+# define Qmake_frame_visible builtin_lisp_symbol (783)
+# define Qmake_invisible builtin_lisp_symbol (784)
+# define Qmake_lock_file_name builtin_lisp_symbol (785)
+# define Qmake_process builtin_lisp_symbol (786)
+# define Qmake_symbolic_link builtin_lisp_symbol (787)
+# define Qmake_window_start_visible builtin_lisp_symbol (788)
+# define Qmakunbound builtin_lisp_symbol (789)
+# define Qmany builtin_lisp_symbol (790)
+# define Qmargin builtin_lisp_symbol (791)
+# define Qmark_for_redisplay builtin_lisp_symbol (792)
+# define Qmark_inactive builtin_lisp_symbol (793)
+# define Qmarker builtin_lisp_symbol (794)
+# define Qmarkerp builtin_lisp_symbol (795)
+# define Qmaximized builtin_lisp_symbol (796)
+# define Qmd5 builtin_lisp_symbol (797)
+# define Qmedium builtin_lisp_symbol (798)
+# define Qmemory_info builtin_lisp_symbol (799)
+# define Qmenu builtin_lisp_symbol (800)
+# define Qmenu_bar builtin_lisp_symbol (801)
+# define Qmenu_bar_external builtin_lisp_symbol (802)
+# define Qmenu_bar_lines builtin_lisp_symbol (803)
+# define Qmenu_bar_size builtin_lisp_symbol (804)
+# define Qmenu_bar_update_hook builtin_lisp_symbol (805)
+# define Qmenu_enable builtin_lisp_symbol (806)
+# define Qmenu_item builtin_lisp_symbol (807)
+# define Qmessage builtin_lisp_symbol (808)
+# define Qmetadata builtin_lisp_symbol (809)
+# define Qmin_height builtin_lisp_symbol (810)
+# define Qmin_width builtin_lisp_symbol (811)
+# define Qminflt builtin_lisp_symbol (812)
+# define Qminibuffer builtin_lisp_symbol (813)
+# define Qminibuffer_completing_file_name builtin_lisp_symbol (814)
+# define Qminibuffer_completion_table builtin_lisp_symbol (815)
+# define Qminibuffer_default builtin_lisp_symbol (816)
+# define Qminibuffer_exit builtin_lisp_symbol (817)
+# define Qminibuffer_exit_hook builtin_lisp_symbol (818)
+# define Qminibuffer_follows_selected_frame builtin_lisp_symbol (819)
+# define Qminibuffer_history builtin_lisp_symbol (820)
+# define Qminibuffer_inactive_mode builtin_lisp_symbol (821)
+# define Qminibuffer_mode builtin_lisp_symbol (822)
+# define Qminibuffer_prompt builtin_lisp_symbol (823)
+# define Qminibuffer_quit builtin_lisp_symbol (824)
+# define Qminibuffer_setup_hook builtin_lisp_symbol (825)
+# define Qminus builtin_lisp_symbol (826)
+# define Qmirroring builtin_lisp_symbol (827)
+# define Qmm_size builtin_lisp_symbol (828)
+# define Qmode_class builtin_lisp_symbol (829)
+# define Qmode_line builtin_lisp_symbol (830)
+# define Qmode_line_active builtin_lisp_symbol (831)
+# define Qmode_line_default_help_echo builtin_lisp_symbol (832)
+# define Qmode_line_format builtin_lisp_symbol (833)
+# define Qmode_line_inactive builtin_lisp_symbol (834)
+# define Qmodeline builtin_lisp_symbol (835)
+# define Qmodification_hooks builtin_lisp_symbol (836)
+# define Qmodifier_cache builtin_lisp_symbol (837)
+# define Qmodule_function builtin_lisp_symbol (838)
+# define Qmonths builtin_lisp_symbol (839)
+# define Qmouse builtin_lisp_symbol (840)
+# define Qmouse_click builtin_lisp_symbol (841)
+# define Qmouse_color builtin_lisp_symbol (842)
+# define Qmouse_face builtin_lisp_symbol (843)
+# define Qmouse_fixup_help_message builtin_lisp_symbol (844)
+# define Qmouse_leave_buffer_hook builtin_lisp_symbol (845)
+# define Qmouse_movement builtin_lisp_symbol (846)
+# define Qmouse_wheel_frame builtin_lisp_symbol (847)
+# define Qmove_frame builtin_lisp_symbol (848)
+# define Qmove_toolbar builtin_lisp_symbol (849)
+# define Qmutex builtin_lisp_symbol (850)
+# define Qmutexp builtin_lisp_symbol (851)
+# define Qname builtin_lisp_symbol (852)
+# define Qnative__compile_async builtin_lisp_symbol (853)
+# define Qnative_comp_compiler_options builtin_lisp_symbol (854)
+# define Qnative_comp_debug builtin_lisp_symbol (855)
+# define Qnative_comp_driver_options builtin_lisp_symbol (856)
+# define Qnative_comp_speed builtin_lisp_symbol (857)
+# define Qnative_comp_unit builtin_lisp_symbol (858)
+# define Qnative_comp_warning_on_missing_source builtin_lisp_symbol (859)
+# define Qnative_compiler_error builtin_lisp_symbol (860)
+# define Qnative_edges builtin_lisp_symbol (861)
+# define Qnative_ice builtin_lisp_symbol (862)
+# define Qnative_lisp_file_inconsistent builtin_lisp_symbol (863)
+# define Qnative_lisp_load_failed builtin_lisp_symbol (864)
+# define Qnative_lisp_wrong_reloc builtin_lisp_symbol (865)
+# define Qnatnump builtin_lisp_symbol (866)
+# define Qnegate builtin_lisp_symbol (867)
+# define Qnetwork builtin_lisp_symbol (868)
+# define Qnice builtin_lisp_symbol (869)
+# define Qno_accept_focus builtin_lisp_symbol (870)
+# define Qno_catch builtin_lisp_symbol (871)
+# define Qno_conversion builtin_lisp_symbol (872)
+# define Qno_focus_on_map builtin_lisp_symbol (873)
+# define Qno_other_frame builtin_lisp_symbol (874)
+# define Qno_other_window builtin_lisp_symbol (875)
+# define Qno_record builtin_lisp_symbol (876)
+# define Qno_special_glyphs builtin_lisp_symbol (877)
+# define Qnobreak_hyphen builtin_lisp_symbol (878)
+# define Qnobreak_space builtin_lisp_symbol (879)
+# define Qnoelisp builtin_lisp_symbol (880)
+# define Qnon_ascii builtin_lisp_symbol (881)
+# define Qnon_key_event builtin_lisp_symbol (882)
+# define Qnone builtin_lisp_symbol (883)
+# define Qnormal builtin_lisp_symbol (884)
+# define Qnormal_top_level builtin_lisp_symbol (885)
+# define Qns builtin_lisp_symbol (886)
+# define Qns_appearance builtin_lisp_symbol (887)
+# define Qns_parse_geometry builtin_lisp_symbol (888)
+# define Qns_transparent_titlebar builtin_lisp_symbol (889)
+# define Qnsm_verify_connection builtin_lisp_symbol (890)
+# define Qnth builtin_lisp_symbol (891)
+# define Qnull builtin_lisp_symbol (892)
+# define Qnumber_or_marker_p builtin_lisp_symbol (893)
+# define Qnumberp builtin_lisp_symbol (894)
+# define Qnumeric builtin_lisp_symbol (895)
+# define Qobarray_cache builtin_lisp_symbol (896)
+# define Qobarrayp builtin_lisp_symbol (897)
+# define Qobject builtin_lisp_symbol (898)
+# define Qoblique builtin_lisp_symbol (899)
+# define Qoclosure_interactive_form builtin_lisp_symbol (900)
+# define Qodd builtin_lisp_symbol (901)
+# define Qonly builtin_lisp_symbol (902)
+# define Qopen builtin_lisp_symbol (903)
+# define Qopen_network_stream builtin_lisp_symbol (904)
+# define Qopentype builtin_lisp_symbol (905)
+# define Qoperations builtin_lisp_symbol (906)
+# define Qouter_border_width builtin_lisp_symbol (907)
+# define Qouter_edges builtin_lisp_symbol (908)
+# define Qouter_position builtin_lisp_symbol (909)
+# define Qouter_size builtin_lisp_symbol (910)
+# define Qouter_window_id builtin_lisp_symbol (911)
+# define Qoverflow_error builtin_lisp_symbol (912)
+# define Qoverlay builtin_lisp_symbol (913)
+# define Qoverlay_arrow_bitmap builtin_lisp_symbol (914)
+# define Qoverlay_arrow_string builtin_lisp_symbol (915)
+# define Qoverlayp builtin_lisp_symbol (916)
+# define Qoverride_redirect builtin_lisp_symbol (917)
+# define Qoverriding_local_map builtin_lisp_symbol (918)
+# define Qoverriding_plist_environment builtin_lisp_symbol (919)
+# define Qoverriding_terminal_local_map builtin_lisp_symbol (920)
+# define Qoverwrite_mode builtin_lisp_symbol (921)
+# define Qoverwrite_mode_binary builtin_lisp_symbol (922)
+# define Qp builtin_lisp_symbol (923)
+# define Qpaper builtin_lisp_symbol (924)
+# define Qparent_frame builtin_lisp_symbol (925)
+# define Qparent_id builtin_lisp_symbol (926)
+# define Qpc builtin_lisp_symbol (927)
+# define Qpcpu builtin_lisp_symbol (928)
+# define Qpermanent_local builtin_lisp_symbol (929)
+# define Qpermanent_local_hook builtin_lisp_symbol (930)
+# define Qpermission_denied builtin_lisp_symbol (931)
+# define Qpgrp builtin_lisp_symbol (932)
+# define Qpgtk builtin_lisp_symbol (933)
+# define Qphi builtin_lisp_symbol (934)
+# define Qpinch builtin_lisp_symbol (935)
+# define Qpipe builtin_lisp_symbol (936)
+# define Qpipe_process_p builtin_lisp_symbol (937)
+# define Qplay_sound_functions builtin_lisp_symbol (938)
+# define Qplistp builtin_lisp_symbol (939)
+# define Qplus builtin_lisp_symbol (940)
+# define Qpmem builtin_lisp_symbol (941)
+# define Qpoint_entered builtin_lisp_symbol (942)
+# define Qpoint_left builtin_lisp_symbol (943)
+# define Qpointer builtin_lisp_symbol (944)
+# define Qpolling_period builtin_lisp_symbol (945)
+# define Qpoly builtin_lisp_symbol (946)
+# define Qposition builtin_lisp_symbol (947)
+# define Qpost_command_hook builtin_lisp_symbol (948)
+# define Qpost_gc_hook builtin_lisp_symbol (949)
+# define Qpost_select_region_hook builtin_lisp_symbol (950)
+# define Qpost_self_insert_hook builtin_lisp_symbol (951)
+# define Qppid builtin_lisp_symbol (952)
+# define Qpre_command_hook builtin_lisp_symbol (953)
+# define Qpreedit_text builtin_lisp_symbol (954)
+# define Qpressed_button builtin_lisp_symbol (955)
+# define Qpri builtin_lisp_symbol (956)
+# define Qprint__unreadable_callback_buffer builtin_lisp_symbol (957)
+# define Qprint_escape_multibyte builtin_lisp_symbol (958)
+# define Qprint_escape_nonascii builtin_lisp_symbol (959)
+# define Qprint_unreadable_function builtin_lisp_symbol (960)
+# define Qpriority builtin_lisp_symbol (961)
+# define Qprocess builtin_lisp_symbol (962)
+# define Qprocess_attributes builtin_lisp_symbol (963)
+# define Qprocessp builtin_lisp_symbol (964)
+# define Qprogn builtin_lisp_symbol (965)
+# define Qpropertize builtin_lisp_symbol (966)
+# define Qprotected_field builtin_lisp_symbol (967)
+# define Qprovide builtin_lisp_symbol (968)
+# define Qpty builtin_lisp_symbol (969)
+# define Qpurecopy builtin_lisp_symbol (970)
+# define Qpush_exception builtin_lisp_symbol (971)
+# define Qpush_window_buffer_onto_prev builtin_lisp_symbol (972)
+# define Qquit builtin_lisp_symbol (973)
+# define Qquote builtin_lisp_symbol (974)
+# define Qraise builtin_lisp_symbol (975)
+# define Qrange builtin_lisp_symbol (976)
+# define Qrange_error builtin_lisp_symbol (977)
+# define Qratio builtin_lisp_symbol (978)
+# define Qraw_text builtin_lisp_symbol (979)
+# define Qread builtin_lisp_symbol (980)
+# define Qread_char builtin_lisp_symbol (981)
+# define Qread_number builtin_lisp_symbol (982)
+# define Qread_only builtin_lisp_symbol (983)
+# define Qreal builtin_lisp_symbol (984)
+# define Qreal_this_command builtin_lisp_symbol (985)
+# define Qrear_nonsticky builtin_lisp_symbol (986)
+# define Qrecord builtin_lisp_symbol (987)
+# define Qrecord_unwind_current_buffer builtin_lisp_symbol (988)
+# define Qrecord_unwind_protect_excursion builtin_lisp_symbol (989)
+# define Qrecord_window_buffer builtin_lisp_symbol (990)
+# define Qrecordp builtin_lisp_symbol (991)
+# define Qrect builtin_lisp_symbol (992)
+# define Qrecursion_error builtin_lisp_symbol (993)
+# define Qredisplay_dont_pause builtin_lisp_symbol (994)
+# define Qredisplay_internal_xC_functionx builtin_lisp_symbol (995)
+# define Qrelative builtin_lisp_symbol (996)
+# define Qreleased_button builtin_lisp_symbol (997)
+# define Qremap builtin_lisp_symbol (998)
+# define Qremote_file_error builtin_lisp_symbol (999)
+# define Qrename_file builtin_lisp_symbol (1000)
+# define Qreplace_buffer_in_windows builtin_lisp_symbol (1001)
+# define Qrequire builtin_lisp_symbol (1002)
+# define Qreset builtin_lisp_symbol (1003)
+# define Qreturn builtin_lisp_symbol (1004)
+# define Qright builtin_lisp_symbol (1005)
+# define Qright_divider builtin_lisp_symbol (1006)
+# define Qright_divider_width builtin_lisp_symbol (1007)
+# define Qright_edge builtin_lisp_symbol (1008)
+# define Qright_fringe builtin_lisp_symbol (1009)
+# define Qright_margin builtin_lisp_symbol (1010)
+# define Qright_to_left builtin_lisp_symbol (1011)
+# define Qrightmost builtin_lisp_symbol (1012)
+# define Qrisky_local_variable builtin_lisp_symbol (1013)
+# define Qrss builtin_lisp_symbol (1014)
+# define Qrun builtin_lisp_symbol (1015)
+# define Qrun_hook_query_error_with_timeout builtin_lisp_symbol (1016)
+# define Qrun_hook_with_args builtin_lisp_symbol (1017)
+# define Qsafe builtin_lisp_symbol (1018)
+# define Qsave_excursion builtin_lisp_symbol (1019)
+# define Qsave_session builtin_lisp_symbol (1020)
+# define Qscale_factor builtin_lisp_symbol (1021)
+# define Qscan_error builtin_lisp_symbol (1022)
+# define Qscratch builtin_lisp_symbol (1023)
+# define Qscreen_gamma builtin_lisp_symbol (1024)
+# define Qscroll_bar builtin_lisp_symbol (1025)
+# define Qscroll_bar_background builtin_lisp_symbol (1026)
+# define Qscroll_bar_foreground builtin_lisp_symbol (1027)
+# define Qscroll_bar_height builtin_lisp_symbol (1028)
+# define Qscroll_bar_movement builtin_lisp_symbol (1029)
+# define Qscroll_bar_width builtin_lisp_symbol (1030)
+# define Qscroll_command builtin_lisp_symbol (1031)
+# define Qscroll_down builtin_lisp_symbol (1032)
+# define Qscroll_up builtin_lisp_symbol (1033)
+# define Qsearch_failed builtin_lisp_symbol (1034)
+# define Qsecure_hash_file builtin_lisp_symbol (1035)
+# define Qselect_frame_set_input_focus builtin_lisp_symbol (1036)
+# define Qselect_window builtin_lisp_symbol (1037)
+# define Qselection_request builtin_lisp_symbol (1038)
+# define Qself_insert_command builtin_lisp_symbol (1039)
+# define Qsemi_bold builtin_lisp_symbol (1040)
+# define Qsemi_light builtin_lisp_symbol (1041)
+# define Qseqpacket builtin_lisp_symbol (1042)
+# define Qsequencep builtin_lisp_symbol (1043)
+# define Qserial builtin_lisp_symbol (1044)
+# define Qsess builtin_lisp_symbol (1045)
+# define Qset builtin_lisp_symbol (1046)
+# define Qset_args_to_local builtin_lisp_symbol (1047)
+# define Qset_default builtin_lisp_symbol (1048)
+# define Qset_file_acl builtin_lisp_symbol (1049)
+# define Qset_file_modes builtin_lisp_symbol (1050)
+# define Qset_file_selinux_context builtin_lisp_symbol (1051)
+# define Qset_file_times builtin_lisp_symbol (1052)
+# define Qset_internal builtin_lisp_symbol (1053)
+# define Qset_par_to_local builtin_lisp_symbol (1054)
+# define Qset_rest_args_to_local builtin_lisp_symbol (1055)
+# define Qset_visited_file_modtime builtin_lisp_symbol (1056)
+# define Qset_window_configuration builtin_lisp_symbol (1057)
+# define Qsetcar builtin_lisp_symbol (1058)
+# define Qsetcdr builtin_lisp_symbol (1059)
+# define Qsetimm builtin_lisp_symbol (1060)
+# define Qsetq builtin_lisp_symbol (1061)
+# define Qsetting_constant builtin_lisp_symbol (1062)
+# define Qsha1 builtin_lisp_symbol (1063)
+# define Qsha224 builtin_lisp_symbol (1064)
+# define Qsha256 builtin_lisp_symbol (1065)
+# define Qsha384 builtin_lisp_symbol (1066)
+# define Qsha512 builtin_lisp_symbol (1067)
+# define Qshaded builtin_lisp_symbol (1068)
+# define Qshift_jis builtin_lisp_symbol (1069)
+# define Qsignal builtin_lisp_symbol (1070)
+# define Qsignal_process_functions builtin_lisp_symbol (1071)
+# define Qsingularity_error builtin_lisp_symbol (1072)
+# define Qsize builtin_lisp_symbol (1073)
+# define Qskip_taskbar builtin_lisp_symbol (1074)
+# define Qslice builtin_lisp_symbol (1075)
+# define Qsound builtin_lisp_symbol (1076)
+# define Qsource builtin_lisp_symbol (1077)
+# define Qspace builtin_lisp_symbol (1078)
+# define Qspace_width builtin_lisp_symbol (1079)
+# define Qspecial_lowercase builtin_lisp_symbol (1080)
+# define Qspecial_titlecase builtin_lisp_symbol (1081)
+# define Qspecial_uppercase builtin_lisp_symbol (1082)
+# define Qsqlite builtin_lisp_symbol (1083)
+# define Qstandard_input builtin_lisp_symbol (1084)
+# define Qstandard_output builtin_lisp_symbol (1085)
+# define Qstart builtin_lisp_symbol (1086)
+# define Qstart_process builtin_lisp_symbol (1087)
+# define Qstate builtin_lisp_symbol (1088)
+# define Qstderr builtin_lisp_symbol (1089)
+# define Qstdin builtin_lisp_symbol (1090)
+# define Qstdout builtin_lisp_symbol (1091)
+# define Qsticky builtin_lisp_symbol (1092)
+# define Qstime builtin_lisp_symbol (1093)
+# define Qstop builtin_lisp_symbol (1094)
+# define Qstraight builtin_lisp_symbol (1095)
+# define Qstring builtin_lisp_symbol (1096)
+# define Qstring_bytes builtin_lisp_symbol (1097)
+# define Qstring_lessp builtin_lisp_symbol (1098)
+# define Qstringp builtin_lisp_symbol (1099)
+# define Qstrings builtin_lisp_symbol (1100)
+# define Qsub1 builtin_lisp_symbol (1101)
+# define Qsub_char_table builtin_lisp_symbol (1102)
+# define Qsubfeatures builtin_lisp_symbol (1103)
+# define Qsubr builtin_lisp_symbol (1104)
+# define Qsubrp builtin_lisp_symbol (1105)
+# define Qsubstitute_command_keys builtin_lisp_symbol (1106)
+# define Qsubstitute_env_in_file_name builtin_lisp_symbol (1107)
+# define Qsubstitute_in_file_name builtin_lisp_symbol (1108)
+# define Qsw builtin_lisp_symbol (1109)
+# define Qswitch_frame builtin_lisp_symbol (1110)
+# define Qsymbol builtin_lisp_symbol (1111)
+# define Qsymbolp builtin_lisp_symbol (1112)
+# define Qsymbols builtin_lisp_symbol (1113)
+# define Qsyntax_ppss builtin_lisp_symbol (1114)
+# define Qsyntax_table builtin_lisp_symbol (1115)
+# define Qsyntax_table_p builtin_lisp_symbol (1116)
+# define Qtab_bar builtin_lisp_symbol (1117)
+# define Qtab_bar_lines builtin_lisp_symbol (1118)
+# define Qtab_bar_size builtin_lisp_symbol (1119)
+# define Qtab_line builtin_lisp_symbol (1120)
+# define Qtab_line_format builtin_lisp_symbol (1121)
+# define Qtarget_idx builtin_lisp_symbol (1122)
+# define Qtemp_buffer_setup_hook builtin_lisp_symbol (1123)
+# define Qtemp_buffer_show_hook builtin_lisp_symbol (1124)
+# define Qterminal builtin_lisp_symbol (1125)
+# define Qterminal_frame builtin_lisp_symbol (1126)
+# define Qterminal_live_p builtin_lisp_symbol (1127)
+# define Qtest builtin_lisp_symbol (1128)
+# define Qtext builtin_lisp_symbol (1129)
+# define Qtext_image_horiz builtin_lisp_symbol (1130)
+# define Qtext_pixels builtin_lisp_symbol (1131)
+# define Qtext_read_only builtin_lisp_symbol (1132)
+# define Qthcount builtin_lisp_symbol (1133)
+# define Qthin builtin_lisp_symbol (1134)
+# define Qthin_space builtin_lisp_symbol (1135)
+# define Qthread builtin_lisp_symbol (1136)
+# define Qthread_event builtin_lisp_symbol (1137)
+# define Qthread_pool builtin_lisp_symbol (1138)
+# define Qthread_pool_p builtin_lisp_symbol (1139)
+# define Qthreadp builtin_lisp_symbol (1140)
+# define Qthreshold builtin_lisp_symbol (1141)
+# define Qtime builtin_lisp_symbol (1142)
+# define Qtimer_event_handler builtin_lisp_symbol (1143)
+# define Qtip_frame builtin_lisp_symbol (1144)
+# define Qtitle builtin_lisp_symbol (1145)
+# define Qtitle_bar_size builtin_lisp_symbol (1146)
+# define Qtitlecase builtin_lisp_symbol (1147)
+# define Qtool_bar builtin_lisp_symbol (1148)
+# define Qtool_bar_external builtin_lisp_symbol (1149)
+# define Qtool_bar_lines builtin_lisp_symbol (1150)
+# define Qtool_bar_position builtin_lisp_symbol (1151)
+# define Qtool_bar_size builtin_lisp_symbol (1152)
+# define Qtooltip builtin_lisp_symbol (1153)
+# define Qtop builtin_lisp_symbol (1154)
+# define Qtop_edge builtin_lisp_symbol (1155)
+# define Qtop_left_corner builtin_lisp_symbol (1156)
+# define Qtop_level builtin_lisp_symbol (1157)
+# define Qtop_only builtin_lisp_symbol (1158)
+# define Qtop_right_corner builtin_lisp_symbol (1159)
+# define Qtouch_end builtin_lisp_symbol (1160)
+# define Qtouchscreen_begin builtin_lisp_symbol (1161)
+# define Qtouchscreen_end builtin_lisp_symbol (1162)
+# define Qtouchscreen_update builtin_lisp_symbol (1163)
+# define Qtpgid builtin_lisp_symbol (1164)
+# define Qtrailing_whitespace builtin_lisp_symbol (1165)
+# define Qtranslation_table builtin_lisp_symbol (1166)
+# define Qtranslation_table_id builtin_lisp_symbol (1167)
+# define Qtrapping_constant builtin_lisp_symbol (1168)
+# define Qtree_sitter builtin_lisp_symbol (1169)
+# define Qtree_sitter_cursor builtin_lisp_symbol (1170)
+# define Qtree_sitter_node builtin_lisp_symbol (1171)
+# define Qttname builtin_lisp_symbol (1172)
+# define Qtty builtin_lisp_symbol (1173)
+# define Qtty_color_alist builtin_lisp_symbol (1174)
+# define Qtty_color_by_index builtin_lisp_symbol (1175)
+# define Qtty_color_desc builtin_lisp_symbol (1176)
+# define Qtty_color_mode builtin_lisp_symbol (1177)
+# define Qtty_color_standard_values builtin_lisp_symbol (1178)
+# define Qtty_menu_exit builtin_lisp_symbol (1179)
+# define Qtty_menu_ignore builtin_lisp_symbol (1180)
+# define Qtty_menu_mouse_movement builtin_lisp_symbol (1181)
+# define Qtty_menu_navigation_map builtin_lisp_symbol (1182)
+# define Qtty_menu_next_item builtin_lisp_symbol (1183)
+# define Qtty_menu_next_menu builtin_lisp_symbol (1184)
+# define Qtty_menu_prev_item builtin_lisp_symbol (1185)
+# define Qtty_menu_prev_menu builtin_lisp_symbol (1186)
+# define Qtty_menu_select builtin_lisp_symbol (1187)
+# define Qtty_mode_reset_strings builtin_lisp_symbol (1188)
+# define Qtty_mode_set_strings builtin_lisp_symbol (1189)
+# define Qtty_type builtin_lisp_symbol (1190)
+# define Qultra_bold builtin_lisp_symbol (1191)
+# define Qultra_heavy builtin_lisp_symbol (1192)
+# define Qultra_light builtin_lisp_symbol (1193)
+# define Qundecided builtin_lisp_symbol (1194)
+# define Qundecorated builtin_lisp_symbol (1195)
+# define Qundefined builtin_lisp_symbol (1196)
+# define Qunderflow_error builtin_lisp_symbol (1197)
+# define Qunderline_minimum_offset builtin_lisp_symbol (1198)
+# define Qundo_auto__add_boundary builtin_lisp_symbol (1199)
+# define Qundo_auto__last_boundary_cause builtin_lisp_symbol (1200)
+# define Qundo_auto__this_command_amalgamating builtin_lisp_symbol (1201)
+# define Qundo_auto__undoable_change builtin_lisp_symbol (1202)
+# define Qundo_auto__undoably_changed_buffers builtin_lisp_symbol (1203)
+# define Qundo_auto_amalgamate builtin_lisp_symbol (1204)
+# define Qunevalled builtin_lisp_symbol (1205)
+# define Qunhandled_file_name_directory builtin_lisp_symbol (1206)
+# define Qunicode builtin_lisp_symbol (1207)
+# define Qunicode_bmp builtin_lisp_symbol (1208)
+# define Qunix builtin_lisp_symbol (1209)
+# define Qunlet builtin_lisp_symbol (1210)
+# define Qunlock_file builtin_lisp_symbol (1211)
+# define Qunreachable builtin_lisp_symbol (1212)
+# define Qunspecified builtin_lisp_symbol (1213)
+# define Qunsplittable builtin_lisp_symbol (1214)
+# define Qup builtin_lisp_symbol (1215)
+# define Quppercase builtin_lisp_symbol (1216)
+# define Qus_ascii builtin_lisp_symbol (1217)
+# define Quse_frame_synchronization builtin_lisp_symbol (1218)
+# define Quser builtin_lisp_symbol (1219)
+# define Quser_error builtin_lisp_symbol (1220)
+# define Quser_position builtin_lisp_symbol (1221)
+# define Quser_ptr builtin_lisp_symbol (1222)
+# define Quser_ptrp builtin_lisp_symbol (1223)
+# define Quser_search_failed builtin_lisp_symbol (1224)
+# define Quser_size builtin_lisp_symbol (1225)
+# define Qutf_16 builtin_lisp_symbol (1226)
+# define Qutf_16le builtin_lisp_symbol (1227)
+# define Qutf_8 builtin_lisp_symbol (1228)
+# define Qutf_8_emacs builtin_lisp_symbol (1229)
+# define Qutf_8_string_p builtin_lisp_symbol (1230)
+# define Qutf_8_unix builtin_lisp_symbol (1231)
+# define Qutime builtin_lisp_symbol (1232)
+# define Qvalue builtin_lisp_symbol (1233)
+# define Qvariable_documentation builtin_lisp_symbol (1234)
+# define Qvector builtin_lisp_symbol (1235)
+# define Qvector_or_char_table_p builtin_lisp_symbol (1236)
+# define Qvector_slots builtin_lisp_symbol (1237)
+# define Qvectorp builtin_lisp_symbol (1238)
+# define Qvectors builtin_lisp_symbol (1239)
+# define Qverify_visited_file_modtime builtin_lisp_symbol (1240)
+# define Qvertical_border builtin_lisp_symbol (1241)
+# define Qvertical_line builtin_lisp_symbol (1242)
+# define Qvertical_scroll_bar builtin_lisp_symbol (1243)
+# define Qvertical_scroll_bars builtin_lisp_symbol (1244)
+# define Qvisibility builtin_lisp_symbol (1245)
+# define Qvisible builtin_lisp_symbol (1246)
+# define Qvisual builtin_lisp_symbol (1247)
+# define Qvoid_function builtin_lisp_symbol (1248)
+# define Qvoid_variable builtin_lisp_symbol (1249)
+# define Qvsize builtin_lisp_symbol (1250)
+# define Qw32 builtin_lisp_symbol (1251)
+# define Qwait_for_wm builtin_lisp_symbol (1252)
+# define Qwall builtin_lisp_symbol (1253)
+# define Qwatchers builtin_lisp_symbol (1254)
+# define Qwave builtin_lisp_symbol (1255)
+# define Qweakness builtin_lisp_symbol (1256)
+# define Qwhen builtin_lisp_symbol (1257)
+# define Qwholenump builtin_lisp_symbol (1258)
+# define Qwidget_type builtin_lisp_symbol (1259)
+# define Qwidth builtin_lisp_symbol (1260)
+# define Qwidth_only builtin_lisp_symbol (1261)
+# define Qwindow builtin_lisp_symbol (1262)
+# define Qwindow__pixel_to_total builtin_lisp_symbol (1263)
+# define Qwindow__resize_mini_frame builtin_lisp_symbol (1264)
+# define Qwindow__resize_root_window builtin_lisp_symbol (1265)
+# define Qwindow__resize_root_window_vertically builtin_lisp_symbol (1266)
+# define Qwindow_buffer_change_functions builtin_lisp_symbol (1267)
+# define Qwindow_configuration builtin_lisp_symbol (1268)
+# define Qwindow_configuration_change_hook builtin_lisp_symbol (1269)
+# define Qwindow_configuration_p builtin_lisp_symbol (1270)
+# define Qwindow_deletable_p builtin_lisp_symbol (1271)
+# define Qwindow_divider builtin_lisp_symbol (1272)
+# define Qwindow_divider_first_pixel builtin_lisp_symbol (1273)
+# define Qwindow_divider_last_pixel builtin_lisp_symbol (1274)
+# define Qwindow_edges builtin_lisp_symbol (1275)
+# define Qwindow_id builtin_lisp_symbol (1276)
+# define Qwindow_live_p builtin_lisp_symbol (1277)
+# define Qwindow_point_insertion_type builtin_lisp_symbol (1278)
+# define Qwindow_scroll_functions builtin_lisp_symbol (1279)
+# define Qwindow_selection_change_functions builtin_lisp_symbol (1280)
+# define Qwindow_size builtin_lisp_symbol (1281)
+# define Qwindow_size_change_functions builtin_lisp_symbol (1282)
+# define Qwindow_state_change_functions builtin_lisp_symbol (1283)
+# define Qwindow_state_change_hook builtin_lisp_symbol (1284)
+# define Qwindow_valid_p builtin_lisp_symbol (1285)
+# define Qwindowp builtin_lisp_symbol (1286)
+# define Qworkarea builtin_lisp_symbol (1287)
+# define Qwrap_prefix builtin_lisp_symbol (1288)
+# define Qwrite_region builtin_lisp_symbol (1289)
+# define Qwrite_region_annotate_functions builtin_lisp_symbol (1290)
+# define Qwrong_length_argument builtin_lisp_symbol (1291)
+# define Qwrong_number_of_arguments builtin_lisp_symbol (1292)
+# define Qwrong_register_subr_call builtin_lisp_symbol (1293)
+# define Qwrong_type_argument builtin_lisp_symbol (1294)
+# define Qx builtin_lisp_symbol (1295)
+# define Qx_create_frame_1 builtin_lisp_symbol (1296)
+# define Qx_create_frame_2 builtin_lisp_symbol (1297)
+# define Qx_frame_parameter builtin_lisp_symbol (1298)
+# define Qx_pre_popup_menu_hook builtin_lisp_symbol (1299)
+# define Qx_resource_name builtin_lisp_symbol (1300)
+# define Qx_set_menu_bar_lines builtin_lisp_symbol (1301)
+# define Qx_set_window_size_1 builtin_lisp_symbol (1302)
+# define Qxg_frame_set_char_size builtin_lisp_symbol (1303)
+# define Qxterm__set_selection builtin_lisp_symbol (1304)
+# define Qxterm_select_active_regions builtin_lisp_symbol (1305)
+# define Qxwidget builtin_lisp_symbol (1306)
+# define Qxwidget_display_event builtin_lisp_symbol (1307)
+# define Qxwidget_event builtin_lisp_symbol (1308)
+# define Qxwidget_view builtin_lisp_symbol (1309)
+# define Qyes_or_no_p_history builtin_lisp_symbol (1310)
+# define Qz_group builtin_lisp_symbol (1311)
+# define Qzero_width builtin_lisp_symbol (1312)
+#endif
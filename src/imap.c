@@ -0,0 +1,123 @@
+/* Scanning IMAP server responses.
+
+Copyright (C) 2024 Free Software Foundation, Inc.
+
+This file is NOT part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* An IMAP response line may carry literals: a line that ends in {N}
+   is followed by N octets of data, after which the response line
+   goes on.  nnimap used to find the end of a response by searching
+   the whole process buffer backwards with regexps each time more
+   output arrived, which also took lines inside literals for response
+   lines.  Here the responses are walked forward one at a time,
+   skipping literals by their length, so that nnimap can resume where
+   it stopped.  */
+
+#include <config.h>
+
+#include <c-ctype.h>
+
+#include "lisp.h"
+#include "character.h"
+#include "buffer.h"
+
+/* Return the byte position of the first newline at or after FROM and
+   before TO in the current buffer, or -1 if there is none.  */
+
+static ptrdiff_t
+find_newline_byte (ptrdiff_t from, ptrdiff_t to)
+{
+  if (from < GPT_BYTE)
+    {
+      ptrdiff_t stop = min (to, GPT_BYTE);
+      unsigned char *p = BYTE_POS_ADDR (from);
+      unsigned char *nl = memchr (p, '\n', stop - from);
+      if (nl)
+	return from + (nl - p);
+      from = stop;
+    }
+  if (from < to)
+    {
+      unsigned char *p = BYTE_POS_ADDR (from);
+      unsigned char *nl = memchr (p, '\n', to - from);
+      if (nl)
+	return from + (nl - p);
+    }
+  return -1;
+}
+
+/* Return the length of the literal announced by the line that starts
+   at byte BEG and whose newline is at byte NL, or -1 if the line does
+   not end in {N}.  */
+
+static intmax_t
+literal_length (ptrdiff_t beg, ptrdiff_t nl)
+{
+  ptrdiff_t p = nl;
+  if (p > beg && FETCH_BYTE (p - 1) == '\r')
+    p--;
+  if (!(p > beg && FETCH_BYTE (p - 1) == '}'))
+    return -1;
+  ptrdiff_t close = --p;
+  while (p > beg && c_isdigit (FETCH_BYTE (p - 1)))
+    p--;
+  if (p == close || !(p > beg && FETCH_BYTE (p - 1) == '{'))
+    return -1;
+
+  intmax_t length = 0;
+  for (; p < close; p++)
+    if (ckd_mul (&length, length, 10)
+	|| ckd_add (&length, length, FETCH_BYTE (p) - '0'))
+      return -1;
+  return length;
+}
+
+DEFUN ("nnimap--response-end", Fnnimap__response_end,
+       Snnimap__response_end, 1, 1, 0,
+       doc: /* Return the end of the IMAP response line that starts at POS.
+That is the position after the newline that ends the line, where the
+next response starts.  The data of literals, announced by a {N} at the
+end of a line, is part of the response line and skipped by its length,
+whatever it contains.  Return nil if the response is not complete yet
+in the accessible portion of the buffer.  */)
+  (Lisp_Object pos)
+{
+  EMACS_INT charpos = fix_position (pos);
+  if (!(BEGV <= charpos && charpos <= ZV))
+    args_out_of_range (pos, Fcurrent_buffer ());
+
+  ptrdiff_t p = CHAR_TO_BYTE (charpos);
+  intmax_t quit_count = 0;
+  for (;;)
+    {
+      rarely_quit (++quit_count);
+      ptrdiff_t nl = find_newline_byte (p, ZV_BYTE);
+      if (nl < 0)
+	return Qnil;
+      intmax_t length = literal_length (p, nl);
+      if (length < 0)
+	return make_fixnum (BYTE_TO_CHAR (nl + 1));
+      if (length > ZV_BYTE - (nl + 1))
+	return Qnil;
+      p = nl + 1 + length;
+    }
+}
+
+void
+syms_of_imap (void)
+{
+  defsubr (&Snnimap__response_end);
+}
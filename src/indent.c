@@ -296,6 +296,136 @@ #define MULTIBYTE_BYTES_WIDTH(p, dp, bytes, width)			\
   } while (0)
 
 
+/* Column checkpoints.
+
+   Finding the column of a position in a long line means scanning from
+   the beginning of the line, which is slow when the line is long and
+   has display properties, invisible text or wide characters.  So
+   scan_for_column records, every COLUMN_CHECKPOINT_INTERVAL characters
+   or so, the column at the places it goes through, and the next scan
+   of the same line starts at the last checkpoint before its goal.  The
+   checkpoints are only good for one line of the buffer as it was when
+   they were recorded, and are thrown away when the text, its
+   properties, the overlays or the way characters are displayed
+   change.  */
+
+enum { COLUMN_CHECKPOINT_INTERVAL = 4096 };
+
+struct column_checkpoint
+{
+  ptrdiff_t pos, bytepos, col;
+  /* Where scan_for_column was next going to look for invisible text.  */
+  ptrdiff_t next_boundary;
+};
+
+struct column_cache
+{
+  /* What the checkpoints depend on.  */
+  modiff_count modiff, overlay_modiff;
+  ptrdiff_t line_start;
+  struct window *w;
+  struct Lisp_Char_Table *dp;
+  int tab_width;
+  bool_bf ctl_arrow : 1;
+  bool_bf selective : 1;
+  bool_bf multibyte : 1;
+
+  /* The farthest place in the line that a scan has got to.  */
+  ptrdiff_t scanned;
+
+  /* The checkpoints, in increasing order of position.  */
+  struct column_checkpoint *checkpoints;
+  ptrdiff_t n, size;
+};
+
+void
+free_column_cache (struct column_cache *cache)
+{
+  xfree (cache->checkpoints);
+  xfree (cache);
+}
+
+/* Return the column cache of the current buffer if it is good for the
+   line starting at LINE_START as displayed in window W, with tab width
+   TAB_WIDTH, CTL_ARROW and display table DP.  Otherwise, if CREATE,
+   return it emptied for that line, and if not, return NULL.  */
+
+static struct column_cache *
+column_cache_for_line (ptrdiff_t line_start, struct window *w,
+		       int tab_width, bool ctl_arrow,
+		       struct Lisp_Char_Table *dp, bool create)
+{
+  struct column_cache *cache = current_buffer->column_cache;
+  bool selective = EQ (BVAR (current_buffer, selective_display), Qt);
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+
+  if (cache
+      && cache->modiff == MODIFF
+      && cache->overlay_modiff == OVERLAY_MODIFF
+      && cache->line_start == line_start
+      && cache->w == w
+      && cache->dp == dp
+      && cache->tab_width == tab_width
+      && cache->ctl_arrow == ctl_arrow
+      && cache->selective == selective
+      && cache->multibyte == multibyte)
+    return cache;
+  if (!create)
+    return NULL;
+
+  if (!cache)
+    {
+      cache = xzalloc (sizeof *cache);
+      current_buffer->column_cache = cache;
+    }
+  cache->modiff = MODIFF;
+  cache->overlay_modiff = OVERLAY_MODIFF;
+  cache->line_start = line_start;
+  cache->w = w;
+  cache->dp = dp;
+  cache->tab_width = tab_width;
+  cache->ctl_arrow = ctl_arrow;
+  cache->selective = selective;
+  cache->multibyte = multibyte;
+  cache->scanned = line_start;
+  cache->n = 0;
+  return cache;
+}
+
+/* Return the last checkpoint in CACHE before END whose column is less
+   than GOAL, or NULL if there is none.  */
+
+static struct column_checkpoint *
+find_column_checkpoint (struct column_cache *cache, ptrdiff_t end,
+			EMACS_INT goal)
+{
+  /* Both positions and columns increase along the line.  */
+  ptrdiff_t lo = 0, hi = cache->n;
+  while (lo < hi)
+    {
+      ptrdiff_t mid = lo + (hi - lo) / 2;
+      struct column_checkpoint *cp = &cache->checkpoints[mid];
+      if (cp->pos < end && cp->col < goal)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo > 0 ? &cache->checkpoints[lo - 1] : NULL;
+}
+
+static void
+add_column_checkpoint (struct column_cache *cache, ptrdiff_t pos,
+		       ptrdiff_t bytepos, ptrdiff_t col,
+		       ptrdiff_t next_boundary)
+{
+  if (cache->n == cache->size)
+    cache->checkpoints = xpalloc (cache->checkpoints, &cache->size, 1, -1,
+				  sizeof *cache->checkpoints);
+  cache->checkpoints[cache->n++]
+    = (struct column_checkpoint) { pos, bytepos, col, next_boundary };
+}
+
+
 DEFUN ("current-column", Fcurrent_column, Scurrent_column, 0, 0, 0,
        doc: /* Return the horizontal position of point.  Beginning of line is column 0.
 This is calculated by adding together the widths of all the displayed
@@ -329,7 +459,7 @@ current_column (void)
   ptrdiff_t col;
   unsigned char *ptr, *stop;
   bool tab_seen;
-  ptrdiff_t post_tab;
+  ptrdiff_t post_tab, scanned = 0;
   int c;
   int tab_width = SANE_TAB_WIDTH (current_buffer);
   bool ctl_arrow = !NILP (BVAR (current_buffer, ctl_arrow));
@@ -346,6 +476,13 @@ current_column (void)
       || Z != Z_BYTE)
     return current_column_1 ();
 
+  /* Likewise far into a long line that has checkpoints.  */
+  struct column_cache *cache = current_buffer->column_cache;
+  if (cache && cache->modiff == MODIFF
+      && cache->line_start + COLUMN_CHECKPOINT_INTERVAL <= PT
+      && PT <= cache->scanned)
+    return current_column_1 ();
+
   /* Scan backwards from point to the previous newline,
      counting width.  Tab characters are the only complicated case.  */
 
@@ -367,6 +504,11 @@ current_column (void)
       ptrdiff_t i, n;
       Lisp_Object charvec;
 
+      /* In a long line, scan forward instead, recording checkpoints
+	 for the next time.  */
+      if (++scanned > 4 * COLUMN_CHECKPOINT_INTERVAL)
+	return current_column_1 ();
+
       if (ptr == stop)
 	{
 	  /* We stopped either for the beginning of the buffer
@@ -552,18 +694,50 @@ scan_for_column (ptrdiff_t *endpos, EMACS_INT *goalcol,
   EMACS_INT goal = goalcol ? *goalcol : MOST_POSITIVE_FIXNUM;
   ptrdiff_t end = endpos ? *endpos : PT;
   ptrdiff_t scan, scan_byte, next_boundary, prev_pos, prev_bpos;
+  ptrdiff_t line_start, next_checkpoint;
+  struct column_cache *cache;
+  modiff_count modiff = MODIFF, overlay_modiff = OVERLAY_MODIFF;
+  bool end_independent = true;
 
   scan = find_newline (PT, PT_BYTE, BEGV, BEGV_BYTE, -1, NULL, &scan_byte, 1);
-  next_boundary = scan;
-  prev_pos = scan;
-  prev_bpos = scan_byte;
+  line_start = scan;
 
   window = Fget_buffer_window (Fcurrent_buffer (), Qnil);
   w = !NILP (window) ? XWINDOW (window) : NULL;
 
   memset (&cmp_it, 0, sizeof cmp_it);
   cmp_it.id = -1;
-  composition_compute_stop_pos (&cmp_it, scan, scan_byte, end, Qnil);
+
+  /* Start instead at the last checkpoint before the goal, if any,
+     unless a composition starts before it and goes past it.  */
+  cache = column_cache_for_line (line_start, w, tab_width, ctl_arrow, dp,
+				 false);
+  next_checkpoint = line_start + COLUMN_CHECKPOINT_INTERVAL;
+  next_boundary = line_start;
+  if (cache)
+    {
+      struct column_checkpoint *cp
+	= find_column_checkpoint (cache, end, goal);
+      if (cache->n > 0)
+	next_checkpoint = (cache->checkpoints[cache->n - 1].pos
+			   + COLUMN_CHECKPOINT_INTERVAL);
+      if (cp)
+	{
+	  composition_compute_stop_pos (&cmp_it, cp->pos, cp->bytepos, end,
+					Qnil);
+	  if (cmp_it.stop_pos >= cp->pos)
+	    {
+	      scan = cp->pos;
+	      scan_byte = cp->bytepos;
+	      col = prev_col = cp->col;
+	      next_boundary = cp->next_boundary;
+	    }
+	}
+    }
+  prev_pos = scan;
+  prev_bpos = scan_byte;
+  if (scan == line_start)
+    composition_compute_stop_pos (&cmp_it, scan, scan_byte, end, Qnil);
 
   /* Scan forward to the target position.  */
   while (scan < end)
@@ -577,6 +751,10 @@ scan_for_column (ptrdiff_t *endpos, EMACS_INT *goalcol,
 	  /* This updates NEXT_BOUNDARY to the next place
 	     where we might need to skip more invisible text.  */
 	  scan = skip_invisible (scan, &next_boundary, end, Qnil);
+	  /* skip_invisible looks at END only within 100 characters of
+	     it, and then sets NEXT_BOUNDARY no farther than that.  */
+	  if (end <= old_scan + 100 && next_boundary <= old_scan + 100)
+	    end_independent = false;
 	  if (scan != old_scan)
 	    scan_byte = CHAR_TO_BYTE (scan);
 	  if (scan >= end)
@@ -597,6 +775,21 @@ scan_for_column (ptrdiff_t *endpos, EMACS_INT *goalcol,
       prev_pos = scan;
       prev_bpos = scan_byte;
 
+      /* Record a checkpoint, if the state of the scan is what it
+	 would be for any END.  */
+      if (scan >= next_checkpoint && cmp_it.id < 0 && scan < cmp_it.stop_pos
+	  && end_independent
+	  && modiff == MODIFF && overlay_modiff == OVERLAY_MODIFF)
+	{
+	  /* Look the cache up again, as Lisp code run for compositions
+	     may have done anything to it.  */
+	  cache = column_cache_for_line (line_start, w, tab_width, ctl_arrow,
+					 dp, true);
+	  if (cache->n == 0 || cache->checkpoints[cache->n - 1].pos < scan)
+	    add_column_checkpoint (cache, scan, scan_byte, col, next_boundary);
+	  next_checkpoint = scan + COLUMN_CHECKPOINT_INTERVAL;
+	}
+
       { /* Check display property.  */
 	ptrdiff_t endp;
 	int width = check_display_width (scan, col, &endp);
@@ -717,6 +910,11 @@ scan_for_column (ptrdiff_t *endpos, EMACS_INT *goalcol,
     }
  endloop:
 
+  cache = column_cache_for_line (line_start, w, tab_width, ctl_arrow, dp,
+				 false);
+  if (cache && cache->scanned < scan)
+    cache->scanned = scan;
+
   last_known_column = col;
   last_known_column_point = PT;
   last_known_column_modified = MODIFF;
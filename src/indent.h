@@ -57,4 +57,8 @@ #define EMACS_INDENT_H
 void recompute_width_table (struct buffer *buf,
                             struct Lisp_Char_Table *disptab);
 
+/* Free the column checkpoints CACHE of a buffer.  */
+struct column_cache;
+void free_column_cache (struct column_cache *cache);
+
 #endif /* EMACS_INDENT_H */
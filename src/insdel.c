@@ -314,6 +314,7 @@ anchor_gap (void)
 void
 move_gap (ptrdiff_t charpos, ptrdiff_t bytepos)
 {
+  buffer_text_write_lock (current_buffer);
   BUF_COMPUTE_UNCHANGED (current_buffer, charpos, GPT);
   if (bytepos < GPT_BYTE)
     {
@@ -345,10 +346,14 @@ make_gap_larger (ptrdiff_t nbytes_added)
   if (BUF_BYTES_MAX - current_size < nbytes_added)
     buffer_overflow ();
 
-  /* If we have to get more space, get enough to last a while;
-     but do not exceed the maximum buffer size.  */
-  nbytes_added = min (nbytes_added + GAP_BYTES_DFL,
-		      BUF_BYTES_MAX - current_size);
+  /* If we have to get more space, get enough to last a while: an
+     eighth of the text, so that a buffer that keeps growing is
+     enlarged only a logarithmic number of times, but at least
+     GAP_BYTES_DFL and at most GAP_BYTES_MAX bytes.  Do not exceed
+     the maximum buffer size.  */
+  nbytes_added += min (clip_to_bounds (GAP_BYTES_DFL, current_size / 8,
+				       GAP_BYTES_MAX),
+		       BUF_BYTES_MAX - current_size - nbytes_added);
 
   enlarge_buffer_text (current_buffer, nbytes_added);
 
@@ -431,6 +436,7 @@ make_gap_smaller (ptrdiff_t nbytes_removed)
 void
 make_gap (ptrdiff_t nbytes_added)
 {
+  buffer_text_write_lock (current_buffer);
   if (nbytes_added >= 0)
     /* With set-buffer-multibyte on a large buffer, we can end up growing the
      * buffer *many* times.  Avoid an O(N^2) behavior by increasing by an
@@ -780,6 +786,7 @@ insert_1_both (const char *string,
        or make it smaller.  */
     prepare_to_modify_buffer (PT, PT, NULL);
 
+  buffer_text_write_lock (current_buffer);
   if (PT != GPT)
     move_gap (PT, PT_BYTE);
   if (GAP_SIZE < nbytes)
@@ -905,6 +912,7 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
+  buffer_text_write_lock (current_buffer);
   if (PT != GPT)
     move_gap (PT, PT_BYTE);
   if (GAP_SIZE < outgoing_nbytes)
@@ -985,6 +993,7 @@ insert_from_gap_1 (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
   eassert (NILP (BVAR (current_buffer, enable_multibyte_characters))
            ? nchars == nbytes : nchars <= nbytes);
 
+  buffer_text_write_lock (current_buffer);
   GAP_SIZE -= nbytes;
   if (!text_at_gap_tail)
     {
@@ -1005,8 +1014,9 @@ insert_from_gap_1 (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
    starting at GAP_END_ADDR - NBYTES (if text_at_gap_tail) and at
    GAP_BEG_ADDR (if not text_at_gap_tail).  */
 
-void
-insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
+static void
+insert_from_gap_2 (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail,
+		   bool before_markers)
 {
   ptrdiff_t ins_charpos = GPT, ins_bytepos = GPT_BYTE;
 
@@ -1022,10 +1032,15 @@ insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
+  if (before_markers)
+    detect_bidi (current_buffer,
+		 text_at_gap_tail ? GAP_END_ADDR - nbytes : GAP_BEG_ADDR, nbytes);
+
   insert_from_gap_1 (nchars, nbytes, text_at_gap_tail);
 
   adjust_markers_for_insert (ins_charpos, ins_bytepos,
-			     ins_charpos + nchars, ins_bytepos + nbytes, false);
+			     ins_charpos + nchars, ins_bytepos + nbytes,
+			     before_markers);
 
   if (buffer_intervals (current_buffer))
     {
@@ -1039,12 +1054,29 @@ insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
 			     ins_charpos + nchars);
 #endif
 
-  if (ins_charpos < PT)
+  if (ins_charpos < PT || (before_markers && ins_charpos == PT))
     adjust_point (nchars, nbytes);
 
   check_markers ();
 }
 
+void
+insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
+{
+  insert_from_gap_2 (nchars, nbytes, text_at_gap_tail, false);
+}
+
+/* Like insert_from_gap except all markers at the insertion point are
+   adjusted to point after it, and so is point.  Process output uses
+   this to be decoded directly into the buffer.  */
+
+void
+insert_from_gap_before_markers (ptrdiff_t nchars, ptrdiff_t nbytes,
+				bool text_at_gap_tail)
+{
+  insert_from_gap_2 (nchars, nbytes, text_at_gap_tail, true);
+}
+
 /* Insert text from BUF, NCHARS characters starting at CHARPOS, into the
    current buffer.  If the text in BUF has properties, they are absorbed
    into the current buffer.
@@ -1113,6 +1145,7 @@ insert_from_buffer_1 (struct buffer *buf,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
+  buffer_text_write_lock (current_buffer);
   if (PT != GPT)
     move_gap (PT, PT_BYTE);
   if (GAP_SIZE < outgoing_nbytes)
@@ -1221,6 +1254,7 @@ adjust_after_replace (ptrdiff_t from, ptrdiff_t from_byte,
     emacs_abort ();
 #endif
 
+  buffer_text_write_lock (current_buffer);
   if (STRINGP (prev_text))
     {
       nchars_del = SCHARS (prev_text);
@@ -1278,6 +1312,7 @@ adjust_after_insert (ptrdiff_t from, ptrdiff_t from_byte,
 {
   ptrdiff_t len = to - from, len_byte = to_byte - from_byte;
 
+  buffer_text_write_lock (current_buffer);
   if (GPT != to)
     move_gap (to, to_byte);
   GAP_SIZE += len_byte;
@@ -1328,6 +1363,8 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
       to = from + range_length;
     }
 
+  buffer_text_write_lock (current_buffer);
+
   /* Make args be valid.  */
   if (from < BEGV)
     from = BEGV;
@@ -1497,6 +1534,7 @@ replace_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 #endif
 
   check_markers ();
+  buffer_text_write_lock (current_buffer);
 
   nchars_del = to - from;
   nbytes_del = to_byte - from_byte;
@@ -1777,6 +1815,7 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 #endif
 
   check_markers ();
+  buffer_text_write_lock (current_buffer);
 
   nchars_del = to - from;
   nbytes_del = to_byte - from_byte;
@@ -1853,6 +1892,7 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 modify_text (ptrdiff_t start, ptrdiff_t end)
 {
   prepare_to_modify_buffer (start, end, NULL);
+  buffer_text_write_lock (current_buffer);
 
   BUF_COMPUTE_UNCHANGED (current_buffer, start - 1, end);
   if (MODIFF <= SAVE_MODIFF)
@@ -1836,6 +1836,14 @@ set_point_both (ptrdiff_t charpos, ptrdiff_t bytepos)
      whether or not there are intervals in the buffer.  */
   eassert (charpos <= ZV && charpos >= BEGV);
 
+  /* Uncooperative threads look at neither text properties nor
+     overlays, see buffer_text_read_lock.  */
+  if (!current_thread->cooperative)
+    {
+      temp_set_point_both (current_buffer, charpos, bytepos);
+      return;
+    }
+
   have_overlays = buffer_has_overlays ();
 
   /* If we have no text properties and overlays,
@@ -463,7 +463,9 @@ #define ENUM_BF(TYPE) enum TYPE
 
 /* Defined in chartab.c.  */
 extern Lisp_Object char_table_ref (Lisp_Object, int) ATTRIBUTE_PURE;
+extern Lisp_Object char_table_ref_flat (Lisp_Object, int);
 extern void char_table_set (Lisp_Object, int, Lisp_Object);
+extern EMACS_UINT chartab_tick;
 
 /* Defined in data.c.  */
 extern AVOID args_out_of_range_3 (Lisp_Object, Lisp_Object, Lisp_Object);
@@ -944,6 +946,9 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_THREAD,
   PVEC_MUTEX,
   PVEC_CONDVAR,
+  PVEC_CHANNEL,
+  PVEC_THREAD_POOL,
+  PVEC_FUTURE,
   PVEC_MODULE_FUNCTION,
   PVEC_NATIVE_COMP_UNIT,
   PVEC_SQLITE,
@@ -1188,6 +1193,9 @@ #define XSETSUB_CHAR_TABLE(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_SUB_CHAR_TABLE))
 #define XSETTHREAD(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_THREAD))
 #define XSETMUTEX(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_MUTEX))
 #define XSETCONDVAR(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_CONDVAR))
+#define XSETCHANNEL(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_CHANNEL))
+#define XSETTHREAD_POOL(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_THREAD_POOL))
+#define XSETFUTURE(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_FUTURE))
 #define XSETNATIVE_COMP_UNIT(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_NATIVE_COMP_UNIT))
 #define XSETTREE_SITTER(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_TREE_SITTER))
 #define XSETTREE_SITTER_NODE(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_TREE_SITTER_NODE))
@@ -1882,6 +1890,17 @@ CHAR_TABLE_REF (Lisp_Object ct, int idx)
 	  : char_table_ref (ct, idx));
 }
 
+/* Like CHAR_TABLE_REF, but for tables looked up once per character
+   by scanning loops, e.g., syntax tables.  Non-ASCII characters are
+   looked up in a flattened copy of CT.  */
+INLINE Lisp_Object
+CHAR_TABLE_REF_FLAT (Lisp_Object ct, int idx)
+{
+  return (ASCII_CHAR_P (idx)
+	  ? CHAR_TABLE_REF_ASCII (ct, idx)
+	  : char_table_ref_flat (ct, idx));
+}
+
 /* Equivalent to Faset (CT, IDX, VAL) with optimization for ASCII and
    8-bit European characters.  Does not check validity of CT.  */
 INLINE void
@@ -3074,9 +3093,14 @@ #define MALLOC_SIZE_NEAR(n) \
   /* See free_slot() for sizing rationale.  */
   VBLOCK_NFREE_LISTS = 1 + (LARGE_VECTOR_THRESH - LISP_VECTOR_MIN) / word_size,
 
+  /* Size classes of `struct sblock`.  Small and medium strings are
+     packed into sblocks of their class, larger ones get their own.  */
   SBLOCK_NBITS = 13,
   SBLOCK_NBYTES = MALLOC_SIZE_NEAR(1 << SBLOCK_NBITS),
-  LARGE_STRING_THRESH = (SBLOCK_NBYTES >> 3),
+  SMALL_STRING_THRESH = (SBLOCK_NBYTES >> 3),
+  MEDIUM_SBLOCK_NBITS = 17,
+  MEDIUM_SBLOCK_NBYTES = MALLOC_SIZE_NEAR(1 << MEDIUM_SBLOCK_NBITS),
+  LARGE_STRING_THRESH = (MEDIUM_SBLOCK_NBYTES >> 3),
 };
 
 #include "thread.h"
@@ -3523,6 +3547,7 @@ set_string_intervals (Lisp_Object s, INTERVAL i)
 set_char_table_defalt (Lisp_Object table, Lisp_Object val)
 {
   XCHAR_TABLE (table)->defalt = val;
+  ++chartab_tick;
 }
 INLINE void
 set_char_table_purpose (Lisp_Object table, Lisp_Object val)
@@ -3544,12 +3569,14 @@ set_char_table_contents (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 {
   eassert (0 <= idx && idx < (1 << CHARTAB_SIZE_BITS_0));
   XCHAR_TABLE (table)->contents[idx] = val;
+  ++chartab_tick;
 }
 
 INLINE void
 set_sub_char_table_contents (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 {
   XSUB_CHAR_TABLE (table)->contents[idx] = val;
+  ++chartab_tick;
 }
 
 /* Defined in bignum.c.  This part of bignum.c's API does not require
@@ -3742,7 +3769,8 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 extern void mark_fns (void);
 
 /* Defined in sort.c  */
-extern void tim_sort (Lisp_Object, Lisp_Object *, const ptrdiff_t);
+extern void tim_sort (Lisp_Object, Lisp_Object, Lisp_Object *,
+		      const ptrdiff_t);
 
 /* Defined in floatfns.c.  */
 verify (FLT_RADIX == 2 || FLT_RADIX == 16);
@@ -3789,6 +3817,8 @@ verify (FLT_RADIX == 2 || FLT_RADIX == 16);
 			   bool, bool, bool);
 extern void insert_from_gap_1 (ptrdiff_t, ptrdiff_t, bool text_at_gap_tail);
 extern void insert_from_gap (ptrdiff_t, ptrdiff_t, bool text_at_gap_tail);
+extern void insert_from_gap_before_markers (ptrdiff_t, ptrdiff_t,
+					    bool text_at_gap_tail);
 extern void insert_from_string (Lisp_Object, ptrdiff_t, ptrdiff_t,
 				ptrdiff_t, ptrdiff_t, bool);
 extern void insert_from_buffer (struct buffer *, ptrdiff_t, ptrdiff_t, bool);
@@ -3899,6 +3929,7 @@ mark_automatic_object (Lisp_Object obj)
 
 extern void with_flushed_stack (void (*func) (void *arg), void *arg);
 extern bool garbage_collect (void);
+extern void finish_sweeps (void);
 extern Lisp_Object zero_vector;
 extern Lisp_Object Vmemory_full;
 extern PER_THREAD EMACS_INT bytes_since_gc;
@@ -4437,6 +4468,18 @@ fast_string_match_ignore_case (Lisp_Object regexp, Lisp_Object string)
 
 extern void syms_of_callint (void);
 
+/* Defined in ansi.c.  */
+
+extern void syms_of_ansi (void);
+
+/* Defined in nov.c.  */
+
+extern void syms_of_nov (void);
+
+/* Defined in imap.c.  */
+
+extern void syms_of_imap (void);
+
 /* Defined in casefiddle.c.  */
 
 extern void syms_of_casefiddle (void);
@@ -30,12 +30,17 @@
 #include "buffer.h"
 
 /* Record one cached position found recently by
-   buf_charpos_to_bytepos or buf_bytepos_to_charpos.  */
-
-static ptrdiff_t cached_charpos;
-static ptrdiff_t cached_bytepos;
-static struct buffer *cached_buffer;
-static modiff_count cached_modiff;
+   buf_charpos_to_bytepos or buf_bytepos_to_charpos.  Uncooperative
+   threads convert positions alongside the global lock holder, so each
+   thread has its own, which clear_charpos_cache cannot reach; it bumps
+   charpos_cache_generation instead.  */
+
+PER_THREAD_STATIC ptrdiff_t cached_charpos;
+PER_THREAD_STATIC ptrdiff_t cached_bytepos;
+PER_THREAD_STATIC struct buffer *cached_buffer;
+PER_THREAD_STATIC modiff_count cached_modiff;
+PER_THREAD_STATIC EMACS_UINT cached_generation;
+static EMACS_UINT charpos_cache_generation;
 
 /* Juanma Barranquero <lekktu@gmail.com> reported ~3x increased
    bootstrap time when byte_char_debug_check is enabled; so this
@@ -79,6 +84,16 @@ clear_charpos_cache (struct buffer *b)
 {
   if (cached_buffer == b)
     cached_buffer = 0;
+  charpos_cache_generation++;
+}
+
+/* Return true if the cached position is one in B.  */
+
+static bool
+charpos_cache_valid_p (struct buffer *b)
+{
+  return (b == cached_buffer && BUF_MODIFF (b) == cached_modiff
+	  && cached_generation == charpos_cache_generation);
 }
 
 /* Converting between character positions and byte positions.  */
@@ -193,15 +208,25 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
      two best approximations is all single-byte,
      we interpolate the result immediately.  */
 
-  CONSIDER (BUF_PT (b), BUF_PT_BYTE (b));
+  /* The global lock holder moves point, narrows and sets markers
+     without taking the text, so an uncooperative thread could see one
+     half of such a pair updated and not the other.  Nor do those
+     threads record positions in markers.  */
+  bool cooperative = current_thread->cooperative;
+
+  if (cooperative)
+    CONSIDER (BUF_PT (b), BUF_PT_BYTE (b));
   CONSIDER (BUF_GPT (b), BUF_GPT_BYTE (b));
-  CONSIDER (BUF_BEGV (b), BUF_BEGV_BYTE (b));
-  CONSIDER (BUF_ZV (b), BUF_ZV_BYTE (b));
+  if (cooperative)
+    {
+      CONSIDER (BUF_BEGV (b), BUF_BEGV_BYTE (b));
+      CONSIDER (BUF_ZV (b), BUF_ZV_BYTE (b));
+    }
 
-  if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
+  if (charpos_cache_valid_p (b))
     CONSIDER (cached_charpos, cached_bytepos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  for (tail = cooperative ? BUF_MARKERS (b) : NULL; tail; tail = tail->next)
     {
       CONSIDER (tail->charpos, tail->bytepos);
 
@@ -233,13 +258,14 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
       /* If this position is quite far from the nearest known position,
 	 cache the correspondence by creating a marker here.
 	 It will last until the next GC.  */
-      if (record)
+      if (record && cooperative)
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
 
       cached_buffer = b;
       cached_modiff = BUF_MODIFF (b);
+      cached_generation = charpos_cache_generation;
       cached_charpos = best_below;
       cached_bytepos = best_below_byte;
 
@@ -258,13 +284,14 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
       /* If this position is quite far from the nearest known position,
 	 cache the correspondence by creating a marker here.
 	 It will last until the next GC.  */
-      if (record)
+      if (record && cooperative)
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
 
       cached_buffer = b;
       cached_modiff = BUF_MODIFF (b);
+      cached_generation = charpos_cache_generation;
       cached_charpos = best_above;
       cached_bytepos = best_above_byte;
 
@@ -345,15 +372,22 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
   best_below = BEG;
   best_below_byte = BEG_BYTE;
 
-  CONSIDER (BUF_PT_BYTE (b), BUF_PT (b));
+  /* See buf_charpos_to_bytepos.  */
+  bool cooperative = current_thread->cooperative;
+
+  if (cooperative)
+    CONSIDER (BUF_PT_BYTE (b), BUF_PT (b));
   CONSIDER (BUF_GPT_BYTE (b), BUF_GPT (b));
-  CONSIDER (BUF_BEGV_BYTE (b), BUF_BEGV (b));
-  CONSIDER (BUF_ZV_BYTE (b), BUF_ZV (b));
+  if (cooperative)
+    {
+      CONSIDER (BUF_BEGV_BYTE (b), BUF_BEGV (b));
+      CONSIDER (BUF_ZV_BYTE (b), BUF_ZV (b));
+    }
 
-  if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
+  if (charpos_cache_valid_p (b))
     CONSIDER (cached_bytepos, cached_charpos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  for (tail = cooperative ? BUF_MARKERS (b) : NULL; tail; tail = tail->next)
     {
       CONSIDER (tail->bytepos, tail->charpos);
 
@@ -386,13 +420,14 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	 It will last until the next GC.
 	 But don't do it if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && cooperative && BUF_MARKERS (b))
 	build_marker (b, best_below, best_below_byte);
 
       byte_char_debug_check (b, best_below, best_below_byte);
 
       cached_buffer = b;
       cached_modiff = BUF_MODIFF (b);
+      cached_generation = charpos_cache_generation;
       cached_charpos = best_below;
       cached_bytepos = best_below_byte;
 
@@ -413,13 +448,14 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 	 It will last until the next GC.
 	 But don't do it if BUF_MARKERS is nil;
 	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
+      if (record && cooperative && BUF_MARKERS (b))
 	build_marker (b, best_above, best_above_byte);
 
       byte_char_debug_check (b, best_above, best_above_byte);
 
       cached_buffer = b;
       cached_modiff = BUF_MODIFF (b);
+      cached_generation = charpos_cache_generation;
       cached_charpos = best_above;
       cached_bytepos = best_above_byte;
 
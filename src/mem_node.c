@@ -4,392 +4,223 @@
 /* Conservative stack scanning (mark_maybe_pointer) needs to
    trace an arbitrary address back to its respective memory block.
 
-   To make these searches efficient, new blocks are stored in a global
-   red-black tree which is "fixed" after every insertion or deletion
-   such that:
-
-   1. Every node is either red or black.
-   2. Every leaf is black.
-   3. If a node is red, then both its children are black.
-   4. Every simple path from a node to a descendant leaf contains
-      the same number of black nodes.
-   5. The root is always black.
-
-   These invariants balance the tree so that its height can be no
-   greater than 2 log(N+1), where N is the number of internal nodes.
-   Searches, insertions and deletions are done in O(log N).
+   To make these searches O(1) irrespective of thread count, blocks
+   are registered in a global two-level page map.  The address space
+   is cut into granules of 1 << MEM_GRANULE_BITS bytes, and granules
+   into leaves of 1 << MEM_LEAF_BITS bytes.  Each granule records
+   the block covering its first byte, and the block, if any, starting
+   past its first byte.  Since no block is smaller than a granule,
+   these two slots suffice to resolve any address within it.
+
+   Leaves are looked up by their address bits in an open-addressed
+   hash table rather than a flat array, so that 64-bit address spaces
+   of any width are covered.  Leaves are never freed; being calloc'd,
+   only the parts covering live blocks get paged in.
+
+   Uncooperative threads allocate without the global lock, so changes
+   to the map are made under mem_mutex.  Lookups take no lock: they
+   read whichever table is current, and a table outgrown by another is
+   kept rather than freed, since a lookup may still be walking it.
+   Each table is at least twice the size of the one before, so the
+   kept tables cost less than the current one.
   */
 
-static struct mem_node _mem_nil;
-struct mem_node *mem_nil = &_mem_nil;
-
-static void mem_insert_fixup (struct mem_node *, struct mem_node **root);
-static void mem_delete_fixup (struct mem_node *, struct mem_node **root);
-static void mem_rotate_left (struct mem_node *, struct mem_node **root);
-static void mem_rotate_right (struct mem_node *, struct mem_node **root);
-
-struct mem_node *
-mem_find (struct thread_state *thr, void *start)
+enum
 {
-  struct mem_node *p = THREAD_FIELD (thr, m_mem_root);
-  while (p != mem_nil)
-    {
-      if (start < p->start)
-	p = p->left;
-      else if (start >= p->end)
-	p = p->right;
-      else
-	break;
-    }
-  return p;
-}
+  MEM_LEAF_BITS = 24,
+  MEM_LEAF_NGRANULES = 1 << (MEM_LEAF_BITS - MEM_GRANULE_BITS),
+};
 
-struct mem_node *
-mem_find_which_thread (const void *start, struct thread_state **which)
+struct mem_granule
 {
-  struct mem_node *p = mem_nil;
-  for (struct thread_state *thr = all_threads;
-       thr != NULL && p == mem_nil;
-       thr = thr->next_thread)
-    {
-      p = thr->m_mem_root;
-      while (p != mem_nil)
-	{
-	  if (start < p->start)
-	    p = p->left;
-	  else if (start >= p->end)
-	    p = p->right;
-	  else
-	    {
-	      if (which)
-		*which = thr;
-	      break;
-	    }
-	}
-    }
-  return p;
-}
+  /* Block covering the granule's first byte.  */
+  struct mem_node *first;
 
-/* Destroy tree at ROOT.  */
+  /* Block starting past the granule's first byte.  */
+  struct mem_node *start;
+};
 
-void
-mem_delete_root (struct mem_node **root)
+struct mem_leaf
 {
-  if (*root == mem_nil)
-    return;
-  mem_delete_root (&((*root)->left));
-  mem_delete_root (&((*root)->right));
-  mem_delete (*root, root);
-}
-
-/* Merge FROM into INTO.  */
+  uintptr_t key;
+  struct mem_granule granules[MEM_LEAF_NGRANULES];
+};
 
-void
-mem_merge_into (struct mem_node **into, struct mem_node *from)
+struct mem_leaves
 {
-  if (*into == from || from == mem_nil)
-    return;
-  mem_insert (from->start, from->end, from->type, into);
-  mem_merge_into (into, from->left);
-  mem_merge_into (into, from->right);
-}
+  /* The table this one replaced.  */
+  struct mem_leaves *outgrown;
 
-/* Insert node representing mem block of TYPE spanning START and END.
-   Return the inserted node.  */
+  int bits;
+  struct mem_leaf *slots[FLEXIBLE_ARRAY_MEMBER];
+};
 
-struct mem_node *
-mem_insert (void *start, void *end, enum mem_type type, struct mem_node **root)
-{
-  for (struct mem_node *node = *root, *parent = NULL; ; )
-    {
-      if (node == mem_nil)
-	{
-	  // insert here
-	  struct mem_node *x = xmalloc (sizeof *x);
-	  x->parent = parent;
-	  x->start = start;
-	  x->end = end;
-	  x->type = type;
-	  x->left = x->right = mem_nil;
-	  x->color = MEM_RED;
+static struct mem_leaves *mem_leaves;
+static ptrdiff_t mem_leaves_count;
 
-	  // establish linkages
-	  if (node == *root)
-	    *root = x;
-	  else if (start < parent->start)
-	    parent->left = x;
-	  else
-	    parent->right = x;
+#ifdef HAVE_GCC_TLS
+static sys_mutex_t mem_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
 
-	  mem_insert_fixup (x, root);
-	  return x;
-	}
-      else
-	{
-	  parent = node;
-	  node = start < node->start ? node->left : node->right;
-	}
-    }
-  emacs_abort (); // should have returned by now
-}
+/* Leaf of the most recent lookup by this thread.  */
+PER_THREAD_STATIC struct mem_leaf *mem_last_leaf;
 
-/* Insert node X, then rebalance red-black tree.  X is always red.  */
+static ptrdiff_t
+mem_leaf_hash (uintptr_t key, int bits)
+{
+  return (uint32_t) (key * 2654435761u) >> (32 - bits);
+}
 
 static void
-mem_insert_fixup (struct mem_node *x, struct mem_node **root)
+mem_leaves_put (struct mem_leaves *leaves, struct mem_leaf *leaf)
 {
-  while (x != *root && x->parent->color == MEM_RED)
-    {
-      /* Ensure property 3, if node is red, children black. */
-      if (x->parent == x->parent->parent->left)
-	{
-	  /* X is a left grand-child, and Y is uncle.  */
-	  struct mem_node *y = x->parent->parent->right;
-
-	  if (y->color == MEM_RED)
-	    {
-	      /* Parent and uncle are red.  Change both to black
-		 because X is red.  Then proceed with grandparent.  */
-	      x->parent->color = MEM_BLACK;
-	      y->color = MEM_BLACK;
-	      x->parent->parent->color = MEM_RED;
-	      x = x->parent->parent;
-            }
-	  else
-	    {
-	      /* Parent is red but uncle is black.  */
-	      if (x == x->parent->right)
-		{
-		  /* collapsing a degenerate self-sibling? */
-		  x = x->parent;
-		  mem_rotate_left (x, root);
-                }
-
-	      x->parent->color = MEM_BLACK;
-	      x->parent->parent->color = MEM_RED;
-	      mem_rotate_right (x->parent->parent, root);
-            }
-        }
-      else
-	{
-	  /* Symmetrical where X is right grand-child  */
-	  struct mem_node *y = x->parent->parent->left;
+  ptrdiff_t mask = ((ptrdiff_t) 1 << leaves->bits) - 1;
+  ptrdiff_t i = mem_leaf_hash (leaf->key, leaves->bits);
+  while (leaves->slots[i])
+    i = (i + 1) & mask;
+  leaves->slots[i] = leaf;
+}
 
-	  if (y->color == MEM_RED)
-	    {
-	      x->parent->color = MEM_BLACK;
-	      y->color = MEM_BLACK;
-	      x->parent->parent->color = MEM_RED;
-	      x = x->parent->parent;
-            }
-	  else
-	    {
-	      if (x == x->parent->left)
-		{
-		  x = x->parent;
-		  mem_rotate_right (x, root);
-		}
+/* Return leaf for address bits KEY, or NULL if none.  */
 
-	      x->parent->color = MEM_BLACK;
-	      x->parent->parent->color = MEM_RED;
-	      mem_rotate_left (x->parent->parent, root);
-            }
-        }
-    }
-  (*root)->color = MEM_BLACK;   /* Invariant: root is black.  */
+static struct mem_leaf *
+mem_leaf (uintptr_t key)
+{
+  struct mem_leaf *leaf = mem_last_leaf;
+  if (leaf && leaf->key == key)
+    return leaf;
+  struct mem_leaves *leaves = mem_leaves;
+  if (!leaves)
+    return NULL;
+  ptrdiff_t mask = ((ptrdiff_t) 1 << leaves->bits) - 1;
+  for (ptrdiff_t i = mem_leaf_hash (key, leaves->bits);
+       (leaf = leaves->slots[i]) != NULL;
+       i = (i + 1) & mask)
+    if (leaf->key == key)
+      return mem_last_leaf = leaf;
+  return NULL;
 }
 
-/*   (x)                   (y)
-     / \                   / \
-    a   (y)      ===>    (x)  c
-        / \              / \
-       b   c            a   b  */
+/* Return leaf for address bits KEY, creating it if none.  Call with
+   mem_mutex held.  */
 
-static void
-mem_rotate_left (struct mem_node *x, struct mem_node **root)
+static struct mem_leaf *
+mem_leaf_create (uintptr_t key)
 {
-  struct mem_node *y;
+  struct mem_leaf *leaf = mem_leaf (key);
+  if (leaf)
+    return leaf;
 
-  /* Turn y's left sub-tree into x's right sub-tree.  */
-  y = x->right;
-  x->right = y->left;
-  if (y->left != mem_nil)
-    y->left->parent = x;
+  leaf = xzalloc (sizeof *leaf);
+  leaf->key = key;
 
-  /* Y's parent was x's parent.  */
-  if (y != mem_nil)
-    y->parent = x->parent;
-
-  /* Get the parent to point to y instead of x.  */
-  if (x->parent)
+  struct mem_leaves *old = mem_leaves;
+  int old_bits = old ? old->bits : 0;
+  if (2 * (mem_leaves_count + 1) > (ptrdiff_t) 1 << old_bits)
     {
-      if (x == x->parent->left)
-	x->parent->left = y;
-      else
-	x->parent->right = y;
+      /* Keep the table at most half full.  Fill the new table
+	 before publishing it, and keep the old one for lookups
+	 that may still be walking it.  */
+      int bits = old ? old_bits + 1 : 4;
+      struct mem_leaves *leaves
+	= xzalloc (offsetof (struct mem_leaves, slots)
+		   + (sizeof *leaves->slots << bits));
+      leaves->outgrown = old;
+      leaves->bits = bits;
+      for (ptrdiff_t i = 0; old && i < (ptrdiff_t) 1 << old_bits; ++i)
+	if (old->slots[i])
+	  mem_leaves_put (leaves, old->slots[i]);
+      mem_leaves_put (leaves, leaf);
+      mem_leaves = leaves;
     }
   else
-    *root = y;
-
-  /* Put x on y's left.  */
-  y->left = x;
-  if (x != mem_nil)
-    x->parent = y;
+    mem_leaves_put (mem_leaves, leaf);
+  ++mem_leaves_count;
+  return mem_last_leaf = leaf;
 }
 
-/*     (x)                (Y)
-       / \                / \
-     (y)  c      ===>    a  (x)
-     / \                    / \
-    a   b                  b   c  */
+/* Point the granules spanned by NODE at VAL, which is either NODE
+   itself or NULL.  */
 
 static void
-mem_rotate_right (struct mem_node *x, struct mem_node **root)
+mem_set (struct mem_node *node, struct mem_node *val)
 {
-  struct mem_node *y = x->left;
-
-  x->left = y->right;
-  if (y->right != mem_nil)
-    y->right->parent = x;
+  uintptr_t from = (uintptr_t) node->start;
+  uintptr_t last = ((uintptr_t) node->end - 1) >> MEM_GRANULE_BITS;
+  eassert ((uintptr_t) node->end - from >= 1 << MEM_GRANULE_BITS);
 
-  if (y != mem_nil)
-    y->parent = x->parent;
-  if (x->parent)
+  for (uintptr_t g = from >> MEM_GRANULE_BITS; g <= last; )
     {
-      if (x == x->parent->right)
-	x->parent->right = y;
-      else
-	x->parent->left = y;
+      uintptr_t key = g >> (MEM_LEAF_BITS - MEM_GRANULE_BITS);
+      struct mem_leaf *leaf = val ? mem_leaf_create (key) : mem_leaf (key);
+      eassert (leaf);
+      uintptr_t leaf_last = ((key + 1) << (MEM_LEAF_BITS - MEM_GRANULE_BITS)) - 1;
+      for (; g <= last && g <= leaf_last; ++g)
+	{
+	  struct mem_granule *granule
+	    = &leaf->granules[g & (MEM_LEAF_NGRANULES - 1)];
+	  struct mem_node **slot = (g << MEM_GRANULE_BITS < from
+				    ? &granule->start : &granule->first);
+	  eassert (*slot == (val ? NULL : node));
+	  *slot = val;
+	}
     }
-  else
-    *root = y;
-
-  y->right = x;
-  if (x != mem_nil)
-    x->parent = y;
 }
 
-void
-mem_delete (struct mem_node *z, struct mem_node **root)
-{
-  struct mem_node *x, *y;
-
-  if (!z || z == mem_nil)
-    return;
-
-  if (z->left == mem_nil || z->right == mem_nil)
-    y = z;
-  else
-    {
-      y = z->right;
-      while (y->left != mem_nil)
-	y = y->left;
-    }
-
-  if (y->left != mem_nil)
-    x = y->left;
-  else
-    x = y->right;
-
-  x->parent = y->parent;
-  if (y->parent)
-    {
-      if (y == y->parent->left)
-	y->parent->left = x;
-      else
-	y->parent->right = x;
-    }
-  else
-    *root = x;
+/* Return the block containing P, or NULL if none.  */
 
-  if (y != z)
-    {
-      z->start = y->start;
-      z->end = y->end;
-      z->type = y->type;
-    }
+struct mem_node *
+mem_find (const void *p)
+{
+  uintptr_t addr = (uintptr_t) p;
+  struct mem_leaf *leaf = mem_leaf (addr >> MEM_LEAF_BITS);
+  if (!leaf)
+    return NULL;
+  struct mem_granule *granule
+    = &leaf->granules[(addr >> MEM_GRANULE_BITS) & (MEM_LEAF_NGRANULES - 1)];
+  struct mem_node *m = granule->first;
+  if (m && p < m->end)
+    return m;
+  m = granule->start;
+  if (m && m->start <= p && p < m->end)
+    return m;
+  return NULL;
+}
 
-  if (y->color == MEM_BLACK)
-    mem_delete_fixup (x, root);
+/* Register block of TYPE spanning START and END, owned by THR.
+   Return its node.  */
 
-  xfree (y);
+struct mem_node *
+mem_insert (void *start, void *end, enum mem_type type,
+	    struct thread_state *thr)
+{
+  struct mem_node *x = xmalloc (sizeof *x);
+  x->start = start;
+  x->end = end;
+  x->thread = thr;
+  x->type = type;
+#ifdef HAVE_GCC_TLS
+  sys_mutex_lock (&mem_mutex);
+#endif
+  mem_set (x, x);
+#ifdef HAVE_GCC_TLS
+  sys_mutex_unlock (&mem_mutex);
+#endif
+  return x;
 }
 
-/* Delete X, then rebalance red-black tree.  */
-
-static void
-mem_delete_fixup (struct mem_node *x, struct mem_node **root)
+void
+mem_delete (struct mem_node *node)
 {
-  while (x != *root && x->color == MEM_BLACK)
+  if (node)
     {
-      if (x == x->parent->left)
-	{
-	  struct mem_node *w = x->parent->right;
-
-	  if (w->color == MEM_RED)
-	    {
-	      w->color = MEM_BLACK;
-	      x->parent->color = MEM_RED;
-	      mem_rotate_left (x->parent, root);
-	      w = x->parent->right;
-            }
-
-	  if (w->left->color == MEM_BLACK && w->right->color == MEM_BLACK)
-	    {
-	      w->color = MEM_RED;
-	      x = x->parent;
-            }
-	  else
-	    {
-	      if (w->right->color == MEM_BLACK)
-		{
-		  w->left->color = MEM_BLACK;
-		  w->color = MEM_RED;
-		  mem_rotate_right (w, root);
-		  w = x->parent->right;
-                }
-	      w->color = x->parent->color;
-	      x->parent->color = MEM_BLACK;
-	      w->right->color = MEM_BLACK;
-	      mem_rotate_left (x->parent, root);
-	      x = *root;
-            }
-        }
-      else
-	{
-	  struct mem_node *w = x->parent->left;
-
-	  if (w->color == MEM_RED)
-	    {
-	      w->color = MEM_BLACK;
-	      x->parent->color = MEM_RED;
-	      mem_rotate_right (x->parent, root);
-	      w = x->parent->left;
-            }
-
-	  if (w->right->color == MEM_BLACK && w->left->color == MEM_BLACK)
-	    {
-	      w->color = MEM_RED;
-	      x = x->parent;
-            }
-	  else
-	    {
-	      if (w->left->color == MEM_BLACK)
-		{
-		  w->right->color = MEM_BLACK;
-		  w->color = MEM_RED;
-		  mem_rotate_left (w, root);
-		  w = x->parent->left;
-                }
-
-	      w->color = x->parent->color;
-	      x->parent->color = MEM_BLACK;
-	      w->left->color = MEM_BLACK;
-	      mem_rotate_right (x->parent, root);
-	      x = *root;
-            }
-        }
+#ifdef HAVE_GCC_TLS
+      sys_mutex_lock (&mem_mutex);
+#endif
+      mem_set (node, NULL);
+#ifdef HAVE_GCC_TLS
+      sys_mutex_unlock (&mem_mutex);
+#endif
+      xfree (node);
     }
-
-  x->color = MEM_BLACK;
 }
@@ -18,32 +18,28 @@ #define MEM_NODE_H
   MEM_TYPE_NTYPES,
 };
 
+struct thread_state;
+
 struct mem_node
 {
-  /* Children of node, or mem_nil (but not NULL).  */
-  struct mem_node *left, *right;
-
-  /* The parent of this node.  In the root node, this is NULL.  */
-  struct mem_node *parent;
-
   /* Start and end of allocated region.  */
   void *start, *end;
 
-  /* Node color.  */
-  enum {MEM_BLACK, MEM_RED} color;
+  /* Thread whose block lists hold the region.  */
+  struct thread_state *thread;
 
   /* Memory type.  */
   enum mem_type type;
 };
 
-struct thread_state;
-extern struct mem_node *mem_nil;
-void mem_merge_into (struct mem_node **into, struct mem_node *from);
-struct mem_node *mem_find (struct thread_state *thr, void *start);
-void mem_delete_root (struct mem_node **root);
-struct mem_node *mem_insert (void *, void *, enum mem_type, struct mem_node **root);
-void mem_delete (struct mem_node *node, struct mem_node **root);
-struct mem_node *mem_find_which_thread (const void *start, struct thread_state **which);
+/* Every registered region spans at least one granule of the page
+   map, so no granule holds the start of more than one region.  */
+enum { MEM_GRANULE_BITS = 10 };
+
+struct mem_node *mem_find (const void *p);
+struct mem_node *mem_insert (void *start, void *end, enum mem_type type,
+			     struct thread_state *thr);
+void mem_delete (struct mem_node *node);
 
 #ifdef HAVE_GCC_TLS
 # define THREAD_FIELD(thr, field) (thr->field)
@@ -0,0 +1,245 @@
+/* Parsing news overview (NOV) data.
+
+Copyright (C) 2024 Free Software Foundation, Inc.
+
+This file is NOT part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* Gnus reads the headers of a group from overview data, one line per
+   article with tab-separated fields:
+
+     NUMBER SUBJECT FROM DATE MESSAGE-ID REFERENCES CHARS LINES XREF EXTRA...
+
+   Entering a large group used to split each line with buffer searches
+   and the Lisp reader.  Here the lines are split in a single pass
+   into the header vectors of nnheader.el, and only the decoding of
+   encoded words is left to Lisp.  */
+
+#include <config.h>
+
+#include <c-ctype.h>
+#include <c-strcase.h>
+
+#include "lisp.h"
+#include "character.h"
+#include "buffer.h"
+
+/* A line of overview data being parsed: the byte positions of its
+   next field and of its end.  */
+
+struct nov_line
+{
+  ptrdiff_t pos, end;
+};
+
+/* Return the next field of LINE, as `nnheader-nov-field' does.  */
+
+static Lisp_Object
+nov_field (struct nov_line *line)
+{
+  ptrdiff_t beg = line->pos, end = beg;
+  while (end < line->end && FETCH_BYTE (end) != '\t')
+    end++;
+  line->pos = end < line->end ? end + 1 : end;
+  return make_buffer_string_both (BYTE_TO_CHAR (beg), beg,
+				  BYTE_TO_CHAR (end), end, true);
+}
+
+/* Return the next field of LINE as a number, as
+   `nnheader-nov-read-integer' does.  Return 0 if it is not a number.  */
+
+static Lisp_Object
+nov_number (struct nov_line *line)
+{
+  ptrdiff_t beg = line->pos, end = beg;
+  while (end < line->end && FETCH_BYTE (end) != '\t')
+    end++;
+  line->pos = end < line->end ? end + 1 : end;
+
+  /* Like the Lisp reader, allow blanks around the number.  */
+  while (beg < end && FETCH_BYTE (beg) == ' ')
+    beg++;
+  char buf[64];
+  ptrdiff_t len = end - beg, numlen;
+  if (len == 0 || len >= sizeof buf)
+    return make_fixnum (0);
+  for (ptrdiff_t i = 0; i < len; i++)
+    buf[i] = FETCH_BYTE (beg + i);
+  buf[len] = '\0';
+  Lisp_Object val = string_to_number (buf, 10, &numlen);
+  return (NILP (val) || (numlen < len && buf[numlen] != ' ')
+	  ? make_fixnum (0) : val);
+}
+
+/* Return the first Message-ID in STRING, as
+   `gnus-extract-message-id-from-in-reply-to' does, or nil.  */
+
+static Lisp_Object
+first_message_id (Lisp_Object string)
+{
+  ptrdiff_t nbytes = SBYTES (string);
+  for (ptrdiff_t lt = 0; lt < nbytes; lt++)
+    if (SREF (string, lt) == '<')
+      {
+	unsigned char *gt = memchr (SDATA (string) + lt + 1, '>',
+				    nbytes - (lt + 1));
+	if (!gt)
+	  break;
+	ptrdiff_t end = gt - SDATA (string) + 1;
+	if (end - lt > 2)
+	  return Fsubstring (string,
+			     make_fixnum (string_byte_to_char (string, lt)),
+			     make_fixnum (string_byte_to_char (string, end)));
+      }
+  return Qnil;
+}
+
+/* Parse the rest of LINE, which follows the article NUMBER, into a
+   header vector.  */
+
+static Lisp_Object
+nov_header (Lisp_Object number, struct nov_line *line)
+{
+  Lisp_Object header = initialize_vector (10, Qnil);
+  ASET (header, 0, number);
+  ASET (header, 1, nov_field (line));
+  ASET (header, 2, nov_field (line));
+  ASET (header, 3, nov_field (line));
+
+  /* Message-IDs that are not of the form <...> are left out, for the
+     caller to make up one.  */
+  Lisp_Object id = nov_field (line);
+  ptrdiff_t idbytes = SBYTES (id);
+  if (idbytes > 2 && SREF (id, 0) == '<' && SREF (id, idbytes - 1) == '>'
+      && !memchr (SDATA (id) + 1, '>', idbytes - 2))
+    ASET (header, 4, id);
+
+  Lisp_Object references = nov_field (line);
+  ASET (header, 6, nov_number (line));
+  ASET (header, 7, nov_number (line));
+  if (line->pos < line->end)
+    {
+      if (line->end - line->pos >= 6)
+	{
+	  char xref[6];
+	  for (int i = 0; i < 6; i++)
+	    xref[i] = FETCH_BYTE (line->pos + i);
+	  if (c_strncasecmp (xref, "Xref: ", 6) == 0)
+	    line->pos += 6;
+	}
+      ASET (header, 8, nov_field (line));
+    }
+
+  /* The extra headers, in reverse order like
+     `nnheader-nov-parse-extra' makes them.  The last In-Reply-To
+     stands in for missing references, as `assq' would find it.  */
+  Lisp_Object extra = Qnil, in_reply_to = Qnil;
+  while (line->pos < line->end)
+    {
+      Lisp_Object field = nov_field (line);
+      ptrdiff_t nbytes = SBYTES (field), colon = 0;
+      while (colon < nbytes && SREF (field, colon) != ' '
+	     && SREF (field, colon) != ':')
+	colon++;
+      if (colon > 0 && colon + 1 < nbytes
+	  && SREF (field, colon) == ':' && SREF (field, colon + 1) == ' ')
+	{
+	  ptrdiff_t namelen = string_byte_to_char (field, colon);
+	  Lisp_Object name = Fintern (Fsubstring (field, make_fixnum (0),
+						  make_fixnum (namelen)),
+				      Qnil);
+	  Lisp_Object value = Fsubstring (field, make_fixnum (namelen + 2),
+					  Qnil);
+	  extra = Fcons (Fcons (name, value), extra);
+	  if (EQ (name, QIn_Reply_To))
+	    in_reply_to = value;
+	}
+    }
+  ASET (header, 9, extra);
+
+  if (SCHARS (references) == 0 && !NILP (in_reply_to))
+    references = first_message_id (in_reply_to);
+  ASET (header, 5, references);
+  return header;
+}
+
+DEFUN ("nnheader--parse-nov-region", Fnnheader__parse_nov_region,
+       Snnheader__parse_nov_region, 3, 3, 0,
+       doc: /* Parse the overview lines between START and END.
+ARTICLES is t to parse every line, or an ascending list of the numbers
+of the articles whose lines to parse, which must be in ascending order
+too.  Return (HEADERS . REST), where HEADERS is the list of the header
+vectors of those lines, as `nnheader-parse-nov' makes them, and REST
+is the tail of ARTICLES that follows the last line.
+
+The subject and From fields are left as they are in the buffer, and
+the Message-ID is nil when the line has none.  Lines that do not start
+with an article number are skipped.  */)
+  (Lisp_Object start, Lisp_Object end, Lisp_Object articles)
+{
+  validate_region (&start, &end);
+  ptrdiff_t pos_byte = CHAR_TO_BYTE (XFIXNUM (start));
+  ptrdiff_t lim_byte = CHAR_TO_BYTE (XFIXNUM (end));
+  bool all = EQ (articles, Qt);
+  Lisp_Object headers = Qnil;
+  intmax_t quit_count = 0;
+
+  while (pos_byte < lim_byte && (all || CONSP (articles)))
+    {
+      rarely_quit (++quit_count);
+      struct nov_line line = { pos_byte, pos_byte };
+      while (line.end < lim_byte && FETCH_BYTE (line.end) != '\n')
+	line.end++;
+      pos_byte = line.end + 1;
+
+      /* The article number, as the Lisp reader would read it.  */
+      ptrdiff_t p = line.pos;
+      while (p < line.end
+	     && (FETCH_BYTE (p) == ' ' || FETCH_BYTE (p) == '\t'))
+	p++;
+      EMACS_INT number = 0;
+      ptrdiff_t digits = p;
+      while (p < line.end && c_isdigit (FETCH_BYTE (p))
+	     && number < MOST_POSITIVE_FIXNUM / 10)
+	number = number * 10 + (FETCH_BYTE (p++) - '0');
+      if (p == digits
+	  || (p < line.end && FETCH_BYTE (p) != '\t' && FETCH_BYTE (p) != ' '))
+	continue;
+
+      if (!all)
+	{
+	  while (CONSP (articles) && FIXNUMP (XCAR (articles))
+		 && XFIXNUM (XCAR (articles)) < number)
+	    articles = XCDR (articles);
+	  if (!(CONSP (articles)
+		&& EQ (XCAR (articles), make_fixnum (number))))
+	    continue;
+	  articles = XCDR (articles);
+	}
+
+      /* Skip the tab after the number.  */
+      line.pos = p < line.end ? p + 1 : p;
+      headers = Fcons (nov_header (make_fixnum (number), &line), headers);
+    }
+
+  return Fcons (Fnreverse (headers), articles);
+}
+
+void
+syms_of_nov (void)
+{
+  DEFSYM (QIn_Reply_To, "In-Reply-To");
+  defsubr (&Snnheader__parse_nov_region);
+}
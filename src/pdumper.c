@@ -2721,6 +2721,7 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->column_cache = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
@@ -2929,6 +2930,9 @@ dump_vectorlike (struct dump_context *ctx,
     case PVEC_USER_PTR:
     case PVEC_MUTEX:
     case PVEC_CONDVAR:
+    case PVEC_CHANNEL:
+    case PVEC_THREAD_POOL:
+    case PVEC_FUTURE:
     case PVEC_SQLITE:
     case PVEC_MODULE_FUNCTION:
     case PVEC_FREE:
@@ -3170,7 +3174,7 @@ dump_sort_copied_objects (struct dump_context *ctx)
      most effective.  */
   ctx->copied_queue =
     Fsort (Fnreverse (ctx->copied_queue),
-           Qdump_emacs_portable__sort_predicate_copied);
+           Qdump_emacs_portable__sort_predicate_copied, Qnil);
 }
 
 /* Dump parts of copied objects we need at runtime.  */
@@ -3729,7 +3733,7 @@ drain_reloc_list (struct dump_context *ctx,
   struct dump_flags old_flags = ctx->flags;
   ctx->flags.pack_objects = true;
   Lisp_Object relocs = Fsort (Fnreverse (*reloc_list),
-                              Qdump_emacs_portable__sort_predicate);
+                              Qdump_emacs_portable__sort_predicate, Qnil);
   *reloc_list = Qnil;
   dump_align_output (ctx, max (alignof (struct dump_reloc),
 			       alignof (struct emacs_reloc)));
@@ -3851,7 +3855,7 @@ dump_do_fixups (struct dump_context *ctx)
 {
   dump_off saved_offset = ctx->offset;
   Lisp_Object fixups = Fsort (Fnreverse (ctx->fixups),
-                              Qdump_emacs_portable__sort_predicate);
+                              Qdump_emacs_portable__sort_predicate, Qnil);
   Lisp_Object prev_fixup = Qnil;
   ctx->fixups = Qnil;
   while (!NILP (fixups))
@@ -3922,6 +3926,7 @@ DEFUN ("dump-emacs-portable",
 
   /* Clear detritus in memory.  */
   while (garbage_collect ()); // while a finalizer was run
+  finish_sweeps (); // clear lingering marks
 
   specpdl_ref count = SPECPDL_INDEX ();
 
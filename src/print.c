@@ -1929,6 +1929,40 @@ print_vectorlike_unreadable (Lisp_Object obj, Lisp_Object printcharfun,
       printchar ('>', printcharfun);
       return;
 
+    case PVEC_CHANNEL:
+      print_c_string ("#<channel ", printcharfun);
+      if (STRINGP (XCHANNEL (obj)->name))
+	print_string (XCHANNEL (obj)->name, printcharfun);
+      else
+	{
+	  void *p = XCHANNEL (obj);
+	  int len = sprintf (buf, "%p", p);
+	  strout (buf, len, len, printcharfun);
+	}
+      printchar ('>', printcharfun);
+      return;
+
+    case PVEC_THREAD_POOL:
+      print_c_string ("#<thread-pool ", printcharfun);
+      if (STRINGP (XTHREAD_POOL (obj)->name))
+	print_string (XTHREAD_POOL (obj)->name, printcharfun);
+      else
+	{
+	  void *p = XTHREAD_POOL (obj);
+	  int len = sprintf (buf, "%p", p);
+	  strout (buf, len, len, printcharfun);
+	}
+      printchar ('>', printcharfun);
+      return;
+
+    case PVEC_FUTURE:
+      {
+	void *p = XFUTURE (obj);
+	int len = sprintf (buf, "#<future %p>", p);
+	strout (buf, len, len, printcharfun);
+      }
+      return;
+
     case PVEC_MODULE_FUNCTION:
 #ifdef HAVE_MODULES
       {
@@ -242,6 +242,9 @@ #define READ_OUTPUT_DELAY_MAX_MAX   (READ_OUTPUT_DELAY_INCREMENT * 7)
 static void deactivate_process (Lisp_Object);
 static int status_notify (struct Lisp_Process *);
 static int read_process_output (Lisp_Object);
+static void insert_process_output (struct Lisp_Process *, Lisp_Object,
+				   struct coding_system *,
+				   const unsigned char *, ptrdiff_t);
 static void create_pty (Lisp_Object);
 static void exec_sentinel (Lisp_Object, Lisp_Object);
 
@@ -5646,6 +5649,40 @@ read_process_output_error_handler (Lisp_Object error_val)
   return Qt;
 }
 
+/* Arguments of read_process_output_direct, which cannot be passed
+   through internal_condition_case_1 as Lisp objects.  */
+
+struct process_output
+{
+  struct Lisp_Process *p;
+  struct coding_system *coding;
+  const unsigned char *chars;
+  ptrdiff_t nbytes;
+};
+
+static Lisp_Object
+read_process_output_direct (Lisp_Object arg)
+{
+  struct process_output *out = xmint_pointer (arg);
+  insert_process_output (out->p, Qnil, out->coding, out->chars, out->nbytes);
+  return Qnil;
+}
+
+/* Return true if output of P decoded by CODING can bypass the filter
+   and go straight into P's buffer.  This is so when the filter is the
+   unadvised default one, which has no use for the output as a string,
+   and the decoding runs no Lisp that would want one either.  */
+
+static bool
+process_output_direct_p (struct Lisp_Process *p, struct coding_system *coding)
+{
+  return (EQ (p->filter, Qinternal_default_process_filter)
+	  && SUBRP (XSYMBOL (Qinternal_default_process_filter)->u.s.function)
+	  && BUFFERP (p->buffer)
+	  && BUFFER_LIVE_P (XBUFFER (p->buffer))
+	  && NILP (CODING_ATTR_POST_READ (CODING_ID_ATTRS (coding->id))));
+}
+
 /* Read pending output from the process channel.  Return number of
    decoded characters read, or -1 upon error.
 
@@ -5665,6 +5702,7 @@ read_process_output (Lisp_Object proc)
   const specpdl_ref count = SPECPDL_INDEX ();
   Lisp_Object restore_deactivate;
   char *chars;
+  bool direct;
 
   USE_SAFE_ALLOCA;
   chars = SAFE_ALLOCA (sizeof coding->carryover + readmax);
@@ -5732,7 +5770,22 @@ read_process_output (Lisp_Object proc)
   specbind (Qinhibit_quit, Qt);
   specbind (Qlast_nonmenu_event, Qt);
 
-  decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
+  /* For the default filter, decode straight into the process buffer
+     rather than into a string that is garbage once inserted.  */
+  direct = nbytes > 0 && process_output_direct_p (p, coding);
+  if (direct)
+    {
+      struct process_output out = { p, coding, (unsigned char *) chars,
+				    nbytes };
+      coding->carryover_bytes = 0;
+      internal_condition_case_1 (read_process_output_direct,
+				 make_mint_ptr (&out),
+				 NILP (Vdebug_on_error) ? Qerror : Qnil,
+				 read_process_output_error_handler);
+      coding->insert_before_markers = false;
+    }
+  else
+    decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
   Vlast_coding_system_used = CODING_ID_NAME (coding->id);
 
   /* Set decoder to last coding system used..  */
@@ -5764,7 +5817,7 @@ read_process_output (Lisp_Object proc)
       p->decoding_carryover = coding->carryover_bytes;
     }
 
-  if (SBYTES (coding->dst_object) > 0)
+  if (!direct && SBYTES (coding->dst_object) > 0)
     call_process_filter (proc, coding->dst_object);
   Vdeactivate_mark = restore_deactivate;
 
@@ -5773,51 +5826,48 @@ read_process_output (Lisp_Object proc)
   return nbytes;
 }
 
-DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
-       Sinternal_default_process_filter, 2, 2, 0,
-       doc: /* Function used as default process filter.
-This inserts the process's output into its buffer, if there is one.
-Otherwise it discards the output.  */)
-  (Lisp_Object proc, Lisp_Object text)
-{
-  struct Lisp_Process *p;
-  ptrdiff_t opoint;
-
-  CHECK_PROCESS (proc);
-  p = XPROCESS (proc);
-  CHECK_STRING (text);
-
-  if (!NILP (p->buffer) && BUFFER_LIVE_P (XBUFFER (p->buffer)))
-    {
-      Lisp_Object old_read_only;
-      ptrdiff_t old_begv, old_zv;
-      ptrdiff_t before, before_byte;
-      ptrdiff_t opoint_byte;
-      struct buffer *b;
-
-      Fset_buffer (p->buffer);
-      opoint = PT;
-      opoint_byte = PT_BYTE;
-      old_read_only = BVAR (current_buffer, read_only);
-      old_begv = BEGV;
-      old_zv = ZV;
-
-      bset_read_only (current_buffer, Qnil);
+/* Insert output of process P into its live buffer at the process
+   mark, preserving point and the restriction.  The output is TEXT if
+   it is a string.  Otherwise it is NBYTES bytes at CHARS, decoded by
+   CODING straight into the buffer's gap, which spares the copy into
+   an intermediate Lisp string.  */
 
-      /* Insert new output into buffer at the current end-of-output
-	 marker, thus preserving logical ordering of input and output.  */
-      if (XMARKER (p->mark)->buffer)
-	set_point_from_marker (p->mark);
-      else
-	SET_PT_BOTH (ZV, ZV_BYTE);
-      before = PT;
-      before_byte = PT_BYTE;
+static void
+insert_process_output (struct Lisp_Process *p, Lisp_Object text,
+		       struct coding_system *coding,
+		       const unsigned char *chars, ptrdiff_t nbytes)
+{
+  Lisp_Object old_read_only;
+  ptrdiff_t opoint, opoint_byte;
+  ptrdiff_t old_begv, old_zv;
+  ptrdiff_t before, before_byte;
+  struct buffer *b;
+
+  Fset_buffer (p->buffer);
+  opoint = PT;
+  opoint_byte = PT_BYTE;
+  old_read_only = BVAR (current_buffer, read_only);
+  old_begv = BEGV;
+  old_zv = ZV;
+
+  bset_read_only (current_buffer, Qnil);
+
+  /* Insert new output into buffer at the current end-of-output
+     marker, thus preserving logical ordering of input and output.  */
+  if (XMARKER (p->mark)->buffer)
+    set_point_from_marker (p->mark);
+  else
+    SET_PT_BOTH (ZV, ZV_BYTE);
+  before = PT;
+  before_byte = PT_BYTE;
 
-      /* If the output marker is outside of the visible region, save
-	 the restriction and widen.  */
-      if (!(BEGV <= PT && PT <= ZV))
-	Fwiden ();
+  /* If the output marker is outside of the visible region, save
+     the restriction and widen.  */
+  if (!(BEGV <= PT && PT <= ZV))
+    Fwiden ();
 
+  if (STRINGP (text))
+    {
       /* Adjust the multibyteness of TEXT to that of the buffer.  */
       if (NILP (BVAR (current_buffer, enable_multibyte_characters))
 	  != !STRING_MULTIBYTE (text))
@@ -5828,37 +5878,66 @@ DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
 	 the buffer's mark is, and the user's next command is Meta-y.  */
       insert_from_string_before_markers (text, 0, 0,
 					 SCHARS (text), SBYTES (text), 0);
-
-      /* Make sure the process marker's position is valid when the
-	 process buffer is changed in the signal_after_change above.
-	 W3 is known to do that.  */
-      if (BUFFERP (p->buffer)
-	  && (b = XBUFFER (p->buffer), b != current_buffer))
-	set_marker_both (p->mark, p->buffer, BUF_PT (b), BUF_PT_BYTE (b));
-      else
-	set_marker_both (p->mark, p->buffer, PT, PT_BYTE);
-
-      update_mode_lines = 23;
-
-      /* Make sure opoint and the old restrictions
-	 float ahead of any new text just as point would.  */
-      if (opoint >= before)
+    }
+  else
+    {
+      prepare_to_modify_buffer (PT, PT, NULL);
+      coding->insert_before_markers = true;
+      decode_coding_c_string (coding, chars, nbytes, Fcurrent_buffer ());
+      coding->insert_before_markers = false;
+      if (PT > before)
 	{
-	  opoint += PT - before;
-	  opoint_byte += PT_BYTE - before_byte;
+	  signal_after_change (before, 0, PT - before);
+	  update_compositions (before, PT, CHECK_BORDER);
 	}
-      if (old_begv > before)
-	old_begv += PT - before;
-      if (old_zv >= before)
-	old_zv += PT - before;
+    }
+
+  /* Make sure the process marker's position is valid when the
+     process buffer is changed in the signal_after_change above.
+     W3 is known to do that.  */
+  if (BUFFERP (p->buffer)
+      && (b = XBUFFER (p->buffer), b != current_buffer))
+    set_marker_both (p->mark, p->buffer, BUF_PT (b), BUF_PT_BYTE (b));
+  else
+    set_marker_both (p->mark, p->buffer, PT, PT_BYTE);
 
-      /* If the restriction isn't what it should be, set it.  */
-      if (old_begv != BEGV || old_zv != ZV)
-	Fnarrow_to_region (make_fixnum (old_begv), make_fixnum (old_zv));
+  update_mode_lines = 23;
 
-      bset_read_only (current_buffer, old_read_only);
-      SET_PT_BOTH (opoint, opoint_byte);
+  /* Make sure opoint and the old restrictions
+     float ahead of any new text just as point would.  */
+  if (opoint >= before)
+    {
+      opoint += PT - before;
+      opoint_byte += PT_BYTE - before_byte;
     }
+  if (old_begv > before)
+    old_begv += PT - before;
+  if (old_zv >= before)
+    old_zv += PT - before;
+
+  /* If the restriction isn't what it should be, set it.  */
+  if (old_begv != BEGV || old_zv != ZV)
+    Fnarrow_to_region (make_fixnum (old_begv), make_fixnum (old_zv));
+
+  bset_read_only (current_buffer, old_read_only);
+  SET_PT_BOTH (opoint, opoint_byte);
+}
+
+DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
+       Sinternal_default_process_filter, 2, 2, 0,
+       doc: /* Function used as default process filter.
+This inserts the process's output into its buffer, if there is one.
+Otherwise it discards the output.  */)
+  (Lisp_Object proc, Lisp_Object text)
+{
+  struct Lisp_Process *p;
+
+  CHECK_PROCESS (proc);
+  p = XPROCESS (proc);
+  CHECK_STRING (text);
+
+  if (!NILP (p->buffer) && BUFFER_LIVE_P (XBUFFER (p->buffer)))
+    insert_process_output (p, text, NULL, NULL, 0);
   return Qnil;
 }
 
@@ -185,13 +185,18 @@ #define BYTEWIDTH 8 /* In bits.  */
 /* Type of source-pattern and string chars.  */
 typedef const unsigned char re_char;
 
-static void re_compile_fastmap (struct re_pattern_buffer *);
 static ptrdiff_t re_match_2_internal (struct re_pattern_buffer *bufp,
 				     re_char *string1, ptrdiff_t size1,
 				     re_char *string2, ptrdiff_t size2,
 				     ptrdiff_t pos,
 				     struct re_registers *regs,
-				     ptrdiff_t stop);
+				     ptrdiff_t stop, ptrdiff_t *budget);
+static ptrdiff_t nfa_match (struct re_pattern_buffer *bufp,
+			    re_char *string1, ptrdiff_t size1,
+			    re_char *string2, ptrdiff_t size2,
+			    ptrdiff_t pos, ptrdiff_t range,
+			    struct re_registers *regs, ptrdiff_t stop,
+			    ptrdiff_t *endp);
 
 /* These are the command codes that appear in compiled regular
    expressions.  Some opcodes are followed by argument bytes.  A
@@ -1074,7 +1079,8 @@ #define CHECK_INFINITE_LOOP(pat_cur, string_place)			\
    num_regs be declared.  GROW_FAIL_STACK requires 'destination' be
    declared.
 
-   Does 'return FAILURE_CODE' if runs out of memory.  */
+   Does 'return FAILURE_CODE' if runs out of memory, and 'return -3'
+   if BUDGET is non-null and runs out.  */
 
 #define PUSH_FAILURE_POINT(pattern, string_place)			\
 do {									\
@@ -1088,6 +1094,13 @@ #define PUSH_FAILURE_POINT(pattern, string_place)			\
 									\
   DEBUG_PRINT ("\n");							\
 									\
+  if (budget && --*budget < 0)						\
+    {									\
+      unbind_to (count, Qnil);						\
+      SAFE_FREE ();							\
+      return -3;							\
+    }									\
+									\
   DEBUG_PRINT ("  Push frame index: %td\n", fail_stack.frame);		\
   PUSH_FAILURE_INT (fail_stack.frame);					\
 									\
@@ -1180,6 +1193,9 @@ #define REG_UNSET(e) ((e) == NULL)
 static re_char *skip_one_char (re_char *p);
 static bool analyze_first (struct re_pattern_buffer *bufp,
                            re_char *p, re_char *pend, char *fastmap);
+static void analyze_must (struct re_pattern_buffer *bufp);
+static bool fold_must (struct re_pattern_buffer *bufp);
+static bool nfa_usable_p (struct re_pattern_buffer *bufp);
 
 /* Fetch the next character in the uncompiled pattern, with no
    translation.  */
@@ -2687,6 +2703,9 @@ regex_compile (re_char *pattern, ptrdiff_t size,
   /* Success; set the length of the buffer.  */
   bufp->used = b - bufp->buffer;
 
+  analyze_must (bufp);
+  bufp->nfa_ok = !posix_backtracking && nfa_usable_p (bufp);
+
 #ifdef REGEX_EMACS_DEBUG
   if (regex_emacs_debug > 0)
     {
@@ -2756,6 +2775,326 @@ insert_op2 (re_opcode_t op, unsigned char *loc, int arg1, int arg2,
 }
 
 
+/* Return a pointer to the operation following the one at P.  */
+
+static re_char *
+skip_op (re_char *p)
+{
+  switch (*p)
+    {
+    case exactn:
+      return p + 2 + p[1];
+
+    case anychar:
+    case charset:
+    case charset_not:
+    case syntaxspec:
+    case notsyntaxspec:
+    case categoryspec:
+    case notcategoryspec:
+      return skip_one_char (p);
+
+    case start_memory:
+    case stop_memory:
+    case duplicate:
+      return p + 2;
+
+    case jump:
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      return p + 3;
+
+    case succeed_n:
+    case jump_n:
+    case set_number_at:
+      return p + 5;
+
+    default:
+      return p + 1;
+    }
+}
+
+/* The literal being collected by 'analyze_must'.  */
+
+struct must_run
+{
+  unsigned char text[RE_MUST_MAX];
+  int len;
+  /* True if the literal went on past RE_MUST_MAX bytes.  */
+  bool full;
+  /* Offset of the literal from the start of the match, or -1.  */
+  ptrdiff_t offset;
+};
+
+/* End RUN, keeping it in BUFP if it is the longest seen so far.  */
+
+static void
+commit_must_run (struct re_pattern_buffer *bufp, struct must_run *run)
+{
+  if (run->len > bufp->must_len)
+    {
+      memcpy (bufp->must, run->text, run->len);
+      bufp->must_len = run->len;
+      bufp->must_offset = run->offset;
+    }
+  run->len = 0;
+  run->full = false;
+}
+
+/* Find the longest literal that every match of the compiled pattern
+   in BUFP contains, and store it in BUFP's 'must' fields.
+
+   Only the mandatory path through the pattern is walked.  Optional
+   parts and alternatives start with a forward jump; they are stepped
+   over as a whole, extending the skipped region to the targets of any
+   forward jumps inside it, and they end the current literal.  A
+   backward jump means a loop: the code before it has already been
+   matched once, but the offset of anything after it varies.  */
+
+static void
+analyze_must (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer, *pend = p + bufp->used;
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+  struct must_run run = { .len = 0 };
+  /* Bytes consumed by every match before P, or -1 if that varies.  */
+  ptrdiff_t pos = 0;
+
+  bufp->must_len = 0;
+  bufp->must_offset = -1;
+
+  while (p < pend)
+    switch (*p)
+      {
+      case exactn:
+	{
+	  re_char *s = p + 2, *send = s + p[1];
+	  if (run.len == 0)
+	    run.offset = pos;
+	  while (s < send && !run.full)
+	    {
+	      int len = multibyte ? BYTES_BY_CHAR_HEAD (*s) : 1;
+	      if (run.len + len > RE_MUST_MAX || s + len > send)
+		run.full = true;
+	      else
+		{
+		  memcpy (run.text + run.len, s, len);
+		  run.len += len;
+		  s += len;
+		}
+	    }
+	  /* Non-ASCII text takes different numbers of bytes in unibyte
+	     and multibyte strings, so the offset of what follows is not
+	     fixed.  */
+	  for (s = p + 2; s < send && pos >= 0; s++)
+	    if (!ASCII_CHAR_P (*s))
+	      pos = -1;
+	  if (pos >= 0)
+	    pos += p[1];
+	  p = send;
+	}
+	break;
+
+      case no_op:
+      case begline:
+      case endline:
+      case begbuf:
+      case endbuf:
+      case wordbeg:
+      case wordend:
+      case wordbound:
+      case notwordbound:
+      case symbeg:
+      case symend:
+      case at_dot:
+      case start_memory:
+      case stop_memory:
+      case set_number_at:
+	/* Zero-width; the literal goes on.  */
+	p = skip_op (p);
+	break;
+
+      case anychar:
+      case charset:
+      case charset_not:
+      case syntaxspec:
+      case notsyntaxspec:
+      case categoryspec:
+      case notcategoryspec:
+      case duplicate:
+	commit_must_run (bufp, &run);
+	pos = -1;
+	p = skip_op (p);
+	break;
+
+      case jump:
+      case on_failure_jump:
+      case on_failure_keep_string_jump:
+      case on_failure_jump_loop:
+      case on_failure_jump_nastyloop:
+      case on_failure_jump_smart:
+      case succeed_n:
+	{
+	  re_char *end = extract_address (p + 1);
+	  commit_must_run (bufp, &run);
+	  pos = -1;
+	  if (end <= p)
+	    {
+	      if (*p == jump)
+		goto done;
+	      p = skip_op (p);
+	      break;
+	    }
+	  for (re_char *q = p; q < end; q = skip_op (q))
+	    switch (*q)
+	      {
+	      case jump:
+	      case on_failure_jump:
+	      case on_failure_keep_string_jump:
+	      case on_failure_jump_loop:
+	      case on_failure_jump_nastyloop:
+	      case on_failure_jump_smart:
+	      case succeed_n:
+	      case jump_n:
+		end = max (end, extract_address (q + 1));
+		break;
+	      case succeed:
+		goto done;
+	      default:
+		break;
+	      }
+	  p = end;
+	}
+	break;
+
+      default:
+	/* 'succeed', or a stray 'jump_n'.  */
+	goto done;
+      }
+
+ done:
+  commit_must_run (bufp, &run);
+  bufp->must_ascii = true;
+  for (int i = 0; i < bufp->must_len; i++)
+    if (!ASCII_CHAR_P (bufp->must[i]))
+      bufp->must_ascii = false;
+  bufp->must_fold = (bufp->must_len > 0 && bufp->must_ascii
+		     && !NILP (bufp->translate) && fold_must (bufp));
+}
+
+/* Fill in BUFP's 'must_fold_table', so that a byte of the text may
+   be part of an occurrence of its required literal if the table maps
+   it to the literal's byte.  Return false if that cannot be done, as
+   the translate table is not a case table or maps some non-ASCII
+   character to a byte of the literal.  */
+
+static bool
+fold_must (struct re_pattern_buffer *bufp)
+{
+  Lisp_Object translate = bufp->translate, eqv;
+
+  /* The characters that a case table translates to C are those in the
+     cycle of equivalent characters through C.  */
+  if (!CHAR_TABLE_P (translate)
+      || CHAR_TABLE_EXTRA_SLOTS (XCHAR_TABLE (translate)) < 3)
+    return false;
+  eqv = XCHAR_TABLE (translate)->extras[2];
+  if (!CHAR_TABLE_P (eqv))
+    return false;
+  for (int i = 0; i < bufp->must_len; i++)
+    {
+      int c = bufp->must[i];
+      for (int n = 0; ; n++)
+	{
+	  Lisp_Object next = CHAR_TABLE_REF (eqv, c);
+	  if (!CHARACTERP (next) || XFIXNAT (next) == bufp->must[i])
+	    break;
+	  c = XFIXNAT (next);
+	  if (!ASCII_CHAR_P (c) || n == 128)
+	    return false;
+	}
+    }
+
+  for (int c = 0; c < 256; c++)
+    {
+      int folded = ASCII_CHAR_P (c) ? RE_TRANSLATE (translate, c) : -1;
+      bufp->must_fold_table[c] = ASCII_CHAR_P (folded) ? folded : 0xff;
+    }
+  return true;
+}
+
+
+/* Return true if P, in the compiled pattern from BUFFER to PEND,
+   starts a loop whose body can match the empty string.  If so, set
+   *LO and *HI to the bounds of the loop's code.  */
+
+static bool
+empty_loop_bounds (re_char *buffer, re_char *pend, re_char *p,
+		   re_char **lo, re_char **hi)
+{
+  re_char *target = extract_address (p + 1);
+  switch (*p)
+    {
+    case on_failure_jump_loop:
+      /* The loop ends where it exits, and may begin before P if P is
+	 at the end of a + loop, whose last jump goes back to it.  */
+      *lo = p;
+      *hi = target;
+      for (re_char *q = buffer; q < pend; q = skip_op (q))
+	if (*q == jump && q + 3 == target && extract_address (q + 1) < p)
+	  *lo = extract_address (q + 1);
+      return true;
+
+    case on_failure_jump_nastyloop:
+      /* A non-greedy loop ends with the jump back to its body.  */
+      *lo = target;
+      *hi = p + 3;
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+/* Return true if 'nfa_match' can run the compiled pattern in BUFP.
+   Back-references and counted repetitions need more state than a
+   position in the pattern.  Loops that can match the empty string
+   within other such loops leave their subexpressions where the cycle
+   checks of 're_match_2_internal' happen to, which depends on the
+   failure points pushed so far rather than on the position.  */
+
+static bool
+nfa_usable_p (struct re_pattern_buffer *bufp)
+{
+  re_char *buffer = bufp->buffer, *pend = buffer + bufp->used;
+  for (re_char *p = buffer; p < pend; p = skip_op (p))
+    switch (*p)
+      {
+      case duplicate:
+      case succeed_n:
+      case jump_n:
+      case set_number_at:
+	return false;
+      default:
+	break;
+      }
+
+  for (re_char *p = buffer; p < pend; p = skip_op (p))
+    {
+      re_char *lo, *hi, *lo1, *hi1;
+      if (empty_loop_bounds (buffer, pend, p, &lo, &hi))
+	for (re_char *q = buffer; q < pend; q = skip_op (q))
+	  if (q != p && lo <= q && q < hi
+	      && empty_loop_bounds (buffer, pend, q, &lo1, &hi1))
+	    return false;
+    }
+  return true;
+}
+
+
 /* P points to just after a ^ in PATTERN.  Return true if that ^ comes
    after an alternative or a begin-subexpression.  Assume there is at
    least one character before the ^.  */
@@ -3317,7 +3656,7 @@ analyze_first (struct re_pattern_buffer *bufp,
    Set the 'fastmap', 'fastmap_accurate', and 'can_be_null' fields in
    the pattern buffer.  */
 
-static void
+void
 re_compile_fastmap (struct re_pattern_buffer *bufp)
 {
   char *fastmap = bufp->fastmap;
@@ -3332,6 +3671,14 @@ re_compile_fastmap (struct re_pattern_buffer *bufp)
   bufp->can_be_null = analyze_first (bufp, bufp->buffer,
 			             bufp->buffer + bufp->used, fastmap);
 } /* re_compile_fastmap */
+
+/* Return true if BUFP can match only at the beginning of a line.  */
+
+bool
+re_begline_p (struct re_pattern_buffer *bufp)
+{
+  return bufp->used > 0 && (re_opcode_t) bufp->buffer[0] == begline;
+}
 
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
    ENDS.  Subsequent matches using PATTERN_BUFFER and REGS will use
@@ -3378,10 +3725,129 @@ re_search (struct re_pattern_buffer *bufp, const char *string, ptrdiff_t size,
 		      regs, size);
 }
 
+/* How many failure points 're_search_2' and 're_match_2' let the
+   backtracking matcher push, in all, before they switch a pattern
+   that allows it to 'nfa_match': RE_BACKTRACK_BASE plus
+   RE_BACKTRACK_PER_BYTE for each byte of text.  Ordinary patterns
+   stay well within this.  */
+enum { RE_BACKTRACK_BASE = 10000, RE_BACKTRACK_PER_BYTE = 32 };
+
+static ptrdiff_t
+backtrack_budget (ptrdiff_t size)
+{
+  ptrdiff_t budget;
+  if (ckd_mul (&budget, size, RE_BACKTRACK_PER_BYTE)
+      || ckd_add (&budget, budget, RE_BACKTRACK_BASE))
+    return PTRDIFF_MAX;
+  return budget;
+}
+
 /* Address of POS in the concatenation of virtual string. */
 #define POS_ADDR_VSTRING(POS)					\
   (((POS) >= size1 ? string2 - size1 : string1) + (POS))
 
+/* Return true if the N bytes at S are the N bytes of BUFP's required
+   literal at MUST, once folded if the search ignores case.  */
+
+static bool
+must_equal (struct re_pattern_buffer *bufp, re_char *s, re_char *must,
+	    ptrdiff_t n)
+{
+  if (!bufp->must_fold)
+    return memcmp (s, must, n) == 0;
+  for (ptrdiff_t i = 0; i < n; i++)
+    if (bufp->must_fold_table[s[i]] != must[i])
+      return false;
+  return true;
+}
+
+/* Return the first occurrence of BUFP's required literal in the N
+   bytes at S, or NULL if there is none.  */
+
+static re_char *
+must_in (struct re_pattern_buffer *bufp, re_char *s, ptrdiff_t n)
+{
+  ptrdiff_t len = bufp->must_len;
+  if (!bufp->must_fold)
+    return memmem (s, n, bufp->must, len);
+  for (re_char *p = s, *last = s + n - len; p <= last; p++)
+    if (bufp->must_fold_table[*p] == bufp->must[0]
+	&& must_equal (bufp, p + 1, bufp->must + 1, len - 1))
+      return p;
+  return NULL;
+}
+
+/* Return the index of the first occurrence of BUFP's required literal
+   in the virtual concatenation of STRING1 and STRING2 that starts at or
+   after FROM and ends at or before TO, or -1 if there is none.  */
+
+static ptrdiff_t
+find_must (struct re_pattern_buffer *bufp,
+	   re_char *string1, ptrdiff_t size1,
+	   re_char *string2, ptrdiff_t size2,
+	   ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t len = bufp->must_len;
+  re_char *found;
+
+  if (from < size1)
+    {
+      ptrdiff_t end1 = min (to, size1);
+      if (end1 - from >= len)
+	{
+	  found = must_in (bufp, string1 + from, end1 - from);
+	  if (found)
+	    return found - string1;
+	}
+      /* Occurrences straddling the end of STRING1.  */
+      for (ptrdiff_t i = max (from, size1 - len + 1);
+	   i < size1 && i + len <= to; i++)
+	{
+	  ptrdiff_t len1 = size1 - i;
+	  if (must_equal (bufp, string1 + i, bufp->must, len1)
+	      && must_equal (bufp, string2, bufp->must + len1, len - len1))
+	    return i;
+	}
+      from = size1;
+    }
+  if (to - from >= len)
+    {
+      found = must_in (bufp, string2 + from - size1, to - from);
+      if (found)
+	return found - string2 + size1;
+    }
+  return -1;
+}
+
+/* Return true if searches with BUFP can look for its required literal
+   in the bytes of the text, as there is one and the text encodes it
+   the same way.  When the search translates the text, that needs a
+   literal whose bytes only ASCII characters translate to.  */
+
+static bool
+must_usable_p (struct re_pattern_buffer *bufp)
+{
+  if (bufp->must_len == 0)
+    return false;
+  if (!NILP (bufp->translate))
+    return bufp->must_fold;
+  return (bufp->must_ascii
+	  || RE_MULTIBYTE_P (bufp) == RE_TARGET_MULTIBYTE_P (bufp));
+}
+
+ptrdiff_t
+re_search_must (struct re_pattern_buffer *bufp,
+		const char *string1, ptrdiff_t size1,
+		const char *string2, ptrdiff_t size2,
+		ptrdiff_t from, ptrdiff_t stop)
+{
+  if (!must_usable_p (bufp))
+    return -2;
+  return find_must (bufp, (re_char *) string1, size1,
+		    (re_char *) string2, size2, from,
+		    min (stop, size1 + size2));
+}
+
 /* Using the compiled pattern in BUFP->buffer, first tries to match the
    virtual concatenation of STRING1 and STRING2, starting first at index
    STARTPOS, then at STARTPOS + 1, and so on.
@@ -3419,6 +3885,15 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
   bool anchored_start;
   /* Nonzero if we are searching multibyte string.  */
   bool multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  /* Where a match must have ended, and the last occurrence found of
+     the pattern's required literal, if there is one we can use.  */
+  ptrdiff_t must_stop = min (stop, total_size), must_pos = -1;
+  bool use_must = must_usable_p (bufp);
+  /* Failure points that may be pushed before switching to 'nfa_match',
+     and whether that has happened.  */
+  ptrdiff_t budget;
+  ptrdiff_t *budgetp = bufp->nfa_ok ? &budget : NULL;
+  bool use_nfa = false;
 
   /* Check for out-of-range STARTPOS.  */
   if (startpos < 0 || startpos > total_size)
@@ -3451,6 +3926,10 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	return -1;
     }
 
+  /* The text any attempt can look at lies between the lowest start
+     and STOP, which may be much less than the whole of the strings.  */
+  budget = backtrack_budget (must_stop - min (startpos, startpos + range));
+
   /* Update the fastmap now if not correct already.  */
   if (fastmap && !bufp->fastmap_accurate)
     re_compile_fastmap (bufp);
@@ -3458,11 +3937,45 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
   /* See whether the pattern is anchored.  */
   anchored_start = (bufp->buffer[0] == begline);
 
+  /* A backward search can at least give up when the required literal
+     does not occur in the region it could match.  */
+  if (use_must && range < 0)
+    {
+      use_must = false;
+      if (find_must (bufp, string1, size1, string2, size2,
+		     startpos + range, must_stop) < 0)
+	return -1;
+    }
+
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, startpos);
 
   /* Loop through the string, looking for a place to start matching.  */
   for (;;)
     {
+      /* Skip ahead to the next occurrence of the required literal.  If
+	 its offset in a match is fixed, that also gives the only place
+	 where the next match can start.  */
+      if (use_must && range > 0)
+	{
+	  ptrdiff_t offset = bufp->must_offset;
+	  ptrdiff_t from = startpos + max (offset, 0);
+	  if (must_pos < from)
+	    {
+	      must_pos = find_must (bufp, string1, size1, string2, size2,
+				    from, must_stop);
+	      if (must_pos < 0)
+		return -1;
+	    }
+	  if (offset >= 0)
+	    {
+	      ptrdiff_t skip = must_pos - offset - startpos;
+	      if (skip > range)
+		return -1;
+	      startpos += skip;
+	      range -= skip;
+	    }
+	}
+
       /* If the pattern is anchored,
 	 skip quickly past places we cannot match.
 	 Don't bother to treat startpos == 0 specially
@@ -3575,8 +4088,25 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	  && !bufp->can_be_null)
 	return -1;
 
-      val = re_match_2_internal (bufp, string1, size1, string2, size2,
-				 startpos, regs, stop);
+      if (use_nfa)
+	val = nfa_match (bufp, string1, size1, string2, size2,
+			 startpos, max (range, 0), regs, stop, NULL);
+      else
+	val = re_match_2_internal (bufp, string1, size1, string2, size2,
+				   startpos, regs, stop, budgetp);
+
+      if (val == -3)
+	{
+	  /* Backtracking is taking too long, so go on without it; or
+	     the pattern is too big for that, so backtrack after all.  */
+	  use_nfa = !use_nfa;
+	  budgetp = NULL;
+	  continue;
+	}
+
+      /* A forward NFA search has tried all the remaining positions.  */
+      if (use_nfa && range > 0)
+	return val;
 
       if (val >= 0)
 	return startpos;
@@ -4048,16 +4578,74 @@ re_match_2 (struct re_pattern_buffer *bufp,
 	    char const *string2, ptrdiff_t size2,
 	    ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
 {
-  ptrdiff_t result;
-
   RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, pos);
+  return re_match_2_again (bufp, string1, size1, string2, size2,
+			   pos, regs, stop);
+}
+
+ptrdiff_t
+re_match_2_again (struct re_pattern_buffer *bufp,
+		  char const *string1, ptrdiff_t size1,
+		  char const *string2, ptrdiff_t size2,
+		  ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
+{
+  ptrdiff_t result;
+  ptrdiff_t budget = backtrack_budget (stop - pos);
 
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
 				(re_char *) string2, size2,
-				pos, regs, stop);
+				pos, regs, stop,
+				bufp->nfa_ok ? &budget : NULL);
+  if (result == -3)
+    {
+      /* Backtracking is taking too long; match without it.  */
+      ptrdiff_t end;
+      result = nfa_match (bufp, (re_char *) string1, size1,
+			  (re_char *) string2, size2,
+			  pos, 0, regs, stop, &end);
+      if (result >= 0)
+	result = end - pos;
+      else if (result == -3)
+	result = re_match_2_internal (bufp, (re_char *) string1, size1,
+				      (re_char *) string2, size2,
+				      pos, regs, stop, NULL);
+    }
   return result;
 }
 
+/* Make sure REGS has room for NUM_REGS registers, allocating or
+   growing its arrays as BUFP's 'regs_allocated' allows.  */
+
+static void
+allocate_registers (struct re_pattern_buffer *bufp,
+		    struct re_registers *regs, ptrdiff_t num_regs)
+{
+  /* Have the register data arrays been allocated?	*/
+  if (bufp->regs_allocated == REGS_UNALLOCATED)
+    { /* No.  So allocate them with malloc.  */
+      ptrdiff_t n = max (RE_NREGS, num_regs);
+      regs->start = xnmalloc (n, sizeof *regs->start);
+      regs->end = xnmalloc (n, sizeof *regs->end);
+      regs->num_regs = n;
+      bufp->regs_allocated = REGS_REALLOCATE;
+    }
+  else if (bufp->regs_allocated == REGS_REALLOCATE)
+    { /* Yes.  If we need more elements than were already
+	 allocated, reallocate them.  If we need fewer, just
+	 leave it alone.  */
+      ptrdiff_t n = regs->num_regs;
+      if (n < num_regs)
+	{
+	  n = max (n + (n >> 1), num_regs);
+	  regs->start = xnrealloc (regs->start, n, sizeof *regs->start);
+	  regs->end = xnrealloc (regs->end, n, sizeof *regs->end);
+	  regs->num_regs = n;
+	}
+    }
+  else
+    eassert (bufp->regs_allocated == REGS_FIXED);
+}
+
 static void
 unwind_re_match (void *ptr)
 {
@@ -4071,7 +4659,8 @@ unwind_re_match (void *ptr)
 re_match_2_internal (struct re_pattern_buffer *bufp,
 		     re_char *string1, ptrdiff_t size1,
 		     re_char *string2, ptrdiff_t size2,
-		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop)
+		     ptrdiff_t pos, struct re_registers *regs, ptrdiff_t stop,
+		     ptrdiff_t *budget)
 {
   eassume (0 <= size1);
   eassume (0 <= size2);
@@ -4346,31 +4935,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 	  /* If caller wants register contents data back, do it.  */
 	  if (regs)
 	    {
-	      /* Have the register data arrays been allocated?	*/
-	      if (bufp->regs_allocated == REGS_UNALLOCATED)
-		{ /* No.  So allocate them with malloc.  */
-		  ptrdiff_t n = max (RE_NREGS, num_regs);
-		  regs->start = xnmalloc (n, sizeof *regs->start);
-		  regs->end = xnmalloc (n, sizeof *regs->end);
-		  regs->num_regs = n;
-		  bufp->regs_allocated = REGS_REALLOCATE;
-		}
-	      else if (bufp->regs_allocated == REGS_REALLOCATE)
-		{ /* Yes.  If we need more elements than were already
-		     allocated, reallocate them.  If we need fewer, just
-		     leave it alone.  */
-		  ptrdiff_t n = regs->num_regs;
-		  if (n < num_regs)
-		    {
-		      n = max (n + (n >> 1), num_regs);
-		      regs->start
-			= xnrealloc (regs->start, n, sizeof *regs->start);
-		      regs->end = xnrealloc (regs->end, n, sizeof *regs->end);
-		      regs->num_regs = n;
-		    }
-		}
-	      else
-		eassert (bufp->regs_allocated == REGS_FIXED);
+	      allocate_registers (bufp, regs, num_regs);
 
 	      /* Convert the pointer data in 'regstart' and 'regend' to
 		 indices.  Register zero has to be set differently,
@@ -5264,6 +5829,696 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
   return retval;
 }
 
+/* Matching without backtracking.
+
+   'nfa_match' runs a compiled pattern as a nondeterministic automaton
+   (a Pike VM): it keeps a list of threads, each a place in the pattern
+   with its own registers, and moves them all over the text one
+   character at a time.  There is at most one thread per place in the
+   pattern, so the time taken is linear in the length of the text,
+   however badly the pattern would backtrack.  The threads are kept in
+   the order the backtracking matcher would try them, so both find the
+   same match.  Only patterns with 'nfa_ok' set can be run this way;
+   see 'nfa_usable_p' for those that cannot.  */
+
+struct nfa_thread
+{
+  /* The next opcode, or the next character of an exactn.  */
+  re_char *pc;
+  /* End of the exactn that PC is inside, or NULL.  */
+  re_char *exact_end;
+  /* Start and end of each register, as offsets into the text.  */
+  ptrdiff_t *regs;
+};
+
+struct nfa_list
+{
+  struct nfa_thread *threads;
+  ptrdiff_t n;
+  /* Room for the registers of each thread.  */
+  ptrdiff_t *regs;
+};
+
+/* Work items for 'nfa_add_thread', which follows all the paths
+   through the pattern that do not consume any text.  */
+enum nfa_work { NFA_PC, NFA_RESTORE, NFA_ENTER_LOOP, NFA_LEAVE_LOOP };
+
+struct nfa_item
+{
+  enum nfa_work work;
+  union
+  {
+    re_char *pc;		/* NFA_PC: place to continue at.  */
+    /* NFA_ENTER_LOOP: offset of the loop.  NFA_LEAVE_LOOP: that, and
+       the scope outside the loop.  */
+    struct { ptrdiff_t off, base; } loop;
+    struct { ptrdiff_t reg, val; } restore; /* NFA_RESTORE.  */
+  } u;
+};
+
+struct nfa
+{
+  struct re_pattern_buffer *bufp;
+  re_char *string1, *string2, *end1, *end2;
+  ptrdiff_t size1, size2, stop;
+  Lisp_Object translate;
+  bool multibyte, target_multibyte;
+  /* Number of elements in each thread's registers.  */
+  ptrdiff_t nregs;
+  /* For each byte of the pattern, whether an opcode starts there.  */
+  bool *is_op;
+  /* For each byte of the pattern, the generation in which a thread
+     last got there, or a loop there was last entered.  */
+  ptrdiff_t *mark, generation;
+  /* For each byte of the pattern, the scope in which a path last went
+     through it.  Each entry to a loop starts a new scope, numbered
+     after all the earlier ones, because the path can go through the
+     places it went to before the loop again, as
+     're_match_2_internal' would; a path has been somewhere already
+     if it went there in the current scope or a later one.  */
+  ptrdiff_t *visit, serial;
+  /* For each on_failure_jump_loop, whether the path being followed
+     is inside the loop it starts.  */
+  bool *in_loop;
+  struct nfa_item *work;
+  ptrdiff_t work_size;
+  ptrdiff_t *scratch;
+};
+
+/* Return the address of text offset POS.  */
+
+static re_char *
+nfa_addr (struct nfa *m, ptrdiff_t pos)
+{
+  return (pos < m->size1 ? m->string1 + pos
+	  : m->string2 + (pos - m->size1));
+}
+
+/* Return true if the zero-width assertion at P holds at offset POS.
+   This does what 're_match_2_internal' does for the same opcode.  */
+
+static bool
+nfa_assert (struct nfa *m, re_char *p, ptrdiff_t pos)
+{
+  re_char *string1 = m->string1, *string2 = m->string2;
+  re_char *end1 = m->end1, *end2 = m->end2;
+  ptrdiff_t size1 = m->size1, size2 = m->size2;
+  bool target_multibyte = m->target_multibyte;
+  re_char *d = nfa_addr (m, pos);
+  int c1, c2, s1, s2, dummy;
+  ptrdiff_t charpos;
+
+  switch (*p)
+    {
+    case begline:
+      if (AT_STRINGS_BEG (d))
+	return true;
+      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+      return c1 == '\n';
+
+    case endline:
+      return AT_STRINGS_END (d) || *d == '\n';
+
+    case begbuf:
+      return AT_STRINGS_BEG (d);
+
+    case endbuf:
+      return AT_STRINGS_END (d);
+
+    case at_dot:
+      return PTR_BYTE_POS (d) == PT_BYTE;
+
+    case wordbound:
+    case notwordbound:
+      {
+	bool not = *p == notwordbound;
+	if (AT_STRINGS_BEG (d) || AT_STRINGS_END (d))
+	  return !not;
+	charpos = RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos) - 1;
+	UPDATE_SYNTAX_TABLE (charpos);
+	GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+	s1 = SYNTAX (c1);
+	UPDATE_SYNTAX_TABLE_FORWARD (charpos + 1);
+	GET_CHAR_AFTER (c2, d, dummy);
+	s2 = SYNTAX (c2);
+	return (((s1 == Sword) != (s2 == Sword))
+		|| ((s1 == Sword) && WORD_BOUNDARY_P (c1, c2))) != not;
+      }
+
+    case wordbeg:
+    case symbeg:
+      /* 're_match_2_internal' fails at the end of the strings, and
+	 its PREFETCH fails at STOP.  */
+      if (AT_STRINGS_END (d) || pos >= m->stop)
+	return false;
+      charpos = RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos);
+      UPDATE_SYNTAX_TABLE (charpos);
+      GET_CHAR_AFTER (c2, d, dummy);
+      s2 = SYNTAX (c2);
+      if (*p == wordbeg ? s2 != Sword : s2 != Sword && s2 != Ssymbol)
+	return false;
+      if (AT_STRINGS_BEG (d))
+	return true;
+      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+      UPDATE_SYNTAX_TABLE_BACKWARD (charpos - 1);
+      s1 = SYNTAX (c1);
+      return (*p == wordbeg
+	      ? s1 != Sword || WORD_BOUNDARY_P (c1, c2)
+	      : s1 != Sword && s1 != Ssymbol);
+
+    case wordend:
+    case symend:
+      if (AT_STRINGS_BEG (d))
+	return false;
+      charpos = RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos) - 1;
+      UPDATE_SYNTAX_TABLE (charpos);
+      GET_CHAR_BEFORE_2 (c1, d, string1, end1, string2, end2);
+      s1 = SYNTAX (c1);
+      if (*p == wordend ? s1 != Sword : s1 != Sword && s1 != Ssymbol)
+	return false;
+      if (AT_STRINGS_END (d))
+	return true;
+      GET_CHAR_AFTER (c2, d, dummy);
+      UPDATE_SYNTAX_TABLE_FORWARD (charpos + 1);
+      s2 = SYNTAX (c2);
+      return (*p == wordend
+	      ? s2 != Sword || WORD_BOUNDARY_P (c1, c2)
+	      : s2 != Sword && s2 != Ssymbol);
+
+    default:
+      abort ();
+    }
+}
+
+/* Match the character at text offset POS, which is LEN bytes long,
+   against the character-matching operation at P, or against the next
+   character of an exactn if EXACT_END is non-null.  Return the place
+   in the pattern to go on from, or NULL if there is no match.  Update
+   *EXACT_END for the new place.  */
+
+static re_char *
+nfa_consume (struct nfa *m, re_char *p, re_char **exact_end,
+	     ptrdiff_t pos, int len)
+{
+  Lisp_Object translate = m->translate;
+  bool target_multibyte = m->target_multibyte;
+  re_char *d = nfa_addr (m, pos);
+  int c, dummy;
+
+  if (*exact_end)
+    {
+      int pat_charlen, pat_ch, buf_ch;
+      if (target_multibyte)
+	{
+	  if (m->multibyte)
+	    pat_ch = string_char_and_length (p, &pat_charlen);
+	  else
+	    {
+	      pat_ch = RE_CHAR_TO_MULTIBYTE (*p);
+	      pat_charlen = 1;
+	    }
+	  buf_ch = TRANSLATE (STRING_CHAR (d));
+	}
+      else
+	{
+	  if (m->multibyte)
+	    {
+	      pat_ch = string_char_and_length (p, &pat_charlen);
+	      pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
+	    }
+	  else
+	    {
+	      pat_ch = *p;
+	      pat_charlen = 1;
+	    }
+	  buf_ch = RE_CHAR_TO_MULTIBYTE (*d);
+	  if (!CHAR_BYTE8_P (buf_ch))
+	    {
+	      buf_ch = TRANSLATE (buf_ch);
+	      buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
+	      if (buf_ch < 0)
+		buf_ch = *d;
+	    }
+	  else
+	    buf_ch = *d;
+	}
+      if (buf_ch != pat_ch)
+	return NULL;
+      p += pat_charlen;
+      if (p == *exact_end)
+	*exact_end = NULL;
+      return p;
+    }
+
+  switch (*p)
+    {
+    case anychar:
+      c = RE_STRING_CHAR_AND_LENGTH (d, dummy, target_multibyte);
+      return TRANSLATE (c) == '\n' ? NULL : p + 1;
+
+    case charset:
+    case charset_not:
+      {
+	bool unibyte_char = false;
+	int corig = RE_STRING_CHAR_AND_LENGTH (d, dummy, target_multibyte);
+	c = corig;
+	if (target_multibyte)
+	  {
+	    int c1;
+	    c = TRANSLATE (c);
+	    c1 = RE_CHAR_TO_UNIBYTE (c);
+	    if (c1 >= 0)
+	      {
+		unibyte_char = true;
+		c = c1;
+	      }
+	  }
+	else
+	  {
+	    int c1 = RE_CHAR_TO_MULTIBYTE (c);
+	    if (!CHAR_BYTE8_P (c1))
+	      {
+		c1 = TRANSLATE (c1);
+		c1 = RE_CHAR_TO_UNIBYTE (c1);
+		if (c1 >= 0)
+		  {
+		    unibyte_char = true;
+		    c = c1;
+		  }
+	      }
+	    else
+	      unibyte_char = true;
+	  }
+	return (execute_charset (&p, c, corig, unibyte_char, translate)
+		? p : NULL);
+      }
+
+    case syntaxspec:
+    case notsyntaxspec:
+      UPDATE_SYNTAX_TABLE (RE_SYNTAX_TABLE_BYTE_TO_CHAR (pos));
+      GET_CHAR_AFTER (c, d, dummy);
+      return (((SYNTAX (c) != (enum syntaxcode) p[1])
+	       ^ (*p == notsyntaxspec))
+	      ? NULL : p + 2);
+
+    case categoryspec:
+    case notcategoryspec:
+      GET_CHAR_AFTER (c, d, dummy);
+      return ((!CHAR_HAS_CATEGORY (c, p[1]) ^ (*p == notcategoryspec))
+	      ? NULL : p + 2);
+
+    default:
+      abort ();
+    }
+}
+
+/* Append a thread at PC with registers REGS to LIST.  */
+
+static void
+nfa_push_thread (struct nfa *m, struct nfa_list *list, re_char *pc,
+		 re_char *exact_end, ptrdiff_t const *regs)
+{
+  struct nfa_thread *t = &list->threads[list->n];
+  t->pc = pc;
+  t->exact_end = exact_end;
+  t->regs = list->regs + list->n * m->nregs;
+  memcpy (t->regs, regs, m->nregs * sizeof *regs);
+  list->n++;
+}
+
+/* Push ITEM onto the work stack of M, which has *NWORK items.  */
+
+static void
+nfa_push_work (struct nfa *m, ptrdiff_t *nwork, struct nfa_item item)
+{
+  if (*nwork == m->work_size)
+    m->work = xpalloc (m->work, &m->work_size, 1, -1, sizeof *m->work);
+  m->work[(*nwork)++] = item;
+}
+
+/* Add to LIST, unless it is there already, a thread at PC with
+   registers REGS.  */
+
+static void
+nfa_add_final (struct nfa *m, struct nfa_list *list, re_char *pc,
+	       re_char *exact_end, ptrdiff_t const *regs)
+{
+  ptrdiff_t off = pc - m->bufp->buffer;
+  if (m->mark[off] != m->generation)
+    {
+      m->mark[off] = m->generation;
+      nfa_push_thread (m, list, pc, exact_end, regs);
+    }
+}
+
+/* Add to LIST, in priority order, a thread for each place where the
+   text at offset POS can be matched after starting at PC with
+   registers REGS.  This follows the jumps and zero-width operations
+   from PC, the way 're_match_2_internal' would try them.  */
+
+static void
+nfa_add_thread (struct nfa *m, struct nfa_list *list, re_char *pc,
+		ptrdiff_t const *regs, ptrdiff_t pos)
+{
+  re_char *buffer = m->bufp->buffer, *pend = buffer + m->bufp->used;
+  ptrdiff_t *r = m->scratch;
+  ptrdiff_t nwork = 0;
+  ptrdiff_t base = m->generation;
+
+  memcpy (r, regs, m->nregs * sizeof *r);
+  nfa_push_work (m, &nwork, (struct nfa_item) { NFA_PC, { .pc = pc } });
+
+  while (nwork > 0)
+    {
+      struct nfa_item item = m->work[--nwork];
+      switch (item.work)
+	{
+	case NFA_RESTORE:
+	  r[item.u.restore.reg] = item.u.restore.val;
+	  continue;
+	case NFA_ENTER_LOOP:
+	  /* Another iteration of a non-greedy loop.  */
+	  nfa_push_work (m, &nwork, (struct nfa_item)
+			 { NFA_LEAVE_LOOP, { .loop = { item.u.loop.off,
+						       base } } });
+	  m->in_loop[item.u.loop.off] = true;
+	  base = ++m->serial;
+	  pc = extract_address (buffer + item.u.loop.off + 1);
+	  break;
+	case NFA_LEAVE_LOOP:
+	  m->in_loop[item.u.loop.off] = false;
+	  base = item.u.loop.base;
+	  continue;
+	case NFA_PC:
+	  pc = item.u.pc;
+	  break;
+	}
+
+      for (;;)
+	{
+	  ptrdiff_t off = pc - buffer;
+
+	  /* Coming back to an on_failure_jump_loop without having
+	     matched anything gets out of the loop, like the cycle check
+	     in 're_match_2_internal'.  */
+	  if (pc < pend && *pc == on_failure_jump_loop && m->in_loop[off])
+	    {
+	      pc = extract_address (pc + 1);
+	      continue;
+	    }
+	  if (m->visit[off] >= base)
+	    break;
+	  m->visit[off] = base;
+
+	  if (pc == pend)
+	    {
+	      nfa_add_final (m, list, pc, NULL, r);
+	      break;
+	    }
+
+	  switch (*pc)
+	    {
+	    case no_op:
+	      pc++;
+	      continue;
+
+	    case exactn:
+	      if (pc[1] == 0)
+		{
+		  pc += 2;
+		  continue;
+		}
+	      nfa_add_final (m, list, pc + 2, pc + 2 + pc[1], r);
+	      break;
+
+	    case succeed:
+	    case anychar:
+	    case charset:
+	    case charset_not:
+	    case syntaxspec:
+	    case notsyntaxspec:
+	    case categoryspec:
+	    case notcategoryspec:
+	      nfa_add_final (m, list, pc, NULL, r);
+	      break;
+
+	    case start_memory:
+	    case stop_memory:
+	      {
+		ptrdiff_t reg = 2 * pc[1] + (*pc == stop_memory);
+		nfa_push_work (m, &nwork, (struct nfa_item)
+			       { NFA_RESTORE, { .restore = { reg, r[reg] } } });
+		r[reg] = pos;
+		pc += 2;
+		continue;
+	      }
+
+	    case jump:
+	      {
+		re_char *q = extract_address (pc + 1);
+		/* A loop that 'on_failure_jump_smart' turned into an
+		   'on_failure_keep_string_jump' loop jumps back past
+		   its start; go back to the start, so the loop can
+		   still be left after each iteration.  */
+		if (q - buffer >= 3 && m->is_op[q - buffer - 3]
+		    && q[-3] == on_failure_keep_string_jump
+		    && extract_address (q - 2) == pc + 3)
+		  q -= 3;
+		pc = q;
+		continue;
+	      }
+
+	    case on_failure_jump_loop:
+	      /* Enter each loop once at each place in the text, so
+		 that there are only so many scopes.  */
+	      if (m->mark[off] == m->generation)
+		break;
+	      m->mark[off] = m->generation;
+	      nfa_push_work (m, &nwork, (struct nfa_item)
+			     { NFA_PC, { .pc = extract_address (pc + 1) } });
+	      nfa_push_work (m, &nwork, (struct nfa_item)
+			     { NFA_LEAVE_LOOP, { .loop = { off, base } } });
+	      m->in_loop[off] = true;
+	      base = ++m->serial;
+	      pc += 3;
+	      continue;
+
+	    case on_failure_jump_nastyloop:
+	      /* Try leaving the loop first, and another iteration next,
+		 unless this one matched nothing.  */
+	      if (!m->in_loop[off] && m->mark[off] != m->generation)
+		{
+		  m->mark[off] = m->generation;
+		  nfa_push_work (m, &nwork, (struct nfa_item)
+				 { NFA_ENTER_LOOP, { .loop = { off } } });
+		}
+	      pc += 3;
+	      continue;
+
+	    case on_failure_jump:
+	    case on_failure_keep_string_jump:
+	    case on_failure_jump_smart:
+	      /* Try what follows first, and the jump target next.  */
+	      nfa_push_work (m, &nwork, (struct nfa_item)
+			     { NFA_PC, { .pc = extract_address (pc + 1) } });
+	      pc += 3;
+	      continue;
+
+	    default:
+	      if (nfa_assert (m, pc, pos))
+		{
+		  pc++;
+		  continue;
+		}
+	      break;
+	    }
+	  break;
+	}
+    }
+}
+
+/* Largest number of register elements 'nfa_match' allocates for its
+   threads; bigger patterns are left to the backtracking matcher.  */
+enum { NFA_MAX_REGS = 1 << 20 };
+
+static void
+nfa_free_work (void *m)
+{
+  xfree (((struct nfa *) m)->work);
+}
+
+/* Match the compiled pattern in BUFP against the virtual concatenation
+   of STRING1 and STRING2, starting at offset POS, POS + 1, ... up to
+   POS + RANGE, and not going past offset STOP.  Return the start of
+   the first match, setting REGS and *ENDP (if non-null) to describe
+   it, or -1 if there is none.  Return -3 if the pattern is too big.  */
+
+static ptrdiff_t
+nfa_match (struct re_pattern_buffer *bufp,
+	   re_char *string1, ptrdiff_t size1,
+	   re_char *string2, ptrdiff_t size2,
+	   ptrdiff_t pos, ptrdiff_t range,
+	   struct re_registers *regs, ptrdiff_t stop, ptrdiff_t *endp)
+{
+  eassert (bufp->nfa_ok && range >= 0);
+  ptrdiff_t num_regs = bufp->re_nsub + 1;
+  ptrdiff_t nregs = 2 * num_regs;
+  ptrdiff_t nplaces = bufp->used + 1;
+  ptrdiff_t last_start = pos + range;
+  ptrdiff_t start = -1, end = -1;
+  struct nfa m;
+  struct nfa_list lists[2], *clist = &lists[0], *nlist = &lists[1];
+
+  if (nregs > NFA_MAX_REGS / nplaces)
+    return -3;
+
+  /* Match within STRING2 only if it is the only string, the way
+     're_match_2_internal' does.  */
+  if (size2 == 0 && string1 != NULL)
+    {
+      string2 = string1;
+      size2 = size1;
+      string1 = NULL;
+      size1 = 0;
+    }
+
+  REGEX_USE_SAFE_ALLOCA;
+  m.bufp = bufp;
+  m.string1 = string1;
+  m.string2 = string2;
+  m.size1 = size1;
+  m.size2 = size2;
+  m.end1 = string1 + size1;
+  m.end2 = string2 + size2;
+  m.stop = stop;
+  m.translate = bufp->translate;
+  m.multibyte = RE_MULTIBYTE_P (bufp);
+  m.target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  m.nregs = nregs;
+  m.generation = m.serial = 0;
+  m.work = NULL;
+  m.work_size = 0;
+  SAFE_NALLOCA (m.is_op, 1, nplaces);
+  SAFE_NALLOCA (m.in_loop, 1, nplaces);
+  SAFE_NALLOCA (m.mark, 1, nplaces);
+  SAFE_NALLOCA (m.visit, 1, nplaces);
+  SAFE_NALLOCA (m.scratch, 3, nregs);
+  for (int i = 0; i < 2; i++)
+    {
+      SAFE_NALLOCA (lists[i].threads, 1, nplaces);
+      SAFE_NALLOCA (lists[i].regs, nregs, nplaces);
+      lists[i].n = 0;
+    }
+  memset (m.is_op, 0, nplaces);
+  memset (m.in_loop, 0, nplaces);
+  for (ptrdiff_t i = 0; i < nplaces; i++)
+    m.mark[i] = m.visit[i] = -1;
+  for (re_char *p = bufp->buffer; p < bufp->buffer + bufp->used;
+       p = skip_op (p))
+    m.is_op[p - bufp->buffer] = true;
+
+  /* The registers of a new thread, and after them those of the
+     match found.  */
+  ptrdiff_t *init = m.scratch + nregs;
+  for (ptrdiff_t i = 0; i < nregs; i++)
+    init[i] = -1;
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect_ptr (nfa_free_work, &m);
+
+  /* Protect the text from relocation, as 're_match_2_internal' does.  */
+  if (!current_buffer->text->inhibit_shrinking)
+    {
+      record_unwind_protect_ptr (unwind_re_match, current_buffer);
+      current_buffer->text->inhibit_shrinking = 1;
+    }
+
+  for (ptrdiff_t p = pos; ; )
+    {
+      /* Start a new thread here, after all the ones that started
+	 earlier, unless a match has been found already.  */
+      if (start < 0 && p <= last_start)
+	{
+	  init[0] = p;
+	  nfa_add_thread (&m, clist, bufp->buffer, init, p);
+	  init[0] = -1;
+	}
+
+      /* Length of the character at P, or 0 if it cannot be matched.  */
+      int len = 0;
+      if (p < stop)
+	len = (m.target_multibyte
+	       ? BYTES_BY_CHAR_HEAD (*nfa_addr (&m, p)) : 1);
+
+      m.generation = ++m.serial;
+      nlist->n = 0;
+      for (ptrdiff_t i = 0; i < clist->n; i++)
+	{
+	  struct nfa_thread *t = &clist->threads[i];
+	  if (!t->exact_end
+	      && (t->pc == bufp->buffer + bufp->used || *t->pc == succeed))
+	    {
+	      /* This beats any match found before; the threads after
+		 it could only find worse ones.  */
+	      start = t->regs[0];
+	      end = p;
+	      memcpy (init + nregs, t->regs, nregs * sizeof *init);
+	      break;
+	    }
+	  if (len == 0)
+	    continue;
+	  re_char *exact_end = t->exact_end;
+	  re_char *next = nfa_consume (&m, t->pc, &exact_end, p, len);
+	  if (!next)
+	    continue;
+	  if (exact_end)
+	    /* Still inside an exactn; there is nothing to follow.  */
+	    nfa_add_final (&m, nlist, next, exact_end, t->regs);
+	  else
+	    nfa_add_thread (&m, nlist, next, t->regs, p + len);
+	}
+
+      struct nfa_list *tmp = clist;
+      clist = nlist;
+      nlist = tmp;
+      if (len == 0)
+	break;
+      p += len;
+      if (clist->n == 0 && (start >= 0 || p > last_start))
+	break;
+      maybe_quit ();
+    }
+
+  if (start >= 0 && regs)
+    {
+      ptrdiff_t *best = init + nregs;
+      allocate_registers (bufp, regs, num_regs);
+      if (regs->num_regs > 0)
+	{
+	  regs->start[0] = start;
+	  regs->end[0] = end;
+	}
+      for (ptrdiff_t reg = 1; reg < num_regs; reg++)
+	{
+	  if (best[2 * reg + 1] < 0)
+	    regs->start[reg] = regs->end[reg] = -1;
+	  else
+	    {
+	      regs->start[reg] = best[2 * reg];
+	      regs->end[reg] = best[2 * reg + 1];
+	    }
+	}
+      for (ptrdiff_t reg = num_regs; reg < regs->num_regs; reg++)
+	regs->start[reg] = regs->end[reg] = -1;
+    }
+  if (endp)
+    *endp = end;
+
+  unbind_to (count, Qnil);
+  SAFE_FREE ();
+  return start;
+}
+
 /* Subroutine definitions for re_match_2.  */
 
 /* Return true if TRANSLATE[S1] and TRANSLATE[S2] are not identical
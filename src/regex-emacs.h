@@ -33,8 +33,8 @@ #define EMACS_REGEX_H 1
 
 #include "lisp.h"
 
-/* The string or buffer being matched.
-   It is used for looking up syntax properties.
+/* re_match_object, defined per thread in thread.h, is the string or
+   buffer being matched.  It is used for looking up syntax properties.
 
    If the value is a Lisp string object, match text in that string; if
    it's nil, match text in the current buffer; if it's t, match text
@@ -47,7 +47,6 @@ #define EMACS_REGEX_H 1
    re_match_object into gl_state on entry.
 
    TODO: turn into an actual function parameter.  */
-extern Lisp_Object re_match_object;
 
 /* Roughly the maximum number of failure points on the stack.  */
 extern ptrdiff_t emacs_re_max_failures;
@@ -55,6 +54,9 @@ #define EMACS_REGEX_H 1
 /* Amount of memory that we can safely stack allocate.  */
 extern ptrdiff_t emacs_re_safe_alloca;
 
+/* Maximum number of bytes kept of a pattern's required literal.  */
+enum { RE_MUST_MAX = 64 };
+
 /* This data structure represents a compiled pattern.  Before calling
    the pattern compiler, the fields 'buffer', 'allocated', 'fastmap',
    and 'translate' can be set.  After the pattern has been
@@ -118,6 +120,33 @@ #define EMACS_REGEX_H 1
   /* If true, multi-byte form in the target of match should be
      recognized as a multibyte character.  */
   bool_bf target_multibyte : 1;
+
+  /* If true, the pattern can be matched by simulating it as an NFA,
+     without backtracking.  Set by 'regex_compile'.  */
+  bool_bf nfa_ok : 1;
+
+  /* If true, 'must' holds only ASCII bytes, which encode the same
+     text in unibyte and multibyte strings.  */
+  bool_bf must_ascii : 1;
+
+  /* If true, 'translate' maps only ASCII characters to the bytes of
+     'must', and 'must_fold_table' gives the ASCII character that each
+     byte of the text translates to, or 0xff if there is none.  */
+  bool_bf must_fold : 1;
+
+  /* Number of bytes in 'must', or zero if the pattern has no literal
+     that every match contains.  */
+  int must_len;
+
+  /* Byte distance from the start of every match to the start of
+     'must', or -1 if that distance varies.  */
+  ptrdiff_t must_offset;
+
+  /* Longest literal that every match of the pattern contains.
+     're_search_2' skips between its occurrences before trying to
+     match.  Set by 'regex_compile'.  */
+  unsigned char must[RE_MUST_MAX];
+  unsigned char must_fold_table[256];
 };
 
 /* Declarations for routines.  */
@@ -160,6 +189,34 @@ #define EMACS_REGEX_H 1
 			    ptrdiff_t start, struct re_registers *regs,
 			    ptrdiff_t stop);
 
+/* Like 're_match_2', but for another match in the same text: go on
+   from the state of the syntax table that the last match left instead
+   of setting it up again, as the attempts of 're_search_2' do.  */
+extern ptrdiff_t re_match_2_again (struct re_pattern_buffer *buffer,
+				   const char *string1, ptrdiff_t length1,
+				   const char *string2, ptrdiff_t length2,
+				   ptrdiff_t start, struct re_registers *regs,
+				   ptrdiff_t stop);
+
+
+/* Fill in the fastmap of BUFFER, which must point to 256 bytes: the
+   leading codes of the characters a match can start with.  Also set
+   its 'can_be_null', in which case the fastmap does not apply.  */
+extern void re_compile_fastmap (struct re_pattern_buffer *buffer);
+
+/* Return true if BUFFER can match only at the beginning of a line.  */
+extern bool re_begline_p (struct re_pattern_buffer *buffer);
+
+/* Return the index of the first occurrence of BUFFER's required
+   literal that starts at or after FROM and ends at or before STOP in
+   the virtual concatenation of STRING1 and STRING2, or -1 if there is
+   none.  Return -2 if BUFFER has no required literal that can be
+   looked for in the text.  */
+extern ptrdiff_t re_search_must (struct re_pattern_buffer *buffer,
+				 const char *string1, ptrdiff_t size1,
+				 const char *string2, ptrdiff_t size2,
+				 ptrdiff_t from, ptrdiff_t stop);
+
 
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
    ENDS.  Subsequent matches using BUFFER and REGS will use this memory
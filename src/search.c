@@ -60,6 +60,12 @@ #define REGEXP_CACHE_SIZE 20
 /* The head of the linked list; points to the most recently used buffer.  */
 static struct regexp_cache *searchbuf_head;
 
+#ifdef HAVE_GCC_TLS
+/* Uncooperative threads search too, so the cache and its busy flags
+   are only looked at under this.  */
+static sys_mutex_t searchbuf_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static EMACS_INT simple_search (EMACS_INT, unsigned char *, ptrdiff_t,
 				ptrdiff_t, Lisp_Object, ptrdiff_t, ptrdiff_t,
@@ -68,8 +74,6 @@ #define REGEXP_CACHE_SIZE 20
                               Lisp_Object, Lisp_Object, ptrdiff_t,
                               ptrdiff_t, int);
 
-Lisp_Object re_match_object;
-
 static AVOID
 matcher_overflow (void)
 {
@@ -103,7 +107,7 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   const char *whitespace_regexp;
   char *val;
 
-  eassert (!cp->busy);
+  eassert (cp->busy);
   cp->regexp = Qnil;
   cp->buf.translate = translate;
   cp->posix = posix;
@@ -135,12 +139,18 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
 void
 compact_regexp_cache (void)
 {
+#ifdef HAVE_GCC_TLS
+  sys_mutex_lock (&searchbuf_mutex);
+#endif
   for (struct regexp_cache *cp = searchbuf_head; cp != NULL; cp = cp->next)
     if (!cp->busy)
       {
         cp->buf.allocated = cp->buf.used;
         cp->buf.buffer = xrealloc (cp->buf.buffer, cp->buf.used);
       }
+#ifdef HAVE_GCC_TLS
+  sys_mutex_unlock (&searchbuf_mutex);
+#endif
 }
 
 /* Clear the regexp cache w.r.t. a particular syntax table,
@@ -153,27 +163,31 @@ clear_regexp_cache (void)
 {
   int i;
 
+#ifdef HAVE_GCC_TLS
+  sys_mutex_lock (&searchbuf_mutex);
+#endif
   for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
     /* It's tempting to compare with the syntax-table we've actually changed,
        but it's not sufficient because char-table inheritance means that
        modifying one syntax-table can change others at the same time.  */
     if (!searchbufs[i].busy && !EQ (searchbufs[i].syntax_table, Qt))
       searchbufs[i].regexp = Qnil;
+#ifdef HAVE_GCC_TLS
+  sys_mutex_unlock (&searchbuf_mutex);
+#endif
 }
 
 static void
 unfreeze_pattern (void *arg)
 {
   struct regexp_cache *searchbuf = arg;
+#ifdef HAVE_GCC_TLS
+  sys_mutex_lock (&searchbuf_mutex);
+#endif
   searchbuf->busy = false;
-}
-
-static void
-freeze_pattern (struct regexp_cache *searchbuf)
-{
-  eassert (!searchbuf->busy);
-  record_unwind_protect_ptr (unfreeze_pattern, searchbuf);
-  searchbuf->busy = true;
+#ifdef HAVE_GCC_TLS
+  sys_mutex_unlock (&searchbuf_mutex);
+#endif
 }
 
 /* Compile a regexp if necessary, but first check to see if there's one in
@@ -185,14 +199,20 @@ freeze_pattern (struct regexp_cache *searchbuf)
    If it is 0, we should compile the pattern not to record any
    subexpression bounds.
    POSIX is true if we want full backtracking (POSIX style) for this pattern.
-   False means backtrack only enough to get a valid match.  */
+   False means backtrack only enough to get a valid match.
+
+   The pattern returned is kept busy until the caller unbinds.  */
 
 static struct regexp_cache *
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
   struct regexp_cache *cp, **cpp, **lru_nonbusy;
+  bool compile = false;
 
+#ifdef HAVE_GCC_TLS
+  sys_mutex_lock (&searchbuf_mutex);
+#endif
   for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
     {
       cp = *cpp;
@@ -204,8 +224,15 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 	 is only applied to the cache entry we pick here to reuse.  So
 	 nil should never appear before a non-nil entry.  */
       if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
+	{
+	  /* Unless another thread is compiling into it.  */
+	  if (!cp->busy)
+	    {
+	      compile = true;
+	      break;
+	    }
+	}
+      else if (SCHARS (cp->regexp) == SCHARS (pattern)
           && !cp->busy
 	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
 	  && !NILP (Fstring_equal (cp->regexp, pattern))
@@ -222,22 +249,34 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
       if (cp->next == 0)
 	{
           if (!lru_nonbusy)
-            error ("Too much matching reentrancy");
+	    {
+#ifdef HAVE_GCC_TLS
+	      sys_mutex_unlock (&searchbuf_mutex);
+#endif
+	      error ("Too much matching reentrancy");
+	    }
           cpp = lru_nonbusy;
           cp = *cpp;
-	compile_it:
-          eassert (!cp->busy);
-	  compile_pattern_1 (cp, pattern, translate, posix);
+	  compile = true;
 	  break;
 	}
     }
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
+  /* When we get here, cp (aka *cpp) contains the compiled pattern, or
+     is the cell to compile it into.  Move it to the front of the
+     queue to mark it as most recently used.  */
   *cpp = cp->next;
   cp->next = searchbuf_head;
   searchbuf_head = cp;
+  eassert (!cp->busy);
+  cp->busy = true;
+#ifdef HAVE_GCC_TLS
+  sys_mutex_unlock (&searchbuf_mutex);
+#endif
+  record_unwind_protect_ptr (unfreeze_pattern, cp);
+
+  if (compile)
+    compile_pattern_1 (cp, pattern, translate, posix);
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -269,6 +308,8 @@ looking_at_1 (Lisp_Object string, bool posix, bool modify_data)
   /* Snapshot in case Lisp changes the value.  */
   bool modify_match_data = NILP (Vinhibit_changing_match_data) && modify_data;
 
+  specpdl_ref count = SPECPDL_INDEX ();
+  buffer_text_read_lock (current_buffer);
   struct regexp_cache *cache_entry = compile_pattern (
     string,
     modify_match_data ? &search_regs : NULL,
@@ -299,9 +340,7 @@ looking_at_1 (Lisp_Object string, bool posix, bool modify_data)
       s2 = 0;
     }
 
-  specpdl_ref count = SPECPDL_INDEX ();
   freeze_buffer_relocation ();
-  freeze_pattern (cache_entry);
   re_match_object = Qnil;
   i = re_match_2 (&cache_entry->buf, (char *) p1, s1, (char *) p2, s2,
 		  PT_BYTE - BEGV_BYTE,
@@ -395,7 +434,6 @@ string_match_1 (Lisp_Object regexp, Lisp_Object string, Lisp_Object start,
 			: Qnil),
 		       posix,
 		       STRING_MULTIBYTE (string));
-  freeze_pattern (cache_entry);
   re_match_object = string;
   val = re_search (&cache_entry->buf, SSDATA (string),
 		   SBYTES (string), pos_byte,
@@ -474,7 +512,6 @@ fast_string_match_internal (Lisp_Object regexp, Lisp_Object string,
   specpdl_ref count = SPECPDL_INDEX ();
   struct regexp_cache *cache_entry
     = compile_pattern (regexp, 0, table, 0, STRING_MULTIBYTE (string));
-  freeze_pattern (cache_entry);
   ptrdiff_t val = re_search (&cache_entry->buf, SSDATA (string),
 			     SBYTES (string), 0,
 			     SBYTES (string), 0);
@@ -495,7 +532,6 @@ fast_c_string_match_ignore_case (Lisp_Object regexp,
   specpdl_ref count = SPECPDL_INDEX ();
   struct regexp_cache *cache_entry
     = compile_pattern (regexp, 0, Vascii_canon_table, 0, 0);
-  freeze_pattern (cache_entry);
   re_match_object = Qt;
   ptrdiff_t val = re_search (&cache_entry->buf, string, len, 0, len, 0);
   unbind_to (count, Qnil);
@@ -555,11 +591,10 @@ fast_looking_at (Lisp_Object regexp, ptrdiff_t pos, ptrdiff_t pos_byte,
       multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
     }
 
+  specpdl_ref count = SPECPDL_INDEX ();
   struct regexp_cache *cache_entry =
     compile_pattern (regexp, 0, Qnil, 0, multibyte);
-  specpdl_ref count = SPECPDL_INDEX ();
   freeze_buffer_relocation ();
-  freeze_pattern (cache_entry);
   re_match_object = STRINGP (string) ? string : Qnil;
   len = re_match_2 (&cache_entry->buf, (char *) p1, s1, (char *) p2, s2,
 		    pos_byte, NULL, limit_byte);
@@ -1023,6 +1058,8 @@ search_command (Lisp_Object string, Lisp_Object bound, Lisp_Object noerror,
     }
 
   CHECK_STRING (string);
+  specpdl_ref speccount = SPECPDL_INDEX ();
+  buffer_text_read_lock (current_buffer);
   if (NILP (bound))
     {
       if (n > 0)
@@ -1061,24 +1098,27 @@ search_command (Lisp_Object string, Lisp_Object bound, Lisp_Object noerror,
       if (NILP (noerror))
 	xsignal1 (Qsearch_failed, string);
 
-      if (!EQ (noerror, Qt))
+      if (!EQ (noerror, Qt) && current_thread->cooperative)
 	{
 	  eassert (BEGV <= lim && lim <= ZV);
 	  SET_PT_BOTH (lim, lim_byte);
-	  return Qnil;
+	  return unbind_to (speccount, Qnil);
 #if 0 /* This would be clean, but maybe programs depend on
 	 a value of nil here.  */
 	  np = lim;
 #endif
 	}
       else
-	return Qnil;
+	return unbind_to (speccount, Qnil);
     }
 
   eassert (BEGV <= np && np <= ZV);
-  SET_PT (np);
+  /* Point is shared with the global lock holder, and moving it looks
+     at text properties; uncooperative threads get only the value.  */
+  if (current_thread->cooperative)
+    SET_PT (np);
 
-  return make_fixnum (np);
+  return unbind_to (speccount, make_fixnum (np));
 }
 
 /* Return true if REGEXP it matches just one constant string.  */
@@ -1132,7 +1172,7 @@ while (0)
 /* Only used in search_buffer, to record the end position of the match
    when searching regexps and SEARCH_REGS should not be changed
    (i.e. Vinhibit_changing_match_data is non-nil).  */
-static struct re_registers search_regs_1;
+PER_THREAD_STATIC struct re_registers search_regs_1;
 
 static EMACS_INT
 search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
@@ -1145,6 +1185,7 @@ search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   /* Snapshot in case Lisp changes the value.  */
   bool preserve_match_data = NILP (Vinhibit_changing_match_data);
 
+  specpdl_ref count = SPECPDL_INDEX ();
   struct regexp_cache *cache_entry =
     compile_pattern (string,
                      preserve_match_data ? &search_regs : &search_regs_1,
@@ -1173,9 +1214,7 @@ search_buffer_re (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
       s2 = 0;
     }
 
-  specpdl_ref count = SPECPDL_INDEX ();
   freeze_buffer_relocation ();
-  freeze_pattern (cache_entry);
 
   while (n < 0)
     {
@@ -2275,6 +2314,392 @@ DEFUN ("re-search-forward", Fre_search_forward, Sre_search_forward, 1, 4,
   return search_command (regexp, bound, noerror, count, 1, true, false);
 }
 
+/* The regexps of a search_regexps call.  They are compiled
+   outside the regexp cache, which could not hold them all at once.  */
+
+struct region_search
+{
+  ptrdiff_t n;
+  struct re_pattern_buffer *bufs;
+  char *fastmaps;
+
+  /* Each regexp's next match can start no earlier than this byte
+     position, or anywhere if it is PTRDIFF_MAX.  */
+  ptrdiff_t *next;
+
+  /* The last occurrence found of each regexp's required literal, as an
+     offset in the accessible text; -1 if it was not looked for yet,
+     or -2 if there is no literal that can be looked for.  */
+  ptrdiff_t *must;
+
+  /* Indexes of the regexps worth trying where a character with a given
+     leading code starts, at the beginning of a line (BOL is 1) or
+     elsewhere (BOL is 0), are CANDS[CAND_START[BOL][C]] up to before
+     CANDS[CAND_START[BOL][C + 1]].  */
+  ptrdiff_t *cands;
+  ptrdiff_t cand_start[2][0401];
+
+  /* Whether a byte starts no match away from the beginning of a line,
+     so that it can be passed over without decoding the text.  */
+  bool skip[0400];
+
+  struct re_registers regs;
+};
+
+static void
+free_region_search (void *arg)
+{
+  struct region_search *rs = arg;
+  for (ptrdiff_t i = 0; i < rs->n; i++)
+    xfree (rs->bufs[i].buffer);
+  xfree (rs->bufs);
+  xfree (rs->fastmaps);
+  xfree (rs->next);
+  xfree (rs->must);
+  xfree (rs->cands);
+  xfree (rs->regs.start);
+  xfree (rs->regs.end);
+}
+
+/* Return the match data of the last match in RS, as integers.  */
+
+static Lisp_Object
+region_search_data (struct region_search *rs, struct re_pattern_buffer *bufp)
+{
+  Lisp_Object data = Qnil;
+  ptrdiff_t last = min (bufp->re_nsub, rs->regs.num_regs - 1);
+  while (last > 0 && rs->regs.start[last] < 0)
+    last--;
+  for (ptrdiff_t i = last; i >= 0; i--)
+    if (rs->regs.start[i] < 0)
+      data = Fcons (Qnil, Fcons (Qnil, data));
+    else
+      data = Fcons (make_fixnum (BYTE_TO_CHAR (rs->regs.start[i]
+					       + BEGV_BYTE)),
+		    Fcons (make_fixnum (BYTE_TO_CHAR (rs->regs.end[i]
+						      + BEGV_BYTE)),
+			   data));
+  return data;
+}
+
+/* Return the matches of each of REGEXPS, a list or vector of regexps
+   or nil, that start at or after START_BYTE and end at or before
+   LIM_BYTE, as 'search-regexps-in-region' does.  If FIRST, return
+   just the first of them.  */
+
+static Lisp_Object
+search_regexps (Lisp_Object regexps, ptrdiff_t start_byte,
+		ptrdiff_t lim_byte, bool first)
+{
+  if (!CONSP (regexps) && !NILP (regexps))
+    CHECK_VECTOR (regexps);
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+
+  /* This is so set_image_of_range_1 in regex-emacs.c can find the EQV
+     table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+  Lisp_Object trt = (!NILP (Vcase_fold_search)
+		     ? BVAR (current_buffer, case_canon_table) : Qnil);
+  const char *whitespace_regexp = (STRINGP (Vsearch_spaces_regexp)
+				   ? SSDATA (Vsearch_spaces_regexp) : NULL);
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  struct region_search rs = { .n = 0 };
+  record_unwind_protect_ptr (free_region_search, &rs);
+  ptrdiff_t n = XFIXNUM (Flength (regexps));
+  rs.bufs = xzalloc (n * sizeof *rs.bufs);
+  rs.fastmaps = xmalloc (n * 0400);
+  rs.next = xmalloc (n * sizeof *rs.next);
+  rs.must = xmalloc (n * sizeof *rs.must);
+  rs.cands = xmalloc (2 * 0400 * n * sizeof *rs.cands);
+
+  Lisp_Object seq = regexps;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object regexp;
+      if (CONSP (seq))
+	{
+	  regexp = XCAR (seq);
+	  seq = XCDR (seq);
+	}
+      else
+	regexp = AREF (regexps, i);
+      rs.next[i] = PTRDIFF_MAX;
+      rs.must[i] = -1;
+      rs.n = i + 1;
+      if (NILP (regexp))
+	continue;
+      CHECK_STRING (regexp);
+
+      struct re_pattern_buffer *bufp = &rs.bufs[i];
+      bufp->translate = trt;
+      bufp->multibyte = STRING_MULTIBYTE (regexp);
+      bufp->charset_unibyte = charset_unibyte;
+      const char *val = re_compile_pattern (SSDATA (regexp), SBYTES (regexp),
+					    false, whitespace_regexp, bufp);
+      if (val)
+	xsignal1 (Qinvalid_regexp, build_string (val));
+      bufp->target_multibyte = multibyte;
+      bufp->fastmap = rs.fastmaps + i * 0400;
+      re_compile_fastmap (bufp);
+      rs.next[i] = start_byte;
+    }
+
+  /* Lay out the candidates by leading code.  */
+  ptrdiff_t ncands = 0;
+  for (int bol = 0; bol < 2; bol++)
+    for (int c = 0; c < 0400; c++)
+      {
+	rs.cand_start[bol][c] = ncands;
+	for (ptrdiff_t i = 0; i < rs.n; i++)
+	  if (rs.next[i] != PTRDIFF_MAX
+	      && (bol || !re_begline_p (&rs.bufs[i]))
+	      && (rs.bufs[i].can_be_null || rs.bufs[i].fastmap[c]))
+	    rs.cands[ncands++] = i;
+	rs.cand_start[bol][c + 1] = ncands;
+      }
+  for (int c = 0; c < 0400; c++)
+    {
+      int lead = c;
+      if (c < 0x80 && !NILP (trt))
+	lead = RE_TRANSLATE (trt, c);
+      if (multibyte && 0x80 <= c && c < 0xC0)
+	/* Not a leading code: the rest of a character whose leading
+	   code was passed over.  */
+	rs.skip[c] = true;
+      else
+	rs.skip[c] = ((c < 0x80 || NILP (trt)) && lead < 0400
+		      && rs.cand_start[0][lead] == rs.cand_start[0][lead + 1]);
+    }
+
+  buffer_text_read_lock (current_buffer);
+
+  /* Get pointers and sizes of the two strings
+     that make up the visible portion of the buffer. */
+  unsigned char *p1 = BEGV_ADDR, *p2 = GAP_END_ADDR;
+  ptrdiff_t s1 = GPT_BYTE - BEGV_BYTE, s2 = ZV_BYTE - GPT_BYTE;
+  if (s1 < 0)
+    {
+      p2 = p1;
+      s2 = ZV_BYTE - BEGV_BYTE;
+      s1 = 0;
+    }
+  if (s2 < 0)
+    {
+      s1 = ZV_BYTE - BEGV_BYTE;
+      s2 = 0;
+    }
+  freeze_buffer_relocation ();
+
+  Lisp_Object hits = Qnil;
+  intmax_t quit_count = 0;
+  bool syntax_ready = false;
+  for (ptrdiff_t pos_byte = start_byte; pos_byte <= lim_byte; )
+    {
+      bool bol = (pos_byte == BEGV_BYTE
+		  || FETCH_BYTE (pos_byte - 1) == '\n');
+      if (!bol && pos_byte < lim_byte && rs.skip[FETCH_BYTE (pos_byte)])
+	{
+	  /* Go as far as the next place where a regexp could match,
+	     the beginning of the next line, or the gap.  */
+	  ptrdiff_t stop = (pos_byte < GPT_BYTE ? min (lim_byte, GPT_BYTE)
+			    : lim_byte);
+	  unsigned char *p = BYTE_POS_ADDR (pos_byte);
+	  unsigned char *q = p, *qlim = p + (stop - pos_byte);
+	  while (q < qlim && *q != '\n' && rs.skip[*q])
+	    q++;
+	  if (q < qlim && *q == '\n' && rs.skip['\n'])
+	    q++;
+	  pos_byte += q - p;
+	  rarely_quit (++quit_count);
+	  continue;
+	}
+      int len = 1, lead;
+      if (pos_byte == lim_byte)
+	/* Only a regexp that can match the null string can match here,
+	   and those are candidates for any character.  */
+	lead = 0;
+      else if (multibyte)
+	{
+	  int c = string_char_and_length (BYTE_POS_ADDR (pos_byte), &len);
+	  if (!NILP (trt))
+	    c = RE_TRANSLATE (trt, c);
+	  lead = CHAR_LEADING_CODE (c);
+	}
+      else
+	{
+	  lead = FETCH_BYTE (pos_byte);
+	  if (!NILP (trt))
+	    {
+	      int c = UNIBYTE_TO_CHAR (lead);
+	      int translated = RE_TRANSLATE (trt, c);
+	      if (translated != c
+		  && (c = CHAR_TO_BYTE_SAFE (translated)) >= 0)
+		lead = c;
+	    }
+	}
+
+      for (ptrdiff_t k = rs.cand_start[bol][lead];
+	   k < rs.cand_start[bol][lead + 1]; k++)
+	{
+	  ptrdiff_t i = rs.cands[k];
+	  struct re_pattern_buffer *bufp = &rs.bufs[i];
+	  if (rs.next[i] > pos_byte
+	      || (pos_byte == lim_byte && !bufp->can_be_null))
+	    continue;
+
+	  /* Skip to the next occurrence of the required literal, as
+	     're_search_2' does.  */
+	  ptrdiff_t offset = bufp->must_offset;
+	  ptrdiff_t from = pos_byte - BEGV_BYTE + max (offset, 0);
+	  if (rs.must[i] != -2 && rs.must[i] < from)
+	    {
+	      rs.must[i] = re_search_must (bufp, (char *) p1, s1,
+					   (char *) p2, s2, from,
+					   lim_byte - BEGV_BYTE);
+	      if (rs.must[i] == -1)
+		{
+		  rs.next[i] = PTRDIFF_MAX;
+		  continue;
+		}
+	    }
+	  if (offset >= 0 && rs.must[i] > from)
+	    {
+	      rs.next[i] = rs.must[i] - offset + BEGV_BYTE;
+	      continue;
+	    }
+	  re_set_registers (bufp, &rs.regs, rs.regs.num_regs,
+			    rs.regs.start, rs.regs.end);
+	  re_match_object = Qnil;
+	  ptrdiff_t val
+	    = (syntax_ready ? re_match_2_again : re_match_2)
+	    (bufp, (char *) p1, s1, (char *) p2, s2, pos_byte - BEGV_BYTE,
+	     &rs.regs, lim_byte - BEGV_BYTE);
+	  syntax_ready = true;
+	  if (val == -2)
+	    {
+	      unbind_to (count, Qnil);
+	      matcher_overflow ();
+	    }
+	  if (val >= 0)
+	    {
+	      hits = Fcons (Fcons (make_fixnum (i),
+				   region_search_data (&rs, bufp)),
+			    hits);
+	      /* The candidates come in the order of REGEXPS.  */
+	      if (first)
+		goto done;
+	      /* Do not find an empty match again.  */
+	      rs.next[i] = pos_byte + (val > 0 ? val : len);
+	    }
+	}
+
+      pos_byte += len;
+      rarely_quit (++quit_count);
+    }
+
+ done:
+  unbind_to (count, Qnil);
+  return Fnreverse (hits);
+}
+
+DEFUN ("search-regexps-in-region", Fsearch_regexps_in_region,
+       Ssearch_regexps_in_region, 3, 3, 0,
+       doc: /* Find the matches of each of REGEXPS between START and END.
+REGEXPS is a list or vector of regular expressions, any of which may
+be nil to find nothing.  A regexp's matches are those that successive
+calls of `re-search-forward' would find, starting at START with END as
+bound, and each starting where the previous match ended.
+
+Return a list of elements (INDEX . DATA) in order of where the matches
+start, with INDEX the position in REGEXPS of the regexp that matched,
+and DATA its match data as `match-data' with INTEGERS would return.
+Matches of several regexps at the same place are in the order of
+REGEXPS.  The match data of the caller is left alone.  Point does not
+move, so `\\=' in a regexp matches only at point.
+
+This is faster than searching for each regexp in turn, since it goes
+over the region only once, trying at each place just the regexps whose
+match could start with the character there.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.  */)
+  (Lisp_Object regexps, Lisp_Object start, Lisp_Object end)
+{
+  validate_region (&start, &end);
+  return search_regexps (regexps, CHAR_TO_BYTE (XFIXNUM (start)),
+			 CHAR_TO_BYTE (XFIXNUM (end)), false);
+}
+
+DEFUN ("search-forward-regexps", Fsearch_forward_regexps,
+       Ssearch_forward_regexps, 1, 3, 0,
+       doc: /* Search forward from point for the earliest match of any of REGEXPS.
+REGEXPS is a list or vector of regular expressions.  The match that
+starts first wins; if several regexps match at the same place, the
+one that comes first in REGEXPS wins.  Set point to the end of the
+occurrence found, set the match data as `re-search-forward' would for
+the winning regexp, and return its index in REGEXPS.
+
+This is faster than searching for each regexp in turn, since it goes
+over the text only once, trying at each place just the regexps whose
+match could start with the character there.
+
+The optional second argument BOUND is a buffer position that bounds
+  the search.  The match found must not end after that position.  A
+  value of nil means search to the end of the accessible portion of
+  the buffer.
+The optional third argument NOERROR indicates how errors are handled
+  when the search fails.  If it is nil or omitted, emit an error; if
+  it is t, simply return nil and do nothing; if it is neither nil nor
+  t, move to the limit of search and return nil.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.  */)
+  (Lisp_Object regexps, Lisp_Object bound, Lisp_Object noerror)
+{
+  ptrdiff_t lim, lim_byte;
+
+  if (NILP (bound))
+    lim = ZV, lim_byte = ZV_BYTE;
+  else
+    {
+      lim = fix_position (bound);
+      if (lim < PT)
+	error ("Invalid search bound (wrong side of point)");
+      if (lim > ZV)
+	lim = ZV, lim_byte = ZV_BYTE;
+      else
+	lim_byte = CHAR_TO_BYTE (lim);
+    }
+
+  Lisp_Object hit = search_regexps (regexps, PT_BYTE, lim_byte, true);
+  if (NILP (hit))
+    {
+      if (NILP (noerror))
+	xsignal1 (Qsearch_failed, regexps);
+      if (!EQ (noerror, Qt) && current_thread->cooperative)
+	SET_PT_BOTH (lim, lim_byte);
+      return Qnil;
+    }
+
+  /* Match the winner again where it was found, this time recording
+     the match data.  */
+  Lisp_Object index = XCAR (XCAR (hit));
+  ptrdiff_t beg = XFIXNUM (XCAR (XCDR (XCAR (hit))));
+  Lisp_Object trt = (!NILP (Vcase_fold_search)
+		     ? BVAR (current_buffer, case_canon_table) : Qnil);
+  Lisp_Object inverse_trt = (!NILP (Vcase_fold_search)
+			     ? BVAR (current_buffer, case_eqv_table) : Qnil);
+  EMACS_INT np = search_buffer_re (Felt (regexps, index),
+				   beg, CHAR_TO_BYTE (beg),
+				   lim, lim_byte, 1, trt, inverse_trt, false);
+  eassert (BEGV <= np && np <= ZV);
+  if (current_thread->cooperative)
+    SET_PT (np);
+  return index;
+}
+
 DEFUN ("posix-search-backward", Fposix_search_backward, Sposix_search_backward, 1, 4,
        "sPosix search backward: ",
        doc: /* Search backward from point for match for REGEXP according to Posix rules.
@@ -3330,6 +3755,7 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
 If RAW is non-nil, just return the actual bytecode.  */)
   (Lisp_Object regexp, Lisp_Object raw)
 {
+  specpdl_ref count = SPECPDL_INDEX ();
   struct regexp_cache *cache_entry
     = compile_pattern (regexp, NULL,
                        (!NILP (Vcase_fold_search)
@@ -3338,8 +3764,9 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
                        !NILP (BVAR (current_buffer,
                                     enable_multibyte_characters)));
   if (!NILP (raw))
-    return make_unibyte_string ((char *) cache_entry->buf.buffer,
-                                cache_entry->buf.used);
+    return unbind_to (count,
+		      make_unibyte_string ((char *) cache_entry->buf.buffer,
+					   cache_entry->buf.used));
   else
     {                           /* FIXME: Why ENABLE_CHECKING?  */
 #if !defined ENABLE_CHECKING
@@ -3353,13 +3780,14 @@ DEFUN ("re--describe-compiled", Fre__describe_compiled, Sre__describe_compiled,
       print_compiled_pattern (f, &cache_entry->buf);
       fclose (f);
       if (!buffer)
-        return Qnil;
+        return unbind_to (count, Qnil);
       Lisp_Object description = make_unibyte_string (buffer, size);
       free (buffer);
-      return description;
+      return unbind_to (count, description);
 #else /* ENABLE_CHECKING && !HAVE_OPEN_MEMSTREAM */
       print_compiled_pattern (stderr, &cache_entry->buf);
-      return build_string ("Description was sent to standard error");
+      return unbind_to (count,
+			build_string ("Description was sent to standard error"));
 #endif /* !ENABLE_CHECKING */
     }
 }
@@ -3401,9 +3829,6 @@ syms_of_search (void)
   Fput (Qinvalid_regexp, Qerror_message,
 	build_pure_c_string ("Invalid regexp"));
 
-  re_match_object = Qnil;
-  staticpro (&re_match_object);
-
   DEFVAR_LISP ("search-spaces-regexp", Vsearch_spaces_regexp,
       doc: /* Regexp to substitute for bunches of spaces in regexp search.
 Some commands use this for user-specified regexps.
@@ -3430,6 +3855,8 @@ syms_of_search (void)
   defsubr (&Ssearch_forward);
   defsubr (&Ssearch_backward);
   defsubr (&Sre_search_forward);
+  defsubr (&Ssearch_forward_regexps);
+  defsubr (&Ssearch_regexps_in_region);
   defsubr (&Sre_search_backward);
   defsubr (&Sposix_search_forward);
   defsubr (&Sposix_search_backward);
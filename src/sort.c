@@ -102,20 +102,92 @@ #define MERGESTATE_TEMP_SIZE 256
 
   struct reloc reloc;
 
-  /* PREDICATE is the lisp comparison predicate for the sort.  */
+  /* PREDICATE is the lisp comparison predicate for the sort.
+     PRED_FUN compares two elements by PREDICATE, either by calling it
+     or, for a few well-known predicates, inline.  */
 
   Lisp_Object predicate;
+  bool (*pred_fun) (Lisp_Object, Lisp_Object, Lisp_Object);
+
+  /* If sorting by key, KEYS holds the precomputed key of each element
+     and the array being sorted holds fixnum indices into it.  */
+
+  Lisp_Object *keys;
 } merge_state;
 
 
 /* Return true iff (PREDICATE A B) is non-nil.  */
 
-static inline bool
-inorder (const Lisp_Object predicate, const Lisp_Object a, const Lisp_Object b)
+static bool
+order_pred_lisp (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
 {
   return !NILP (call2 (predicate, a, b));
 }
 
+/* Return true iff (< A B), without a funcall.  */
+
+static bool
+order_pred_lt (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  if (FIXNUMP (a) && FIXNUMP (b))
+    return XFIXNUM (a) < XFIXNUM (b);
+  if (FLOATP (a) && FLOATP (b))
+    return XFLOAT_DATA (a) < XFLOAT_DATA (b);
+  return !NILP (arithcompare (a, b, ARITH_LESS));
+}
+
+/* Return true iff (> A B), without a funcall.  */
+
+static bool
+order_pred_gt (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  return order_pred_lt (predicate, b, a);
+}
+
+/* Return true iff (string< A B), without a funcall.  */
+
+static bool
+order_pred_string_lt (Lisp_Object predicate, Lisp_Object a, Lisp_Object b)
+{
+  return !NILP (Fstring_lessp (a, b));
+}
+
+/* Return the inline comparison function equivalent to PREDICATE, or
+   order_pred_lisp if there is none.  Only the builtins themselves
+   qualify, so that a redefined or advised `<' is still called.  */
+
+static bool (*
+resolve_pred_fun (Lisp_Object predicate)) (Lisp_Object, Lisp_Object,
+					   Lisp_Object)
+{
+  Lisp_Object fun = SYMBOLP (predicate) ? indirect_function (predicate)
+					: predicate;
+  if (SUBRP (fun))
+    {
+      struct Lisp_Subr *subr = XSUBR (fun);
+      if (subr->function.aMANY == Flss)
+	return order_pred_lt;
+      if (subr->function.aMANY == Fgtr)
+	return order_pred_gt;
+      if (subr->function.a2 == Fstring_lessp)
+	return order_pred_string_lt;
+    }
+  return order_pred_lisp;
+}
+
+/* Return true iff A should sort before B.  */
+
+static inline bool
+inorder (const merge_state *ms, Lisp_Object a, Lisp_Object b)
+{
+  if (ms->keys)
+    {
+      a = ms->keys[XFIXNUM (a)];
+      b = ms->keys[XFIXNUM (b)];
+    }
+  return ms->pred_fun (ms->predicate, a, b);
+}
+
 
 /* Sort the list starting at LO and ending at HI using a stable binary
    insertion sort algorithm. On entry the sublist [LO, START) (with
@@ -127,8 +199,6 @@ inorder (const Lisp_Object predicate, const Lisp_Object a, const Lisp_Object b)
 binarysort (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
 	    Lisp_Object *start)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (lo <= start && start <= hi);
   if (lo == start)
     ++start;
@@ -141,7 +211,7 @@ binarysort (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
       eassume (l < r);
       do {
 	Lisp_Object *p = l + ((r - l) >> 1);
-	if (inorder (pred, pivot, *p))
+	if (inorder (ms, pivot, *p))
 	  r = p;
 	else
 	  l = p + 1;
@@ -167,8 +237,6 @@ binarysort (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
 count_run (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
 	   bool *descending)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (lo < hi);
   *descending = 0;
   ++lo;
@@ -177,12 +245,12 @@ count_run (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
     return n;
 
   n = 2;
-  if (inorder (pred, lo[0], lo[-1]))
+  if (inorder (ms, lo[0], lo[-1]))
     {
       *descending = 1;
       for (lo = lo + 1; lo < hi; ++lo, ++n)
 	{
-	  if (!inorder (pred, lo[0], lo[-1]))
+	  if (!inorder (ms, lo[0], lo[-1]))
 	    break;
 	}
     }
@@ -190,7 +258,7 @@ count_run (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
     {
       for (lo = lo + 1; lo < hi; ++lo, ++n)
 	{
-	  if (inorder (pred, lo[0], lo[-1]))
+	  if (inorder (ms, lo[0], lo[-1]))
 	    break;
 	}
     }
@@ -223,21 +291,19 @@ count_run (merge_state *ms, Lisp_Object *lo, const Lisp_Object *hi,
 gallop_left (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
 	     const ptrdiff_t n, const ptrdiff_t hint)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (a && n > 0 && hint >= 0 && hint < n);
 
   a += hint;
   ptrdiff_t lastofs = 0;
   ptrdiff_t ofs = 1;
-  if (inorder (pred, *a, key))
+  if (inorder (ms, *a, key))
     {
       /* When a[hint] < key, gallop right until
 	 a[hint + lastofs] < key <= a[hint + ofs].  */
       const ptrdiff_t maxofs = n - hint; /* This is one after the end of a.  */
       while (ofs < maxofs)
 	{
-	  if (inorder (pred, a[ofs], key))
+	  if (inorder (ms, a[ofs], key))
 	    {
 	      lastofs = ofs;
 	      eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
@@ -259,7 +325,7 @@ gallop_left (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
       const ptrdiff_t maxofs = hint + 1;        /* Here &a[0] is lowest.  */
       while (ofs < maxofs)
 	{
-	  if (inorder (pred, a[-ofs], key))
+	  if (inorder (ms, a[-ofs], key))
 	    break;
 	  /* Here key <= a[hint - ofs].  */
 	  lastofs = ofs;
@@ -284,7 +350,7 @@ gallop_left (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
     {
       ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
 
-      if (inorder (pred, a[m], key))
+      if (inorder (ms, a[m], key))
 	lastofs = m + 1;            /* Here a[m] < key.  */
       else
 	ofs = m;                    /* Here key <= a[m].  */
@@ -307,21 +373,19 @@ gallop_left (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
 gallop_right (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
 	      const ptrdiff_t n, const ptrdiff_t hint)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (a && n > 0 && hint >= 0 && hint < n);
 
   a += hint;
   ptrdiff_t lastofs = 0;
   ptrdiff_t ofs = 1;
-  if (inorder (pred, key, *a))
+  if (inorder (ms, key, *a))
     {
       /* When key < a[hint], gallop left until
 	 a[hint - ofs] <= key < a[hint - lastofs].  */
       const ptrdiff_t maxofs = hint + 1;        /* Here &a[0] is lowest.  */
       while (ofs < maxofs)
 	{
-	  if (inorder (pred, key, a[-ofs]))
+	  if (inorder (ms, key, a[-ofs]))
 	    {
 	      lastofs = ofs;
 	      eassume (ofs <= (PTRDIFF_MAX - 1) / 2);
@@ -344,7 +408,7 @@ gallop_right (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
       const ptrdiff_t maxofs = n - hint;        /* Here &a[n-1] is highest.  */
       while (ofs < maxofs)
 	{
-	  if (inorder (pred, key, a[ofs]))
+	  if (inorder (ms, key, a[ofs]))
 	    break;
 	  /* Here a[hint + ofs] <= key.  */
 	  lastofs = ofs;
@@ -368,7 +432,7 @@ gallop_right (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
     {
       ptrdiff_t m = lastofs + ((ofs - lastofs) >> 1);
 
-      if (inorder (pred, key, a[m]))
+      if (inorder (ms, key, a[m]))
 	ofs = m;                    /* Here key < a[m].  */
       else
 	lastofs = m + 1;            /* Here a[m] <= key.  */
@@ -380,7 +444,9 @@ gallop_right (merge_state *ms, const Lisp_Object key, Lisp_Object *a,
 
 static void
 merge_init (merge_state *ms, const ptrdiff_t list_size, Lisp_Object *lo,
-	    const Lisp_Object predicate)
+	    const Lisp_Object predicate,
+	    bool (*pred_fun) (Lisp_Object, Lisp_Object, Lisp_Object),
+	    Lisp_Object *keys)
 {
   eassume (ms != NULL);
 
@@ -392,6 +458,8 @@ merge_init (merge_state *ms, const ptrdiff_t list_size, Lisp_Object *lo,
   ms->listlen = list_size;
   ms->listbase = lo;
   ms->predicate = predicate;
+  ms->pred_fun = pred_fun;
+  ms->keys = keys;
   ms->reloc = (struct reloc){NULL, NULL, NULL, 0};
 }
 
@@ -491,8 +559,6 @@ needmem (merge_state *ms, ptrdiff_t na)
 merge_lo (merge_state *ms, Lisp_Object *ssa, ptrdiff_t na, Lisp_Object *ssb,
 	  ptrdiff_t nb)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (ms && ssa && ssb && na > 0 && nb > 0);
   eassume (ssa + na == ssb);
   needmem (ms, na);
@@ -519,7 +585,7 @@ merge_lo (merge_state *ms, Lisp_Object *ssa, ptrdiff_t na, Lisp_Object *ssb,
       for (;;)
 	{
 	  eassume (na > 1 && nb > 0);
-	  if (inorder (pred, *ssb, *ssa))
+	  if (inorder (ms, *ssb, *ssa))
 	    {
 	      *dest++ = *ssb++ ;
 	      ++bcount;
@@ -616,8 +682,6 @@ merge_lo (merge_state *ms, Lisp_Object *ssa, ptrdiff_t na, Lisp_Object *ssb,
 merge_hi (merge_state *ms, Lisp_Object *ssa, ptrdiff_t na,
 	  Lisp_Object *ssb, ptrdiff_t nb)
 {
-  Lisp_Object pred = ms->predicate;
-
   eassume (ms && ssa && ssb && na > 0 && nb > 0);
   eassume (ssa + na == ssb);
   needmem (ms, nb);
@@ -645,7 +709,7 @@ merge_hi (merge_state *ms, Lisp_Object *ssa, ptrdiff_t na,
 
     for (;;) {
       eassume (na > 0 && nb > 1);
-      if (inorder (pred, *ssb, *ssa))
+      if (inorder (ms, *ssb, *ssa))
 	{
 	  *dest-- = *ssa--;
 	  ++acount;
@@ -908,12 +972,38 @@ reverse_vector (Lisp_Object *s, const ptrdiff_t n)
     }
 }
 
+/* An array of fixnum indices sorted in place of the elements ELTS
+   when sorting by key.  */
+
+struct sort_decoration
+{
+  Lisp_Object *seq;
+  Lisp_Object *elts;
+  ptrdiff_t length;
+};
+
+/* Replace the indices in the sorted array by their elements.  This
+   also runs upon a nonlocal exit, which leaves the indices in some
+   permutation, so that the sequence never loses its elements.  */
+
+static void
+undecorate (void *arg)
+{
+  struct sort_decoration *d = arg;
+  for (ptrdiff_t i = 0; i < d->length; i++)
+    d->seq[i] = d->elts[XFIXNUM (d->seq[i])];
+}
+
 /* Sort the array SEQ with LENGTH elements in the order determined by
-   PREDICATE.  */
+   PREDICATE.  If KEY is non-nil, call it once on each element and
+   compare the results by PREDICATE instead of the elements.  */
 
 void
-tim_sort (Lisp_Object predicate, Lisp_Object *seq, const ptrdiff_t length)
+tim_sort (Lisp_Object predicate, Lisp_Object key, Lisp_Object *seq,
+	  const ptrdiff_t length)
 {
+  bool (*pred_fun) (Lisp_Object, Lisp_Object, Lisp_Object)
+    = resolve_pred_fun (predicate);
   if (SYMBOLP (predicate))
     {
       /* Attempt to resolve the function as far as possible ahead of time,
@@ -929,8 +1019,31 @@ tim_sort (Lisp_Object predicate, Lisp_Object *seq, const ptrdiff_t length)
 
   merge_state ms;
   Lisp_Object *lo = seq;
+  Lisp_Object *keys = NULL;
+  struct sort_decoration decoration;
+  specpdl_ref count = SPECPDL_INDEX ();
+  USE_SAFE_ALLOCA;
+
+  if (!NILP (key))
+    {
+      /* Decorate: compute each key once, and sort indices into KEYS
+	 rather than the elements themselves, so that the comparisons
+	 need not call KEY again.  */
+      Lisp_Object *elts;
+      SAFE_ALLOCA_LISP (keys, length);
+      SAFE_ALLOCA_LISP (elts, length);
+      for (ptrdiff_t i = 0; i < length; i++)
+	{
+	  keys[i] = call1 (key, seq[i]);
+	  elts[i] = seq[i];
+	}
+      for (ptrdiff_t i = 0; i < length; i++)
+	seq[i] = make_fixnum (i);
+      decoration = (struct sort_decoration) { seq, elts, length };
+      record_unwind_protect_ptr (undecorate, &decoration);
+    }
 
-  merge_init (&ms, length, lo, predicate);
+  merge_init (&ms, length, lo, predicate, pred_fun, keys);
 
   /* March over the array once, left to right, finding natural runs,
      and extending short natural runs to minrun elements.  */
@@ -970,4 +1083,5 @@ tim_sort (Lisp_Object predicate, Lisp_Object *seq, const ptrdiff_t length)
 
   if (ms.a != ms.temparray)
     unbind_to (ms.count, Qnil);
+  SAFE_FREE_UNBIND_TO (count, Qnil);
 }
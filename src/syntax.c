@@ -19,6 +19,8 @@
 
 #include <config.h>
 
+#include <nproc.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -146,6 +148,7 @@ SYNTAX_COMEND_FIRST (int c)
     int comstyle;  /* comment style a=0, or b=1, or ST_COMMENT_STYLE.  */
     bool quoted;   /* True if just after an escape char at end of parsing.  */
     EMACS_INT mindepth;	/* Minimum depth seen while scanning.  */
+    EMACS_INT maxdepth;	/* Maximum depth seen while scanning.  */
     /* Char number of most recent start-of-expression at current level */
     ptrdiff_t thislevelstart;
     /* Char number of start of containing expression */
@@ -161,6 +164,26 @@ SYNTAX_COMEND_FIRST (int c)
                         or Sescape, etc.  Smax otherwise. */
   };
 
+/* Within a paren level, where the last sexp started, and where the
+   one before it started, once completed.  */
+struct level { ptrdiff_t last, prev; };
+
+enum
+  {
+    MAX_LEVELS = 100,		/* Deeper levels all share the last.  */
+    INHERITED_POS = -2	/* A position before a speculative scan.  */
+  };
+
+/* True while scanning speculatively, when quitting is unsafe.  */
+PER_THREAD_STATIC bool scan_speculatively;
+
+static void
+scan_rarely_quit (unsigned short int count)
+{
+  if (!scan_speculatively)
+    rarely_quit (count);
+}
+
 /* These variables are a cache for finding the start of a defun.
    find_start_pos is the place for which the defun start was found.
    find_start_value is the defun start position found for it.
@@ -182,7 +205,7 @@ SYNTAX_COMEND_FIRST (int c)
 static Lisp_Object scan_lists (EMACS_INT, EMACS_INT, EMACS_INT, bool);
 static void scan_sexps_forward (struct lisp_parse_state *,
                                 ptrdiff_t, ptrdiff_t, ptrdiff_t, EMACS_INT,
-                                bool, int);
+                                bool, int, struct level *);
 static void internalize_parse_state (Lisp_Object, struct lisp_parse_state *);
 static bool in_classes (int c, int num_classes, const unsigned char *classes);
 static void parse_sexp_propertize (ptrdiff_t charpos);
@@ -201,8 +224,6 @@ syntax_prefix_flag_p (int c)
   return SYNTAX_FLAGS_PREFIX (SYNTAX_WITH_FLAGS (c));
 }
 
-struct gl_state_s gl_state;		/* Global state of syntax parser.  */
-
 enum { INTERVALS_AT_ONCE = 10 };	/* 1 + max-number of intervals
 					   to scan to property-change.  */
 
@@ -272,6 +293,14 @@ RE_SETUP_SYNTAX_TABLE_FOR_OBJECT (Lisp_Object object,
 {
   SETUP_BUFFER_SYNTAX_TABLE ();
   gl_state.object = object;
+  if (!current_thread->cooperative)
+    {
+      /* Text properties are off limits to uncooperative threads, see
+	 buffer_text_read_lock.  */
+      gl_state.b_property = 0;
+      gl_state.e_property = PTRDIFF_MAX;
+      return;
+    }
   if (BUFFERP (gl_state.object))
     {
       struct buffer *buf = XBUFFER (gl_state.object);
@@ -922,7 +951,7 @@ back_comment (ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
 	  scan_sexps_forward (&state,
 			      defun_start, defun_start_byte,
 			      comment_end, TYPE_MINIMUM (EMACS_INT),
-			      0, 0);
+			      0, 0, NULL);
 	  defun_start = comment_end;
 	  if (!adjusted)
 	    {
@@ -2392,7 +2421,7 @@ forw_comment (ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t stop,
 	  nesting++;
 	}
 
-      rarely_quit (++quit_count);
+      scan_rarely_quit (++quit_count);
     }
   *charpos_ptr = from;
   *bytepos_ptr = from_byte;
@@ -3138,23 +3167,31 @@ in_2char_comment_start (struct lisp_parse_state *state,
    If STOPBEFORE, stop at the start of an atom.
    If COMMENTSTOP is 1, stop at the start of a comment.
    If COMMENTSTOP is -1, stop at the start or end of a comment,
-   after the beginning of a string, or after the end of a string.  */
+   after the beginning of a string, or after the end of a string.
+
+   If SPECULATIVE, it points to 2 * MAX_LEVELS levels, of which the
+   first half stand for the levels enclosing FROM, as yet unknown,
+   and the second half are scanned from.  The depths recorded in
+   STATE are then relative to FROM, STATE->levelstarts is neither read
+   nor set, and gl_state must already be set up for FROM.  */
 
 static void
 scan_sexps_forward (struct lisp_parse_state *state,
 		    ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t end,
 		    EMACS_INT targetdepth, bool stopbefore,
-		    int commentstop)
+		    int commentstop, struct level *speculative)
 {
   enum syntaxcode code;
-  struct level { ptrdiff_t last, prev; };
-  struct level levelstart[100];
+  struct level levels[MAX_LEVELS];
+  struct level *levelstart = speculative ? speculative + MAX_LEVELS : levels;
+  struct level *levelfloor = speculative ? speculative : levelstart;
   struct level *curlevel = levelstart;
-  struct level *endlevel = levelstart + 100;
+  struct level *endlevel = levelstart + MAX_LEVELS;
   EMACS_INT depth;      /* Paren depth of current scanning location.
 			   level - levelstart equals this except
 			   when the depth becomes negative.  */
   EMACS_INT mindepth;		/* Lowest DEPTH value seen.  */
+  EMACS_INT maxdepth;		/* Highest DEPTH value seen.  */
   bool start_quoted = 0;	/* True means starting after a char quote.  */
   Lisp_Object tem;
   ptrdiff_t prev_from;		/* Keep one character before FROM.  */
@@ -3184,14 +3221,18 @@ #define INC_FROM				\
        UPDATE_SYNTAX_TABLE_FORWARD (from);	\
   } while (0)
 
-  maybe_quit ();
+  if (!scan_speculatively)
+    maybe_quit ();
 
   depth = state->depth;
   start_quoted = state->quoted;
   prev_prev_from_syntax = Smax;
   prev_from_syntax = state->prev_syntax;
 
-  tem = state->levelstarts;
+  for (struct level *l = levelfloor; l < levelstart; ++l)
+    l->last = l->prev = INHERITED_POS;
+
+  tem = speculative ? Qnil : state->levelstarts;
   while (!NILP (tem))		/* >= second enclosing sexps.  */
     {
       Lisp_Object temhd = Fcar (tem);
@@ -3207,9 +3248,10 @@ #define INC_FROM				\
   curlevel->last = -1;
 
   state->quoted = 0;
-  mindepth = depth;
+  mindepth = maxdepth = depth;
 
-  SETUP_SYNTAX_TABLE (from, 1);
+  if (!speculative)
+    SETUP_SYNTAX_TABLE (from, 1);
 
   /* Enter the loop at a place appropriate for initial state.  */
 
@@ -3235,7 +3277,7 @@ #define INC_FROM				\
 
   while (from < end)
     {
-      rarely_quit (++quit_count);
+      scan_rarely_quit (++quit_count);
       INC_FROM;
 
       if ((from < end)
@@ -3292,7 +3334,7 @@ #define INC_FROM				\
 		  goto symdone;
 		}
 	      INC_FROM;
-	      rarely_quit (++quit_count);
+	      scan_rarely_quit (++quit_count);
 	    }
 	symdone:
 	  curlevel->prev = curlevel->last;
@@ -3346,6 +3388,8 @@ #define INC_FROM				\
 	case Sopen:
 	  if (stopbefore) goto stop;  /* this arg means stop at sexp start */
 	  depth++;
+	  if (depth > maxdepth)
+	    maxdepth = depth;
 	  /* curlevel++->last ran into compiler bug on Apollo */
 	  curlevel->last = prev_from;
 	  if (++curlevel == endlevel)
@@ -3359,7 +3403,7 @@ #define INC_FROM				\
 	  depth--;
 	  if (depth < mindepth)
 	    mindepth = depth;
-	  if (curlevel != levelstart)
+	  if (curlevel != levelfloor)
 	    curlevel--;
 	  curlevel->prev = curlevel->last;
 	  if (targetdepth == depth) goto done;
@@ -3410,7 +3454,7 @@ #define INC_FROM				\
 		    break;
 		  }
 		INC_FROM;
-		rarely_quit (++quit_count);
+		scan_rarely_quit (++quit_count);
 	      }
 	  }
 	string_end:
@@ -3441,15 +3485,19 @@ #define INC_FROM				\
  done:
   state->depth = depth;
   state->mindepth = mindepth;
+  state->maxdepth = maxdepth;
   state->thislevelstart = curlevel->prev;
   state->prevlevelstart
-    = (curlevel == levelstart) ? -1 : (curlevel - 1)->last;
+    = (curlevel == levelfloor) ? -1 : (curlevel - 1)->last;
   state->location = from;
   state->location_byte = from_byte;
-  state->levelstarts = Qnil;
-  while (curlevel > levelstart)
-    state->levelstarts = Fcons (make_fixnum ((--curlevel)->last),
-                                state->levelstarts);
+  if (!speculative)
+    {
+      state->levelstarts = Qnil;
+      while (curlevel > levelstart)
+	state->levelstarts = Fcons (make_fixnum ((--curlevel)->last),
+				    state->levelstarts);
+    }
   state->prev_syntax = (SYNTAX_FLAGS_COMSTARTEND_FIRST (prev_from_syntax)
                         || state->quoted) ? prev_from_syntax : Smax;
 }
@@ -3521,6 +3569,498 @@ internalize_parse_state (Lisp_Object external, struct lisp_parse_state *state)
     }
 }
 
+/* Convert an internal parse state to the list parse-partial-sexp
+   returns.  */
+static Lisp_Object
+externalize_parse_state (struct lisp_parse_state *state)
+{
+  return
+    Fcons (make_fixnum (state->depth),
+	   Fcons (state->prevlevelstart < 0
+		  ? Qnil : make_fixnum (state->prevlevelstart),
+	     Fcons (state->thislevelstart < 0
+		    ? Qnil : make_fixnum (state->thislevelstart),
+	       Fcons (state->instring >= 0
+		      ? (state->instring == ST_STRING_STYLE
+			 ? Qt : make_fixnum (state->instring)) : Qnil,
+		 Fcons (state->incomment < 0 ? Qt :
+			(state->incomment == 0 ? Qnil :
+			 make_fixnum (state->incomment)),
+		   Fcons (state->quoted ? Qt : Qnil,
+		     Fcons (make_fixnum (state->mindepth),
+		       Fcons ((state->comstyle
+			       ? (state->comstyle == ST_COMMENT_STYLE
+				  ? Qsyntax_table
+				  : make_fixnum (state->comstyle))
+			       : Qnil),
+		         Fcons (((state->incomment
+                                  || (state->instring >= 0))
+                                 ? make_fixnum (state->comstr_start)
+                                 : Qnil),
+			   Fcons (state->levelstarts,
+                             Fcons (state->prev_syntax == Smax
+                                    ? Qnil
+                                    : make_fixnum (state->prev_syntax),
+                                Qnil)))))))))));
+}
+
+#ifdef HAVE_GCC_TLS
+
+/* Parsing in parallel.
+
+   parse-partial-sexp-states parses a long stretch of text segment by
+   segment, the state at the end of each segment being the state at
+   the start of the next.  To scan segments concurrently, worker
+   threads scan each from a guess at its starting mode, i.e., its
+   state less paren depth and levels, which are kept relative to the
+   segment's start.  The first guess is being outside any string or
+   comment.
+
+   Segments are then reconciled in order.  A scan guessing the actual
+   mode at a segment's start combines with the state there into the
+   state at its end.  At the first wrong guess, each remaining segment
+   is scanned again from the modes that scans of the segment before
+   ended in, and so on until guesses are right.  Modes being few in
+   practice (within a string, a comment, or neither), this takes few
+   rounds, and little more work than scanning once.
+
+   Workers only read the buffer and its intervals, the latter after
+   syntax-table properties are computed up front.  */
+
+enum
+  {
+    PARSE_GUESSES = 4,		/* Scans per segment at most.  */
+    PARSE_GUESS_LEVELS = 16,	/* Levels kept per scan.  */
+    PARSE_WORKERS = 16		/* Threads per parse at most.  */
+  };
+
+/* What of a parse state determines how scanning proceeds.  */
+struct parse_mode
+{
+  int instring;
+  EMACS_INT incomment;
+  int comstyle;
+  bool quoted;
+  int prev_syntax;
+};
+
+/* A scan of a segment from a guessed mode.  */
+struct parse_guess
+{
+  struct parse_mode mode;
+  bool scanned;
+
+  /* Whether the scan stayed within the levels kept.  */
+  bool kept;
+
+  /* State at the segment's end, depths relative to its start.  */
+  struct lisp_parse_state state;
+
+  /* Starts of the last sexps at depths STATE.mindepth up to
+     STATE.depth, or INHERITED_POS.  */
+  ptrdiff_t lasts[PARSE_GUESS_LEVELS];
+};
+
+struct parse_segment
+{
+  ptrdiff_t from, from_byte, to;
+
+  /* The syntax table state at FROM.  */
+  struct gl_state_s gl;
+
+  struct parse_guess guesses[PARSE_GUESSES];
+  int nguesses;
+};
+
+/* The parse under way, shared with its workers.  The workers are
+   started on first use and kept, each round of scans waking them.  */
+static struct
+{
+  sys_mutex_t mutex;
+  sys_cond_t work, done;
+  bool initialized;
+
+  /* Whether workers are to stop taking segments.  */
+  bool cancel;
+
+  struct buffer *buffer;
+  struct parse_segment *segments;
+  ptrdiff_t next, nsegments;
+  int nthreads, nworkers, running;
+  unsigned int round;
+} parse_pool;
+
+static bool
+parse_mode_eq (struct parse_mode const *a, struct parse_mode const *b)
+{
+  return (a->instring == b->instring
+	  && a->incomment == b->incomment
+	  && a->comstyle == b->comstyle
+	  && a->quoted == b->quoted
+	  && a->prev_syntax == b->prev_syntax);
+}
+
+static struct parse_mode
+parse_mode_of (struct lisp_parse_state const *state)
+{
+  return (struct parse_mode) { .instring = state->instring,
+			       .incomment = state->incomment,
+			       .comstyle = state->comstyle,
+			       .quoted = state->quoted,
+			       .prev_syntax = state->prev_syntax };
+}
+
+/* Scan SEG from the mode guessed by G.  */
+
+static void
+parse_guess_scan (struct parse_segment *seg, struct parse_guess *g)
+{
+  struct level levels[2 * MAX_LEVELS];
+  struct lisp_parse_state *state = &g->state;
+
+  state->depth = 0;
+  state->instring = g->mode.instring;
+  state->incomment = g->mode.incomment;
+  state->comstyle = g->mode.comstyle;
+  state->quoted = g->mode.quoted;
+  state->prev_syntax = g->mode.prev_syntax;
+  state->comstr_start = INHERITED_POS;
+  state->levelstarts = Qnil;
+  gl_state = seg->gl;
+  scan_sexps_forward (state, seg->from, seg->from_byte, seg->to,
+		      TYPE_MINIMUM (EMACS_INT), false, 0, levels);
+
+  EMACS_INT mindepth = state->mindepth, depth = state->depth;
+  g->kept = (-MAX_LEVELS < mindepth && state->maxdepth < MAX_LEVELS
+	     && depth - mindepth <= PARSE_GUESS_LEVELS);
+  if (g->kept)
+    for (EMACS_INT d = mindepth; d < depth; ++d)
+      g->lasts[d - mindepth] = levels[MAX_LEVELS + d].last;
+  g->scanned = true;
+}
+
+/* Return the index of the next segment to scan, or -1 if none is
+   left or workers are to stop.  */
+
+static ptrdiff_t
+parse_take (bool worker)
+{
+  sys_mutex_lock (&parse_pool.mutex);
+  ptrdiff_t k = ((!worker || !parse_pool.cancel)
+		 && parse_pool.next < parse_pool.nsegments
+		 ? parse_pool.next++ : -1);
+  sys_mutex_unlock (&parse_pool.mutex);
+  return k;
+}
+
+static void
+parse_scan (ptrdiff_t k)
+{
+  struct parse_segment *seg = &parse_pool.segments[k];
+  for (int i = 0; i < seg->nguesses; ++i)
+    if (!seg->guesses[i].scanned)
+      parse_guess_scan (seg, &seg->guesses[i]);
+}
+
+static void *
+parse_worker (void *arg)
+{
+  /* Enough of a thread for the scanner.  */
+  struct thread_state self = { .m_current_buffer = NULL };
+  current_thread = &self;
+  scan_speculatively = true;
+
+  /* The round before the first this worker is to join.  */
+  unsigned int round = (uintptr_t) arg;
+
+  sys_mutex_lock (&parse_pool.mutex);
+  for (;;)
+    {
+      while (parse_pool.round == round)
+	sys_cond_wait (&parse_pool.work, &parse_pool.mutex);
+      round = parse_pool.round;
+      self.m_current_buffer = parse_pool.buffer;
+      sys_mutex_unlock (&parse_pool.mutex);
+
+      for (ptrdiff_t k; (k = parse_take (true)) >= 0; )
+	parse_scan (k);
+
+      sys_mutex_lock (&parse_pool.mutex);
+      if (--parse_pool.running == 0)
+	sys_cond_signal (&parse_pool.done);
+    }
+  return NULL;
+}
+
+/* Start the workers on a round of scans.  */
+
+static void
+parse_wake (void)
+{
+  sys_mutex_lock (&parse_pool.mutex);
+  parse_pool.running = parse_pool.nworkers;
+  parse_pool.round++;
+  sys_cond_broadcast (&parse_pool.work);
+  sys_mutex_unlock (&parse_pool.mutex);
+}
+
+/* Stop the workers taking segments, and wait for those they have.  */
+
+static void
+parse_stop (void)
+{
+  sys_mutex_lock (&parse_pool.mutex);
+  parse_pool.cancel = true;
+  while (parse_pool.running)
+    sys_cond_wait (&parse_pool.done, &parse_pool.mutex);
+  parse_pool.cancel = false;
+  sys_mutex_unlock (&parse_pool.mutex);
+}
+
+/* Scan the unscanned guesses of SEGMENTS from FROM to N.  The current
+   thread scans along with the workers, and between segments stops
+   them to quit.  */
+
+static void
+parse_run (struct parse_segment *segments, ptrdiff_t from, ptrdiff_t n)
+{
+  if (!parse_pool.initialized)
+    {
+      sys_mutex_init (&parse_pool.mutex);
+      sys_cond_init (&parse_pool.work);
+      sys_cond_init (&parse_pool.done);
+      parse_pool.initialized = true;
+    }
+  while (parse_pool.nworkers < parse_pool.nthreads - 1)
+    {
+      sys_thread_t thr;
+      if (!sys_thread_create (&thr, parse_worker,
+			      (void *) (uintptr_t) parse_pool.round))
+	break;
+      parse_pool.nworkers++;
+    }
+
+  parse_pool.buffer = current_buffer;
+  parse_pool.segments = segments;
+  parse_pool.next = from;
+  parse_pool.nsegments = n;
+  parse_wake ();
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect_void (parse_stop);
+  scan_speculatively = true;
+  for (ptrdiff_t k; (k = parse_take (false)) >= 0; )
+    {
+      parse_scan (k);
+      if (QUITP || pending_signals)
+	{
+	  parse_stop ();
+	  scan_speculatively = false;
+	  maybe_quit ();
+	  scan_speculatively = true;
+	  parse_wake ();
+	}
+    }
+  scan_speculatively = false;
+  unbind_to (count, Qnil);
+}
+
+/* Add guesses for SEGMENTS from FROM to N, MODE being known at FROM:
+   for each segment after, the modes scans of the one before ended in.  */
+
+static void
+parse_guess_more (struct parse_segment *segments, ptrdiff_t from,
+		  ptrdiff_t n, struct parse_mode const *mode)
+{
+  /* Backward, so that guesses added are not taken for scanned.  */
+  for (ptrdiff_t k = n - 1; k > from; --k)
+    {
+      struct parse_segment *seg = &segments[k], *prev = seg - 1;
+      for (int i = 0; i < prev->nguesses; ++i)
+	{
+	  if (!prev->guesses[i].scanned)
+	    continue;
+	  struct parse_mode end = parse_mode_of (&prev->guesses[i].state);
+	  int j;
+	  for (j = 0; j < seg->nguesses; ++j)
+	    if (parse_mode_eq (&seg->guesses[j].mode, &end))
+	      break;
+	  if (j == seg->nguesses && j < PARSE_GUESSES)
+	    seg->guesses[seg->nguesses++] = (struct parse_guess) { .mode = end };
+	}
+    }
+
+  struct parse_segment *seg = &segments[from];
+  seg->nguesses = min (seg->nguesses, PARSE_GUESSES - 1);
+  seg->guesses[seg->nguesses++] = (struct parse_guess) { .mode = *mode };
+}
+
+/* Combine STATE, with levels LEVELS, the actual state at the start
+   of a segment, with G, a scan of the segment from STATE's mode, into
+   the state at the segment's end.  Return false if G does not tell,
+   having lost track of levels.  */
+
+static bool
+parse_guess_combine (struct lisp_parse_state *state, ptrdiff_t *levels,
+		     ptrdiff_t *nlevels, struct parse_guess const *g)
+{
+  ptrdiff_t n = *nlevels;
+  EMACS_INT mindepth = g->state.mindepth, depth = g->state.depth;
+  if (! (g->kept && n + mindepth >= 0 && n + g->state.maxdepth < MAX_LEVELS))
+    return false;
+
+  for (EMACS_INT d = mindepth; d < depth; ++d)
+    if (g->lasts[d - mindepth] != INHERITED_POS)
+      levels[n + d] = g->lasts[d - mindepth];
+  *nlevels = n + depth;
+
+  state->thislevelstart = (g->state.thislevelstart == INHERITED_POS
+			   ? levels[n + depth] : g->state.thislevelstart);
+  state->prevlevelstart = n + depth == 0 ? -1 : levels[n + depth - 1];
+  state->mindepth = state->depth + mindepth;
+  state->depth += depth;
+  state->instring = g->state.instring;
+  state->incomment = g->state.incomment;
+  state->comstyle = g->state.comstyle;
+  state->quoted = g->state.quoted;
+  state->prev_syntax = g->state.prev_syntax;
+  if (g->state.comstr_start != INHERITED_POS)
+    state->comstr_start = g->state.comstr_start;
+  state->location = g->state.location;
+  state->location_byte = g->state.location_byte;
+  return true;
+}
+
+/* States at the ends of the segments parsed in parallel.  */
+struct parse_exits
+{
+  struct parse_segment *segments;
+  struct lisp_parse_state *states;
+  ptrdiff_t *levels;
+  ptrdiff_t *nlevels;
+};
+
+static void
+parse_exits_free (void *arg)
+{
+  struct parse_exits *exits = arg;
+  xfree (exits->segments);
+  xfree (exits->states);
+  xfree (exits->levels);
+  xfree (exits->nlevels);
+}
+
+/* Parse from POS[0] through each of POS[1] to POS[N] in parallel, from
+   STATE.  Push the states at the positions parsed onto *RESULT,
+   update STATE to the last of them and return how many, parsing
+   ending short where levels are too many to track in parallel.  */
+
+static ptrdiff_t
+parse_in_parallel (ptrdiff_t const *pos, ptrdiff_t n,
+		   struct lisp_parse_state *state, Lisp_Object *result)
+{
+  parse_pool.nthreads = min (num_processors (NPROC_CURRENT_OVERRIDABLE),
+			     PARSE_WORKERS);
+  if (parse_pool.nthreads < 2)
+    return 0;
+
+  ptrdiff_t levels[MAX_LEVELS];
+  ptrdiff_t nlevels = 0;
+  for (Lisp_Object tail = state->levelstarts; !NILP (tail);
+       tail = XCDR (tail))
+    if (! (CONSP (tail) && nlevels < MAX_LEVELS - 1
+	   && RANGED_FIXNUMP (PTRDIFF_MIN, XCAR (tail), PTRDIFF_MAX)))
+      return 0;
+    else
+      levels[nlevels++] = XFIXNUM (XCAR (tail));
+
+  /* Workers must not call out to compute syntax-table properties.  */
+  if (parse_sexp_lookup_properties)
+    {
+      parse_sexp_propertize (pos[n] - 1);
+      if (syntax_propertize__done < pos[n] && syntax_propertize__done < ZV)
+	return 0;
+    }
+
+  specpdl_ref count = SPECPDL_INDEX ();
+  struct parse_exits exits = { NULL };
+  record_unwind_protect_ptr (parse_exits_free, &exits);
+  struct parse_segment *segs = exits.segments = xnmalloc (n, sizeof *segs);
+  exits.states = xnmalloc (n, sizeof *exits.states);
+  exits.nlevels = xnmalloc (n, sizeof *exits.nlevels);
+  ptrdiff_t levels_size = 0, levels_used = 0;
+
+  struct parse_mode mode = parse_mode_of (state);
+  for (ptrdiff_t k = 0; k < n; ++k)
+    {
+      struct parse_segment *seg = &segs[k];
+      seg->from = pos[k];
+      seg->from_byte = CHAR_TO_BYTE (pos[k]);
+      seg->to = pos[k + 1];
+      SETUP_SYNTAX_TABLE (seg->from, 1);
+      seg->gl = gl_state;
+      seg->nguesses = 1;
+      seg->guesses[0] = (struct parse_guess) {
+	.mode = (k == 0 ? mode
+		 : (struct parse_mode) { .instring = -1, .prev_syntax = Smax })
+      };
+    }
+  parse_run (segs, 0, n);
+
+  ptrdiff_t k;
+  for (k = 0; k < n; ++k)
+    {
+      struct parse_segment *seg = &segs[k];
+      struct parse_guess *g = NULL;
+      mode = parse_mode_of (state);
+      for (int i = 0; i < seg->nguesses && !g; ++i)
+	if (parse_mode_eq (&seg->guesses[i].mode, &mode))
+	  g = &seg->guesses[i];
+      if (!g)
+	{
+	  parse_guess_more (segs, k, n, &mode);
+	  parse_run (segs, k, n);
+	  --k;
+	  continue;
+	}
+      if (!parse_guess_combine (state, levels, &nlevels, g))
+	break;
+
+      exits.states[k] = *state;
+      exits.nlevels[k] = nlevels;
+      if (levels_size - levels_used < nlevels)
+	exits.levels = xpalloc (exits.levels, &levels_size,
+				nlevels - (levels_size - levels_used), -1,
+				sizeof *exits.levels);
+      if (nlevels)
+	memcpy (exits.levels + levels_used, levels,
+		nlevels * sizeof *exits.levels);
+      levels_used += nlevels;
+    }
+
+  /* Parsing is over, so allocating is safe again.  */
+  Lisp_Object levelstarts = state->levelstarts;
+  for (ptrdiff_t i = 0, used = 0; i < k; ++i)
+    {
+      levelstarts = Qnil;
+      for (ptrdiff_t j = exits.nlevels[i]; j > 0; --j)
+	levelstarts = Fcons (make_fixnum (exits.levels[used + j - 1]),
+			     levelstarts);
+      used += exits.nlevels[i];
+      exits.states[i].levelstarts = levelstarts;
+      *result = Fcons (externalize_parse_state (&exits.states[i]), *result);
+    }
+  if (k > 0)
+    *state = exits.states[k - 1];
+  else
+    state->levelstarts = levelstarts;
+
+  unbind_to (count, Qnil);
+  return k;
+}
+
+#endif	/* HAVE_GCC_TLS */
+
 DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
        doc: /* Parse from FROM to TO using prevailing syntax table.
 Return 11-element state consisting of:
@@ -3577,42 +4117,74 @@ DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
   scan_sexps_forward (&state, XFIXNUM (from), CHAR_TO_BYTE (XFIXNUM (from)),
 		      XFIXNUM (to), target, !NILP (stopbefore),
 		      (NILP (commentstop)
-		       ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)));
+		       ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)),
+		      NULL);
 
   SET_PT_BOTH (state.location, state.location_byte);
 
-  ret =
-    Fcons (make_fixnum (state.depth),
-	   Fcons (state.prevlevelstart < 0
-		  ? Qnil : make_fixnum (state.prevlevelstart),
-	     Fcons (state.thislevelstart < 0
-		    ? Qnil : make_fixnum (state.thislevelstart),
-	       Fcons (state.instring >= 0
-		      ? (state.instring == ST_STRING_STYLE
-			 ? Qt : make_fixnum (state.instring)) : Qnil,
-		 Fcons (state.incomment < 0 ? Qt :
-			(state.incomment == 0 ? Qnil :
-			 make_fixnum (state.incomment)),
-		   Fcons (state.quoted ? Qt : Qnil,
-		     Fcons (make_fixnum (state.mindepth),
-		       Fcons ((state.comstyle
-			       ? (state.comstyle == ST_COMMENT_STYLE
-				  ? Qsyntax_table
-				  : make_fixnum (state.comstyle))
-			       : Qnil),
-		         Fcons (((state.incomment
-                                  || (state.instring >= 0))
-                                 ? make_fixnum (state.comstr_start)
-                                 : Qnil),
-			   Fcons (state.levelstarts,
-                             Fcons (state.prev_syntax == Smax
-                                    ? Qnil
-                                    : make_fixnum (state.prev_syntax),
-                                Qnil)))))))))));
+  ret = externalize_parse_state (&state);
   unbind_to (pdl_count, Qnil);
   return ret;
 }
 
+DEFUN ("parse-partial-sexp-states", Fparse_partial_sexp_states,
+       Sparse_partial_sexp_states, 1, 2, 0,
+       doc: /* Parse from the first of POSITIONS through each of the others.
+Return the list of states at each position but the first, as
+`parse-partial-sexp' returns them parsing from the position before,
+with the state there as OLDSTATE.  OLDSTATE is the state at the first
+position.  POSITIONS must not decrease.  Point is left at the last.
+
+Where Emacs supports threads that run in parallel, parsing
+`parse-sexp-parallel-threshold' characters or more is split among
+them.  */)
+  (Lisp_Object positions, Lisp_Object oldstate)
+{
+  specpdl_ref count = SPECPDL_INDEX ();
+  record_unwind_protect (save_restriction_restore, save_restriction_save ());
+  Fwiden ();
+
+  ptrdiff_t n = list_length (positions) - 1;
+  if (n < 0)
+    return unbind_to (count, Qnil);
+  ptrdiff_t *pos;
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (pos, 1, n + 1);
+  ptrdiff_t i = 0;
+  for (Lisp_Object tail = positions; CONSP (tail); tail = XCDR (tail), ++i)
+    {
+      Lisp_Object p = XCAR (tail);
+      CHECK_FIXNUM_COERCE_MARKER (p);
+      if (! (BEGV <= XFIXNUM (p) && XFIXNUM (p) <= ZV
+	     && (i == 0 || pos[i - 1] <= XFIXNUM (p))))
+	args_out_of_range (p, positions);
+      pos[i] = XFIXNUM (p);
+    }
+
+  struct lisp_parse_state state;
+  internalize_parse_state (oldstate, &state);
+  state.location = pos[0];
+  state.location_byte = CHAR_TO_BYTE (pos[0]);
+
+  Lisp_Object result = Qnil;
+  i = 0;
+#ifdef HAVE_GCC_TLS
+  if (n > 1 && pos[n] - pos[0] >= parse_sexp_parallel_threshold
+      && main_thread_p (current_thread))
+    i = parse_in_parallel (pos, n, &state, &result);
+#endif
+  for (; i < n; ++i)
+    {
+      scan_sexps_forward (&state, pos[i], CHAR_TO_BYTE (pos[i]), pos[i + 1],
+			  TYPE_MINIMUM (EMACS_INT), false, 0, NULL);
+      result = Fcons (externalize_parse_state (&state), result);
+    }
+
+  SET_PT_BOTH (state.location, state.location_byte);
+  SAFE_FREE ();
+  return unbind_to (count, Fnreverse (result));
+}
+
 void
 init_syntax_once (void)
 {
@@ -3708,11 +4280,6 @@ syms_of_syntax (void)
 
   staticpro (&Vsyntax_code_object);
 
-  staticpro (&gl_state.object);
-  staticpro (&gl_state.global_code);
-  staticpro (&gl_state.current_syntax_table);
-  staticpro (&gl_state.old_prop);
-
   DEFSYM (Qscan_error, "scan-error");
   Fput (Qscan_error, Qerror_conditions,
 	pure_list (Qscan_error, Qerror));
@@ -3769,6 +4336,10 @@ syms_of_syntax (void)
   DEFVAR_BOOL ("comment-end-can-be-escaped", comment_end_can_be_escaped,
                doc: /* Non-nil means an escaped ender inside a comment doesn't end the comment.  */);
   comment_end_can_be_escaped = false;
+
+  DEFVAR_INT ("parse-sexp-parallel-threshold", parse_sexp_parallel_threshold,
+	      doc: /* Characters from which `parse-partial-sexp-states' parses in parallel.  */);
+  parse_sexp_parallel_threshold = 1 << 20;
   DEFSYM (Qcomment_end_can_be_escaped, "comment-end-can-be-escaped");
   Fmake_variable_buffer_local (Qcomment_end_can_be_escaped);
 
@@ -3796,4 +4367,5 @@ syms_of_syntax (void)
   defsubr (&Sscan_sexps);
   defsubr (&Sbackward_prefix_chars);
   defsubr (&Sparse_partial_sexp);
+  defsubr (&Sparse_partial_sexp_states);
 }
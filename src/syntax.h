@@ -63,32 +63,6 @@ #define Vstandard_syntax_table BVAR (&buffer_slot_defaults, syntax_table)
   };
 
 
-struct gl_state_s
-{
-  Lisp_Object object;			/* The object we are scanning.  */
-  ptrdiff_t start;			/* Where to stop.  */
-  ptrdiff_t stop;			/* Where to stop.  */
-  bool use_global;			/* Whether to use global_code
-					   or c_s_t.  */
-  Lisp_Object global_code;		/* Syntax code of current char.  */
-  Lisp_Object current_syntax_table;	/* Syntax table for current pos.  */
-  Lisp_Object old_prop;			/* Syntax-table prop at prev pos.  */
-  ptrdiff_t b_property;			/* First index where c_s_t is valid.  */
-  ptrdiff_t e_property;			/* First index where c_s_t is
-					   not valid.  */
-  bool e_property_truncated;		/* true if e_property if was truncated
-					   by parse_sexp_propertize_done.  */
-  INTERVAL forward_i;			/* Where to start lookup on forward.  */
-  INTERVAL backward_i;			/* or backward movement.  The
-					   data in c_s_t is valid
-					   between these intervals,
-					   and possibly at the
-					   intervals too, depending
-					   on:  */
-};
-
-extern struct gl_state_s gl_state;
-
 /* Fetch the information from the entry for character C
    in the current buffer's syntax table,
    or (if VIA_PROPERTY) from globally kept data (gl_state).
@@ -100,8 +74,8 @@ syntax_property_entry (int c, bool via_property)
   if (via_property)
     return (gl_state.use_global
 	    ? gl_state.global_code
-	    : CHAR_TABLE_REF (gl_state.current_syntax_table, c));
-  return CHAR_TABLE_REF (BVAR (current_buffer, syntax_table), c);
+	    : CHAR_TABLE_REF_FLAT (gl_state.current_syntax_table, c));
+  return CHAR_TABLE_REF_FLAT (BVAR (current_buffer, syntax_table), c);
 }
 INLINE Lisp_Object
 SYNTAX_ENTRY (int c)
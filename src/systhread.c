@@ -48,6 +48,11 @@ sys_mutex_unlock (sys_mutex_t *m)
 {
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *m)
+{
+}
+
 void
 sys_cond_init (sys_cond_t *c)
 {
@@ -148,6 +153,13 @@ sys_mutex_unlock (sys_mutex_t *mutex)
   eassert (error == 0);
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *mutex)
+{
+  int error = pthread_mutex_destroy (mutex);
+  eassert (error == 0);
+}
+
 void
 sys_cond_init (sys_cond_t *cond)
 {
@@ -294,6 +306,12 @@ sys_mutex_unlock (sys_mutex_t *mutex)
   LeaveCriticalSection ((LPCRITICAL_SECTION)mutex);
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *mutex)
+{
+  DeleteCriticalSection ((LPCRITICAL_SECTION)mutex);
+}
+
 void
 sys_cond_init (sys_cond_t *cond)
 {
@@ -26,6 +26,7 @@ Copyright (C) 2012-2024 Free Software Foundation, Inc.
 
 #include <config.h>
 #include <setjmp.h>
+#include <nproc.h>
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -59,6 +60,7 @@ verify (GCALIGNED (union aligned_thread_state));
 						    THREAD_LAST_LISP_FIELD),
 				     VECSIZE (struct thread_state)),
       .m_last_thing_searched = LISPSYM_INITIALLY (Qnil),
+      .m_re_match_object = LISPSYM_INITIALLY (Qnil),
       .name = LISPSYM_INITIALLY (Qnil),
       .function = LISPSYM_INITIALLY (Qnil),
       .obarray = LISPSYM_INITIALLY (Qnil),
@@ -86,6 +88,104 @@ verify (GCALIGNED (union aligned_thread_state));
 /* m_specpdl is cleared when the thread dies.  */
 #define thread_live_p(STATE) ((STATE)->m_specpdl != NULL)
 
+#ifdef HAVE_GCC_TLS
+/* Uncooperative threads may read buffer text while the holder of the
+   global lock changes it.  Readers share a buffer's text for the
+   length of one primitive, a search or a substring.  The global lock
+   holder takes the text exclusively on its first change and keeps it
+   until it gives up the global lock, so the many small changes of one
+   command do not each wait on readers.  Uncooperative threads may not
+   change buffer text at all.  */
+
+int uncooperative_threads;
+static sys_mutex_t text_lock_mutex = PTHREAD_MUTEX_INITIALIZER;
+static sys_cond_t text_lock_cond = PTHREAD_COND_INITIALIZER;
+
+/* Whether the global lock holder took any text, only looked at by
+   the global lock holder.  */
+static bool text_locks_held;
+
+static struct buffer *
+text_owner (struct buffer *b)
+{
+  return b->base_buffer ? b->base_buffer : b;
+}
+
+void
+buffer_text_write_lock_1 (struct buffer *b)
+{
+  if (!current_thread->cooperative)
+    error ("Uncooperative threads cannot change buffer text");
+  b = text_owner (b);
+  if (b->text_locked)
+    return;
+  sys_mutex_lock (&text_lock_mutex);
+  b->text_lock_wanted = true;
+  while (b->text_readers > 0)
+    sys_cond_wait (&text_lock_cond, &text_lock_mutex);
+  b->text_lock_wanted = false;
+  b->text_locked = true;
+  text_locks_held = true;
+  sys_mutex_unlock (&text_lock_mutex);
+}
+
+static void
+buffer_text_read_unlock (void *arg)
+{
+  struct buffer *b = arg;
+  sys_mutex_lock (&text_lock_mutex);
+  current_thread->text_reading--;
+  if (--b->text_readers == 0 && b->text_lock_wanted)
+    sys_cond_broadcast (&text_lock_cond);
+  sys_mutex_unlock (&text_lock_mutex);
+}
+
+/* Share buffer B's text with other readers until the caller unbinds.
+   A thread already reading something is let through ahead of waiting
+   writers lest it wait on itself.  */
+
+void
+buffer_text_read_lock (struct buffer *b)
+{
+  if (current_thread->cooperative)
+    return;
+  b = text_owner (b);
+  sys_mutex_lock (&text_lock_mutex);
+  while (BUFFER_LIVE_P (b)
+	 && (b->text_locked
+	     || (b->text_lock_wanted && !current_thread->text_reading)))
+    sys_cond_wait (&text_lock_cond, &text_lock_mutex);
+  if (!BUFFER_LIVE_P (b))
+    {
+      sys_mutex_unlock (&text_lock_mutex);
+      error ("Selecting deleted buffer");
+    }
+  b->text_readers++;
+  current_thread->text_reading++;
+  sys_mutex_unlock (&text_lock_mutex);
+  record_unwind_protect_ptr (buffer_text_read_unlock, b);
+}
+
+/* Hand back all text taken by the global lock holder, which is about
+   to give up the global lock.  */
+
+static void
+release_text_locks (void)
+{
+  if (!text_locks_held)
+    return;
+  Lisp_Object tail, buf;
+  sys_mutex_lock (&text_lock_mutex);
+  FOR_EACH_LIVE_BUFFER (tail, buf)
+    XBUFFER (buf)->text_locked = false;
+  text_locks_held = false;
+  sys_cond_broadcast (&text_lock_cond);
+  sys_mutex_unlock (&text_lock_mutex);
+}
+#else
+# define release_text_locks() ((void) 0)
+#endif
+
 static void
 clear_thread (void *arg)
 {
@@ -153,6 +253,7 @@ lisp_mutex_restore_lock (lisp_mutex_t *mutex, struct thread_state *locker,
   else
     {
       locker->wait_condvar = &mutex->condition;
+      release_text_locks ();
       while (mutex->owner != NULL)
 	sys_cond_wait (&mutex->condition, &global_lock);
       clear_thread (locker);
@@ -173,6 +274,7 @@ lisp_mutex_lock (lisp_mutex_t *mutex, struct thread_state *locker)
   else
     {
       locker->wait_condvar = &mutex->condition;
+      release_text_locks ();
       while (mutex->owner != NULL && NILP (locker->error_symbol))
 	sys_cond_wait (&mutex->condition, &global_lock);
       clear_thread (locker);
@@ -352,6 +454,7 @@ condition_wait_callback (void *arg)
   mutex->mutex.owner = NULL;
   sys_cond_broadcast (&mutex->mutex.condition);
 
+  release_text_locks ();
   sys_cond_wait (&cvar->cond, &global_lock);
   clear_thread (self);
   lisp_mutex_restore_lock (&mutex->mutex, self, restore_count);
@@ -473,6 +576,193 @@ finalize_one_condvar (struct Lisp_CondVar *condvar)
   sys_cond_destroy (&condvar->cond);
 }
 
+
+DEFUN ("make-channel", Fmake_channel, Smake_channel, 0, 2, 0,
+       doc: /* Return a channel holding up to CAPACITY objects in transit.
+CAPACITY defaults to 16.  A non-nil NAME string is assigned to the
+channel.  Threads pass objects through it, first in first out, with
+`channel-send' and `channel-receive'.  Unlike mutexes and condition
+variables, a channel works without the global lock, so uncooperative
+threads can use it without waiting on cooperative ones.  */)
+  (Lisp_Object capacity, Lisp_Object name)
+{
+  EMACS_INT size = 16;
+  if (!NILP (capacity))
+    {
+      CHECK_FIXNAT (capacity);
+      size = XFIXNAT (capacity);
+      if (size == 0)
+	xsignal1 (Qargs_out_of_range, capacity);
+    }
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  Lisp_Object ring = initialize_vector (size, Qnil);
+  struct Lisp_Channel *ch
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Channel, ring, PVEC_CHANNEL);
+  sys_mutex_init (&ch->mutex);
+  sys_cond_init (&ch->cond);
+  ch->name = name;
+  ch->ring = ring;
+
+  Lisp_Object channel;
+  XSETCHANNEL (channel, ch);
+  return channel;
+}
+
+#ifdef HAVE_GCC_TLS
+/* Wait on CH's condition with its mutex held, but not for long.
+   Uncooperative threads do not stop for the main thread's garbage
+   collection while they block.  */
+static void
+channel_nap (struct Lisp_Channel *ch)
+{
+  struct timespec until
+    = timespec_add (current_timespec (), make_timespec (0, 20000000));
+  pthread_cond_timedwait (&ch->cond, &ch->mutex, &until);
+}
+#endif
+
+/* Wait for a send or receive on CH, whose mutex the caller holds.
+   Return with the mutex released.  */
+static void
+channel_wait_callback (void *arg)
+{
+  struct Lisp_Channel *ch = arg;
+  struct thread_state *self = current_thread; // current_thread changes!
+
+#ifdef HAVE_GCC_TLS
+  if (!self->cooperative)
+    {
+      channel_nap (ch);
+      sys_mutex_unlock (&ch->mutex);
+      return;
+    }
+#endif
+
+  XSETCHANNEL (self->event_object, ch);
+  self->wait_condvar = &ch->cond;
+  release_text_locks ();
+#ifdef HAVE_GCC_TLS
+  /* Broadcasts come under CH's mutex, not necessarily the global
+     lock, so wait with the former.  */
+  sys_mutex_unlock (&global_lock);
+  channel_nap (ch);
+  sys_mutex_unlock (&ch->mutex);
+  sys_mutex_lock (&global_lock);
+#else
+  /* Every sender and receiver holds the global lock.  */
+  sys_mutex_unlock (&ch->mutex);
+  sys_cond_wait (&ch->cond, &global_lock);
+#endif
+  clear_thread (self);
+  restore_thread (self);
+}
+
+static void
+channel_wait (struct Lisp_Channel *ch)
+{
+  with_flushed_stack (channel_wait_callback, ch);
+#ifdef HAVE_GCC_TLS
+  if (current_thread->cooperative)
+#endif
+    maybe_quit ();
+  maybe_garbage_collect ();
+}
+
+/* Remove and return the oldest object in CH, whose mutex the caller
+   holds.  */
+static Lisp_Object
+channel_take (struct Lisp_Channel *ch)
+{
+  Lisp_Object object = AREF (ch->ring, ch->head);
+  ASET (ch->ring, ch->head, Qnil);
+  ch->head = (ch->head + 1) % ASIZE (ch->ring);
+  ch->count--;
+  sys_cond_broadcast (&ch->cond);
+  return object;
+}
+
+DEFUN ("channel-send", Fchannel_send, Schannel_send, 2, 2, 0,
+       doc: /* Send OBJECT through CHANNEL.
+If CHANNEL is full, wait for a receiver to make room, or for this
+thread to be signaled with `thread-signal'.  */)
+  (Lisp_Object channel, Lisp_Object object)
+{
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *ch = XCHANNEL (channel);
+
+  for (;;)
+    {
+      sys_mutex_lock (&ch->mutex);
+      if (ch->count < ASIZE (ch->ring))
+	break;
+      channel_wait (ch);
+    }
+  ASET (ch->ring, (ch->head + ch->count++) % ASIZE (ch->ring), object);
+  sys_cond_broadcast (&ch->cond);
+  sys_mutex_unlock (&ch->mutex);
+  return Qnil;
+}
+
+DEFUN ("channel-receive", Fchannel_receive, Schannel_receive, 1, 1, 0,
+       doc: /* Return the oldest object sent through CHANNEL.
+If CHANNEL is empty, wait for a sender, or for this thread to be
+signaled with `thread-signal'.  */)
+  (Lisp_Object channel)
+{
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *ch = XCHANNEL (channel);
+
+  for (;;)
+    {
+      sys_mutex_lock (&ch->mutex);
+      if (ch->count > 0)
+	break;
+      channel_wait (ch);
+    }
+  Lisp_Object object = channel_take (ch);
+  sys_mutex_unlock (&ch->mutex);
+  return object;
+}
+
+DEFUN ("channel-try-receive", Fchannel_try_receive, Schannel_try_receive,
+       1, 2, 0,
+       doc: /* Return the oldest object sent through CHANNEL, or DEFAULT.
+Unlike `channel-receive', return DEFAULT at once if CHANNEL is empty.  */)
+  (Lisp_Object channel, Lisp_Object default_object)
+{
+  CHECK_CHANNEL (channel);
+  struct Lisp_Channel *ch = XCHANNEL (channel);
+
+  sys_mutex_lock (&ch->mutex);
+  Lisp_Object object = ch->count > 0 ? channel_take (ch) : default_object;
+  sys_mutex_unlock (&ch->mutex);
+  return object;
+}
+
+DEFUN ("channelp", Fchannelp, Schannelp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a channel.  */)
+  (Lisp_Object object)
+{
+  return CHANNELP (object) ? Qt : Qnil;
+}
+
+DEFUN ("channel-name", Fchannel_name, Schannel_name, 1, 1, 0,
+       doc: /* Return the name of CHANNEL.
+If no name was given when CHANNEL was created, return nil.  */)
+  (Lisp_Object channel)
+{
+  CHECK_CHANNEL (channel);
+  return XCHANNEL (channel)->name;
+}
+
+void
+finalize_one_channel (struct Lisp_Channel *channel)
+{
+  sys_cond_destroy (&channel->cond);
+}
+
 struct select_args
 {
   select_func *func;
@@ -555,6 +845,11 @@ mark_one_thread (struct thread_state *thread)
       mark_object (&tem);
     }
 
+  mark_object (&thread->m_gl_state.object);
+  mark_object (&thread->m_gl_state.global_code);
+  mark_object (&thread->m_gl_state.current_syntax_table);
+  mark_object (&thread->m_gl_state.old_prop);
+
   mark_bytecode (&thread->bc);
 
   /* No need to mark Lisp_Object members like m_last_thing_searched,
@@ -603,6 +898,7 @@ yield_callback (void *ignore)
 void
 release_global_lock (void)
 {
+  release_text_locks ();
   sys_mutex_unlock (&global_lock);
   sys_thread_yield (); // mostly no-op
 }
@@ -621,11 +917,20 @@ DEFUN ("thread-yield", Fthread_yield, Sthread_yield, 0, 0, 0,
   return Qnil;
 }
 
+#ifdef HAVE_GCC_TLS
+static Lisp_Object thread_pool_work (void);
+#endif
+
 static Lisp_Object
 invoke_thread (void)
 {
   specpdl_ref count = SPECPDL_INDEX ();
-  current_thread->result = Ffuncall (1, &current_thread->function);
+#ifdef HAVE_GCC_TLS
+  if (THREAD_POOL_P (current_thread->function))
+    current_thread->result = thread_pool_work ();
+  else
+#endif
+    current_thread->result = Ffuncall (1, &current_thread->function);
   return unbind_to (count, Qnil);
 }
 
@@ -645,9 +950,8 @@ sem_wait_ (sem_t *sem, struct thread_state *thr)
     {
       /* GIL requires manual yield.  */
       for (;;) {
-	int val;
-	if (sem_getvalue (sem, &val) == 0 && val)
-	  return sem_init (sem, 0, --val);
+	if (sem_trywait (sem) == 0)
+	  return 0;
 	Fthread_yield ();
       }
     }
@@ -734,6 +1038,15 @@ run_thread (void *state)
 
   sys_cond_broadcast (&self->thread_condvar);
 
+#ifdef HAVE_GCC_TLS
+  if (!self->cooperative)
+    {
+      sys_mutex_lock (&text_lock_mutex);
+      uncooperative_threads--;
+      sys_mutex_unlock (&text_lock_mutex);
+    }
+#endif
+
   await_reap (self);
 
 #ifdef HAVE_GCC_TLS
@@ -754,25 +1067,17 @@ finalize_one_thread (struct thread_state *state)
   xfree (state->m_vector_free_lists);
 }
 
-DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
-       doc: /* Spawn thread running FUNCTION.
-A non-nil NAME string is assigned to the thread.
-A non-nil UNCOOPERATIVE halts and catches fire.
-*/)
-  (Lisp_Object function, Lisp_Object name, Lisp_Object uncooperative)
+/* Start a thread running FUNCTION, or the work loop of FUNCTION if
+   that is a thread pool.  */
+
+static Lisp_Object
+spawn_thread (Lisp_Object function, Lisp_Object name, bool cooperative)
 {
   Lisp_Object result;
   sys_thread_t thr;
   struct thread_state *new_thread;
   const ptrdiff_t init_pdl = 50;
 
-  /* Can't start a thread in temacs.  */
-  if (!initialized)
-    emacs_abort ();
-
-  if (!NILP (name))
-    CHECK_STRING (name);
-
   new_thread = ALLOCATE_ZEROED_PSEUDOVECTOR (struct thread_state,
 					     THREAD_LAST_LISP_FIELD,
 					     PVEC_THREAD);
@@ -780,12 +1085,14 @@ DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
   new_thread->function = function;
   new_thread->obarray = initialize_vector (OBARRAY_SIZE / 10, make_fixnum (0));
   new_thread->lexical_environment = current_thread->lexical_environment;
+  new_thread->cooperative = cooperative;
 #ifdef HAVE_GCC_TLS
-  new_thread->cooperative = NILP (uncooperative);
-#else
-  new_thread->cooperative = true;
-  if (!NILP (uncooperative))
-    error ("No gcc tls support");
+  if (!new_thread->cooperative)
+    {
+      sys_mutex_lock (&text_lock_mutex);
+      uncooperative_threads++;
+      sys_mutex_unlock (&text_lock_mutex);
+    }
 #endif
   new_thread->m_current_buffer = current_thread->m_current_buffer;
 
@@ -809,7 +1116,6 @@ DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
   new_thread->m_most_recent_free_slot = VBLOCK_NFREE_LISTS;
   new_thread->m_vector_free_lists = xzalloc (VBLOCK_NFREE_LISTS *
 					     sizeof (struct Lisp_Vector *));
-  new_thread->m_mem_root = mem_nil;
 
   init_bc_thread (&new_thread->bc);
   sys_cond_init (&new_thread->thread_condvar);
@@ -823,6 +1129,14 @@ DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
   if (!sys_thread_create (&thr, run_thread, new_thread))
     {
       all_threads = all_threads->next_thread; /* restore to original.  */
+#ifdef HAVE_GCC_TLS
+      if (!new_thread->cooperative)
+	{
+	  sys_mutex_lock (&text_lock_mutex);
+	  uncooperative_threads--;
+	  sys_mutex_unlock (&text_lock_mutex);
+	}
+#endif
       error ("Could not start a new thread");
     }
 
@@ -830,6 +1144,34 @@ DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
   return result;
 }
 
+DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 3, 0,
+       doc: /* Spawn thread running FUNCTION.
+A non-nil NAME string is assigned to the thread.
+A non-nil UNCOOPERATIVE halts and catches fire.
+
+An uncooperative thread runs in parallel, without the global lock.  It
+may read the text of any buffer, without its text properties, but it
+signals an error if it tries to change the text of any buffer, even a
+temporary buffer of its own.  Its searches return where they end
+without moving point, which other threads share.
+*/)
+  (Lisp_Object function, Lisp_Object name, Lisp_Object uncooperative)
+{
+  /* Can't start a thread in temacs.  */
+  if (!initialized)
+    emacs_abort ();
+
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+#ifndef HAVE_GCC_TLS
+  if (!NILP (uncooperative))
+    error ("No gcc tls support");
+#endif
+
+  return spawn_thread (function, name, NILP (uncooperative));
+}
+
 DEFUN ("current-thread", Fcurrent_thread, Scurrent_thread, 0, 0, 0,
        doc: /* Return the current thread.  */)
   (void)
@@ -910,6 +1252,8 @@ DEFUN ("thread--blocker", Fthread_blocker, Sthread_blocker, 1, 1, 0,
 thread.
 If THREAD is blocked in `mutex-lock', return the mutex.
 If THREAD is blocked in `condition-wait', return the condition variable.
+If THREAD is blocked in `channel-send' or `channel-receive', return the
+channel.
 Otherwise, if THREAD is not blocked, return nil.  */)
   (Lisp_Object thread)
 {
@@ -931,6 +1275,7 @@ thread_join_callback (void *arg)
   XSETTHREAD (thread, tstate);
   self->event_object = thread;
   self->wait_condvar = &tstate->thread_condvar;
+  release_text_locks ();
   while (thread_live_p (tstate) && NILP (self->error_symbol))
     sys_cond_wait (self->wait_condvar, &global_lock);
   clear_thread (self);
@@ -999,6 +1344,367 @@ DEFUN ("thread-last-error", Fthread_last_error, Sthread_last_error, 0, 1, 0,
   return result;
 }
 
+#ifdef HAVE_GCC_TLS
+/* Thread pools keep their workers for good, so a small task costs a
+   deque push rather than a new thread's stacks and obarray.  A worker
+   runs the futures of its own deque newest first, and once that is
+   empty takes the oldest from the outside submissions or from another
+   worker.  Idle and awaiting threads nap briefly rather than block, so
+   that they keep reaching maybe_garbage_collect.  */
+
+static void
+thread_pool_nap (struct Lisp_Thread_Pool *pool)
+{
+  struct timespec until
+    = timespec_add (current_timespec (), make_timespec (0, 20000000));
+  pthread_cond_timedwait (&pool->cond, &pool->mutex, &until);
+}
+
+/* Return which worker of POOL the current thread is, or -1.  */
+
+static int
+thread_pool_worker_index (struct Lisp_Thread_Pool *pool)
+{
+  Lisp_Object self;
+  XSETTHREAD (self, current_thread);
+  for (ptrdiff_t i = 0; i < ASIZE (pool->workers); ++i)
+    if (EQ (AREF (pool->workers, i), self))
+      return i;
+  return -1;
+}
+
+static void
+thread_pool_push (struct Lisp_Thread_Pool *pool, ptrdiff_t k,
+		  Lisp_Object future)
+{
+  struct thread_pool_deque *dq = &pool->rings[k];
+
+  sys_mutex_lock (&dq->mutex);
+  Lisp_Object ring = AREF (pool->deques, k);
+  ptrdiff_t size = ASIZE (ring);
+  if (dq->count == size)
+    {
+      Lisp_Object bigger = initialize_vector (2 * size, Qnil);
+      for (ptrdiff_t i = 0; i < size; ++i)
+	ASET (bigger, i, AREF (ring, (dq->head + i) % size));
+      ASET (pool->deques, k, bigger);
+      dq->head = 0;
+      ring = bigger;
+      size *= 2;
+    }
+  ASET (ring, (dq->head + dq->count++) % size, future);
+  sys_mutex_unlock (&dq->mutex);
+
+  sys_mutex_lock (&pool->mutex);
+  pool->queued++;
+  sys_cond_broadcast (&pool->cond);
+  sys_mutex_unlock (&pool->mutex);
+}
+
+/* Take a future off deque K of POOL, at the tail if TAIL, else at the
+   head.  Return nil if the deque is empty.  */
+
+static Lisp_Object
+thread_pool_take (struct Lisp_Thread_Pool *pool, ptrdiff_t k, bool tail)
+{
+  struct thread_pool_deque *dq = &pool->rings[k];
+  Lisp_Object future = Qnil;
+
+  sys_mutex_lock (&dq->mutex);
+  if (dq->count > 0)
+    {
+      Lisp_Object ring = AREF (pool->deques, k);
+      ptrdiff_t size = ASIZE (ring), i;
+      if (tail)
+	i = (dq->head + dq->count - 1) % size;
+      else
+	{
+	  i = dq->head;
+	  dq->head = (dq->head + 1) % size;
+	}
+      dq->count--;
+      future = AREF (ring, i);
+      ASET (ring, i, Qnil);
+    }
+  sys_mutex_unlock (&dq->mutex);
+
+  if (!NILP (future))
+    {
+      sys_mutex_lock (&pool->mutex);
+      pool->queued--;
+      XFUTURE (future)->state = FUTURE_RUNNING;
+      sys_mutex_unlock (&pool->mutex);
+    }
+  return future;
+}
+
+/* Return the next future for worker SELF of POOL, or nil.  */
+
+static Lisp_Object
+thread_pool_next (struct Lisp_Thread_Pool *pool, int self)
+{
+  ptrdiff_t nworkers = ASIZE (pool->workers);
+  Lisp_Object future = thread_pool_take (pool, self, true);
+  if (NILP (future))
+    future = thread_pool_take (pool, nworkers, false);
+  for (ptrdiff_t i = 1; NILP (future) && i < nworkers; ++i)
+    future = thread_pool_take (pool, (self + i) % nworkers, false);
+  return future;
+}
+
+/* Nap until FUTURE is done or its pool has news.  A cooperative
+   thread lets go of the global lock meanwhile, so that other threads
+   run while it waits.  */
+
+static void
+future_nap_callback (void *arg)
+{
+  Lisp_Object future = *(Lisp_Object *) arg;
+  struct Lisp_Thread_Pool *pool = XTHREAD_POOL (XFUTURE (future)->pool);
+  struct thread_state *self = current_thread; // current_thread changes!
+
+  if (self->cooperative)
+    release_global_lock ();
+  sys_mutex_lock (&pool->mutex);
+  if (XFUTURE (future)->state != FUTURE_DONE)
+    thread_pool_nap (pool);
+  sys_mutex_unlock (&pool->mutex);
+  if (self->cooperative)
+    acquire_global_lock (self);
+}
+
+static Lisp_Object
+future_call (Lisp_Object future)
+{
+  XFUTURE (future)->value = call0 (XFUTURE (future)->function);
+  return Qt;
+}
+
+static Lisp_Object
+future_error (Lisp_Object err)
+{
+  return err;
+}
+
+static void
+thread_pool_run (Lisp_Object future)
+{
+  struct Lisp_Thread_Pool *pool = XTHREAD_POOL (XFUTURE (future)->pool);
+  Lisp_Object err
+    = internal_condition_case_1 (future_call, future, Qt, future_error);
+
+  sys_mutex_lock (&pool->mutex);
+  if (!EQ (err, Qt))
+    XFUTURE (future)->error = err;
+  XFUTURE (future)->function = Qnil;
+  XFUTURE (future)->state = FUTURE_DONE;
+  sys_cond_broadcast (&pool->cond);
+  sys_mutex_unlock (&pool->mutex);
+}
+
+/* The function of every worker thread.  */
+
+static Lisp_Object
+thread_pool_work (void)
+{
+  Lisp_Object pool_obj = current_thread->function;
+  struct Lisp_Thread_Pool *pool = XTHREAD_POOL (pool_obj);
+  int self = -1;
+
+  for (;;)
+    {
+      /* The pool fills in WORKERS after starting us.  */
+      if (self < 0)
+	self = thread_pool_worker_index (pool);
+      Lisp_Object future = self < 0 ? Qnil : thread_pool_next (pool, self);
+      if (!NILP (future))
+	{
+	  specpdl_ref count = SPECPDL_INDEX ();
+	  thread_pool_run (future);
+	  unbind_to (count, Qnil);
+	  continue;
+	}
+
+      sys_mutex_lock (&pool->mutex);
+      bool done = pool->shutdown && pool->queued == 0;
+      if (!done)
+	thread_pool_nap (pool);
+      sys_mutex_unlock (&pool->mutex);
+      if (done)
+	return Qnil;
+      maybe_garbage_collect ();
+    }
+}
+
+DEFUN ("make-thread-pool", Fmake_thread_pool, Smake_thread_pool, 0, 2, 0,
+       doc: /* Return a pool of SIZE uncooperative worker threads.
+SIZE defaults to the number of processors available.  A non-nil NAME
+string is assigned to the pool and its workers.  Give the pool work
+with `thread-pool-submit'.  */)
+  (Lisp_Object size, Lisp_Object name)
+{
+  EMACS_INT nworkers;
+  if (NILP (size))
+    nworkers = num_processors (NPROC_CURRENT_OVERRIDABLE);
+  else
+    {
+      CHECK_FIXNAT (size);
+      nworkers = XFIXNAT (size);
+      if (nworkers == 0 || nworkers > 1024)
+	args_out_of_range (size, make_fixnum (1024));
+    }
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  struct Lisp_Thread_Pool *pool
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Thread_Pool, deques,
+				    PVEC_THREAD_POOL);
+  Lisp_Object result;
+  XSETTHREAD_POOL (result, pool);
+  pool->name = name;
+  pool->workers = initialize_vector (nworkers, Qnil);
+  pool->deques = initialize_vector (nworkers + 1, Qnil);
+  pool->rings = xzalloc ((nworkers + 1) * sizeof *pool->rings);
+  pool->nrings = nworkers + 1;
+  for (EMACS_INT k = 0; k <= nworkers; ++k)
+    {
+      ASET (pool->deques, k, initialize_vector (16, Qnil));
+      sys_mutex_init (&pool->rings[k].mutex);
+    }
+  sys_mutex_init (&pool->mutex);
+  sys_cond_init (&pool->cond);
+
+  for (EMACS_INT k = 0; k < nworkers; ++k)
+    ASET (pool->workers, k, spawn_thread (result, name, false));
+  return result;
+}
+
+DEFUN ("thread-pool-p", Fthread_pool_p, Sthread_pool_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is a thread pool.  */)
+  (Lisp_Object object)
+{
+  return THREAD_POOL_P (object) ? Qt : Qnil;
+}
+
+DEFUN ("thread-pool-submit", Fthread_pool_submit, Sthread_pool_submit,
+       2, 2, 0,
+       doc: /* Queue FUNCTION to be called without arguments in POOL.
+Return a future for its value, see `future-await'.  FUNCTION runs in an
+uncooperative thread, and so must not change buffer text.  */)
+  (Lisp_Object pool, Lisp_Object function)
+{
+  CHECK_THREAD_POOL (pool);
+  struct Lisp_Thread_Pool *p = XTHREAD_POOL (pool);
+  if (p->shutdown)
+    error ("Thread pool is shut down");
+
+  struct Lisp_Future *f
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Future, pool, PVEC_FUTURE);
+  f->function = function;
+  f->value = Qnil;
+  f->error = Qnil;
+  f->pool = pool;
+  f->state = FUTURE_QUEUED;
+  Lisp_Object future;
+  XSETFUTURE (future, f);
+
+  /* Work spawned by work stays with its worker.  */
+  int self = thread_pool_worker_index (p);
+  thread_pool_push (p, self < 0 ? ASIZE (p->workers) : self, future);
+  return future;
+}
+
+DEFUN ("thread-pool-shutdown", Fthread_pool_shutdown, Sthread_pool_shutdown,
+       1, 1, 0,
+       doc: /* Refuse further work in POOL.
+Its workers exit after running the futures already submitted.  */)
+  (Lisp_Object pool)
+{
+  CHECK_THREAD_POOL (pool);
+  struct Lisp_Thread_Pool *p = XTHREAD_POOL (pool);
+  sys_mutex_lock (&p->mutex);
+  p->shutdown = true;
+  sys_cond_broadcast (&p->cond);
+  sys_mutex_unlock (&p->mutex);
+  return Qnil;
+}
+
+DEFUN ("futurep", Ffuturep, Sfuturep, 1, 1, 0,
+       doc: /* Return t if OBJECT is a future.  */)
+  (Lisp_Object object)
+{
+  return FUTUREP (object) ? Qt : Qnil;
+}
+
+DEFUN ("future-done-p", Ffuture_done_p, Sfuture_done_p, 1, 1, 0,
+       doc: /* Return t if FUTURE has finished running.  */)
+  (Lisp_Object future)
+{
+  CHECK_FUTURE (future);
+  struct Lisp_Thread_Pool *pool = XTHREAD_POOL (XFUTURE (future)->pool);
+  sys_mutex_lock (&pool->mutex);
+  bool done = XFUTURE (future)->state == FUTURE_DONE;
+  sys_mutex_unlock (&pool->mutex);
+  return done ? Qt : Qnil;
+}
+
+DEFUN ("future-await", Ffuture_await, Sfuture_await, 1, 1, 0,
+       doc: /* Wait for FUTURE and return the value of its function.
+If the function signaled an error, signal it again.  A worker of the
+future's pool runs other queued futures while it waits.  */)
+  (Lisp_Object future)
+{
+  CHECK_FUTURE (future);
+  struct Lisp_Thread_Pool *pool = XTHREAD_POOL (XFUTURE (future)->pool);
+  int self = thread_pool_worker_index (pool);
+
+  /* Workers may need to read what we changed.  */
+  if (current_thread->cooperative)
+    release_text_locks ();
+
+  for (;;)
+    {
+      sys_mutex_lock (&pool->mutex);
+      bool done = XFUTURE (future)->state == FUTURE_DONE;
+      sys_mutex_unlock (&pool->mutex);
+      if (done)
+	break;
+
+      Lisp_Object other = self < 0 ? Qnil : thread_pool_next (pool, self);
+      if (!NILP (other))
+	{
+	  specpdl_ref count = SPECPDL_INDEX ();
+	  thread_pool_run (other);
+	  unbind_to (count, Qnil);
+	  continue;
+	}
+
+      with_flushed_stack (future_nap_callback, &future);
+      if (current_thread->cooperative)
+	maybe_quit ();
+      maybe_garbage_collect ();
+    }
+
+  Lisp_Object err = XFUTURE (future)->error;
+  if (!NILP (err))
+    xsignal (XCAR (err), XCDR (err));
+  return XFUTURE (future)->value;
+}
+#endif /* HAVE_GCC_TLS */
+
+void
+finalize_one_thread_pool (struct Lisp_Thread_Pool *pool)
+{
+  if (pool->rings)
+    {
+      for (ptrdiff_t k = 0; k < pool->nrings; ++k)
+	sys_mutex_destroy (&pool->rings[k].mutex);
+      xfree (pool->rings);
+      sys_mutex_destroy (&pool->mutex);
+      sys_cond_destroy (&pool->cond);
+    }
+}
+
 bool
 main_thread_p (const void *ptr)
 {
@@ -1073,7 +1779,6 @@ init_threads (void)
   sys_mutex_init (&global_lock);
   sys_mutex_lock (&global_lock);
   eassume (current_thread == &main_state.s);
-  eassume (main_state.s.m_mem_root != NULL);
   main_state.s.thread_id = sys_thread_self ();
   main_state.s.cooperative = true;
   init_bc_thread (&main_state.s.bc);
@@ -1101,7 +1806,22 @@ syms_of_threads (void)
   defsubr (&Scondition_notify);
   defsubr (&Scondition_mutex);
   defsubr (&Scondition_name);
+  defsubr (&Smake_channel);
+  defsubr (&Schannel_send);
+  defsubr (&Schannel_receive);
+  defsubr (&Schannel_try_receive);
+  defsubr (&Schannelp);
+  defsubr (&Schannel_name);
   defsubr (&Sthread_last_error);
+#ifdef HAVE_GCC_TLS
+  defsubr (&Smake_thread_pool);
+  defsubr (&Sthread_pool_p);
+  defsubr (&Sthread_pool_submit);
+  defsubr (&Sthread_pool_shutdown);
+  defsubr (&Sfuturep);
+  defsubr (&Sfuture_done_p);
+  defsubr (&Sfuture_await);
+#endif
 
   staticpro (&last_thread_error);
   last_thread_error = Qnil;
@@ -1112,6 +1832,9 @@ syms_of_threads (void)
   DEFSYM (Qthreadp, "threadp");
   DEFSYM (Qmutexp, "mutexp");
   DEFSYM (Qcondition_variable_p, "condition-variable-p");
+  DEFSYM (Qchannelp, "channelp");
+  DEFSYM (Qthread_pool_p, "thread-pool-p");
+  DEFSYM (Qfuturep, "futurep");
 
   DEFVAR_LISP ("main-thread", Vmain_thread,
     doc: /* The main thread of Emacs.  */);
@@ -52,6 +52,31 @@ #define THREAD_H
   char *stack_end;
 };
 
+/* State of the syntax scanner, see syntax.h.  */
+struct gl_state_s
+{
+  Lisp_Object object;			/* The object we are scanning.  */
+  ptrdiff_t start;			/* Where to stop.  */
+  ptrdiff_t stop;			/* Where to stop.  */
+  bool use_global;			/* Whether to use global_code
+					   or c_s_t.  */
+  Lisp_Object global_code;		/* Syntax code of current char.  */
+  Lisp_Object current_syntax_table;	/* Syntax table for current pos.  */
+  Lisp_Object old_prop;			/* Syntax-table prop at prev pos.  */
+  ptrdiff_t b_property;			/* First index where c_s_t is valid.  */
+  ptrdiff_t e_property;			/* First index where c_s_t is
+					   not valid.  */
+  bool e_property_truncated;		/* true if e_property if was truncated
+					   by parse_sexp_propertize_done.  */
+  INTERVAL forward_i;			/* Where to start lookup on forward.  */
+  INTERVAL backward_i;			/* or backward movement.  The
+					   data in c_s_t is valid
+					   between these intervals,
+					   and possibly at the
+					   intervals too, depending
+					   on:  */
+};
+
 struct ablock;
 struct thread_state
 {
@@ -62,6 +87,10 @@ #define THREAD_H
   Lisp_Object m_last_thing_searched;
 #define last_thing_searched (current_thread->m_last_thing_searched)
 
+  /* String or buffer being matched, see regex-emacs.h.  */
+  Lisp_Object m_re_match_object;
+#define re_match_object (current_thread->m_re_match_object)
+
   Lisp_Object name;
   Lisp_Object function;
 
@@ -150,8 +179,10 @@ #define search_regs (current_thread->m_search_regs)
   sys_jmp_buf m_getcjmp;
 #define getcjmp (current_thread->m_getcjmp)
 
-  /* The red-black tree for finding the memory block of a Lisp_Object.  */
-  struct mem_node *m_mem_root;
+  /* Syntax table state of the scan in progress, if any.  Being
+     per-thread lets several threads scan at once.  */
+  struct gl_state_s m_gl_state;
+#define gl_state (current_thread->m_gl_state)
 
   struct ablock *m_free_ablocks;
 
@@ -165,6 +196,19 @@ #define getcjmp (current_thread->m_getcjmp)
 
   struct sblock *m_current_sblock;
 
+  struct sblock *m_oldest_medium_sblock;
+
+  struct sblock *m_current_medium_sblock;
+
+  /* Emptied medium sblocks awaiting reuse.  */
+  struct sblock *m_spare_sblocks;
+
+  /* Most medium sblocks in use at a collection since
+     m_medium_sblocks_peak_time.  */
+  ptrdiff_t m_medium_sblocks_peak;
+
+  struct timespec m_medium_sblocks_peak_time;
+
   struct sblock *m_large_sblocks;
 
   struct string_block *m_string_blocks;
@@ -177,12 +221,20 @@ #define getcjmp (current_thread->m_getcjmp)
 
   struct Lisp_Float *m_float_free_list;
 
+  /* Next-pointer of the last float block swept since the last
+     collection, or NULL if none remain unswept.  */
+  struct float_block **m_float_unswept;
+
   struct cons_block *m_cons_blocks;
 
   int m_cons_block_index;
 
   struct Lisp_Cons *m_cons_free_list;
 
+  /* Next-pointer of the last cons block swept since the last
+     collection, or NULL if none remain unswept.  */
+  struct cons_block **m_cons_unswept;
+
   struct vector_block *m_vector_blocks;
 
   /* See free_slot() for rationale.  */
@@ -202,6 +254,10 @@ #define getcjmp (current_thread->m_getcjmp)
 
   struct Lisp_Symbol *m_symbol_free_list;
 
+  /* Next-pointer of the last symbol block swept since the last
+     collection, or NULL if none remain unswept.  */
+  struct symbol_block **m_symbol_unswept;
+
   /* The OS identifier for this thread.  */
   sys_thread_t thread_id;
 
@@ -220,6 +276,10 @@ #define getcjmp (current_thread->m_getcjmp)
   /* Run under auspices of global lock.  */
   bool cooperative;
 
+  /* Number of buffer text read locks held by this uncooperative
+     thread.  */
+  int text_reading;
+
   /* Threads are kept on a linked list.  */
   struct thread_state *next_thread;
 
@@ -309,6 +369,149 @@ XCONDVAR (Lisp_Object a)
   return XUNTAG (a, Lisp_Vectorlike, struct Lisp_CondVar);
 }
 
+/* A bounded first-in first-out queue of Lisp objects between threads.
+   Its own mutex, not the global lock, guards it, so that uncooperative
+   threads pass messages without serializing on the global lock.  */
+struct Lisp_Channel
+{
+  union vectorlike_header header;
+  Lisp_Object name;
+
+  /* Vector of CAPACITY slots, COUNT of them in use from HEAD on.  */
+  Lisp_Object ring;
+
+  /* This ends the Lisp fields.  */
+  ptrdiff_t head;
+  ptrdiff_t count;
+  sys_mutex_t mutex;
+
+  /* Broadcast on every send and receive.  */
+  sys_cond_t cond;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+CHANNELP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_CHANNEL);
+}
+
+INLINE void
+CHECK_CHANNEL (Lisp_Object x)
+{
+  CHECK_TYPE (CHANNELP (x), Qchannelp, x);
+}
+
+INLINE struct Lisp_Channel *
+XCHANNEL (Lisp_Object a)
+{
+  eassert (CHANNELP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Channel);
+}
+
+/* A fixed set of uncooperative worker threads running futures.  Each
+   worker pops its own deque at the tail and steals from the others at
+   the head.  */
+struct Lisp_Thread_Pool
+{
+  union vectorlike_header header;
+  Lisp_Object name;
+
+  /* Vector of the worker threads.  */
+  Lisp_Object workers;
+
+  /* Vector of one deque per worker, then one more for futures
+     submitted from outside the pool.  Each deque is a vector used as
+     a ring.  */
+  Lisp_Object deques;
+
+  /* Where each ring of DEQUES starts and how full it is.  */
+  struct thread_pool_deque *rings;
+
+  /* Number of RINGS, for finalization, when DEQUES may be gone.  */
+  ptrdiff_t nrings;
+
+  /* Number of futures sitting in deques.  */
+  ptrdiff_t queued;
+
+  /* No more submissions; workers exit once QUEUED drops to zero.  */
+  bool shutdown;
+
+  /* Guards QUEUED, SHUTDOWN and the state of this pool's futures.
+     Idle workers and awaiting threads wait on COND.  */
+  sys_mutex_t mutex;
+  sys_cond_t cond;
+} GCALIGNED_STRUCT;
+
+struct thread_pool_deque
+{
+  sys_mutex_t mutex;
+  ptrdiff_t head;
+  ptrdiff_t count;
+};
+
+INLINE bool
+THREAD_POOL_P (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_THREAD_POOL);
+}
+
+INLINE void
+CHECK_THREAD_POOL (Lisp_Object x)
+{
+  CHECK_TYPE (THREAD_POOL_P (x), Qthread_pool_p, x);
+}
+
+INLINE struct Lisp_Thread_Pool *
+XTHREAD_POOL (Lisp_Object a)
+{
+  eassert (THREAD_POOL_P (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Thread_Pool);
+}
+
+enum future_state
+{
+  FUTURE_QUEUED,
+  FUTURE_RUNNING,
+  FUTURE_DONE
+};
+
+struct Lisp_Future
+{
+  union vectorlike_header header;
+
+  /* Function to call, nil once called.  */
+  Lisp_Object function;
+
+  /* What FUNCTION returned.  */
+  Lisp_Object value;
+
+  /* (ERROR-SYMBOL . DATA) if FUNCTION signaled, else nil.  */
+  Lisp_Object error;
+
+  Lisp_Object pool;
+
+  enum future_state state;
+} GCALIGNED_STRUCT;
+
+INLINE bool
+FUTUREP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_FUTURE);
+}
+
+INLINE void
+CHECK_FUTURE (Lisp_Object x)
+{
+  CHECK_TYPE (FUTUREP (x), Qfuturep, x);
+}
+
+INLINE struct Lisp_Future *
+XFUTURE (Lisp_Object a)
+{
+  eassert (FUTUREP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Future);
+}
+
 #ifdef HAVE_GCC_TLS
 # define PER_THREAD __thread
 # define PER_THREAD_STATIC __thread
@@ -323,6 +526,8 @@ XCONDVAR (Lisp_Object a)
 extern void finalize_one_thread (struct thread_state *state);
 extern void finalize_one_mutex (struct Lisp_Mutex *);
 extern void finalize_one_condvar (struct Lisp_CondVar *);
+extern void finalize_one_channel (struct Lisp_Channel *);
+extern void finalize_one_thread_pool (struct Lisp_Thread_Pool *);
 
 extern void init_threads (void);
 extern void syms_of_threads (void);
@@ -343,6 +548,28 @@ XCONDVAR (Lisp_Object a)
 #ifdef HAVE_GCC_TLS
 void reap_threads (void);
 extern void reap_thread_allocations (struct thread_state *);
+extern int uncooperative_threads;
+extern void buffer_text_read_lock (struct buffer *);
+extern void buffer_text_write_lock_1 (struct buffer *);
+
+/* Take buffer B's text for writing, which only matters while
+   uncooperative threads might be reading it.  */
+INLINE void
+buffer_text_write_lock (struct buffer *b)
+{
+  if (uncooperative_threads)
+    buffer_text_write_lock_1 (b);
+}
+#else
+INLINE void
+buffer_text_read_lock (struct buffer *b)
+{
+}
+
+INLINE void
+buffer_text_write_lock (struct buffer *b)
+{
+}
 #endif
 
 size_t exception_stack_count (struct thread_state *thr);
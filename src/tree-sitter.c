@@ -45,6 +45,8 @@ make_sitter (TSParser *parser, TSTree *tree, Lisp_Object progmode_arg)
   ptr->highlights_query = NULL;
   ptr->indents_query = NULL;
   ptr->dirty = true;
+  ptr->node_tree = NULL;
+  sys_mutex_init (&ptr->mutex);
   return make_lisp_ptr (ptr, Lisp_Vectorlike);
 }
 
@@ -329,8 +331,8 @@ ensure_highlighter(Lisp_Object sitter)
 tree_sitter_read_buffer (void *payload, uint32_t byte_index,
                          TSPoint position, uint32_t *bytes_read)
 {
-  static int thread_unsafe_last_scan_characters = -1;
-  static char *thread_unsafe_return_value = NULL;
+  static PER_THREAD int thread_unsafe_last_scan_characters = -1;
+  static PER_THREAD char *thread_unsafe_return_value = NULL;
   EMACS_INT start = SITTER_TO_BUFFER (byte_index);
   struct buffer *bp = (struct buffer *) payload;
   specpdl_ref pdl_count = SPECPDL_INDEX ();
@@ -363,11 +365,34 @@ tree_sitter_read_buffer (void *payload, uint32_t byte_index,
   return thread_unsafe_return_value;
 }
 
-static TSTree *
-parsed_tree (struct Lisp_Tree_Sitter *sitter)
+static void
+unlock_sitter (void *arg)
+{
+  sys_mutex_unlock (&((struct Lisp_Tree_Sitter *) arg)->mutex);
+}
+
+static void
+delete_tree (void *tree)
+{
+  ts_tree_delete (tree);
+}
+
+/* Lock SITTER and reparse it if the buffer changed.  Return the count
+   to unbind to for unlocking it.
+
+   The calling thread also shares the buffer's text for reading until
+   the caller unbinds, so no change, and hence no reparse, can happen
+   to the tree while the caller walks it.  */
+
+static specpdl_ref
+lock_parsed (struct Lisp_Tree_Sitter *sitter)
 {
   if (sitter->tree == NULL)
     xsignal1 (Qtree_sitter_error, BVAR (XBUFFER (Fcurrent_buffer ()), name));
+  buffer_text_read_lock (current_buffer);
+  specpdl_ref count = SPECPDL_INDEX ();
+  sys_mutex_lock (&sitter->mutex);
+  record_unwind_protect_ptr (unlock_sitter, sitter);
   if (sitter->dirty)
     {
       TSTree *tree = sitter->tree;
@@ -377,6 +402,11 @@ parsed_tree (struct Lisp_Tree_Sitter *sitter)
 	  ts_tree_delete (sitter->prev_tree);
 	  sitter->prev_tree = NULL;
 	}
+      if (sitter->node_tree != NULL)
+	{
+	  ts_tree_delete (sitter->node_tree);
+	  sitter->node_tree = NULL;
+	}
 
       sitter->prev_tree = ts_tree_copy (tree);
       sitter->tree =
@@ -389,7 +419,41 @@ parsed_tree (struct Lisp_Tree_Sitter *sitter)
 			 });
       ts_tree_delete (tree);
     }
-  return sitter->tree;
+  return count;
+}
+
+/* Return a copy of SITTER's tree, reparsed if need be, which is
+   deleted when the caller unbinds.  If PREV, also store there a
+   copy of the tree before the last reparse, or NULL if none.  */
+
+static TSTree *
+parsed_tree (struct Lisp_Tree_Sitter *sitter, TSTree **prev)
+{
+  specpdl_ref count = lock_parsed (sitter);
+  TSTree *tree = ts_tree_copy (sitter->tree);
+  TSTree *prev_tree = (prev && sitter->prev_tree
+		       ? ts_tree_copy (sitter->prev_tree) : NULL);
+  unbind_to (count, Qnil);
+  record_unwind_protect_ptr (delete_tree, tree);
+  if (prev_tree)
+    record_unwind_protect_ptr (delete_tree, prev_tree);
+  if (prev)
+    *prev = prev_tree;
+  return tree;
+}
+
+/* Like parsed_tree, but return a tree that nodes handed to Lisp can
+   point into.  It stays until the next change to the buffer.  */
+
+static const TSTree *
+parsed_node_tree (struct Lisp_Tree_Sitter *sitter)
+{
+  specpdl_ref count = lock_parsed (sitter);
+  if (sitter->node_tree == NULL)
+    sitter->node_tree = ts_tree_copy (sitter->tree);
+  const TSTree *tree = sitter->node_tree;
+  unbind_to (count, Qnil);
+  return tree;
 }
 
 static Lisp_Object
@@ -407,6 +471,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
 					       Fsymbol_value (Qtree_sitter_mode_alist)));
       Lisp_Object max_bytes = Fsymbol_value (Qjit_lock_chunk_size);
       char *scope;
+      specpdl_ref count = SPECPDL_INDEX ();
 
       USE_SAFE_ALLOCA;
       scope = SAFE_ALLOCA (strlen ("scope.") + SCHARS (language) + 1);
@@ -415,7 +480,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
       if (ts_highlighter)
 	{
 	  TSNode node = ts_node_first_child_for_byte
-	    (ts_tree_root_node (parsed_tree (XTREE_SITTER (sitter))),
+	    (ts_tree_root_node (parsed_tree (XTREE_SITTER (sitter), NULL)),
 	     BUFFER_TO_SITTER (XFIXNUM (beg)));
 	  while (!ts_node_is_null (node)
 		 && ts_node_start_byte (node) < BUFFER_TO_SITTER (XFIXNUM (end)))
@@ -468,6 +533,7 @@ do_highlights (Lisp_Object beg, Lisp_Object end, HighlightsFunctor fn)
 	}
 
       SAFE_FREE ();
+      unbind_to (count, Qnil);
     }
   return retval;
 }
@@ -515,13 +581,15 @@ DEFUN ("tree-sitter-root-node",
 
   if (!NILP (sitter))
     {
-      const TSTree *tree = parsed_tree (XTREE_SITTER (sitter));
+      specpdl_ref count = SPECPDL_INDEX ();
+      const TSTree *tree = parsed_node_tree (XTREE_SITTER (sitter));
       if (tree != NULL)
 	{
 	  TSNode root_node = ts_tree_root_node (tree);
 	  if (!ts_node_is_null (root_node))
 	    retval = make_node (root_node);
 	}
+      unbind_to (count, Qnil);
     }
   return retval;
 }
@@ -547,17 +615,18 @@ DEFUN ("tree-sitter-ppss",
   if (NILP (sitter))
     return retval;
 
-  tree = parsed_tree (XTREE_SITTER (sitter));
+  specpdl_ref count = SPECPDL_INDEX ();
+  tree = parsed_tree (XTREE_SITTER (sitter), NULL);
   if (tree == NULL)
-    return retval;
+    return unbind_to (count, retval);
 
   node = ts_tree_node_at (tree, BUFFER_TO_SITTER (XFIXNUM (pos)));
   if (ts_node_is_null (node))
-    return retval;
+    return unbind_to (count, retval);
 
   parent = ts_node_parent (node);
   if (ts_node_is_null (parent))
-    return retval;
+    return unbind_to (count, retval);
 
   Fsetcar (Fnthcdr (make_fixnum (1), retval),
 	   make_fixnum (SITTER_TO_BUFFER (ts_node_start_byte (parent))));
@@ -599,7 +668,7 @@ DEFUN ("tree-sitter-ppss",
 	}
     }
   Fsetcar (retval, make_fixnum (max (depth, 0)));
-  return retval;
+  return unbind_to (count, retval);
 }
 
 DEFUN ("tree-sitter-node-of",
@@ -727,16 +796,20 @@ DEFUN ("tree-sitter-node-at",
   if (NILP (sitter))
     return Qnil;
 
-  tree = parsed_tree (XTREE_SITTER (sitter));
+  specpdl_ref count = SPECPDL_INDEX ();
+  tree = parsed_node_tree (XTREE_SITTER (sitter));
   if (tree == NULL)
-    return Qnil;
+    return unbind_to (count, Qnil);
 
   node = ts_tree_node_at (tree, BUFFER_TO_SITTER (XFIXNUM (pos)));
-  return (ts_node_is_null (node)
-	  || (!NILP (precise)
-	      && (XFIXNUM (pos) < SITTER_TO_BUFFER (ts_node_start_byte (node))
-		  || XFIXNUM (pos) >= SITTER_TO_BUFFER (ts_node_end_byte (node)))))
-    ? Qnil : make_node (node);
+  return unbind_to (count,
+		    (ts_node_is_null (node)
+		     || (!NILP (precise)
+			 && (XFIXNUM (pos)
+			     < SITTER_TO_BUFFER (ts_node_start_byte (node))
+			     || XFIXNUM (pos)
+			     >= SITTER_TO_BUFFER (ts_node_end_byte (node)))))
+		    ? Qnil : make_node (node));
 }
 
 DEFUN ("tree-sitter-node-parent",
@@ -1740,8 +1813,9 @@ DEFUN ("tree-sitter-changed-range",
 
   if (!NILP (sitter))
     {
-      const TSTree *tree = parsed_tree (XTREE_SITTER (sitter)),
-	*prev_tree = XTREE_SITTER (sitter)->prev_tree;
+      specpdl_ref count = SPECPDL_INDEX ();
+      TSTree *prev_tree;
+      const TSTree *tree = parsed_tree (XTREE_SITTER (sitter), &prev_tree);
       if (tree != NULL && prev_tree != NULL)
 	{
 	  uint32_t count;
@@ -1754,6 +1828,7 @@ DEFUN ("tree-sitter-changed-range",
 	      free (range);
 	    }
 	}
+      unbind_to (count, Qnil);
     }
   return retval;
 }
@@ -1778,25 +1853,33 @@ DEFUN ("tree-sitter",
 		     tree_sitter_create (BVAR (XBUFFER (buffer), major_mode)));
     }
 
-  if (!NILP (sitter))
+  if (NILP (sitter))
+    xsignal1 (Qtree_sitter_error, BVAR (XBUFFER (Fcurrent_buffer ()), name));
+
+  if (XTREE_SITTER (sitter)->tree == NULL)
     {
-      if (XTREE_SITTER (sitter)->tree == NULL)
+      /* Uncooperative threads may get here at the same time.  */
+      struct Lisp_Tree_Sitter *ptr = XTREE_SITTER (sitter);
+      specpdl_ref count = SPECPDL_INDEX ();
+      buffer_text_read_lock (XBUFFER (buffer));
+      sys_mutex_lock (&ptr->mutex);
+      record_unwind_protect_ptr (unlock_sitter, ptr);
+      if (ptr->tree == NULL)
 	{
-	  XTREE_SITTER (sitter)->tree =
-	    ts_parser_parse (XTREE_SITTER (sitter)->parser,
-			     XTREE_SITTER (sitter)->tree,
+	  ptr->tree =
+	    ts_parser_parse (ptr->parser,
+			     ptr->tree,
 			     (TSInput) {
 			       XBUFFER (buffer),
 			       tree_sitter_read_buffer,
 			       TSInputEncodingUTF8
 			     });
-	  if (XTREE_SITTER (sitter)->tree == NULL)
+	  if (ptr->tree == NULL)
 	    xsignal1 (Qtree_sitter_parse_error, BVAR (XBUFFER (buffer), name));
-          XTREE_SITTER (sitter)->dirty = false;
+	  ptr->dirty = false;
 	}
+      unbind_to (count, Qnil);
     }
-  else
-    xsignal1 (Qtree_sitter_error, BVAR (XBUFFER (Fcurrent_buffer ()), name));
   return sitter;
 }
 
@@ -1821,8 +1904,10 @@ tree_sitter_record_change (ptrdiff_t start_char,
 	    (TSPoint) { 0, 0 },
 	    (TSPoint) { 0, max (1, new_end_char - start_char) } /* black magic */
 	  };
+	  sys_mutex_lock (&XTREE_SITTER (sitter)->mutex);
           XTREE_SITTER (sitter)->dirty = true;
 	  ts_tree_edit (tree, &edit);
+	  sys_mutex_unlock (&XTREE_SITTER (sitter)->mutex);
 	}
       else
 	{
@@ -55,6 +55,13 @@ #define SITTER_TO_BUFFER(byte) (BYTE_TO_CHAR ((EMACS_INT) byte + 1))
   char *highlights_query;
   TSQuery *indents_query;
   bool dirty;
+
+  /* Copy of TREE that nodes handed to Lisp point into, deleted on the
+     next reparse.  */
+  TSTree *node_tree;
+
+  /* Serializes reparses, which uncooperative threads may also do.  */
+  sys_mutex_t mutex;
 } GCALIGNED_STRUCT;
 
 INLINE bool
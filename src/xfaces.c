@@ -4496,6 +4496,9 @@ free_realized_face (struct frame *f, struct face *face)
 #endif /* HAVE_X_WINDOWS */
 	  image_destroy_bitmap (f, face->stipple);
 	}
+      /* Cached face ids may refer to FACE or its kin.  */
+      invalidate_face_char_caches ();
+      xfree (face->char_cache);
 #endif /* HAVE_WINDOW_SYSTEM */
 
       xfree (face);
@@ -5977,6 +5980,7 @@ realize_non_ascii_face (struct frame *f, Lisp_Object font_object,
   face->colors_copied_bitwise_p = true;
   face->font = NILP (font_object) ? NULL : XFONT_OBJECT (font_object);
   face->gc = 0;
+  face->char_cache = NULL;
 
   cache_face (cache, face, face->hash);
 
@@ -38,6 +38,26 @@ font-lock-test-prepend-anonymous-face
     (should (equal (get-text-property 1 'face (current-buffer))
                    '((:strike-through t) italic)))))
 
+(ert-deftest font-lock-test-keywords-after-text-change ()
+  "Keywords match the text as it is when they are applied."
+  (with-temp-buffer
+    (insert "foo bar\nbaz x\n\n\n\n")
+    (setq-local font-lock-defaults
+                '((("x*" 0 'underline)
+                   ("foo" 0 (progn
+                              (save-excursion
+                                (goto-char (match-beginning 0))
+                                (insert "!!"))
+                              'italic))
+                   ("ba[rz]\\|x" 0 'bold prepend))
+                  t))
+    (font-lock-ensure)
+    (should (equal (buffer-string) "!!foo bar\nbaz x\n\n\n\n"))
+    (should (equal (get-text-property 7 'face) '(bold)))
+    (should (equal (get-text-property 11 'face) '(bold)))
+    (should-not (get-text-property 10 'face))
+    (should (equal (get-text-property 15 'face) '(bold underline)))))
+
 (ert-deftest font-lock-test-add-keywords-derived-mode ()
   "Bug#24176 exercises monnier's `font-lock-add-keywords' implicit hack.
 To specify keywords for a derived mode without repeating those of
@@ -154,6 +154,17 @@ term-colors-bold-is-bright
         (should (equal (text-properties-at 0 result)
                        (text-properties-at 0 expected)))))))
 
+(ert-deftest term-colors-in-one-chunk ()
+  (skip-when (memq system-type '(windows-nt ms-dos)))
+  ;; Text in several colors comes out the same whether or not the
+  ;; changes of color arrive with it.
+  (let ((pieces '("ab" "\e[33m" "Hello" "\e[1;43m" " Wd" "\e[0m" "!\r\n"
+                  "\e[33m" "x" "\e[m" "y" "\e[93m" "0123456789012"
+                  "\e[0m" "z")))
+    (should (equal-including-properties
+             (term-test-screen-from-input 12 12 (apply #'concat pieces))
+             (term-test-screen-from-input 12 12 pieces)))))
+
 (ert-deftest term-cursor-movement ()
   (skip-when (memq system-type '(windows-nt ms-dos)))
   ;; Absolute positioning.
@@ -0,0 +1,83 @@
+;;; base64-perf.el --- Timings of the base64 functions  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Run with
+;;
+;;   emacs -Q --batch -l test/manual/base64-perf.el -f base64-perf-run
+;;
+;; to print the time taken to encode and decode random data of sizes
+;; from 1 KB to 100 MB, as strings and as buffer regions, in unibyte
+;; and multibyte buffers.
+
+;;; Code:
+
+(require 'benchmark)
+
+(defconst base64-perf-sizes
+  '(1024 (* 64 1024) (* 1024 1024) (* 16 1024 1024) (* 100 1024 1024))
+  "Sizes of the data to time, in bytes.")
+
+(defun base64-perf-data (size)
+  "Return a unibyte string of SIZE random bytes."
+  (let ((data (make-string size 0)))
+    (dotimes (i size)
+      (aset data i (random 256)))
+    (string-to-unibyte data)))
+
+(defun base64-perf-time (size thunk)
+  "Return the time THUNK takes per call on data of SIZE bytes.
+Repeat it often enough for about 16 MB to pass through."
+  (let ((repetitions (max 1 (/ (* 16 1024 1024) size))))
+    (/ (car (benchmark-call thunk repetitions)) repetitions)))
+
+(defun base64-perf-region (size data multibyte function &rest args)
+  "Time FUNCTION on a buffer holding DATA, which has SIZE bytes.
+MULTIBYTE says whether the buffer is multibyte.  Pass ARGS to
+FUNCTION after the region."
+  (with-temp-buffer
+    (set-buffer-multibyte multibyte)
+    (base64-perf-time
+     size (lambda ()
+            (erase-buffer)
+            (insert data)
+            (apply function (point-min) (point-max) args)))))
+
+(defun base64-perf-run ()
+  "Print timings of the base64 functions."
+  (message "%10s %12s %12s %12s %12s %12s %12s"
+           "bytes" "enc-string" "dec-string" "enc-region" "dec-region"
+           "enc-mb" "dec-mb")
+  (dolist (size (mapcar #'eval base64-perf-sizes))
+    (let* ((data (base64-perf-data size))
+           (encoded (base64-encode-string data)))
+      (garbage-collect)
+      (message "%10d %12.6f %12.6f %12.6f %12.6f %12.6f %12.6f"
+               size
+               (base64-perf-time size (lambda () (base64-encode-string data)))
+               (base64-perf-time size (lambda ()
+                                        (base64-decode-string encoded)))
+               (base64-perf-region size data nil #'base64-encode-region)
+               (base64-perf-region size encoded nil #'base64-decode-region)
+               (base64-perf-region size data t #'base64-encode-region)
+               (base64-perf-region size encoded t
+                                   #'base64-decode-region)))))
+
+;;; base64-perf.el ends here
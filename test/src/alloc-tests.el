@@ -27,6 +27,7 @@
 ;;; Code:
 
 (require 'ert)
+(require 'ert-x)
 (require 'cl-lib)
 
 (ert-deftest finalizer-object-type ()
@@ -100,4 +101,75 @@ flip-one-float
     (garbage-collect)
     (should (= (1+ ocount) (alist-get 'floats (mgc-counts))))))
 
+(ert-deftest lazy-sweep-reuses-free-conses ()
+  "Conses freed by collection should be reused before new blocks."
+  (let ((gc-cons-threshold most-positive-fixnum)
+        garbage)
+    ;; Unlinked conses, so that a stray pointer to one of them found
+    ;; by conservative stack scanning keeps no others alive.
+    (dotimes (_ 100000)
+      (setq garbage (cons nil nil)))
+    (setq garbage nil)
+    (let* ((counts (alist-get 'conses (garbage-collect)))
+           (capacity (+ (nth 1 counts) (nth 2 counts)))
+           (free (nth 2 counts)))
+      (should (>= free 90000))
+      ;; Allocating half of what was freed takes no new blocks.
+      (setq garbage (make-list (/ free 2) nil))
+      (setq counts (alist-get 'conses (garbage-collect)))
+      (should (>= (nth 1 counts) (/ free 2)))
+      (should (<= (+ (nth 1 counts) (nth 2 counts)) capacity)))))
+
+(ert-deftest gc-events-record-collections ()
+  (let ((gc-event-log-file nil))
+    (garbage-collect)
+    (let ((event (car (gc-events))))
+      (should (eq (plist-get event :trigger) 'explicit))
+      (should (= (plist-get event :number) gcs-done))
+      (should (<= (+ (plist-get event :mark) (plist-get event :sweep))
+                  (plist-get event :elapsed)))
+      (should (> (alist-get 'conses (plist-get event :live)) 0))
+      (should (natnump (alist-get 'conses (plist-get event :freed)))))
+    (should (<= (length (gc-events)) 64))))
+
+(ert-deftest gc-events-log-file ()
+  (ert-with-temp-file file
+    (let ((gc-event-log-file file))
+      (garbage-collect)
+      (garbage-collect))
+    (with-temp-buffer
+      (insert-file-contents file)
+      (should (= (count-lines (point-min) (point-max)) 2))
+      (goto-char (point-min))
+      (should (looking-at "gc=[0-9]+ trigger=explicit "))
+      (should (re-search-forward " conses=[0-9]+/[0-9]+ " (pos-eol) t)))))
+
+(ert-deftest gc-events-log-file-relative ()
+  "A relative log file name is expanded when the variable is set."
+  (ert-with-temp-directory dir
+    (let ((default-directory dir))
+      (let ((gc-event-log-file "gc.log"))
+        (let ((default-directory temporary-file-directory))
+          (garbage-collect))))
+    (should (file-exists-p (expand-file-name "gc.log" dir)))
+    (garbage-collect)
+    (with-temp-buffer
+      (insert-file-contents (expand-file-name "gc.log" dir))
+      (should (= (count-lines (point-min) (point-max)) 1)))))
+
+(ert-deftest gc-events-medium-strings-compacted ()
+  "Medium strings should survive compaction and free their blocks."
+  (let* ((gc-event-log-file nil)
+         (strings (mapcar (lambda (i) (make-string (+ 2000 i) (+ ?a (% i 26))))
+                          (number-sequence 0 499)))
+         (kept (seq-filter (lambda (s) (zerop (% (length s) 50))) strings)))
+    (setq strings nil)
+    (garbage-collect)
+    (let ((event (car (gc-events))))
+      (should (> (plist-get event :sblocks-freed) 0))
+      (should (> (plist-get event :sblock-bytes) 0))
+      (should (<= 0 (plist-get event :string-fragmentation) 1)))
+    (dolist (s kept)
+      (should (string-match-p (format "\\`%c+\\'" (aref s 0)) s)))))
+
 ;;; alloc-tests.el ends here
@@ -0,0 +1,86 @@
+;;; ansi-tests.el --- Tests for ansi.c  -*- lexical-binding: t; -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is NOT part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(defun ansi-tests--face (face-vec)
+  "Return a copy of FACE-VEC to compare with."
+  (list (append (car face-vec) nil) (nth 1 face-vec) (nth 2 face-vec)))
+
+(ert-deftest ansi-test-scan-sequences ()
+  (let ((string "a\e[1;31mb\e[Kc\e[0md\e[4"))
+    ;; Without a face, just find the sequences.
+    (should (equal (ansi-color--scan string 0 (length string) nil nil)
+                   '(nil 18 ((1 8) (9 12) (13 17)))))
+    (should (equal (ansi-color--scan string 1 18 nil nil)
+                   '(nil nil ((1 8) (9 12) (13 17)))))
+    ;; An escape that starts no sequence is left alone.
+    (should (equal (ansi-color--scan "\eX\e[1\n" 0 6 nil nil)
+                   '(nil nil nil)))
+    (should (equal (ansi-color--scan "x\e" 0 2 nil nil) '(nil 1 nil)))
+    (with-temp-buffer
+      (insert "é" string)
+      (should (equal (ansi-color--scan nil 1 (point-max) nil nil)
+                     '(nil 20 ((3 10) (11 14) (15 19))))))))
+
+(ert-deftest ansi-test-scan-faces ()
+  (let* ((face-vec (list (make-bool-vector 8 nil) nil nil))
+         (faces nil)
+         (face-function (lambda (fv)
+                          (push (ansi-tests--face fv) faces)
+                          (length faces)))
+         (string (concat "\e[1;31mbold red\e[K\e[38;5;200;48;2;1;2;3m"
+                         "\e[22;39m\e[58m\e[38;2;300;0;0mx")))
+    (should (equal (ansi-color--scan string 0 (length string)
+                                     face-vec face-function)
+                   '(5 nil ((0 7 . 1) (15 18 . 2) (18 40 . 2) (40 48 . 3)
+                            (48 53 . 4) (53 68 . 5)))))
+    ;; The face is computed again only when the state changes.
+    (should (equal (nreverse faces)
+                   `(((nil nil nil nil nil nil nil nil) nil nil)
+                     ((nil t nil nil nil nil nil nil) 1 nil)
+                     ;; 24-bit colors come after the 256 indexed ones.
+                     ((nil t nil nil nil nil nil nil) 200 ,(+ 256 #x10203))
+                     ((nil nil nil nil nil nil nil nil) nil ,(+ 256 #x10203))
+                     ((nil nil nil nil nil nil nil nil) nil nil))))
+    (should (equal (ansi-tests--face face-vec)
+                   '((nil nil nil nil nil nil nil nil) nil nil)))))
+
+(ert-deftest ansi-test-term-next-control ()
+  (should (equal (term--next-control "ab\r\ncd" 0) '(2 3)))
+  (should (equal (term--next-control "ab\r\ncd" 3) '(3 4)))
+  (should-not (term--next-control "ab\r\ncd" 4))
+  ;; Parameters are numbers, and empty ones are 0.
+  (should (equal (term--next-control "é\e[12;;3H" 0) '(1 9 12 0 3)))
+  (should (equal (term--next-control "\e[m" 0) '(0 3 0)))
+  (should (equal (term--next-control "\e[?25l" 0) '(0 6 0)))
+  ;; Sequences with intermediate bytes have no parameters.
+  (should (equal (term--next-control "\e[1 q" 0) '(0 5)))
+  (should (equal (term--next-control "\e7\eM" 0) '(0 2)))
+  (should (equal (term--next-control "x\032/tmp\r\n" 0) '(1 8)))
+  (should (equal (term--next-control "\eAnSiTc /\n" 0) '(0 10)))
+  ;; Incomplete sequences and unknown escapes are not control sequences.
+  (should-not (term--next-control "\e[12" 0))
+  (should (equal (term--next-control "\032\n\eAnSiT\n\ex" 0) '(1 2)))
+  (should (equal (term--next-control "\032\n\eAnSiT\n\ex" 2) '(8 9)))
+  (should-not (term--next-control "\032\n\eAnSiT\n\ex" 9)))
+
+;;; ansi-tests.el ends here
@@ -8561,4 +8561,29 @@ test-buffer-switch-visible
       (let (kill-buffer-query-functions)
         (kill-buffer buffer)))))
 
+;; Big buffer text is mapped on its own where the system allows.
+(ert-deftest test-buffer-big-text ()
+  (let ((chunk (make-string 4096 ?a))
+        (a (generate-new-buffer " *big-a*"))
+        (b (generate-new-buffer " *big-b*")))
+    (unwind-protect
+        (progn
+          (with-current-buffer a
+            (dotimes (i 1024)
+              (insert chunk (format "%d\n" i)))
+            (goto-char (/ (point-max) 2))
+            (insert "middle")
+            (should (search-backward "middle" nil t))
+            (should (= (buffer-size) (+ (* 1024 4096) 4010 6)))
+            (delete-region (point-min) (- (point-max) 10))
+            (should (equal (buffer-string) "aaaaa1023\n"))
+            (buffer-swap-text b)
+            (should (= (buffer-size) 0)))
+          (with-current-buffer b
+            (should (= (buffer-size) 10))
+            (insert (make-string (* 3 1024 1024) ?b))
+            (should (= (char-before) ?b))))
+      (kill-buffer a)
+      (kill-buffer b))))
+
 ;;; buffer-tests.el ends here
@@ -294,6 +294,45 @@ casefiddle-turkish
     ;;(should (string-equal (capitalize "indIá") "İndıa"))
     ))
 
+(ert-deftest casefiddle-tests-region-ascii-runs ()
+  ;; Long ASCII runs are cased in place, on both sides of the gap,
+  ;; but must agree with casing strings character by character.
+  (let ((text (concat (make-string 300 ?x) " ΣA ﬁsh Ab\n"
+                      (apply #'concat (make-list 40 "Mixed CASE words; "))
+                      "straße ΌΣ\n")))
+    (dolist (funcs '((upcase upcase-region) (downcase downcase-region)
+                     (capitalize capitalize-region)
+                     (upcase-initials upcase-initials-region)))
+      (with-temp-buffer
+        (insert text)
+        ;; Move the gap into the middle of the region.
+        (goto-char 500)
+        (insert "*")
+        (delete-char -1)
+        (should (< 2 (gap-position) (point-max)))
+        (let (changes)
+          (add-hook 'after-change-functions
+                    (lambda (&rest args) (push args changes)) nil t)
+          (funcall (cadr funcs) 2 (point-max))
+          (should (equal (buffer-string)
+                         (concat "x" (funcall (car funcs)
+                                              (substring text 1)))))
+          ;; The change starts at the first character that changed.
+          (should (equal (car (car changes))
+                         (if (eq (car funcs) 'downcase) 302 2)))))))
+  ;; A case table that maps ASCII characters to non-ASCII ones.
+  (with-temp-buffer
+    (let ((table (copy-case-table (standard-case-table))))
+      (set-case-syntax-pair ?I ?ı table)
+      (set-case-table table))
+    (insert (make-string 100 ?I) "i" (make-string 100 ?a))
+    (downcase-region (point-min) (point-max))
+    (should (equal (buffer-string)
+                   (concat (make-string 100 ?ı) "i" (make-string 100 ?a))))
+    (upcase-region (point-min) (point-max))
+    (should (equal (buffer-string)
+                   (concat (make-string 100 ?I) "I" (make-string 100 ?A))))))
+
 (defun casefiddle-tests--check-syms (init with-words with-symbols)
   (let ((case-symbols-as-words nil))
     (should (string-equal (upcase-initials init) with-words)))
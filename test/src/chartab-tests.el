@@ -69,5 +69,25 @@ chartab-test-char-table-extra-slot
     (set-char-table-extra-slot tbl 1 'bar)
     (should (eq (char-table-extra-slot tbl 1) 'bar))))
 
+;; Syntax lookups go through a flattened copy of the syntax table,
+;; which must follow modifications of the table and of its parent.
+(ert-deftest chartab-test-flat-follows-modifications ()
+  (let* ((parent (make-syntax-table))
+         (table (make-syntax-table parent)))
+    (with-temp-buffer
+      (set-syntax-table table)
+      (modify-syntax-entry ?α "w" parent)
+      (should (eq (char-syntax ?α) ?w))
+      (modify-syntax-entry ?α "." parent)
+      (should (eq (char-syntax ?α) ?.))
+      (modify-syntax-entry '(?α . ?ω) "_" table)
+      (should (eq (char-syntax ?β) ?_))
+      (set-char-table-parent table (standard-syntax-table))
+      (should (eq (char-syntax ?β) ?_))
+      (set-char-table-range table '(?α . ?ω) nil)
+      (should (eq (char-syntax ?β)
+                  (with-syntax-table (standard-syntax-table)
+                    (char-syntax ?β)))))))
+
 (provide 'chartab-tests)
 ;;; chartab-tests.el ends here
@@ -23,6 +23,7 @@
 
 (require 'cl-lib)
 (require 'ert)
+(require 'ert-x)
 
 (ert-deftest fns-tests-identity ()
   (let ((num 12345)) (should (eq (identity num) num)))
@@ -355,6 +356,42 @@ fns-tests-sort
   (should (equal (should-error (sort "cba" #'<) :type 'wrong-type-argument)
                  '(wrong-type-argument list-or-vector-p "cba"))))
 
+(ert-deftest fns-tests-sort-key ()
+  (let ((calls 0))
+    (should (equal (sort (list "ccc" "a" "bb" "dd") #'<
+                         (lambda (x) (cl-incf calls) (length x)))
+                   '("a" "bb" "dd" "ccc")))
+    ;; KEY is called once per element, not once per comparison.
+    (should (= calls 4)))
+  (should (equal (sort (vector '(2 . a) '(1 . b) '(2 . c) '(1 . d))
+                       #'> #'car)
+                 [(2 . a) (2 . c) (1 . b) (1 . d)]))
+  (should (equal (sort (list "b" "C" "a") #'string< #'downcase)
+                 '("a" "b" "C")))
+  (let ((v (vconcat (number-sequence 1 300))))
+    (should (equal (sort (copy-sequence v) #'< #'-) (reverse v))))
+  ;; A nonlocal exit leaves the elements, not the decoration.
+  (let ((v (vconcat (number-sequence 1 300))))
+    (should-error (sort v (lambda (a b) (if (= a -150) (error "Boom") (< a b)))
+                        #'-))
+    (should (equal (sort v #'<) (vconcat (number-sequence 1 300))))))
+
+(ert-deftest fns-tests-sort-builtin-predicates ()
+  (should (equal (sort (list 3 1.5 2 -1 0.5) #'<) '(-1 0.5 1.5 2 3)))
+  (should (equal (sort (vector 3 1.5 2 -1 0.5) #'>) [3 2 1.5 0.5 -1]))
+  (should (equal (sort (list (1+ most-positive-fixnum) 1 -1.0) #'<)
+                 (list -1.0 1 (1+ most-positive-fixnum))))
+  (should (equal (sort (list "b" 'c "a") #'string<) '("a" "b" c)))
+  (should-error (sort (list 1 "a") #'<) :type 'wrong-type-argument)
+  ;; Advice on the builtin is honored.
+  (let ((calls 0))
+    (advice-add '< :before (lambda (&rest _) (cl-incf calls))
+                '((name . fns-tests-sort)))
+    (unwind-protect
+        (sort (list 3 2 1) #'<)
+      (advice-remove '< 'fns-tests-sort))
+    (should (< 0 calls))))
+
 (defvar w32-collate-ignore-punctuation)
 
 (ert-deftest fns-tests-collate-sort ()
@@ -613,6 +650,85 @@ fns-tests-base64-decode-string
   (should (eq :got-error (condition-case () (base64-decode-string "Zm9vYmFy=") (error :got-error))))
   (should (eq :got-error (condition-case () (base64-decode-string "Zg=Zg=") (error :got-error)))))
 
+;; Long data takes the paths that convert several bytes at once.
+(ert-deftest fns-tests-base64-long ()
+  (let ((data (apply #'unibyte-string
+                     (mapcar (lambda (i) (% (* i 7) 256)) (number-sequence 0 4999)))))
+    (dolist (no-line-break '(nil t))
+      (let ((encoded (base64-encode-string data no-line-break)))
+        (should (equal (base64-decode-string encoded) data))
+        (should (equal (string-search "\n" encoded)
+                       (and (not no-line-break) 76)))
+        (should (equal (base64-encode-string (string-to-multibyte data)
+                                             no-line-break)
+                       encoded))
+        (should (equal (fns-tests--with-region base64-encode-region data
+                         no-line-break)
+                       encoded))
+        (with-temp-buffer
+          (insert encoded)
+          (should (= (base64-decode-region (point-min) (point-max))
+                     (length data)))
+          (should (equal (buffer-string) (string-to-multibyte data))))))))
+
+(ert-deftest fns-tests-base64-region-markers ()
+  (with-temp-buffer
+    (insert "<foobar>")
+    (let ((start (copy-marker 2))
+          (start-after (copy-marker 2 t))
+          (inside (copy-marker 4))
+          (end (copy-marker 8)))
+      (goto-char 5)
+      (should (= (base64-encode-region 2 8) 8))
+      (should (equal (buffer-string) "<Zm9vYmFy>"))
+      (should (= (point) 2))
+      (should (equal (list start start-after inside end)
+                     (mapcar #'copy-marker '(2 10 10 10))))
+      (should (= (base64-decode-region 2 10) 6))
+      (should (equal (buffer-string) "<foobar>"))
+      (should (equal (list start start-after inside end)
+                     (mapcar #'copy-marker '(2 8 8 8)))))))
+
+(ert-deftest fns-tests-base64-decode-region-invalid ()
+  (with-temp-buffer
+    (let* ((changes 0)
+           (before-change-functions
+            (list (lambda (_beg _end) (setq changes (1+ changes))))))
+      (insert "Zm9v!YmFy")
+      (set-buffer-modified-p nil)
+      (setq changes 0)
+      (should-error (base64-decode-region (point-min) (point-max)))
+      (should (equal (buffer-string) "Zm9v!YmFy"))
+      (should-not (buffer-modified-p))
+      (should (= changes 0))
+      (should (= (base64-decode-region (point-min) (point-max) nil t) 6))
+      (should (equal (buffer-string) "foobar"))
+      (should (= changes 1)))))
+
+(ert-deftest fns-tests-base64-region-hook-changes-text ()
+  "Conversions are redone when `before-change-functions' change the text."
+  (with-temp-buffer
+    (insert "Zm9vYmFy")
+    (let ((before-change-functions
+           (list (lambda (beg _end)
+                   (let ((before-change-functions nil))
+                     (save-excursion
+                       (goto-char beg)
+                       (insert "YmF6")))))))
+      ;; The region is now the inserted text.
+      (should (= (base64-decode-region 1 5) 3))
+      (should (equal (buffer-string) "bazZm9vYmFy")))
+    (erase-buffer)
+    (insert "foo")
+    (let ((before-change-functions
+           (list (lambda (beg end)
+                   (let ((before-change-functions nil))
+                     (delete-region beg end)
+                     (goto-char beg)
+                     (insert "bar"))))))
+      (should (= (base64-encode-region 1 4) 4))
+      (should (equal (buffer-string) "YmFy")))))
+
 (ert-deftest fns-tests-hash-buffer ()
   (should (equal (sha1 "foo") "0beec7b5ea3f0fdbc95d0dd47f3c5bc275da8a33"))
   (should (equal (with-temp-buffer
@@ -987,7 +1103,41 @@ test-string-distance
   (should (equal 1 (string-distance "x" "")))
   (should (equal 1 (string-distance "x" "" t)))
   (should (equal 1 (string-distance "" "x")))
-  (should (equal 1 (string-distance "" "x" t))))
+  (should (equal 1 (string-distance "" "x" t)))
+
+  ;; strings longer than a machine word
+  (let ((a (concat (make-string 70 ?a) "我"))
+        (b (concat "b" (make-string 69 ?a) "她c")))
+    (should (equal 3 (string-distance a b)))
+    (should (equal 3 (string-distance b a)))
+    (should (equal 3 (string-distance (substring a 1) b)))
+    (should (equal 5 (string-distance a b t)))))
+
+(ert-deftest test-string-distance-nearest ()
+  "Test `string-distance-nearest' behavior."
+  (let ((words '("hello" "help" "yellow" "hell" "world" "halo")))
+    (should (equal '("hello") (string-distance-nearest "helo" words)))
+    ;; Ties keep the order of the candidates.
+    (should (equal '("hello" "help" "hell")
+                   (string-distance-nearest "helo" words 3)))
+    (should (equal '("hello" "help" "hell" "halo" "yellow" "world")
+                   (string-distance-nearest "helo" (vconcat words) 10)))
+    (should (equal '("hello" "help" "hell" "halo")
+                   (string-distance-nearest "helo" words 10 1)))
+    (should-not (string-distance-nearest "xyzzy" words 10 2))
+    (should-not (string-distance-nearest "helo" words 0))
+    (should-not (string-distance-nearest "helo" nil))
+    (should (equal '(help) (string-distance-nearest "hlp" '(world help))))
+    (should (equal '("我她") (string-distance-nearest "我" '("ab我她" "我她"))))
+    (should (equal '("a我") (string-distance-nearest "ab" '("a我" "abcd"))))
+    (should (equal '("abcd")
+                   (string-distance-nearest "ab" '("a我" "abcd") 1 nil t))))
+  (let* ((long (make-string 100 ?a))
+         (words (list (concat long "bbb") (concat "b" long) long)))
+    (should (equal (list long (cadr words))
+                   (string-distance-nearest long words 2 2))))
+  (should-error (string-distance-nearest "a" '("b" . "c")))
+  (should-error (string-distance-nearest "a" '("b" 1))))
 
 (ert-deftest test-bignum-eql ()
   "Test that `eql' works for bignums."
@@ -1099,6 +1249,52 @@ test-secure-hash
   (should (string-match "\\`[0-9a-f]\\{128\\}\\'"
                         (secure-hash 'sha512 'iv-auto 100))))
 
+(ert-deftest test-secure-hash-buffer ()
+  ;; Hashing a buffer in place should give the hash of its encoded
+  ;; text, whichever side of the gap the text is on.
+  (let ((text (concat "h\u00e9llo\n\u65e5\u672c\n"
+                      (string (unibyte-char-to-multibyte #xff))
+                      "plain\n")))
+    (dolist (cs '(utf-8-unix utf-8-dos utf-8-with-signature latin-1-unix
+                  raw-text-unix no-conversion))
+      (with-temp-buffer
+        (insert text text)
+        (goto-char 5)
+        (insert "gap")
+        (setq-local buffer-file-coding-system cs)
+        (let* ((select-safe-coding-system-function nil)
+               (hash (secure-hash 'sha256 (current-buffer)))
+               (used last-coding-system-used)
+               (encoded (encode-coding-string (buffer-string) cs)))
+          (should (equal hash (secure-hash 'sha256 encoded)))
+          (should (eq used last-coding-system-used))
+          (should (equal (md5 (current-buffer) 3 12 cs)
+                         (md5 (encode-coding-string
+                               (buffer-substring 3 12) cs))))))))
+  (with-temp-buffer
+    (set-buffer-multibyte nil)
+    (insert "\377\0\200abc")
+    (goto-char 3)
+    (insert "\301")
+    (should (equal (secure-hash 'sha1 (current-buffer))
+                   (secure-hash 'sha1 "\377\0\301\200abc")))))
+
+(ert-deftest test-secure-hash-file ()
+  (ert-with-temp-file file
+    (let ((data (apply #'unibyte-string
+                       (mapcar (lambda (i) (% (* i 7) 256))
+                               (number-sequence 0 100000)))))
+      (let ((coding-system-for-write 'no-conversion))
+        (write-region data nil file nil 'silent))
+      (dolist (algorithm (secure-hash-algorithms))
+        (should (equal (secure-hash-file algorithm file)
+                       (secure-hash algorithm data)))
+        (should (equal (secure-hash-file algorithm file t)
+                       (secure-hash algorithm data nil nil t))))))
+  (should-error (secure-hash-file 'sha1 "/nonexistent/file")
+                :type 'file-missing)
+  (should-error (secure-hash-file 'sha0 null-device)))
+
 (ert-deftest test-vector-delete ()
   (let ((v1 (make-vector 1000 1)))
     (should (equal (delete t (vector nil t)) [nil]))
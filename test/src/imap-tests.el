@@ -0,0 +1,76 @@
+;;; imap-tests.el --- Tests for imap.c  -*- lexical-binding: t; -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is NOT part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+(require 'nnimap)
+
+(defconst imap-tests--response
+  (concat "* 1 FETCH (UID 4 BODY[] {11}\r\n"
+          "6 OK\r\n* x\r\n)\r\n"
+          "* 2 FETCH (UID 5 BODY[] {0}\r\n)\r\n"
+          "6 OK Fetch completed\r\n")
+  "A response whose first literal looks like response lines.")
+
+(ert-deftest imap-test-response-end ()
+  (with-temp-buffer
+    (insert imap-tests--response)
+    (should (equal (nnimap--response-end 1) 45))
+    (should (equal (nnimap--response-end 45) 77))
+    (should (equal (nnimap--response-end 77) 99))
+    (should-not (nnimap--response-end 99))
+    ;; Incomplete literals and lines.
+    (narrow-to-region 1 40)
+    (should-not (nnimap--response-end 1))
+    (narrow-to-region 1 98)
+    (should-not (nnimap--response-end 77))
+    (widen)
+    ;; Braces that do not end the line announce no literal.
+    (erase-buffer)
+    (insert "* OK {3} x\n* BAD {}\n{x}\n")
+    (should (equal (nnimap--response-end 1) 12))
+    (should (equal (nnimap--response-end 12) 21))
+    (should (equal (nnimap--response-end 21) 25))
+    (should-error (nnimap--response-end 26) :type 'args-out-of-range)))
+
+(ert-deftest imap-test-scan-responses ()
+  (with-temp-buffer
+    (let ((nnimap-object (make-nnimap))
+          lines)
+      (insert "5 OK\r\n" (substring imap-tests--response 0 50))
+      (should-not (nnimap-scan-responses 6 (lambda (beg _end)
+                                             (push beg lines))))
+      (should (equal lines '(7 1)))
+      ;; Scanning resumes after the last complete line.
+      (goto-char (point-max))
+      (insert (substring imap-tests--response 50))
+      (should (nnimap-scan-responses 6 (lambda (beg _end)
+                                         (push beg lines))))
+      (should (equal lines '(83 51 7 1)))
+      (should (looking-at "6 OK Fetch"))
+      (should (equal (nnimap-last-tag nnimap-object) 6))
+      ;; A command whose response was scanned before.
+      (goto-char (point-min))
+      (should (nnimap-scan-responses 5))
+      (should (looking-at "5 OK"))
+      (erase-buffer)
+      (should-not (nnimap-scan-responses 7)))))
+
+;;; imap-tests.el ends here
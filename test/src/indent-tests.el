@@ -58,4 +58,30 @@ indent-tests-move-to-column-invis-between-tabs
       (buffer-substring-no-properties 1 14))
     "\txxx    \tLine")))
 
+(ert-deftest indent-tests-column-long-line ()
+  "Test columns far into a long line, with and without checkpoints."
+  (with-temp-buffer
+    (dotimes (i 3000)
+      (insert (if (zerop (% i 7)) "\t" "ab") "中é"))
+    (add-text-properties 100 103 '(invisible t))
+    (add-text-properties 9000 9002 '(display "XYZ"))
+    (let ((positions '(5000 9001 9500 12000 3000 14000)))
+      (let ((columns (mapcar (lambda (pos)
+                               (goto-char pos)
+                               (current-column))
+                             positions)))
+        ;; Change the text, so the columns are computed from the
+        ;; beginning of the line each time.
+        (dolist (pos positions)
+          (goto-char (point-max))
+          (insert "x")
+          (delete-char -1)
+          (goto-char pos)
+          (should (= (current-column) (pop columns))))))
+    (goto-char 6000)
+    (let ((col (current-column)))
+      (goto-char (point-min))
+      (should (= (move-to-column col) col))
+      (should (= (point) 6000)))))
+
 ;;; indent-tests.el ends here
@@ -0,0 +1,95 @@
+;;; nov-tests.el --- Tests for nov.c  -*- lexical-binding: t; -*-
+
+;; Copyright (C) 2024 Free Software Foundation, Inc.
+
+;; This file is NOT part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+(require 'gnus-sum)
+
+(defconst nov-tests--lines
+  (concat
+   "1\tFirst\tA <a@x>\tMon, 1 Jan 2024\t<1@x>\t\t100\t10\tXref: h g:1\n"
+   "3\tRé: First\tB <b@x>\tTue, 2 Jan 2024\t<3@x>\t<1@x>\t200\t20\t\n"
+   "junk line\n"
+   "5\tNo id\tC\tWed\tbogus\t\t\t 3\tg:5\tTo: d@x\tIn-Reply-To: foo <3@x>\n"
+   "7\tLast\tD\tThu\t<7@x>\t<1@x> <3@x>\t7\t1")
+  "Overview lines with a bad line and some odd fields.")
+
+(ert-deftest nov-test-parse-region ()
+  (with-temp-buffer
+    (insert nov-tests--lines)
+    (let* ((parsed (nnheader--parse-nov-region (point-min) (point-max) t))
+           (headers (car parsed)))
+      (should (equal (mapcar #'mail-header-number headers) '(1 3 5 7)))
+      (should (eq (cdr parsed) t))
+      (should (equal (car headers)
+                     [1 "First" "A <a@x>" "Mon, 1 Jan 2024" "<1@x>" ""
+                      100 10 "h g:1" nil]))
+      (should (equal (mail-header-subject (nth 1 headers)) "Ré: First"))
+      (should-not (mail-header-xref (nth 1 headers)))
+      (let ((header (nth 2 headers)))
+        ;; The Message-ID is left for the caller to make up, and the
+        ;; references come from In-Reply-To.
+        (should-not (mail-header-id header))
+        (should (equal (mail-header-references header) "<3@x>"))
+        (should (equal (mail-header-chars header) 0))
+        (should (equal (mail-header-lines header) 3))
+        (should (equal (mail-header-extra header)
+                       '((In-Reply-To . "foo <3@x>") (To . "d@x")))))
+      (should (equal (mail-header-references (nth 3 headers))
+                     "<1@x> <3@x>"))
+      (should (null (mail-header-xref (nth 3 headers)))))))
+
+(ert-deftest nov-test-parse-region-articles ()
+  (with-temp-buffer
+    (insert nov-tests--lines)
+    (let ((parsed (nnheader--parse-nov-region (point-min) (point-max)
+                                              '(2 3 7 8))))
+      (should (equal (mapcar #'mail-header-number (car parsed)) '(3 7)))
+      (should (equal (cdr parsed) '(8))))
+    ;; Parsing stops once the articles run out.
+    (should (equal (cdr (nnheader--parse-nov-region (point-min) (point-max)
+                                                    '(1)))
+                   nil))
+    (should (equal (length (car (nnheader--parse-nov-region
+                                 (point-min) (point-max) '(1))))
+                   1))))
+
+(ert-deftest nov-test-parse-region-like-lisp ()
+  "The headers match those that `nnheader-parse-nov' makes."
+  (with-temp-buffer
+    (insert nov-tests--lines)
+    (let ((gnus-newsgroup-name "g")
+          (gnus-decode-encoded-word-function #'identity)
+          (gnus-decode-encoded-address-function #'identity)
+          (headers (car (nnheader--parse-nov-region (point-min) (point-max)
+                                                    t))))
+      (goto-char (point-min))
+      (dolist (header headers)
+        (unless (looking-at "[0-9]")
+          (forward-line 1))
+        (let ((lisp (save-restriction
+                      (narrow-to-region (point) (line-end-position))
+                      (nnheader-parse-nov))))
+          (unless (mail-header-id header)
+            (setf (mail-header-id header) (mail-header-id lisp)))
+          (should (equal header lisp)))
+        (forward-line 1)))))
+
+;;; nov-tests.el ends here
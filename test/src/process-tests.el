@@ -188,6 +188,31 @@ set-process-filter-t
         (accept-process-output proc))   ; Read "Two".
       (should (equal (buffer-string) "0> one\n1> two\n2> "))))))
 
+(ert-deftest process-test-default-filter-direct ()
+  "Check output the default filter decodes straight into the buffer."
+  (skip-unless (executable-find "sh"))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (with-temp-buffer
+      (insert "0> ")
+      (let* ((changes 0)
+             (marker (point-marker))
+             ;; Split a multibyte character across two reads.
+             (proc (make-process
+                    :name "test proc" :buffer (current-buffer)
+                    :command '("sh" "-c" "printf 'h\\303'; sleep 0.2; \
+printf '\\251llo \\342\\230\\203\\n'")
+                    :coding 'utf-8-unix :connection-type 'pipe
+                    :sentinel #'ignore)))
+        (add-hook 'after-change-functions
+                  (lambda (&rest _) (cl-incf changes)) nil t)
+        (goto-char (point-min))
+        (while (not (equal (buffer-string) "0> héllo ☃\n"))
+          (accept-process-output nil 0.1))
+        (should (= (point) (point-min)))
+        (should (= marker (point-max)))
+        (should (= (process-mark proc) (point-max)))
+        (should (< 1 changes))))))
+
 (ert-deftest start-process-should-not-modify-arguments ()
   "`start-process' must not modify its arguments in-place."
   ;; See bug#21831.
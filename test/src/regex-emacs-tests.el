@@ -998,4 +998,125 @@ regex-tests-mutual-exclusive-inf-rec
   ;; relint suppression: Repetition of expression matching an empty string
   (should (equal (string-match "a*\\(?:c\\|b*\\)*" "a") 0)))
 
+;; The searcher skips between occurrences of a literal that every
+;; match must contain; make sure that never loses a match.
+(ert-deftest regex-tests-required-literal ()
+  (let ((case-fold-search nil))
+    (dolist (str '("xx defun-x defun" "a" "dddefun defun"))
+      (dolist (re '("\\_<defun\\_>" "d*efun$" "\\(?:x\\|de\\)fun"
+                    "x+ \\(def\\)un" "[a-z]\\{2\\}fun" "\\(d\\)\\1efun"))
+        (let ((expected (catch 'found
+                          (dotimes (i (1+ (length str)))
+                            (when (eq (string-match re str i) i)
+                              (throw 'found i))))))
+          (should (equal (string-match re str) expected))
+          (with-temp-buffer
+            (insert str)
+            ;; Put the gap in the middle of the text.
+            (goto-char 8)
+            (insert "*")
+            (delete-char -1)
+            (goto-char (point-min))
+            (should (equal (and (re-search-forward re nil t)
+                                (1- (match-beginning 0)))
+                           expected))
+            (goto-char (point-max))
+            (let ((last (catch 'found
+                          (let ((i (length str)))
+                            (while (>= i 0)
+                              (goto-char (1+ i))
+                              (when (looking-at re)
+                                (throw 'found i))
+                              (setq i (1- i)))))))
+              (goto-char (point-max))
+              (should (equal (and (re-search-backward re nil t)
+                                  (1- (match-beginning 0)))
+                             last)))))))
+    ;; Unibyte pattern against multibyte text and back.
+    (should (equal (string-match "é+x" "aéé éx") 4))
+    (should (equal (string-match (string-to-unibyte "\\(?:ab\\)+c")
+                                 "éababc")
+                   1))
+    (should (equal (string-match "ab\\(?:é\\)*c"
+                                 (string-to-unibyte "xxabc"))
+                   2))))
+
+(ert-deftest regex-tests-exponential-backtracking ()
+  "Patterns that backtrack exponentially still fail or match quickly."
+  (let ((case-fold-search nil)
+        (str (concat (make-string 1000 ?a) "!")))
+    (dolist (re '("\\(a*\\)*b" "\\(?:a\\|aa\\)*c" "\\(?:a*\\)*?b"
+                  "\\(a\\|a\\)*b"))
+      (should-not (string-match re str)))
+    (should (equal (string-match "\\(a\\|aa\\)*!" str) 0))
+    (should (equal (match-data) '(0 1001 999 1000)))
+    (with-temp-buffer
+      (insert str)
+      ;; Put the gap in the middle of the text.
+      (goto-char 500)
+      (insert "*")
+      (delete-char -1)
+      (goto-char (point-min))
+      (should-not (re-search-forward "\\(a*\\)*b" nil t))
+      (should (looking-at "\\(a*\\)*!"))
+      (should (equal (match-end 0) 1002))
+      (should (equal (match-beginning 1) 1001))
+      (goto-char (point-max))
+      (should-not (re-search-backward "\\(a*\\)*b" nil t)))))
+
+(ert-deftest regex-tests-exponential-backtracking-bound ()
+  "Patterns that backtrack exponentially respect the search bound."
+  (let ((case-fold-search nil))
+    (with-temp-buffer
+      (insert (make-string 1000 ?a) " b")
+      (goto-char 500)
+      (insert "*")
+      (delete-char -1)
+      ;; A word starts at the bound, but the bound ends the text the
+      ;; match may look at.
+      (goto-char (point-min))
+      (should-not (re-search-forward "\\(?:a*\\)* \\<" 1002 t))
+      (should-not (re-search-forward "\\(?:a*\\)* \\_<" 1002 t))
+      (should (equal (re-search-forward "\\(?:a*\\)* \\<" 1003 t) 1002))
+      (goto-char (point-min))
+      (should (equal (re-search-forward "\\(?:a*\\)* \\_<" nil t)
+                     1002)))))
+
+;; When case is ignored, the searcher looks for the required literal in
+;; either case.
+(ert-deftest regex-tests-required-literal-case-fold ()
+  (dolist (str '("xx DeFun-x DEFUN" "dddEFUN defun" "XXX  DEF"
+                 "\u017fefun xdefun"))
+    (dolist (re '("\\_<defun\\_>" "d*efun$" "\\(?:x\\|de\\)fun"
+                  "x+ \\(def\\)un" "[a-z]\\{2\\}fun" "sefun"))
+      (let ((expected (let ((case-fold-search nil))
+                        (string-match re (downcase str)))))
+        (let ((case-fold-search t))
+          (should (equal (string-match re str) expected))
+          (with-temp-buffer
+            (insert str)
+            ;; Put the gap in the middle of the text.
+            (goto-char 8)
+            (insert "*")
+            (delete-char -1)
+            (goto-char (point-min))
+            (should (equal (and (re-search-forward re nil t)
+                                (1- (match-beginning 0)))
+                           expected))))))))
+
+;; The first alternative backtracks enough on the longer string that the
+;; search falls back to the other matcher, which must agree with the
+;; backtracking one about the nested loops matching the empty string.
+(ert-deftest regex-tests-nested-empty-loops ()
+  "Both matchers set the same match data for nested empty loops."
+  (let ((case-fold-search nil)
+        (re "\\(?:a\\|a\\)*b\\|\\(\\(\\(?:\\'\\)*\\)+\\|[^c]\\)+"))
+    (should (equal (string-match re "aaaa\nded\n") 0))
+    (let ((short (match-data)))
+      (should (equal short '(0 0 0 0 0 0)))
+      (should (equal (string-match re (concat (make-string 14 ?a)
+                                              "\nded\n"))
+                     0))
+      (should (equal (match-data) short)))))
+
 ;;; regex-emacs-tests.el ends here
@@ -77,4 +77,53 @@ search-test--replace-match-update-data
         ;;(should (equal (match-end 2) beg4))
         ))))
 
+(ert-deftest search-test-forward-regexps ()
+  (with-temp-buffer
+    (insert "one two three two one")
+    (goto-char (point-min))
+    (let ((case-fold-search nil))
+      ;; The earliest match wins, whatever the order of the regexps.
+      (should (equal (search-forward-regexps '("thr\\(ee\\)" "t\\(wo\\)")) 1))
+      (should (equal (point) 8))
+      (should (equal (match-beginning 1) 6))
+      (should (equal (match-string 0) "two"))
+      ;; On a tie, the first regexp wins.
+      (should (equal (search-forward-regexps ["th" "thr\\(e\\)+"]) 0))
+      (should (equal (point) 11))
+      (should (equal (match-beginning 1) nil))
+      (should (equal (search-forward-regexps ["x" "o" "w"] 18) 2))
+      (should (equal (point) 17))
+      (should-not (search-forward-regexps '("two" "x") 20 t))
+      (should (equal (point) 17))
+      (should-not (search-forward-regexps '("x") nil 'move))
+      (should (equal (point) (point-max)))
+      (should-error (search-forward-regexps '("x")) :type 'search-failed)
+      (goto-char (point-min))
+      (let ((case-fold-search t))
+        (should (equal (search-forward-regexps '("TWO" "ONE")) 1))))))
+
+(ert-deftest search-test-regexps-in-region ()
+  (with-temp-buffer
+    (insert "a.c:1: error\nnote\nb.c:22: warning\n")
+    (set-match-data '(1 2))
+    (let ((case-fold-search nil))
+      (should (equal (search-regexps-in-region
+                      '("^\\([a-z.]+\\):\\([0-9]+\\)" nil "warning\\|\\(x\\)"
+                        "o")
+                      (point-min) (point-max))
+                     '((0 1 6 1 4 5 6) (3 11 12) (3 15 16) (0 19 25 19 22 23 25)
+                       (2 27 34))))
+      ;; Matches must lie within the region, and anchors respect it.
+      (should (equal (search-regexps-in-region ["^note" "e"] 15 (point-max))
+                     '((1 17 18))))
+      ;; An empty match is found only once.
+      (should (equal (search-regexps-in-region ["x*"] 1 3)
+                     '((0 1 1) (0 2 2) (0 3 3))))
+      (should-error (search-regexps-in-region '("\\(") 1 2)
+                    :type 'invalid-regexp))
+    (let ((case-fold-search t))
+      (should (equal (search-regexps-in-region '("NOTE") 1 (point-max))
+                     '((0 14 18)))))
+    (should (equal (match-data) '(1 2)))))
+
 ;;; search-tests.el ends here
@@ -98,6 +98,30 @@ parse-partial-sexp-paren-comments
       (should (equal (parse-partial-sexp pointC pointX nil nil ppsC)
                      ppsX)))))
 
+(ert-deftest parse-partial-sexp-states ()
+  "Test that `parse-partial-sexp-states' parses as `parse-partial-sexp'."
+  (with-temp-buffer
+    (let ((table (make-syntax-table)))
+      (modify-syntax-entry ?/ ". 124b" table)
+      (modify-syntax-entry ?* ". 23" table)
+      (modify-syntax-entry ?\n "> b" table)
+      (set-syntax-table table))
+    (dotimes (i 500)
+      (insert (format "/* %d ( */ f (a, \"s)\\\" (\") { // x\n g (b); }\n"
+                      i)))
+    (insert (make-string 300 ?\() "\"" (make-string 200 ?\)))
+    (let* ((positions (number-sequence (point-min) (point-max) 7))
+           (oldstate (parse-partial-sexp (point-min) (car positions)))
+           (states (let ((parse-sexp-parallel-threshold 1))
+                     (parse-partial-sexp-states positions oldstate))))
+      (should (= (point) (car (last positions))))
+      (should (= (length states) (1- (length positions))))
+      (cl-loop for (from to) on positions while to
+               for state = (parse-partial-sexp from to nil nil oldstate)
+               then (parse-partial-sexp from to nil nil state)
+               do (should (equal state (pop states)))))
+    (should-error (parse-partial-sexp-states (list 10 5)))))
+
 
 ;;; Commentary:
 ;; The next bit tests the handling of comments in syntax.c, in
@@ -25,14 +25,24 @@
 
 ;; Declare the functions in case Emacs has been configured --without-threads.
 (declare-function all-threads "thread.c" ())
+(declare-function channel-name "thread.c" (channel))
+(declare-function channel-receive "thread.c" (channel))
+(declare-function channel-send "thread.c" (channel object))
+(declare-function channel-try-receive "thread.c" (channel &optional default))
+(declare-function channelp "thread.c" (object))
 (declare-function condition-mutex "thread.c" (cond))
 (declare-function condition-name "thread.c" (cond))
 (declare-function condition-notify "thread.c" (cond &optional all))
 (declare-function condition-wait "thread.c" (cond))
 (declare-function current-thread "thread.c" ())
+(declare-function future-await "thread.c" (future))
+(declare-function future-done-p "thread.c" (future))
+(declare-function futurep "thread.c" (object))
+(declare-function make-channel "thread.c" (&optional capacity name))
 (declare-function make-condition-variable "thread.c" (mutex &optional name))
 (declare-function make-mutex "thread.c" (&optional name))
 (declare-function make-thread "thread.c" (function &optional name noncooperative))
+(declare-function make-thread-pool "thread.c" (&optional size name))
 (declare-function mutex-lock "thread.c" (mutex))
 (declare-function mutex-unlock "thread.c" (mutex))
 (declare-function thread--blocker "thread.c" (thread))
@@ -40,6 +50,9 @@
 (declare-function thread-join "thread.c" (thread))
 (declare-function thread-last-error "thread.c" (&optional cleanup))
 (declare-function thread-name "thread.c" (thread))
+(declare-function thread-pool-p "thread.c" (object))
+(declare-function thread-pool-shutdown "thread.c" (pool))
+(declare-function thread-pool-submit "thread.c" (pool function))
 (declare-function thread-signal "thread.c" (thread error-symbol data))
 (declare-function thread-yield "thread.c" ())
 (defvar main-thread)
@@ -605,6 +618,200 @@ thread-test-trivial-multithread
           results)
     (should (= (length results) 4))))
 
+(ert-deftest thread-test-uncooperative-search ()
+  "Uncooperative threads search text the main thread is changing."
+  (skip-unless (featurep 'threads))
+  (skip-unless (cl-search "enable-multithreading" system-configuration-options))
+  (with-temp-buffer
+    (dotimes (_ 100) (insert "xxxx\n"))
+    (let ((indirects
+           (mapcar (lambda (_)
+                     (make-indirect-buffer
+                      (current-buffer)
+                      (generate-new-buffer-name " *thread-search*") nil t))
+                   '(1 2)))
+          results denied)
+      (unwind-protect
+          (progn
+            (dolist (indirect indirects)
+              (make-thread
+               (lambda ()
+                 (with-current-buffer indirect
+                   (dotimes (_ 50)
+                     (goto-char (point-min))
+                     (while (re-search-forward "^x+$" nil t)
+                       (goto-char (match-end 0))
+                       (unless (equal (match-string 0) "xxxx")
+                         (push (match-string 0) results))))
+                   (condition-case err
+                       (insert "y")
+                     (error (push err denied)))))
+               nil :multi))
+            (dotimes (_ 100)
+              (save-excursion
+                (goto-char (point-max))
+                (insert "xxxx\n"))
+              (thread-yield))
+            (while (> (length (all-threads)) 1) (sleep-for 0.1))
+            (should-not results)
+            (should (= (length denied) 2))
+            (should (= (buffer-size) (* 200 5))))
+        (mapc #'kill-buffer indirects)))))
+
+(ert-deftest thread-test-uncooperative-search-far ()
+  "Uncooperative threads find matches far apart and leave point alone."
+  (skip-unless (featurep 'threads))
+  (skip-unless (cl-search "enable-multithreading" system-configuration-options))
+  (with-temp-buffer
+    ;; Multibyte text, with matches too far apart for the positions of
+    ;; one to be counted quickly from those of the last.
+    (dotimes (i 20)
+      (insert (make-string 6000 ?é) (format "needle-%d\n" i)))
+    (goto-char (point-min))
+    (let ((buffer (current-buffer))
+          (re "needle-\\([0-9]+\\)")
+          expected indirects threads)
+      (while (re-search-forward re nil t)
+        (push (cons (match-beginning 0) (match-string 1)) expected))
+      (goto-char 10)
+      (unwind-protect
+          (progn
+            (dotimes (_ 2)
+              (let ((indirect (make-indirect-buffer
+                               buffer
+                               (generate-new-buffer-name " *thread-search*")
+                               nil t)))
+                (push indirect indirects)
+                (push (make-thread
+                       (lambda ()
+                         (let (ends found)
+                           ;; Searching the buffer itself gives the end
+                           ;; of the match but leaves point.
+                           (with-current-buffer buffer
+                             (push (re-search-forward re nil t) ends)
+                             (push (point) ends))
+                           ;; In a buffer of its own, the thread may
+                           ;; move point.
+                           (with-current-buffer indirect
+                             (dotimes (_ 5)
+                               (goto-char (point-min))
+                               (while (re-search-forward re nil t)
+                                 (goto-char (match-end 0))
+                                 (push (cons (match-beginning 0)
+                                             (match-string 1))
+                                       found))))
+                           (list ends found)))
+                       nil :multi)
+                      threads)))
+            (dolist (thread threads)
+              (let ((result (thread-join thread)))
+                (should (equal (car result) (list 10 6009)))
+                (should (equal (cadr result)
+                               (apply #'append
+                                      (make-list 5 expected))))))
+            (should (= (point) 10)))
+        (mapc #'kill-buffer indirects)))))
+
+(ert-deftest thread-test-pool ()
+  "Thread pools run futures, nested ones included, and report errors."
+  (skip-unless (featurep 'threads))
+  (skip-unless (cl-search "enable-multithreading" system-configuration-options))
+  (let ((pool (make-thread-pool 3 "test-pool")))
+    (unwind-protect
+        (progn
+          (should (thread-pool-p pool))
+          (should (eq (type-of pool) 'thread-pool))
+          (let ((futures (mapcar (lambda (n)
+                                   (thread-pool-submit
+                                    pool (lambda () (make-list 1000 n))))
+                                 (number-sequence 1 100))))
+            (should (futurep (car futures)))
+            (should (equal (mapcar (lambda (f) (car (future-await f)))
+                                   futures)
+                           (number-sequence 1 100)))
+            (should (future-done-p (car futures))))
+          (should (= (future-await
+                      (thread-pool-submit
+                       pool
+                       (lambda ()
+                         (apply #'+ (mapcar #'future-await
+                                            (mapcar (lambda (k)
+                                                      (thread-pool-submit
+                                                       pool (lambda () (* k k))))
+                                                    '(1 2 3)))))))
+                     14))
+          (should (equal (should-error
+                          (future-await
+                           (thread-pool-submit pool (lambda () (error "Boom")))))
+                         '(error "Boom"))))
+      (thread-pool-shutdown pool))
+    (should-error (thread-pool-submit pool #'ignore))
+    (while (> (length (all-threads)) 1) (sleep-for 0.1))))
+
+(ert-deftest thread-test-pool-await-lets-threads-run ()
+  "Other threads run while the main thread awaits a future."
+  (skip-unless (featurep 'threads))
+  (skip-unless (cl-search "enable-multithreading" system-configuration-options))
+  (setq thread-test-global nil)
+  (let ((pool (make-thread-pool 1)))
+    (unwind-protect
+        (let ((future (thread-pool-submit
+                       pool (lambda ()
+                              ;; Lisp mutexes and condition variables
+                              ;; need the global lock, so poll.
+                              (while (not thread-test-global))
+                              (1+ thread-test-global)))))
+          ;; This thread is cooperative, so it needs the global lock.
+          (make-thread (lambda () (setq thread-test-global 41)))
+          (should (= (future-await future) 42)))
+      (thread-pool-shutdown pool))
+    (while (> (length (all-threads)) 1) (sleep-for 0.1))))
+
+(ert-deftest thread-test-pmapcar ()
+  "`pmapcar' is `mapcar' whether or not it runs in parallel."
+  (should (equal (pmapcar #'1+ '(1 2 3)) '(2 3 4)))
+  (should (equal (pmapcar #'upcase ["a" "b"]) '("A" "B")))
+  (should-not (pmapcar #'ignore nil))
+  (when (bound-and-true-p thread--pmapcar-pool)
+    (thread-pool-shutdown thread--pmapcar-pool)
+    (setq thread--pmapcar-pool nil)
+    (while (> (length (all-threads)) 1) (sleep-for 0.1))))
+
+(ert-deftest thread-test-native-channel ()
+  "Channels pass objects in order and block when full or empty."
+  (skip-unless (featurep 'threads))
+  (let ((channel (make-channel 2 "test-channel"))
+        received)
+    (should (channelp channel))
+    (should (equal (channel-name channel) "test-channel"))
+    (should (eq (channel-try-receive channel 'empty) 'empty))
+    (let ((sender (make-thread
+                   (lambda ()
+                     (dotimes (i 10) (channel-send channel i))
+                     (channel-send channel nil)))))
+      (while (let ((object (channel-receive channel)))
+               (when object (push object received))
+               object))
+      (thread-join sender))
+    (should (equal (nreverse received) (number-sequence 0 9)))
+    (should-error (make-channel 0))))
+
+(ert-deftest thread-test-uncooperative-channel ()
+  "Uncooperative senders feed a cooperative receiver."
+  (skip-unless (featurep 'threads))
+  (skip-unless (cl-search "enable-multithreading" system-configuration-options))
+  (let ((channel (make-channel 4))
+        (sum 0))
+    (dotimes (k 3)
+      (make-thread (lambda ()
+                     (dotimes (i 1000)
+                       (channel-send channel (make-list 10 (+ i (* k 1000))))))
+                   nil :multi))
+    (dotimes (_ 3000)
+      (setq sum (+ sum (car (channel-receive channel)))))
+    (should (= sum (/ (* 2999 3000) 2)))
+    (while (> (length (all-threads)) 1) (sleep-for 0.1))))
+
 (ert-deftest thread-test-cconv ()
   "Thread obarrays under --enable-multithreading bork cconv.
 This test should just work under --disable-multithreading too."